@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) 2026 The flow-tools authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *      $Id$
+ */
+
+#include "ftinclude.h"
+#include "ftlib.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Reader for the binary report output of flow-report (format binary).
+ *
+ * A file is a sequence of blocks, one per report output or time series
+ * interval.  A block is a struct ftbin_hdr, hdr.ncols struct ftbin_col
+ * and hdr.nrows fixed size rows.  Rows are read FT_BIN_BUFSIZE bytes at
+ * a time and handed out in place.
+ *
+ *   struct ftbin ftb;
+ *   char *row;
+ *   int c;
+ *
+ *   ftbin_open(&ftb, stdin);
+ *   while (ftbin_next(&ftb) == 1) {
+ *     c = ftbin_col_find(&ftb, "octets");
+ *     while ((row = ftbin_read(&ftb)))
+ *       ... ftbin_col_u64(&ftb, row, c) ...
+ *   }
+ *   ftbin_close(&ftb);
+ */
+
+/*
+ * function: ftbin_open
+ *
+ * Start reading binary report blocks from fp.  The caller owns fp.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftbin_open(struct ftbin *ftb, FILE *fp)
+{
+
+  bzero(ftb, sizeof *ftb);
+  ftb->fp = fp;
+
+  return 0;
+
+} /* ftbin_open */
+
+/*
+ * function: ftbin_next
+ *
+ * Skip what is left of the current block and read the header and
+ * columns of the next one into ftb->hdr and ftb->cols.
+ *
+ * returns: 1  block ready
+ *          0  end of file
+ *          <0 fail
+ */
+int ftbin_next(struct ftbin *ftb)
+{
+  uint64_t skip;
+  size_t n;
+  int i;
+
+  /* rest of the previous block */
+  if (ftb->left) {
+    skip = ftb->left * ftb->hdr.row_size;
+    if (fseeko(ftb->fp, (off_t)skip, SEEK_CUR) < 0) {
+      /* pipe */
+      while (ftb->left) {
+        n = (ftb->left > ftb->buf_rows) ? ftb->buf_rows : ftb->left;
+        if (fread(ftb->buf, ftb->hdr.row_size, n, ftb->fp) != n) {
+          fterr_warnx("ftbin_next(): short block.");
+          return -1;
+        }
+        ftb->left -= n;
+      }
+    }
+    ftb->left = 0;
+  }
+
+  ftb->nbuf = ftb->ibuf = 0;
+
+  n = fread(&ftb->hdr, 1, sizeof ftb->hdr, ftb->fp);
+
+  if (n == 0)
+    return 0;
+
+  if (n != sizeof ftb->hdr) {
+    fterr_warnx("ftbin_next(): short header.");
+    return -1;
+  }
+
+  if (ftb->hdr.magic != FT_BIN_MAGIC) {
+    fterr_warnx("ftbin_next(): bad magic, not a binary report or other byte order.");
+    return -1;
+  }
+
+  if (ftb->hdr.version != FT_BIN_VERSION) {
+    fterr_warnx("ftbin_next(): unsupported version %d.",
+      (int)ftb->hdr.version);
+    return -1;
+  }
+
+  if ((ftb->hdr.ncols > FT_BIN_MAXCOLS) || (!ftb->hdr.row_size)) {
+    fterr_warnx("ftbin_next(): bad header.");
+    return -1;
+  }
+
+  if (fread(ftb->cols, sizeof ftb->cols[0], ftb->hdr.ncols, ftb->fp) !=
+    ftb->hdr.ncols) {
+    fterr_warnx("ftbin_next(): short column list.");
+    return -1;
+  }
+
+  for (i = 0; i < ftb->hdr.ncols; ++i) {
+    ftb->cols[i].name[FT_BIN_COLLEN-1] = 0;
+    if (ftb->cols[i].offset + ftb->cols[i].size > ftb->hdr.row_size) {
+      fterr_warnx("ftbin_next(): column %s outside row.", ftb->cols[i].name);
+      return -1;
+    }
+  }
+
+  ftb->hdr.name[FT_BIN_NAMELEN-1] = 0;
+  ftb->hdr.type[FT_BIN_NAMELEN-1] = 0;
+
+  /* read buffer holds at least one row */
+  n = FT_BIN_BUFSIZE / ftb->hdr.row_size;
+  if (!n)
+    n = 1;
+
+  if (n != ftb->buf_rows) {
+    if (ftb->buf)
+      free(ftb->buf);
+    if (!(ftb->buf = (char*)malloc(n * ftb->hdr.row_size))) {
+      fterr_warn("malloc()");
+      ftb->buf_rows = 0;
+      return -1;
+    }
+    ftb->buf_rows = n;
+  }
+
+  ftb->left = ftb->hdr.nrows;
+
+  return 1;
+
+} /* ftbin_next */
+
+/*
+ * function: ftbin_read
+ *
+ * Next row of the current block.  The row is valid until the following
+ * ftbin_read() or ftbin_next().
+ *
+ * returns: pointer to the row
+ *          0L at the end of the block or on error
+ */
+char *ftbin_read(struct ftbin *ftb)
+{
+  size_t n;
+
+  if (ftb->ibuf == ftb->nbuf) {
+
+    if (!ftb->left)
+      return (char*)0L;
+
+    n = (ftb->left > ftb->buf_rows) ? ftb->buf_rows : ftb->left;
+
+    if (fread(ftb->buf, ftb->hdr.row_size, n, ftb->fp) != n) {
+      fterr_warnx("ftbin_read(): short block.");
+      ftb->left = 0;
+      ftb->nbuf = ftb->ibuf = 0;
+      return (char*)0L;
+    }
+
+    ftb->left -= n;
+    ftb->nbuf = n;
+    ftb->ibuf = 0;
+
+  }
+
+  return ftb->buf + (size_t)(ftb->ibuf++) * ftb->hdr.row_size;
+
+} /* ftbin_read */
+
+/*
+ * function: ftbin_col_find
+ *
+ * Column of the current block by name.
+ *
+ * returns: column index
+ *          -1 not in this block
+ */
+int ftbin_col_find(struct ftbin *ftb, const char *name)
+{
+  int i;
+
+  for (i = 0; i < ftb->hdr.ncols; ++i)
+    if (!strcmp(ftb->cols[i].name, name))
+      return i;
+
+  return -1;
+
+} /* ftbin_col_find */
+
+/*
+ * function: ftbin_col_u64
+ *
+ * Value of an integer column, doubles are truncated.
+ *
+ * returns: value
+ */
+uint64_t ftbin_col_u64(struct ftbin *ftb, char *row, int col)
+{
+  struct ftbin_col *c;
+  uint64_t v64;
+  uint32_t v32;
+  uint16_t v16;
+  double d;
+
+  c = &ftb->cols[col];
+  row += c->offset;
+
+  switch (c->type) {
+
+    case FT_BIN_TYPE_U8:
+      return (uint8_t)*row;
+
+    case FT_BIN_TYPE_U16:
+      bcopy(row, &v16, sizeof v16);
+      return v16;
+
+    case FT_BIN_TYPE_U32:
+    case FT_BIN_TYPE_IPV4:
+      bcopy(row, &v32, sizeof v32);
+      return v32;
+
+    case FT_BIN_TYPE_U64:
+      bcopy(row, &v64, sizeof v64);
+      return v64;
+
+    case FT_BIN_TYPE_DOUBLE:
+      bcopy(row, &d, sizeof d);
+      return (uint64_t)d;
+
+  } /* switch */
+
+  return 0;
+
+} /* ftbin_col_u64 */
+
+/*
+ * function: ftbin_col_double
+ *
+ * Value of any column as a double.
+ *
+ * returns: value
+ */
+double ftbin_col_double(struct ftbin *ftb, char *row, int col)
+{
+  double d;
+
+  if (ftb->cols[col].type == FT_BIN_TYPE_DOUBLE) {
+    bcopy(row + ftb->cols[col].offset, &d, sizeof d);
+    return d;
+  }
+
+  return (double)ftbin_col_u64(ftb, row, col);
+
+} /* ftbin_col_double */
+
+/*
+ * function: ftbin_close
+ *
+ * Free the read buffer.  ftb->fp is left open.
+ */
+void ftbin_close(struct ftbin *ftb)
+{
+
+  if (ftb->buf)
+    free(ftb->buf);
+
+  bzero(ftb, sizeof *ftb);
+
+} /* ftbin_close */
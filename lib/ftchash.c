@@ -29,8 +29,12 @@
 #include "ftconfig.h"
 #include "ftlib.h"
 
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <unistd.h>
 
 #if HAVE_STRINGS_H
  #include <strings.h>
@@ -39,20 +43,275 @@
   #include <string.h>
 #endif
 
-int sort_offset;
-static int cmp64(const void *a, const void *b);
-static int cmp40(const void *a, const void *b);
-static int cmp32(const void *a, const void *b);
-static int cmp16(const void *a, const void *b);
-static int cmp8(const void *a, const void *b);
-static int cmp_double(const void *a, const void *b);
+/*
+ * The table is an open addressing index of (hash, record) slots in front
+ * of the chunk allocated records.  Collisions are resolved with linear
+ * probing in Robin Hood order: an entry never sits further from its home
+ * slot than the entry it displaced, so a lookup can stop at the first
+ * slot that is closer to home than the probe distance.
+ *
+ * The index doubles once it is 7/8 full.  The old index is migrated a
+ * few slots per update instead of all at once so a single update never
+ * stalls for the size of the table.  Lookups consult both indexes until
+ * the migration completes.  Migrated slots are left with FT_CHASH_MOVED
+ * so probe sequences through them stay intact.
+ *
+ * A table given a memory limit with ftchash_limit() does not grow past
+ * it.  When the next chunk would not fit, the records are sorted by key
+ * and written to a run file, and the table starts over empty.
+ * ftchash_unspill() k-way merges the runs back into exact records.
+ *
+ * A table given a bound with ftchash_bound() is a Space-Saving summary
+ * (Metwally et al. 2005) of at most that many records.  A new key
+ * arriving at a full table takes over the record with the smallest
+ * ranking counter and inherits its value, so counters only overestimate
+ * and by no more than the largest value taken over.  The smallest record
+ * comes from a min heap of counter snapshots.  Updates to existing keys
+ * do not touch the heap, the snapshots only lag and are refreshed when
+ * they reach the top.
+ */
+
+#define FT_CHASH_MIN_SIZE   16
+#define FT_CHASH_MIGRATE    8      /* old slots migrated per update */
+#define FT_CHASH_ISORT      16     /* insertion sort runs up to this size */
+#define FT_CHASH_RADIX_MIN  4096   /* radix sort tables this size and up */
+#define FT_CHASH_LIMIT_CHUNKS 8    /* chunks that fit in a memory limit */
+#define FT_CHASH_MERGE_RUNS 8      /* runs of a level merged into one */
+
+/*
+ * internal sort flag, compare the key bytes with memcmp().  The key
+ * size is carried in the upper bits of flags.
+ */
+#define FT_CHASH_SORT_KEY   0x100
+#define FT_CHASH_KEY_FLAGS(ftch) (FT_CHASH_SORT_KEY | ((ftch)->key_size << 16))
+
+static char ftchash_moved;
+#define FT_CHASH_MOVED ((void*)&ftchash_moved)
+
+
+struct ftchash_kp {
+  uint64_t key;                              /* sort field as integer */
+  void *rec;                                 /* record */
+};
+
+struct ftchash_topk {
+  void *rec;                                 /* record */
+  uint64_t idx;                              /* traversal order */
+};
+
+struct ftchash_src {
+  FILE *fp;                                  /* run */
+  char *rec;                                 /* current record */
+  uint64_t left;                             /* records not yet merged */
+  unsigned int run;                          /* run number, breaks ties */
+};
+
+struct ftchash_sel {
+  struct ftchash_topk *heap;                 /* selected, worst first */
+  char *store;                               /* record copies for heap */
+  uint64_t n;                                /* entries in heap */
+};
+
+static int cmp_val(const char *a, const char *b, int offset, int flags);
+static void msort_recs(void **a, void **tmp, uint64_t n, int offset,
+  int flags);
+static int rsort_recs(void **a, uint64_t n, int offset, int flags);
+static int topk_cmp(struct ftchash_topk *a, struct ftchash_topk *b,
+  int offset, int flags, int largest);
+static void topk_siftup(struct ftchash_topk *heap, uint64_t i, int offset,
+  int flags, int largest);
+static void topk_siftdown(struct ftchash_topk *heap, uint64_t n, uint64_t i,
+  int offset, int flags, int largest);
+
+static void ftchash_place(struct ftchash_slot *slots, uint32_t mask,
+  uint32_t hash, void *rec);
+static void ftchash_migrate(struct ftchash *ftch, unsigned int n);
+static int ftchash_grow(struct ftchash *ftch);
+static void ftchash_clear(struct ftchash *ftch);
+static void ftchash_free_runs(struct ftchash *ftch);
+static int ftchash_spill(struct ftchash *ftch);
+static FILE *ftchash_tmpfile(void);
+static int ftchash_emit(struct ftchash *ftch, char *acc,
+  void (*f_final)(void *rec, void *arg), void *arg,
+  struct ftchash_keep *keep, struct ftchash_sel *sel, int nkeep, uint64_t c);
+static int ftchash_compact(struct ftchash *ftch, unsigned int first);
+static int src_open(struct ftchash *ftch, unsigned int first,
+  struct ftchash_src **srcp, unsigned int *nsrcp);
+static int src_next(struct ftchash *ftch, struct ftchash_src *src,
+  unsigned int *nsrcp);
+static void src_close(struct ftchash_src *src, unsigned int nsrc);
+static void src_siftdown(struct ftchash_src *heap, unsigned int n,
+  unsigned int i, int keyoff, int kflags);
+static int topk_idx_cmp(const void *a, const void *b);
+static void ftchash_unplace(struct ftchash_slot *slots, uint32_t mask,
+  uint32_t hash, void *rec);
+static void *ftchash_evict(struct ftchash *ftch, const char *key,
+  uint32_t hash);
+static void kp_siftdown(struct ftchash_kp *heap, uint64_t n, uint64_t i);
+
+static uint32_t ld32(const char *p)
+{
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+static uint64_t ld64(const char *p)
+{
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+/* murmur3 fmix64 */
+static uint64_t mix64(uint64_t x)
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+#define MIX2(a, b) mix64((a) + (b) * 0x9e3779b97f4a7c15ULL)
+
+/*
+ * function: ftchash_hashkey
+ *
+ *   hash key_size bytes at key.  The common key widths load the key
+ *   as one or two words.
+ */
+static uint32_t ftchash_hashkey(struct ftchash *ftch, const char *key)
+{
+  uint64_t h;
+  unsigned int i;
+
+  switch (ftch->key_size) {
+
+    case 4:
+      return (uint32_t)mix64(ld32(key));
+
+    case 5:
+      return (uint32_t)mix64(ld32(key) | (uint64_t)(uint8_t)key[4] << 32);
+
+    case 8:
+      return (uint32_t)mix64(ld64(key));
+
+    case 12:
+      return (uint32_t)MIX2(ld64(key), ld32(key+8));
+
+    case 16:
+      return (uint32_t)MIX2(ld64(key), ld64(key+8));
+
+    default:
+      h = ftch->key_size;
+      for (i = 0; i + 8 <= ftch->key_size; i += 8)
+        h = MIX2(h, ld64(key+i));
+      for (; i < ftch->key_size; ++i)
+        h = MIX2(h, (uint8_t)key[i]);
+      return (uint32_t)h;
+
+  } /* switch */
+
+} /* ftchash_hashkey */
+
+/*
+ * function: ftchash_keyeq
+ *
+ *   compare two keys of key_size bytes
+ */
+static int ftchash_keyeq(struct ftchash *ftch, const char *a,
+  const char *b)
+{
+
+  switch (ftch->key_size) {
+
+    case 4:
+      return ld32(a) == ld32(b);
+
+    case 5:
+      return (ld32(a) == ld32(b)) && (a[4] == b[4]);
+
+    case 8:
+      return ld64(a) == ld64(b);
+
+    case 12:
+      return (ld64(a) == ld64(b)) && (ld32(a+8) == ld32(b+8));
+
+    case 16:
+      return (ld64(a) == ld64(b)) && (ld64(a+8) == ld64(b+8));
+
+    default:
+      return !memcmp(a, b, ftch->key_size);
+
+  } /* switch */
+
+} /* ftchash_keyeq */
+
+/*
+ * function: ftchash_probe
+ *
+ *   find key in one index
+ *
+ *   returns pointer to record found or
+ *           *0L if not found
+ */
+static void *ftchash_probe(struct ftchash *ftch,
+  struct ftchash_slot *slots, uint32_t mask, uint32_t hash, const char *key)
+{
+  struct ftchash_slot *slot;
+  uint32_t i, d;
+  int keyoff;
+
+  keyoff = offsetof(struct ftchash_rec_gen, data);
+
+  for (i = hash & mask, d = 0;; i = (i + 1) & mask, ++d) {
+
+    slot = &slots[i];
+
+    if (!slot->rec)
+      return (void*)0L;
+
+    /* Robin Hood invariant, key would have been placed by now */
+    if (((i - (slot->hash & mask)) & mask) < d)
+      return (void*)0L;
+
+    if ((slot->hash == hash) && (slot->rec != FT_CHASH_MOVED) &&
+      ftchash_keyeq(ftch, (char*)slot->rec+keyoff, key))
+      return slot->rec;
+
+  }
+
+} /* ftchash_probe */
+
+/*
+ * function: ftchash_find
+ *
+ *   find key in the index and any index still being migrated
+ */
+static void *ftchash_find(struct ftchash *ftch, const char *key,
+  uint32_t hash)
+{
+  void *rec;
+
+  if ((rec = ftchash_probe(ftch, ftch->slots, ftch->h_size - 1, hash, key)))
+    return rec;
+
+  if (ftch->old_slots)
+    return ftchash_probe(ftch, ftch->old_slots, ftch->old_size - 1, hash,
+      key);
+
+  return (void*)0L;
+
+} /* ftchash_find */
 
 /*
  * function: ftchash_new
  *
  *   allocate and initialize new hash structure.
  *
- *   h_size -        size of hash table (number of buckets)
+ *   h_size -        initial size of hash index, grows as needed
  *   d_size -        size of data record (multiple of long word byte alignment)
  *   key_size -      size of key
  *   chunk_entries - number of data entries per chunk
@@ -64,7 +323,7 @@ struct ftchash *ftchash_new(int h_size, int d_size, int key_size,
   int chunk_entries)
 {
   struct ftchash *ftch;
-  int i;
+  unsigned int size;
 
   /* allocate ftchash */
   if (!(ftch = (struct ftchash*)malloc(sizeof (struct ftchash)))) {
@@ -72,26 +331,26 @@ struct ftchash *ftchash_new(int h_size, int d_size, int key_size,
     return ftch;
   }
 
+  /* index size is a power of 2 */
+  for (size = FT_CHASH_MIN_SIZE; size < (unsigned int)h_size; size <<= 1);
+
   /* init */
   bzero(ftch, sizeof (struct ftchash));
-  ftch->h_size = h_size;
+  ftch->h_size = size;
+  ftch->h_grow = (uint64_t)size / 8 * 7;
   ftch->d_size = d_size;
   ftch->key_size = key_size;
   ftch->chunk_size = chunk_entries * d_size;
   FT_SLIST_INIT(&ftch->chunk_list);
 
-  /* allocate h_size buckets */
-  if (!(ftch->buckets = (struct ftchash_bhead*)malloc(
-    sizeof (struct ftchash_bhead)*h_size))) {
-    fterr_warn("malloc()");
+  /* allocate and clear index */
+  if (!(ftch->slots = (struct ftchash_slot*)calloc(size,
+    sizeof (struct ftchash_slot)))) {
+    fterr_warn("calloc()");
     free (ftch);
     return (struct ftchash*)0L;
   }
 
-  /* init buckets */
-  for (i = 0; i < h_size; ++i)
-    FT_SLIST_INIT(&(*ftch).buckets[i]);
-
   return ftch;
 
 } /* ftchash_new */
@@ -107,8 +366,11 @@ void ftchash_free(struct ftchash *ftch)
 
   if (ftch) {
 
-    if (ftch->buckets)
-      free (ftch->buckets);
+    if (ftch->slots)
+      free (ftch->slots);
+
+    if (ftch->old_slots)
+      free (ftch->old_slots);
 
     if (ftch->sorted_recs)
       free (ftch->sorted_recs);
@@ -118,6 +380,11 @@ void ftchash_free(struct ftchash *ftch)
       free (chunk->base);
       free (chunk);
     }
+
+    ftchash_free_runs(ftch);
+
+    if (ftch->bound_heap)
+      free (ftch->bound_heap);
  
     free (ftch);
   }
@@ -128,32 +395,16 @@ void ftchash_free(struct ftchash *ftch)
  *
  *   lookup record in hash table
  *
+ *   hash is unused, the table hashes the key itself.  It is kept so
+ *   existing callers continue to work.
+ *
  *   returns pointer to record found or
  *           *0L if not found
  */
 void *ftchash_lookup(struct ftchash *ftch, void *key, uint32_t hash)
 {
 
-  struct ftchash_rec_gen *rec;
-  struct ftchash_bhead *bhead;
-  int keyoff;
-
-  /* offset to key */
-  keyoff = offsetof(struct ftchash_rec_gen, data);
-
-  /* lookup hash entry */
-  bhead = &(*ftch).buckets[hash];
-
-  /* walk down chain */
-  FT_SLIST_FOREACH(rec, bhead, chain) {
-
-    /* if found return pointer */
-    if (!bcmp((char*)rec+keyoff, (char*)key, ftch->key_size))
-      return rec;
-
-  }
-
-  return (void*)0L;
+  return ftchash_find(ftch, (char*)key, ftchash_hashkey(ftch, (char*)key));
 
 } /* ftchash_lookup */
 
@@ -162,7 +413,7 @@ void *ftchash_lookup(struct ftchash *ftch, void *key, uint32_t hash)
  *
  *   add record to hash table.  key_size bytes will be copied from rec to
  *   the allocated hash record.  The caller must update the remaining
- *   area of rec.  hash value must be less than h_size.
+ *   area of rec.  hash is unused, see ftchash_lookup().
  *
  *   returns 0L on error
  *           or pointer to allocated record
@@ -171,7 +422,7 @@ void *ftchash_update(struct ftchash *ftch, void *newrec, uint32_t hash)
 {
 
   struct ftchash_rec_gen *rec;
-  struct ftchash_bhead *bhead;
+  char *key;
   int keyoff;
 
   /* no longer sorted */
@@ -179,17 +430,41 @@ void *ftchash_update(struct ftchash *ftch, void *newrec, uint32_t hash)
 
   /* offset to key */
   keyoff = offsetof(struct ftchash_rec_gen, data);
+  key = (char*)newrec+keyoff;
+
+  hash = ftchash_hashkey(ftch, key);
+
+  /*
+   * continue any resize in progress.  Done on every update, not only
+   * inserts, so a table that stops growing still retires the old index.
+   */
+  if (ftch->old_slots)
+    ftchash_migrate(ftch, FT_CHASH_MIGRATE);
+
+  /* if found return pointer */
+  if ((rec = ftchash_find(ftch, key, hash)))
+    return rec;
+
+  /* full summary, take over the smallest record */
+  if (ftch->bound && (ftch->entries >= ftch->bound))
+    return ftchash_evict(ftch, key, hash);
+
+  /* over the memory limit with the next chunk?  Spill and start over */
+  if (ftch->max_bytes && ftch->entries &&
+    ((!ftch->active_chunk) ||
+     (ftch->active_chunk->next >= ftch->chunk_size)) &&
+    (ftch->chunk_bytes + ftch->chunk_size +
+     (uint64_t)(ftch->h_size + ftch->old_size) *
+       sizeof (struct ftchash_slot) > ftch->max_bytes) &&
+    (ftchash_spill(ftch) < 0)) {
+    fterr_warnx("ftchash_spill(): failed");
+    return (void*)0L;
+  }
 
-  /* lookup hash entry */
-  bhead = &(*ftch).buckets[hash];
-
-  /* walk down chain */
-  FT_SLIST_FOREACH(rec, bhead, chain) {
-
-    /* if found return pointer */
-    if (!bcmp((char*)rec+keyoff, (char*)newrec+keyoff, ftch->key_size))
-      return rec;
-
+  /* make room before allocating so a failure leaves no orphan record */
+  if ((ftch->entries >= ftch->h_grow) && (ftchash_grow(ftch) < 0)) {
+    fterr_warnx("ftchash_grow(): failed");
+    return (void*)0L;
   }
 
   /* not found, allocate new entry */
@@ -198,11 +473,11 @@ void *ftchash_update(struct ftchash *ftch, void *newrec, uint32_t hash)
     return (void*)0L;
   }
 
-  /* add to chain */
-  FT_SLIST_INSERT_HEAD(bhead, rec, chain);
-
   /* copy in key */
-  bcopy((char*)newrec+keyoff, (char*)rec+keyoff, ftch->key_size);
+  bcopy(key, (char*)rec+keyoff, ftch->key_size);
+
+  /* add to index */
+  ftchash_place(ftch->slots, ftch->h_size - 1, hash, rec);
 
   /* increment storage counter */
   ftch->entries ++;
@@ -212,6 +487,139 @@ void *ftchash_update(struct ftchash *ftch, void *newrec, uint32_t hash)
 
 } /* ftchash_update */
 
+/*
+ * function: ftchash_place
+ *
+ *   insert a record known not to be in the index
+ */
+static void ftchash_place(struct ftchash_slot *slots, uint32_t mask,
+  uint32_t hash, void *rec)
+{
+  struct ftchash_slot *slot;
+  uint32_t i, d, sd, th;
+  void *tr;
+
+  for (i = hash & mask, d = 0;; i = (i + 1) & mask, ++d) {
+
+    slot = &slots[i];
+
+    if (!slot->rec) {
+      slot->hash = hash;
+      slot->rec = rec;
+      return;
+    }
+
+    /* take the slot from an entry closer to home, carry it forward */
+    sd = (i - (slot->hash & mask)) & mask;
+    if (sd < d) {
+      th = slot->hash; tr = slot->rec;
+      slot->hash = hash; slot->rec = rec;
+      hash = th; rec = tr;
+      d = sd;
+    }
+
+  }
+
+} /* ftchash_place */
+
+/*
+ * function: ftchash_unplace
+ *
+ *   remove rec from the index.  The entries after it are shifted back
+ *   one slot until one is home, which keeps the Robin Hood order.
+ */
+static void ftchash_unplace(struct ftchash_slot *slots, uint32_t mask,
+  uint32_t hash, void *rec)
+{
+  uint32_t i, j;
+
+  for (i = hash & mask; slots[i].rec != rec; i = (i + 1) & mask);
+
+  for (;;) {
+
+    j = (i + 1) & mask;
+
+    if ((!slots[j].rec) || (!((j - (slots[j].hash & mask)) & mask)))
+      break;
+
+    slots[i] = slots[j];
+    i = j;
+
+  }
+
+  slots[i].hash = 0;
+  slots[i].rec = (void*)0L;
+
+} /* ftchash_unplace */
+
+/*
+ * function: ftchash_migrate
+ *
+ *   move up to n slots of the old index to the current one, free
+ *   the old index when done
+ */
+static void ftchash_migrate(struct ftchash *ftch, unsigned int n)
+{
+  struct ftchash_slot *slot;
+
+  while (n-- && (ftch->old_next < ftch->old_size)) {
+
+    slot = &ftch->old_slots[ftch->old_next++];
+
+    if (slot->rec && (slot->rec != FT_CHASH_MOVED)) {
+      ftchash_place(ftch->slots, ftch->h_size - 1, slot->hash, slot->rec);
+      slot->rec = FT_CHASH_MOVED;
+    }
+
+  }
+
+  if (ftch->old_next == ftch->old_size) {
+    free (ftch->old_slots);
+    ftch->old_slots = (struct ftchash_slot*)0L;
+    ftch->old_size = ftch->old_next = 0;
+  }
+
+} /* ftchash_migrate */
+
+/*
+ * function: ftchash_grow
+ *
+ *   double the index.  Entries are moved over by ftchash_migrate().
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+static int ftchash_grow(struct ftchash *ftch)
+{
+  struct ftchash_slot *slots;
+
+  /* previous resize must be complete */
+  if (ftch->old_slots)
+    ftchash_migrate(ftch, ftch->old_size);
+
+  if (ftch->h_size & 0x80000000) {
+    fterr_warnx("ftchash_grow(): index at maximum size");
+    return -1;
+  }
+
+  if (!(slots = (struct ftchash_slot*)calloc(ftch->h_size * 2,
+    sizeof (struct ftchash_slot)))) {
+    fterr_warn("calloc()");
+    return -1;
+  }
+
+  ftch->old_slots = ftch->slots;
+  ftch->old_size = ftch->h_size;
+  ftch->old_next = 0;
+
+  ftch->slots = slots;
+  ftch->h_size *= 2;
+  ftch->h_grow = (uint64_t)ftch->h_size / 8 * 7;
+
+  return 0;
+
+} /* ftchash_grow */
+
 /*
  * function: ftchash_alloc_rec
  *
@@ -251,6 +659,7 @@ void *ftchash_alloc_rec(struct ftchash *ftch)
     chunk->base = p;
 
     ftch->active_chunk = chunk;
+    ftch->chunk_bytes += ftch->chunk_size;
 
     FT_SLIST_INSERT_HEAD(&ftch->chunk_list, chunk, chain);
 
@@ -263,276 +672,1691 @@ void *ftchash_alloc_rec(struct ftchash *ftch)
 } /* ftchash_alloc_rec */
 
 /*
- * function: ftchash_first
+ * function: ftchash_merge
  *
- * setup ftchash_foreach to first entry;
- */
-void ftchash_first(struct ftchash *ftch)
-{
-  struct ftchash_chunk *chunk;
-
-  if (ftch->sort_flags & FT_CHASH_SORTED) {
-    if (ftch->sort_flags & FT_CHASH_SORT_ASCENDING)
-      ftch->traverse_srec = ftch->entries;
-    else
-      ftch->traverse_srec = 0;
-  } else {
-
-    chunk = FT_SLIST_FIRST(&ftch->chunk_list);
-
-    if (chunk) {
-      ftch->traverse_chunk = chunk;
-      ftch->traverse_rec = chunk->base;
-    } else {
-      ftch->traverse_rec = (void*)0L;
-      ftch->traverse_chunk = (void*)0L;
-    }
-  } /* sorted? */
-} /* ftchash_first */
-
-/*
- * function: ftchash_foreach
+ *   fold every record of src into dst.  Keys missing from dst are
+ *   added, then f_combine(drec, srec, arg) is called to fold the data
+ *   portion of srec into drec.  A record just added to dst is all zero
+ *   past the key, so f_combine can treat new and existing keys alike.
+ *   With f_combine 0L only the keys are merged.
  *
- * returns next entry in hash table, or NULL if the last entry
- * ftchash_first() must be called first.
+ *   src is walked in insertion order and is left unchanged, except that
+ *   runs src has spilled are handed over to dst.  Both tables must have
+ *   the same record and key size.
  *
+ *   returns -1 on error (dst holds a partial merge)
+ *            0 otherwise
  */
-void *ftchash_foreach(struct ftchash *ftch)
+int ftchash_merge(struct ftchash *dst, struct ftchash *src,
+  int (*f_combine)(void *drec, void *srec, void *arg), void *arg)
 {
-  struct ftchash_chunk *chunk;
-  void *ret;
+  struct ftchash_chunk *chunk, **chunks;
+  struct ftchash_run *runs;
+  uint64_t nchunks, i;
+  char *srec, *drec;
+  int ret;
+
+  if ((dst->d_size != src->d_size) || (dst->key_size != src->key_size)) {
+    fterr_warnx("ftchash_merge(): record size mismatch");
+    return -1;
+  }
 
-  if (ftch->sort_flags & FT_CHASH_SORTED) {
-    if (ftch->sort_flags & FT_CHASH_SORT_ASCENDING) {
-      if (ftch->traverse_srec > 0)
-        return (ftch->sorted_recs[--ftch->traverse_srec]);
-      else
-        return (void*)0L;
-    } else {
-      if (ftch->traverse_srec < ftch->entries)
-        return (ftch->sorted_recs[ftch->traverse_srec++]);
-      else
-        return (void*)0L;
-    }
-  } else {
+  /* spilled runs are merged by ftchash_unspill(), move them over */
+  if (src->nruns) {
 
-    /* only happens on empty hash table -- done */
-    if (!ftch->traverse_chunk)
-      return (void*)0L;
-   
-      
-    /* more entries in this chunk *? */ 
-    if  ((char*)ftch->traverse_rec <
-      (char*)ftch->traverse_chunk->base+ftch->traverse_chunk->next) {
-
-      ret = ftch->traverse_rec;
-      ftch->traverse_rec = (char*)ftch->traverse_rec + ftch->d_size;
-      
-      return ret;
+    if (!(runs = (struct ftchash_run*)realloc(dst->runs,
+      (dst->nruns + src->nruns) * sizeof (struct ftchash_run)))) {
+      fterr_warn("realloc()");
+      return -1;
+    }
 
-    } else {
+    bcopy(src->runs, runs + dst->nruns,
+      src->nruns * sizeof (struct ftchash_run));
+    dst->runs = runs;
+    dst->nruns += src->nruns;
+    dst->spill_runs += src->spill_runs;
+    dst->spill_recs += src->spill_recs;
+    dst->merge_recs += src->merge_recs;
 
-        /* go to next chunk */
-        chunk = FT_SLIST_NEXT(ftch->traverse_chunk, chain);
+    free(src->runs);
+    src->runs = (struct ftchash_run*)0L;
+    src->nruns = 0;
 
-        /* if this is a valid chunk, return first record */
-        if (chunk) {
-          ftch->traverse_chunk = chunk;
-          ftch->traverse_rec = (char*)ftch->traverse_chunk->base + ftch->d_size;
-          return (chunk->base);
-        } else { /* else that was the last chunk, done */
-          return (void*)0L;
-        }
-    }
-  } /* sorted? */
-} /* ftchash_foreach */
+  }
 
-/*
- * function: ftchash_sort
- *
- *   creates an array of pointers to the sorted records
- *
- *   returns -1 on error
- *            0 otherwise
- */
-int ftchash_sort(struct ftchash *ftch, int offset, int flags)
-{
-  void *rec;
-  uint64_t x;
+  /* chunks are kept newest first */
+  nchunks = 0;
+  FT_SLIST_FOREACH(chunk, &src->chunk_list, chain)
+    ++nchunks;
 
-  /* entries to sort? */
-  if (!ftch->entries)
+  if (!nchunks)
     return 0;
 
-  /* free memory from previous call */
-  if (ftch->sorted_recs)
-    free(ftch->sorted_recs);
-
-  /* allocate ftch->entries * sizeof 32 bit pointer */
-  if (!(ftch->sorted_recs = (struct ftchash_rec_gen**)
-    malloc(sizeof (struct ftchash_rec_gen*)*ftch->entries))) {
+  if (!(chunks = (struct ftchash_chunk**)malloc(nchunks * sizeof *chunks))) {
     fterr_warn("malloc()");
     return -1;
   }
 
-  ftch->sort_flags = flags;
+  i = nchunks;
+  FT_SLIST_FOREACH(chunk, &src->chunk_list, chain)
+    chunks[--i] = chunk;
 
-  /* copy in the unsorted entries */
-  ftchash_first(ftch);
-  x = 0;
-  while ((rec = ftchash_foreach(ftch))) {
+  ret = -1; /* err */
 
-    ftch->sorted_recs[x++] = (struct ftchash_rec_gen*)rec;
+  for (i = 0; i < nchunks; ++i) {
 
-  } /* while */
+    chunk = chunks[i];
 
-  sort_offset = offset;
+    for (srec = chunk->base; srec < (char*)chunk->base + chunk->next;
+      srec += src->d_size) {
 
-  if (flags & FT_CHASH_SORT_64)
-    qsort(ftch->sorted_recs, ftch->entries, sizeof (void*), cmp64);
-  else if (flags & FT_CHASH_SORT_40)
-    qsort(ftch->sorted_recs, ftch->entries, sizeof (void*), cmp40);
-  else if (flags & FT_CHASH_SORT_32)
-    qsort(ftch->sorted_recs, ftch->entries, sizeof (void*), cmp32);
-  else if (flags & FT_CHASH_SORT_16)
-    qsort(ftch->sorted_recs, ftch->entries, sizeof (void*), cmp16);
-  else if (flags & FT_CHASH_SORT_8)
-    qsort(ftch->sorted_recs, ftch->entries, sizeof (void*), cmp8);
-  else if (flags & FT_CHASH_SORT_DOUBLE)
-    qsort(ftch->sorted_recs, ftch->entries, sizeof (void*), cmp_double);
-  else
-    fterr_errx(1, "ftchash_sort(): internal error");
+      if (!(drec = ftchash_update(dst, srec, 0))) {
+        fterr_warnx("ftchash_update(): failed");
+        goto out;
+      }
 
-  ftch->sort_flags |= FT_CHASH_SORTED;
+      if (f_combine && f_combine(drec, srec, arg))
+        goto out;
 
-  return 0;
+    }
 
-} /* ftchash_sort */
+  }
 
-static int cmp64(const void *a, const void *b)
-{
-  uint64_t *la, *lb;
-  char *d;
+  /* an overestimate in src carries over to dst */
+  dst->evictions += src->evictions;
+  dst->bound_err += src->bound_err;
 
-  d = *(char**)a;
-  la = (uint64_t*)(d+sort_offset);
+  ret = 0;
 
-  d = *(char**)b;
-  lb = (uint64_t*)(d+sort_offset);
+out:
 
-  if (*la < *lb)
-    return -1;
-  if (*la > *lb)
-    return 1;
-  return 0;
+  free(chunks);
+
+  return ret;
 
-} /* cmp64 */
+} /* ftchash_merge */
 
-static int cmp40(const void *a, const void *b)
+/*
+ * function: ftchash_save
+ *
+ *   write the records of ftch, spilled runs included, to fp for
+ *   ftchash_load().  The record count, evictions and bound_err are
+ *   written first, then the key and data of each record.  A key that
+ *   was spilled more than once appears once per run.  Records are
+ *   written in insertion order so a load rebuilds the same table.
+ *   f_clear(rec, arg) is called on a copy of each record before it is
+ *   written to zero what only has meaning in memory, such as pointers.
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+int ftchash_save(struct ftchash *ftch, FILE *fp,
+  void (*f_clear)(void *rec, void *arg), void *arg)
 {
-  uint32_t *la, *lb;
-  uint8_t *ca, *cb;
-  char *d;
+  struct ftchash_chunk *chunk, **chunks;
+  uint64_t n, i, nchunks, hdr[3];
+  unsigned int r, off, len;
+  char *rec, *buf;
+  int ret;
 
-  d = *(char**)a;
-  la = (uint32_t*)(d+sort_offset);
+  off = offsetof(struct ftchash_rec_gen, data);
+  len = ftch->d_size - off;
 
-  d = *(char**)b;
-  lb = (uint32_t*)(d+sort_offset);
+  n = ftch->entries;
+  for (r = 0; r < ftch->nruns; ++r)
+    n += ftch->runs[r].recs;
 
-  if (*la < *lb)
+  hdr[0] = n;
+  hdr[1] = ftch->evictions;
+  hdr[2] = ftch->bound_err;
+
+  if (fwrite(hdr, sizeof hdr, 1, fp) != 1) {
+    fterr_warn("fwrite()");
+    return -1;
+  }
+
+  /* chunks are kept newest first */
+  nchunks = 0;
+  FT_SLIST_FOREACH(chunk, &ftch->chunk_list, chain)
+    ++nchunks;
+
+  if (!(chunks = (struct ftchash_chunk**)malloc(
+    (nchunks ? nchunks : 1) * sizeof *chunks))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  i = nchunks;
+  FT_SLIST_FOREACH(chunk, &ftch->chunk_list, chain)
+    chunks[--i] = chunk;
+
+  if (!(buf = (char*)malloc(ftch->d_size))) {
+    fterr_warn("malloc()");
+    free(chunks);
+    return -1;
+  }
+
+  ret = -1; /* err */
+
+  for (i = 0; i < nchunks; ++i) {
+
+    chunk = chunks[i];
+
+    for (rec = chunk->base; rec < (char*)chunk->base + chunk->next;
+      rec += ftch->d_size) {
+
+      bcopy(rec, buf, ftch->d_size);
+
+      if (f_clear)
+        f_clear(buf, arg);
+
+      if (fwrite(buf + off, len, 1, fp) != 1) {
+        fterr_warn("fwrite()");
+        goto out;
+      }
+
+    }
+
+  }
+
+  for (r = 0; r < ftch->nruns; ++r) {
+
+    if (fseek(ftch->runs[r].fp, 0L, SEEK_SET)) {
+      fterr_warn("fseek()");
+      goto out;
+    }
+
+    for (i = 0; i < ftch->runs[r].recs; ++i) {
+
+      if (fread(buf, ftch->d_size, 1, ftch->runs[r].fp) != 1) {
+        fterr_warn("fread()");
+        goto out;
+      }
+
+      if (f_clear)
+        f_clear(buf, arg);
+
+      if (fwrite(buf + off, len, 1, fp) != 1) {
+        fterr_warn("fwrite()");
+        goto out;
+      }
+
+    }
+
+  }
+
+  ret = 0;
+
+out:
+
+  free(buf);
+  free(chunks);
+
+  return ret;
+
+} /* ftchash_save */
+
+/*
+ * function: ftchash_load
+ *
+ *   read the records written by ftchash_save() from fp into ftch.
+ *   f_combine(drec, srec, arg) folds each record into the table as
+ *   for ftchash_merge(), srec is as read from fp.  Both tables must have
+ *   the same record and key size.  When fp is a file the record count
+ *   must fit in what is left of it.
+ *
+ *   returns -1 on error (ftch holds a partial load)
+ *            0 otherwise
+ */
+int ftchash_load(struct ftchash *ftch, FILE *fp,
+  int (*f_combine)(void *drec, void *srec, void *arg), void *arg)
+{
+  struct stat sb;
+  uint64_t i, hdr[3];
+  unsigned int off, len;
+  char *buf, *drec;
+  off_t pos;
+  int ret;
+
+  off = offsetof(struct ftchash_rec_gen, data);
+  len = ftch->d_size - off;
+
+  if (fread(hdr, sizeof hdr, 1, fp) != 1) {
+    fterr_warnx("ftchash_load(): short read");
+    return -1;
+  }
+
+  /* a bad count would otherwise grow the table until the read fails */
+  if (!fstat(fileno(fp), &sb) && S_ISREG(sb.st_mode) &&
+    ((pos = ftello(fp)) != -1) &&
+    ((pos > sb.st_size) || (hdr[0] > (uint64_t)(sb.st_size - pos) / len))) {
+    fterr_warnx("ftchash_load(): %llu records do not fit in the file",
+      (unsigned long long)hdr[0]);
     return -1;
-  if (*la > *lb)
-    return 1;
+  }
+
+  if (!(buf = (char*)malloc(ftch->d_size))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  bzero(buf, off);
+
+  ret = -1; /* err */
+
+  for (i = 0; i < hdr[0]; ++i) {
+
+    if (fread(buf + off, len, 1, fp) != 1) {
+      fterr_warnx("ftchash_load(): short read");
+      goto out;
+    }
+
+    if (!(drec = ftchash_update(ftch, buf, 0))) {
+      fterr_warnx("ftchash_update(): failed");
+      goto out;
+    }
+
+    if (f_combine && f_combine(drec, buf, arg))
+      goto out;
+
+  }
+
+  ftch->evictions += hdr[1];
+  ftch->bound_err += hdr[2];
+
+  ret = 0;
+
+out:
+
+  free(buf);
+
+  return ret;
+
+} /* ftchash_load */
+
+/*
+ * function: ftchash_limit
+ *
+ *   limit the memory of ftch to about max_bytes, chunks plus index.
+ *   Past the limit records are spilled to run files, see
+ *   ftchash_unspill().  Must be called before the first update.
+ *   max_bytes of 0 removes the limit.
+ */
+void ftchash_limit(struct ftchash *ftch, uint64_t max_bytes)
+{
+  uint64_t n;
+
+  ftch->max_bytes = max_bytes;
+
+  /* chunks are the unit of allocation, several must fit in the limit */
+  n = max_bytes / FT_CHASH_LIMIT_CHUNKS / ftch->d_size;
+  if (!n)
+    n = 1;
+
+  if (max_bytes && ((uint64_t)ftch->chunk_size > n * ftch->d_size))
+    ftch->chunk_size = n * ftch->d_size;
+
+} /* ftchash_limit */
+
+/*
+ * function: ftchash_bound
+ *
+ *   keep at most max_entries records in ftch as a Space-Saving summary
+ *   ranked on the uint64_t counter at offset, see the top of this file.
+ *   The record taken over by a new key is zero past the key except for
+ *   the ranking counter.  evictions counts the take overs and bound_err
+ *   is the most any ranking counter can exceed the true value.  Must be
+ *   called before the first update, the memory limit of ftchash_limit()
+ *   does not apply.  f_evict(rec, arg), if set, is called on a record
+ *   before it is taken over so what it points to can be reused.
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+int ftchash_bound(struct ftchash *ftch, uint64_t max_entries, int offset,
+  void (*f_evict)(void *rec, void *arg), void *arg)
+{
+  struct ftchash_slot *slots;
+  unsigned int size;
+
+  if (!max_entries || ftch->entries) {
+    fterr_warnx("ftchash_bound(): bad bound or table in use");
+    return -1;
+  }
+
+  /* size the index so it never grows */
+  for (size = ftch->h_size; (uint64_t)size / 8 * 7 <= max_entries;
+    size <<= 1) {
+    if (size & 0x80000000) {
+      fterr_warnx("ftchash_bound(): bound too large");
+      return -1;
+    }
+  }
+
+  if (size != ftch->h_size) {
+
+    if (!(slots = (struct ftchash_slot*)calloc(size,
+      sizeof (struct ftchash_slot)))) {
+      fterr_warn("calloc()");
+      return -1;
+    }
+
+    free (ftch->slots);
+    ftch->slots = slots;
+    ftch->h_size = size;
+    ftch->h_grow = (uint64_t)size / 8 * 7;
+
+  }
+
+  if ((uint64_t)ftch->chunk_size > max_entries * ftch->d_size)
+    ftch->chunk_size = max_entries * ftch->d_size;
+
+  ftch->bound = max_entries;
+  ftch->bound_offset = offset;
+  ftch->bound_evict = f_evict;
+  ftch->bound_arg = arg;
+  ftch->max_bytes = 0;
+
+  return 0;
+
+} /* ftchash_bound */
+
+/*
+ * function: ftchash_evict
+ *
+ *   hand the record with the smallest ranking counter of a full
+ *   bounded table over to key.  The heap is built on the first call.
+ *
+ *   returns 0L on error
+ *           or pointer to the record
+ */
+static void *ftchash_evict(struct ftchash *ftch, const char *key,
+  uint32_t hash)
+{
+  struct ftchash_chunk *chunk;
+  struct ftchash_kp *heap;
+  uint64_t n, i, v;
+  char *rec;
+  int keyoff;
+
+  keyoff = offsetof(struct ftchash_rec_gen, data);
+  n = ftch->entries;
+
+  if (!(heap = ftch->bound_heap)) {
+
+    if (!(heap = (struct ftchash_kp*)malloc(n * sizeof *heap))) {
+      fterr_warn("malloc()");
+      return (void*)0L;
+    }
+
+    i = 0;
+    FT_SLIST_FOREACH(chunk, &ftch->chunk_list, chain) {
+      for (rec = chunk->base; rec < (char*)chunk->base + chunk->next;
+        rec += ftch->d_size) {
+        heap[i].key = ld64(rec + ftch->bound_offset);
+        heap[i++].rec = rec;
+      }
+    }
+
+    for (i = n / 2; i--;)
+      kp_siftdown(heap, n, i);
+
+    ftch->bound_heap = heap;
+
+  }
+
+  /* snapshots only lag the counters, refresh until the top is current */
+  while ((v = ld64((char*)heap[0].rec + ftch->bound_offset)) != heap[0].key) {
+    heap[0].key = v;
+    kp_siftdown(heap, n, 0);
+  }
+
+  rec = heap[0].rec;
+
+  ftchash_unplace(ftch->slots, ftch->h_size - 1,
+    ftchash_hashkey(ftch, rec+keyoff), rec);
+
+  if (ftch->bound_evict)
+    ftch->bound_evict(rec, ftch->bound_arg);
+
+  bzero(rec+keyoff, ftch->d_size - keyoff);
+  bcopy(key, rec+keyoff, ftch->key_size);
+  bcopy(&v, rec + ftch->bound_offset, sizeof v);
+
+  ftchash_place(ftch->slots, ftch->h_size - 1, hash, rec);
+
+  ++ftch->evictions;
+  if (v > ftch->bound_err)
+    ftch->bound_err = v;
+
+  /* still the top of the heap, the caller's update makes it stale */
+  return rec;
+
+} /* ftchash_evict */
+
+static void kp_siftdown(struct ftchash_kp *heap, uint64_t n, uint64_t i)
+{
+  struct ftchash_kp t;
+  uint64_t c;
+
+  while ((c = 2 * i + 1) < n) {
+    if ((c + 1 < n) && (heap[c+1].key < heap[c].key))
+      ++c;
+    if (heap[i].key <= heap[c].key)
+      break;
+    t = heap[c]; heap[c] = heap[i]; heap[i] = t;
+    i = c;
+  }
+
+} /* kp_siftdown */
+
+/*
+ * function: ftchash_unspill
+ *
+ *   k-way merge the runs spilled by a table with a memory limit and the
+ *   records still in memory.  Records with the same key are folded with
+ *   f_combine(drec, srec, arg) starting from a record that is all zero
+ *   past the key, as in ftchash_merge().  f_final(rec, arg), if set, is
+ *   then called once on each folded record.
+ *
+ *   With nkeep 0 the table is rebuilt with every record, in key order.
+ *   Otherwise only the records that rank in the first keep[i].k of any
+ *   keep[i] are put back, keep[i].offset and keep[i].flags as passed to
+ *   ftchash_sort_topk(), offset -1 for traversal order.  Equal values go
+ *   to the record ahead in the traversal of the full rebuilt table, so
+ *   ftchash_sort_topk() on the smaller table returns the same records.
+ *
+ *   merge_keys is the number of records the full table would hold.  The
+ *   memory limit is not applied while rebuilding.  A table without runs
+ *   is left alone.
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+int ftchash_unspill(struct ftchash *ftch,
+  int (*f_combine)(void *drec, void *srec, void *arg),
+  void (*f_final)(void *rec, void *arg), void *arg,
+  struct ftchash_keep *keep, int nkeep)
+{
+  struct ftchash_src *src;
+  struct ftchash_sel *sel;
+  struct ftchash_topk *all;
+  uint64_t max_bytes, c, nall, i, j;
+  unsigned int nsrc;
+  char *acc, *rec;
+  int keyoff, kflags, have, ret, k;
+
+  if (!ftch->nruns)
+    return 0;
+
+  ret = -1; /* err */
+  src = (struct ftchash_src*)0L;
+  sel = (struct ftchash_sel*)0L;
+  all = (struct ftchash_topk*)0L;
+  acc = (char*)0L;
+  nsrc = 0;
+
+  keyoff = offsetof(struct ftchash_rec_gen, data);
+  kflags = FT_CHASH_KEY_FLAGS(ftch);
+
+  max_bytes = ftch->max_bytes;
+  ftch->max_bytes = 0;
+
+  /* the remainder is the last run, the table is rebuilt from empty */
+  if (ftchash_spill(ftch) < 0) {
+    fterr_warnx("ftchash_spill(): failed");
+    goto out;
+  }
+
+  /* records per chunk, for the traversal order of the rebuilt table */
+  c = ftch->chunk_size / ftch->d_size;
+
+  if (!(acc = (char*)malloc(ftch->d_size))) {
+    fterr_warn("malloc()");
+    goto out;
+  }
+
+  if (nkeep) {
+
+    if (!(sel = (struct ftchash_sel*)malloc(nkeep * sizeof *sel))) {
+      fterr_warn("malloc()");
+      goto out;
+    }
+
+    bzero(sel, nkeep * sizeof *sel);
+
+    for (k = 0; k < nkeep; ++k) {
+
+      if (!(sel[k].heap = (struct ftchash_topk*)malloc(keep[k].k *
+        sizeof (struct ftchash_topk))) ||
+        !(sel[k].store = (char*)malloc(keep[k].k * ftch->d_size))) {
+        fterr_warn("malloc()");
+        goto out;
+      }
+
+    }
+
+  } /* nkeep */
+
+  if (src_open(ftch, 0, &src, &nsrc) < 0)
+    goto out;
+
+  /* smallest key first, fold equal keys into acc */
+  have = 0;
+  while (nsrc) {
+
+    if ((!have) || cmp_val(acc, src[0].rec, keyoff, kflags)) {
+
+      if (have && ftchash_emit(ftch, acc, f_final, arg, keep, sel, nkeep, c))
+        goto out;
+
+      bzero(acc, ftch->d_size);
+      bcopy(src[0].rec+keyoff, acc+keyoff, ftch->key_size);
+      have = 1;
+
+    }
+
+    if (f_combine && f_combine(acc, src[0].rec, arg))
+      goto out;
+
+    ++ftch->merge_recs;
+
+    if (src_next(ftch, src, &nsrc) < 0)
+      goto out;
+
+  } /* while */
+
+  if (have && ftchash_emit(ftch, acc, f_final, arg, keep, sel, nkeep, c))
+    goto out;
+
+  /* put back the union of the kept records in traversal order */
+  if (nkeep) {
+
+    for (nall = 0, k = 0; k < nkeep; ++k)
+      nall += sel[k].n;
+
+    if (nall) {
+
+      if (!(all = (struct ftchash_topk*)malloc(nall * sizeof *all))) {
+        fterr_warn("malloc()");
+        goto out;
+      }
+
+      for (i = 0, k = 0; k < nkeep; ++k)
+        for (j = 0; j < sel[k].n; ++j)
+          all[i++] = sel[k].heap[j];
+
+      qsort(all, nall, sizeof *all, topk_idx_cmp);
+
+      /* one chunk keeps traversal in insertion order */
+      if ((nall > c) && (nall * ftch->d_size <= 0x7FFFFFFF))
+        ftch->chunk_size = nall * ftch->d_size;
+
+      for (i = 0; i < nall; ++i) {
+
+        /* kept by more than one output */
+        if (i && (all[i].idx == all[i-1].idx))
+          continue;
+
+        if (!(rec = (char*)ftchash_update(ftch, all[i].rec, 0))) {
+          fterr_warnx("ftchash_update(): failed");
+          goto out;
+        }
+
+        bcopy((char*)all[i].rec+keyoff, rec+keyoff, ftch->d_size-keyoff);
+
+      }
+
+    } /* nall */
+
+  } /* nkeep */
+
+  ret = 0;
+
+out:
+
+  src_close(src, nsrc);
+
+  if (sel) {
+    for (k = 0; k < nkeep; ++k) {
+      if (sel[k].heap)
+        free(sel[k].heap);
+      if (sel[k].store)
+        free(sel[k].store);
+    }
+    free(sel);
+  }
+
+  if (all)
+    free(all);
+
+  if (acc)
+    free(acc);
+
+  ftchash_free_runs(ftch);
+
+  ftch->max_bytes = max_bytes;
+
+  return ret;
+
+} /* ftchash_unspill */
+
+/*
+ * function: ftchash_emit
+ *
+ *   a folded record from ftchash_unspill(), put it in the table or
+ *   offer it to each selection
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+static int ftchash_emit(struct ftchash *ftch, char *acc,
+  void (*f_final)(void *rec, void *arg), void *arg,
+  struct ftchash_keep *keep, struct ftchash_sel *sel, int nkeep, uint64_t c)
+{
+  struct ftchash_topk e;
+  char *rec;
+  int keyoff, largest, k;
+
+  keyoff = offsetof(struct ftchash_rec_gen, data);
+
+  if (f_final)
+    f_final(acc, arg);
+
+  /*
+   * position in the traversal of the full table.  Chunks are walked
+   * newest first, records within a chunk in insertion order.
+   */
+  e.idx = ((~(uint64_t)0 / c - 1) - ftch->merge_keys / c) * c +
+    ftch->merge_keys % c;
+  ++ftch->merge_keys;
+
+  if (!nkeep) {
+
+    if (!(rec = (char*)ftchash_update(ftch, acc, 0))) {
+      fterr_warnx("ftchash_update(): failed");
+      return -1;
+    }
+
+    bcopy(acc+keyoff, rec+keyoff, ftch->d_size-keyoff);
+
+    return 0;
+
+  }
+
+  for (k = 0; k < nkeep; ++k) {
+
+    largest = (keep[k].flags & FT_CHASH_SORT_ASCENDING) ? 1 : 0;
+
+    e.rec = acc;
+
+    if (sel[k].n < keep[k].k) {
+
+      e.rec = sel[k].store + sel[k].n * ftch->d_size;
+      bcopy(acc, e.rec, ftch->d_size);
+      sel[k].heap[sel[k].n++] = e;
+      topk_siftup(sel[k].heap, sel[k].n - 1, keep[k].offset, keep[k].flags,
+        largest);
+
+    } else if (topk_cmp(&e, &sel[k].heap[0], keep[k].offset, keep[k].flags,
+      largest) > 0) {
+
+      bcopy(acc, sel[k].heap[0].rec, ftch->d_size);
+      sel[k].heap[0].idx = e.idx;
+      topk_siftdown(sel[k].heap, sel[k].n, 0, keep[k].offset, keep[k].flags,
+        largest);
+
+    }
+
+  } /* k */
+
+  return 0;
+
+} /* ftchash_emit */
+
+/*
+ * function: ftchash_spill
+ *
+ *   sort the records of ftch by key, write them to a new run and empty
+ *   the table
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+static int ftchash_spill(struct ftchash *ftch)
+{
+  struct ftchash_iter iter;
+  struct ftchash_run *runs;
+  void **recs, **tmp;
+  void *rec;
+  uint64_t n, i;
+  FILE *fp;
+
+  if (!ftch->entries)
+    return 0;
+
+  if (!(runs = (struct ftchash_run*)realloc(ftch->runs,
+    (ftch->nruns + 1) * sizeof (struct ftchash_run)))) {
+    fterr_warn("realloc()");
+    return -1;
+  }
+
+  ftch->runs = runs;
+
+  if (!(recs = (void**)malloc(ftch->entries * sizeof (void*)))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  if (!(tmp = (void**)malloc((ftch->entries/2+1) * sizeof (void*)))) {
+    fterr_warn("malloc()");
+    free(recs);
+    return -1;
+  }
+
+  /* insertion order */
+  ftch->sort_flags &= ~FT_CHASH_SORTED;
+  ftchash_iter_init(ftch, &iter);
+  n = 0;
+  while ((rec = ftchash_iter_next(&iter)))
+    recs[n++] = rec;
+
+  msort_recs(recs, tmp, n, offsetof(struct ftchash_rec_gen, data),
+    FT_CHASH_KEY_FLAGS(ftch));
+
+  free(tmp);
+
+  if (!(fp = ftchash_tmpfile())) {
+    free(recs);
+    return -1;
+  }
+
+  for (i = 0; i < n; ++i)
+    if (fwrite(recs[i], ftch->d_size, 1, fp) != 1)
+      break;
+
+  free(recs);
+
+  if ((i != n) || fflush(fp)) {
+    fterr_warn("fwrite()");
+    fclose(fp);
+    return -1;
+  }
+
+  runs[ftch->nruns].fp = fp;
+  runs[ftch->nruns].recs = n;
+  runs[ftch->nruns].level = 0;
+  ++ftch->nruns;
+
+  ++ftch->spill_runs;
+  ftch->spill_recs += n;
+
+  ftchash_clear(ftch);
+
+  /*
+   * bound the open files.  The last FT_CHASH_MERGE_RUNS runs of one
+   * level are merged into a run of the next, so a record is rewritten
+   * once per level.
+   */
+  while ((ftch->nruns >= FT_CHASH_MERGE_RUNS) &&
+    (ftch->runs[ftch->nruns - FT_CHASH_MERGE_RUNS].level ==
+     ftch->runs[ftch->nruns - 1].level)) {
+
+    if (ftchash_compact(ftch, ftch->nruns - FT_CHASH_MERGE_RUNS) < 0) {
+      fterr_warnx("ftchash_compact(): failed");
+      return -1;
+    }
+
+  }
+
+  return 0;
+
+} /* ftchash_spill */
+
+/*
+ * function: ftchash_compact
+ *
+ *   merge the runs of ftch from first on into a single run of the next
+ *   level.  Equal keys are left for ftchash_unspill() to fold, only the
+ *   order matters here.
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+static int ftchash_compact(struct ftchash *ftch, unsigned int first)
+{
+  struct ftchash_src *src;
+  unsigned int nsrc, i;
+  uint64_t n;
+  FILE *fp;
+
+  if (!(fp = ftchash_tmpfile()))
+    return -1;
+
+  if (src_open(ftch, first, &src, &nsrc) < 0) {
+    fclose(fp);
+    return -1;
+  }
+
+  n = 0;
+  while (nsrc) {
+
+    if (fwrite(src[0].rec, ftch->d_size, 1, fp) != 1)
+      break;
+
+    ++n;
+    ++ftch->merge_recs;
+
+    if (src_next(ftch, src, &nsrc) < 0)
+      break;
+
+  }
+
+  src_close(src, nsrc);
+
+  if (nsrc || fflush(fp)) {
+    fterr_warn("fwrite()");
+    fclose(fp);
+    return -1;
+  }
+
+  for (i = first; i < ftch->nruns; ++i)
+    fclose(ftch->runs[i].fp);
+
+  ftch->runs[first].fp = fp;
+  ftch->runs[first].recs = n;
+  ftch->runs[first].level++;
+  ftch->nruns = first + 1;
+
+  return 0;
+
+} /* ftchash_compact */
+
+/*
+ * function: ftchash_clear
+ *
+ *   remove all records, the index keeps its size
+ */
+static void ftchash_clear(struct ftchash *ftch)
+{
+  struct ftchash_chunk *chunk;
+
+  while ((chunk = FT_SLIST_FIRST(&ftch->chunk_list))) {
+    FT_SLIST_REMOVE_HEAD(&ftch->chunk_list, chain);
+    free (chunk->base);
+    free (chunk);
+  }
+
+  ftch->active_chunk = (struct ftchash_chunk*)0L;
+  ftch->chunk_bytes = 0;
+
+  if (ftch->old_slots) {
+    free (ftch->old_slots);
+    ftch->old_slots = (struct ftchash_slot*)0L;
+    ftch->old_size = ftch->old_next = 0;
+  }
+
+  bzero(ftch->slots, ftch->h_size * sizeof (struct ftchash_slot));
+
+  if (ftch->sorted_recs) {
+    free (ftch->sorted_recs);
+    ftch->sorted_recs = (struct ftchash_rec_gen**)0L;
+  }
+
+  ftch->sorted_entries = 0;
+  ftch->sort_flags = 0;
+  ftch->entries = 0;
+
+} /* ftchash_clear */
+
+/*
+ * function: ftchash_free_runs
+ *
+ *   close and forget spilled runs
+ */
+static void ftchash_free_runs(struct ftchash *ftch)
+{
+  unsigned int i;
+
+  for (i = 0; i < ftch->nruns; ++i)
+    fclose(ftch->runs[i].fp);
+
+  if (ftch->runs)
+    free (ftch->runs);
+
+  ftch->runs = (struct ftchash_run*)0L;
+  ftch->nruns = 0;
+
+} /* ftchash_free_runs */
+
+/*
+ * function: ftchash_tmpfile
+ *
+ *   open an anonymous run file in $TMPDIR, /tmp by default
+ *
+ *   returns 0L on error
+ *           or open stream
+ */
+static FILE *ftchash_tmpfile(void)
+{
+  char path[1024], *dir;
+  FILE *fp;
+  int fd;
+
+  if (!(dir = getenv("TMPDIR")) || !*dir)
+    dir = "/tmp";
+
+  snprintf(path, sizeof path, "%s/ftchash.XXXXXX", dir);
+
+  if ((fd = mkstemp(path)) < 0) {
+    fterr_warn("mkstemp(%s)", path);
+    return (FILE*)0L;
+  }
+
+  /* gone once the stream is closed */
+  unlink(path);
+
+  if (!(fp = fdopen(fd, "w+"))) {
+    fterr_warn("fdopen()");
+    close(fd);
+  }
+
+  return fp;
+
+} /* ftchash_tmpfile */
+
+/*
+ * function: ftchash_iter_init
+ *
+ *   position iterator before the first entry of ftch.  The sorted
+ *   order is used if ftchash_sort() has been called since the last
+ *   update.
+ *
+ *   Iterators hold all traversal state, any number of them can walk the
+ *   same table at once as long as it is not updated or sorted meanwhile.
+ */
+void ftchash_iter_init(struct ftchash *ftch, struct ftchash_iter *iter)
+{
+
+  iter->ftch = ftch;
+  iter->sort_flags = ftch->sort_flags;
+
+  if (iter->sort_flags & FT_CHASH_SORTED) {
+    if (iter->sort_flags & FT_CHASH_SORT_ASCENDING)
+      iter->srec = ftch->sorted_entries;
+    else
+      iter->srec = 0;
+  } else {
+
+    iter->chunk = FT_SLIST_FIRST(&ftch->chunk_list);
+
+    if (iter->chunk)
+      iter->rec = iter->chunk->base;
+    else
+      iter->rec = (void*)0L;
+
+  } /* sorted? */
+
+} /* ftchash_iter_init */
+
+/*
+ * function: ftchash_iter_next
+ *
+ * returns next entry in hash table, or NULL if the last entry
+ * ftchash_iter_init() must be called first.
+ *
+ */
+void *ftchash_iter_next(struct ftchash_iter *iter)
+{
+  struct ftchash *ftch;
+  void *ret;
+
+  ftch = iter->ftch;
+
+  if (iter->sort_flags & FT_CHASH_SORTED) {
+    if (iter->sort_flags & FT_CHASH_SORT_ASCENDING) {
+      if (iter->srec > 0)
+        return (ftch->sorted_recs[--iter->srec]);
+      else
+        return (void*)0L;
+    } else {
+      if (iter->srec < ftch->sorted_entries)
+        return (ftch->sorted_recs[iter->srec++]);
+      else
+        return (void*)0L;
+    }
+  } else {
+
+    /* only happens on empty hash table -- done */
+    if (!iter->chunk)
+      return (void*)0L;
+
+    /* more entries in this chunk? */
+    if ((char*)iter->rec < (char*)iter->chunk->base+iter->chunk->next) {
+
+      ret = iter->rec;
+      iter->rec = (char*)iter->rec + ftch->d_size;
+
+      return ret;
+
+    } else {
+
+        /* go to next chunk */
+        iter->chunk = FT_SLIST_NEXT(iter->chunk, chain);
+
+        /* if this is a valid chunk, return first record */
+        if (iter->chunk) {
+          iter->rec = (char*)iter->chunk->base + ftch->d_size;
+          return (iter->chunk->base);
+        } else { /* else that was the last chunk, done */
+          return (void*)0L;
+        }
+    }
+  } /* sorted? */
+} /* ftchash_iter_next */
+
+/*
+ * function: ftchash_first
+ *
+ * setup ftchash_foreach to first entry, using the iterator
+ * embedded in ftch.
+ */
+void ftchash_first(struct ftchash *ftch)
+{
+
+  ftchash_iter_init(ftch, &ftch->iter);
+
+} /* ftchash_first */
+
+/*
+ * function: ftchash_foreach
+ *
+ * returns next entry in hash table, or NULL if the last entry
+ * ftchash_first() must be called first.
+ *
+ */
+void *ftchash_foreach(struct ftchash *ftch)
+{
+
+  return ftchash_iter_next(&ftch->iter);
+
+} /* ftchash_foreach */
+
+/*
+ * function: ftchash_sort
+ *
+ *   creates an array of pointers to the sorted records
+ *
+ *   The sort is stable with the field offset and width passed down
+ *   explicitly, there is no global state, so different tables may be
+ *   sorted concurrently.  Tables of FT_CHASH_RADIX_MIN entries or more
+ *   are radix sorted, smaller ones merge sorted.
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+int ftchash_sort(struct ftchash *ftch, int offset, int flags)
+{
+  struct ftchash_iter iter;
+  void **tmp;
+  void *rec;
+  uint64_t x;
+
+  /* entries to sort? */
+  if (!ftch->entries)
+    return 0;
 
-  d = *(char**)a;
-  ca = (uint8_t*)(d+sort_offset+4);
+  /* free memory from previous call */
+  ftch->sort_flags &= ~FT_CHASH_SORTED;
+  if (ftch->sorted_recs) {
+    free(ftch->sorted_recs);
+    ftch->sorted_recs = (struct ftchash_rec_gen**)0L;
+  }
 
-  d = *(char**)b;
-  cb = (uint8_t*)(d+sort_offset+4);
-  
-  if (*ca < *cb)
+  /* allocate ftch->entries * sizeof 32 bit pointer */
+  if (!(ftch->sorted_recs = (struct ftchash_rec_gen**)
+    malloc(sizeof (struct ftchash_rec_gen*)*ftch->entries))) {
+    fterr_warn("malloc()");
     return -1;
-  if (*ca > *cb)
-    return 1;
-  
+  }
+
+  ftch->sort_flags = flags;
+
+  /* copy in the unsorted entries */
+  ftchash_iter_init(ftch, &iter);
+  x = 0;
+  while ((rec = ftchash_iter_next(&iter))) {
+
+    ftch->sorted_recs[x++] = (struct ftchash_rec_gen*)rec;
+
+  } /* while */
+
+  /* large tables radix sort, falling back to merge sort without memory */
+  if ((ftch->entries < FT_CHASH_RADIX_MIN) ||
+    (rsort_recs((void**)ftch->sorted_recs, ftch->entries, offset, flags) < 0)) {
+
+    /* merge buffer, holds the lower half of a merge */
+    if (!(tmp = (void**)malloc(sizeof (void*)*(ftch->entries/2+1)))) {
+      fterr_warn("malloc()");
+      return -1;
+    }
+
+    msort_recs((void**)ftch->sorted_recs, tmp, ftch->entries, offset, flags);
+
+    free(tmp);
+
+  }
+
+  ftch->sorted_entries = ftch->entries;
+  ftch->sort_flags |= FT_CHASH_SORTED;
+
   return 0;
 
-} /* cmp40 */
+} /* ftchash_sort */
 
-static int cmp32(const void *a, const void *b)
+/*
+ * function: ftchash_sort_topk
+ *
+ *   like ftchash_sort() but only the first k records of the sorted
+ *   traversal are kept.  ftchash_foreach() returns at most k records.
+ *
+ *   The k records are selected with a bounded heap in one pass over the
+ *   table, O(n log k) instead of O(n log n) and k pointers of storage
+ *   instead of n.  Equal values keep traversal order, as the full sort
+ *   does, so the output matches the first k records of ftchash_sort().
+ *
+ *   k of 0, or a k that is a large part of the table, falls back to the
+ *   full sort.
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+int ftchash_sort_topk(struct ftchash *ftch, int offset, int flags,
+  uint64_t k)
 {
-  uint32_t *la, *lb;
-  char *d;
+  struct ftchash_iter iter;
+  struct ftchash_topk *heap;
+  struct ftchash_topk e;
+  uint64_t n, idx, i;
+  void *rec;
+  int largest;
 
-  d = *(char**)a;
-  la = (uint32_t*)(d+sort_offset);
+  if (!k || (k >= ftch->entries / 4))
+    return ftchash_sort(ftch, offset, flags);
 
-  d = *(char**)b;
-  lb = (uint32_t*)(d+sort_offset);
+  /*
+   * ascending traversal walks the sorted array backwards, keep the k
+   * largest.  Otherwise keep the k smallest.
+   */
+  largest = (flags & FT_CHASH_SORT_ASCENDING) ? 1 : 0;
 
-  if (*la < *lb)
+  if (!(heap = (struct ftchash_topk*)malloc(sizeof (*heap) * k))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  /* free memory from previous call */
+  ftch->sort_flags &= ~FT_CHASH_SORTED;
+  if (ftch->sorted_recs) {
+    free(ftch->sorted_recs);
+    ftch->sorted_recs = (struct ftchash_rec_gen**)0L;
+  }
+
+  if (!(ftch->sorted_recs = (struct ftchash_rec_gen**)
+    malloc(sizeof (struct ftchash_rec_gen*)*k))) {
+    fterr_warn("malloc()");
+    free(heap);
     return -1;
-  if (*la > *lb)
-    return 1;
+  }
+
+  ftch->sort_flags = flags;
+
+  /*
+   * heap[0] is the record that would be dropped first, a new record
+   * replaces it when it ranks ahead.
+   */
+  ftchash_iter_init(ftch, &iter);
+  n = idx = 0;
+  while ((rec = ftchash_iter_next(&iter))) {
+
+    e.rec = rec;
+    e.idx = idx++;
+
+    if (n < k) {
+      heap[n++] = e;
+      topk_siftup(heap, n - 1, offset, flags, largest);
+    } else if (topk_cmp(&e, &heap[0], offset, flags, largest) > 0) {
+      heap[0] = e;
+      topk_siftdown(heap, n, 0, offset, flags, largest);
+    }
+
+  } /* while */
+
+  /* drain worst first into ascending order */
+  ftch->sorted_entries = n;
+  for (i = 0; n; ++i) {
+    if (largest)
+      ftch->sorted_recs[i] = (struct ftchash_rec_gen*)heap[0].rec;
+    else
+      ftch->sorted_recs[n-1] = (struct ftchash_rec_gen*)heap[0].rec;
+    heap[0] = heap[--n];
+    topk_siftdown(heap, n, 0, offset, flags, largest);
+  }
+
+  free(heap);
+
+  ftch->sort_flags |= FT_CHASH_SORTED;
+
+  return 0;
+
+} /* ftchash_sort_topk */
+
+/*
+ * function: cmp_val
+ *
+ *   compare the sort field of two records
+ */
+static int cmp_val(const char *a, const char *b, int offset, int flags)
+{
+  a += offset;
+  b += offset;
+
+  if (flags & FT_CHASH_SORT_64) {
+    if (*(uint64_t*)a != *(uint64_t*)b)
+      return (*(uint64_t*)a < *(uint64_t*)b) ? -1 : 1;
+  } else if (flags & FT_CHASH_SORT_40) {
+    if (*(uint32_t*)a != *(uint32_t*)b)
+      return (*(uint32_t*)a < *(uint32_t*)b) ? -1 : 1;
+    if (*(uint8_t*)(a+4) != *(uint8_t*)(b+4))
+      return (*(uint8_t*)(a+4) < *(uint8_t*)(b+4)) ? -1 : 1;
+  } else if (flags & FT_CHASH_SORT_32) {
+    if (*(uint32_t*)a != *(uint32_t*)b)
+      return (*(uint32_t*)a < *(uint32_t*)b) ? -1 : 1;
+  } else if (flags & FT_CHASH_SORT_16) {
+    if (*(uint16_t*)a != *(uint16_t*)b)
+      return (*(uint16_t*)a < *(uint16_t*)b) ? -1 : 1;
+  } else if (flags & FT_CHASH_SORT_8) {
+    if (*(uint8_t*)a != *(uint8_t*)b)
+      return (*(uint8_t*)a < *(uint8_t*)b) ? -1 : 1;
+  } else if (flags & FT_CHASH_SORT_DOUBLE) {
+    if (*(double*)a < *(double*)b)
+      return -1;
+    if (*(double*)a > *(double*)b)
+      return 1;
+  } else if (flags & FT_CHASH_SORT_KEY) {
+    return memcmp(a, b, (unsigned int)flags >> 16);
+  } else
+    fterr_errx(1, "cmp_val(): internal error");
+
   return 0;
 
-} /* cmp32 */
+} /* cmp_val */
+
+/*
+ * function: msort_recs
+ *
+ *   stable merge sort of n record pointers on the field at offset.
+ *   tmp must hold n/2+1 pointers.  Short runs use insertion sort.
+ */
+static void msort_recs(void **a, void **tmp, uint64_t n, int offset,
+  int flags)
+{
+  uint64_t i, j, k, h;
+  void *t;
+
+  if (n <= FT_CHASH_ISORT) {
+    for (i = 1; i < n; ++i) {
+      t = a[i];
+      for (j = i; j && (cmp_val((char*)a[j-1], (char*)t, offset, flags) > 0);
+        --j)
+        a[j] = a[j-1];
+      a[j] = t;
+    }
+    return;
+  }
+
+  h = n / 2;
+  msort_recs(a, tmp, h, offset, flags);
+  msort_recs(a+h, tmp, n-h, offset, flags);
+
+  /* halves already in order? */
+  if (cmp_val((char*)a[h-1], (char*)a[h], offset, flags) <= 0)
+    return;
+
+  /* merge, ties go to the lower half */
+  bcopy(a, tmp, h * sizeof (void*));
+  i = k = 0; j = h;
+  while ((i < h) && (j < n)) {
+    if (cmp_val((char*)a[j], (char*)tmp[i], offset, flags) < 0)
+      a[k++] = a[j++];
+    else
+      a[k++] = tmp[i++];
+  }
+  while (i < h)
+    a[k++] = tmp[i++];
+
+} /* msort_recs */
 
-static int cmp16(const void *a, const void *b)
+/*
+ * function: sort_key
+ *
+ *   sort field of rec as an unsigned integer with the same order as
+ *   cmp_val().  Doubles map to their IEEE bits with the sign bit
+ *   flipped for positives and all bits flipped for negatives.
+ */
+static uint64_t sort_key(const char *rec, int offset, int flags)
 {
-  uint16_t *la, *lb;
-  char *d;
+  uint64_t u;
+  double d;
+
+  rec += offset;
+
+  if (flags & FT_CHASH_SORT_64)
+    return *(uint64_t*)rec;
+  else if (flags & FT_CHASH_SORT_40)
+    return ((uint64_t)*(uint32_t*)rec << 8) | *(uint8_t*)(rec+4);
+  else if (flags & FT_CHASH_SORT_32)
+    return *(uint32_t*)rec;
+  else if (flags & FT_CHASH_SORT_16)
+    return *(uint16_t*)rec;
+  else if (flags & FT_CHASH_SORT_8)
+    return *(uint8_t*)rec;
+  else if (flags & FT_CHASH_SORT_DOUBLE) {
+    d = *(double*)rec;
+    if (d == 0.0)   /* -0.0 and 0.0 compare equal */
+      d = 0.0;
+    bcopy(&d, &u, sizeof u);
+    return (u & 0x8000000000000000ULL) ? ~u : u | 0x8000000000000000ULL;
+  } else
+    fterr_errx(1, "sort_key(): internal error");
 
-  d = *(char**)a;
-  la = (uint16_t*)(d+sort_offset);
+  return 0;
+
+} /* sort_key */
+
+/*
+ * function: rsort_recs
+ *
+ *   stable LSD radix sort of n record pointers on the field at offset.
+ *   (key, pointer) pairs are extracted once into a contiguous array so
+ *   the passes never chase record pointers.  Byte histograms for every
+ *   pass are built in the extraction pass, and passes where all keys
+ *   share a byte are skipped.
+ *
+ *   returns -1 if the pair arrays can't be allocated
+ *            0 otherwise
+ */
+static int rsort_recs(void **a, uint64_t n, int offset, int flags)
+{
+  uint64_t hist[8][256];            /* on stack, sorts are reentrant */
+  struct ftchash_kp *kp, *src, *dst, *t;
+  uint64_t i, sum, c;
+  int b, nbytes, shift;
 
-  d = *(char**)b;
-  lb = (uint16_t*)(d+sort_offset);
+  if (flags & FT_CHASH_SORT_8)
+    nbytes = 1;
+  else if (flags & FT_CHASH_SORT_16)
+    nbytes = 2;
+  else if (flags & FT_CHASH_SORT_32)
+    nbytes = 4;
+  else if (flags & FT_CHASH_SORT_40)
+    nbytes = 5;
+  else
+    nbytes = 8;
 
-  if (*la < *lb)
+  if (!(kp = (struct ftchash_kp*)malloc(sizeof (*kp) * n * 2)))
     return -1;
-  if (*la > *lb)
-    return 1;
+
+  bzero(hist, sizeof hist);
+
+  for (i = 0; i < n; ++i) {
+    kp[i].key = sort_key((char*)a[i], offset, flags);
+    kp[i].rec = a[i];
+    for (b = 0; b < nbytes; ++b)
+      ++hist[b][(kp[i].key >> (b*8)) & 0xFF];
+  }
+
+  src = kp;
+  dst = kp + n;
+
+  for (b = 0; b < nbytes; ++b) {
+
+    shift = b*8;
+
+    /* every key has the same byte here */
+    if (hist[b][(src[0].key >> shift) & 0xFF] == n)
+      continue;
+
+    /* counts to starting offsets */
+    for (sum = 0, i = 0; i < 256; ++i) {
+      c = hist[b][i];
+      hist[b][i] = sum;
+      sum += c;
+    }
+
+    for (i = 0; i < n; ++i)
+      dst[hist[b][(src[i].key >> shift) & 0xFF]++] = src[i];
+
+    t = src; src = dst; dst = t;
+
+  }
+
+  for (i = 0; i < n; ++i)
+    a[i] = src[i].rec;
+
+  free(kp);
+
   return 0;
 
-} /* cmp16 */
+} /* rsort_recs */
+
+/*
+ * function: topk_cmp
+ *
+ *   > 0 if a ranks ahead of b in the selection.  Ties go to the
+ *   record seen first in traversal order, matching the stable sort.
+ */
+static int topk_cmp(struct ftchash_topk *a, struct ftchash_topk *b,
+  int offset, int flags, int largest)
+{
+  int c;
+
+  /* no sort field, traversal order only */
+  if (offset < 0)
+    c = 0;
+  else
+    c = cmp_val((char*)a->rec, (char*)b->rec, offset, flags);
+
+  if (!c)
+    c = (a->idx < b->idx) ? -1 : 1;
+
+  /*
+   * keeping the largest, the later of two equal records ranks ahead
+   * as it is traversed first from the end of the array.
+   */
+  return largest ? c : -c;
+
+} /* topk_cmp */
+
+static void topk_siftup(struct ftchash_topk *heap, uint64_t i, int offset,
+  int flags, int largest)
+{
+  struct ftchash_topk t;
+  uint64_t p;
+
+  while (i) {
+    p = (i - 1) / 2;
+    if (topk_cmp(&heap[p], &heap[i], offset, flags, largest) <= 0)
+      break;
+    t = heap[p]; heap[p] = heap[i]; heap[i] = t;
+    i = p;
+  }
 
-static int cmp8(const void *a, const void *b)
+} /* topk_siftup */
+
+static void topk_siftdown(struct ftchash_topk *heap, uint64_t n, uint64_t i,
+  int offset, int flags, int largest)
 {
-  uint8_t *la, *lb;
-  char *d;
+  struct ftchash_topk t;
+  uint64_t c;
+
+  while ((c = 2 * i + 1) < n) {
+    if ((c + 1 < n) &&
+      (topk_cmp(&heap[c+1], &heap[c], offset, flags, largest) < 0))
+      ++c;
+    if (topk_cmp(&heap[i], &heap[c], offset, flags, largest) <= 0)
+      break;
+    t = heap[c]; heap[c] = heap[i]; heap[i] = t;
+    i = c;
+  }
 
-  d = *(char**)a;
-  la = (uint8_t*)(d+sort_offset);
+} /* topk_siftdown */
+
+/*
+ * function: src_open
+ *
+ *   read the first record of each run of ftch from first on into a
+ *   heap for merging
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+static int src_open(struct ftchash *ftch, unsigned int first,
+  struct ftchash_src **srcp, unsigned int *nsrcp)
+{
+  struct ftchash_src *src;
+  unsigned int nsrc, i;
+  int keyoff, kflags;
 
-  d = *(char**)b;
-  lb = (uint8_t*)(d+sort_offset);
+  keyoff = offsetof(struct ftchash_rec_gen, data);
+  kflags = FT_CHASH_KEY_FLAGS(ftch);
 
-  if (*la < *lb)
+  if (!(src = (struct ftchash_src*)malloc((ftch->nruns - first) *
+    sizeof *src))) {
+    fterr_warn("malloc()");
     return -1;
-  if (*la > *lb)
-    return 1;
+  }
+
+  for (nsrc = 0; first + nsrc < ftch->nruns; ++nsrc) {
+
+    src[nsrc].fp = ftch->runs[first + nsrc].fp;
+    src[nsrc].left = ftch->runs[first + nsrc].recs;
+    src[nsrc].run = nsrc;
+
+    if (!(src[nsrc].rec = (char*)malloc(ftch->d_size))) {
+      fterr_warn("malloc()");
+      src_close(src, nsrc);
+      return -1;
+    }
+
+    if (fseek(src[nsrc].fp, 0L, SEEK_SET) ||
+      (fread(src[nsrc].rec, ftch->d_size, 1, src[nsrc].fp) != 1)) {
+      fterr_warn("fread()");
+      src_close(src, nsrc+1);
+      return -1;
+    }
+
+  }
+
+  for (i = nsrc / 2; i > 0; --i)
+    src_siftdown(src, nsrc, i - 1, keyoff, kflags);
+
+  *srcp = src;
+  *nsrcp = nsrc;
+
   return 0;
 
-} /* cmp8 */
+} /* src_open */
 
-static int cmp_double(const void *a, const void *b)
+/*
+ * function: src_next
+ *
+ *   replace the top of the heap with the next record of its run
+ *
+ *   returns -1 on error
+ *            0 otherwise
+ */
+static int src_next(struct ftchash *ftch, struct ftchash_src *src,
+  unsigned int *nsrcp)
 {
-  double *la, *lb;
-  char *d;
 
-  d = *(char**)a;
-  la = (double*)(d+sort_offset);
+  if (--src[0].left) {
+    if (fread(src[0].rec, ftch->d_size, 1, src[0].fp) != 1) {
+      fterr_warn("fread()");
+      return -1;
+    }
+  } else {
+    free(src[0].rec);
+    src[0] = src[--*nsrcp];
+  }
 
-  d = *(char**)b;
-  lb = (double*)(d+sort_offset);
+  src_siftdown(src, *nsrcp, 0, offsetof(struct ftchash_rec_gen, data),
+    FT_CHASH_KEY_FLAGS(ftch));
 
-  if (*la < *lb)
-    return -1;
-  if (*la > *lb)
-    return 1;
   return 0;
 
-} /* cmp_double */
+} /* src_next */
+
+/*
+ * function: src_close
+ *
+ *   free a heap from src_open()
+ */
+static void src_close(struct ftchash_src *src, unsigned int nsrc)
+{
+
+  if (src) {
+    while (nsrc)
+      free(src[--nsrc].rec);
+    free(src);
+  }
+
+} /* src_close */
+
+/*
+ * function: src_siftdown
+ *
+ *   heap of runs being merged, smallest key on top.  Equal keys come
+ *   off in run order.
+ */
+static void src_siftdown(struct ftchash_src *heap, unsigned int n,
+  unsigned int i, int keyoff, int kflags)
+{
+  struct ftchash_src t;
+  unsigned int c;
+  int x;
+
+  while ((c = 2 * i + 1) < n) {
+
+    if (c + 1 < n) {
+      x = cmp_val(heap[c+1].rec, heap[c].rec, keyoff, kflags);
+      if ((x < 0) || (!x && (heap[c+1].run < heap[c].run)))
+        ++c;
+    }
+
+    x = cmp_val(heap[i].rec, heap[c].rec, keyoff, kflags);
+    if ((x < 0) || (!x && (heap[i].run < heap[c].run)))
+      break;
+
+    t = heap[c]; heap[c] = heap[i]; heap[i] = t;
+    i = c;
+
+  }
+
+} /* src_siftdown */
+
+/*
+ * function: topk_idx_cmp
+ *
+ *   qsort() selected records into traversal order
+ */
+static int topk_idx_cmp(const void *a, const void *b)
+{
+  uint64_t x, y;
+
+  x = ((struct ftchash_topk*)a)->idx;
+  y = ((struct ftchash_topk*)b)->idx;
+
+  return (x < y) ? -1 : (x > y);
 
+} /* topk_idx_cmp */
@@ -0,0 +1,759 @@
+/*
+ * Copyright (c) 2026 The flow-tools authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *      $Id$
+ */
+
+#include "ftinclude.h"
+#include "ftlib.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+/*
+ * Column files.  The records of a flow file are kept as blocks, each
+ * field of a block is one column encoded on its own (raw, delta of the
+ * previous value or a dictionary of up to 256 values, whichever is
+ * smallest) and compressed on its own.  A reader selects the fields it
+ * needs, typically ftstat_def_need_xfields(), the other columns are
+ * skipped without being decompressed and read back as 0.  Records are
+ * handed out in the layout of their version so fts3rec_compute_offsets()
+ * and everything that takes a flow record works unchanged.
+ *
+ *   struct ftcol ftc;
+ *   char *rec;
+ *
+ *   ftcol_open_read(&ftc, fp);
+ *   ftcol_select(&ftc, need);
+ *   while ((rec = ftcol_read(&ftc)))
+ *     ...
+ *   ftcol_close(&ftc);
+ */
+
+#define FT_COL_OFF(F) offsetof(struct fts3rec_offsets, F)
+
+/* the flow fields, offset of their offset in fts3rec_offsets and width */
+static struct ftcol_field {
+  uint64_t xfield;
+  size_t fo_off;
+  uint8_t width;
+} ftcol_fields[] = {
+  {FT_XFIELD_UNIX_SECS, FT_COL_OFF(unix_secs), 4},
+  {FT_XFIELD_UNIX_NSECS, FT_COL_OFF(unix_nsecs), 4},
+  {FT_XFIELD_SYSUPTIME, FT_COL_OFF(sysUpTime), 4},
+  {FT_XFIELD_EXADDR, FT_COL_OFF(exaddr), 4},
+  {FT_XFIELD_DFLOWS, FT_COL_OFF(dFlows), 4},
+  {FT_XFIELD_DPKTS, FT_COL_OFF(dPkts), 4},
+  {FT_XFIELD_DOCTETS, FT_COL_OFF(dOctets), 4},
+  {FT_XFIELD_FIRST, FT_COL_OFF(First), 4},
+  {FT_XFIELD_LAST, FT_COL_OFF(Last), 4},
+  {FT_XFIELD_ENGINE_TYPE, FT_COL_OFF(engine_type), 1},
+  {FT_XFIELD_ENGINE_ID, FT_COL_OFF(engine_id), 1},
+  {FT_XFIELD_SRCADDR, FT_COL_OFF(srcaddr), 4},
+  {FT_XFIELD_DSTADDR, FT_COL_OFF(dstaddr), 4},
+  {FT_XFIELD_NEXTHOP, FT_COL_OFF(nexthop), 4},
+  {FT_XFIELD_INPUT, FT_COL_OFF(input), 2},
+  {FT_XFIELD_OUTPUT, FT_COL_OFF(output), 2},
+  {FT_XFIELD_SRCPORT, FT_COL_OFF(srcport), 2},
+  {FT_XFIELD_DSTPORT, FT_COL_OFF(dstport), 2},
+  {FT_XFIELD_PROT, FT_COL_OFF(prot), 1},
+  {FT_XFIELD_TOS, FT_COL_OFF(tos), 1},
+  {FT_XFIELD_TCP_FLAGS, FT_COL_OFF(tcp_flags), 1},
+  {FT_XFIELD_SRC_MASK, FT_COL_OFF(src_mask), 1},
+  {FT_XFIELD_DST_MASK, FT_COL_OFF(dst_mask), 1},
+  {FT_XFIELD_SRC_AS, FT_COL_OFF(src_as), 2},
+  {FT_XFIELD_DST_AS, FT_COL_OFF(dst_as), 2},
+  {FT_XFIELD_IN_ENCAPS, FT_COL_OFF(in_encaps), 1},
+  {FT_XFIELD_OUT_ENCAPS, FT_COL_OFF(out_encaps), 1},
+  {FT_XFIELD_PEER_NEXTHOP, FT_COL_OFF(peer_nexthop), 4},
+  {FT_XFIELD_ROUTER_SC, FT_COL_OFF(router_sc), 4},
+  {FT_XFIELD_EXTRA_PKTS, FT_COL_OFF(extra_pkts), 4},
+  {FT_XFIELD_MARKED_TOS, FT_COL_OFF(marked_tos), 1},
+  {FT_XFIELD_SRC_TAG, FT_COL_OFF(src_tag), 4},
+  {FT_XFIELD_DST_TAG, FT_COL_OFF(dst_tag), 4},
+  {0, 0, 0}
+};
+
+#define FT_COL_DICT_HSIZE 1024 /* > 256 */
+
+static int ftcol_setup(struct ftcol *ftc);
+static int ftcol_flush(struct ftcol *ftc);
+static uint32_t ftcol_enc_delta(char *buf, uint32_t *vals, uint32_t n);
+static uint32_t ftcol_enc_dict(char *buf, uint32_t *vals, uint32_t n,
+  int width);
+static int ftcol_dec(struct ftcol *ftc, struct ftcol_col *col,
+  struct ftcol_dir *dir, char *buf);
+static int ftcol_fill(struct ftcol *ftc);
+
+/*
+ * function: ftcol_setup
+ *
+ * Columns and buffers for ftc->ftv, ftc->hdr must be filled in.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int ftcol_setup(struct ftcol *ftc)
+{
+  struct ftcol_field *f;
+  uint32_t n;
+
+  if (fts3rec_compute_offsets(&ftc->fo, &ftc->ftv) < 0) {
+    fterr_warnx("fts3rec_compute_offsets(): failed");
+    return -1;
+  }
+
+  for (f = ftcol_fields; f->xfield; ++f) {
+
+    if (!(ftc->hdr.xfields & f->xfield))
+      continue;
+
+    ftc->cols[ftc->ncols].xfield = f->xfield;
+    ftc->cols[ftc->ncols].off = *(uint16_t*)((char*)&ftc->fo + f->fo_off);
+    ftc->cols[ftc->ncols].width = f->width;
+    ++ftc->ncols;
+
+  }
+
+  n = FT_COL_BLOCK_RECS;
+
+  /* delta is at most 5 bytes a value, dictionary 2 + 256 * 4 + n */
+  ftc->buf_size = n * 5 + 2 + 256 * 4;
+  ftc->zbuf_size = compressBound(ftc->buf_size);
+  ftc->out_size = n * ftc->hdr.rec_size;
+
+  if (!(ftc->recs = (char*)malloc(n * ftc->hdr.rec_size)) ||
+      !(ftc->vals = (uint32_t*)malloc(n * sizeof (uint32_t))) ||
+      !(ftc->buf = (char*)malloc(ftc->buf_size)) ||
+      !(ftc->zbuf = (char*)malloc(ftc->zbuf_size)) ||
+      (ftc->write && !(ftc->out = (char*)malloc(ftc->out_size)))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  return 0;
+
+} /* ftcol_setup */
+
+/*
+ * function: ftcol_open_write
+ *
+ * Start the column file fp for records of version ftv.  Each column is
+ * compressed at z_level, 0 stores it encoded only.  The caller owns fp.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftcol_open_write(struct ftcol *ftc, FILE *fp, struct ftver *ftv,
+  int z_level)
+{
+
+  bzero(ftc, sizeof *ftc);
+  ftc->fp = fp;
+  ftc->write = 1;
+  ftc->z_level = z_level;
+  bcopy(ftv, &ftc->ftv, sizeof ftc->ftv);
+
+  ftc->hdr.magic = FT_COL_MAGIC;
+  ftc->hdr.version = FT_COL_VERSION;
+  ftc->hdr.d_version = ftv->d_version;
+  ftc->hdr.agg_version = ftv->agg_version;
+  ftc->hdr.agg_method = ftv->agg_method;
+  ftc->hdr.xfields = ftrec_xfield(ftv);
+
+  if (ftrec_size(ftv) <= 0) {
+    fterr_warnx("ftcol_open_write(): unsupported version.");
+    return -1;
+  }
+
+  ftc->hdr.rec_size = ftrec_size(ftv);
+
+  if (ftcol_setup(ftc) < 0)
+    return -1;
+
+  ftc->xfields = ftc->hdr.xfields;
+
+  if (fwrite(&ftc->hdr, sizeof ftc->hdr, 1, fp) != 1) {
+    fterr_warn("fwrite()");
+    return -1;
+  }
+
+  return 0;
+
+} /* ftcol_open_write */
+
+/*
+ * function: ftcol_write
+ *
+ * Add rec to the current block, written when full.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftcol_write(struct ftcol *ftc, char *rec)
+{
+
+  bcopy(rec, ftc->recs + ftc->nrecs * ftc->hdr.rec_size, ftc->hdr.rec_size);
+
+  if (++ftc->nrecs == FT_COL_BLOCK_RECS)
+    return ftcol_flush(ftc);
+
+  return 0;
+
+} /* ftcol_write */
+
+/*
+ * function: ftcol_enc_delta
+ *
+ * Encode n vals into buf as zigzag varints of the difference to the
+ * previous value.  Time fields change slowly and get 1 or 2 bytes.
+ *
+ * returns: bytes used
+ */
+static uint32_t ftcol_enc_delta(char *buf, uint32_t *vals, uint32_t n)
+{
+  uint32_t i, prev, z, len;
+  int32_t d;
+
+  prev = 0;
+  len = 0;
+
+  for (i = 0; i < n; ++i) {
+
+    d = (int32_t)(vals[i] - prev);
+    z = ((uint32_t)d << 1) ^ (uint32_t)(d >> 31);
+    prev = vals[i];
+
+    while (z >= 0x80) {
+      buf[len++] = (char)(z | 0x80);
+      z >>= 7;
+    }
+
+    buf[len++] = (char)z;
+
+  }
+
+  return len;
+
+} /* ftcol_enc_delta */
+
+/*
+ * function: ftcol_enc_dict
+ *
+ * Encode n vals into buf as a dictionary and an index byte per value.
+ *
+ * returns: bytes used
+ *          0 more than 256 distinct values
+ */
+static uint32_t ftcol_enc_dict(char *buf, uint32_t *vals, uint32_t n,
+  int width)
+{
+  uint32_t hval[FT_COL_DICT_HSIZE];
+  uint16_t hidx[FT_COL_DICT_HSIZE], k;
+  uint8_t *idx;
+  uint32_t i, h, len;
+  uint8_t v8;
+  uint16_t v16;
+
+  bzero(hidx, sizeof hidx);
+
+  k = 0;
+  len = sizeof k + 256 * width;
+  idx = (uint8_t*)buf + len;
+
+  for (i = 0; i < n; ++i) {
+
+    h = (vals[i] * 2654435761U) >> 22;
+
+    /* hidx is 1 + dictionary index, 0 unused */
+    while (hidx[h] && (hval[h] != vals[i]))
+      h = (h + 1) & (FT_COL_DICT_HSIZE-1);
+
+    if (!hidx[h]) {
+
+      if (k == 256)
+        return 0;
+
+      hval[h] = vals[i];
+      hidx[h] = ++k;
+
+      if (width == 4) {
+        bcopy(&vals[i], buf + sizeof k + (k-1) * 4, 4);
+      } else if (width == 2) {
+        v16 = vals[i];
+        bcopy(&v16, buf + sizeof k + (k-1) * 2, 2);
+      } else {
+        v8 = vals[i];
+        bcopy(&v8, buf + sizeof k + (k-1), 1);
+      }
+
+    }
+
+    idx[i] = hidx[h] - 1;
+
+  }
+
+  /* close the gap after the k values */
+  bcopy(&k, buf, sizeof k);
+  memmove(buf + sizeof k + k * width, idx, n);
+
+  return sizeof k + k * width + n;
+
+} /* ftcol_enc_dict */
+
+/*
+ * function: ftcol_flush
+ *
+ * Write the block of records in ftc as columns.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int ftcol_flush(struct ftcol *ftc)
+{
+  struct ftcol_blk blk;
+  struct ftcol_dir dir[FT_COL_MAXCOLS];
+  struct ftcol_col *col;
+  uLongf zlen;
+  uint32_t i, n, raw, len, olen;
+  char *rec;
+  int c;
+
+  if (!(n = ftc->nrecs))
+    return 0;
+
+  bzero(dir, sizeof dir);
+  olen = 0;
+
+  for (c = 0; c < ftc->ncols; ++c) {
+
+    col = &ftc->cols[c];
+
+    for (i = 0, rec = ftc->recs + col->off; i < n;
+      ++i, rec += ftc->hdr.rec_size) {
+      if (col->width == 4)
+        ftc->vals[i] = *(uint32_t*)rec;
+      else if (col->width == 2)
+        ftc->vals[i] = *(uint16_t*)rec;
+      else
+        ftc->vals[i] = *(uint8_t*)rec;
+    }
+
+    dir[c].xfield = col->xfield;
+    dir[c].width = col->width;
+
+    /* smallest of raw, delta and dictionary */
+    raw = n * col->width;
+    dir[c].enc = FT_COL_ENC_RAW;
+    dir[c].len = raw;
+
+    if (col->width > 1) {
+
+      len = ftcol_enc_dict(ftc->buf, ftc->vals, n, col->width);
+
+      if (len && (len < dir[c].len)) {
+        dir[c].enc = FT_COL_ENC_DICT;
+        dir[c].len = len;
+      }
+
+      len = ftcol_enc_delta(ftc->buf, ftc->vals, n);
+
+      if (len < dir[c].len) {
+        dir[c].enc = FT_COL_ENC_DELTA;
+        dir[c].len = len;
+      }
+
+    }
+
+    /* buf holds the delta encoding, redo the winner if it was not that */
+    if (dir[c].enc == FT_COL_ENC_RAW) {
+      for (i = 0, rec = ftc->buf; i < n; ++i, rec += col->width)
+        bcopy(ftc->recs + i * ftc->hdr.rec_size + col->off, rec, col->width);
+    } else if (dir[c].enc == FT_COL_ENC_DICT) {
+      ftcol_enc_dict(ftc->buf, ftc->vals, n, col->width);
+    }
+
+    if (ftc->z_level) {
+
+      zlen = ftc->zbuf_size;
+
+      if (compress2((Bytef*)ftc->zbuf, &zlen, (Bytef*)ftc->buf, dir[c].len,
+        ftc->z_level) != Z_OK) {
+        fterr_warnx("compress2(): failed");
+        return -1;
+      }
+
+      if (zlen < dir[c].len)
+        dir[c].zlen = zlen;
+
+    }
+
+    len = dir[c].zlen ? dir[c].zlen : dir[c].len;
+
+    /* never larger than raw, which fits a block of records */
+    bcopy(dir[c].zlen ? ftc->zbuf : ftc->buf, ftc->out + olen, len);
+    olen += len;
+
+  } /* foreach column */
+
+  blk.nrecs = n;
+  blk.ncols = ftc->ncols;
+
+  if ((fwrite(&blk, sizeof blk, 1, ftc->fp) != 1) ||
+      (fwrite(dir, sizeof dir[0], blk.ncols, ftc->fp) != blk.ncols) ||
+      (fwrite(ftc->out, 1, olen, ftc->fp) != olen)) {
+    fterr_warn("fwrite()");
+    return -1;
+  }
+
+  ftc->nrecs = 0;
+
+  return 0;
+
+} /* ftcol_flush */
+
+/*
+ * function: ftcol_open_read
+ *
+ * Start reading the column file fp, every column is decoded until
+ * ftcol_select().  The version of the records is in ftc->ftv and their
+ * offsets in ftc->fo.  The caller owns fp.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftcol_open_read(struct ftcol *ftc, FILE *fp)
+{
+
+  bzero(ftc, sizeof *ftc);
+  ftc->fp = fp;
+
+  if (fread(&ftc->hdr, sizeof ftc->hdr, 1, fp) != 1) {
+    fterr_warnx("ftcol_open_read(): short header.");
+    return -1;
+  }
+
+  if (ftc->hdr.magic != FT_COL_MAGIC) {
+    fterr_warnx("ftcol_open_read(): bad magic, not a column file or other byte order.");
+    return -1;
+  }
+
+  if (ftc->hdr.version != FT_COL_VERSION) {
+    fterr_warnx("ftcol_open_read(): unsupported version %lu.",
+      (unsigned long)ftc->hdr.version);
+    return -1;
+  }
+
+  ftc->ftv.s_version = FT_IO_SVERSION;
+  ftc->ftv.d_version = ftc->hdr.d_version;
+  ftc->ftv.agg_version = ftc->hdr.agg_version;
+  ftc->ftv.agg_method = ftc->hdr.agg_method;
+  ftc->ftv.set = 1;
+
+  if ((ftrec_size(&ftc->ftv) != (int)ftc->hdr.rec_size) ||
+      (ftc->hdr.xfields & ~ftrec_xfield(&ftc->ftv))) {
+    fterr_warnx("ftcol_open_read(): header does not match version.");
+    return -1;
+  }
+
+  if (ftcol_setup(ftc) < 0)
+    return -1;
+
+  ftc->xfields = ftc->hdr.xfields;
+
+  /* a pipe reads the columns that are skipped */
+  ftc->seekable = (fseek(fp, 0L, SEEK_CUR) == 0);
+
+  return 0;
+
+} /* ftcol_open_read */
+
+/*
+ * function: ftcol_select
+ *
+ * Decode only the columns of xfields from the next block on, the other
+ * fields of the records are 0.
+ */
+void ftcol_select(struct ftcol *ftc, uint64_t xfields)
+{
+
+  ftc->xfields = ftc->hdr.xfields & xfields;
+
+} /* ftcol_select */
+
+/*
+ * function: ftcol_dec
+ *
+ * Decode the column data in buf described by dir into the records of
+ * the block.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int ftcol_dec(struct ftcol *ftc, struct ftcol_col *col,
+  struct ftcol_dir *dir, char *buf)
+{
+  uint32_t i, n, v, z, prev, len, shift;
+  uint16_t k, v16;
+  uint8_t v8;
+  char *rec, *dict;
+
+  n = ftc->nrecs;
+  len = dir->len;
+
+  switch (dir->enc) {
+
+    case FT_COL_ENC_RAW:
+
+      if (len != n * col->width)
+        goto bad;
+
+      for (i = 0, rec = ftc->recs + col->off; i < n;
+        ++i, rec += ftc->hdr.rec_size)
+        bcopy(buf + i * col->width, rec, col->width);
+
+      break;
+
+    case FT_COL_ENC_DELTA:
+
+      prev = 0;
+
+      for (i = 0, rec = ftc->recs + col->off; i < n;
+        ++i, rec += ftc->hdr.rec_size) {
+
+        z = shift = 0;
+
+        do {
+          if (!len-- || (shift > 28))
+            goto bad;
+          z |= (uint32_t)(*buf & 0x7f) << shift;
+          shift += 7;
+        } while (*buf++ & 0x80);
+
+        prev += (z >> 1) ^ (0 - (z & 1));
+        v = prev;
+
+        if (col->width == 4) {
+          bcopy(&v, rec, 4);
+        } else if (col->width == 2) {
+          v16 = v;
+          bcopy(&v16, rec, 2);
+        } else {
+          v8 = v;
+          bcopy(&v8, rec, 1);
+        }
+
+      }
+
+      break;
+
+    case FT_COL_ENC_DICT:
+
+      bcopy(buf, &k, sizeof k);
+
+      if ((k > 256) || (len != sizeof k + k * col->width + n))
+        goto bad;
+
+      dict = buf + sizeof k;
+      buf = dict + k * col->width;
+
+      for (i = 0, rec = ftc->recs + col->off; i < n;
+        ++i, rec += ftc->hdr.rec_size) {
+
+        if ((uint8_t)buf[i] >= k)
+          goto bad;
+
+        bcopy(dict + (uint8_t)buf[i] * col->width, rec, col->width);
+
+      }
+
+      break;
+
+    default:
+      goto bad;
+
+  } /* switch */
+
+  return 0;
+
+bad:
+
+  fterr_warnx("ftcol_read(): corrupt column.");
+  return -1;
+
+} /* ftcol_dec */
+
+/*
+ * function: ftcol_fill
+ *
+ * Read the next block, decode the selected columns.
+ *
+ * returns: 1  block ready
+ *          0  end of file
+ *          <0 fail
+ */
+static int ftcol_fill(struct ftcol *ftc)
+{
+  struct ftcol_blk blk;
+  struct ftcol_dir dir[FT_COL_MAXCOLS];
+  struct ftcol_col *col;
+  uLongf len;
+  uint32_t i, size, n;
+  int c;
+
+  if (fread(&blk, sizeof blk, 1, ftc->fp) != 1)
+    return 0;
+
+  if ((blk.nrecs == 0) || (blk.nrecs > FT_COL_BLOCK_RECS) ||
+      (blk.ncols > FT_COL_MAXCOLS)) {
+    fterr_warnx("ftcol_read(): corrupt block.");
+    return -1;
+  }
+
+  if (fread(dir, sizeof dir[0], blk.ncols, ftc->fp) != blk.ncols) {
+    fterr_warnx("ftcol_read(): short block.");
+    return -1;
+  }
+
+  ftc->nrecs = blk.nrecs;
+  ftc->irec = 0;
+
+  bzero(ftc->recs, ftc->nrecs * ftc->hdr.rec_size);
+
+  for (i = 0; i < blk.ncols; ++i) {
+
+    size = dir[i].zlen ? dir[i].zlen : dir[i].len;
+
+    for (c = 0, col = (struct ftcol_col*)0L; c < ftc->ncols; ++c)
+      if (ftc->cols[c].xfield == dir[i].xfield)
+        col = &ftc->cols[c];
+
+    if ((size > ftc->zbuf_size) || (dir[i].len > ftc->buf_size) ||
+        (col && (col->width != dir[i].width))) {
+      fterr_warnx("ftcol_read(): corrupt directory.");
+      return -1;
+    }
+
+    /* not needed, skip it */
+    if (!col || !(ftc->xfields & col->xfield)) {
+
+      ftc->bytes_skipped += size;
+
+      if (ftc->seekable) {
+        if (fseek(ftc->fp, (long)size, SEEK_CUR) < 0) {
+          fterr_warn("fseek()");
+          return -1;
+        }
+      } else {
+        for (; size; size -= n) {
+          n = (size < ftc->zbuf_size) ? size : ftc->zbuf_size;
+          if (fread(ftc->zbuf, 1, n, ftc->fp) != n) {
+            fterr_warnx("ftcol_read(): short column.");
+            return -1;
+          }
+        }
+      }
+
+      continue;
+
+    }
+
+    ftc->bytes_read += size;
+
+    if (fread(dir[i].zlen ? ftc->zbuf : ftc->buf, 1, size, ftc->fp) != size) {
+      fterr_warnx("ftcol_read(): short column.");
+      return -1;
+    }
+
+    if (dir[i].zlen) {
+
+      len = ftc->buf_size;
+
+      if ((uncompress((Bytef*)ftc->buf, &len, (Bytef*)ftc->zbuf, size)
+        != Z_OK) || (len != dir[i].len)) {
+        fterr_warnx("uncompress(): failed");
+        return -1;
+      }
+
+    }
+
+    if (ftcol_dec(ftc, col, &dir[i], ftc->buf) < 0)
+      return -1;
+
+  } /* foreach column */
+
+  return 1;
+
+} /* ftcol_fill */
+
+/*
+ * function: ftcol_read
+ *
+ * Next record, valid until the next call.
+ *
+ * returns: record
+ *          0L end of file or error
+ */
+char *ftcol_read(struct ftcol *ftc)
+{
+
+  if (ftc->irec == ftc->nrecs)
+    if (ftcol_fill(ftc) != 1)
+      return (char*)0L;
+
+  return ftc->recs + ftc->irec++ * ftc->hdr.rec_size;
+
+} /* ftcol_read */
+
+/*
+ * function: ftcol_close
+ *
+ * Write the last block when writing and free ftc.  fp is left open.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftcol_close(struct ftcol *ftc)
+{
+  int ret;
+
+  ret = 0;
+
+  if (ftc->write && ftc->recs)
+    ret = ftcol_flush(ftc);
+
+  free(ftc->recs);
+  free(ftc->vals);
+  free(ftc->buf);
+  free(ftc->zbuf);
+  free(ftc->out);
+
+  bzero(ftc, sizeof *ftc);
+
+  return ret;
+
+} /* ftcol_close */
@@ -112,6 +112,11 @@ int ftfile_loadfile(struct ftfile_entries *fte, char *fname, int flags)
 
   if (fname[0]) {
 
+    /* rollups written next to the flow files by flow-capture -a */
+    if (flags & FT_FILE_CHECKNAMES)
+      if (!strncmp(fname, FT_ROLLUP_PREFIX, strlen(FT_ROLLUP_PREFIX)))
+        return 0;
+
     /* skip anything that doesn't begin with "ft" "cf" and "tmp" */
     if (flags & FT_FILE_CHECKNAMES)
       if ((strncmp(fname, "ft", 2)) &&
@@ -607,8 +612,10 @@ int load_dir(char *prefix, struct ftfile_entries *fte, int flags, int *depth)
   struct stat sb;
   struct ftfile_entry *n1, *n2;
   struct ftiheader head;
+  struct ftrollup_hdr ruh;
   char *path_new;
-  int fd, done, ret, here;
+  uint32_t start;
+  int fd, done, ret, here, rollup;
   int prefix_len, name_len, path_len;
 
   if (++ *depth > 50) {
@@ -687,9 +694,16 @@ int load_dir(char *prefix, struct ftfile_entries *fte, int flags, int *depth)
         continue;
       }
 
+      /* rollups written next to the flow files by flow-capture -a */
+      rollup = !strncmp(dirent->d_name, FT_ROLLUP_PREFIX,
+        strlen(FT_ROLLUP_PREFIX));
+
+      if (rollup && !(flags & FT_FILE_ROLLUPS))
+        continue;
+
       /* skip anything that doesn't begin with "ft" "cf" and "tmp" */
       if (flags & FT_FILE_CHECKNAMES)
-        if ((strncmp(dirent->d_name, "ft", 2)) &&
+        if ((!rollup) && (strncmp(dirent->d_name, "ft", 2)) &&
            (strncmp(dirent->d_name, "cf", 2)) &&
            (strncmp(dirent->d_name, "tmp", 3))) {
           fterr_warnx("ignoring: %s", dirent->d_name);
@@ -707,10 +721,28 @@ int load_dir(char *prefix, struct ftfile_entries *fte, int flags, int *depth)
         continue;
       }
 
-      if (ftiheader_read(fd, &head) < 0) {
-        fterr_warnx("ftiheader_read(%s): Failed, ignoring file.", dirent->d_name);
-        close(fd);
-        continue;
+      if (rollup) {
+
+        if ((read(fd, &ruh, sizeof ruh) != sizeof ruh) ||
+          (ruh.magic != FT_ROLLUP_MAGIC)) {
+          fterr_warnx("%s: Not a rollup, ignoring file.", dirent->d_name);
+          close(fd);
+          continue;
+        }
+
+        start = ruh.time_start;
+
+      } else {
+
+        if (ftiheader_read(fd, &head) < 0) {
+          fterr_warnx("ftiheader_read(%s): Failed, ignoring file.",
+            dirent->d_name);
+          close(fd);
+          continue;
+        }
+
+        start = head.cap_start;
+
       }
 
       close (fd);
@@ -722,7 +754,7 @@ int load_dir(char *prefix, struct ftfile_entries *fte, int flags, int *depth)
 
         FT_TAILQ_FOREACH(n1, &fte->head, chain) {
 
-          if (n1->start > head.cap_start) {
+          if (n1->start > start) {
 
             if (!(n2 = ftfile_entry_new(path_len))) {
               fterr_warnx("ftfile_entry_new(): failed");
@@ -730,7 +762,7 @@ int load_dir(char *prefix, struct ftfile_entries *fte, int flags, int *depth)
             }
 
             n2->size = sb.st_size;
-            n2->start = head.cap_start;
+            n2->start = start;
             sprintf(n2->name, "%s/%s", prefix, dirent->d_name);
 
             FT_TAILQ_INSERT_BEFORE(n1, n2, chain);
@@ -748,7 +780,7 @@ int load_dir(char *prefix, struct ftfile_entries *fte, int flags, int *depth)
         }
 
         n2->size = sb.st_size;
-        n2->start = head.cap_start; 
+        n2->start = start;
         sprintf(n2->name, "%s/%s", prefix, dirent->d_name);
         FT_TAILQ_INSERT_TAIL(&fte->head, n2, chain);
 
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2026 The flow-tools authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *      $Id$
+ */
+
+#include "ftinclude.h"
+#include "ftlib.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * HyperLogLog distinct value estimate, Flajolet et al. 2007.
+ *
+ * A value is hashed to 64 bits.  The top precision bits pick one of
+ * 2^precision registers, the register keeps the largest position of
+ * the first 1 bit seen in the remaining bits.  The harmonic mean of the
+ * registers estimates the number of distinct values with a relative
+ * standard error of 1.04/sqrt(2^precision).  Small counts use linear
+ * counting on the empty registers.  With 64 bit hashes no large range
+ * correction is needed.
+ *
+ * Registers only ever grow, so two sketches of the same precision are
+ * merged by taking the larger of each register, in any order.
+ */
+
+/* murmur3 fmix64 */
+static uint64_t fthll_mix(uint64_t x)
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+}
+
+/*
+ * function: fthll_new
+ *
+ * Allocate an empty sketch of 2^precision one byte registers.
+ *
+ * returns: allocated sketch or 0L for error
+ */
+struct fthll *fthll_new(int precision)
+{
+  struct fthll *hll;
+
+  if ((precision < FT_HLL_MIN_PRECISION) ||
+    (precision > FT_HLL_MAX_PRECISION)) {
+    fterr_warnx("fthll_new(): precision %d not in %d..%d", precision,
+      FT_HLL_MIN_PRECISION, FT_HLL_MAX_PRECISION);
+    return (struct fthll*)0L;
+  }
+
+  if (!(hll = (struct fthll*)malloc(sizeof *hll + (1 << precision)))) {
+    fterr_warn("malloc()");
+    return (struct fthll*)0L;
+  }
+
+  hll->precision = precision;
+  hll->reg = (uint8_t*)(hll + 1);
+  bzero(hll->reg, 1 << precision);
+
+  return hll;
+
+} /* fthll_new */
+
+/*
+ * function: fthll_free
+ *
+ * Free a sketch allocated with fthll_new()
+ */
+void fthll_free(struct fthll *hll)
+{
+
+  if (hll)
+    free(hll);
+
+} /* fthll_free */
+
+/*
+ * function: fthll_add
+ *
+ * Add value v to the sketch.  v is hashed here, any encoding of the
+ * value that is unique will do.
+ */
+void fthll_add(struct fthll *hll, uint64_t v)
+{
+  uint64_t x;
+  uint32_t i;
+  uint8_t rank;
+
+  x = fthll_mix(v);
+
+  i = x >> (64 - hll->precision);
+
+  /* the stop bit bounds rank at 64 - precision + 1 */
+  x = (x << hll->precision) | ((uint64_t)1 << (hll->precision - 1));
+
+  for (rank = 1; !(x & 0x8000000000000000ULL); x <<= 1)
+    ++rank;
+
+  if (rank > hll->reg[i])
+    hll->reg[i] = rank;
+
+} /* fthll_add */
+
+/*
+ * function: fthll_merge
+ *
+ * Fold src into dst, dst then estimates the union of both.
+ *
+ * returns: 0  ok
+ *          <0 precision differs
+ */
+int fthll_merge(struct fthll *dst, struct fthll *src)
+{
+  uint32_t i, m;
+
+  if (dst->precision != src->precision) {
+    fterr_warnx("fthll_merge(): precision mismatch");
+    return -1;
+  }
+
+  m = 1 << dst->precision;
+
+  for (i = 0; i < m; ++i)
+    if (src->reg[i] > dst->reg[i])
+      dst->reg[i] = src->reg[i];
+
+  return 0;
+
+} /* fthll_merge */
+
+/*
+ * function: fthll_count
+ *
+ * Estimate of the number of distinct values added.
+ *
+ * returns: estimate, rounded
+ */
+uint64_t fthll_count(struct fthll *hll)
+{
+  double sum, alpha, m, e;
+  uint32_t i, zeros;
+
+  m = (double)(1 << hll->precision);
+
+  sum = 0;
+  zeros = 0;
+  for (i = 0; i < (1U << hll->precision); ++i) {
+    sum += 1.0 / (double)((uint64_t)1 << hll->reg[i]);
+    if (!hll->reg[i])
+      ++zeros;
+  }
+
+  if (hll->precision == 4)
+    alpha = 0.673;
+  else if (hll->precision == 5)
+    alpha = 0.697;
+  else if (hll->precision == 6)
+    alpha = 0.709;
+  else
+    alpha = 0.7213 / (1.0 + 1.079 / m);
+
+  e = alpha * m * m / sum;
+
+  /* small range, linear counting */
+  if ((e <= 2.5 * m) && zeros)
+    e = m * log(m / (double)zeros);
+
+  return (uint64_t)(e + 0.5);
+
+} /* fthll_count */
+
+/*
+ * function: fthll_error
+ *
+ * Relative standard error of a sketch of precision, 1.04/sqrt(2^p).
+ *
+ * returns: error as a fraction
+ */
+double fthll_error(int precision)
+{
+
+  return 1.04 / sqrt((double)(1 << precision));
+
+} /* fthll_error */
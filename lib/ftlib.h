@@ -187,6 +187,7 @@ struct mymsghdr {
 #define FT_FILE_INIT           0x2    /* initialize */
 #define FT_FILE_SKIPTMP        0x4    /* skip tmp files */
 #define FT_FILE_CHECKNAMES     0x8    /* check filenames for sanity */
+#define FT_FILE_ROLLUPS        0x10   /* load ru- rollup files too */
 
 #define FT_LP_MAXLINE          1024   /* maximum length of line */
 
@@ -384,6 +385,34 @@ struct ftprof {
   uint64_t nflows;       /* total # of flows processed */
 };
 
+struct ftpace {
+  double rate;           /* tokens released per second, 0 disables */
+  double ns_per_token;   /* 1e9 / rate */
+  double tokens;         /* tokens currently in the bucket */
+  uint32_t burst;        /* bucket depth */
+  int64_t last;          /* ftpace_now() at last refill */
+  uint64_t waits;        /* # of times ftpace_wait() blocked */
+};
+
+#define FT_HLL_MIN_PRECISION 4
+#define FT_HLL_MAX_PRECISION 16
+#define FT_HLL_DEF_PRECISION 10
+
+struct fthll {
+  int precision;         /* 2^precision registers */
+  uint8_t *reg;          /* registers, allocated with the struct */
+};
+
+#define FT_QS_MAX_BINS  1024   /* lowest bins are collapsed past this */
+
+struct ftqs {
+  uint64_t n;            /* values added */
+  uint64_t zero;         /* values too small to map, counted as 0 */
+  int32_t lo;            /* index of bins[0] */
+  uint32_t nbins;        /* entries in bins */
+  uint32_t *bins;        /* counts of consecutive bin indexes */
+};
+
 struct ftset {
   int byte_order;
   int z_level;
@@ -2059,23 +2088,63 @@ struct ftchash_chunk {
   FT_SLIST_ENTRY(ftchash_chunk) chain;       /* next */
 };
 
+struct ftchash_slot {
+  uint32_t hash;                             /* full hash of key */
+  void *rec;                                 /* record, 0L if empty */
+};
+
+struct ftchash_iter {
+  struct ftchash *ftch;                      /* table */
+  void *rec;                                 /* next record, unsorted */
+  struct ftchash_chunk *chunk;               /* chunk of rec */
+  uint64_t srec;                             /* next record, sorted */
+  int sort_flags;                            /* table sort_flags at init */
+};
+
+struct ftchash_run {
+  FILE *fp;                                  /* key sorted records */
+  uint64_t recs;                             /* records in fp */
+  unsigned int level;                        /* merges into this run */
+};
+
+struct ftchash_keep {
+  int offset;                                /* sort field, -1 = none */
+  int flags;                                 /* FT_CHASH_SORT_* */
+  uint64_t k;                                /* records to keep */
+};
+
 struct ftchash {
-  unsigned int h_size;                              /* hash_table_size */
+  unsigned int h_size;                       /* index slots, power of 2 */
   unsigned int d_size;                              /* data entry size */
   unsigned int key_size;                            /* size of key */
   int   chunk_size;                          /* chunk size (entries * d_size */
   uint64_t entries;                           /* entries in hash table */
-  void *traverse_rec;                        /* record when traversing */
-  struct ftchash_chunk *traverse_chunk;      /* chunk when traversing */
-  uint64_t traverse_srec;                     /* sorted rec when traversing */
+  struct ftchash_iter iter;                  /* ftchash_first/foreach */
   struct ftchash_chunk *active_chunk;        /* currently active chunk */
                                              /* memory chunk list */
   FT_SLIST_HEAD(ftchash_chunkh, ftchash_chunk) chunk_list;
-                                             /* hash table buckets */
-  FT_SLIST_HEAD(ftchash_bhead, ftchash_rec_gen) *buckets;
+  struct ftchash_slot *slots;                /* open addressing index */
+  uint64_t h_grow;                           /* entries before next resize */
+  struct ftchash_slot *old_slots;            /* index being migrated */
+  unsigned int old_size;                     /* slots in old_slots */
+  unsigned int old_next;                     /* next old slot to migrate */
   struct ftchash_rec_gen **sorted_recs;      /* array of pointers to sorted 
                                                 records */
+  uint64_t sorted_entries;                   /* entries in sorted_recs */
   int sort_flags;                            /* sorted version available? */
+  uint64_t chunk_bytes;                      /* bytes in chunk_list */
+  uint64_t max_bytes;                        /* spill past this, 0=never */
+  struct ftchash_run *runs;                  /* spilled runs */
+  unsigned int nruns;                        /* entries in runs */
+  uint64_t spill_runs, spill_recs;           /* runs/records written */
+  uint64_t merge_recs, merge_keys;           /* records read back/keys out */
+  uint64_t bound;                            /* max entries, 0=unbounded */
+  int bound_offset;                          /* ranking counter */
+  struct ftchash_kp *bound_heap;             /* smallest counters first */
+  void (*bound_evict)(void *rec, void *arg); /* before a take over */
+  void *bound_arg;                           /* for bound_evict */
+  uint64_t evictions;                        /* records taken over */
+  uint64_t bound_err;                        /* max overestimate */
 };
 
 struct ftchash_rec_gen {
@@ -2100,6 +2169,7 @@ struct ftps {
   double avg_pps, avg_bps;   /* packets/bytes per second */
   double max_pps, max_bps;   /* packets/bytes per second */
   double min_pps, min_bps;   /* packets/bytes per second */
+  struct ftstat_qs *qs;      /* quantile sketches or 0L */
 };
 
 struct ftchash_rec_prefixh {
@@ -2115,6 +2185,7 @@ struct ftchash_rec_prefixh {
   uint64_t etime;        /* duration */
   uint64_t nprefixes;    /* number of prefixes seen */
   struct ftchash *ftch; /* second list */
+  struct fthll *hll;    /* or estimate of its size */
   struct ftps ps;       /* per second counters */
 };
 
@@ -2572,6 +2643,24 @@ int ftprof_start(struct ftprof *ftp);
 int ftprof_end(struct ftprof *ftp, uint64_t nflows);
 void ftprof_print(struct ftprof *ftp, char *prog, FILE *std);
 
+int64_t ftpace_now(void);
+int64_t ftpace_sleep_until(int64_t t);
+int ftpace_init(struct ftpace *ftpc, double rate, uint32_t burst);
+int64_t ftpace_wait(struct ftpace *ftpc, uint32_t n);
+
+struct fthll *fthll_new(int precision);
+void fthll_free(struct fthll *hll);
+void fthll_add(struct fthll *hll, uint64_t v);
+int fthll_merge(struct fthll *dst, struct fthll *src);
+uint64_t fthll_count(struct fthll *hll);
+double fthll_error(int precision);
+
+int ftqs_add(struct ftqs *qs, double v);
+int ftqs_merge(struct ftqs *dst, struct ftqs *src);
+double ftqs_quantile(struct ftqs *qs, double q);
+void ftqs_free(struct ftqs *qs);
+double ftqs_error(void);
+
 int ftiheader_read(int fd, struct ftiheader *h);
 
 struct fttime ftltime(uint32_t sys, uint32_t secs, uint32_t nsecs, uint32_t t);
@@ -2671,9 +2760,26 @@ void *ftchash_lookup(struct ftchash *ftch, void *key, uint32_t hash);
 void ftchash_free(struct ftchash *ftch);
 void *ftchash_update(struct ftchash *ftch, void *newrec, uint32_t hash);
 void *ftchash_alloc_rec(struct ftchash *ftch);
+int ftchash_merge(struct ftchash *dst, struct ftchash *src,
+  int (*f_combine)(void *drec, void *srec, void *arg), void *arg);
 void *ftchash_foreach(struct ftchash *ftch);
 void ftchash_first(struct ftchash *ftch);
+void ftchash_iter_init(struct ftchash *ftch, struct ftchash_iter *iter);
+void *ftchash_iter_next(struct ftchash_iter *iter);
 int ftchash_sort(struct ftchash *ftch, int offset, int flags);
+int ftchash_sort_topk(struct ftchash *ftch, int offset, int flags,
+  uint64_t k);
+void ftchash_limit(struct ftchash *ftch, uint64_t max_bytes);
+int ftchash_bound(struct ftchash *ftch, uint64_t max_entries, int offset,
+  void (*f_evict)(void *rec, void *arg), void *arg);
+int ftchash_save(struct ftchash *ftch, FILE *fp,
+  void (*f_clear)(void *rec, void *arg), void *arg);
+int ftchash_load(struct ftchash *ftch, FILE *fp,
+  int (*f_combine)(void *drec, void *srec, void *arg), void *arg);
+int ftchash_unspill(struct ftchash *ftch,
+  int (*f_combine)(void *drec, void *srec, void *arg),
+  void (*f_final)(void *rec, void *arg), void *arg,
+  struct ftchash_keep *keep, int nkeep);
 
 void ftrec_xlate(void *in_rec, struct ftver *in_ftv, void *out_rec,
   struct ftver *out_ftv);
@@ -2714,10 +2820,217 @@ enum ftstat_rpt_format {FT_STAT_FMT_UNSET,
                         FT_STAT_FMT_ASCII,
                         FT_STAT_FMT_BINARY};
 
+/* report state files, ftstat_def_state_save() */
+#define FT_STAT_STATE_MAGIC   0x46545354 /* FTST */
+#define FT_STAT_STATE_VERSION 2
+#define FT_STAT_STATE_MAXSTR  1024
+
+/*
+ * binary report output, format binary.  Each report output is a block
+ * of struct ftbin_hdr, hdr.ncols struct ftbin_col and hdr.nrows rows of
+ * hdr.row_size bytes, all in host byte order.  A time series appends
+ * one block per interval.  Read back with ftbin_open() and friends.
+ */
+#define FT_BIN_MAGIC     0x46545242 /* FTRB */
+#define FT_BIN_VERSION   1
+#define FT_BIN_NAMELEN   64
+#define FT_BIN_COLLEN    48
+#define FT_BIN_MAXCOLS   32
+#define FT_BIN_BUFSIZE   262144 /* bytes of rows per write/read */
+
+#define FT_BIN_TYPE_U8     1
+#define FT_BIN_TYPE_U16    2
+#define FT_BIN_TYPE_U32    3
+#define FT_BIN_TYPE_U64    4
+#define FT_BIN_TYPE_DOUBLE 5
+#define FT_BIN_TYPE_IPV4   6 /* uint32_t address */
+
+struct ftbin_hdr {
+  uint32_t magic; /* FT_BIN_MAGIC */
+  uint16_t version; /* FT_BIN_VERSION */
+  uint16_t ncols; /* struct ftbin_col following */
+  uint32_t row_size; /* bytes per row */
+  uint32_t reserved;
+  uint64_t nrows; /* rows following the columns */
+  uint64_t t_ignores, t_recs, t_flows, t_octets, t_packets, t_duration;
+  uint32_t time_start, time_end; /* real time of earliest/latest flow */
+  char name[FT_BIN_NAMELEN]; /* report name */
+  char type[FT_BIN_NAMELEN]; /* report type */
+};
+
+struct ftbin_col {
+  char name[FT_BIN_COLLEN]; /* field name as in the ascii recn line */
+  uint16_t offset; /* in the row */
+  uint8_t type; /* FT_BIN_TYPE_* */
+  uint8_t size; /* bytes */
+  uint32_t reserved;
+};
+
+struct ftbin {
+  FILE *fp;
+  struct ftbin_hdr hdr; /* current block */
+  struct ftbin_col cols[FT_BIN_MAXCOLS];
+  char *buf; /* rows read ahead */
+  uint64_t left; /* rows of the block not yet read into buf */
+  uint32_t buf_rows, nbuf, ibuf; /* buf capacity, rows in buf, next row */
+};
+
+/*
+ * rollup file, written by flow-capture -a at each rotation.  Flows,
+ * octets, packets and duration summed by the dimensions of hdr.xfields,
+ * a subset of FT_ROLLUP_XFIELDS.  A file is a struct ftrollup_hdr and
+ * hdr.nrows struct ftrollup_row, all in host byte order.  Read back
+ * with ftrollup_open() as flow records for ftstat.
+ */
+#define FT_ROLLUP_MAGIC    0x46545255 /* FTRU */
+#define FT_ROLLUP_VERSION  1
+#define FT_ROLLUP_PREFIX   "ru-" /* in place of ft- in the capture name */
+
+#define FT_ROLLUP_XFIELDS  (FT_XFIELD_EXADDR|FT_XFIELD_INPUT|\
+                            FT_XFIELD_OUTPUT|FT_XFIELD_PROT|FT_XFIELD_TOS|\
+                            FT_XFIELD_SRC_AS|FT_XFIELD_DST_AS)
+
+/* fields of a record read from a rollup besides its dimensions */
+#define FT_ROLLUP_XFIELDS_REC (FT_XFIELD_UNIX_SECS|FT_XFIELD_UNIX_NSECS|\
+                            FT_XFIELD_SYSUPTIME|FT_XFIELD_DFLOWS|\
+                            FT_XFIELD_DPKTS|FT_XFIELD_DOCTETS|\
+                            FT_XFIELD_FIRST|FT_XFIELD_LAST)
+
+struct ftrollup_key {
+  uint32_t exaddr;
+  uint16_t input, output;
+  uint16_t src_as, dst_as;
+  uint8_t prot, tos;
+  uint16_t pad;
+};
+
+struct ftrollup_hdr {
+  uint32_t magic; /* FT_ROLLUP_MAGIC */
+  uint32_t version; /* FT_ROLLUP_VERSION */
+  uint64_t xfields; /* dimensions, FT_XFIELD_* */
+  uint32_t time_start, time_end; /* capture interval */
+  uint64_t nrows; /* struct ftrollup_row following */
+};
+
+struct ftrollup_row {
+  struct ftrollup_key key; /* dimensions not in xfields are 0 */
+  uint64_t nflows, noctets, npackets, etime;
+};
+
+struct ftchash_rec_rollup {
+  FT_SLIST_ENTRY(ftchash_rec_rollup) chain;
+  struct ftrollup_row row;
+};
+
+struct ftrollup {
+  struct ftchash *ftch; /* of ftchash_rec_rollup */
+  uint64_t xfields; /* dimensions */
+  uint32_t time_start; /* capture interval */
+};
+
+/*
+ * a rollup row as a flow, counters over 32 bits are split over several
+ * records.  Flow fields that are not kept point at zero.
+ */
+struct ftrollup_xrec {
+  uint32_t unix_secs, unix_nsecs, sysUpTime, exaddr;
+  uint32_t dFlows, dPkts, dOctets, First, Last;
+  uint16_t input, output, src_as, dst_as;
+  uint8_t prot, tos;
+  uint16_t pad;
+  uint32_t zero[4];
+};
+
+struct ftrollup_rd {
+  FILE *fp;
+  struct ftrollup_hdr hdr;
+  uint64_t left; /* rows not yet read */
+  struct ftrollup_row row; /* being split */
+  uint32_t split, nsplit; /* next record of row, records for row */
+  struct ftrollup_xrec xrec; /* record handed out */
+  struct fts3rec_offsets fo; /* offsets for xrec */
+};
+
+/*
+ * column file, written by flow-cat -c.  The records of a flow file cut
+ * into blocks of FT_COL_BLOCK_RECS, each field of a block stored as its
+ * own column so a reader only decodes the fields it needs.  A file is a
+ * struct ftcol_hdr, then for each block a struct ftcol_blk, hdr.ncols
+ * struct ftcol_dir and the column data in directory order, all in host
+ * byte order.
+ */
+#define FT_COL_MAGIC       0x4654434C /* FTCL */
+#define FT_COL_VERSION     1
+#define FT_COL_BLOCK_RECS  16384
+#define FT_COL_MAXCOLS     64
+
+#define FT_COL_ENC_RAW     0 /* values, width bytes each */
+#define FT_COL_ENC_DELTA   1 /* zigzag varint of the difference to previous */
+#define FT_COL_ENC_DICT    2 /* uint16 count, values, one byte index each */
+
+struct ftcol_hdr {
+  uint32_t magic; /* FT_COL_MAGIC */
+  uint32_t version; /* FT_COL_VERSION */
+  uint16_t d_version; /* ftver of the records */
+  uint8_t agg_version, agg_method;
+  uint32_t rec_size;
+  uint64_t xfields; /* columns in each block */
+};
+
+struct ftcol_blk {
+  uint32_t nrecs, ncols;
+};
+
+struct ftcol_dir {
+  uint64_t xfield; /* FT_XFIELD_* of the column */
+  uint32_t len; /* encoded length */
+  uint32_t zlen; /* compressed length, 0 stored */
+  uint8_t enc; /* FT_COL_ENC_* */
+  uint8_t width; /* of a value in the record */
+  uint8_t pad[6];
+};
+
+struct ftcol_col {
+  uint64_t xfield;
+  uint16_t off; /* in the record */
+  uint8_t width;
+};
+
+struct ftcol {
+  FILE *fp;
+  struct ftcol_hdr hdr;
+  struct ftver ftv;
+  struct fts3rec_offsets fo; /* offsets of the records handed out */
+  struct ftcol_col cols[FT_COL_MAXCOLS];
+  int ncols;
+  int write; /* open for write */
+  int z_level;
+  int seekable; /* skip columns with fseek() */
+  uint64_t xfields; /* columns decoded by ftcol_read() */
+  char *recs; /* block of records */
+  uint32_t nrecs, irec; /* records in block, next record */
+  uint32_t *vals; /* one column widened to 32 bits */
+  char *buf, *zbuf, *out; /* encoded, compressed, block being written */
+  uint32_t buf_size, zbuf_size, out_size;
+  uint64_t bytes_read, bytes_skipped; /* column data */
+};
+
 enum ftstat_rpt_time { FT_STAT_TIME_UNSET, FT_STAT_TIME_NOW,
                        FT_STAT_TIME_START, FT_STAT_TIME_END,
                        FT_STAT_TIME_MID };
 
+/*
+ * Values of a flow shared by the reports of a definition, extracted
+ * once per flow by ftstat_def_accum() and passed to each f_accum.
+ */
+struct ftstat_flow {
+  uint64_t dFlows64, dOctets64, dPkts64; /* unscaled */
+  uint32_t unix_secs, First, Last;
+  uint32_t duration; /* Last - First */
+  double pps, bps; /* unscaled, set by the first report using them */
+  int ps_valid; /* pps and bps are set */
+};
+
 struct ftstat_rpt {
   FT_SLIST_ENTRY(ftstat_rpt) chain; /* list */
   FT_STAILQ_HEAD(ftstatrptouthead, ftstat_rpt_out) outs;
@@ -2735,8 +3048,11 @@ struct ftstat_rpt {
   uint64_t xfields; /* FT_XFIELD_* */
   void *data; /* ftstat_rpt_n */
   void* (*f_new)(struct ftstat_rpt *ftsrpt); /* ftstat_rpt_n_new */
-  void* (*f_accum)(struct ftstat_rpt *ftsrpt, char *rec, struct fts3rec_offsets *fo); /* ftstat_rpt_n_accum */
+  void* (*f_accum)(struct ftstat_rpt *ftsrpt, char *rec, struct fts3rec_offsets *fo, struct ftstat_flow *ff); /* ftstat_rpt_n_accum */
   void* (*f_calc)(struct ftstat_rpt *ftsrpt); /* ftstat_rpt_n_calc */
+  void* (*f_merge)(struct ftstat_rpt *ftsrpt, struct ftstat_rpt *src); /* ftstat_rpt_n_merge */
+  int (*f_save)(struct ftstat_rpt *ftsrpt, FILE *fp); /* ftstat_rpt_n_save */
+  int (*f_load)(struct ftstat_rpt *ftsrpt, FILE *fp); /* ftstat_rpt_n_load */
   void* (*f_free)(void *data); /* ftstat_rpt_n_free */
   void* (*f_dump)(FILE *fp, struct ftio *ftio, struct ftstat_rpt *ftsrpt); /* ftstat_rpt_n_dump */
   /* totals */
@@ -2748,6 +3064,15 @@ struct ftstat_rpt {
   uint32_t time_end; /* real time of latest flow */
   uint64_t recs; /* records in report */
   uint64_t idx;
+  uint64_t memory_limit; /* hash table bytes before spilling, 0=none */
+  int count_estimate; /* HyperLogLog precision of counts, 0=exact */
+  uint64_t spill_runs, spill_recs, merge_recs; /* from the hash table */
+  uint64_t heavy_hitters; /* Space-Saving summary entries, 0=exact */
+  int heavy_field; /* FT_STAT_FIELD_* ranking the summary, 0=from output */
+  uint64_t heavy_evictions, heavy_error; /* from the hash table */
+  struct ftstat_qs *qs; /* quantile sketches of every key */
+  struct ftstat_qs *qs_spare; /* reset sketches of evicted keys */
+  int qs_offset; /* of the sketch pointer in a heavy hitters record */
 };
 
 struct ftstat_rpt_out {
@@ -2758,6 +3083,7 @@ struct ftstat_rpt_out {
   uint32_t fields; /* FT_STAT_FIELD_* - default to allowed_fields */
   int sort_field;  /* field to sort on FT_STAT_FIELD_* */
   int sort_order; /* FT_STAT_FIELD_SORT_* */
+  enum ftstat_rpt_format format; /* FT_STAT_FMT* */
   enum ftstat_rpt_time time; /* where to derive clock for output path */
   char *path; /* pathname of output */
   void* (*f_dump)(FILE *fp, struct ftio *ftio, struct ftstat_rpt *ftsrpt); /* ftstat_rpt_n_dump */
@@ -2780,9 +3106,28 @@ struct ftstat_def {
   uint32_t max_time; /* maximum seconds for report definition */
   uint32_t start_time; /* start seconds */
   uint32_t interval; /* time series interval */
+  uint32_t window, slide; /* wall clock window and step seconds, 0=none */
+  uint32_t window_end; /* wall clock end of the current step */
   uint64_t xfields; /* required flow fields - FT_XFIELD_* */
 };
   
+/*
+ * A flow as seen by a definition after its mask and tag.  Kept across
+ * the definitions evaluated for the same flow so the ones sharing a
+ * mask, tag or filter do that work once.  ftstat_xrec_reset() before
+ * each flow.
+ */
+struct ftstat_xrec {
+  char *rec; /* masked/tagged flow, 0L when not set up */
+  struct fts3rec_offsets *fo; /* offsets for rec */
+  struct ftmask_def *ftmd; /* mask applied to rec */
+  struct fttag_def *ftd; /* tag applied to rec */
+  struct ftfil_def *ftfd; /* last filter evaluated on rec */
+  int fil_mode; /* and its result, FT_FIL_MODE_* */
+  char buf[FT_IO_MAXREC]; /* masked copy */
+  char xl_rec[FT_IO_MAXREC]; /* translated copy */
+};
+
 struct ftstat {
   FT_SLIST_HEAD(statrpthead, ftstat_rpt) rpts; /* reports */
   FT_SLIST_HEAD(statdefhead, ftstat_def) defs; /* defs */
@@ -2796,16 +3141,55 @@ struct ftstat {
   struct ftvar *ftvar;
 };
 
+/* ftbin */
+int ftbin_open(struct ftbin *ftb, FILE *fp);
+int ftbin_next(struct ftbin *ftb);
+char *ftbin_read(struct ftbin *ftb);
+int ftbin_col_find(struct ftbin *ftb, const char *name);
+uint64_t ftbin_col_u64(struct ftbin *ftb, char *row, int col);
+double ftbin_col_double(struct ftbin *ftb, char *row, int col);
+void ftbin_close(struct ftbin *ftb);
+
+/* ftrollup */
+int ftrollup_new(struct ftrollup *ftr, uint64_t xfields, uint32_t time_start);
+int ftrollup_accum(struct ftrollup *ftr, char *rec,
+  struct fts3rec_offsets *fo);
+int ftrollup_write(struct ftrollup *ftr, FILE *fp, uint32_t time_end);
+void ftrollup_free(struct ftrollup *ftr);
+int ftrollup_open(struct ftrollup_rd *rd, FILE *fp);
+int ftrollup_read(struct ftrollup_rd *rd, char **rec);
+
+/* ftcol */
+int ftcol_open_write(struct ftcol *ftc, FILE *fp, struct ftver *ftv,
+  int z_level);
+int ftcol_write(struct ftcol *ftc, char *rec);
+int ftcol_open_read(struct ftcol *ftc, FILE *fp);
+void ftcol_select(struct ftcol *ftc, uint64_t xfields);
+char *ftcol_read(struct ftcol *ftc);
+int ftcol_close(struct ftcol *ftc);
+
 /* ftstat */
 int ftstat_load(struct ftstat *ftstat, struct ftvar *ftvar, const char *fname);
 void ftstat_free(struct ftstat *ftstat);
 struct ftstat_def *ftstat_def_find(struct ftstat *ftstat, const char *name);
 int ftstat_def_test_xfields(struct ftstat_def *active_def, uint64_t test);
+int ftstat_def_test_rollup(struct ftstat_def *active_def, uint64_t xfields);
+uint64_t ftstat_def_need_xfields(struct ftstat_def *active_def);
 int ftstat_def_new(struct ftstat_def *active_def);
+int ftstat_def_split(struct ftstat_def *active_def, uint32_t unix_secs);
+int ftstat_def_window(struct ftstat_def *active_def, uint32_t now);
 int ftstat_def_accum(struct ftstat_def *active_def,
   char *rec, struct fts3rec_offsets *fo);
+int ftstat_def_accum_xrec(struct ftstat_def *active_def,
+  char *rec, struct fts3rec_offsets *fo, struct ftstat_xrec *xr);
+void ftstat_xrec_reset(struct ftstat_xrec *xr);
+int ftstat_def_accum_batch(struct ftstat_def *active_def, char *recs,
+  int rec_size, uint32_t *nrecs, struct fts3rec_offsets *fo);
 int ftstat_def_calc(struct ftstat_def *active_def);
+int ftstat_def_merge(struct ftstat_def *active_def, struct ftstat_def *src_def);
 int ftstat_def_dump(struct ftio *ftio, struct ftstat_def *active_def);
+int ftstat_def_state_save(struct ftstat_def *active_def, FILE *fp);
+int ftstat_def_state_load(struct ftstat_def **defs, int ndefs, FILE *fp);
 int ftstat_def_free(struct ftstat_def *active_def);
 int ftstat_def_reset(struct ftstat_def *active_def);
 void ftstat_list_reports(FILE *out);
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2026 The flow-tools authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *      $Id$
+ */
+
+#include "ftinclude.h"
+#include "ftlib.h"
+
+#include <sys/time.h>
+#include <errno.h>
+#include <time.h>
+
+/*
+ * Sleeping is only accurate to the scheduler tick, so waits shorter
+ * than this are finished by polling the clock.
+ */
+#define FT_PACE_SPIN_NS  100000LL
+
+/*
+ * function: ftpace_now
+ *
+ * Monotonic time in nanoseconds.
+ *
+ * returns: nanoseconds since an arbitrary epoch
+*/
+int64_t ftpace_now(void)
+{
+#if HAVE_CLOCK_GETTIME && defined (CLOCK_MONOTONIC)
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+#else
+  struct timeval tv;
+
+  gettimeofday(&tv, (struct timezone*)0L);
+  return (int64_t)tv.tv_sec * 1000000000LL + (int64_t)tv.tv_usec * 1000LL;
+#endif
+} /* ftpace_now */
+
+/*
+ * function: ftpace_sleep_until
+ *
+ * Block until ftpace_now() >= t.  Long waits are slept off, the
+ * remainder is busy waited for sub scheduler tick accuracy.
+ *
+ * returns: time on exit
+*/
+int64_t ftpace_sleep_until(int64_t t)
+{
+  struct timespec ts;
+  int64_t now, delta;
+
+  for (;;) {
+
+    now = ftpace_now();
+
+    if (now >= t)
+      break;
+
+    delta = t - now;
+
+    if (delta > FT_PACE_SPIN_NS) {
+
+      delta -= FT_PACE_SPIN_NS;
+      ts.tv_sec = delta / 1000000000LL;
+      ts.tv_nsec = delta % 1000000000LL;
+
+      /* EINTR is fine, the loop re-evaluates */
+      nanosleep(&ts, (struct timespec*)0L);
+
+    }
+
+  } /* for */
+
+  return now;
+
+} /* ftpace_sleep_until */
+
+/*
+ * function: ftpace_init
+ *
+ * Initialize a token bucket releasing rate tokens/second with room
+ * for burst tokens.  A rate of 0 disables pacing.
+ *
+ * returns: < 0 error
+ *          >= 0 ok
+*/
+int ftpace_init(struct ftpace *ftpc, double rate, uint32_t burst)
+{
+
+  bzero(ftpc, sizeof *ftpc);
+
+  if (rate < 0)
+    return -1;
+
+  ftpc->rate = rate;
+  ftpc->burst = burst ? burst : 1;
+
+  if (rate > 0)
+    ftpc->ns_per_token = 1000000000.0 / rate;
+
+  /* start with a full bucket */
+  ftpc->tokens = ftpc->burst;
+  ftpc->last = ftpace_now();
+
+  return 0;
+
+} /* ftpace_init */
+
+/*
+ * function: ftpace_wait
+ *
+ * Take n tokens from the bucket, blocking until they are available.
+ * While the bucket holds enough tokens no system call is made, which
+ * keeps the per PDU cost negligible at high rates.
+ *
+ * returns: nanoseconds spent waiting
+*/
+int64_t ftpace_wait(struct ftpace *ftpc, uint32_t n)
+{
+  int64_t now, t;
+  double need;
+
+  if (ftpc->rate <= 0)
+    return 0;
+
+  /* fast path */
+  if (ftpc->tokens >= n) {
+    ftpc->tokens -= n;
+    return 0;
+  }
+
+  /* refill */
+  now = ftpace_now();
+  ftpc->tokens += (double)(now - ftpc->last) / ftpc->ns_per_token;
+  ftpc->last = now;
+
+  /* burst is also the most that can be carried between calls */
+  if (ftpc->tokens > ftpc->burst)
+    ftpc->tokens = ftpc->burst;
+
+  if (ftpc->tokens >= n) {
+    ftpc->tokens -= n;
+    return 0;
+  }
+
+  /* short, sleep until the deficit is covered */
+  need = (double)n - ftpc->tokens;
+  t = now + (int64_t)(need * ftpc->ns_per_token);
+
+  ftpc->last = ftpace_sleep_until(t);
+  ftpc->tokens += (double)(ftpc->last - now) / ftpc->ns_per_token;
+  ftpc->tokens -= n;
+
+  ++ftpc->waits;
+
+  return ftpc->last - now;
+
+} /* ftpace_wait */
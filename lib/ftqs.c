@@ -0,0 +1,280 @@
+/*
+ * Copyright (c) 2026 The flow-tools authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *      $Id$
+ */
+
+#include "ftinclude.h"
+#include "ftlib.h"
+
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * Relative error quantile sketch, after DDSketch (Masson et al. 2019).
+ *
+ * A value v > 0 goes to bin floor(FT_QS_MULT * L(v)) where L is log2
+ * interpolated linearly between powers of two, e + (m - 1) for
+ * v = m * 2^e with m in [1,2).  L is read off the bits of the double,
+ * no log() is needed per value.  One bin spans at most 1/FT_QS_MULT in
+ * ln(v) so the value returned for a bin is within 2% of every value
+ * that landed there.  Quantiles keep that relative error whatever the
+ * distribution.
+ *
+ * The bins cover a dense range of indexes that grows as needed.  Past
+ * FT_QS_MAX_BINS the lowest bins are folded into one, the upper
+ * quantiles stay accurate.  Two sketches are merged by adding the bins.
+ */
+
+#define FT_QS_MULT   25.0      /* bins per power of two, 2.0% error */
+#define FT_QS_MIN    1e-9      /* smaller values count as 0 */
+#define FT_QS_SLACK  8         /* extra bins allocated when growing */
+
+static int32_t ftqs_index(double v)
+{
+  uint64_t b;
+  double m, x;
+  int32_t e, i;
+
+  bcopy(&v, &b, sizeof b);
+  e = (int32_t)((b >> 52) & 0x7ff) - 1023;
+  b = (b & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+  bcopy(&b, &m, sizeof m);
+
+  x = ((double)e + m - 1.0) * FT_QS_MULT;
+  i = (int32_t)x;
+  if (x < (double)i)
+    --i;
+
+  return i;
+
+} /* ftqs_index */
+
+/* midpoint of bin i in the interpolated log2 */
+static double ftqs_value(int32_t i)
+{
+  double x;
+  int32_t e;
+
+  x = ((double)i + 0.5) / FT_QS_MULT;
+  e = (int32_t)x;
+  if (x < (double)e)
+    --e;
+
+  return ldexp(1.0 + (x - (double)e), e);
+
+} /* ftqs_value */
+
+/*
+ * function: ftqs_grow
+ *
+ * Make the bins cover indexes a..b, collapsing the lowest bins into
+ * the first when that would exceed FT_QS_MAX_BINS.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int ftqs_grow(struct ftqs *qs, int32_t a, int32_t b)
+{
+  uint32_t *bins, n, j;
+  int32_t lo, hi, olo, ohi, k;
+
+  olo = qs->lo;
+  ohi = qs->lo + (int32_t)qs->nbins - 1;
+
+  if (qs->nbins) {
+    if (olo < a)
+      a = olo;
+    if (ohi > b)
+      b = ohi;
+  }
+
+  lo = a;
+  hi = b;
+
+  if (hi - lo + 1 > FT_QS_MAX_BINS) {
+    lo = hi - FT_QS_MAX_BINS + 1;
+  } else {
+    if ((!qs->nbins) || (a < olo)) {
+      lo = a - (FT_QS_SLACK + (int32_t)qs->nbins / 4);
+      if (hi - lo + 1 > FT_QS_MAX_BINS)
+        lo = hi - FT_QS_MAX_BINS + 1;
+    }
+    if ((!qs->nbins) || (b > ohi)) {
+      hi = b + (FT_QS_SLACK + (int32_t)qs->nbins / 4);
+      if (hi - lo + 1 > FT_QS_MAX_BINS)
+        hi = lo + FT_QS_MAX_BINS - 1;
+    }
+  }
+
+  n = (uint32_t)(hi - lo + 1);
+
+  if (!(bins = (uint32_t*)calloc(n, sizeof (uint32_t)))) {
+    fterr_warn("calloc()");
+    return -1;
+  }
+
+  for (j = 0; j < qs->nbins; ++j) {
+    k = olo + (int32_t)j;
+    bins[(k < lo) ? 0 : k - lo] += qs->bins[j];
+  }
+
+  if (qs->bins)
+    free(qs->bins);
+
+  qs->bins = bins;
+  qs->nbins = n;
+  qs->lo = lo;
+
+  return 0;
+
+} /* ftqs_grow */
+
+/*
+ * function: ftqs_add
+ *
+ * Add value v to the sketch.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftqs_add(struct ftqs *qs, double v)
+{
+  int32_t i;
+
+  if (v < FT_QS_MIN) {
+    ++qs->zero;
+    ++qs->n;
+    return 0;
+  }
+
+  i = ftqs_index(v);
+
+  if (((!qs->nbins) || (i < qs->lo) ||
+    (i >= qs->lo + (int32_t)qs->nbins)) && ftqs_grow(qs, i, i))
+    return -1;
+
+  /* collapsed */
+  if (i < qs->lo)
+    i = qs->lo;
+
+  ++qs->bins[i - qs->lo];
+  ++qs->n;
+
+  return 0;
+
+} /* ftqs_add */
+
+/*
+ * function: ftqs_merge
+ *
+ * Fold src into dst.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftqs_merge(struct ftqs *dst, struct ftqs *src)
+{
+  uint32_t j;
+  int32_t k;
+
+  if (src->nbins && ((!dst->nbins) || (src->lo < dst->lo) ||
+    (src->lo + src->nbins > dst->lo + dst->nbins)) &&
+    ftqs_grow(dst, src->lo, src->lo + (int32_t)src->nbins - 1))
+    return -1;
+
+  for (j = 0; j < src->nbins; ++j) {
+    k = src->lo + (int32_t)j;
+    dst->bins[(k < dst->lo) ? 0 : k - dst->lo] += src->bins[j];
+  }
+
+  dst->n += src->n;
+  dst->zero += src->zero;
+
+  return 0;
+
+} /* ftqs_merge */
+
+/*
+ * function: ftqs_quantile
+ *
+ * Value at quantile q, 0 <= q <= 1, of the values added.
+ *
+ * returns: estimate, 0 for an empty sketch
+ */
+double ftqs_quantile(struct ftqs *qs, double q)
+{
+  uint64_t rank, c;
+  uint32_t j;
+
+  if (!qs->n)
+    return 0.0;
+
+  rank = (uint64_t)(q * (double)(qs->n - 1));
+
+  if (rank < qs->zero)
+    return 0.0;
+
+  c = qs->zero;
+
+  for (j = 0; j < qs->nbins; ++j) {
+    c += qs->bins[j];
+    if (c > rank)
+      break;
+  }
+
+  if (j == qs->nbins)
+    j = qs->nbins - 1;
+
+  return ftqs_value(qs->lo + (int32_t)j);
+
+} /* ftqs_quantile */
+
+/*
+ * function: ftqs_free
+ *
+ * Free the bins of a sketch, it is left empty.
+ */
+void ftqs_free(struct ftqs *qs)
+{
+
+  if (qs->bins)
+    free(qs->bins);
+
+  bzero(qs, sizeof *qs);
+
+} /* ftqs_free */
+
+/*
+ * function: ftqs_error
+ *
+ * returns: relative error bound of ftqs_quantile()
+ */
+double ftqs_error(void)
+{
+
+  return exp(1.0 / (2.0 * FT_QS_MULT)) - 1.0;
+
+} /* ftqs_error */
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2026 The flow-tools authors
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ *
+ *      $Id$
+ */
+
+#include "ftinclude.h"
+#include "ftlib.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Rollup files.  flow-capture -a sums the flows of each capture file by
+ * a few dimensions (exporter, interfaces, protocol, ToS, AS) and writes
+ * the sums next to it at rotation.  flow-report -R reads them back as
+ * flow records, one per row, so the reports keyed on those dimensions
+ * run over a handful of rows per interval instead of every flow.
+ *
+ *   struct ftrollup_rd rd;
+ *   char *rec;
+ *
+ *   ftrollup_open(&rd, fp);
+ *   while (ftrollup_read(&rd, &rec) == 1)
+ *     ftstat_def_accum(def, rec, &rd.fo);
+ */
+
+#define FT_ROLLUP_HSIZE   4096 /* initial hash index */
+#define FT_ROLLUP_CHUNK   1024 /* rows per hash chunk */
+
+#define FT_ROLLUP_MAX32   0xFFFFFFFFLL
+
+/*
+ * function: ftrollup_new
+ *
+ * Start summing flows by the dimensions xfields, a subset of
+ * FT_ROLLUP_XFIELDS.  time_start is the start of the capture interval.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftrollup_new(struct ftrollup *ftr, uint64_t xfields, uint32_t time_start)
+{
+
+  bzero(ftr, sizeof *ftr);
+
+  if (xfields & ~FT_ROLLUP_XFIELDS) {
+    fterr_warnx("ftrollup_new(): not a rollup dimension.");
+    return -1;
+  }
+
+  if (!(ftr->ftch = ftchash_new(FT_ROLLUP_HSIZE,
+    sizeof (struct ftchash_rec_rollup), sizeof (struct ftrollup_key),
+    FT_ROLLUP_CHUNK))) {
+    fterr_warnx("ftchash_new(): failed");
+    return -1;
+  }
+
+  ftr->xfields = xfields;
+  ftr->time_start = time_start;
+
+  return 0;
+
+} /* ftrollup_new */
+
+/*
+ * function: ftrollup_accum
+ *
+ * Add flow rec to its row.  fo must have the dimensions of ftr.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftrollup_accum(struct ftrollup *ftr, char *rec,
+  struct fts3rec_offsets *fo)
+{
+  struct fts3rec_all2 cur;
+  struct ftchash_rec_rollup ftch_recrollup, *ftch_recrollupp;
+  struct ftrollup_key *key;
+
+  bzero(&ftch_recrollup, sizeof ftch_recrollup);
+  key = &ftch_recrollup.row.key;
+
+  if (ftr->xfields & FT_XFIELD_EXADDR) {
+    FT_RECGET_EXADDR(cur,rec,*fo);
+    key->exaddr = cur.exaddr;
+  }
+
+  if (ftr->xfields & FT_XFIELD_INPUT) {
+    FT_RECGET_INPUT(cur,rec,*fo);
+    key->input = cur.input;
+  }
+
+  if (ftr->xfields & FT_XFIELD_OUTPUT) {
+    FT_RECGET_OUTPUT(cur,rec,*fo);
+    key->output = cur.output;
+  }
+
+  if (ftr->xfields & FT_XFIELD_PROT) {
+    FT_RECGET_PROT(cur,rec,*fo);
+    key->prot = cur.prot;
+  }
+
+  if (ftr->xfields & FT_XFIELD_TOS) {
+    FT_RECGET_TOS(cur,rec,*fo);
+    key->tos = cur.tos;
+  }
+
+  if (ftr->xfields & FT_XFIELD_SRC_AS) {
+    FT_RECGET_SRC_AS(cur,rec,*fo);
+    key->src_as = cur.src_as;
+  }
+
+  if (ftr->xfields & FT_XFIELD_DST_AS) {
+    FT_RECGET_DST_AS(cur,rec,*fo);
+    key->dst_as = cur.dst_as;
+  }
+
+  FT_RECGET_FIRST(cur,rec,*fo);
+  FT_RECGET_LAST(cur,rec,*fo);
+  FT_RECGET64_DPKTS(cur,rec,*fo);
+  FT_RECGET64_DOCTETS(cur,rec,*fo);
+
+  if (fo->xfields & FT_XFIELD_DFLOWS) {
+    FT_RECGET64_DFLOWS(cur,rec,*fo);
+  } else {
+    cur.dFlows64 = 1;
+  }
+
+  if (!(ftch_recrollupp = ftchash_update(ftr->ftch, &ftch_recrollup, 0))) {
+    fterr_warnx("ftch_update(): failed");
+    return -1;
+  }
+
+  ftch_recrollupp->row.nflows += cur.dFlows64;
+  ftch_recrollupp->row.noctets += cur.dOctets64;
+  ftch_recrollupp->row.npackets += cur.dPkts64;
+  ftch_recrollupp->row.etime += (uint32_t)(cur.Last - cur.First);
+
+  return 0;
+
+} /* ftrollup_accum */
+
+/*
+ * function: ftrollup_write
+ *
+ * Write the rows of ftr to fp as a rollup file, time_end is the end
+ * of the capture interval.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftrollup_write(struct ftrollup *ftr, FILE *fp, uint32_t time_end)
+{
+  struct ftrollup_hdr hdr;
+  struct ftchash_rec_rollup *ftch_recrollupp;
+
+  bzero(&hdr, sizeof hdr);
+  hdr.magic = FT_ROLLUP_MAGIC;
+  hdr.version = FT_ROLLUP_VERSION;
+  hdr.xfields = ftr->xfields;
+  hdr.time_start = ftr->time_start;
+  hdr.time_end = time_end;
+  hdr.nrows = ftr->ftch->entries;
+
+  if (fwrite(&hdr, sizeof hdr, 1, fp) != 1) {
+    fterr_warn("fwrite()");
+    return -1;
+  }
+
+  ftchash_first(ftr->ftch);
+
+  while ((ftch_recrollupp = ftchash_foreach(ftr->ftch))) {
+
+    if (fwrite(&ftch_recrollupp->row, sizeof ftch_recrollupp->row, 1,
+      fp) != 1) {
+      fterr_warn("fwrite()");
+      return -1;
+    }
+
+  }
+
+  return 0;
+
+} /* ftrollup_write */
+
+/*
+ * function: ftrollup_free
+ *
+ * Free the rows of ftr.
+ */
+void ftrollup_free(struct ftrollup *ftr)
+{
+
+  if (ftr->ftch)
+    ftchash_free(ftr->ftch);
+
+  bzero(ftr, sizeof *ftr);
+
+} /* ftrollup_free */
+
+/*
+ * function: ftrollup_open
+ *
+ * Start reading the rollup file fp, its header is in rd->hdr and the
+ * offsets of the records ftrollup_read() hands out in rd->fo.  The
+ * records have the fields FT_ROLLUP_XFIELDS_REC and the dimensions of
+ * the file.  The caller owns fp.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int ftrollup_open(struct ftrollup_rd *rd, FILE *fp)
+{
+  struct fts3rec_offsets *fo;
+  uint16_t zero;
+
+  bzero(rd, sizeof *rd);
+  rd->fp = fp;
+
+  if (fread(&rd->hdr, sizeof rd->hdr, 1, fp) != 1) {
+    fterr_warnx("ftrollup_open(): short header.");
+    return -1;
+  }
+
+  if (rd->hdr.magic != FT_ROLLUP_MAGIC) {
+    fterr_warnx("ftrollup_open(): bad magic, not a rollup or other byte order.");
+    return -1;
+  }
+
+  if (rd->hdr.version != FT_ROLLUP_VERSION) {
+    fterr_warnx("ftrollup_open(): unsupported version %lu.",
+      (unsigned long)rd->hdr.version);
+    return -1;
+  }
+
+  if (rd->hdr.xfields & ~FT_ROLLUP_XFIELDS) {
+    fterr_warnx("ftrollup_open(): unknown dimensions.");
+    return -1;
+  }
+
+  rd->left = rd->hdr.nrows;
+
+  /* fields not in the rollup read as 0 */
+  fo = &rd->fo;
+  zero = offsetof(struct ftrollup_xrec, zero);
+
+  fo->unix_secs = offsetof(struct ftrollup_xrec, unix_secs);
+  fo->unix_nsecs = offsetof(struct ftrollup_xrec, unix_nsecs);
+  fo->sysUpTime = offsetof(struct ftrollup_xrec, sysUpTime);
+  fo->exaddr = offsetof(struct ftrollup_xrec, exaddr);
+  fo->srcaddr = fo->dstaddr = fo->nexthop = zero;
+  fo->input = offsetof(struct ftrollup_xrec, input);
+  fo->output = offsetof(struct ftrollup_xrec, output);
+  fo->dFlows = offsetof(struct ftrollup_xrec, dFlows);
+  fo->dPkts = offsetof(struct ftrollup_xrec, dPkts);
+  fo->dOctets = offsetof(struct ftrollup_xrec, dOctets);
+  fo->First = offsetof(struct ftrollup_xrec, First);
+  fo->Last = offsetof(struct ftrollup_xrec, Last);
+  fo->srcport = fo->dstport = zero;
+  fo->prot = offsetof(struct ftrollup_xrec, prot);
+  fo->tos = offsetof(struct ftrollup_xrec, tos);
+  fo->tcp_flags = fo->pad = fo->engine_type = fo->engine_id = zero;
+  fo->src_mask = fo->dst_mask = zero;
+  fo->src_as = offsetof(struct ftrollup_xrec, src_as);
+  fo->dst_as = offsetof(struct ftrollup_xrec, dst_as);
+  fo->in_encaps = fo->out_encaps = fo->peer_nexthop = fo->router_sc = zero;
+  fo->src_tag = fo->dst_tag = fo->extra_pkts = fo->marked_tos = zero;
+
+  fo->xfields = FT_ROLLUP_XFIELDS_REC | rd->hdr.xfields;
+
+  /* rows carry the end of the capture interval as their time */
+  rd->xrec.unix_secs = rd->hdr.time_end;
+
+  return 0;
+
+} /* ftrollup_open */
+
+/*
+ * function: ftrollup_share
+ *
+ * Part i of n of the counter v, the parts add up to v.
+ */
+static uint32_t ftrollup_share(uint64_t v, uint32_t i, uint32_t n)
+{
+
+  return (uint32_t)(v / n + ((i < (v % n)) ? 1 : 0));
+
+} /* ftrollup_share */
+
+/*
+ * function: ftrollup_read
+ *
+ * Next record of the rollup in *rec, valid until the next call.  A row
+ * is one record unless a counter does not fit the 32 bit flow fields,
+ * then it is split over as many records as needed.
+ *
+ * returns: 1  record ready
+ *          0  end of file
+ *          <0 fail
+ */
+int ftrollup_read(struct ftrollup_rd *rd, char **rec)
+{
+  struct ftrollup_row *row;
+  uint64_t n;
+
+  row = &rd->row;
+
+  if (rd->split == rd->nsplit) {
+
+    if (!rd->left)
+      return 0;
+
+    if (fread(row, sizeof *row, 1, rd->fp) != 1) {
+      fterr_warnx("ftrollup_read(): short file.");
+      return -1;
+    }
+
+    --rd->left;
+
+    n = row->nflows / FT_ROLLUP_MAX32;
+    if (row->noctets / FT_ROLLUP_MAX32 > n)
+      n = row->noctets / FT_ROLLUP_MAX32;
+    if (row->npackets / FT_ROLLUP_MAX32 > n)
+      n = row->npackets / FT_ROLLUP_MAX32;
+    if (row->etime / FT_ROLLUP_MAX32 > n)
+      n = row->etime / FT_ROLLUP_MAX32;
+
+    rd->nsplit = n + 1;
+    rd->split = 0;
+
+    rd->xrec.exaddr = row->key.exaddr;
+    rd->xrec.input = row->key.input;
+    rd->xrec.output = row->key.output;
+    rd->xrec.src_as = row->key.src_as;
+    rd->xrec.dst_as = row->key.dst_as;
+    rd->xrec.prot = row->key.prot;
+    rd->xrec.tos = row->key.tos;
+
+  }
+
+  rd->xrec.dFlows = ftrollup_share(row->nflows, rd->split, rd->nsplit);
+  rd->xrec.dOctets = ftrollup_share(row->noctets, rd->split, rd->nsplit);
+  rd->xrec.dPkts = ftrollup_share(row->npackets, rd->split, rd->nsplit);
+  rd->xrec.Last = ftrollup_share(row->etime, rd->split, rd->nsplit);
+  rd->xrec.sysUpTime = rd->xrec.Last;
+
+  ++rd->split;
+
+  *rec = (char*)&rd->xrec;
+
+  return 1;
+
+} /* ftrollup_read */
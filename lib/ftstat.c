@@ -67,6 +67,8 @@
 
 #define FMT_SYM_LEN 64
 
+#define FT_STAT_BATCH 256 /* flows per pass of ftstat_def_accum_batch() */
+
 /*
  * ****  Datastructures and other implementation notes  ***
  *
@@ -84,7 +86,8 @@
  * The reports are grouped by a definition.  Typically the caller will
  * invoke all reports in a group by calling ftstat_def_new(),
  * ftstat_def_accum(), ftstat_def_calc(), ftstat_def_dump(), and
- * ftstat_def_free().
+ * ftstat_def_free().  ftstat_def_accum_batch() accumulates an array
+ * of flows a stage at a time, each report running over the whole batch.
  *
  * The reports in the configuration file are stored in a linked
  * list of ftstat_rpt with the head in struct ftstat.
@@ -155,7 +158,7 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
   fmt = FMT_JUST_LEFT;\
   fmt_buf1[0] = fmt_buf[0] = 0;\
   bzero(&tally, sizeof tally);\
-  tally.t_recs = ftch->entries;\
+  tally.t_recs = rpt->recs;\
   if (rpt->out->options & FT_STAT_OPT_NAMES)\
     fmt |= FMT_SYM;\
 
@@ -276,6 +279,10 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
       len += sprintf(fmt_buf+len, "%f", A->ps.max_pps);\
       comma = 1;\
     }\
+    if (rpt->out->fields & FT_STAT_FIELD_QUANT) {\
+      len += qs_dump(fmt_buf+len, rpt->out->fields, A->ps.qs, comma);\
+      comma = 1;\
+    }\
     if (rpt->out->fields & FT_STAT_FIELD_FRECS) {\
       if (comma) fmt_buf[len++] = ',';\
       len += fmt_uint64(fmt_buf+len, A->nrecs, FMT_JUST_LEFT);\
@@ -378,6 +385,10 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
      ((double)A->ps.max_pps / (double)rpt->max_pps)*100.0);\
     comma = 1;\
   }\
+  if (rpt->out->fields & FT_STAT_FIELD_QUANT) {\
+    len += qs_dump(fmt_buf+len, rpt->out->fields, A->ps.qs, comma);\
+    comma = 1;\
+  }\
   if (rpt->out->fields & FT_STAT_FIELD_FRECS) {\
     if (comma) fmt_buf[len++] = ',';\
     len += fmt_uint64(fmt_buf+len, A->nrecs, FMT_JUST_LEFT);\
@@ -405,9 +416,13 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
  * D = size of hash record (passed to sizeof (struct)
  * E = size of hash key
  * F = num hash recs in a chunk
+ * G = table may spill or be bounded, see STD_CALC_HASH
  *
  */
 #define STD_NEW_HASH(A,B,C,D,E,F)\
+  STD_NEW_HASH1(A,B,C,D,E,F,1)
+
+#define STD_NEW_HASH1(A,B,C,D,E,F,G)\
   struct A *B;\
   int slen;\
   if (!(B = (struct A*)malloc(sizeof (*B)))) {\
@@ -415,7 +430,7 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
     return (struct A*)0L;\
   }\
   bzero(B, sizeof *B);\
-  if (rpt->all_fields & FT_STAT_FIELD_PS)\
+  if (rpt->all_fields & (FT_STAT_FIELD_PS|FT_STAT_FIELD_QUANT))\
     slen = sizeof (struct D);\
   else\
     slen = sizeof (struct D) - sizeof (struct ftps);\
@@ -424,6 +439,16 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
     fterr_warnx("ftchash_new(): failed");\
     return (struct A*)0L;\
   }\
+  if ((G) && rpt->heavy_hitters) {\
+    if (chash_std_bound(rpt, B->ftch, offsetof(struct D, nrecs),\
+      offsetof(struct D, ps))) {\
+      ftchash_free(B->ftch);\
+      free(B);\
+      return (struct A*)0L;\
+    }\
+  } else if ((G) && rpt->memory_limit &&\
+    !(rpt->all_fields & FT_STAT_FIELD_QUANT))\
+    ftchash_limit(B->ftch, rpt->memory_limit);\
   return B;\
 
 /*
@@ -448,20 +473,12 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 
 #define STD_CALC_BUCKET(A,B,C)\
   struct A *B;\
-  register int i;\
   if (rpt->t_recs)\
     rpt->avg_pps /= (double)rpt->t_recs;\
   if (rpt->t_recs)\
     rpt->avg_bps /= (double)rpt->t_recs;\
   B = rpt->data;\
-  for (i = 0; i < C; ++i) {\
-    if ((B->bucket.duration[i]) && (rpt->all_fields & FT_STAT_FIELD_PS)) {\
-      B->bucket.avg_pps[i] /= (double)B->bucket.recs[i];\
-      B->bucket.avg_bps[i] /= (double)B->bucket.recs[i];\
-    }\
-    if (B->bucket.packets[i])\
-      rpt->recs ++;\
-  }\
+  bucket_calc(&B->bucket, rpt);\
   return 0;\
 
 /*
@@ -479,6 +496,11 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
     rpt->avg_pps /= (double)rpt->t_recs;\
   if (rpt->t_recs)\
     rpt->avg_bps /= (double)rpt->t_recs;\
+  rpt->heavy_evictions = B->ftch->evictions;\
+  rpt->heavy_error = B->ftch->bound_err;\
+  if (B->ftch->spill_runs)\
+    return chash_std_unspill(rpt, B->ftch, offsetof(struct C, nrecs),\
+      (rpt->all_fields & FT_STAT_FIELD_PS) ? offsetof(struct C, ps) : -1);\
   rpt->recs = B->ftch->entries;\
   if (rpt->all_fields & FT_STAT_FIELD_PS) {\
     ftchash_first(B->ftch);\
@@ -504,6 +526,96 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
     free (A);\
   }\
 
+/*
+ * merge min/max, a 0 min is unset
+ */
+#define MERGE_MIN(A,B)\
+  if ((B) && (((B) < (A)) || (!(A))))\
+    (A) = (B);\
+
+#define MERGE_MAX(A,B)\
+  if ((B) > (A))\
+    (A) = (B);\
+
+/*
+ * A = ftstat_rpt_n
+ * C = ftchash_rec_x
+ * F = record combine function for ftchash_merge()
+ */
+#define STD_MERGE_HASH1(A,C,F)\
+  struct chash_merge cm;\
+  cm.nrecs = offsetof(struct C, nrecs);\
+  cm.rpt = rpt;\
+  if (rpt->all_fields & (FT_STAT_FIELD_PS|FT_STAT_FIELD_QUANT))\
+    cm.ps = offsetof(struct C, ps);\
+  else\
+    cm.ps = -1;\
+  rpt_merge_totals(rpt, src);\
+  if (ftchash_merge(((struct A*)rpt->data)->ftch,\
+    ((struct A*)src->data)->ftch, F, &cm)) {\
+    fterr_warnx("ftchash_merge(): failed");\
+    return -1;\
+  }\
+  return 0;
+
+#define STD_MERGE_HASH(A,C)\
+  STD_MERGE_HASH1(A,C,chash_std_combine)
+
+/*
+ * A = ftstat_rpt_n
+ * C = bucket size
+ */
+#define STD_MERGE_BUCKET(A,C)\
+  rpt_merge_totals(rpt, src);\
+  if (bucket_merge(&((struct A*)rpt->data)->bucket,\
+    &((struct A*)src->data)->bucket, C, rpt)) {\
+    fterr_warnx("bucket_merge(): failed");\
+    return -1;\
+  }\
+  return 0;
+
+/*
+ * A = ftstat_rpt_n
+ * C = ftchash_rec_x
+ */
+#define STD_SAVE_HASH(A,C)\
+  struct chash_merge cm;\
+  cm.nrecs = offsetof(struct C, nrecs);\
+  cm.rpt = rpt;\
+  if (rpt->all_fields & (FT_STAT_FIELD_PS|FT_STAT_FIELD_QUANT))\
+    cm.ps = offsetof(struct C, ps);\
+  else\
+    cm.ps = -1;\
+  return chash_save(((struct A*)rpt->data)->ftch, fp, &cm);
+
+#define STD_LOAD_HASH(A,C)\
+  struct chash_merge cm;\
+  cm.nrecs = offsetof(struct C, nrecs);\
+  cm.rpt = rpt;\
+  if (rpt->all_fields & (FT_STAT_FIELD_PS|FT_STAT_FIELD_QUANT))\
+    cm.ps = offsetof(struct C, ps);\
+  else\
+    cm.ps = -1;\
+  return chash_load(((struct A*)rpt->data)->ftch, fp, &cm);
+
+/*
+ * A = ftstat_rpt_n
+ * C = bucket size
+ */
+#define STD_SAVE_BUCKET(A,C)\
+  return bucket_save(&((struct A*)rpt->data)->bucket, C, rpt, fp);
+
+#define STD_LOAD_BUCKET(A,C)\
+  return bucket_load(&((struct A*)rpt->data)->bucket, C, rpt, fp);
+
+/*
+ * reports whose records point to other tables or sketches
+ */
+#define STD_STATE_NONE\
+  fterr_warnx("%s: type %s can not save or load state.", rpt->name,\
+    rpt->format_name);\
+  return -1;
+
 /*
  * A = ftstat_rpt_n
  * B = rptn (local var name for A)
@@ -513,9 +625,10 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_BUCKET(A,B,C,SYM,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return bucket_bin_dump(fp, rpt, &B->bucket, KEY);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4,KEY5,KEY6);\
-  bucket_dump1(fp, rpt, &B->bucket, C, SYM);\
-  return 0;\
+  return bucket_dump1(fp, rpt, &B->bucket, SYM);\
 
 /*
  * A = ftstat_rpt_n
@@ -526,6 +639,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH0(A,B,C,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, 0, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch);\
   return 0;
@@ -533,6 +649,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH0P(A,B,C,D,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, D, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, D);\
   return 0;
@@ -541,6 +660,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH1(A,B,C,SYM1,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, 0, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, SYM1);\
   return 0;
@@ -548,6 +670,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH1P(A,B,C,D,SYM1,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, D, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, SYM1, D);\
   return 0;
@@ -555,6 +680,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH2(A,B,C,SYM1,SYM2,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, 0, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, SYM1, SYM2);\
   return 0;
@@ -562,6 +690,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH2P(A,B,C,D,SYM1,SYM2,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, D, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, SYM1, SYM2, D);\
   return 0;
@@ -569,6 +700,9 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH3(A,B,C,SYM1,SYM2,SYM3,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, 0, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, SYM1, SYM2, SYM3);\
   return 0;
@@ -576,22 +710,25 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
 #define STD_DUMP_HASH4(A,B,C,SYM1,SYM2,SYM3,SYM4,KEY,KEY1,KEY2,KEY3,KEY4,KEY5,KEY6)\
   struct A *B;\
   B = rpt->data;\
+  if (rpt->out->format == FT_STAT_FMT_BINARY)\
+    return chash_bin_dump(fp, rpt, B->ftch, (void*)C, 0, KEY, KEY1, KEY2,\
+      KEY3, KEY4, KEY5, KEY6);\
   recn_dump(fp, rpt->out->fields, KEY, KEY1, KEY2, KEY3, KEY4, KEY5, KEY6);\
   C(fp, rpt, B->ftch, SYM1, SYM2, SYM3,SYM4);\
   return 0;
 
+/*
+ * the counters were extracted once for all reports into ff by
+ * ftstat_def_accum_xrec(), as was the duration.  pps and bps are
+ * computed by the first report that needs them.
+ */
 #define STD_ACCUM\
-  cur.dFlows64 = 1;\
-  FT_RECGET_LAST(cur,rec,*fo);\
-  FT_RECGET_FIRST(cur,rec,*fo);\
-  FT_RECGET64_DPKTS(cur,rec,*fo);\
-  FT_RECGET64_DOCTETS(cur,rec,*fo);\
-  FT_RECGET_UNIX_SECS(cur,rec,*fo);\
-  if (fo->xfields &  FT_XFIELD_DFLOWS) {\
-    FT_RECGET64_DFLOWS(cur,rec,*fo);\
-  } else {\
-    cur.dFlows64 = 1;\
-  }\
+  cur.dFlows64 = ff->dFlows64;\
+  cur.Last = ff->Last;\
+  cur.First = ff->First;\
+  cur.dPkts64 = ff->dPkts64;\
+  cur.dOctets64 = ff->dOctets64;\
+  cur.unix_secs = ff->unix_secs;\
   if (rpt->scale) {\
     cur.dPkts64 *= rpt->scale;\
     cur.dOctets64 *= rpt->scale;\
@@ -605,13 +742,23 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
   if (cur.unix_secs < rpt->time_start)\
     rpt->time_start = cur.unix_secs;\
   {\
-  duration_tmp = (cur.Last - cur.First);\
+  duration_tmp = ff->duration;\
   if (duration_tmp) {\
     rpt->t_recs ++;\
     rpt->t_duration += duration_tmp;\
-    if (rpt->all_fields & FT_STAT_FIELD_PS) {\
-      pps_tmp = (double)cur.dPkts64/((double)(duration_tmp)/1000.0);\
-      bps_tmp = (double)cur.dOctets64*8/((double)(duration_tmp)/1000.0);\
+    if (rpt->all_fields & (FT_STAT_FIELD_PS|FT_STAT_FIELD_QPS)) {\
+      if (rpt->scale) {\
+        pps_tmp = (double)cur.dPkts64/((double)(duration_tmp)/1000.0);\
+        bps_tmp = (double)cur.dOctets64*8/((double)(duration_tmp)/1000.0);\
+      } else {\
+        if (!ff->ps_valid) {\
+          ff->pps = (double)cur.dPkts64/((double)(duration_tmp)/1000.0);\
+          ff->bps = (double)cur.dOctets64*8/((double)(duration_tmp)/1000.0);\
+          ff->ps_valid = 1;\
+        }\
+        pps_tmp = ff->pps;\
+        bps_tmp = ff->bps;\
+      }\
       if (pps_tmp > rpt->max_pps)\
         rpt->max_pps = pps_tmp;\
       if ((pps_tmp < rpt->min_pps) || (!rpt->min_pps))\
@@ -638,25 +785,33 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
   STD_ACCUM;
 
 #define STD_ACCUM_BUCKET2(A,B)\
+  {\
+  struct flow_bucket_page *bp;\
+  uint32_t bi;\
+  if (!(bp = BUCKET_PAGE(&(A), (B))))\
+    return -1;\
+  bi = (B) & FT_STAT_BUCKET_MASK;\
   if (duration_tmp) {\
-    A.duration[B] += duration_tmp;\
-    A.recs[B] ++;\
+    bp->duration[bi] += duration_tmp;\
+    bp->recs[bi] ++;\
     if (rpt->all_fields & FT_STAT_FIELD_PS) {\
-      if (pps_tmp > A.max_pps[B])\
-        A.max_pps[B] = pps_tmp;\
-      if ((pps_tmp < A.min_pps[B]) || (!A.min_pps[B]))\
-        A.min_pps[B] = pps_tmp;\
-      A.avg_pps[B] += pps_tmp;\
-      if (bps_tmp > A.max_bps[B])\
-        A.max_bps[B] = bps_tmp;\
-      if ((bps_tmp < A.min_bps[B]) || (!A.min_bps[B]))\
-        A.min_bps[B] = bps_tmp;\
-      A.avg_bps[B] += bps_tmp;\
+      if (pps_tmp > bp->max_pps[bi])\
+        bp->max_pps[bi] = pps_tmp;\
+      if ((pps_tmp < bp->min_pps[bi]) || (!bp->min_pps[bi]))\
+        bp->min_pps[bi] = pps_tmp;\
+      bp->avg_pps[bi] += pps_tmp;\
+      if (bps_tmp > bp->max_bps[bi])\
+        bp->max_bps[bi] = bps_tmp;\
+      if ((bps_tmp < bp->min_bps[bi]) || (!bp->min_bps[bi]))\
+        bp->min_bps[bi] = bps_tmp;\
+      bp->avg_bps[bi] += bps_tmp;\
     }\
   }\
-  A.flows[B] += cur.dFlows64;\
-  A.octets[B] += cur.dOctets64;\
-  A.packets[B] += cur.dPkts64;\
+  bp->flows[bi] += cur.dFlows64;\
+  bp->octets[bi] += cur.dOctets64;\
+  bp->packets[bi] += cur.dPkts64;\
+  STD_ACCUM_QS(bp->qs[bi]);\
+  }\
 
 #define STD_ACCUM_HASH1(A,B,C,D,E)\
   struct fts3rec_all2 cur;\
@@ -696,6 +851,16 @@ if (rpt->out->fields & FT_STAT_FIELD_LAST) {\
   A->nflows += cur.dFlows64;\
   A->noctets += cur.dOctets64;\
   A->npackets += cur.dPkts64;\
+  STD_ACCUM_QS(A->ps.qs);\
+
+/*
+ * A = struct ftstat_qs pointer of the key, allocated on first use
+ */
+#define STD_ACCUM_QS(A)\
+  if (rpt->all_fields & FT_STAT_FIELD_QUANT) {\
+    if (qs_accum(rpt, &(A), &cur, duration_tmp, pps_tmp, bps_tmp))\
+      return -1;\
+  }\
 
 #define STD_CALC\
   if (rpt->t_recs)\
@@ -782,12 +947,19 @@ enum ftstat_parse_state { PARSE_STATE_UNSET, PARSE_STATE_REPORT,
 #define FT_STAT_FIELD_KEY5       0x00100000
 #define FT_STAT_FIELD_KEY6       0x00200000
 
+#define FT_STAT_FIELD_QDURATION  0x00400000 /* quantiles of duration */
+#define FT_STAT_FIELD_QPPS       0x00800000 /* quantiles of pps */
+
 #define FT_STAT_FIELD_COUNT      0x01000000 /* reports that do a count */
 #define FT_STAT_FIELD_FRECS      0x02000000 /* flow records in report line */
+#define FT_STAT_FIELD_QBPS       0x04000000 /* quantiles of bps */
+#define FT_STAT_FIELD_QOPP       0x08000000 /* quantiles of octets/packet */
 
 #define FT_STAT_FIELD_PPS        0x00001500 /* any *_PPS */
 #define FT_STAT_FIELD_BPS        0x00002A00 /* any *_BPS */
 #define FT_STAT_FIELD_PS         (FT_STAT_FIELD_PPS|FT_STAT_FIELD_BPS)
+#define FT_STAT_FIELD_QPS        (FT_STAT_FIELD_QPPS|FT_STAT_FIELD_QBPS)
+#define FT_STAT_FIELD_QUANT      0x0CC00000 /* any quantiles */
 
 #define FT_STAT_FIELD_GENERIC    0x0200FFF7 /* most reports */
 #define FT_STAT_FIELD_GENERIC2   0x02037FF7 /* reports with 2 key fields */
@@ -804,14 +976,71 @@ struct tally {
   double ravg_bps, ravg_pps, rt_frecs;
 };
 
-struct flow_bucket {
+/*
+ * layout of a hash record for chash_std_combine().  nrecs, nflows,
+ * noctets, npackets and etime are consecutive in every ftchash_rec_*
+ */
+struct chash_merge {
+  int nrecs; /* offset of nrecs */
+  int ps; /* offset of struct ftps, -1 when not allocated */
+  struct ftstat_rpt *rpt; /* owner of drec */
+};
+
+/*
+ * bucket reports keep their counters in pages of FT_STAT_BUCKET_PAGE
+ * buckets allocated the first time a flow lands in one.  A page holds
+ * one array per counter, the pps/bps and quantile arrays only when the
+ * report has those fields.  index lists the buckets with flows at dump
+ * time.
+ */
+#define FT_STAT_BUCKET_SHIFT     8
+#define FT_STAT_BUCKET_PAGE      (1<<FT_STAT_BUCKET_SHIFT)
+#define FT_STAT_BUCKET_MASK      (FT_STAT_BUCKET_PAGE-1)
+
+struct flow_bucket_page {
   uint64_t *recs, *flows, *octets, *packets, *duration;
   double *avg_pps, *avg_bps;
   double *min_pps, *min_bps;
   double *max_pps, *max_bps;
-  uint32_t *index;
+  struct ftstat_qs **qs;
+}; /* flow_bucket_page */
+
+struct flow_bucket {
+  struct flow_bucket_page **pages; /* npages, 0L until touched */
+  uint32_t n, npages, page_len; /* buckets, pages, buckets per page */
+  int ps, qs; /* pages have the pps/bps, quantile arrays */
+  uint32_t *index, nindex; /* buckets with flows, bucket_index() */
 }; /* flow_bucket */
 
+/* page of bucket i, allocated if new.  0L if out of memory */
+#define BUCKET_PAGE(b,i)\
+  ((b)->pages[(i)>>FT_STAT_BUCKET_SHIFT] ?\
+    (b)->pages[(i)>>FT_STAT_BUCKET_SHIFT] :\
+    bucket_page_new((b), (i)>>FT_STAT_BUCKET_SHIFT))
+
+/*
+ * quantile sketches of one key, allocated on the first flow and kept
+ * on a list in the report so they are freed with it
+ */
+#define FT_STAT_QS_DURATION 0
+#define FT_STAT_QS_PPS      1
+#define FT_STAT_QS_BPS      2
+#define FT_STAT_QS_OPP      3
+#define FT_STAT_QS_N        4
+
+struct ftstat_qs {
+  struct ftstat_qs *next; /* rpt->qs */
+  struct ftstat_qs *spare; /* rpt->qs_spare */
+  struct ftqs q[FT_STAT_QS_N];
+};
+
+#define FT_STAT_QS_NPOINTS  3
+
+static int qs_fields[FT_STAT_QS_N] = {FT_STAT_FIELD_QDURATION,
+  FT_STAT_FIELD_QPPS, FT_STAT_FIELD_QBPS, FT_STAT_FIELD_QOPP};
+static char *qs_names[FT_STAT_QS_N] = {"duration", "pps", "bps", "opp"};
+static int qs_points[FT_STAT_QS_NPOINTS] = {50, 95, 99};
+
 struct line_parser {
   enum ftstat_parse_state state;
   struct ftstat_rpt *cur_rpt;
@@ -833,6 +1062,9 @@ struct typelookup {
   void* (*f_new)();
   void* (*f_accum)();
   void* (*f_calc)();
+  void* (*f_merge)();
+  int (*f_save)();
+  int (*f_load)();
   void* (*f_dump)();
   void* (*f_free)();
   int allowed_fields; /* FT_STAT_FIELD_* */
@@ -1220,6 +1452,9 @@ int parse_rpt(struct line_parser *lp, struct ftstat *ftstat);
 int parse_rpt_type(struct line_parser *lp, struct ftstat *ftstat);
 int parse_rpt_filter(struct line_parser *lp, struct ftstat *ftstat);
 int parse_rpt_scale(struct line_parser *lp, struct ftstat *ftstat);
+int parse_rpt_memory_limit(struct line_parser *lp, struct ftstat *ftstat);
+int parse_rpt_count_estimate(struct line_parser *lp, struct ftstat *ftstat);
+int parse_rpt_heavy_hitters(struct line_parser *lp, struct ftstat *ftstat);
 int parse_rpt_tag_mask(struct line_parser *lp, struct ftstat *ftstat);
 int parse_rpt_ip_src_addr_fmt(struct line_parser *lp, struct ftstat *ftstat);
 int parse_rpt_ip_dst_addr_fmt(struct line_parser *lp, struct ftstat *ftstat);
@@ -1238,6 +1473,7 @@ int parse_def_tag(struct line_parser *lp, struct ftstat *ftstat);
 int parse_def_filter(struct line_parser *lp, struct ftstat *ftstat);
 int parse_def_report(struct line_parser *lp, struct ftstat *ftstat);
 int parse_def_time_series(struct line_parser *lp, struct ftstat *ftstat);
+int parse_def_window(struct line_parser *lp, struct ftstat *ftstat);
 int parse_include_tag(struct line_parser *lp, struct ftstat *ftstat);
 int parse_include_filter(struct line_parser *lp, struct ftstat *ftstat);
 int parse_include_mask(struct line_parser *lp, struct ftstat *ftstat);
@@ -1257,8 +1493,54 @@ static int sort_cmp64(const void *a, const void *b);
 static int sort_cmp_double(const void *a, const void *b);
 void bucket_free(struct flow_bucket *b);
 int bucket_alloc(struct flow_bucket *b, uint32_t n, struct ftstat_rpt *rpt);
+static struct flow_bucket_page *bucket_page_new(struct flow_bucket *b,
+  uint32_t pg);
+static void bucket_calc(struct flow_bucket *b, struct ftstat_rpt *rpt);
+static int bucket_index(struct flow_bucket *b);
+static int bucket_merge(struct flow_bucket *b, struct flow_bucket *src,
+  uint32_t n, struct ftstat_rpt *rpt);
+static void rpt_merge_totals(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+static int state_write(FILE *fp, const void *buf, size_t n);
+static int state_read(FILE *fp, void *buf, size_t n);
+static int state_write_str(FILE *fp, const char *str);
+static char *state_read_str(FILE *fp);
+static int rpt_save_totals(struct ftstat_rpt *rpt, FILE *fp);
+static int rpt_load_totals(struct ftstat_rpt *rpt, FILE *fp);
+static int chash_save(struct ftchash *ftch, FILE *fp, struct chash_merge *cm);
+static int chash_load(struct ftchash *ftch, FILE *fp, struct chash_merge *cm);
+static int bucket_save(struct flow_bucket *b, uint32_t n,
+  struct ftstat_rpt *rpt, FILE *fp);
+static int bucket_load(struct flow_bucket *b, uint32_t n,
+  struct ftstat_rpt *rpt, FILE *fp);
+static int chash_std_combine(void *drec, void *srec, void *arg);
+static void chash_std_clear(void *rec, void *arg);
+static int chash_load_combine(void *drec, void *srec, void *arg);
+static void chash_std_final(void *rec, void *arg);
+static int chash_std_unspill(struct ftstat_rpt *rpt, struct ftchash *ftch,
+  int nrecs, int ps);
+static int chash_std_bound(struct ftstat_rpt *rpt, struct ftchash *ftch,
+  int nrecs, int ps);
+static void chash_std_evict(void *rec, void *arg);
+static struct ftstat_qs *qs_new(struct ftstat_rpt *rpt);
+static int qs_accum(struct ftstat_rpt *rpt, struct ftstat_qs **qsp,
+  struct fts3rec_all2 *cur, uint32_t duration, double pps, double bps);
+static int qs_merge(struct ftstat_rpt *rpt, struct ftstat_qs **qsp,
+  struct ftstat_qs *src);
+static int qs_dump(char *buf, int fields, struct ftstat_qs *qs, int comma);
+static void qs_free(struct ftstat_rpt *rpt);
+static int chash_prefixh_combine(void *drec, void *srec, void *arg);
+static void flow_get(struct ftstat_flow *ff, char *rec,
+  struct fts3rec_offsets *fo);
+static int chash_int_combine(void *drec, void *srec, void *arg);
 static int bucket_dump1(FILE *fp, struct ftstat_rpt *rpt, struct flow_bucket *b,
-  uint32_t nindex, const char *symfile);
+  const char *symfile);
+static int bucket_sort(struct ftstat_rpt *rpt, struct flow_bucket *b,
+  int32_t *start, int32_t *end, int32_t *increment);
+static int bucket_bin_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct flow_bucket *b, char *key);
+static int chash_bin_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, void *f_dump, int f1, char *key, char *key1,
+  char *key2, char *key3, char *key4, char *key5, char *key6);
 static int chash_c64_dump(FILE *fp, struct ftstat_rpt *rpt,
   struct ftchash *ftch);
 static int chash_c32_dump(FILE *fp, struct ftstat_rpt *rpt,
@@ -1300,547 +1582,785 @@ static int chash_int_dump(FILE *fp, struct ftstat_rpt *rpt,
 
 struct ftstat_rpt_1 *ftstat_rpt_1_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_1_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_1_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_1_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_1_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_1_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_1_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_1_free(struct ftstat_rpt_1 *rpt);
 
 struct ftstat_rpt_2 *ftstat_rpt_2_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_2_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_2_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_2_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_2_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_2_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_2_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_2_free(struct ftstat_rpt_2 *rpt);
 
 struct ftstat_rpt_3 *ftstat_rpt_3_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_3_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_3_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_3_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_3_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_3_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_3_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_3_free(struct ftstat_rpt_3 *rpt);
 
 struct ftstat_rpt_4 *ftstat_rpt_4_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_4_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_4_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_4_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_4_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_4_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_4_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_4_free(struct ftstat_rpt_4 *rpt);
 
 struct ftstat_rpt_5 *ftstat_rpt_5_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_5_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_5_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_5_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_5_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_5_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_5_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_5_free(struct ftstat_rpt_5 *rpt);
 
 struct ftstat_rpt_6 *ftstat_rpt_6_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_6_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_6_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_6_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_6_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_6_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_6_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_6_free(struct ftstat_rpt_6 *rpt);
 
 struct ftstat_rpt_7 *ftstat_rpt_7_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_7_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_7_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_7_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_7_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_7_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_7_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_7_free(struct ftstat_rpt_7 *rpt);
 
 struct ftstat_rpt_8 *ftstat_rpt_8_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_8_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_8_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_8_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_8_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_8_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_8_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_8_free(struct ftstat_rpt_8 *rpt);
 
 struct ftstat_rpt_9 *ftstat_rpt_9_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_9_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_9_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_9_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_9_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_9_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_9_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_9_free(struct ftstat_rpt_9 *rpt);
 
 struct ftstat_rpt_10 *ftstat_rpt_10_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_10_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_10_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_10_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_10_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_10_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_10_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_10_free(struct ftstat_rpt_10 *rpt);
 
 struct ftstat_rpt_11 *ftstat_rpt_11_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_11_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_11_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_11_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_11_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_11_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_11_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_11_free(struct ftstat_rpt_11 *rpt);
 
 struct ftstat_rpt_12 *ftstat_rpt_12_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_12_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_12_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_12_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_12_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_12_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_12_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_12_free(struct ftstat_rpt_12 *rpt);
 
 struct ftstat_rpt_13 *ftstat_rpt_13_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_13_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_13_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_13_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_13_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_13_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_13_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_13_free(struct ftstat_rpt_13 *rpt);
 
 struct ftstat_rpt_14 *ftstat_rpt_14_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_14_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_14_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_14_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_14_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_14_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_14_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_14_free(struct ftstat_rpt_14 *rpt);
 
 struct ftstat_rpt_15 *ftstat_rpt_15_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_15_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_15_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_15_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_15_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_15_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_15_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_15_free(struct ftstat_rpt_15 *rpt);
 
 struct ftstat_rpt_16 *ftstat_rpt_16_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_16_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_16_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_16_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_16_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_16_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_16_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_16_free(struct ftstat_rpt_16 *rpt);
 
 struct ftstat_rpt_17 *ftstat_rpt_17_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_17_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_17_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_17_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_17_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_17_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_17_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_17_free(struct ftstat_rpt_17 *rpt);
 
 struct ftstat_rpt_18 *ftstat_rpt_18_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_18_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_18_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_18_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_18_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_18_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_18_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_18_free(struct ftstat_rpt_18 *rpt);
 
 struct ftstat_rpt_19 *ftstat_rpt_19_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_19_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_19_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_19_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_19_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_19_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_19_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_19_free(struct ftstat_rpt_19 *rpt);
 
 struct ftstat_rpt_20 *ftstat_rpt_20_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_20_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_20_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_20_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_20_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_20_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_20_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_20_free(struct ftstat_rpt_20 *rpt);
 
 struct ftstat_rpt_21 *ftstat_rpt_21_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_21_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_21_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_21_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_21_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_21_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_21_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_21_free(struct ftstat_rpt_21 *rpt);
 
 struct ftstat_rpt_22 *ftstat_rpt_22_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_22_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_22_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_22_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_22_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_22_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_22_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_22_free(struct ftstat_rpt_22 *rpt);
 
 struct ftstat_rpt_23 *ftstat_rpt_23_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_23_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_23_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_23_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_23_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_23_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_23_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_23_free(struct ftstat_rpt_23 *rpt);
 
 struct ftstat_rpt_24 *ftstat_rpt_24_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_24_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_24_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_24_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_24_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_24_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_24_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_24_free(struct ftstat_rpt_24 *rpt);
 
 struct ftstat_rpt_25 *ftstat_rpt_25_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_25_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_25_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_25_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_25_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_25_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_25_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_25_free(struct ftstat_rpt_25 *rpt);
 
 struct ftstat_rpt_26 *ftstat_rpt_26_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_26_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_26_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_26_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_26_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_26_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_26_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_26_free(struct ftstat_rpt_26 *rpt);
 
 struct ftstat_rpt_27 *ftstat_rpt_27_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_27_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_27_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_27_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_27_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_27_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_27_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_27_free(struct ftstat_rpt_27 *rpt);
 
 struct ftstat_rpt_28 *ftstat_rpt_28_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_28_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_28_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_28_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_28_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_28_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_28_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_28_free(struct ftstat_rpt_28 *rpt);
 
 struct ftstat_rpt_29 *ftstat_rpt_29_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_29_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_29_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_29_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_29_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_29_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_29_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_29_free(struct ftstat_rpt_29 *rpt);
 
 struct ftstat_rpt_30 *ftstat_rpt_30_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_30_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_30_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_30_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_30_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_30_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_30_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_30_free(struct ftstat_rpt_30 *rpt);
 
 struct ftstat_rpt_31 *ftstat_rpt_31_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_31_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_31_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_31_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_31_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_31_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_31_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_31_free(struct ftstat_rpt_31 *rpt);
 
 struct ftstat_rpt_32 *ftstat_rpt_32_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_32_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_32_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_32_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_32_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_32_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_32_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_32_free(struct ftstat_rpt_32 *rpt);
 
 struct ftstat_rpt_33 *ftstat_rpt_33_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_33_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_33_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_33_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_33_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_33_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_33_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_33_free(struct ftstat_rpt_33 *rpt);
 
 struct ftstat_rpt_34 *ftstat_rpt_34_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_34_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_34_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_34_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_34_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_34_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_34_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_34_free(struct ftstat_rpt_34 *rpt);
 
 struct ftstat_rpt_35 *ftstat_rpt_35_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_35_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_35_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_35_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_35_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_35_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_35_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_35_free(struct ftstat_rpt_35 *rpt);
 
 struct ftstat_rpt_36 *ftstat_rpt_36_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_36_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_36_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_36_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_36_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_36_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_36_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_36_free(struct ftstat_rpt_36 *rpt);
 
 struct ftstat_rpt_37 *ftstat_rpt_37_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_37_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_37_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_37_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_37_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_37_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_37_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_37_free(struct ftstat_rpt_37 *rpt);
 
 struct ftstat_rpt_38 *ftstat_rpt_38_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_38_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_38_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_38_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_38_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_38_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_38_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_38_free(struct ftstat_rpt_38 *rpt);
 
 struct ftstat_rpt_39 *ftstat_rpt_39_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_39_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_39_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_39_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_39_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_39_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_39_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_39_free(struct ftstat_rpt_39 *rpt);
 
 struct ftstat_rpt_40 *ftstat_rpt_40_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_40_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_40_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_40_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_40_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_40_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_40_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_40_free(struct ftstat_rpt_40 *rpt);
 
 struct ftstat_rpt_41 *ftstat_rpt_41_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_41_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_41_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_41_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_41_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_41_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_41_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_41_free(struct ftstat_rpt_41 *rpt);
 
 struct ftstat_rpt_42 *ftstat_rpt_42_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_42_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_42_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_42_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_42_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_42_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_42_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_42_free(struct ftstat_rpt_42 *rpt);
 
 struct ftstat_rpt_43 *ftstat_rpt_43_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_43_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_43_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_43_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_43_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_43_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_43_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_43_free(struct ftstat_rpt_43 *rpt);
 
 struct ftstat_rpt_44 *ftstat_rpt_44_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_44_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_44_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_44_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_44_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_44_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_44_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_44_free(struct ftstat_rpt_44 *rpt);
 
 struct ftstat_rpt_45 *ftstat_rpt_45_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_45_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_45_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_45_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_45_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_45_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_45_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_45_free(struct ftstat_rpt_45 *rpt);
 
 struct ftstat_rpt_46 *ftstat_rpt_46_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_46_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_46_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_46_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_46_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_46_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_46_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_46_free(struct ftstat_rpt_46 *rpt);
 
 struct ftstat_rpt_47 *ftstat_rpt_47_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_47_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_47_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_47_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_47_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_47_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_47_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_47_free(struct ftstat_rpt_47 *rpt);
 
 struct ftstat_rpt_48 *ftstat_rpt_48_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_48_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_48_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_48_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_48_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_48_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_48_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_48_free(struct ftstat_rpt_48 *rpt);
 
 struct ftstat_rpt_49 *ftstat_rpt_49_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_49_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_49_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_49_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_49_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_49_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_49_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_49_free(struct ftstat_rpt_49 *rpt);
 
 struct ftstat_rpt_50 *ftstat_rpt_50_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_50_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_50_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_50_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_50_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_50_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_50_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_50_free(struct ftstat_rpt_50 *rpt);
 
 struct ftstat_rpt_51 *ftstat_rpt_51_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_51_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_51_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_51_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_51_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_51_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_51_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_51_free(struct ftstat_rpt_51 *rpt);
 
 struct ftstat_rpt_52 *ftstat_rpt_52_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_52_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_52_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_52_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_52_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_52_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_52_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_52_free(struct ftstat_rpt_52 *rpt);
 
 struct ftstat_rpt_53 *ftstat_rpt_53_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_53_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_53_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_53_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_53_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_53_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_53_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_53_free(struct ftstat_rpt_53 *rpt);
 
 struct ftstat_rpt_54 *ftstat_rpt_54_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_54_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_54_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_54_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_54_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_54_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_54_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_54_free(struct ftstat_rpt_54 *rpt);
 
 struct ftstat_rpt_55 *ftstat_rpt_55_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_55_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_55_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_55_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_55_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_55_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_55_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_55_free(struct ftstat_rpt_55 *rpt);
 
 struct ftstat_rpt_56 *ftstat_rpt_56_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_56_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_56_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_56_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_56_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_56_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_56_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_56_free(struct ftstat_rpt_56 *rpt);
 
 struct ftstat_rpt_57 *ftstat_rpt_57_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_57_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_57_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_57_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_57_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_57_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_57_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_57_free(struct ftstat_rpt_57 *rpt);
 
 struct ftstat_rpt_58 *ftstat_rpt_58_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_58_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_58_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_58_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_58_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_58_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_58_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_58_free(struct ftstat_rpt_58 *rpt);
 
 struct ftstat_rpt_59 *ftstat_rpt_59_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_59_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_59_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_59_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_59_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_59_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_59_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_59_free(struct ftstat_rpt_59 *rpt);
 
 struct ftstat_rpt_60 *ftstat_rpt_60_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_60_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_60_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_60_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_60_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_60_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_60_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_60_free(struct ftstat_rpt_60 *rpt);
 
 struct ftstat_rpt_61 *ftstat_rpt_61_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_61_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_61_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_61_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_61_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_61_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_61_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_61_free(struct ftstat_rpt_61 *rpt);
 
 struct ftstat_rpt_62 *ftstat_rpt_62_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_62_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_62_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_62_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_62_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_62_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_62_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_62_free(struct ftstat_rpt_62 *rpt);
 
 struct ftstat_rpt_63 *ftstat_rpt_63_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_63_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_63_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_63_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_63_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_63_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_63_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_63_free(struct ftstat_rpt_63 *rpt);
 
 struct ftstat_rpt_64 *ftstat_rpt_64_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_64_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_64_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_64_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_64_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_64_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_64_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_64_free(struct ftstat_rpt_64 *rpt);
 
 struct ftstat_rpt_65 *ftstat_rpt_65_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_65_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_65_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_65_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_65_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_65_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_65_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_65_free(struct ftstat_rpt_65 *rpt);
 
 struct ftstat_rpt_66 *ftstat_rpt_66_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_66_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_66_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_66_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_66_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_66_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_66_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_66_free(struct ftstat_rpt_66 *rpt);
 
 struct ftstat_rpt_67 *ftstat_rpt_67_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_67_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_67_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_67_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_67_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_67_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_67_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_67_free(struct ftstat_rpt_67 *rpt);
 
+struct ftstat_rpt_66 *ftstat_rpt_79_new(struct ftstat_rpt *rpt);
+
+struct ftstat_rpt_67 *ftstat_rpt_80_new(struct ftstat_rpt *rpt);
+
 struct ftstat_rpt_68 *ftstat_rpt_68_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_68_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_68_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_68_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_68_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_68_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_68_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_68_free(struct ftstat_rpt_68 *rpt);
 
 struct ftstat_rpt_69 *ftstat_rpt_69_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_69_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_69_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_69_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_69_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_69_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_69_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_69_free(struct ftstat_rpt_69 *rpt);
 
 struct ftstat_rpt_70 *ftstat_rpt_70_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_70_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_70_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_70_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_70_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_70_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_70_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_70_free(struct ftstat_rpt_70 *rpt);
 
 struct ftstat_rpt_71 *ftstat_rpt_71_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_71_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_71_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_71_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_71_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_71_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_71_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_71_free(struct ftstat_rpt_71 *rpt);
 
 struct ftstat_rpt_72 *ftstat_rpt_72_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_72_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_72_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_72_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_72_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_72_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_72_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_72_free(struct ftstat_rpt_72 *rpt);
 
 struct ftstat_rpt_73 *ftstat_rpt_73_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_73_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_73_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_73_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_73_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_73_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_73_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_73_free(struct ftstat_rpt_73 *rpt);
 
 struct ftstat_rpt_74 *ftstat_rpt_74_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_74_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_74_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_74_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_74_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_74_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_74_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_74_free(struct ftstat_rpt_74 *rpt);
 
 struct ftstat_rpt_75 *ftstat_rpt_75_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_75_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_75_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_75_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_75_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_75_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_75_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_75_free(struct ftstat_rpt_75 *rpt);
 
 struct ftstat_rpt_76 *ftstat_rpt_76_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_76_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_76_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_76_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_76_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_76_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_76_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_76_free(struct ftstat_rpt_76 *rpt);
 
 struct ftstat_rpt_77 *ftstat_rpt_77_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_77_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_77_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_77_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_77_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_77_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_77_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_77_free(struct ftstat_rpt_77 *rpt);
 
 struct ftstat_rpt_78 *ftstat_rpt_78_new(struct ftstat_rpt *rpt);
 int ftstat_rpt_78_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo);
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff);
 int ftstat_rpt_78_calc(struct ftstat_rpt *rpt);
+int ftstat_rpt_78_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src);
+int ftstat_rpt_78_save(struct ftstat_rpt *rpt, FILE *fp);
+int ftstat_rpt_78_load(struct ftstat_rpt *rpt, FILE *fp);
 int ftstat_rpt_78_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt);
 void ftstat_rpt_78_free(struct ftstat_rpt_78 *rpt);
 
@@ -1849,6 +2369,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_1_new,
     (void*)ftstat_rpt_1_accum,
     (void*)ftstat_rpt_1_calc,
+    (void*)ftstat_rpt_1_merge,
+    (void*)ftstat_rpt_1_save,
+    (void*)ftstat_rpt_1_load,
     (void*)ftstat_rpt_1_dump,
     (void*)ftstat_rpt_1_free,
     FT_STAT_FIELD_OTHER|FT_STAT_FIELD_PS,
@@ -1859,6 +2382,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_2_new,
     (void*)ftstat_rpt_2_accum,
     (void*)ftstat_rpt_2_calc,
+    (void*)ftstat_rpt_2_merge,
+    (void*)ftstat_rpt_2_save,
+    (void*)ftstat_rpt_2_load,
     (void*)ftstat_rpt_2_dump,
     (void*)ftstat_rpt_2_free,
     FT_STAT_FIELD_PS,
@@ -1869,6 +2395,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_3_new,
     (void*)ftstat_rpt_3_accum,
     (void*)ftstat_rpt_3_calc,
+    (void*)ftstat_rpt_3_merge,
+    (void*)ftstat_rpt_3_save,
+    (void*)ftstat_rpt_3_load,
     (void*)ftstat_rpt_3_dump,
     (void*)ftstat_rpt_3_free,
     FT_STAT_FIELD_GENERIC,
@@ -1879,6 +2408,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_4_new,
     (void*)ftstat_rpt_4_accum,
     (void*)ftstat_rpt_4_calc,
+    (void*)ftstat_rpt_4_merge,
+    (void*)ftstat_rpt_4_save,
+    (void*)ftstat_rpt_4_load,
     (void*)ftstat_rpt_4_dump,
     (void*)ftstat_rpt_4_free,
     FT_STAT_FIELD_GENERIC,
@@ -1889,6 +2421,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_5_new,
     (void*)ftstat_rpt_5_accum,
     (void*)ftstat_rpt_5_calc,
+    (void*)ftstat_rpt_5_merge,
+    (void*)ftstat_rpt_5_save,
+    (void*)ftstat_rpt_5_load,
     (void*)ftstat_rpt_5_dump,
     (void*)ftstat_rpt_5_free,
     FT_STAT_FIELD_GENERIC,
@@ -1899,6 +2434,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_6_new,
     (void*)ftstat_rpt_6_accum,
     (void*)ftstat_rpt_6_calc,
+    (void*)ftstat_rpt_6_merge,
+    (void*)ftstat_rpt_6_save,
+    (void*)ftstat_rpt_6_load,
     (void*)ftstat_rpt_6_dump,
     (void*)ftstat_rpt_6_free,
     FT_STAT_FIELD_GENERIC,
@@ -1909,6 +2447,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_7_new,
     (void*)ftstat_rpt_7_accum,
     (void*)ftstat_rpt_7_calc,
+    (void*)ftstat_rpt_7_merge,
+    (void*)ftstat_rpt_7_save,
+    (void*)ftstat_rpt_7_load,
     (void*)ftstat_rpt_7_dump,
     (void*)ftstat_rpt_7_free,
     FT_STAT_FIELD_GENERIC,
@@ -1919,6 +2460,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_8_new,
     (void*)ftstat_rpt_8_accum,
     (void*)ftstat_rpt_8_calc,
+    (void*)ftstat_rpt_8_merge,
+    (void*)ftstat_rpt_8_save,
+    (void*)ftstat_rpt_8_load,
     (void*)ftstat_rpt_8_dump,
     (void*)ftstat_rpt_8_free,
     FT_STAT_FIELD_GENERIC2,
@@ -1930,6 +2474,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_9_new,
     (void*)ftstat_rpt_9_accum,
     (void*)ftstat_rpt_9_calc,
+    (void*)ftstat_rpt_9_merge,
+    (void*)ftstat_rpt_9_save,
+    (void*)ftstat_rpt_9_load,
     (void*)ftstat_rpt_9_dump,
     (void*)ftstat_rpt_9_free,
     FT_STAT_FIELD_GENERIC,
@@ -1940,6 +2487,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_10_new,
     (void*)ftstat_rpt_10_accum,
     (void*)ftstat_rpt_10_calc,
+    (void*)ftstat_rpt_10_merge,
+    (void*)ftstat_rpt_10_save,
+    (void*)ftstat_rpt_10_load,
     (void*)ftstat_rpt_10_dump,
     (void*)ftstat_rpt_10_free,
     FT_STAT_FIELD_GENERIC,
@@ -1950,6 +2500,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_11_new,
     (void*)ftstat_rpt_11_accum,
     (void*)ftstat_rpt_11_calc,
+    (void*)ftstat_rpt_11_merge,
+    (void*)ftstat_rpt_11_save,
+    (void*)ftstat_rpt_11_load,
     (void*)ftstat_rpt_11_dump,
     (void*)ftstat_rpt_11_free,
     FT_STAT_FIELD_GENERIC,
@@ -1960,6 +2513,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_12_new,
     (void*)ftstat_rpt_12_accum,
     (void*)ftstat_rpt_12_calc,
+    (void*)ftstat_rpt_12_merge,
+    (void*)ftstat_rpt_12_save,
+    (void*)ftstat_rpt_12_load,
     (void*)ftstat_rpt_12_dump,
     (void*)ftstat_rpt_12_free,
     FT_STAT_FIELD_GENERIC,
@@ -1970,6 +2526,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_13_new,
     (void*)ftstat_rpt_13_accum,
     (void*)ftstat_rpt_13_calc,
+    (void*)ftstat_rpt_13_merge,
+    (void*)ftstat_rpt_13_save,
+    (void*)ftstat_rpt_13_load,
     (void*)ftstat_rpt_13_dump,
     (void*)ftstat_rpt_13_free,
     FT_STAT_FIELD_GENERIC,
@@ -1980,6 +2539,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_14_new,
     (void*)ftstat_rpt_14_accum,
     (void*)ftstat_rpt_14_calc,
+    (void*)ftstat_rpt_14_merge,
+    (void*)ftstat_rpt_14_save,
+    (void*)ftstat_rpt_14_load,
     (void*)ftstat_rpt_14_dump,
     (void*)ftstat_rpt_14_free,
     FT_STAT_FIELD_GENERIC,
@@ -1990,6 +2552,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_15_new,
     (void*)ftstat_rpt_15_accum,
     (void*)ftstat_rpt_15_calc,
+    (void*)ftstat_rpt_15_merge,
+    (void*)ftstat_rpt_15_save,
+    (void*)ftstat_rpt_15_load,
     (void*)ftstat_rpt_15_dump,
     (void*)ftstat_rpt_15_free,
     FT_STAT_FIELD_GENERIC,
@@ -2000,6 +2565,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_16_new,
     (void*)ftstat_rpt_16_accum,
     (void*)ftstat_rpt_16_calc,
+    (void*)ftstat_rpt_16_merge,
+    (void*)ftstat_rpt_16_save,
+    (void*)ftstat_rpt_16_load,
     (void*)ftstat_rpt_16_dump,
     (void*)ftstat_rpt_16_free,
     FT_STAT_FIELD_GENERIC,
@@ -2010,6 +2578,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_17_new,
     (void*)ftstat_rpt_17_accum,
     (void*)ftstat_rpt_17_calc,
+    (void*)ftstat_rpt_17_merge,
+    (void*)ftstat_rpt_17_save,
+    (void*)ftstat_rpt_17_load,
     (void*)ftstat_rpt_17_dump,
     (void*)ftstat_rpt_17_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2021,6 +2592,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_18_new,
     (void*)ftstat_rpt_18_accum,
     (void*)ftstat_rpt_18_calc,
+    (void*)ftstat_rpt_18_merge,
+    (void*)ftstat_rpt_18_save,
+    (void*)ftstat_rpt_18_load,
     (void*)ftstat_rpt_18_dump,
     (void*)ftstat_rpt_18_free,
     FT_STAT_FIELD_GENERIC,
@@ -2031,6 +2605,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_19_new,
     (void*)ftstat_rpt_19_accum,
     (void*)ftstat_rpt_19_calc,
+    (void*)ftstat_rpt_19_merge,
+    (void*)ftstat_rpt_19_save,
+    (void*)ftstat_rpt_19_load,
     (void*)ftstat_rpt_19_dump,
     (void*)ftstat_rpt_19_free,
     FT_STAT_FIELD_GENERIC,
@@ -2041,6 +2618,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_20_new,
     (void*)ftstat_rpt_20_accum,
     (void*)ftstat_rpt_20_calc,
+    (void*)ftstat_rpt_20_merge,
+    (void*)ftstat_rpt_20_save,
+    (void*)ftstat_rpt_20_load,
     (void*)ftstat_rpt_20_dump,
     (void*)ftstat_rpt_20_free,
     FT_STAT_FIELD_GENERIC,
@@ -2051,6 +2631,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_21_new,
     (void*)ftstat_rpt_21_accum,
     (void*)ftstat_rpt_21_calc,
+    (void*)ftstat_rpt_21_merge,
+    (void*)ftstat_rpt_21_save,
+    (void*)ftstat_rpt_21_load,
     (void*)ftstat_rpt_21_dump,
     (void*)ftstat_rpt_21_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2062,6 +2645,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_22_new,
     (void*)ftstat_rpt_22_accum,
     (void*)ftstat_rpt_22_calc,
+    (void*)ftstat_rpt_22_merge,
+    (void*)ftstat_rpt_22_save,
+    (void*)ftstat_rpt_22_load,
     (void*)ftstat_rpt_22_dump,
     (void*)ftstat_rpt_22_free,
     FT_STAT_FIELD_GENERIC,
@@ -2072,6 +2658,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_23_new,
     (void*)ftstat_rpt_23_accum,
     (void*)ftstat_rpt_23_calc,
+    (void*)ftstat_rpt_23_merge,
+    (void*)ftstat_rpt_23_save,
+    (void*)ftstat_rpt_23_load,
     (void*)ftstat_rpt_23_dump,
     (void*)ftstat_rpt_23_free,
     FT_STAT_FIELD_GENERIC,
@@ -2082,6 +2671,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_24_new,
     (void*)ftstat_rpt_24_accum,
     (void*)ftstat_rpt_24_calc,
+    (void*)ftstat_rpt_24_merge,
+    (void*)ftstat_rpt_24_save,
+    (void*)ftstat_rpt_24_load,
     (void*)ftstat_rpt_24_dump,
     (void*)ftstat_rpt_24_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2093,6 +2685,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_25_new,
     (void*)ftstat_rpt_25_accum,
     (void*)ftstat_rpt_25_calc,
+    (void*)ftstat_rpt_25_merge,
+    (void*)ftstat_rpt_25_save,
+    (void*)ftstat_rpt_25_load,
     (void*)ftstat_rpt_25_dump,
     (void*)ftstat_rpt_25_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2104,6 +2699,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_26_new,
     (void*)ftstat_rpt_26_accum,
     (void*)ftstat_rpt_26_calc,
+    (void*)ftstat_rpt_26_merge,
+    (void*)ftstat_rpt_26_save,
+    (void*)ftstat_rpt_26_load,
     (void*)ftstat_rpt_26_dump,
     (void*)ftstat_rpt_26_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2115,6 +2713,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_27_new,
     (void*)ftstat_rpt_27_accum,
     (void*)ftstat_rpt_27_calc,
+    (void*)ftstat_rpt_27_merge,
+    (void*)ftstat_rpt_27_save,
+    (void*)ftstat_rpt_27_load,
     (void*)ftstat_rpt_27_dump,
     (void*)ftstat_rpt_27_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2126,6 +2727,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_28_new,
     (void*)ftstat_rpt_28_accum,
     (void*)ftstat_rpt_28_calc,
+    (void*)ftstat_rpt_28_merge,
+    (void*)ftstat_rpt_28_save,
+    (void*)ftstat_rpt_28_load,
     (void*)ftstat_rpt_28_dump,
     (void*)ftstat_rpt_28_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2137,6 +2741,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_29_new,
     (void*)ftstat_rpt_29_accum,
     (void*)ftstat_rpt_29_calc,
+    (void*)ftstat_rpt_29_merge,
+    (void*)ftstat_rpt_29_save,
+    (void*)ftstat_rpt_29_load,
     (void*)ftstat_rpt_29_dump,
     (void*)ftstat_rpt_29_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2148,6 +2755,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_30_new,
     (void*)ftstat_rpt_30_accum,
     (void*)ftstat_rpt_30_calc,
+    (void*)ftstat_rpt_30_merge,
+    (void*)ftstat_rpt_30_save,
+    (void*)ftstat_rpt_30_load,
     (void*)ftstat_rpt_30_dump,
     (void*)ftstat_rpt_30_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2159,6 +2769,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_31_new,
     (void*)ftstat_rpt_31_accum,
     (void*)ftstat_rpt_31_calc,
+    (void*)ftstat_rpt_31_merge,
+    (void*)ftstat_rpt_31_save,
+    (void*)ftstat_rpt_31_load,
     (void*)ftstat_rpt_31_dump,
     (void*)ftstat_rpt_31_free,
     FT_STAT_FIELD_GENERIC4,
@@ -2170,6 +2783,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_32_new,
     (void*)ftstat_rpt_32_accum,
     (void*)ftstat_rpt_32_calc,
+    (void*)ftstat_rpt_32_merge,
+    (void*)ftstat_rpt_32_save,
+    (void*)ftstat_rpt_32_load,
     (void*)ftstat_rpt_32_dump,
     (void*)ftstat_rpt_32_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2181,6 +2797,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_33_new,
     (void*)ftstat_rpt_33_accum,
     (void*)ftstat_rpt_33_calc,
+    (void*)ftstat_rpt_33_merge,
+    (void*)ftstat_rpt_33_save,
+    (void*)ftstat_rpt_33_load,
     (void*)ftstat_rpt_33_dump,
     (void*)ftstat_rpt_33_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2192,6 +2811,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_34_new,
     (void*)ftstat_rpt_34_accum,
     (void*)ftstat_rpt_34_calc,
+    (void*)ftstat_rpt_34_merge,
+    (void*)ftstat_rpt_34_save,
+    (void*)ftstat_rpt_34_load,
     (void*)ftstat_rpt_34_dump,
     (void*)ftstat_rpt_34_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2203,6 +2825,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_35_new,
     (void*)ftstat_rpt_35_accum,
     (void*)ftstat_rpt_35_calc,
+    (void*)ftstat_rpt_35_merge,
+    (void*)ftstat_rpt_35_save,
+    (void*)ftstat_rpt_35_load,
     (void*)ftstat_rpt_35_dump,
     (void*)ftstat_rpt_35_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2214,6 +2839,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_36_new,
     (void*)ftstat_rpt_36_accum,
     (void*)ftstat_rpt_36_calc,
+    (void*)ftstat_rpt_36_merge,
+    (void*)ftstat_rpt_36_save,
+    (void*)ftstat_rpt_36_load,
     (void*)ftstat_rpt_36_dump,
     (void*)ftstat_rpt_36_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2225,6 +2853,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_37_new,
     (void*)ftstat_rpt_37_accum,
     (void*)ftstat_rpt_37_calc,
+    (void*)ftstat_rpt_37_merge,
+    (void*)ftstat_rpt_37_save,
+    (void*)ftstat_rpt_37_load,
     (void*)ftstat_rpt_37_dump,
     (void*)ftstat_rpt_37_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2236,6 +2867,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_38_new,
     (void*)ftstat_rpt_38_accum,
     (void*)ftstat_rpt_38_calc,
+    (void*)ftstat_rpt_38_merge,
+    (void*)ftstat_rpt_38_save,
+    (void*)ftstat_rpt_38_load,
     (void*)ftstat_rpt_38_dump,
     (void*)ftstat_rpt_38_free,
     FT_STAT_FIELD_GENERIC4,
@@ -2247,6 +2881,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_39_new,
     (void*)ftstat_rpt_39_accum,
     (void*)ftstat_rpt_39_calc,
+    (void*)ftstat_rpt_39_merge,
+    (void*)ftstat_rpt_39_save,
+    (void*)ftstat_rpt_39_load,
     (void*)ftstat_rpt_39_dump,
     (void*)ftstat_rpt_39_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2258,6 +2895,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_40_new,
     (void*)ftstat_rpt_40_accum,
     (void*)ftstat_rpt_40_calc,
+    (void*)ftstat_rpt_40_merge,
+    (void*)ftstat_rpt_40_save,
+    (void*)ftstat_rpt_40_load,
     (void*)ftstat_rpt_40_dump,
     (void*)ftstat_rpt_40_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2269,6 +2909,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_41_new,
     (void*)ftstat_rpt_41_accum,
     (void*)ftstat_rpt_41_calc,
+    (void*)ftstat_rpt_41_merge,
+    (void*)ftstat_rpt_41_save,
+    (void*)ftstat_rpt_41_load,
     (void*)ftstat_rpt_41_dump,
     (void*)ftstat_rpt_41_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2280,6 +2923,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_42_new,
     (void*)ftstat_rpt_42_accum,
     (void*)ftstat_rpt_42_calc,
+    (void*)ftstat_rpt_42_merge,
+    (void*)ftstat_rpt_42_save,
+    (void*)ftstat_rpt_42_load,
     (void*)ftstat_rpt_42_dump,
     (void*)ftstat_rpt_42_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2291,6 +2937,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_43_new,
     (void*)ftstat_rpt_43_accum,
     (void*)ftstat_rpt_43_calc,
+    (void*)ftstat_rpt_43_merge,
+    (void*)ftstat_rpt_43_save,
+    (void*)ftstat_rpt_43_load,
     (void*)ftstat_rpt_43_dump,
     (void*)ftstat_rpt_43_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2302,6 +2951,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_44_new,
     (void*)ftstat_rpt_44_accum,
     (void*)ftstat_rpt_44_calc,
+    (void*)ftstat_rpt_44_merge,
+    (void*)ftstat_rpt_44_save,
+    (void*)ftstat_rpt_44_load,
     (void*)ftstat_rpt_44_dump,
     (void*)ftstat_rpt_44_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2313,6 +2965,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_45_new,
     (void*)ftstat_rpt_45_accum,
     (void*)ftstat_rpt_45_calc,
+    (void*)ftstat_rpt_45_merge,
+    (void*)ftstat_rpt_45_save,
+    (void*)ftstat_rpt_45_load,
     (void*)ftstat_rpt_45_dump,
     (void*)ftstat_rpt_45_free,
     FT_STAT_FIELD_GENERIC4,
@@ -2324,6 +2979,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_46_new,
     (void*)ftstat_rpt_46_accum,
     (void*)ftstat_rpt_46_calc,
+    (void*)ftstat_rpt_46_merge,
+    (void*)ftstat_rpt_46_save,
+    (void*)ftstat_rpt_46_load,
     (void*)ftstat_rpt_46_dump,
     (void*)ftstat_rpt_46_free,
     FT_STAT_FIELD_GENERIC,
@@ -2334,6 +2992,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_47_new,
     (void*)ftstat_rpt_47_accum,
     (void*)ftstat_rpt_47_calc,
+    (void*)ftstat_rpt_47_merge,
+    (void*)ftstat_rpt_47_save,
+    (void*)ftstat_rpt_47_load,
     (void*)ftstat_rpt_47_dump,
     (void*)ftstat_rpt_47_free,
     FT_STAT_FIELD_GENERIC,
@@ -2344,6 +3005,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_48_new,
     (void*)ftstat_rpt_48_accum,
     (void*)ftstat_rpt_48_calc,
+    (void*)ftstat_rpt_48_merge,
+    (void*)ftstat_rpt_48_save,
+    (void*)ftstat_rpt_48_load,
     (void*)ftstat_rpt_48_dump,
     (void*)ftstat_rpt_48_free,
     FT_STAT_FIELD_GENERIC,
@@ -2354,6 +3018,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_49_new,
     (void*)ftstat_rpt_49_accum,
     (void*)ftstat_rpt_49_calc,
+    (void*)ftstat_rpt_49_merge,
+    (void*)ftstat_rpt_49_save,
+    (void*)ftstat_rpt_49_load,
     (void*)ftstat_rpt_49_dump,
     (void*)ftstat_rpt_49_free,
     FT_STAT_FIELD_GENERIC,
@@ -2364,6 +3031,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_50_new,
     (void*)ftstat_rpt_50_accum,
     (void*)ftstat_rpt_50_calc,
+    (void*)ftstat_rpt_50_merge,
+    (void*)ftstat_rpt_50_save,
+    (void*)ftstat_rpt_50_load,
     (void*)ftstat_rpt_50_dump,
     (void*)ftstat_rpt_50_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2375,6 +3045,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_51_new,
     (void*)ftstat_rpt_51_accum,
     (void*)ftstat_rpt_51_calc,
+    (void*)ftstat_rpt_51_merge,
+    (void*)ftstat_rpt_51_save,
+    (void*)ftstat_rpt_51_load,
     (void*)ftstat_rpt_51_dump,
     (void*)ftstat_rpt_51_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2386,6 +3059,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_52_new,
     (void*)ftstat_rpt_52_accum,
     (void*)ftstat_rpt_52_calc,
+    (void*)ftstat_rpt_52_merge,
+    (void*)ftstat_rpt_52_save,
+    (void*)ftstat_rpt_52_load,
     (void*)ftstat_rpt_52_dump,
     (void*)ftstat_rpt_52_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2397,6 +3073,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_53_new,
     (void*)ftstat_rpt_53_accum,
     (void*)ftstat_rpt_53_calc,
+    (void*)ftstat_rpt_53_merge,
+    (void*)ftstat_rpt_53_save,
+    (void*)ftstat_rpt_53_load,
     (void*)ftstat_rpt_53_dump,
     (void*)ftstat_rpt_53_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2408,6 +3087,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_54_new,
     (void*)ftstat_rpt_54_accum,
     (void*)ftstat_rpt_54_calc,
+    (void*)ftstat_rpt_54_merge,
+    (void*)ftstat_rpt_54_save,
+    (void*)ftstat_rpt_54_load,
     (void*)ftstat_rpt_54_dump,
     (void*)ftstat_rpt_54_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2419,6 +3101,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_55_new,
     (void*)ftstat_rpt_55_accum,
     (void*)ftstat_rpt_55_calc,
+    (void*)ftstat_rpt_55_merge,
+    (void*)ftstat_rpt_55_save,
+    (void*)ftstat_rpt_55_load,
     (void*)ftstat_rpt_55_dump,
     (void*)ftstat_rpt_55_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2430,6 +3115,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_56_new,
     (void*)ftstat_rpt_56_accum,
     (void*)ftstat_rpt_56_calc,
+    (void*)ftstat_rpt_56_merge,
+    (void*)ftstat_rpt_56_save,
+    (void*)ftstat_rpt_56_load,
     (void*)ftstat_rpt_56_dump,
     (void*)ftstat_rpt_56_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2441,6 +3129,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_57_new,
     (void*)ftstat_rpt_57_accum,
     (void*)ftstat_rpt_57_calc,
+    (void*)ftstat_rpt_57_merge,
+    (void*)ftstat_rpt_57_save,
+    (void*)ftstat_rpt_57_load,
     (void*)ftstat_rpt_57_dump,
     (void*)ftstat_rpt_57_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2452,6 +3143,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_58_new,
     (void*)ftstat_rpt_58_accum,
     (void*)ftstat_rpt_58_calc,
+    (void*)ftstat_rpt_58_merge,
+    (void*)ftstat_rpt_58_save,
+    (void*)ftstat_rpt_58_load,
     (void*)ftstat_rpt_58_dump,
     (void*)ftstat_rpt_58_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2463,6 +3157,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_59_new,
     (void*)ftstat_rpt_59_accum,
     (void*)ftstat_rpt_59_calc,
+    (void*)ftstat_rpt_59_merge,
+    (void*)ftstat_rpt_59_save,
+    (void*)ftstat_rpt_59_load,
     (void*)ftstat_rpt_59_dump,
     (void*)ftstat_rpt_59_free,
     FT_STAT_FIELD_GENERIC4,
@@ -2474,6 +3171,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_60_new,
     (void*)ftstat_rpt_60_accum,
     (void*)ftstat_rpt_60_calc,
+    (void*)ftstat_rpt_60_merge,
+    (void*)ftstat_rpt_60_save,
+    (void*)ftstat_rpt_60_load,
     (void*)ftstat_rpt_60_dump,
     (void*)ftstat_rpt_60_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2485,6 +3185,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_61_new,
     (void*)ftstat_rpt_61_accum,
     (void*)ftstat_rpt_61_calc,
+    (void*)ftstat_rpt_61_merge,
+    (void*)ftstat_rpt_61_save,
+    (void*)ftstat_rpt_61_load,
     (void*)ftstat_rpt_61_dump,
     (void*)ftstat_rpt_61_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2496,6 +3199,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_62_new,
     (void*)ftstat_rpt_62_accum,
     (void*)ftstat_rpt_62_calc,
+    (void*)ftstat_rpt_62_merge,
+    (void*)ftstat_rpt_62_save,
+    (void*)ftstat_rpt_62_load,
     (void*)ftstat_rpt_62_dump,
     (void*)ftstat_rpt_62_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2507,6 +3213,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_63_new,
     (void*)ftstat_rpt_63_accum,
     (void*)ftstat_rpt_63_calc,
+    (void*)ftstat_rpt_63_merge,
+    (void*)ftstat_rpt_63_save,
+    (void*)ftstat_rpt_63_load,
     (void*)ftstat_rpt_63_dump,
     (void*)ftstat_rpt_63_free,
     FT_STAT_FIELD_GENERIC3,
@@ -2518,6 +3227,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_64_new,
     (void*)ftstat_rpt_64_accum,
     (void*)ftstat_rpt_64_calc,
+    (void*)ftstat_rpt_64_merge,
+    (void*)ftstat_rpt_64_save,
+    (void*)ftstat_rpt_64_load,
     (void*)ftstat_rpt_64_dump,
     (void*)ftstat_rpt_64_free,
     FT_STAT_FIELD_GENERIC,
@@ -2529,6 +3241,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_65_new,
     (void*)ftstat_rpt_65_accum,
     (void*)ftstat_rpt_65_calc,
+    (void*)ftstat_rpt_65_merge,
+    (void*)ftstat_rpt_65_save,
+    (void*)ftstat_rpt_65_load,
     (void*)ftstat_rpt_65_dump,
     (void*)ftstat_rpt_65_free,
     FT_STAT_FIELD_GENERIC,
@@ -2540,6 +3255,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_66_new,
     (void*)ftstat_rpt_66_accum,
     (void*)ftstat_rpt_66_calc,
+    (void*)ftstat_rpt_66_merge,
+    (void*)ftstat_rpt_66_save,
+    (void*)ftstat_rpt_66_load,
     (void*)ftstat_rpt_66_dump,
     (void*)ftstat_rpt_66_free,
     FT_STAT_FIELD_GENERIC|FT_STAT_FIELD_COUNT,
@@ -2551,6 +3269,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_67_new,
     (void*)ftstat_rpt_67_accum,
     (void*)ftstat_rpt_67_calc,
+    (void*)ftstat_rpt_67_merge,
+    (void*)ftstat_rpt_67_save,
+    (void*)ftstat_rpt_67_load,
     (void*)ftstat_rpt_67_dump,
     (void*)ftstat_rpt_67_free,
     FT_STAT_FIELD_GENERIC|FT_STAT_FIELD_COUNT,
@@ -2562,6 +3283,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_68_new,
     (void*)ftstat_rpt_68_accum,
     (void*)ftstat_rpt_68_calc,
+    (void*)ftstat_rpt_68_merge,
+    (void*)ftstat_rpt_68_save,
+    (void*)ftstat_rpt_68_load,
     (void*)ftstat_rpt_68_dump,
     (void*)ftstat_rpt_68_free,
     FT_STAT_FIELD_GENERIC6,
@@ -2574,6 +3298,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_69_new,
     (void*)ftstat_rpt_69_accum,
     (void*)ftstat_rpt_69_calc,
+    (void*)ftstat_rpt_69_merge,
+    (void*)ftstat_rpt_69_save,
+    (void*)ftstat_rpt_69_load,
     (void*)ftstat_rpt_69_dump,
     (void*)ftstat_rpt_69_free,
     FT_STAT_FIELD_GENERIC4,
@@ -2585,6 +3312,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_70_new,
     (void*)ftstat_rpt_70_accum,
     (void*)ftstat_rpt_70_calc,
+    (void*)ftstat_rpt_70_merge,
+    (void*)ftstat_rpt_70_save,
+    (void*)ftstat_rpt_70_load,
     (void*)ftstat_rpt_70_dump,
     (void*)ftstat_rpt_70_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2596,6 +3326,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_71_new,
     (void*)ftstat_rpt_71_accum,
     (void*)ftstat_rpt_71_calc,
+    (void*)ftstat_rpt_71_merge,
+    (void*)ftstat_rpt_71_save,
+    (void*)ftstat_rpt_71_load,
     (void*)ftstat_rpt_71_dump,
     (void*)ftstat_rpt_71_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2607,6 +3340,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_72_new,
     (void*)ftstat_rpt_72_accum,
     (void*)ftstat_rpt_72_calc,
+    (void*)ftstat_rpt_72_merge,
+    (void*)ftstat_rpt_72_save,
+    (void*)ftstat_rpt_72_load,
     (void*)ftstat_rpt_72_dump,
     (void*)ftstat_rpt_72_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2618,6 +3354,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_73_new,
     (void*)ftstat_rpt_73_accum,
     (void*)ftstat_rpt_73_calc,
+    (void*)ftstat_rpt_73_merge,
+    (void*)ftstat_rpt_73_save,
+    (void*)ftstat_rpt_73_load,
     (void*)ftstat_rpt_73_dump,
     (void*)ftstat_rpt_73_free,
     FT_STAT_FIELD_GENERIC2,
@@ -2629,6 +3368,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_74_new,
     (void*)ftstat_rpt_74_accum,
     (void*)ftstat_rpt_74_calc,
+    (void*)ftstat_rpt_74_merge,
+    (void*)ftstat_rpt_74_save,
+    (void*)ftstat_rpt_74_load,
     (void*)ftstat_rpt_74_dump,
     (void*)ftstat_rpt_74_free,
     FT_STAT_FIELD_GENERIC4,
@@ -2640,6 +3382,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_75_new,
     (void*)ftstat_rpt_75_accum,
     (void*)ftstat_rpt_75_calc,
+    (void*)ftstat_rpt_75_merge,
+    (void*)ftstat_rpt_75_save,
+    (void*)ftstat_rpt_75_load,
     (void*)ftstat_rpt_75_dump,
     (void*)ftstat_rpt_75_free,
     FT_STAT_FIELD_FLOWS|FT_STAT_FIELD_OCTETS|FT_STAT_FIELD_PACKETS|
@@ -2651,6 +3396,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_76_new,
     (void*)ftstat_rpt_76_accum,
     (void*)ftstat_rpt_76_calc,
+    (void*)ftstat_rpt_76_merge,
+    (void*)ftstat_rpt_76_save,
+    (void*)ftstat_rpt_76_load,
     (void*)ftstat_rpt_76_dump,
     (void*)ftstat_rpt_76_free,
     FT_STAT_FIELD_GENERIC,
@@ -2661,6 +3409,9 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_77_new,
     (void*)ftstat_rpt_77_accum,
     (void*)ftstat_rpt_77_calc,
+    (void*)ftstat_rpt_77_merge,
+    (void*)ftstat_rpt_77_save,
+    (void*)ftstat_rpt_77_load,
     (void*)ftstat_rpt_77_dump,
     (void*)ftstat_rpt_77_free,
     FT_STAT_FIELD_GENERIC,
@@ -2671,12 +3422,43 @@ struct typelookup tlookup[] = {
     (void*)ftstat_rpt_78_new,
     (void*)ftstat_rpt_78_accum,
     (void*)ftstat_rpt_78_calc,
+    (void*)ftstat_rpt_78_merge,
+    (void*)ftstat_rpt_78_save,
+    (void*)ftstat_rpt_78_load,
     (void*)ftstat_rpt_78_dump,
     (void*)ftstat_rpt_78_free,
     FT_STAT_FIELD_GENERIC,
     FT_STAT_OPT_GENERIC,
     FT_XFIELD_DPKTS|FT_XFIELD_DOCTETS|FT_XFIELD_FIRST|FT_XFIELD_LAST|
       FT_XFIELD_UNIX_SECS|FT_XFIELD_UNIX_NSECS},
+  {"ip-source-address-destination-count-approx",
+    (void*)ftstat_rpt_79_new,
+    (void*)ftstat_rpt_66_accum,
+    (void*)ftstat_rpt_66_calc,
+    (void*)ftstat_rpt_66_merge,
+    (void*)ftstat_rpt_66_save,
+    (void*)ftstat_rpt_66_load,
+    (void*)ftstat_rpt_66_dump,
+    (void*)ftstat_rpt_66_free,
+    FT_STAT_FIELD_GENERIC|FT_STAT_FIELD_COUNT,
+    FT_STAT_OPT_GENERIC_IP_ADDR,
+    FT_XFIELD_DPKTS|FT_XFIELD_DOCTETS|FT_XFIELD_FIRST|FT_XFIELD_LAST|
+      FT_XFIELD_UNIX_SECS|FT_XFIELD_UNIX_NSECS|FT_XFIELD_DSTADDR|
+      FT_XFIELD_SRCADDR},
+  {"ip-destination-address-source-count-approx",
+    (void*)ftstat_rpt_80_new,
+    (void*)ftstat_rpt_67_accum,
+    (void*)ftstat_rpt_67_calc,
+    (void*)ftstat_rpt_67_merge,
+    (void*)ftstat_rpt_67_save,
+    (void*)ftstat_rpt_67_load,
+    (void*)ftstat_rpt_67_dump,
+    (void*)ftstat_rpt_67_free,
+    FT_STAT_FIELD_GENERIC|FT_STAT_FIELD_COUNT,
+    FT_STAT_OPT_GENERIC_IP_ADDR,
+    FT_XFIELD_DPKTS|FT_XFIELD_DOCTETS|FT_XFIELD_FIRST|FT_XFIELD_LAST|
+      FT_XFIELD_UNIX_SECS|FT_XFIELD_UNIX_NSECS|FT_XFIELD_DSTADDR|
+      FT_XFIELD_SRCADDR},
 
   {(char*)0L, 0, (void*)0L},
 };
@@ -2690,6 +3472,9 @@ static struct jump pjump[] = {
           {"type", PARSE_STATE_REPORT, parse_rpt_type},
           {"filter", PARSE_STATE_REPORT, parse_rpt_filter},
           {"scale", PARSE_STATE_REPORT, parse_rpt_scale},
+          {"memory-limit", PARSE_STATE_REPORT, parse_rpt_memory_limit},
+          {"count-estimate", PARSE_STATE_REPORT, parse_rpt_count_estimate},
+          {"heavy-hitters", PARSE_STATE_REPORT, parse_rpt_heavy_hitters},
           {"output", PARSE_STATE_REPORT, parse_rpt_output},
           {"tag-mask", PARSE_STATE_REPORT, parse_rpt_tag_mask},
           {"ip-source-address-format", PARSE_STATE_REPORT,
@@ -2710,6 +3495,7 @@ static struct jump pjump[] = {
           {"mask", PARSE_STATE_DEFINITION, parse_def_mask},
           {"report", PARSE_STATE_DEFINITION, parse_def_report},
           {"time-series", PARSE_STATE_DEFINITION, parse_def_time_series},
+          {"window", PARSE_STATE_DEFINITION, parse_def_window},
           {0, 0, 0},
           };
 
@@ -2983,6 +3769,92 @@ int ftstat_def_test_xfields(struct ftstat_def *active_def, uint64_t test)
 
 } /* ftstat_def_test_xfields */
 
+/*
+ * function: ftstat_def_test_rollup
+ *
+ * Check if active_def can be answered from the records of rollup files
+ * with the dimensions xfields.  Each report must be keyed on those
+ * dimensions only and not show per flow values (pps, bps, quantiles,
+ * flow records), filters may only test the dimensions.
+ * Tags, masks and time series are per flow too.
+ *
+ * returns: 0 okay
+ *          1 fail
+ */
+int ftstat_def_test_rollup(struct ftstat_def *active_def, uint64_t xfields)
+{
+  struct ftstat_rpt *ftsrpt;
+  struct ftstat_rpt_item *ftsrpti;
+  uint64_t key, fil;
+
+  if (active_def->ftd || active_def->ftmd || active_def->max_time ||
+      active_def->window)
+    return 1;
+
+  /* row counters are sums, a filter on them would not see the flows */
+  fil = xfields;
+
+  if (active_def->ftfd && ftfil_def_test_xfields(active_def->ftfd, fil))
+    return 1;
+
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
+
+    ftsrpt = ftsrpti->rpt;
+
+    key = ftsrpt->xfields & ~FT_ROLLUP_XFIELDS_REC;
+
+    if (!key || (key & ~xfields))
+      return 1;
+
+    if (ftsrpt->all_fields & (FT_STAT_FIELD_PS|FT_STAT_FIELD_QUANT|
+      FT_STAT_FIELD_FRECS))
+      return 1;
+
+    if (ftsrpt->ftfd && ftfil_def_test_xfields(ftsrpt->ftfd, fil))
+      return 1;
+
+  }
+
+  return 0;
+
+} /* ftstat_def_test_rollup */
+
+/*
+ * function: ftstat_def_need_xfields
+ *
+ * Flow fields read while accumulating active_def: its reports, the
+ * filters, the mask and the per flow values.  Tags may read any field.
+ *
+ * returns: FT_XFIELD_* mask
+ */
+uint64_t ftstat_def_need_xfields(struct ftstat_def *active_def)
+{
+  struct ftstat_rpt_item *ftsrpti;
+  uint64_t need;
+
+  if (active_def->ftd)
+    return ~(uint64_t)0;
+
+  /* flow_get(), First and Last are relative to the ftltime() base */
+  need = active_def->xfields | FT_XFIELD_UNIX_SECS | FT_XFIELD_UNIX_NSECS |
+    FT_XFIELD_SYSUPTIME | FT_XFIELD_FIRST | FT_XFIELD_LAST |
+    FT_XFIELD_DPKTS | FT_XFIELD_DOCTETS | FT_XFIELD_DFLOWS;
+
+  if (active_def->ftfd)
+    need |= active_def->ftfd->xfields;
+
+  if (active_def->ftmd)
+    need |= FT_XFIELD_SRCADDR | FT_XFIELD_DSTADDR | FT_XFIELD_SRC_MASK |
+      FT_XFIELD_DST_MASK;
+
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain)
+    if (ftsrpti->rpt->ftfd)
+      need |= ftsrpti->rpt->ftfd->xfields;
+
+  return need;
+
+} /* ftstat_def_need_xfields */
+
 /*
  * function: ftstat_def_new
  *
@@ -3016,6 +3888,11 @@ int ftstat_def_new(struct ftstat_def *active_def)
     ftsrpt->time_start = 0xFFFFFFFF;
     ftsrpt->time_end = 0;
     ftsrpt->recs = 0;
+    ftsrpt->spill_runs = 0;
+    ftsrpt->spill_recs = 0;
+    ftsrpt->merge_recs = 0;
+    ftsrpt->heavy_evictions = 0;
+    ftsrpt->heavy_error = 0;
     ftsrpt->avg_pps = 0;
     ftsrpt->avg_bps = 0;
     ftsrpt->max_pps = 0;
@@ -3048,70 +3925,229 @@ out:
 } /* ftstat_def_new */
 
 /*
- * function: ftstat_def_accum
+ * function: ftstat_def_split
  *
- * Call the accum method for each report.
+ * Check if a flow exported at unix_secs starts a new time series
+ * interval.  The interval start is updated when it does.  Callers
+ * that split the input themselves can use this to find the interval
+ * boundaries ftstat_def_accum() would.
  *
- * returns: 0 okay
- *          <0 fail
- *          1 next report.
+ * returns: 0 same interval
+ *          1 new interval
  */
-int ftstat_def_accum(struct ftstat_def *active_def,
-  char *rec, struct fts3rec_offsets *fo)
+int ftstat_def_split(struct ftstat_def *active_def, uint32_t unix_secs)
 {
-  struct ftver ftv;
-  struct ftstat_rpt *ftsrpt;
-  struct ftstat_rpt_item *ftsrpti;
-  struct fts3rec_all2 cur;
-  char xl_rec[FT_IO_MAXREC];
-  int ret;
-
-  FT_RECGET_UNIX_SECS(cur,rec,*fo);
 
   if (!active_def->start_time)
-    active_def->start_time = cur.unix_secs;
+    active_def->start_time = unix_secs;
 
-  /* time series split? */
-  if ((active_def->max_time && (cur.unix_secs > active_def->start_time) &&
-    (cur.unix_secs - active_def->start_time) > active_def->max_time)) {
+  if ((active_def->max_time && (unix_secs > active_def->start_time) &&
+    (unix_secs - active_def->start_time) > active_def->max_time)) {
 
-    active_def->start_time = cur.unix_secs;
+    active_def->start_time = unix_secs;
     return 1;
 
   }
 
-  ret = -1; /* err */
+  return 0;
 
-  /* if mask replacement is enabled, do it */
-  if (active_def->ftmd)
-    ftmask_def_eval(active_def->ftmd, rec, fo);
+} /* ftstat_def_split */
 
-  /* if tagging is enabled, translate and tag */
-  if (active_def->ftd) {
+/*
+ * function: ftstat_def_window
+ *
+ * Check if the wall clock time now ends the current step of a window
+ * definition.  Steps are slide seconds aligned to the epoch, the first
+ * call starts the step now is in.  Steps more than a window in the past
+ * are skipped, the windows ending in them hold no flows.  On 1
+ * window_end is the end of the window to report, callers emit it, add
+ * slide to window_end and loop while this returns 1.
+ *
+ * returns: 0 same step
+ *          1 step ended
+ */
+int ftstat_def_window(struct ftstat_def *active_def, uint32_t now)
+{
+  uint32_t last;
 
-    /* translate to 1005 is not allready */
-    if (fo->ftv.d_version != 1005) {
+  if (!active_def->slide)
+    return 0;
 
-      ftv.d_version = 1005;
-      ftrec_xlate(rec, &fo->ftv, &xl_rec, &ftv);
-      rec = (char*)&xl_rec;
-      fo = &nfo;
+  if (!active_def->window_end) {
+    active_def->window_end = now - (now % active_def->slide) +
+      active_def->slide;
+    return 0;
+  }
 
-    }
+  if (now < active_def->window_end)
+    return 0;
 
-    fttag_def_eval(active_def->ftd, (void*)rec);
+  last = now - (now % active_def->slide);
 
-  }
-  
-  /* if a filter is defined, evaluate it first */
-  if (active_def->ftfd)
-    if (ftfil_def_eval(active_def->ftfd, rec, fo) == FT_FIL_MODE_DENY)
-      goto done;
+  if ((last - active_def->window_end) > active_def->window)
+    active_def->window_end = last - active_def->window;
 
-  /* foreach report in the definition */
-  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
+  return 1;
 
-    ftsrpt = ftsrpti->rpt;
+} /* ftstat_def_window */
+
+/*
+ * function: ftstat_def_accum
+ *
+ * Call the accum method for each report.  The mask and tag of the
+ * definition are applied to rec in place.
+ *
+ * returns: 0 okay
+ *          <0 fail
+ *          1 next report.
+ */
+int ftstat_def_accum(struct ftstat_def *active_def,
+  char *rec, struct fts3rec_offsets *fo)
+{
+
+  return ftstat_def_accum_xrec(active_def, rec, fo, (struct ftstat_xrec*)0L);
+
+} /* ftstat_def_accum */
+
+/*
+ * function: ftstat_xrec_reset
+ *
+ * Forget the masked/tagged flow, call before passing the next flow
+ * to ftstat_def_accum_xrec().
+ */
+void ftstat_xrec_reset(struct ftstat_xrec *xr)
+{
+
+  xr->rec = (char*)0L;
+  xr->ftfd = (struct ftfil_def*)0L;
+
+} /* ftstat_xrec_reset */
+
+/*
+ * function: ftstat_def_accum_xrec
+ *
+ * ftstat_def_accum() for evaluating one flow with several definitions.
+ * rec is not modified, the mask and tag are applied to a copy in xr
+ * which is reused by the next definition with the same mask and tag.
+ * The result of the definition filter is reused the same way.  With
+ * xr 0L this is ftstat_def_accum().
+ *
+ * returns: 0 okay
+ *          <0 fail
+ *          1 next report.
+ */
+int ftstat_def_accum_xrec(struct ftstat_def *active_def,
+  char *rec, struct fts3rec_offsets *fo, struct ftstat_xrec *xr)
+{
+  struct ftver ftv;
+  struct ftstat_rpt *ftsrpt;
+  struct ftstat_rpt_item *ftsrpti;
+  struct fts3rec_all2 cur;
+  struct ftstat_flow ff;
+  struct ftfil_def *fil_last;
+  char xl_rec[FT_IO_MAXREC];
+  int ret, fil_mode, fil_last_mode;
+
+  FT_RECGET_UNIX_SECS(cur,rec,*fo);
+
+  /* time series split? */
+  if (ftstat_def_split(active_def, cur.unix_secs))
+    return 1;
+
+  ret = -1; /* err */
+
+  if (xr) {
+
+    /* mask and tag a copy unless the last definition already did */
+    if (!xr->rec || (xr->ftmd != active_def->ftmd) ||
+        (xr->ftd != active_def->ftd)) {
+
+      xr->rec = rec;
+      xr->fo = fo;
+      xr->ftmd = active_def->ftmd;
+      xr->ftd = active_def->ftd;
+      xr->ftfd = (struct ftfil_def*)0L;
+
+      if (active_def->ftmd) {
+        bcopy(rec, xr->buf, ftrec_size(&fo->ftv));
+        xr->rec = xr->buf;
+        ftmask_def_eval(active_def->ftmd, xr->rec, fo);
+      }
+
+      if (active_def->ftd) {
+
+        ftv.d_version = 1005;
+
+        if (fo->ftv.d_version != 1005) {
+          ftrec_xlate(xr->rec, &fo->ftv, xr->xl_rec, &ftv);
+          xr->rec = xr->xl_rec;
+          xr->fo = &nfo;
+        } else if (xr->rec == rec) {
+          bcopy(rec, xr->buf, sizeof (struct fts3rec_v1005));
+          xr->rec = xr->buf;
+        }
+
+        fttag_def_eval(active_def->ftd, (void*)xr->rec);
+
+      }
+
+    }
+
+    rec = xr->rec;
+    fo = xr->fo;
+
+    if (active_def->ftfd) {
+
+      if (xr->ftfd != active_def->ftfd) {
+        xr->ftfd = active_def->ftfd;
+        xr->fil_mode = ftfil_def_eval(active_def->ftfd, rec, fo);
+      }
+
+      if (xr->fil_mode == FT_FIL_MODE_DENY)
+        goto done;
+
+    }
+
+  } else {
+
+    /* if mask replacement is enabled, do it */
+    if (active_def->ftmd)
+      ftmask_def_eval(active_def->ftmd, rec, fo);
+
+    /* if tagging is enabled, translate and tag */
+    if (active_def->ftd) {
+
+      /* translate to 1005 is not allready */
+      if (fo->ftv.d_version != 1005) {
+
+        ftv.d_version = 1005;
+        ftrec_xlate(rec, &fo->ftv, &xl_rec, &ftv);
+        rec = (char*)&xl_rec;
+        fo = &nfo;
+
+      }
+
+      fttag_def_eval(active_def->ftd, (void*)rec);
+
+    }
+
+    /* if a filter is defined, evaluate it first */
+    if (active_def->ftfd)
+      if (ftfil_def_eval(active_def->ftfd, rec, fo) == FT_FIL_MODE_DENY)
+        goto done;
+
+  }
+
+  /* counters and duration, shared by all reports */
+  flow_get(&ff, rec, fo);
+
+  fil_last = (struct ftfil_def*)0L;
+  fil_last_mode = 0;
+
+  /* foreach report in the definition */
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
+
+    ftsrpt = ftsrpti->rpt;
 
     /*
      * if the tag mask option is set apply the masks, not this can only
@@ -3129,13 +4165,29 @@ int ftstat_def_accum(struct ftstat_def *active_def,
 
     }
 
-    /* if a filter is defined, evaluate */
-    if (ftsrpt->ftfd)
-      if (ftfil_def_eval(ftsrpt->ftfd, rec, fo) == FT_FIL_MODE_DENY)
+    /*
+     * if a filter is defined, evaluate.  Reports sharing a filter
+     * reuse the result unless the tags were masked.
+     */
+    if (ftsrpt->ftfd) {
+
+      if (ftsrpt->options & FT_STAT_OPT_TAG_MASK) {
+        fil_mode = ftfil_def_eval(ftsrpt->ftfd, rec, fo);
+      } else if (ftsrpt->ftfd == fil_last) {
+        fil_mode = fil_last_mode;
+      } else {
+        fil_mode = ftfil_def_eval(ftsrpt->ftfd, rec, fo);
+        fil_last = ftsrpt->ftfd;
+        fil_last_mode = fil_mode;
+      }
+
+      if (fil_mode == FT_FIL_MODE_DENY)
         goto restore_tag;
 
+    }
+
     /* run the accum function */
-    if (ftsrpt->f_accum(ftsrpt, rec, fo)) {
+    if (ftsrpt->f_accum(ftsrpt, rec, fo, &ff)) {
       fterr_warnx("f_accum(%s): failed.", ftsrpt->name);
       goto out;
     }
@@ -3159,4948 +4211,9997 @@ out:
 
   return ret;
 
-} /* ftstat_def_accum */
+} /* ftstat_def_accum_xrec */
 
 /*
- * function: ftstat_def_calc
+ * function: ftstat_def_accum_batch
  *
- * Call the calc method for each report.
+ * ftstat_def_accum() for an array of *nrecs flows rec_size bytes
+ * apart.  The flows are taken FT_STAT_BATCH at a time and each stage
+ * runs over the batch: time series, the definition filter into a
+ * selection vector, the shared values, then each report's filter and
+ * accum over the selected flows.  The reports see the flows in the
+ * same order as with ftstat_def_accum().  Definitions with a mask or
+ * tag go through ftstat_def_accum() one flow at a time.
+ *
+ * On a time series split *nrecs is set to the flows accumulated
+ * before the one that started the next interval.
  *
  * returns: 0 okay
- *          1 fail
+ *          <0 fail
+ *          1 next report.
  */
-int ftstat_def_calc(struct ftstat_def *active_def)
+int ftstat_def_accum_batch(struct ftstat_def *active_def, char *recs,
+  int rec_size, uint32_t *nrecs, struct fts3rec_offsets *fo)
 {
+  struct ftstat_flow ff[FT_STAT_BATCH];
+  uint32_t sel[FT_STAT_BATCH], rsel[FT_STAT_BATCH];
   struct ftstat_rpt *ftsrpt;
   struct ftstat_rpt_item *ftsrpti;
-  int ret;
+  struct ftfil_def *fil_last;
+  struct fts3rec_all2 cur;
+  uint32_t i, j, n, m, nsel, nrsel, done;
+  char *rec, *base;
+  int ret, split;
 
-  ret = 1; /* err */
+  n = *nrecs;
 
-  /* foreach report in the definition */
-  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
+  /* masks and tags modify the flow, leave them to the per flow path */
+  if (active_def->ftmd || active_def->ftd) {
 
-    ftsrpt = ftsrpti->rpt;
+    for (i = 0, rec = recs; i < n; ++i, rec += rec_size)
+      if ((ret = ftstat_def_accum(active_def, rec, fo))) {
+        if (ret == 1)
+          *nrecs = i;
+        return ret;
+      }
 
-    /* run the new function */
-    if (ftsrpt->f_calc(ftsrpt)) {
-      fterr_warnx("f_calc(%s): failed.", ftsrpt->name);
-      goto out;
-    }
+    return 0;
 
   }
 
-  ret = 0;
+  for (done = 0; done < n; done += m) {
 
-out:
+    base = recs + done * rec_size;
+    m = ((n - done) < FT_STAT_BATCH) ? (n - done) : FT_STAT_BATCH;
+    split = 0;
 
-  return ret;
+    /* time series split? the batch ends before the flow */
+    for (i = 0, rec = base; i < m; ++i, rec += rec_size) {
 
-} /* ftstat_def_calc */
+      FT_RECGET_UNIX_SECS(cur,rec,*fo);
 
-/*
- * function: ftstat_def_dump
- *
- * Call the dump method for each report.
- *
- * returns: 0 okay
- *          1 fail
- */
-int ftstat_def_dump(struct ftio *ftio, struct ftstat_def *active_def)
-{
-  struct tm *tm;
-  time_t now;
-  FILE *fp;
-  struct ftstat_rpt *ftsrpt;
-  struct ftstat_rpt_item *ftsrpti;
-  struct ftstat_rpt_out *ftsro;
-  int ret, noclose, pipe, status;
-  char fmt_tmp[64], fmt_buf[1024], path_buf[1024], *path_run;
-  char *mode;
+      if (ftstat_def_split(active_def, cur.unix_secs)) {
+        m = i;
+        split = 1;
+        break;
+      }
 
-  noclose = 0; /* fclose fp */
-  ret = 1; /* err */
-  fp = (FILE*)0L;
+    }
 
-  /* foreach report in the definition */
-  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
+    /* definition filter, selection vector of flows permitted */
+    for (i = 0, nsel = 0, rec = base; i < m; ++i, rec += rec_size)
+      if (!active_def->ftfd ||
+          (ftfil_def_eval(active_def->ftfd, rec, fo) != FT_FIL_MODE_DENY))
+        sel[nsel++] = i;
 
-    ftsrpt = ftsrpti->rpt;
+    for (j = 0; j < nsel; ++j)
+      flow_get(&ff[j], base + sel[j] * rec_size, fo);
 
-    /* foreach output listed */
-    FT_STAILQ_FOREACH(ftsro, &ftsrpt->outs, chain) {
+    fil_last = (struct ftfil_def*)0L;
+    nrsel = 0;
 
-      /* current output is this one */
-      ftsrpt->out = ftsro;
+    FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
 
-      if (ftsro->path) {
+      ftsrpt = ftsrpti->rpt;
 
-        strncpy(fmt_buf, ftsro->path, sizeof(fmt_buf));
-        fmt_buf[sizeof(fmt_buf)-1] = 0;
+      /* tags are masked per flow, filter each flow after the mask */
+      if (ftsrpt->options & FT_STAT_OPT_TAG_MASK) {
 
-        if (ftsro->time == FT_STAT_TIME_NOW)
-          now = time((time_t*)0L);
-        else if (ftsro->time == FT_STAT_TIME_START)
-          now = ftsrpt->time_start;
-        else if (ftsro->time == FT_STAT_TIME_END)
-          now = ftsrpt->time_end;
-        else if (ftsro->time == FT_STAT_TIME_MID)
-          now = ftsrpt->time_start + (ftsrpt->time_end - ftsrpt->time_start)/2;
+        for (j = 0; j < nsel; ++j) {
 
-        tm = localtime(&now);
+          rec = base + sel[j] * rec_size;
 
-        if (!(strftime(path_buf, sizeof path_buf, fmt_buf, tm))) {
-          fterr_warnx("strftime(): failed");
-          goto out;
-        }
+          FT_RECGET_SRC_TAG(cur,rec,*fo);
+          FT_RECGET_DST_TAG(cur,rec,*fo);
 
-        if (path_buf[0] == '|') {
-          pipe = 1;
-          path_run = path_buf+1;
-        } else {
-          pipe = 0;
-          path_run = path_buf;
-        }
+          *((uint32_t*)(rec+(*fo).src_tag)) &= ftsrpt->tag_mask_src;
+          *((uint32_t*)(rec+(*fo).dst_tag)) &= ftsrpt->tag_mask_dst;
 
-        if (!pipe) {
+          ret = 0;
 
-          if (mkpath(path_run, 0755) < 0) {
-            fterr_warnx("mkpath(%s): failed", path_run);
-            goto out;
-          }
+          if (!ftsrpt->ftfd ||
+              (ftfil_def_eval(ftsrpt->ftfd, rec, fo) != FT_FIL_MODE_DENY))
+            ret = ftsrpt->f_accum(ftsrpt, rec, fo, &ff[j]) ? -1 : 0;
 
-          /* write first interval, append the rest */
-          if (!active_def->interval)
-            mode = "w";
-          else
-            mode = "a";
+          *((uint32_t*)(rec+(*fo).src_tag)) = cur.src_tag;
+          *((uint32_t*)(rec+(*fo).dst_tag)) = cur.dst_tag;
 
-          if (!(fp = fopen(path_run, mode))) {
-            fterr_warn("fopen(%s)", path_run);
-            goto out;
+          if (ret) {
+            fterr_warnx("f_accum(%s): failed.", ftsrpt->name);
+            return -1;
           }
 
-          noclose = 0;
-
-        } else { /* pipe */
+        }
 
-          if (!(fp = popen(path_run, "w"))) {
-            fterr_warn("popen(%s)", path_run);
-            goto out;
-          }
+        continue;
 
-          noclose = 0;
+      }
 
-        } /* !pipe */
+      if (!ftsrpt->ftfd) {
 
-      } else { /* path specified */
+        for (j = 0; j < nsel; ++j)
+          if (ftsrpt->f_accum(ftsrpt, base + sel[j] * rec_size, fo, &ff[j]))
+            goto accum_err;
 
-        fp = stdout;
-        pipe = 0;
-        noclose = 1;
+        continue;
 
       }
 
-      /* display header bits */
-      dump_ascii_header(fp, ftio, active_def, ftsrpt);
+      /* report filter, reused by the next report with the same one */
+      if (ftsrpt->ftfd != fil_last) {
+
+        for (j = 0, nrsel = 0; j < nsel; ++j)
+          if (ftfil_def_eval(ftsrpt->ftfd, base + sel[j] * rec_size, fo) !=
+              FT_FIL_MODE_DENY)
+            rsel[nrsel++] = j;
+
+        fil_last = ftsrpt->ftfd;
 
-      /* display totals? */
-      if (ftsro->options & FT_STAT_OPT_TOTALS) {
-        STD_DUMP_TOTALS_HEADER;
-        STD_DUMP_TOTALS_VAL;
       }
 
-      /* run the dump function */
-      if (ftsro->f_dump(fp, ftio, ftsrpt)) {
-        fterr_warnx("f_dump(%s): failed.", path_run);
-        goto out;
+      for (i = 0; i < nrsel; ++i) {
+        j = rsel[i];
+        if (ftsrpt->f_accum(ftsrpt, base + sel[j] * rec_size, fo, &ff[j]))
+          goto accum_err;
       }
 
-      if ((!noclose) && fp) {
+    } /* foreach report */
 
-        if (!pipe) {
-          if (fclose(fp))
-            fterr_warn("fclose(%s)", path_run);
-        } else {
-          status = pclose(fp);
-          if (status == -1)
-            fterr_warn("pclose(%s)", path_run);
-          if (WIFEXITED(status))
-             if (WEXITSTATUS(status) != 0)
-              fterr_warnx("pclose(%s): failed exit code=%d.", path_run,
-                WEXITSTATUS(status));
-        }
+    if (split) {
+      *nrecs = done + m;
+      return 1;
+    }
 
-      } /* !noclose && fp */
+  } /* foreach batch */
 
-    } /* foreach output */
+  return 0;
 
-  } /* foreach report */
+accum_err:
 
-  ret = 0;
+  fterr_warnx("f_accum(%s): failed.", ftsrpt->name);
+  return -1;
 
-out:
+} /* ftstat_def_accum_batch */
 
-  return ret;
+/*
+ * function: flow_get
+ *
+ * Extract the values of rec shared by all reports.
+ */
+static void flow_get(struct ftstat_flow *ff, char *rec,
+  struct fts3rec_offsets *fo)
+{
+  struct fts3rec_all2 cur;
 
-} /* ftstat_def_dump */
+  FT_RECGET_LAST(cur,rec,*fo);
+  FT_RECGET_FIRST(cur,rec,*fo);
+  FT_RECGET64_DPKTS(cur,rec,*fo);
+  FT_RECGET64_DOCTETS(cur,rec,*fo);
+  FT_RECGET_UNIX_SECS(cur,rec,*fo);
+  if (fo->xfields & FT_XFIELD_DFLOWS) {
+    FT_RECGET64_DFLOWS(cur,rec,*fo);
+  } else {
+    cur.dFlows64 = 1;
+  }
+
+  ff->dFlows64 = cur.dFlows64;
+  ff->dOctets64 = cur.dOctets64;
+  ff->dPkts64 = cur.dPkts64;
+  ff->unix_secs = cur.unix_secs;
+  ff->First = cur.First;
+  ff->Last = cur.Last;
+  ff->duration = cur.Last - cur.First;
+  ff->ps_valid = 0;
+
+} /* flow_get */
 
 /*
- * function: ftstat_def_free
+ * function: ftstat_def_calc
  *
- * Call the free method for each report.
+ * Call the calc method for each report.
  *
  * returns: 0 okay
  *          1 fail
  */
-int ftstat_def_free(struct ftstat_def *active_def)
+int ftstat_def_calc(struct ftstat_def *active_def)
 {
   struct ftstat_rpt *ftsrpt;
   struct ftstat_rpt_item *ftsrpti;
+  int ret;
+
+  ret = 1; /* err */
 
   /* foreach report in the definition */
   FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
 
     ftsrpt = ftsrpti->rpt;
 
-    /* run the free function */
-    ftsrpt->f_free(ftsrpt->data);
-
-  }
-
-  return 0;
+    /* run the new function */
+    if (ftsrpt->f_calc(ftsrpt)) {
+      fterr_warnx("f_calc(%s): failed.", ftsrpt->name);
+      goto out;
+    }
 
-} /* ftstat_def_free */
+  }
+
+  ret = 0;
+
+out:
+
+  return ret;
+
+} /* ftstat_def_calc */
 
 /*
- * function: ftstat_def_reset
+ * function: ftstat_def_merge
  *
- * Reset reports between time series intervals
+ * Call the merge method for each report, folding the reports of
+ * src_def into active_def.  Both definitions must come from the same
+ * configuration (ie loaded twice) and have been through ftstat_def_new()
+ * and ftstat_def_accum() but not ftstat_def_calc().  src_def is left
+ * unchanged.
  *
  * returns: 0 okay
  *          1 fail
  */
-int ftstat_def_reset(struct ftstat_def *active_def)
+int ftstat_def_merge(struct ftstat_def *active_def, struct ftstat_def *src_def)
 {
+  struct ftstat_rpt *ftsrpt, *src_rpt;
+  struct ftstat_rpt_item *ftsrpti, *src_rpti;
+  int ret;
 
-  if (ftstat_def_free(active_def)) {
-    fterr_warnx("ftstat_def_free(%s): failed.", active_def->name);
-    return -1;
-  }
+  ret = 1; /* err */
 
-  if (ftstat_def_new(active_def)) {
-    fterr_warnx("ftstat_def_new(%s): failed.", active_def->name);
-    return -1;
-  }
+  src_rpti = FT_STAILQ_FIRST(&src_def->items);
 
-  ++active_def->interval;
+  /* foreach report in the definition */
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
 
-  return 0;
+    ftsrpt = ftsrpti->rpt;
 
-} /* ftstat_def_reset */
+    if (!src_rpti)
+      break;
 
-/*
- * function: ftstat_list_reports
- *
- * List available reports
- *
- */
+    src_rpt = src_rpti->rpt;
 
-void ftstat_list_reports(FILE *out)
-{
-  struct typelookup *tl;
+    /* same report type with the same storage layout */
+    if ((ftsrpt->f_merge != src_rpt->f_merge) ||
+      (ftsrpt->all_fields != src_rpt->all_fields) ||
+      (ftsrpt->options != src_rpt->options) ||
+      (ftsrpt->count_estimate != src_rpt->count_estimate))
+      break;
 
-  for (tl = tlookup; tl->name; ++tl)
-    fprintf(out, "  %s\n", tl->name);
+    /* run the merge function */
+    if (ftsrpt->f_merge(ftsrpt, src_rpt)) {
+      fterr_warnx("f_merge(%s): failed.", ftsrpt->name);
+      goto out;
+    }
 
-} /* ftstat_list_reports */
+    src_rpti = FT_STAILQ_NEXT(src_rpti, chain);
 
-/*
- *************************************************************************
-                             parse_rpt_* 
- *************************************************************************
- */
+  }
 
-/* 
- * function: parse_rpt
+  if (ftsrpti || src_rpti) {
+    fterr_warnx("ftstat_def_merge(%s): definitions differ.", active_def->name);
+    goto out;
+  }
+
+  ret = 0;
+
+out:
+
+  return ret;
+
+} /* ftstat_def_merge */
+
+/*
+ * function: ftstat_def_state_save
  *
- * process the 'stat-report' line.  Each report has a unique name
- * which is added to the ftstat->rpts linked list.  The current
- * report is updated in lp.  Reports by themself do nothing,
- * they must be invoked by a definition.
+ * Append the counters of each report of active_def to the state file
+ * fp as one block, later merged by ftstat_def_state_load().  Must be
+ * called before ftstat_def_calc().  The block is in native byte order
+ * and holds the definition name and length so a reader can skip
+ * definitions it does not know.  fp must be seekable.
  *
- * returns: 0  ok
- *          <0 fail
+ * returns: 0 okay
+ *          1 fail
  */
-int parse_rpt(struct line_parser *lp, struct ftstat *ftstat)
+int ftstat_def_state_save(struct ftstat_def *active_def, FILE *fp)
 {
+  struct ftstat_rpt *ftsrpt;
+  struct ftstat_rpt_item *ftsrpti;
+  uint32_t hdr[2], nrpts, fields;
+  uint64_t len;
+  off_t off_len, off_end;
 
-  char *c;
-  struct ftstat_rpt *ftsr;
-   
-  NEXT_WORD(&lp->buf, c);
-  
-  if (!c) {
-    fterr_warnx("%s line %d: Expecting name.", lp->fname, lp->lineno);
-    return -1;
-  }
+  hdr[0] = FT_STAT_STATE_MAGIC;
+  hdr[1] = FT_STAT_STATE_VERSION;
+  len = 0;
+  nrpts = 0;
 
-  /* check if it exists */
-  FT_SLIST_FOREACH(ftsr, &ftstat->rpts, chain) {
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
 
-    if (!strcasecmp(c, ftsr->name)) {
-      fterr_warnx("%s line %d: Name (%s) previously defined.", lp->fname,
-        lp->lineno, c);
-      return -1;
+    ftsrpt = ftsrpti->rpt;
+
+    if (ftsrpt->all_fields & FT_STAT_FIELD_QUANT) {
+      fterr_warnx("%s: quantile reports can not save state.", ftsrpt->name);
+      return 1;
     }
 
+    ++nrpts;
+
   }
 
-  /* no, add a new entry to the list */
-  if (!(ftsr = (struct ftstat_rpt*)malloc(sizeof *ftsr))) {
-    fterr_warn("malloc()");
-    return -1;
+  if (state_write(fp, hdr, sizeof hdr))
+    return 1;
+
+  if ((off_len = ftello(fp)) == -1) {
+    fterr_warn("ftello()");
+    return 1;
   }
 
-  bzero(ftsr, sizeof *ftsr);
+  if (state_write(fp, &len, sizeof len) ||
+      state_write_str(fp, active_def->name) ||
+      state_write(fp, &nrpts, sizeof nrpts))
+    return 1;
 
-  FT_STAILQ_INIT(&ftsr->outs);
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
+
+    ftsrpt = ftsrpti->rpt;
+
+    fields = ftsrpt->all_fields & FT_STAT_FIELD_PS;
+
+    if (state_write_str(fp, ftsrpt->name) ||
+        state_write_str(fp, ftsrpt->format_name) ||
+        state_write(fp, &fields, sizeof fields) ||
+        rpt_save_totals(ftsrpt, fp))
+      return 1;
+
+    if (ftsrpt->f_save(ftsrpt, fp)) {
+      fterr_warnx("f_save(%s): failed.", ftsrpt->name);
+      return 1;
+    }
 
-  if (!(ftsr->name = (char*)malloc(strlen(c)+1))) {
-    fterr_warn("malloc()");
-    free(ftsr);
-    return -1;
   }
 
-  strcpy(ftsr->name, c);
+  /* patch the block length */
+  if ((off_end = ftello(fp)) == -1) {
+    fterr_warn("ftello()");
+    return 1;
+  }
 
-  FT_SLIST_INSERT_HEAD(&ftstat->rpts, ftsr, chain);
+  len = off_end - off_len - sizeof len;
 
-  lp->state = PARSE_STATE_REPORT;
-  lp->cur_rpt = ftsr;
-  lp->cur_rpt_out = (struct ftstat_rpt_out*)0L;
+  if (fseeko(fp, off_len, SEEK_SET) || state_write(fp, &len, sizeof len) ||
+      fseeko(fp, off_end, SEEK_SET)) {
+    fterr_warn("fseeko()");
+    return 1;
+  }
 
   return 0;
 
-} /* parse_rpt */
+} /* ftstat_def_state_save */
 
-/* 
- * function: parse_rpt_type
+/*
+ * function: ftstat_def_state_load
  *
- * process the 'type' line.
+ * Read the blocks of the state file fp written by ftstat_def_state_save()
+ * and merge each into the definition of defs[0..ndefs-1] with the same
+ * name.  Blocks for other definitions are skipped.  The reports of the
+ * definition must match the saved ones in name, type and fields.
  *
- * returns: 0  ok
- *          <0 fail
+ * returns: number of blocks merged
+ *          -1 fail
  */
-int parse_rpt_type(struct line_parser *lp, struct ftstat *ftstat)
+int ftstat_def_state_load(struct ftstat_def **defs, int ndefs, FILE *fp)
 {
-  struct typelookup *tl;
-  int found;
+  struct ftstat_def *def;
+  struct ftstat_rpt *ftsrpt;
+  struct ftstat_rpt_item *ftsrpti;
+  uint32_t hdr[2], nrpts, fields;
+  uint64_t len;
+  off_t off;
+  char *name, *type;
+  int i, n, merged;
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
-    return -1;
-  }
-   
-  NEXT_WORD(&lp->buf, lp->word);
-  
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting type.", lp->fname, lp->lineno);
-    return -1;
-  }
+  name = type = (char*)0L;
+  merged = 0;
 
-  if (lp->cur_rpt->f_new) {
-    fterr_warnx("%s line %d: Type previously defined.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+  while (1) {
 
-  found = 0;
+    if (fread(hdr, sizeof hdr, 1, fp) != 1) {
+      if (feof(fp) && !ferror(fp))
+        break;
+      fterr_warnx("state file: short read");
+      goto bad;
+    }
 
-  for (tl = tlookup; tl->name; ++tl) {
+    if (hdr[0] != FT_STAT_STATE_MAGIC) {
+      fterr_warnx("state file: bad magic.");
+      goto bad;
+    }
 
-    if (!strcasecmp(lp->word, tl->name)) {
+    if (hdr[1] != FT_STAT_STATE_VERSION) {
+      fterr_warnx("state file: unsupported version %lu.",
+        (unsigned long)hdr[1]);
+      goto bad;
+    }
 
-      lp->cur_rpt->allowed_fields = tl->allowed_fields;
-      lp->cur_rpt->allowed_options = tl->allowed_options;
-      lp->cur_rpt->xfields = tl->xfields;
-      lp->cur_rpt->f_new = tl->f_new;
-      lp->cur_rpt->f_accum = tl->f_accum;
-      lp->cur_rpt->f_calc = tl->f_calc;
-      lp->cur_rpt->f_dump = tl->f_dump;
-      lp->cur_rpt->f_free = tl->f_free;
-      lp->cur_rpt->format_name = tl->name;
+    if (state_read(fp, &len, sizeof len))
+      goto bad;
 
-      found = 1;
+    if ((off = ftello(fp)) == -1) {
+      fterr_warn("ftello()");
+      goto bad;
+    }
 
-      break;
+    if (!(name = state_read_str(fp)))
+      goto bad;
 
+    for (i = 0, def = 0L; i < ndefs; ++i)
+      if (!strcasecmp(defs[i]->name, name)) {
+        def = defs[i];
+        break;
+      }
+
+    free(name);
+    name = (char*)0L;
+
+    /* not selected, skip */
+    if (!def) {
+      if (fseeko(fp, off + len, SEEK_SET)) {
+        fterr_warn("fseeko()");
+        goto bad;
+      }
+      continue;
     }
 
-  } /* for */
+    if (state_read(fp, &nrpts, sizeof nrpts))
+      goto bad;
 
-  if (!found) {
-    fterr_warnx("%s line %d: Unrecognized type.", lp->fname, lp->lineno);
-    return -1;
-  }
+    n = 0;
 
-  return 0;
+    FT_STAILQ_FOREACH(ftsrpti, &def->items, chain) {
 
-} /* parse_rpt_type */
+      ftsrpt = ftsrpti->rpt;
 
-/* 
- * function: parse_rpt_filter
- *
- * process the 'filter' line.
- *
- * returns: 0  ok
- *          <0 fail
- */
-int parse_rpt_filter(struct line_parser *lp, struct ftstat *ftstat)
-{
+      if (n++ == nrpts)
+        break;
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
-    return -1;
-  }
-   
-  NEXT_WORD(&lp->buf, lp->word);
-  
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting filter name.", lp->fname, lp->lineno);
-    return -1;
-  }
+      if (!(name = state_read_str(fp)) || !(type = state_read_str(fp)) ||
+          state_read(fp, &fields, sizeof fields))
+        goto bad;
+
+      if (strcasecmp(name, ftsrpt->name) ||
+          strcasecmp(type, ftsrpt->format_name) ||
+          (fields != (ftsrpt->all_fields & FT_STAT_FIELD_PS)) ||
+          (ftsrpt->all_fields & FT_STAT_FIELD_QUANT)) {
+        fterr_warnx("%s: state of report %s (%s) does not match.",
+          def->name, name, type);
+        goto bad;
+      }
 
-  if (lp->cur_rpt->ftfd) {
-    fterr_warnx("%s line %d: Filter previously defined for report .",
-    lp->fname, lp->lineno);
-    return -1;
-  }
+      free(name);
+      free(type);
+      name = type = (char*)0L;
 
-  /* delay loading the filters until one is requested */
-  if (load_filters(ftstat)) {
-    fterr_warnx("%s line %d: Filters not loaded.", lp->fname, lp->lineno);
-    return -1;
-  }
+      if (rpt_load_totals(ftsrpt, fp))
+        goto bad;
 
-  if (!(lp->cur_rpt->ftfd = ftfil_def_find(&ftstat->ftfil,
-    lp->word))) {
-    fterr_warnx("%s line %d: Filter definition not found.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+      if (ftsrpt->f_load(ftsrpt, fp)) {
+        fterr_warnx("f_load(%s): failed.", ftsrpt->name);
+        goto bad;
+      }
 
-  return 0;
+    }
 
-} /* parse_rpt_filter */
+    if (n != nrpts || ftsrpti) {
+      fterr_warnx("%s: state has %lu reports.", def->name,
+        (unsigned long)nrpts);
+      goto bad;
+    }
 
-/* 
- * function: parse_rpt_tag_mask
- *
- * process the 'output' line.
- *
- * returns: 0  ok
- *          <0 fail
- */
-int parse_rpt_tag_mask(struct line_parser *lp, struct ftstat *ftstat)
-{
+    ++merged;
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
-    return -1;
   }
 
-  NEXT_WORD(&lp->buf, lp->word);
+  return merged;
 
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting source mask.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+bad:
 
-  lp->cur_rpt->tag_mask_src = strtoul(lp->word, (char**)0L, 0);
+  if (name)
+    free(name);
+  if (type)
+    free(type);
 
-  NEXT_WORD(&lp->buf, lp->word);
+  return -1;
 
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting destination mask.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+} /* ftstat_def_state_load */
 
-  lp->cur_rpt->tag_mask_dst = strtoul(lp->word, (char**)0L, 0);
+/*
+ * function: ftstat_def_dump
+ *
+ * Call the dump method for each report.
+ *
+ * returns: 0 okay
+ *          1 fail
+ */
+int ftstat_def_dump(struct ftio *ftio, struct ftstat_def *active_def)
+{
+  struct tm *tm;
+  time_t now;
+  FILE *fp;
+  struct ftstat_rpt *ftsrpt;
+  struct ftstat_rpt_item *ftsrpti;
+  struct ftstat_rpt_out *ftsro;
+  uint32_t t_start, t_end;
+  int ret, noclose, pipe, status;
+  char fmt_tmp[64], fmt_buf[1024], path_buf[1024], *path_run;
+  char *mode;
 
-  lp->cur_rpt->options |= FT_STAT_OPT_TAG_MASK;
-  lp->cur_rpt->xfields |= FT_XFIELD_SRC_TAG|FT_XFIELD_DST_TAG;
+  noclose = 0; /* fclose fp */
+  ret = 1; /* err */
+  fp = (FILE*)0L;
 
-  return 0;
+  /* foreach report in the definition */
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
 
-} /* parse_rpt_tag_mask */
+    ftsrpt = ftsrpti->rpt;
 
+    /* foreach output listed */
+    FT_STAILQ_FOREACH(ftsro, &ftsrpt->outs, chain) {
 
-/* 
- * function: parse_rpt_scale
- *
- * process the 'scale' line.
- *
- * returns: 0  ok
- *          <0 fail
- */
-int parse_rpt_scale(struct line_parser *lp, struct ftstat *ftstat)
-{
+      /* current output is this one */
+      ftsrpt->out = ftsro;
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
-    return -1;
-  }
+      if (ftsro->path) {
 
-  NEXT_WORD(&lp->buf, lp->word);
-  
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting scaling factor.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+        strncpy(fmt_buf, ftsro->path, sizeof(fmt_buf));
+        fmt_buf[sizeof(fmt_buf)-1] = 0;
 
-  lp->cur_rpt->scale = atoi(lp->word);
+        /* a window is named by its bounds, it may hold no flows */
+        if (active_def->window) {
+          t_start = active_def->window_end - active_def->window;
+          t_end = active_def->window_end;
+        } else {
+          t_start = ftsrpt->time_start;
+          t_end = ftsrpt->time_end;
+        }
 
-  return 0;
+        if (ftsro->time == FT_STAT_TIME_NOW)
+          now = time((time_t*)0L);
+        else if (ftsro->time == FT_STAT_TIME_START)
+          now = t_start;
+        else if (ftsro->time == FT_STAT_TIME_END)
+          now = t_end;
+        else if (ftsro->time == FT_STAT_TIME_MID)
+          now = t_start + (t_end - t_start)/2;
 
-} /* parse_rpt_scale */
+        tm = localtime(&now);
 
-/* 
- * function: parse_rpt_ip_src_addr_fmt
- *
- * process the 'ip-source-address-format' line.
- *
- * returns: 0  ok
- *          <0 fail
- */
-int parse_rpt_ip_src_addr_fmt(struct line_parser *lp, struct ftstat *ftstat)
-{
+        if (!(strftime(path_buf, sizeof path_buf, fmt_buf, tm))) {
+          fterr_warnx("strftime(): failed");
+          goto out;
+        }
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Not in report.", lp->fname, lp->lineno);
-    return -1;
-  }
+        if (path_buf[0] == '|') {
+          pipe = 1;
+          path_run = path_buf+1;
+        } else {
+          pipe = 0;
+          path_run = path_buf;
+        }
 
-  NEXT_WORD(&lp->buf, lp->word);
+        if (!pipe) {
 
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting address format.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+          if (mkpath(path_run, 0755) < 0) {
+            fterr_warnx("mkpath(%s): failed", path_run);
+            goto out;
+          }
 
-  if (!(strcasecmp(lp->word, "prefix-len")))
-    lp->cur_rpt->options |= FT_STAT_OPT_SRC_PREFIX_LEN;
-  else if (!(strcasecmp(lp->word, "prefix-mask")))
-    lp->cur_rpt->options |= FT_STAT_OPT_SRC_PREFIX_MASK;
-  else if (!(strcasecmp(lp->word, "address")))
-    lp->cur_rpt->options &=
-      ~(FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN);
-  else {
-    fterr_warnx("%s line %d: Invalid address format.", lp->fname, lp->lineno);
-    return -1;
-  }
+          /* write first interval, append the rest */
+          if (!active_def->interval)
+            mode = "w";
+          else
+            mode = "a";
 
-  /*
-   * if the PREFIX_LEN or PREFIX_MASK option is set then this report
-   *  requires the FT_XFIELD_XXX_MASK bits.
-   */
+          if (!(fp = fopen(path_run, mode))) {
+            fterr_warn("fopen(%s)", path_run);
+            goto out;
+          }
 
-  if (lp->cur_rpt->options &
-    (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+          noclose = 0;
 
-    if (lp->cur_rpt->xfields & FT_XFIELD_SRCADDR)
-      lp->cur_rpt->xfields |= FT_XFIELD_SRC_MASK;
+        } else { /* pipe */
 
-  } else {
+          if (!(fp = popen(path_run, "w"))) {
+            fterr_warn("popen(%s)", path_run);
+            goto out;
+          }
 
-    lp->cur_rpt->xfields &= ~ FT_XFIELD_SRC_MASK;
+          noclose = 0;
 
-  } /* OPT_PREFIX_* */
+        } /* !pipe */
 
-  return 0;
+      } else { /* path specified */
 
-} /* parse_rpt_ip_src_addr_fmt */
+        fp = stdout;
+        pipe = 0;
+        noclose = 1;
 
-/* 
- * function: parse_rpt_ip_dst_addr_fmt
- *
- * process the 'ip-address-format' line.
- *
- * returns: 0  ok
- *          <0 fail
- */
-int parse_rpt_ip_dst_addr_fmt(struct line_parser *lp, struct ftstat *ftstat)
-{
+      }
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Not in report.", lp->fname, lp->lineno);
-    return -1;
-  }
+      /* binary output carries its own header and totals */
+      if (ftsro->format != FT_STAT_FMT_BINARY) {
 
-  NEXT_WORD(&lp->buf, lp->word);
+        /* display header bits */
+        dump_ascii_header(fp, ftio, active_def, ftsrpt);
 
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting address format.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+        /* display totals? */
+        if (ftsro->options & FT_STAT_OPT_TOTALS) {
+          STD_DUMP_TOTALS_HEADER;
+          STD_DUMP_TOTALS_VAL;
+        }
 
-  if (!(strcasecmp(lp->word, "prefix-len")))
-    lp->cur_rpt->options |= FT_STAT_OPT_DST_PREFIX_LEN;
-  else if (!(strcasecmp(lp->word, "prefix-mask")))
-    lp->cur_rpt->options |= FT_STAT_OPT_DST_PREFIX_MASK;
-  else if (!(strcasecmp(lp->word, "address")))
-    lp->cur_rpt->options
-      &= ~(FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN);
-  else {
-    fterr_warnx("%s line %d: Invalid address format.", lp->fname, lp->lineno);
-    return -1;
-  }
+      }
 
-  /*
-   * if the PREFIX_LEN or PREFIX_MASK option is set then this report
-   *  requires the FT_XFIELD_XXX_MASK bits.
-   */
+      /* run the dump function */
+      if (ftsro->f_dump(fp, ftio, ftsrpt)) {
+        fterr_warnx("f_dump(%s): failed.", path_run);
+        goto out;
+      }
 
-  if (lp->cur_rpt->options &
-    (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+      if ((!noclose) && fp) {
 
-    if (lp->cur_rpt->xfields & FT_XFIELD_DSTADDR)
-      lp->cur_rpt->xfields |= FT_XFIELD_DST_MASK;
+        if (!pipe) {
+          if (fclose(fp))
+            fterr_warn("fclose(%s)", path_run);
+        } else {
+          status = pclose(fp);
+          if (status == -1)
+            fterr_warn("pclose(%s)", path_run);
+          if (WIFEXITED(status))
+             if (WEXITSTATUS(status) != 0)
+              fterr_warnx("pclose(%s): failed exit code=%d.", path_run,
+                WEXITSTATUS(status));
+        }
 
-  } else {
+      } /* !noclose && fp */
 
-    lp->cur_rpt->xfields &= ~ FT_XFIELD_DST_MASK;
+    } /* foreach output */
 
-  } /* OPT_PREFIX_* */
+  } /* foreach report */
 
-  return 0;
+  ret = 0;
 
-} /* parse_rpt_ip_dst_addr_fmt */
+out:
 
-/*
- *************************************************************************
-                        parse_rpt_output and friends
- *************************************************************************
- */
+  return ret;
 
-/* 
- * function: parse_rpt_output
+} /* ftstat_def_dump */
+
+/*
+ * function: ftstat_def_free
  *
- * process the 'output' line.
+ * Call the free method for each report.
  *
- * returns: 0  ok
- *          <0 fail
+ * returns: 0 okay
+ *          1 fail
  */
-int parse_rpt_output(struct line_parser *lp, struct ftstat *ftstat)
+int ftstat_def_free(struct ftstat_def *active_def)
 {
-  struct ftstat_rpt_out *ftsro;
+  struct ftstat_rpt *ftsrpt;
+  struct ftstat_rpt_item *ftsrpti;
 
-  if (!lp->cur_rpt) {
-    fterr_warnx("%s line %d: Not in a report.", lp->fname, lp->lineno);
-    return -1;
-  }
+  /* foreach report in the definition */
+  FT_STAILQ_FOREACH(ftsrpti, &active_def->items, chain) {
 
-  /* add a new entry to the list */
-  if (!(ftsro = (struct ftstat_rpt_out*)malloc(sizeof *ftsro))) {
-    fterr_warn("malloc()");
-    return -1;
-  }
+    ftsrpt = ftsrpti->rpt;
 
-  bzero(ftsro, sizeof *ftsro);
-  ftsro->f_dump = lp->cur_rpt->f_dump;
-  ftsro->fields = lp->cur_rpt->allowed_fields;
-  ftsro->fields &= ~(FT_STAT_FIELD_FRECS|
-                     FT_STAT_FIELD_INDEX|
-                     FT_STAT_FIELD_FIRST|
-                     FT_STAT_FIELD_LAST|
-                     FT_STAT_FIELD_PPS|
-                     FT_STAT_FIELD_BPS); /* default some off */
-  ftsro->time = FT_STAT_TIME_MID;
-  lp->cur_rpt_out = ftsro;
+    /* run the free function */
+    ftsrpt->f_free(ftsrpt->data);
 
-  FT_STAILQ_INSERT_TAIL(&lp->cur_rpt->outs, ftsro, chain);
+    qs_free(ftsrpt);
+
+  }
 
   return 0;
 
-} /* parse_rpt_output */
+} /* ftstat_def_free */
 
-/* 
- * function: parse_rpt_out_format
+/*
+ * function: ftstat_def_reset
  *
- * process the 'format' line.
+ * Reset reports between time series intervals
  *
- * returns: 0  ok
- *          <0 fail
+ * returns: 0 okay
+ *          1 fail
  */
-int parse_rpt_out_format(struct line_parser *lp, struct ftstat *ftstat)
+int ftstat_def_reset(struct ftstat_def *active_def)
 {
-  enum ftstat_rpt_format format;
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
-    return -1;
-  }
-
-  NEXT_WORD(&lp->buf, lp->word);
-
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting format.", lp->fname,
-    lp->lineno);
+  if (ftstat_def_free(active_def)) {
+    fterr_warnx("ftstat_def_free(%s): failed.", active_def->name);
     return -1;
   }
 
-  if (!(strcasecmp(lp->word, "ascii")))
-    format = FT_STAT_FMT_ASCII;
-  else if (!(strcasecmp(lp->word, "binary")))
-    format = FT_STAT_FMT_BINARY;
-  else {
-    fterr_warnx("%s line %d: Unrecognized format.", lp->fname, lp->lineno);
+  if (ftstat_def_new(active_def)) {
+    fterr_warnx("ftstat_def_new(%s): failed.", active_def->name);
     return -1;
   }
 
-  lp->cur_rpt->format = format;
+  ++active_def->interval;
 
   return 0;
 
-} /* parse_rpt_out_format */
+} /* ftstat_def_reset */
+
+/*
+ * function: ftstat_list_reports
+ *
+ * List available reports
+ *
+ */
+
+void ftstat_list_reports(FILE *out)
+{
+  struct typelookup *tl;
+
+  for (tl = tlookup; tl->name; ++tl)
+    fprintf(out, "  %s\n", tl->name);
+
+} /* ftstat_list_reports */
+
+/*
+ *************************************************************************
+                             parse_rpt_* 
+ *************************************************************************
+ */
 
 /* 
- * function: parse_rpt_out_sort
+ * function: parse_rpt
  *
- * process the 'sort' line.
+ * process the 'stat-report' line.  Each report has a unique name
+ * which is added to the ftstat->rpts linked list.  The current
+ * report is updated in lp.  Reports by themself do nothing,
+ * they must be invoked by a definition.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_sort(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt(struct line_parser *lp, struct ftstat *ftstat)
 {
-  int sort_field, sort_order;
-  char *c;
-
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
-    return -1;
-  }
 
-  NEXT_WORD(&lp->buf, lp->word);
+  char *c;
+  struct ftstat_rpt *ftsr;
+   
+  NEXT_WORD(&lp->buf, c);
   
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting sort field.", lp->fname,
-    lp->lineno);
+  if (!c) {
+    fterr_warnx("%s line %d: Expecting name.", lp->fname, lp->lineno);
     return -1;
   }
 
-  c = lp->word;
+  /* check if it exists */
+  FT_SLIST_FOREACH(ftsr, &ftstat->rpts, chain) {
 
-  if (*c == '+')
-    sort_order = FT_STAT_SORT_ASCEND;
-  else if (*c == '-')
-    sort_order = FT_STAT_SORT_DESCEND;
-  else {
-    fterr_warnx("%s line %d: Expecting + or -.", lp->fname, lp->lineno);
+    if (!strcasecmp(c, ftsr->name)) {
+      fterr_warnx("%s line %d: Name (%s) previously defined.", lp->fname,
+        lp->lineno, c);
+      return -1;
+    }
+
+  }
+
+  /* no, add a new entry to the list */
+  if (!(ftsr = (struct ftstat_rpt*)malloc(sizeof *ftsr))) {
+    fterr_warn("malloc()");
     return -1;
   }
 
-  ++c;
+  bzero(ftsr, sizeof *ftsr);
 
-  if (!(strcasecmp(c, "key")))
-    sort_field = FT_STAT_FIELD_KEY;
-  else if (!(strcasecmp(c, "key1")))
-    sort_field = FT_STAT_FIELD_KEY1;
-  else if (!(strcasecmp(c, "key2")))
-    sort_field = FT_STAT_FIELD_KEY2;
-  else if (!(strcasecmp(c, "key3")))
-    sort_field = FT_STAT_FIELD_KEY3;
-  else if (!(strcasecmp(c, "key4")))
-    sort_field = FT_STAT_FIELD_KEY4;
-  else if (!(strcasecmp(c, "key5")))
-    sort_field = FT_STAT_FIELD_KEY5;
-  else if (!(strcasecmp(c, "key6")))
-    sort_field = FT_STAT_FIELD_KEY6;
-  else if (!(strcasecmp(c, "flows")))
-    sort_field = FT_STAT_FIELD_FLOWS;
-  else if (!(strcasecmp(c, "octets")))
-    sort_field = FT_STAT_FIELD_OCTETS;
-  else if (!(strcasecmp(c, "packets")))
-    sort_field = FT_STAT_FIELD_PACKETS;
-  else if (!(strcasecmp(c, "duration")))
-    sort_field = FT_STAT_FIELD_DURATION;
-  else if (!(strcasecmp(c, "avg-pps")))
-    sort_field = FT_STAT_FIELD_AVG_PPS;
-  else if (!(strcasecmp(c, "min-pps")))
-    sort_field = FT_STAT_FIELD_MIN_PPS;
-  else if (!(strcasecmp(c, "max-pps")))
-    sort_field = FT_STAT_FIELD_MAX_PPS;
-  else if (!(strcasecmp(c, "avg-bps")))
-    sort_field = FT_STAT_FIELD_AVG_BPS;
-  else if (!(strcasecmp(c, "min-bps")))
-    sort_field = FT_STAT_FIELD_MIN_BPS;
-  else if (!(strcasecmp(c, "max-bps")))
-    sort_field = FT_STAT_FIELD_MAX_BPS;
-  else if (!(strcasecmp(c, "other")))
-    sort_field = FT_STAT_FIELD_OTHER;
-  else if (!(strcasecmp(c, "count")))
-    sort_field = FT_STAT_FIELD_COUNT;
-  else if (!(strcasecmp(c, "")))
-    sort_field = 0;
-  else {
-    fterr_warnx("%s line %d: Unrecognized field.", lp->fname, lp->lineno);
+  FT_STAILQ_INIT(&ftsr->outs);
+
+  if (!(ftsr->name = (char*)malloc(strlen(c)+1))) {
+    fterr_warn("malloc()");
+    free(ftsr);
     return -1;
   }
 
-  if (sort_field) {
-
-    /* make sure that the field selected is valid for this report type */
-    if ((lp->cur_rpt->allowed_fields & sort_field) != sort_field) {
-      fterr_warnx("%s line %d: field \"%s\" selected not available for report.",
-        lp->fname, lp->lineno, c);
-      return -1;
-    }
+  strcpy(ftsr->name, c);
 
-    lp->cur_rpt_out->sort_field = sort_field;
-    lp->cur_rpt_out->sort_order = sort_order;
-    lp->cur_rpt_out->options |= FT_STAT_OPT_SORT;
+  FT_SLIST_INSERT_HEAD(&ftstat->rpts, ftsr, chain);
 
-  }
+  lp->state = PARSE_STATE_REPORT;
+  lp->cur_rpt = ftsr;
+  lp->cur_rpt_out = (struct ftstat_rpt_out*)0L;
 
   return 0;
 
-} /* parse_rpt_out_sort */
+} /* parse_rpt */
 
 /* 
- * function: parse_rpt_out_records
+ * function: parse_rpt_type
  *
- * process the 'records' line.
+ * process the 'type' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_records(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_type(struct line_parser *lp, struct ftstat *ftstat)
 {
+  struct typelookup *tl;
+  int found;
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
     return -1;
   }
-
+   
   NEXT_WORD(&lp->buf, lp->word);
-
+  
   if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting num records.", lp->fname,
+    fterr_warnx("%s line %d: Expecting type.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (lp->cur_rpt->f_new) {
+    fterr_warnx("%s line %d: Type previously defined.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  lp->cur_rpt_out->records = strtoull(lp->word, (char**)0L, 0);
+  found = 0;
+
+  for (tl = tlookup; tl->name; ++tl) {
+
+    if (!strcasecmp(lp->word, tl->name)) {
+
+      lp->cur_rpt->allowed_fields = tl->allowed_fields;
+
+      /* the keyed reports with per second fields can have quantiles */
+      if (((tl->allowed_fields & FT_STAT_FIELD_PS) == FT_STAT_FIELD_PS) &&
+        (tl->allowed_fields & (FT_STAT_FIELD_KEY|FT_STAT_FIELD_KEY1)))
+        lp->cur_rpt->allowed_fields |= FT_STAT_FIELD_QUANT;
+      lp->cur_rpt->allowed_options = tl->allowed_options;
+      lp->cur_rpt->xfields = tl->xfields;
+      lp->cur_rpt->f_new = tl->f_new;
+      lp->cur_rpt->f_accum = tl->f_accum;
+      lp->cur_rpt->f_calc = tl->f_calc;
+      lp->cur_rpt->f_merge = tl->f_merge;
+      lp->cur_rpt->f_save = tl->f_save;
+      lp->cur_rpt->f_load = tl->f_load;
+      lp->cur_rpt->f_dump = tl->f_dump;
+      lp->cur_rpt->f_free = tl->f_free;
+      lp->cur_rpt->format_name = tl->name;
+
+      found = 1;
+
+      break;
+
+    }
+
+  } /* for */
+
+  if (!found) {
+    fterr_warnx("%s line %d: Unrecognized type.", lp->fname, lp->lineno);
+    return -1;
+  }
 
   return 0;
 
-} /* parse_rpt_out_records */
+} /* parse_rpt_type */
 
 /* 
- * function: parse_rpt_out_tally
+ * function: parse_rpt_filter
  *
- * process the 'tally' line.
+ * process the 'filter' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_tally(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_filter(struct line_parser *lp, struct ftstat *ftstat)
 {
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
-    return -1;
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
   }
-
+   
   NEXT_WORD(&lp->buf, lp->word);
-
+  
   if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting tally increment.", lp->fname,
-    lp->lineno);
+    fterr_warnx("%s line %d: Expecting filter name.", lp->fname, lp->lineno);
     return -1;
   }
 
-  lp->cur_rpt_out->tally = strtoul(lp->word, (char**)0L, 0);
+  if (lp->cur_rpt->ftfd) {
+    fterr_warnx("%s line %d: Filter previously defined for report .",
+    lp->fname, lp->lineno);
+    return -1;
+  }
 
-  if (lp->cur_rpt_out->tally)
-    lp->cur_rpt_out->options |= FT_STAT_OPT_TALLY;
-  else
-    lp->cur_rpt_out->options &= ~FT_STAT_OPT_TALLY;
+  /* delay loading the filters until one is requested */
+  if (load_filters(ftstat)) {
+    fterr_warnx("%s line %d: Filters not loaded.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(lp->cur_rpt->ftfd = ftfil_def_find(&ftstat->ftfil,
+    lp->word))) {
+    fterr_warnx("%s line %d: Filter definition not found.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
 
   return 0;
 
-} /* parse_rpt_out_tally */
+} /* parse_rpt_filter */
 
 /* 
- * function: parse_rpt_out_fields
+ * function: parse_rpt_tag_mask
  *
- * process the 'fields' line.
+ * process the 'output' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_fields(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_tag_mask(struct line_parser *lp, struct ftstat *ftstat)
 {
-  char *c, op;
-  uint32_t nfields;
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (!lp->buf) {
-    fterr_warnx("%s line %d: Expecting display fields.", lp->fname,
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting source mask.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  c = lp->buf;
-
-  while (c) {
+  lp->cur_rpt->tag_mask_src = strtoul(lp->word, (char**)0L, 0);
 
-    for (;;) {
-      c = strsep(&lp->buf, " ,");
-      if ((c && *c) || (!c))
-        break;
-    }
+  NEXT_WORD(&lp->buf, lp->word);
 
-    if (!c)
-      break;
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting destination mask.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
 
-    /* + to select, - to remove */
-    op = *c++;
+  lp->cur_rpt->tag_mask_dst = strtoul(lp->word, (char**)0L, 0);
 
-    if ((op != '+') && (op != '-')) {
-      fterr_warnx("%s line %d: Expecting +field or -field.", lp->fname,
-        lp->lineno);
-      return -1;
-    }
+  lp->cur_rpt->options |= FT_STAT_OPT_TAG_MASK;
+  lp->cur_rpt->xfields |= FT_XFIELD_SRC_TAG|FT_XFIELD_DST_TAG;
 
-    nfields = 0;
+  return 0;
 
-    if (!(strcasecmp(c, "index")))
-      nfields |= FT_STAT_FIELD_INDEX;
-    else if (!(strcasecmp(c, "first")))
-      nfields |= FT_STAT_FIELD_FIRST;
-    else if (!(strcasecmp(c, "last")))
-      nfields |= FT_STAT_FIELD_LAST;
-    else if (!(strcasecmp(c, "key")))
-      nfields |= FT_STAT_FIELD_KEY;
-    else if (!(strcasecmp(c, "key1")))
-      nfields |= FT_STAT_FIELD_KEY1;
-    else if (!(strcasecmp(c, "key2")))
-      nfields |= FT_STAT_FIELD_KEY2;
-    else if (!(strcasecmp(c, "key3")))
-      nfields |= FT_STAT_FIELD_KEY3;
-    else if (!(strcasecmp(c, "key4")))
-      nfields |= FT_STAT_FIELD_KEY4;
-    else if (!(strcasecmp(c, "key5")))
-      nfields |= FT_STAT_FIELD_KEY5;
-    else if (!(strcasecmp(c, "key6")))
-      nfields |= FT_STAT_FIELD_KEY6;
-    else if (!(strcasecmp(c, "flows")))
-      nfields |= FT_STAT_FIELD_FLOWS;
-    else if (!(strcasecmp(c, "octets")))
-      nfields |= FT_STAT_FIELD_OCTETS;
-    else if (!(strcasecmp(c, "packets")))
-      nfields |= FT_STAT_FIELD_PACKETS;
-    else if (!(strcasecmp(c, "duration")))
-      nfields |= FT_STAT_FIELD_DURATION;
-    else if (!(strcasecmp(c, "pps")))
-      nfields |= FT_STAT_FIELD_PPS;
-    else if (!(strcasecmp(c, "avg-pps")))
-      nfields |= FT_STAT_FIELD_AVG_PPS;
-    else if (!(strcasecmp(c, "min-pps")))
-      nfields |= FT_STAT_FIELD_MIN_PPS;
-    else if (!(strcasecmp(c, "max-pps")))
-      nfields |= FT_STAT_FIELD_MAX_PPS;
-    else if (!(strcasecmp(c, "bps")))
-      nfields |= FT_STAT_FIELD_BPS;
-    else if (!(strcasecmp(c, "avg-bps")))
-      nfields |= FT_STAT_FIELD_AVG_BPS;
-    else if (!(strcasecmp(c, "min-bps")))
-      nfields |= FT_STAT_FIELD_MIN_BPS;
-    else if (!(strcasecmp(c, "max-bps")))
-      nfields |= FT_STAT_FIELD_MAX_BPS;
-    else if (!(strcasecmp(c, "other")))
-      nfields |= FT_STAT_FIELD_OTHER;
-    else if (!(strcasecmp(c, "generic")))
-      nfields |= FT_STAT_FIELD_GENERIC;
-    else if (!(strcasecmp(c, "count")))
-      nfields |= FT_STAT_FIELD_COUNT;
-    else if (!(strcasecmp(c, "frecs")))
-      nfields |= FT_STAT_FIELD_FRECS;
-    else if (!(strcasecmp(c, "")))
-      nfields |= 0;
-    else {
-      fterr_warnx("%s line %d: Unrecognized field.", lp->fname, lp->lineno);
-      return -1;
-    }
+} /* parse_rpt_tag_mask */
 
-    /* make sure that the field is valid for this report type */
 
-    if ((lp->cur_rpt->allowed_fields & nfields) != nfields) {
-      fterr_warnx(
-        "%s line %d: field \"%s\" selected not available for report.",
-        lp->fname, lp->lineno, c);
-      return -1;
-    }
+/* 
+ * function: parse_rpt_scale
+ *
+ * process the 'scale' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_rpt_scale(struct line_parser *lp, struct ftstat *ftstat)
+{
 
-    if (op == '+')
-      lp->cur_rpt_out->fields |= nfields;
-    else if (op == '-')
-      lp->cur_rpt_out->fields &= ~nfields;
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
 
-    nfields = 0;
+  NEXT_WORD(&lp->buf, lp->word);
+  
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting scaling factor.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
 
-  } /* c */
+  lp->cur_rpt->scale = atoi(lp->word);
 
   return 0;
 
-} /* parse_rpt_out_fields */
+} /* parse_rpt_scale */
 
 /* 
- * function: parse_rpt_out_options
+ * function: parse_rpt_memory_limit
  *
- * process the 'options' line.
+ * process the 'memory-limit' line.  Bytes, with an optional K, M or G
+ * suffix.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_options(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_memory_limit(struct line_parser *lp, struct ftstat *ftstat)
 {
-  int options;
-  char *c, op;
+  int64_t n;
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (!lp->buf) {
-    fterr_warnx("%s line %d: Expecting options.", lp->fname,
+  NEXT_WORD(&lp->buf, lp->word);
+  
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting memory limit.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  c = lp->buf;
-
-  while (c) {
-
-    for (;;) {
-      c = strsep(&lp->buf, " ,");
-      if ((c && *c) || (!c))
-        break;
-    }
-
-    if (!c)
-      break;
-
-    /* + to select, - to remove */
-    op = *c++;
-
-    if ((op != '+') && (op != '-')) {
-      fterr_warnx("%s line %d: Expecting +option or -option.", lp->fname,
-        lp->lineno);
-      return -1;
-    }
-
-    options = 0;
-
-    if (!(strcasecmp(c, "percent-total")))
-      options |= FT_STAT_OPT_PERCENT;
-    else if (!(strcasecmp(c, "names")))
-      options |= FT_STAT_OPT_NAMES;
-    else if (!(strcasecmp(c, "header")))
-      options |= FT_STAT_OPT_HEADER;
-    else if (!(strcasecmp(c, "xheader")))
-      options |= FT_STAT_OPT_XHEADER;
-    else if (!(strcasecmp(c, "totals")))
-      options |= FT_STAT_OPT_TOTALS;
-    else {
-      fterr_warnx("%s line %d: Unrecognized option.", lp->fname, lp->lineno);
-      return -1;
-    }
-
-    /* make sure that the option is valid for this report type */
-
-    if ((lp->cur_rpt->allowed_options & options) != options) {
-      fterr_warnx("%s line %d: option selected not available for report.",
-        lp->fname, lp->lineno);
-      return -1;
-    }
-
-    if (op == '+') 
-      lp->cur_rpt_out->options |= options;
-    else if (op == '-')
-      lp->cur_rpt_out->options &= ~options;
-
-    options = 0;
+  if ((n = scan_size(lp->word)) == -1) {
+    fterr_warnx("%s line %d: Invalid memory limit.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
 
-  } /* c */
+  lp->cur_rpt->memory_limit = n;
 
   return 0;
 
-} /* parse_rpt_out_options */
+} /* parse_rpt_memory_limit */
 
 /* 
- * function: parse_rpt_out_path
+ * function: parse_rpt_count_estimate
  *
- * process the 'path' line.
+ * process the 'count-estimate' line.  HyperLogLog precision used
+ * instead of an exact count of distinct peers.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_path(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_count_estimate(struct line_parser *lp, struct ftstat *ftstat)
 {
+  int n;
   char *c;
-  int len;
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (!lp->buf) {
-    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+  NEXT_WORD(&lp->buf, lp->word);
+  
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting precision.", lp->fname,
+    lp->lineno);
     return -1;
   }
 
-  len = strlen(lp->buf);
+  n = strtol(lp->word, &c, 0);
 
-  if (!(c = malloc(len+1))) {
-    fterr_warn("malloc()");
+  if (*c || n < FT_HLL_MIN_PRECISION || n > FT_HLL_MAX_PRECISION) {
+    fterr_warnx("%s line %d: Precision must be %d..%d.", lp->fname,
+    lp->lineno, FT_HLL_MIN_PRECISION, FT_HLL_MAX_PRECISION);
     return -1;
   }
 
-  strcpy(c, lp->buf);
-
-  lp->cur_rpt_out->path = c;
-
-  /* eat the line */
-  for (; *(lp->buf); ++lp->buf);
+  lp->cur_rpt->count_estimate = n;
 
   return 0;
 
-} /* parse_rpt_out_path */
+} /* parse_rpt_count_estimate */
 
 /* 
- * function: parse_rpt_out_time
+ * function: parse_rpt_heavy_hitters
  *
- * process the 'time' line.
+ * process the 'heavy-hitters' line.  Entries of the Space-Saving
+ * summary and optionally the counter it is ranked on.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_rpt_out_time(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_heavy_hitters(struct line_parser *lp, struct ftstat *ftstat)
 {
+  int64_t n;
 
-  if (!lp->cur_rpt_out) {
-    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
     return -1;
   }
 
   NEXT_WORD(&lp->buf, lp->word);
-
+  
   if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting time specifier.", lp->fname,
+    fterr_warnx("%s line %d: Expecting entries.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  if (!(strcasecmp(lp->word, "now")))
-    lp->cur_rpt_out->time = FT_STAT_TIME_NOW;
-  else if (!(strcasecmp(lp->word, "start")))
-    lp->cur_rpt_out->time = FT_STAT_TIME_START;
-  else if (!(strcasecmp(lp->word, "end")))
-    lp->cur_rpt_out->time = FT_STAT_TIME_END;
-  else if (!(strcasecmp(lp->word, "mid")))
-    lp->cur_rpt_out->time = FT_STAT_TIME_MID;
+  if (((n = scan_size(lp->word)) == -1) || !n) {
+    fterr_warnx("%s line %d: Invalid entries.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  lp->cur_rpt->heavy_hitters = n;
+  lp->cur_rpt->heavy_field = 0;
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word)
+    return 0;
+
+  if (!strcasecmp(lp->word, "flows"))
+    lp->cur_rpt->heavy_field = FT_STAT_FIELD_FLOWS;
+  else if (!strcasecmp(lp->word, "octets"))
+    lp->cur_rpt->heavy_field = FT_STAT_FIELD_OCTETS;
+  else if (!strcasecmp(lp->word, "packets"))
+    lp->cur_rpt->heavy_field = FT_STAT_FIELD_PACKETS;
   else {
-    fterr_warnx("%s line %d: Invalid time specifier.", lp->fname, lp->lineno);
+    fterr_warnx("%s line %d: Expecting flows, octets or packets.",
+    lp->fname, lp->lineno);
     return -1;
   }
 
   return 0;
 
-} /* parse_rpt_out_time */
-
-/*
- *************************************************************************
-                             parse_def_* 
- *************************************************************************
- */
+} /* parse_rpt_heavy_hitters */
 
 /* 
- * function: parse_def
+ * function: parse_rpt_ip_src_addr_fmt
  *
- * process the 'stat-definition' line.  Each definition has a unique name
- * which is added to the ftstat->defs linked list.  The current
- * definition is updated in lp.  Definitions reference reports
+ * process the 'ip-source-address-format' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_def(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_ip_src_addr_fmt(struct line_parser *lp, struct ftstat *ftstat)
 {
-  char *c;
-  struct ftstat_def *ftsd;
-   
-  NEXT_WORD(&lp->buf, c);
-  
-  if (!c) {
-    fterr_warnx("%s line %d: Expecting name.", lp->fname, lp->lineno);
+
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Not in report.", lp->fname, lp->lineno);
     return -1;
   }
 
-  /* check if it exists */
-  FT_SLIST_FOREACH(ftsd, &ftstat->defs, chain) {
-
-    if (!strcasecmp(c, ftsd->name)) {
-      fterr_warnx("%s line %d: Name (%s) previously defined.", lp->fname,
-        lp->lineno, c);
-      return -1;
-    }
+  NEXT_WORD(&lp->buf, lp->word);
 
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting address format.", lp->fname,
+    lp->lineno);
+    return -1;
   }
 
-  /* no, add a new entry to the list */
-  if (!(ftsd = (struct ftstat_def*)malloc(sizeof *ftsd))) {
-    fterr_warn("malloc()");
+  if (!(strcasecmp(lp->word, "prefix-len")))
+    lp->cur_rpt->options |= FT_STAT_OPT_SRC_PREFIX_LEN;
+  else if (!(strcasecmp(lp->word, "prefix-mask")))
+    lp->cur_rpt->options |= FT_STAT_OPT_SRC_PREFIX_MASK;
+  else if (!(strcasecmp(lp->word, "address")))
+    lp->cur_rpt->options &=
+      ~(FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN);
+  else {
+    fterr_warnx("%s line %d: Invalid address format.", lp->fname, lp->lineno);
     return -1;
   }
 
-  bzero(ftsd, sizeof *ftsd);
-  FT_STAILQ_INIT(&ftsd->items);
+  /*
+   * if the PREFIX_LEN or PREFIX_MASK option is set then this report
+   *  requires the FT_XFIELD_XXX_MASK bits.
+   */
 
-  if (!(ftsd->name = (char*)malloc(strlen(c)+1))) {
-    fterr_warn("malloc()");
-    free(ftsd);
-    return -1;
-  }
+  if (lp->cur_rpt->options &
+    (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
 
-  strcpy(ftsd->name, c);
-  ftsd->ftstat = ftstat;
+    if (lp->cur_rpt->xfields & FT_XFIELD_SRCADDR)
+      lp->cur_rpt->xfields |= FT_XFIELD_SRC_MASK;
 
-  FT_SLIST_INSERT_HEAD(&ftstat->defs, ftsd, chain);
+  } else {
 
-  lp->state = PARSE_STATE_DEFINITION;
-  lp->cur_def = ftsd;
+    lp->cur_rpt->xfields &= ~ FT_XFIELD_SRC_MASK;
+
+  } /* OPT_PREFIX_* */
 
   return 0;
 
-} /* parse_def */
+} /* parse_rpt_ip_src_addr_fmt */
 
 /* 
- * function: parse_def_filter
+ * function: parse_rpt_ip_dst_addr_fmt
  *
- * process the 'filter' line.
+ * process the 'ip-address-format' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_def_filter(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_ip_dst_addr_fmt(struct line_parser *lp, struct ftstat *ftstat)
 {
 
-  if (!lp->cur_def) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Not in report.", lp->fname, lp->lineno);
     return -1;
   }
 
   NEXT_WORD(&lp->buf, lp->word);
 
   if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting filter name.", lp->fname,
+    fterr_warnx("%s line %d: Expecting address format.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  if (lp->cur_def->ftfd) {
-    fterr_warnx("%s line %d: Filter previously defined for definition.",
-    lp->fname, lp->lineno);
+  if (!(strcasecmp(lp->word, "prefix-len")))
+    lp->cur_rpt->options |= FT_STAT_OPT_DST_PREFIX_LEN;
+  else if (!(strcasecmp(lp->word, "prefix-mask")))
+    lp->cur_rpt->options |= FT_STAT_OPT_DST_PREFIX_MASK;
+  else if (!(strcasecmp(lp->word, "address")))
+    lp->cur_rpt->options
+      &= ~(FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN);
+  else {
+    fterr_warnx("%s line %d: Invalid address format.", lp->fname, lp->lineno);
     return -1;
   }
 
-  /* delay loading the filters until one is requested */
-  if (load_filters(ftstat)) {
-    fterr_warnx("%s line %d: Filters not loaded.", lp->fname, lp->lineno);
-    return -1;
-  }
+  /*
+   * if the PREFIX_LEN or PREFIX_MASK option is set then this report
+   *  requires the FT_XFIELD_XXX_MASK bits.
+   */
 
-  if (!(lp->cur_def->ftfd = ftfil_def_find(&ftstat->ftfil,
-    lp->word))) {
-    fterr_warnx("%s line %d: Filter definition not found.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+  if (lp->cur_rpt->options &
+    (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+
+    if (lp->cur_rpt->xfields & FT_XFIELD_DSTADDR)
+      lp->cur_rpt->xfields |= FT_XFIELD_DST_MASK;
+
+  } else {
+
+    lp->cur_rpt->xfields &= ~ FT_XFIELD_DST_MASK;
+
+  } /* OPT_PREFIX_* */
 
   return 0;
 
-} /* parse_def_filter */
+} /* parse_rpt_ip_dst_addr_fmt */
+
+/*
+ *************************************************************************
+                        parse_rpt_output and friends
+ *************************************************************************
+ */
 
 /* 
- * function: parse_def_tag
+ * function: parse_rpt_output
  *
- * process the 'tag' line.
+ * process the 'output' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_def_tag(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_output(struct line_parser *lp, struct ftstat *ftstat)
 {
+  struct ftstat_rpt_out *ftsro;
 
-  if (!lp->cur_def) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
-    return -1;
-  }
-
-  NEXT_WORD(&lp->buf, lp->word);
-
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting tag name.", lp->fname,
-    lp->lineno);
+  if (!lp->cur_rpt) {
+    fterr_warnx("%s line %d: Not in a report.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (lp->cur_def->ftd) {
-    fterr_warnx("%s line %d: Tag previously defined for definition.",
-    lp->fname, lp->lineno);
+  /* add a new entry to the list */
+  if (!(ftsro = (struct ftstat_rpt_out*)malloc(sizeof *ftsro))) {
+    fterr_warn("malloc()");
     return -1;
   }
 
-  /* delay loading the tags until one is requested */
-  if (load_tags(ftstat)) {
-    fterr_warnx("%s line %d: Tags not loaded.", lp->fname, lp->lineno);
-    return -1;
-  }
+  bzero(ftsro, sizeof *ftsro);
+  ftsro->f_dump = lp->cur_rpt->f_dump;
+  ftsro->fields = lp->cur_rpt->allowed_fields;
+  ftsro->fields &= ~(FT_STAT_FIELD_FRECS|
+                     FT_STAT_FIELD_INDEX|
+                     FT_STAT_FIELD_FIRST|
+                     FT_STAT_FIELD_LAST|
+                     FT_STAT_FIELD_PPS|
+                     FT_STAT_FIELD_BPS|
+                     FT_STAT_FIELD_QUANT); /* default some off */
+  ftsro->time = FT_STAT_TIME_MID;
+  lp->cur_rpt_out = ftsro;
 
-  if (!(lp->cur_def->ftd = fttag_def_find(&ftstat->fttag, lp->word))) {
-    fterr_warnx("%s line %d: Tag definition not found.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+  FT_STAILQ_INSERT_TAIL(&lp->cur_rpt->outs, ftsro, chain);
 
   return 0;
 
-} /* parse_def_tag */
+} /* parse_rpt_output */
 
 /* 
- * function: parse_def_mask
+ * function: parse_rpt_out_format
  *
- * process the 'mask' line.
+ * process the 'format' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_def_mask(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_out_format(struct line_parser *lp, struct ftstat *ftstat)
 {
+  enum ftstat_rpt_format format;
 
-  if (!lp->cur_def) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
     return -1;
   }
 
   NEXT_WORD(&lp->buf, lp->word);
 
   if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting mask name.", lp->fname,
+    fterr_warnx("%s line %d: Expecting format.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  if (lp->cur_def->ftd) {
-    fterr_warnx("%s line %d: Mask previously defined for definition.",
-    lp->fname, lp->lineno);
+  if (!(strcasecmp(lp->word, "ascii")))
+    format = FT_STAT_FMT_ASCII;
+  else if (!(strcasecmp(lp->word, "binary")))
+    format = FT_STAT_FMT_BINARY;
+  else {
+    fterr_warnx("%s line %d: Unrecognized format.", lp->fname, lp->lineno);
     return -1;
   }
 
-  /* delay loading the tags until one is requested */
-  if (load_masks(ftstat)) {
-    fterr_warnx("%s line %d: Masks not loaded.", lp->fname, lp->lineno);
+  /* summaries and reports of nested tables have no fixed rows */
+  if ((format == FT_STAT_FMT_BINARY) &&
+    (((void*)lp->cur_rpt->f_dump == (void*)ftstat_rpt_1_dump) ||
+     ((void*)lp->cur_rpt->f_dump == (void*)ftstat_rpt_2_dump) ||
+     ((void*)lp->cur_rpt->f_dump == (void*)ftstat_rpt_66_dump) ||
+     ((void*)lp->cur_rpt->f_dump == (void*)ftstat_rpt_67_dump) ||
+     ((void*)lp->cur_rpt->f_dump == (void*)ftstat_rpt_75_dump))) {
+    fterr_warnx("%s line %d: No binary format for type %s.", lp->fname,
+      lp->lineno, lp->cur_rpt->format_name);
     return -1;
   }
 
-  if (!(lp->cur_def->ftmd = ftmask_def_find(&ftstat->ftmask, lp->word))) {
-    fterr_warnx("%s line %d: Mask definition not found.", lp->fname,
-    lp->lineno);
-    return -1;
-  }
+  lp->cur_rpt->format = format;
+  lp->cur_rpt_out->format = format;
 
   return 0;
 
-} /* parse_def_mask */
+} /* parse_rpt_out_format */
 
 /* 
- * function: parse_def_time_series
+ * function: parse_rpt_out_sort
  *
- * process the 'time-series' line.
+ * process the 'sort' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_def_time_series(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_out_sort(struct line_parser *lp, struct ftstat *ftstat)
 {
+  int sort_field, sort_order;
+  char *c;
 
-  if (!lp->cur_def) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
     return -1;
   }
 
   NEXT_WORD(&lp->buf, lp->word);
-
+  
   if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting time in seconds.", lp->fname,
+    fterr_warnx("%s line %d: Expecting sort field.", lp->fname,
     lp->lineno);
     return -1;
   }
 
-  if (lp->cur_def->max_time) {
-    fterr_warnx("%s line %d: Time previously defined for definition.",
-    lp->fname, lp->lineno);
-    return -1;
-  }
-
-  lp->cur_def->max_time = strtoul(lp->word, (char**)0L, 0);
-  lp->cur_def->xfields |= FT_XFIELD_UNIX_SECS;
-
-  return 0;
-
-} /* parse_def_time_series */
-
-
-/* 
- * function: parse_def_report
- *
- * process the 'report' line.
- *
- * resolve_reports() _must_ be called after the configuration file has
- * been parsed and before the parse buffer is released.
- *
- * returns: 0  ok
- *          <0 fail
- */
-int parse_def_report(struct line_parser *lp, struct ftstat *ftstat)
-{
-  struct ftstat_rpt_item *ftsrpti;
-  int n;
+  c = lp->word;
 
-  if (!lp->cur_def) {
-    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+  if (*c == '+')
+    sort_order = FT_STAT_SORT_ASCEND;
+  else if (*c == '-')
+    sort_order = FT_STAT_SORT_DESCEND;
+  else {
+    fterr_warnx("%s line %d: Expecting + or -.", lp->fname, lp->lineno);
     return -1;
   }
 
-  NEXT_WORD(&lp->buf, lp->word);
+  ++c;
 
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting report name.", lp->fname,
-    lp->lineno);
+  if (!(strcasecmp(c, "key")))
+    sort_field = FT_STAT_FIELD_KEY;
+  else if (!(strcasecmp(c, "key1")))
+    sort_field = FT_STAT_FIELD_KEY1;
+  else if (!(strcasecmp(c, "key2")))
+    sort_field = FT_STAT_FIELD_KEY2;
+  else if (!(strcasecmp(c, "key3")))
+    sort_field = FT_STAT_FIELD_KEY3;
+  else if (!(strcasecmp(c, "key4")))
+    sort_field = FT_STAT_FIELD_KEY4;
+  else if (!(strcasecmp(c, "key5")))
+    sort_field = FT_STAT_FIELD_KEY5;
+  else if (!(strcasecmp(c, "key6")))
+    sort_field = FT_STAT_FIELD_KEY6;
+  else if (!(strcasecmp(c, "flows")))
+    sort_field = FT_STAT_FIELD_FLOWS;
+  else if (!(strcasecmp(c, "octets")))
+    sort_field = FT_STAT_FIELD_OCTETS;
+  else if (!(strcasecmp(c, "packets")))
+    sort_field = FT_STAT_FIELD_PACKETS;
+  else if (!(strcasecmp(c, "duration")))
+    sort_field = FT_STAT_FIELD_DURATION;
+  else if (!(strcasecmp(c, "avg-pps")))
+    sort_field = FT_STAT_FIELD_AVG_PPS;
+  else if (!(strcasecmp(c, "min-pps")))
+    sort_field = FT_STAT_FIELD_MIN_PPS;
+  else if (!(strcasecmp(c, "max-pps")))
+    sort_field = FT_STAT_FIELD_MAX_PPS;
+  else if (!(strcasecmp(c, "avg-bps")))
+    sort_field = FT_STAT_FIELD_AVG_BPS;
+  else if (!(strcasecmp(c, "min-bps")))
+    sort_field = FT_STAT_FIELD_MIN_BPS;
+  else if (!(strcasecmp(c, "max-bps")))
+    sort_field = FT_STAT_FIELD_MAX_BPS;
+  else if (!(strcasecmp(c, "other")))
+    sort_field = FT_STAT_FIELD_OTHER;
+  else if (!(strcasecmp(c, "count")))
+    sort_field = FT_STAT_FIELD_COUNT;
+  else if (!(strcasecmp(c, "")))
+    sort_field = 0;
+  else {
+    fterr_warnx("%s line %d: Unrecognized field.", lp->fname, lp->lineno);
     return -1;
   }
 
-  /* make sure this report is only added once */
-  FT_STAILQ_FOREACH(ftsrpti, &lp->cur_def->items, chain) {
+  if (sort_field) {
 
-    if (!(strcasecmp(lp->word, ftsrpti->tmp_report))) {
-      fterr_warnx("%s line %d: Duplicate report in definition.", lp->fname,
-        lp->lineno);
+    /* make sure that the field selected is valid for this report type */
+    if ((lp->cur_rpt->allowed_fields & sort_field) != sort_field) {
+      fterr_warnx("%s line %d: field \"%s\" selected not available for report.",
+        lp->fname, lp->lineno, c);
       return -1;
     }
 
-  }
+    lp->cur_rpt_out->sort_field = sort_field;
+    lp->cur_rpt_out->sort_order = sort_order;
+    lp->cur_rpt_out->options |= FT_STAT_OPT_SORT;
 
-  /* add this report to the list */
-  if (!(ftsrpti = (struct ftstat_rpt_item*)malloc (sizeof *ftsrpti))) {
-    fterr_warn("malloc()");
-    return -1;
   }
 
-  bzero(ftsrpti, sizeof *ftsrpti);
-
-  /* resolve this later in resolve_reports(); */
-  n = strlen(lp->word);
-  if (!(ftsrpti->tmp_report = malloc(n+1)))
-    fterr_errx(1, "malloc(tmp_report): failed");
-  strcpy(ftsrpti->tmp_report, lp->word);
-
-  FT_STAILQ_INSERT_TAIL(&lp->cur_def->items, ftsrpti, chain);
-
   return 0;
 
-} /* parse_def_report */
-
+} /* parse_rpt_out_sort */
 
 /* 
- * function: parse_include_tag
+ * function: parse_rpt_out_records
  *
- * process the 'include-tag' line.  Allow the default tag location
- * to be changed.
+ * process the 'records' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_include_tag(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_out_records(struct line_parser *lp, struct ftstat *ftstat)
 {
 
-  NEXT_WORD(&lp->buf, lp->word);
-  
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (ftstat->tag_fname) {
-    fterr_warnx("%s line %d: Tag pathname previously specified.",
-    lp->fname, lp->lineno);
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting num records.", lp->fname,
+    lp->lineno);
     return -1;
   }
 
-  if (!(ftstat->tag_fname = malloc(strlen(lp->word)+1)))
-    fterr_errx(1, "malloc(tag_fname): failed");
-  strcpy(ftstat->tag_fname, lp->word);
+  lp->cur_rpt_out->records = strtoull(lp->word, (char**)0L, 0);
 
   return 0;
 
-} /* parse_include_tag */
+} /* parse_rpt_out_records */
 
 /* 
- * function: parse_include_filter
+ * function: parse_rpt_out_tally
  *
- * process the 'include-filter' line.  Allow the default filter location
- * to be changed.
+ * process the 'tally' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_include_filter(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_out_tally(struct line_parser *lp, struct ftstat *ftstat)
 {
 
-  NEXT_WORD(&lp->buf, lp->word);
-  
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (ftstat->filter_fname) {
-    fterr_warnx("%s line %d: Filter pathname previously specified.",
-    lp->fname, lp->lineno);
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting tally increment.", lp->fname,
+    lp->lineno);
     return -1;
   }
 
-  if (!(ftstat->filter_fname = malloc(strlen(lp->word)+1)))
-    fterr_errx(1, "malloc(filter_fname): failed");
-  strcpy(ftstat->filter_fname, lp->word);
+  lp->cur_rpt_out->tally = strtoul(lp->word, (char**)0L, 0);
+
+  if (lp->cur_rpt_out->tally)
+    lp->cur_rpt_out->options |= FT_STAT_OPT_TALLY;
+  else
+    lp->cur_rpt_out->options &= ~FT_STAT_OPT_TALLY;
 
   return 0;
 
-} /* parse_include_filter */
+} /* parse_rpt_out_tally */
 
 /* 
- * function: parse_include_mask
+ * function: parse_rpt_out_fields
  *
- * process the 'include-mask' line.  Allow the default mask location
- * to be changed.
+ * process the 'fields' line.
  *
  * returns: 0  ok
  *          <0 fail
  */
-int parse_include_mask(struct line_parser *lp, struct ftstat *ftstat)
+int parse_rpt_out_fields(struct line_parser *lp, struct ftstat *ftstat)
 {
+  char *c, op;
+  uint32_t nfields;
 
-  NEXT_WORD(&lp->buf, lp->word);
-  
-  if (!lp->word) {
-    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
     return -1;
   }
 
-  if (ftstat->mask_fname) {
-    fterr_warnx("%s line %d: Mask pathname previously specified.",
-    lp->fname, lp->lineno);
+  if (!lp->buf) {
+    fterr_warnx("%s line %d: Expecting display fields.", lp->fname,
+    lp->lineno);
     return -1;
   }
 
-  if (!(ftstat->mask_fname = malloc(strlen(lp->word)+1)))
-    fterr_errx(1, "malloc(mask_fname): failed");
-  strcpy(ftstat->mask_fname, lp->word);
+  c = lp->buf;
 
-  return 0;
+  while (c) {
 
-} /* parse_include_mask */
+    for (;;) {
+      c = strsep(&lp->buf, " ,");
+      if ((c && *c) || (!c))
+        break;
+    }
 
-/*
- *************************************************************************
-                     ftstat_rpt_*_new/free/accum/dump 
- *************************************************************************
- */
+    if (!c)
+      break;
 
+    /* + to select, - to remove */
+    op = *c++;
 
-/* function: ftstat_rpt_1_new
- *
- * Allocate and initialize data structures for rpt 1.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_1 *ftstat_rpt_1_new(struct ftstat_rpt *rpt)
-{
-  struct ftstat_rpt_1 *rpt1;
+    if ((op != '+') && (op != '-')) {
+      fterr_warnx("%s line %d: Expecting +field or -field.", lp->fname,
+        lp->lineno);
+      return -1;
+    }
 
-  if (!(rpt1 = (struct ftstat_rpt_1*)malloc(sizeof (*rpt1)))) {
-    fterr_warnx("malloc(rpt1): failed");
-    return (struct ftstat_rpt_1*)0L;
-  }
+    nfields = 0;
+
+    if (!(strcasecmp(c, "index")))
+      nfields |= FT_STAT_FIELD_INDEX;
+    else if (!(strcasecmp(c, "first")))
+      nfields |= FT_STAT_FIELD_FIRST;
+    else if (!(strcasecmp(c, "last")))
+      nfields |= FT_STAT_FIELD_LAST;
+    else if (!(strcasecmp(c, "key")))
+      nfields |= FT_STAT_FIELD_KEY;
+    else if (!(strcasecmp(c, "key1")))
+      nfields |= FT_STAT_FIELD_KEY1;
+    else if (!(strcasecmp(c, "key2")))
+      nfields |= FT_STAT_FIELD_KEY2;
+    else if (!(strcasecmp(c, "key3")))
+      nfields |= FT_STAT_FIELD_KEY3;
+    else if (!(strcasecmp(c, "key4")))
+      nfields |= FT_STAT_FIELD_KEY4;
+    else if (!(strcasecmp(c, "key5")))
+      nfields |= FT_STAT_FIELD_KEY5;
+    else if (!(strcasecmp(c, "key6")))
+      nfields |= FT_STAT_FIELD_KEY6;
+    else if (!(strcasecmp(c, "flows")))
+      nfields |= FT_STAT_FIELD_FLOWS;
+    else if (!(strcasecmp(c, "octets")))
+      nfields |= FT_STAT_FIELD_OCTETS;
+    else if (!(strcasecmp(c, "packets")))
+      nfields |= FT_STAT_FIELD_PACKETS;
+    else if (!(strcasecmp(c, "duration")))
+      nfields |= FT_STAT_FIELD_DURATION;
+    else if (!(strcasecmp(c, "pps")))
+      nfields |= FT_STAT_FIELD_PPS;
+    else if (!(strcasecmp(c, "avg-pps")))
+      nfields |= FT_STAT_FIELD_AVG_PPS;
+    else if (!(strcasecmp(c, "min-pps")))
+      nfields |= FT_STAT_FIELD_MIN_PPS;
+    else if (!(strcasecmp(c, "max-pps")))
+      nfields |= FT_STAT_FIELD_MAX_PPS;
+    else if (!(strcasecmp(c, "bps")))
+      nfields |= FT_STAT_FIELD_BPS;
+    else if (!(strcasecmp(c, "avg-bps")))
+      nfields |= FT_STAT_FIELD_AVG_BPS;
+    else if (!(strcasecmp(c, "min-bps")))
+      nfields |= FT_STAT_FIELD_MIN_BPS;
+    else if (!(strcasecmp(c, "max-bps")))
+      nfields |= FT_STAT_FIELD_MAX_BPS;
+    else if (!(strcasecmp(c, "other")))
+      nfields |= FT_STAT_FIELD_OTHER;
+    else if (!(strcasecmp(c, "generic")))
+      nfields |= FT_STAT_FIELD_GENERIC;
+    else if (!(strcasecmp(c, "count")))
+      nfields |= FT_STAT_FIELD_COUNT;
+    else if (!(strcasecmp(c, "frecs")))
+      nfields |= FT_STAT_FIELD_FRECS;
+    else if (!(strcasecmp(c, "quantiles")))
+      nfields |= FT_STAT_FIELD_QUANT;
+    else if (!(strcasecmp(c, "duration-quantiles")))
+      nfields |= FT_STAT_FIELD_QDURATION;
+    else if (!(strcasecmp(c, "pps-quantiles")))
+      nfields |= FT_STAT_FIELD_QPPS;
+    else if (!(strcasecmp(c, "bps-quantiles")))
+      nfields |= FT_STAT_FIELD_QBPS;
+    else if (!(strcasecmp(c, "opp-quantiles")))
+      nfields |= FT_STAT_FIELD_QOPP;
+    else if (!(strcasecmp(c, "")))
+      nfields |= 0;
+    else {
+      fterr_warnx("%s line %d: Unrecognized field.", lp->fname, lp->lineno);
+      return -1;
+    }
+
+    /* make sure that the field is valid for this report type */
+
+    if ((lp->cur_rpt->allowed_fields & nfields) != nfields) {
+      fterr_warnx(
+        "%s line %d: field \"%s\" selected not available for report.",
+        lp->fname, lp->lineno, c);
+      return -1;
+    }
+
+    if (op == '+')
+      lp->cur_rpt_out->fields |= nfields;
+    else if (op == '-')
+      lp->cur_rpt_out->fields &= ~nfields;
+
+    nfields = 0;
+
+  } /* c */
+
+  return 0;
+
+} /* parse_rpt_out_fields */
+
+/* 
+ * function: parse_rpt_out_options
+ *
+ * process the 'options' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_rpt_out_options(struct line_parser *lp, struct ftstat *ftstat)
+{
+  int options;
+  char *c, op;
+
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!lp->buf) {
+    fterr_warnx("%s line %d: Expecting options.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  c = lp->buf;
+
+  while (c) {
+
+    for (;;) {
+      c = strsep(&lp->buf, " ,");
+      if ((c && *c) || (!c))
+        break;
+    }
+
+    if (!c)
+      break;
+
+    /* + to select, - to remove */
+    op = *c++;
+
+    if ((op != '+') && (op != '-')) {
+      fterr_warnx("%s line %d: Expecting +option or -option.", lp->fname,
+        lp->lineno);
+      return -1;
+    }
+
+    options = 0;
+
+    if (!(strcasecmp(c, "percent-total")))
+      options |= FT_STAT_OPT_PERCENT;
+    else if (!(strcasecmp(c, "names")))
+      options |= FT_STAT_OPT_NAMES;
+    else if (!(strcasecmp(c, "header")))
+      options |= FT_STAT_OPT_HEADER;
+    else if (!(strcasecmp(c, "xheader")))
+      options |= FT_STAT_OPT_XHEADER;
+    else if (!(strcasecmp(c, "totals")))
+      options |= FT_STAT_OPT_TOTALS;
+    else {
+      fterr_warnx("%s line %d: Unrecognized option.", lp->fname, lp->lineno);
+      return -1;
+    }
+
+    /* make sure that the option is valid for this report type */
+
+    if ((lp->cur_rpt->allowed_options & options) != options) {
+      fterr_warnx("%s line %d: option selected not available for report.",
+        lp->fname, lp->lineno);
+      return -1;
+    }
+
+    if (op == '+') 
+      lp->cur_rpt_out->options |= options;
+    else if (op == '-')
+      lp->cur_rpt_out->options &= ~options;
+
+    options = 0;
+
+  } /* c */
+
+  return 0;
+
+} /* parse_rpt_out_options */
+
+/* 
+ * function: parse_rpt_out_path
+ *
+ * process the 'path' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_rpt_out_path(struct line_parser *lp, struct ftstat *ftstat)
+{
+  char *c;
+  int len;
+
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!lp->buf) {
+    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  len = strlen(lp->buf);
+
+  if (!(c = malloc(len+1))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  strcpy(c, lp->buf);
+
+  lp->cur_rpt_out->path = c;
+
+  /* eat the line */
+  for (; *(lp->buf); ++lp->buf);
+
+  return 0;
+
+} /* parse_rpt_out_path */
+
+/* 
+ * function: parse_rpt_out_time
+ *
+ * process the 'time' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_rpt_out_time(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  if (!lp->cur_rpt_out) {
+    fterr_warnx("%s line %d: Not in report output.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting time specifier.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  if (!(strcasecmp(lp->word, "now")))
+    lp->cur_rpt_out->time = FT_STAT_TIME_NOW;
+  else if (!(strcasecmp(lp->word, "start")))
+    lp->cur_rpt_out->time = FT_STAT_TIME_START;
+  else if (!(strcasecmp(lp->word, "end")))
+    lp->cur_rpt_out->time = FT_STAT_TIME_END;
+  else if (!(strcasecmp(lp->word, "mid")))
+    lp->cur_rpt_out->time = FT_STAT_TIME_MID;
+  else {
+    fterr_warnx("%s line %d: Invalid time specifier.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  return 0;
+
+} /* parse_rpt_out_time */
+
+/*
+ *************************************************************************
+                             parse_def_* 
+ *************************************************************************
+ */
+
+/* 
+ * function: parse_def
+ *
+ * process the 'stat-definition' line.  Each definition has a unique name
+ * which is added to the ftstat->defs linked list.  The current
+ * definition is updated in lp.  Definitions reference reports
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def(struct line_parser *lp, struct ftstat *ftstat)
+{
+  char *c;
+  struct ftstat_def *ftsd;
+   
+  NEXT_WORD(&lp->buf, c);
+  
+  if (!c) {
+    fterr_warnx("%s line %d: Expecting name.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  /* check if it exists */
+  FT_SLIST_FOREACH(ftsd, &ftstat->defs, chain) {
+
+    if (!strcasecmp(c, ftsd->name)) {
+      fterr_warnx("%s line %d: Name (%s) previously defined.", lp->fname,
+        lp->lineno, c);
+      return -1;
+    }
+
+  }
+
+  /* no, add a new entry to the list */
+  if (!(ftsd = (struct ftstat_def*)malloc(sizeof *ftsd))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  bzero(ftsd, sizeof *ftsd);
+  FT_STAILQ_INIT(&ftsd->items);
+
+  if (!(ftsd->name = (char*)malloc(strlen(c)+1))) {
+    fterr_warn("malloc()");
+    free(ftsd);
+    return -1;
+  }
+
+  strcpy(ftsd->name, c);
+  ftsd->ftstat = ftstat;
+
+  FT_SLIST_INSERT_HEAD(&ftstat->defs, ftsd, chain);
+
+  lp->state = PARSE_STATE_DEFINITION;
+  lp->cur_def = ftsd;
+
+  return 0;
+
+} /* parse_def */
+
+/* 
+ * function: parse_def_filter
+ *
+ * process the 'filter' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def_filter(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  if (!lp->cur_def) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting filter name.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  if (lp->cur_def->ftfd) {
+    fterr_warnx("%s line %d: Filter previously defined for definition.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  /* delay loading the filters until one is requested */
+  if (load_filters(ftstat)) {
+    fterr_warnx("%s line %d: Filters not loaded.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(lp->cur_def->ftfd = ftfil_def_find(&ftstat->ftfil,
+    lp->word))) {
+    fterr_warnx("%s line %d: Filter definition not found.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  return 0;
+
+} /* parse_def_filter */
+
+/* 
+ * function: parse_def_tag
+ *
+ * process the 'tag' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def_tag(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  if (!lp->cur_def) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting tag name.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  if (lp->cur_def->ftd) {
+    fterr_warnx("%s line %d: Tag previously defined for definition.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  /* delay loading the tags until one is requested */
+  if (load_tags(ftstat)) {
+    fterr_warnx("%s line %d: Tags not loaded.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(lp->cur_def->ftd = fttag_def_find(&ftstat->fttag, lp->word))) {
+    fterr_warnx("%s line %d: Tag definition not found.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  return 0;
+
+} /* parse_def_tag */
+
+/* 
+ * function: parse_def_mask
+ *
+ * process the 'mask' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def_mask(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  if (!lp->cur_def) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting mask name.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  if (lp->cur_def->ftd) {
+    fterr_warnx("%s line %d: Mask previously defined for definition.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  /* delay loading the tags until one is requested */
+  if (load_masks(ftstat)) {
+    fterr_warnx("%s line %d: Masks not loaded.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(lp->cur_def->ftmd = ftmask_def_find(&ftstat->ftmask, lp->word))) {
+    fterr_warnx("%s line %d: Mask definition not found.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  return 0;
+
+} /* parse_def_mask */
+
+/* 
+ * function: parse_def_time_series
+ *
+ * process the 'time-series' line.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def_time_series(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  if (!lp->cur_def) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting time in seconds.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  if (lp->cur_def->max_time || lp->cur_def->window) {
+    fterr_warnx("%s line %d: Time previously defined for definition.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  lp->cur_def->max_time = strtoul(lp->word, (char**)0L, 0);
+  lp->cur_def->xfields |= FT_XFIELD_UNIX_SECS;
+
+  return 0;
+
+} /* parse_def_time_series */
+
+/* 
+ * function: parse_def_window
+ *
+ * process the 'window' line.  window seconds [slide_seconds]
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def_window(struct line_parser *lp, struct ftstat *ftstat)
+{
+  uint32_t window, slide;
+
+  if (!lp->cur_def) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting time in seconds.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  if (lp->cur_def->max_time || lp->cur_def->window) {
+    fterr_warnx("%s line %d: Time previously defined for definition.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  window = strtoul(lp->word, (char**)0L, 0);
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (lp->word)
+    slide = strtoul(lp->word, (char**)0L, 0);
+  else
+    slide = window;
+
+  if (!window || !slide || (slide > window) || (window % slide)) {
+    fterr_warnx("%s line %d: Slide must divide window.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  lp->cur_def->window = window;
+  lp->cur_def->slide = slide;
+
+  return 0;
+
+} /* parse_def_window */
+
+
+/* 
+ * function: parse_def_report
+ *
+ * process the 'report' line.
+ *
+ * resolve_reports() _must_ be called after the configuration file has
+ * been parsed and before the parse buffer is released.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_def_report(struct line_parser *lp, struct ftstat *ftstat)
+{
+  struct ftstat_rpt_item *ftsrpti;
+  int n;
+
+  if (!lp->cur_def) {
+    fterr_warnx("%s line %d: Must set name first.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  NEXT_WORD(&lp->buf, lp->word);
+
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting report name.", lp->fname,
+    lp->lineno);
+    return -1;
+  }
+
+  /* make sure this report is only added once */
+  FT_STAILQ_FOREACH(ftsrpti, &lp->cur_def->items, chain) {
+
+    if (!(strcasecmp(lp->word, ftsrpti->tmp_report))) {
+      fterr_warnx("%s line %d: Duplicate report in definition.", lp->fname,
+        lp->lineno);
+      return -1;
+    }
+
+  }
+
+  /* add this report to the list */
+  if (!(ftsrpti = (struct ftstat_rpt_item*)malloc (sizeof *ftsrpti))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
+
+  bzero(ftsrpti, sizeof *ftsrpti);
+
+  /* resolve this later in resolve_reports(); */
+  n = strlen(lp->word);
+  if (!(ftsrpti->tmp_report = malloc(n+1)))
+    fterr_errx(1, "malloc(tmp_report): failed");
+  strcpy(ftsrpti->tmp_report, lp->word);
+
+  FT_STAILQ_INSERT_TAIL(&lp->cur_def->items, ftsrpti, chain);
+
+  return 0;
+
+} /* parse_def_report */
+
+
+/* 
+ * function: parse_include_tag
+ *
+ * process the 'include-tag' line.  Allow the default tag location
+ * to be changed.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_include_tag(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  NEXT_WORD(&lp->buf, lp->word);
+  
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (ftstat->tag_fname) {
+    fterr_warnx("%s line %d: Tag pathname previously specified.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(ftstat->tag_fname = malloc(strlen(lp->word)+1)))
+    fterr_errx(1, "malloc(tag_fname): failed");
+  strcpy(ftstat->tag_fname, lp->word);
+
+  return 0;
+
+} /* parse_include_tag */
+
+/* 
+ * function: parse_include_filter
+ *
+ * process the 'include-filter' line.  Allow the default filter location
+ * to be changed.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_include_filter(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  NEXT_WORD(&lp->buf, lp->word);
+  
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (ftstat->filter_fname) {
+    fterr_warnx("%s line %d: Filter pathname previously specified.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(ftstat->filter_fname = malloc(strlen(lp->word)+1)))
+    fterr_errx(1, "malloc(filter_fname): failed");
+  strcpy(ftstat->filter_fname, lp->word);
+
+  return 0;
+
+} /* parse_include_filter */
+
+/* 
+ * function: parse_include_mask
+ *
+ * process the 'include-mask' line.  Allow the default mask location
+ * to be changed.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+int parse_include_mask(struct line_parser *lp, struct ftstat *ftstat)
+{
+
+  NEXT_WORD(&lp->buf, lp->word);
+  
+  if (!lp->word) {
+    fterr_warnx("%s line %d: Expecting pathname.", lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (ftstat->mask_fname) {
+    fterr_warnx("%s line %d: Mask pathname previously specified.",
+    lp->fname, lp->lineno);
+    return -1;
+  }
+
+  if (!(ftstat->mask_fname = malloc(strlen(lp->word)+1)))
+    fterr_errx(1, "malloc(mask_fname): failed");
+  strcpy(ftstat->mask_fname, lp->word);
+
+  return 0;
+
+} /* parse_include_mask */
+
+/*
+ *************************************************************************
+                     ftstat_rpt_*_new/free/accum/dump 
+ *************************************************************************
+ */
+
+
+/* function: ftstat_rpt_1_new
+ *
+ * Allocate and initialize data structures for rpt 1.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_1 *ftstat_rpt_1_new(struct ftstat_rpt *rpt)
+{
+  struct ftstat_rpt_1 *rpt1;
+
+  if (!(rpt1 = (struct ftstat_rpt_1*)malloc(sizeof (*rpt1)))) {
+    fterr_warnx("malloc(rpt1): failed");
+    return (struct ftstat_rpt_1*)0L;
+  }
+
+  bzero(rpt1, sizeof *rpt1);
+
+  return rpt1;
+
+} /* ftstat_rpt_1_new */
+
+
+/* function: ftstat_rpt_1_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_1_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+  struct ftstat_rpt_1 *rpt1;
+  struct fts3rec_all2 cur;
+  uint32_t time_tmp, duration_tmp;
+  double pps_tmp, bps_tmp;
+  uint32_t p;
+
+  STD_ACCUM;
+
+  rpt1 = rpt->data;
+
+  time_tmp = cur.unix_secs;
+  
+  if (time_tmp < rpt1->time_start)
+    rpt1->time_start = time_tmp;
+  
+  if (time_tmp > rpt1->time_end)
+    rpt1->time_end = time_tmp;
+
+  if (cur.First < rpt1->start)
+    rpt1->start = cur.First;
+  
+  if (cur.Last > rpt1->end)
+    rpt1->end = cur.Last;
+
+  p = cur.dOctets64 / cur.dPkts64;
+
+  if (p <= 32) ++ rpt1->psize32;
+  else if (p <= 64) ++ rpt1->psize64;
+  else if (p <= 96) ++ rpt1->psize96;
+  else if (p <= 128) ++ rpt1->psize128;
+  else if (p <= 160) ++ rpt1->psize160;
+  else if (p <= 192) ++ rpt1->psize192;
+  else if (p <= 224) ++ rpt1->psize224;
+  else if (p <= 256) ++ rpt1->psize256;
+  else if (p <= 288) ++ rpt1->psize288;
+  else if (p <= 320) ++ rpt1->psize320;
+  else if (p <= 352) ++ rpt1->psize352;
+  else if (p <= 384) ++ rpt1->psize384;
+  else if (p <= 416) ++ rpt1->psize416;
+  else if (p <= 448) ++ rpt1->psize448;
+  else if (p <= 480) ++ rpt1->psize480;
+  else if (p <= 512) ++ rpt1->psize512;
+  else if (p <= 544) ++ rpt1->psize544;
+  else if (p <= 576) ++ rpt1->psize576;
+  else if (p <= 1024) ++ rpt1->psize1024;
+  else if (p <= 1536) ++ rpt1->psize1536;
+  else if (p <= 2048) ++ rpt1->psize2048;
+  else if (p <= 2560) ++ rpt1->psize2560;
+  else if (p <= 3072) ++ rpt1->psize3072;
+  else if (p <= 3584) ++ rpt1->psize3584;
+  else if (p <= 4096) ++ rpt1->psize4096;
+  else if (p <= 4608) ++ rpt1->psize4608;
+
+  p = cur.dPkts64;
+
+  if (p <= 1) ++ rpt1->fpsize1;
+  else if (p <= 2) ++ rpt1->fpsize2;
+  else if (p <= 4) ++ rpt1->fpsize4;
+  else if (p <= 8) ++ rpt1->fpsize8;  
+  else if (p <= 12) ++ rpt1->fpsize12;
+  else if (p <= 16) ++ rpt1->fpsize16;
+  else if (p <= 20) ++ rpt1->fpsize20;
+  else if (p <= 24) ++ rpt1->fpsize24;
+  else if (p <= 28) ++ rpt1->fpsize28;
+  else if (p <= 32) ++ rpt1->fpsize32;
+  else if (p <= 36) ++ rpt1->fpsize36;
+  else if (p <= 40) ++ rpt1->fpsize40;
+  else if (p <= 44) ++ rpt1->fpsize44;
+  else if (p <= 48) ++ rpt1->fpsize48;
+  else if (p <= 52) ++ rpt1->fpsize52;
+  else if (p <= 60) ++ rpt1->fpsize60;
+  else if (p <= 100) ++ rpt1->fpsize100;
+  else if (p <= 200) ++ rpt1->fpsize200;
+  else if (p <= 300) ++ rpt1->fpsize300;
+  else if (p <= 400) ++ rpt1->fpsize400;
+  else if (p <= 500) ++ rpt1->fpsize500;
+  else if (p <= 600) ++ rpt1->fpsize600;
+  else if (p <= 700) ++ rpt1->fpsize700;
+  else if (p <= 800) ++ rpt1->fpsize800;
+  else if (p <= 900) ++ rpt1->fpsize900;
+  else ++ rpt1->fpsize_other;
+
+  p = cur.dOctets64;
+
+  if (p <= 32) ++ rpt1->fosize32;
+  else if (p <= 64) ++ rpt1->fosize64;
+  else if (p <= 128) ++ rpt1->fosize128;
+  else if (p <= 256) ++ rpt1->fosize256;
+  else if (p <= 512) ++ rpt1->fosize512;
+  else if (p <= 1280) ++ rpt1->fosize1280;
+  else if (p <= 2048) ++ rpt1->fosize2048;
+  else if (p <= 2816) ++ rpt1->fosize2816;
+  else if (p <= 3584) ++ rpt1->fosize3584;
+  else if (p <= 4352) ++ rpt1->fosize4352;
+  else if (p <= 5120) ++ rpt1->fosize5120;
+  else if (p <= 5888) ++ rpt1->fosize5888;
+  else if (p <= 6656) ++ rpt1->fosize6656;
+  else if (p <= 7424) ++ rpt1->fosize7424;
+  else if (p <= 8192) ++ rpt1->fosize8192;
+  else if (p <= 8960) ++ rpt1->fosize8960;
+  else if (p <= 9728) ++ rpt1->fosize9728;
+  else if (p <= 10496) ++ rpt1->fosize10496;
+  else if (p <= 11264) ++ rpt1->fosize11264;
+  else if (p <= 12032) ++ rpt1->fosize12032;
+  else if (p <= 12800) ++ rpt1->fosize12800;
+  else if (p <= 13568) ++ rpt1->fosize13568;
+  else if (p <= 14336) ++ rpt1->fosize14336;
+  else if (p <= 15104) ++ rpt1->fosize15104;
+  else if (p <= 15872) ++ rpt1->fosize15872;
+  else ++ rpt1->fosize_other;
+
+  p = cur.Last - cur.First;
+  rpt1->time += p;
+    
+  if (p <= 10) ++ rpt1->ftime10;
+  else if (p <= 50) ++ rpt1->ftime50;
+  else if (p <= 100) ++ rpt1->ftime100;
+  else if (p <= 200) ++ rpt1->ftime200;
+  else if (p <= 500) ++ rpt1->ftime500;
+  else if (p <= 1000) ++ rpt1->ftime1000;
+  else if (p <= 2000) ++ rpt1->ftime2000;
+  else if (p <= 3000) ++ rpt1->ftime3000;
+  else if (p <= 4000) ++ rpt1->ftime4000;
+  else if (p <= 5000) ++ rpt1->ftime5000;
+  else if (p <= 6000) ++ rpt1->ftime6000;
+  else if (p <= 7000) ++ rpt1->ftime7000;
+  else if (p <= 8000) ++ rpt1->ftime8000;
+  else if (p <= 9000) ++ rpt1->ftime9000;
+  else if (p <= 10000) ++ rpt1->ftime10000;
+  else if (p <= 12000) ++ rpt1->ftime12000;
+  else if (p <= 14000) ++ rpt1->ftime14000;
+  else if (p <= 16000) ++ rpt1->ftime16000;
+  else if (p <= 18000) ++ rpt1->ftime18000;
+  else if (p <= 20000) ++ rpt1->ftime20000;
+  else if (p <= 22000) ++ rpt1->ftime22000;
+  else if (p <= 24000) ++ rpt1->ftime24000;
+  else if (p <= 26000) ++ rpt1->ftime26000;
+  else if (p <= 28000) ++ rpt1->ftime28000;
+  else if (p <= 30000) ++ rpt1->ftime30000;
+  else ++ rpt1->ftime_other;
+
+  return 0;
+
+} /* ftstat_rpt_1_accum */
+
+/* function: ftstat_rpt_1_calc
+ *
+ * Perform final calculations for rpt1
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_1_calc(struct ftstat_rpt *rpt)
+{
+  struct ftstat_rpt_1 *rpt1;
+  uint32_t dif;
+
+  rpt1 = rpt->data;
+
+  STD_CALC;
+
+  rpt1->time_real = rpt1->time_end - rpt1->time_start;
+  dif = rpt1->end - rpt1->start;
+
+  if (rpt->t_flows) {
+    rpt1->aflowtime = rpt1->time / rpt->t_flows;
+    rpt1->afs = rpt->t_octets / rpt->t_flows;
+    rpt1->apf = rpt->t_packets / rpt->t_flows;
+  }
+
+  if (rpt->t_packets)
+    rpt1->aps = rpt->t_octets / rpt->t_packets;
+ 
+  if (dif) 
+    rpt1->fps = (double)rpt->t_flows / (dif / 1000.0);
+
+  if (rpt1->time_real)
+    rpt1->fps_real = (double)rpt->t_flows / (double)rpt1->time_real;
+
+  return 0;
+
+} /* ftstat_rpt_1_calc */
+
+/* function: ftstat_rpt_1_merge
+ *
+ * Merge the counters accumulated by src into rpt1
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_1_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+  struct ftstat_rpt_1 *rpt1, *src1;
+  uint64_t *d, *s;
+  int i, n;
+
+  rpt1 = rpt->data;
+  src1 = src->data;
+
+  rpt_merge_totals(rpt, src);
+
+  rpt1->time += src1->time;
+
+  if (src1->start < rpt1->start)
+    rpt1->start = src1->start;
+
+  if (src1->end > rpt1->end)
+    rpt1->end = src1->end;
+
+  if (src1->time_start < rpt1->time_start)
+    rpt1->time_start = src1->time_start;
+
+  if (src1->time_end > rpt1->time_end)
+    rpt1->time_end = src1->time_end;
+
+  /* the histograms are consecutive counters, psize32 .. ftime_other */
+  d = &rpt1->psize32;
+  s = &src1->psize32;
+  n = &rpt1->ftime_other - &rpt1->psize32 + 1;
+
+  for (i = 0; i < n; ++i)
+    d[i] += s[i];
+
+  return 0;
+
+} /* ftstat_rpt_1_merge */
+
+/* function: ftstat_rpt_1_save
+ *
+ * Write the counters of rpt1 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_1_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+  struct ftstat_rpt_1 *rpt1;
+  uint32_t n;
+
+  rpt1 = rpt->data;
+
+  n = &rpt1->ftime_other - &rpt1->psize32 + 1;
+
+  if (state_write(fp, &rpt1->time, sizeof rpt1->time) ||
+      state_write(fp, &rpt1->start, sizeof rpt1->start) ||
+      state_write(fp, &rpt1->end, sizeof rpt1->end) ||
+      state_write(fp, &rpt1->time_start, sizeof rpt1->time_start) ||
+      state_write(fp, &rpt1->time_end, sizeof rpt1->time_end) ||
+      state_write(fp, &n, sizeof n) ||
+      state_write(fp, &rpt1->psize32, n * sizeof (uint64_t)))
+    return -1;
+
+  return 0;
+
+} /* ftstat_rpt_1_save */
+
+/* function: ftstat_rpt_1_load
+ *
+ * Merge counters written by ftstat_rpt_1_save() into rpt1
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_1_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+  struct ftstat_rpt_1 *rpt1, tmp;
+  struct ftstat_rpt src;
+  uint32_t n;
+
+  rpt1 = rpt->data;
+  bzero(&tmp, sizeof tmp);
+
+  if (state_read(fp, &tmp.time, sizeof tmp.time) ||
+      state_read(fp, &tmp.start, sizeof tmp.start) ||
+      state_read(fp, &tmp.end, sizeof tmp.end) ||
+      state_read(fp, &tmp.time_start, sizeof tmp.time_start) ||
+      state_read(fp, &tmp.time_end, sizeof tmp.time_end) ||
+      state_read(fp, &n, sizeof n))
+    return -1;
+
+  if (n != &rpt1->ftime_other - &rpt1->psize32 + 1) {
+    fterr_warnx("%s: state has %lu counters.", rpt->name, (unsigned long)n);
+    return -1;
+  }
+
+  if (state_read(fp, &tmp.psize32, n * sizeof (uint64_t)))
+    return -1;
+
+  /* the totals were merged by the caller, leave them alone */
+  bzero(&src, sizeof src);
+  src.data = &tmp;
+  src.time_start = rpt->time_start;
+  src.time_end = rpt->time_end;
+
+  return ftstat_rpt_1_merge(rpt, &src);
+
+} /* ftstat_rpt_1_load */
+
+/* function: ftstat_rpt_1_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_1_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+  struct ftstat_rpt_1 *rpt1;
+  char fmt_buf[1024];
+
+  rpt1 = rpt->data;
+
+  fprintf(fp, "# rec2: time_real,aflowtime,aps,afs,apf,fps,fps_real,");
+  fprintf(fp, "psize32,psize64,psize96,psize128,psize160,psize192,psize224,psize256,psize288,psize320,psize352,psize384,psize416,psize448,psize480,psize512,psize544,psize576,psize1024,psize1536,psize2048,psize2560,psize3072,psize3584,>psize4096,psize4608,");
+  fprintf(fp, "fpsize1,fpsize2,fpsize4,fpsize8,fpsize12,fpsize16,fpsize20,fpsize24,fpsize28,fpsize32,fpsize36,fpsize40,fpsize44,fpsize48,fpsize52,fpsize60,fpsize100,fpsize200,fpsize300,fpsize400,fpsize500,fpsize600,fpsize700,fpsize800,fpsize900,fpsize_other,");
+  fprintf(fp, "fosize32,fosize64,fosize128,fosize256,fosize512,fosize1280,fosize2048,fosize2816,fosize3584,fosize4352,fosize5120,fosize5888,fosize6656,fosize7424,fosize8192,fosize8960,fosize9728,fosize10496,fosize11264,fosize12032,fosize12800,fosize13568,fosize14336,fosize15104,fosize15872,fosize_other,");
+  fprintf(fp, "ftime10,ftime50,ftime100,ftime200,ftime500,ftime1000,ftime2000,ftime3000,ftime4000,ftime5000,ftime6000,ftime7000,ftime8000,ftime9000,ftime10000,ftime12000,ftime14000,ftime16000,ftime18000,ftime20000,ftime22000,ftime24000,ftime26000,ftime28000,ftime30000,ftime_other\n");
+
+  fmt_uint64(fmt_buf, rpt1->time_real, FMT_JUST_LEFT);
+
+  fprintf(fp, "%s,%f,%f,%f,%f,%f,%f,", fmt_buf, rpt1->aflowtime,
+    rpt1->aps, rpt1->afs, rpt1->apf, rpt1->fps, rpt1->fps_real);
+
+  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,",
+    (double)rpt1->psize32 / (double)rpt->t_flows,
+    (double)rpt1->psize64 / (double)rpt->t_flows,
+    (double)rpt1->psize96 / (double)rpt->t_flows,
+    (double)rpt1->psize128 / (double)rpt->t_flows,
+    (double)rpt1->psize160 / (double)rpt->t_flows,
+    (double)rpt1->psize192 / (double)rpt->t_flows,
+    (double)rpt1->psize224 / (double)rpt->t_flows,
+    (double)rpt1->psize256 / (double)rpt->t_flows,
+    (double)rpt1->psize288 / (double)rpt->t_flows,
+    (double)rpt1->psize320 / (double)rpt->t_flows,
+    (double)rpt1->psize352 / (double)rpt->t_flows,
+    (double)rpt1->psize384 / (double)rpt->t_flows,
+    (double)rpt1->psize416 / (double)rpt->t_flows,
+    (double)rpt1->psize448 / (double)rpt->t_flows,
+    (double)rpt1->psize480 / (double)rpt->t_flows,
+    (double)rpt1->psize512 / (double)rpt->t_flows,
+    (double)rpt1->psize544 / (double)rpt->t_flows,
+    (double)rpt1->psize576 / (double)rpt->t_flows,
+    (double)rpt1->psize1024 / (double)rpt->t_flows,
+    (double)rpt1->psize1536 / (double)rpt->t_flows,
+    (double)rpt1->psize2048 / (double)rpt->t_flows,
+    (double)rpt1->psize2560 / (double)rpt->t_flows,
+    (double)rpt1->psize3072 / (double)rpt->t_flows,
+    (double)rpt1->psize3584 / (double)rpt->t_flows,
+    (double)rpt1->psize4096 / (double)rpt->t_flows,
+    (double)rpt1->psize4608 / (double)rpt->t_flows);
+
+  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,",
+    (double)rpt1->fpsize1 / (double)rpt->t_flows,
+    (double)rpt1->fpsize2 / (double)rpt->t_flows,
+    (double)rpt1->fpsize4 / (double)rpt->t_flows,
+    (double)rpt1->fpsize8 / (double)rpt->t_flows,
+    (double)rpt1->fpsize12 / (double)rpt->t_flows,
+    (double)rpt1->fpsize16 / (double)rpt->t_flows,
+    (double)rpt1->fpsize20 / (double)rpt->t_flows,
+    (double)rpt1->fpsize24 / (double)rpt->t_flows,
+    (double)rpt1->fpsize28 / (double)rpt->t_flows,
+    (double)rpt1->fpsize32 / (double)rpt->t_flows,
+    (double)rpt1->fpsize36 / (double)rpt->t_flows,
+    (double)rpt1->fpsize40 / (double)rpt->t_flows,
+    (double)rpt1->fpsize44 / (double)rpt->t_flows,
+    (double)rpt1->fpsize48 / (double)rpt->t_flows,
+    (double)rpt1->fpsize52 / (double)rpt->t_flows,
+    (double)rpt1->fpsize60 / (double)rpt->t_flows,
+    (double)rpt1->fpsize100 / (double)rpt->t_flows,
+    (double)rpt1->fpsize200 / (double)rpt->t_flows,
+    (double)rpt1->fpsize300 / (double)rpt->t_flows,
+    (double)rpt1->fpsize400 / (double)rpt->t_flows,
+    (double)rpt1->fpsize500 / (double)rpt->t_flows,
+    (double)rpt1->fpsize600 / (double)rpt->t_flows,
+    (double)rpt1->fpsize700 / (double)rpt->t_flows,
+    (double)rpt1->fpsize800 / (double)rpt->t_flows,
+    (double)rpt1->fpsize900 / (double)rpt->t_flows,
+    (double)rpt1->fpsize_other / (double)rpt->t_flows);
+
+  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,",
+    (double)rpt1->fosize32 / (double)rpt->t_flows,
+    (double)rpt1->fosize64 / (double)rpt->t_flows,
+    (double)rpt1->fosize128 / (double)rpt->t_flows,
+    (double)rpt1->fosize256 / (double)rpt->t_flows,
+    (double)rpt1->fosize512 / (double)rpt->t_flows,
+    (double)rpt1->fosize1280 / (double)rpt->t_flows,
+    (double)rpt1->fosize2048 / (double)rpt->t_flows,
+    (double)rpt1->fosize2816 / (double)rpt->t_flows,
+    (double)rpt1->fosize3584 / (double)rpt->t_flows,
+    (double)rpt1->fosize4352 / (double)rpt->t_flows,
+    (double)rpt1->fosize5120 / (double)rpt->t_flows,
+    (double)rpt1->fosize5888 / (double)rpt->t_flows,
+    (double)rpt1->fosize6656 / (double)rpt->t_flows,
+    (double)rpt1->fosize7424 / (double)rpt->t_flows,
+    (double)rpt1->fosize8192 / (double)rpt->t_flows,
+    (double)rpt1->fosize8960 / (double)rpt->t_flows,
+    (double)rpt1->fosize9728 / (double)rpt->t_flows,
+    (double)rpt1->fosize10496 / (double)rpt->t_flows,
+    (double)rpt1->fosize11264 / (double)rpt->t_flows,
+    (double)rpt1->fosize12032 / (double)rpt->t_flows,
+    (double)rpt1->fosize12800 / (double)rpt->t_flows,
+    (double)rpt1->fosize13568 / (double)rpt->t_flows,
+    (double)rpt1->fosize14336 / (double)rpt->t_flows,
+    (double)rpt1->fosize15104 / (double)rpt->t_flows,
+    (double)rpt1->fosize15872 / (double)rpt->t_flows,
+    (double)rpt1->fosize_other / (double)rpt->t_flows);
+
+  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f\n",
+    (double)rpt1->ftime10 / (double)rpt->t_flows,
+    (double)rpt1->ftime50 / (double)rpt->t_flows,
+    (double)rpt1->ftime100 / (double)rpt->t_flows,
+    (double)rpt1->ftime200 / (double)rpt->t_flows,
+    (double)rpt1->ftime500 / (double)rpt->t_flows,
+    (double)rpt1->ftime1000 / (double)rpt->t_flows,
+    (double)rpt1->ftime2000 / (double)rpt->t_flows,
+    (double)rpt1->ftime3000 / (double)rpt->t_flows,
+    (double)rpt1->ftime4000 / (double)rpt->t_flows,
+    (double)rpt1->ftime5000 / (double)rpt->t_flows,
+    (double)rpt1->ftime6000 / (double)rpt->t_flows,
+    (double)rpt1->ftime7000 / (double)rpt->t_flows,
+    (double)rpt1->ftime8000 / (double)rpt->t_flows,
+    (double)rpt1->ftime9000 / (double)rpt->t_flows,
+    (double)rpt1->ftime10000 / (double)rpt->t_flows,
+    (double)rpt1->ftime12000 / (double)rpt->t_flows,
+    (double)rpt1->ftime14000 / (double)rpt->t_flows,
+    (double)rpt1->ftime16000 / (double)rpt->t_flows,
+    (double)rpt1->ftime18000 / (double)rpt->t_flows,
+    (double)rpt1->ftime20000 / (double)rpt->t_flows,
+    (double)rpt1->ftime22000 / (double)rpt->t_flows,
+    (double)rpt1->ftime24000 / (double)rpt->t_flows,
+    (double)rpt1->ftime26000 / (double)rpt->t_flows,
+    (double)rpt1->ftime28000 / (double)rpt->t_flows,
+    (double)rpt1->ftime30000 / (double)rpt->t_flows,
+    (double)rpt1->ftime_other / (double)rpt->t_flows);
+
+
+  return 0;
+
+} /* ftstat_rpt_1_dump */
+
+
+/* function: ftstat_rpt_1_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_1_new
+ *
+ */
+void ftstat_rpt_1_free(struct ftstat_rpt_1 *rpt1)
+{
+  if (rpt1)
+    free(rpt1);
+} /* ftstat_rpt_1_free */
+
+
+/* function: ftstat_rpt_2_new
+ *
+ * Allocate and initialize data structures for rpt 2.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_2 *ftstat_rpt_2_new(struct ftstat_rpt *rpt)
+{
+  struct ftstat_rpt_2 *rpt2;
+
+  if (!(rpt2 = (struct ftstat_rpt_2*)malloc(sizeof (*rpt2)))) {
+    fterr_warnx("malloc(rpt2): failed");
+    return (struct ftstat_rpt_2*)0L;
+  }
+
+  bzero(rpt2, sizeof *rpt2);
+
+  return rpt2;
+
+} /* ftstat_rpt_2_new */
+
+
+/* function: ftstat_rpt_2_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_2_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+  struct fts3rec_all2 cur;
+  uint32_t duration_tmp;
+  double pps_tmp, bps_tmp;
+
+  STD_ACCUM;
+
+  return 0;
+} /* ftstat_rpt_2_accum */
+
+/* function: ftstat_rpt_2_calc
+ *
+ * Perform final calculations for rpt2
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_2_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC;
+
+  return 0;
+
+} /* ftstat_rpt_2_calc */
+
+/* function: ftstat_rpt_2_merge
+ *
+ * Merge the counters accumulated by src into rpt2
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_2_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  rpt_merge_totals(rpt, src);
+
+  return 0;
+
+} /* ftstat_rpt_2_merge */
+
+/* function: ftstat_rpt_2_save
+ *
+ * rpt2 is all totals, written by the caller
+ *
+ * returns 0: ok
+ */
+int ftstat_rpt_2_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  return 0;
+
+} /* ftstat_rpt_2_save */
+
+/* function: ftstat_rpt_2_load
+ *
+ * rpt2 is all totals, merged by the caller
+ *
+ * returns 0: ok
+ */
+int ftstat_rpt_2_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  return 0;
+
+} /* ftstat_rpt_2_load */
+
+
+/* function: ftstat_rpt_2_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_2_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+  return 0;
+} /* ftstat_rpt_2_dump */
+
+
+/* function: ftstat_rpt_2_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_2_new
+ *
+ */
+void ftstat_rpt_2_free(struct ftstat_rpt_2 *rpt2)
+{
+  if (rpt2)
+    free(rpt2);
+} /* ftstat_rpt_2_free */
+
+
+/* function: ftstat_rpt_3_new
+ *
+ * Allocate and initialize data structures for rpt 3.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_3 *ftstat_rpt_3_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_3, rpt3, 65536, ftchash_rec_c32, 4, 65536);
+
+} /* ftstat_rpt_3_new */
+
+
+/* function: ftstat_rpt_3_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_3_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_3, rpt3, ftchash_rec_c32, ftch_recc32,
+    ftch_recc32p);
+
+  ftch_recc32.c32 = cur.dOctets64 / cur.dPkts64;
+
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt3, ftch_recc32, ftch_recc32p);
+
+  return 0;
+
+} /* ftstat_rpt_3_accum */
+
+/* function: ftstat_rpt_3_calc
+ *
+ * Perform final calculations for rpt3
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_3_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_3, rpt3, ftchash_rec_c32, ftch_recc32);
+
+} /* ftstat_rpt_3_calc */
+
+/* function: ftstat_rpt_3_merge
+ *
+ * Merge the counters accumulated by src into rpt3
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_3_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_3, ftchash_rec_c32);
+
+} /* ftstat_rpt_3_merge */
+
+/* function: ftstat_rpt_3_save
+ *
+ * Write the counters of rpt3 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_3_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_3, ftchash_rec_c32);
+
+} /* ftstat_rpt_3_save */
+
+/* function: ftstat_rpt_3_load
+ *
+ * Merge counters written by ftstat_rpt_3_save() into rpt3
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_3_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_3, ftchash_rec_c32);
+
+} /* ftstat_rpt_3_load */
+
+/* function: ftstat_rpt_3_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_3_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1(ftstat_rpt_3, rpt3, chash_c32_dump, (char*)0L,
+    "packet size/flow", "", "", "", "", "", "");
+
+} /* ftstat_rpt_3_dump */
+
+
+/* function: ftstat_rpt_3_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_3_new
+ *
+ */
+void ftstat_rpt_3_free(struct ftstat_rpt_3 *rpt3)
+{
+
+  STD_FREE_HASH(rpt3);
+
+} /* ftstat_rpt_3_free */
+
+
+/* function: ftstat_rpt_4_new
+ *
+ * Allocate and initialize data structures for rpt 4.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_4 *ftstat_rpt_4_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_4, rpt4, 65536, ftchash_rec_c64, 8, 65536);
+
+} /* ftstat_rpt_4_new */
+
+
+/* function: ftstat_rpt_4_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_4_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_4, rpt4, ftchash_rec_c64, ftch_recc64,
+    ftch_recc64p);
+
+  ftch_recc64.c64 = cur.dOctets64;
+     
+  hash = ftch_recc64.c64 & 0x000000FFFFFFLL; 
+  hash = (hash>>16) ^ (hash & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt4, ftch_recc64, ftch_recc64p);
+  
+  return 0;
+
+} /* ftstat_rpt_4_accum */
+
+/* function: ftstat_rpt_4_calc
+ *
+ * Perform final calculations for rpt4
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_4_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_4, rpt4, ftchash_rec_c64, ftch_recc64);
+
+} /* ftstat_rpt_4_calc */
+
+/* function: ftstat_rpt_4_merge
+ *
+ * Merge the counters accumulated by src into rpt4
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_4_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_4, ftchash_rec_c64);
+
+} /* ftstat_rpt_4_merge */
+
+/* function: ftstat_rpt_4_save
+ *
+ * Write the counters of rpt4 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_4_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_4, ftchash_rec_c64);
+
+} /* ftstat_rpt_4_save */
+
+/* function: ftstat_rpt_4_load
+ *
+ * Merge counters written by ftstat_rpt_4_save() into rpt4
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_4_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_4, ftchash_rec_c64);
+
+} /* ftstat_rpt_4_load */
+
+/* function: ftstat_rpt_4_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_4_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_4, rpt4, chash_c64_dump,
+    "octets/flow", "", "", "", "", "", "");
+
+} /* ftstat_rpt_4_dump */
+
+
+/* function: ftstat_rpt_4_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_4_new
+ *
+ */
+void ftstat_rpt_4_free(struct ftstat_rpt_4 *rpt4)
+{
+
+  STD_FREE_HASH(rpt4);
+
+} /* ftstat_rpt_4_free */
+
+
+/* function: ftstat_rpt_5_new
+ *
+ * Allocate and initialize data structures for rpt 5.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_5 *ftstat_rpt_5_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_5, rpt5, 65536, ftchash_rec_c64, 8, 65536);
+
+} /* ftstat_rpt_5_new */
+
+
+/* function: ftstat_rpt_5_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_5_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_5, rpt5, ftchash_rec_c64, ftch_recc64,
+    ftch_recc64p);
+
+  ftch_recc64.c64 = cur.dPkts64;
+  
+  hash = ftch_recc64.c64 & 0x000000FFFFFFLL; 
+  hash = (hash>>16) ^ (hash & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt5, ftch_recc64, ftch_recc64p);
+  
+  return 0;
+
+} /* ftstat_rpt_5_accum */
+
+/* function: ftstat_rpt_5_calc
+ *
+ * Perform final calculations for rpt5
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_5_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_5, rpt5, ftchash_rec_c64, ftch_recc64);
+
+} /* ftstat_rpt_5_calc */
+
+/* function: ftstat_rpt_5_merge
+ *
+ * Merge the counters accumulated by src into rpt5
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_5_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_5, ftchash_rec_c64);
+
+} /* ftstat_rpt_5_merge */
+
+/* function: ftstat_rpt_5_save
+ *
+ * Write the counters of rpt5 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_5_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_5, ftchash_rec_c64);
+
+} /* ftstat_rpt_5_save */
+
+/* function: ftstat_rpt_5_load
+ *
+ * Merge counters written by ftstat_rpt_5_save() into rpt5
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_5_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_5, ftchash_rec_c64);
+
+} /* ftstat_rpt_5_load */
+
+/* function: ftstat_rpt_5_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_5_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_5, rpt5, chash_c64_dump,
+    "packets/flow", "", "", "", "", "", "");
+
+} /* ftstat_rpt_5_dump */
+
+
+/* function: ftstat_rpt_5_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_5_new
+ *
+ */
+void ftstat_rpt_5_free(struct ftstat_rpt_5 *rpt5)
+{
+
+  STD_FREE_HASH(rpt5);
+
+} /* ftstat_rpt_5_free */
+
+
+/* function: ftstat_rpt_6_new
+ *
+ * Allocate and initialize data structures for rpt 6.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_6 *ftstat_rpt_6_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_6, rpt6, 65536, rpt);
+
+} /* ftstat_rpt_6_new */
+
+
+/* function: ftstat_rpt_6_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_6_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_6, rpt6);
+
+  FT_RECGET_SRCPORT(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt6->bucket, cur.srcport);
+
+  return 0;
+
+} /* ftstat_rpt_6_accum */
+
+/* function: ftstat_rpt_6_calc
+ *
+ * Perform final calculations for rpt6
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_6_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_6, rpt6, 65536);
+
+} /* ftstat_rpt_6_calc */
+
+/* function: ftstat_rpt_6_merge
+ *
+ * Merge the counters accumulated by src into rpt6
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_6_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_6, 65536);
+
+} /* ftstat_rpt_6_merge */
+
+/* function: ftstat_rpt_6_save
+ *
+ * Write the counters of rpt6 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_6_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_6, 65536);
+
+} /* ftstat_rpt_6_save */
+
+/* function: ftstat_rpt_6_load
+ *
+ * Merge counters written by ftstat_rpt_6_save() into rpt6
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_6_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_6, 65536);
+
+} /* ftstat_rpt_6_load */
+
+/* function: ftstat_rpt_6_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_6_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_6, rpt6, 65536, FT_PATH_SYM_TCP_PORT,
+    "ip-source-port", "", "", "", "", "", "");
+
+} /* ftstat_rpt_6_dump */
+
+
+/* function: ftstat_rpt_6_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_6_new
+ *
+ */
+void ftstat_rpt_6_free(struct ftstat_rpt_6 *rpt6)
+{
+
+  STD_FREE_BUCKET(rpt6);
+
+} /* ftstat_rpt_6_free */
+
+
+/* function: ftstat_rpt_7_new
+ *
+ * Allocate and initialize data structures for rpt 7.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_7 *ftstat_rpt_7_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_7, rpt7, 65536, rpt);
+
+} /* ftstat_rpt_7_new */
+
+
+/* function: ftstat_rpt_7_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_7_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_7, rpt7);
+
+  FT_RECGET_DSTPORT(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt7->bucket, cur.dstport);
+
+  return 0;
+
+} /* ftstat_rpt_7_accum */
+
+/* function: ftstat_rpt_7_calc
+ *
+ * Perform final calculations for rpt7
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_7_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_7, rpt7, 65536);
+
+} /* ftstat_rpt_7_calc */
+
+/* function: ftstat_rpt_7_merge
+ *
+ * Merge the counters accumulated by src into rpt7
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_7_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_7, 65536);
+
+} /* ftstat_rpt_7_merge */
+
+/* function: ftstat_rpt_7_save
+ *
+ * Write the counters of rpt7 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_7_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_7, 65536);
+
+} /* ftstat_rpt_7_save */
+
+/* function: ftstat_rpt_7_load
+ *
+ * Merge counters written by ftstat_rpt_7_save() into rpt7
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_7_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_7, 65536);
+
+} /* ftstat_rpt_7_load */
+
+/* function: ftstat_rpt_7_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_7_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_7, rpt7, 65536, FT_PATH_SYM_TCP_PORT,
+    "ip-destination-port", "", "", "", "", "", "");
+
+} /* ftstat_rpt_7_dump */
+
+
+/* function: ftstat_rpt_7_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_7_new
+ *
+ */
+void ftstat_rpt_7_free(struct ftstat_rpt_7 *rpt7)
+{
+
+  STD_FREE_BUCKET(rpt7);
+
+} /* ftstat_rpt_7_free */
+
+
+/* function: ftstat_rpt_8_new
+ *
+ * Allocate and initialize data structures for rpt 8.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_8 *ftstat_rpt_8_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_8, rpt8, 65536, ftchash_rec_c162, 4, 65536);
+
+} /* ftstat_rpt_8_new */
+
+
+/* function: ftstat_rpt_8_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_8_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_8, rpt8, ftchash_rec_c162, ftch_recc162,
+    ftch_recc162p);
+
+  FT_RECGET_DSTPORT(cur,rec,*fo);
+  FT_RECGET_SRCPORT(cur,rec,*fo);
+
+  ftch_recc162.c16a = cur.srcport;
+  ftch_recc162.c16b = cur.dstport;
+  
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+
+
+  STD_ACCUM_HASH2(rpt8, ftch_recc162, ftch_recc162p);
+
+  return 0;
+   
+} /* ftstat_rpt_8_accum */
+
+/* function: ftstat_rpt_8_calc
+ *
+ * Perform final calculations for rpt8
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_8_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_8, rpt8, ftchash_rec_c162, ftch_recc162);
+
+} /* ftstat_rpt_8_calc */
+
+/* function: ftstat_rpt_8_merge
+ *
+ * Merge the counters accumulated by src into rpt8
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_8_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_8, ftchash_rec_c162);
+
+} /* ftstat_rpt_8_merge */
+
+/* function: ftstat_rpt_8_save
+ *
+ * Write the counters of rpt8 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_8_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_8, ftchash_rec_c162);
+
+} /* ftstat_rpt_8_save */
+
+/* function: ftstat_rpt_8_load
+ *
+ * Merge counters written by ftstat_rpt_8_save() into rpt8
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_8_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_8, ftchash_rec_c162);
+
+} /* ftstat_rpt_8_load */
+
+/* function: ftstat_rpt_8_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_8_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH2(ftstat_rpt_8, rpt8, chash_c162_dump,
+    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-port", "ip-destination-port", "", "", "", "");
+
+} /* ftstat_rpt_8_dump */
+
+
+/* function: ftstat_rpt_8_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_8_new
+ *
+ */
+void ftstat_rpt_8_free(struct ftstat_rpt_8 *rpt8)
+{
+
+  STD_FREE_HASH(rpt8);
+
+} /* ftstat_rpt_8_free */
+
+
+/* function: ftstat_rpt_9_new
+ *
+ * Allocate and initialize data structures for rpt 9.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_9 *ftstat_rpt_9_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_9, rpt9, 65536, ftchash_rec_c64, 8, 65536);
+
+} /* ftstat_rpt_9_new */
+
+
+/* function: ftstat_rpt_9_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_9_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_9, rpt9, ftchash_rec_c64, ftch_recc64,
+    ftch_recc64p);
+
+  ftch_recc64.c64 = (duration_tmp) ?
+    (double)cur.dOctets64*8/((double)(duration_tmp)/1000.0) : 0;
+
+  hash = ftch_recc64.c64 & 0x000000FFFFFFLL;
+  hash = (hash>>16) ^ (hash & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt9, ftch_recc64, ftch_recc64p);
+
+  return 0;
+   
+} /* ftstat_rpt_9_accum */
+
+/* function: ftstat_rpt_9_calc
+ *
+ * Perform final calculations for rpt9
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_9_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_9, rpt9, ftchash_rec_c64, ftch_recc64);
+
+} /* ftstat_rpt_9_calc */
+
+/* function: ftstat_rpt_9_merge
+ *
+ * Merge the counters accumulated by src into rpt9
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_9_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_9, ftchash_rec_c64);
+
+} /* ftstat_rpt_9_merge */
+
+/* function: ftstat_rpt_9_save
+ *
+ * Write the counters of rpt9 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_9_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_9, ftchash_rec_c64);
+
+} /* ftstat_rpt_9_save */
+
+/* function: ftstat_rpt_9_load
+ *
+ * Merge counters written by ftstat_rpt_9_save() into rpt9
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_9_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_9, ftchash_rec_c64);
+
+} /* ftstat_rpt_9_load */
+
+
+/* function: ftstat_rpt_9_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_9_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_9, rpt9, chash_c64_dump,
+    "bps/flow", "", "", "", "", "", "");
+
+} /* ftstat_rpt_9_dump */
+
+
+/* function: ftstat_rpt_9_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_9_new
+ *
+ */
+void ftstat_rpt_9_free(struct ftstat_rpt_9 *rpt9)
+{
+
+  STD_FREE_HASH(rpt9);
+
+} /* ftstat_rpt_9_free */
+
+
+/* function: ftstat_rpt_10_new
+ *
+ * Allocate and initialize data structures for rpt 10.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_10 *ftstat_rpt_10_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_10, rpt10, 65536, ftchash_rec_c64, 8, 65536);
+
+} /* ftstat_rpt_10_new */
+
+
+/* function: ftstat_rpt_10_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_10_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_10, rpt10, ftchash_rec_c64, ftch_recc64,
+    ftch_recc64p);
+
+  ftch_recc64.c64 = (duration_tmp) ?
+    (double)cur.dPkts64/((double)(duration_tmp)/1000.0) : 0;
+
+  hash = ftch_recc64.c64 & 0x000000FFFFFFLL;
+  hash = (hash>>16) ^ (hash & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt10, ftch_recc64, ftch_recc64p);
+  
+  return 0;
+   
+} /* ftstat_rpt_10_accum */
+
+/* function: ftstat_rpt_10_calc
+ *
+ * Perform final calculations for rpt10
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_10_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_10, rpt10, ftchash_rec_c64, ftch_recc64);
+
+} /* ftstat_rpt_10_calc */
+
+/* function: ftstat_rpt_10_merge
+ *
+ * Merge the counters accumulated by src into rpt10
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_10_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_10, ftchash_rec_c64);
+
+} /* ftstat_rpt_10_merge */
+
+/* function: ftstat_rpt_10_save
+ *
+ * Write the counters of rpt10 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_10_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_10, ftchash_rec_c64);
+
+} /* ftstat_rpt_10_save */
+
+/* function: ftstat_rpt_10_load
+ *
+ * Merge counters written by ftstat_rpt_10_save() into rpt10
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_10_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_10, ftchash_rec_c64);
+
+} /* ftstat_rpt_10_load */
+
+/* function: ftstat_rpt_10_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_10_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_10, rpt10, chash_c64_dump,
+    "pps/flow", "", "", "", "", "", "");
+
+} /* ftstat_rpt_10_dump */
+
+
+/* function: ftstat_rpt_10_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_10_new
+ *
+ */
+void ftstat_rpt_10_free(struct ftstat_rpt_10 *rpt10)
+{
+
+  STD_FREE_HASH(rpt10);
+
+} /* ftstat_rpt_10_free */
+
+
+/* function: ftstat_rpt_11_new
+ *
+ * Allocate and initialize data structures for rpt 11.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_11 *ftstat_rpt_11_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_11, rpt11, 7, rpt);
+
+} /* ftstat_rpt_11_new */
+
+
+/* function: ftstat_rpt_11_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_11_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+  uint16_t tmp;
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_11, rpt11);
+
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+
+  if ((cur.dstaddr & 0xf0000000) == 0xf0000000)
+    tmp = 5; /* Class E Reserved */
+  else if ((cur.dstaddr & 0xff000000) == 0xe8000000)
+    tmp = 4; /* Class D Multicast-SSM */
+  else if ((cur.dstaddr & 0xf0000000) == 0xe0000000)
+    tmp = 3; /* Class D Multicast-ASM */
+  else if ((cur.dstaddr & 0xe0000000) == 0xc0000000)
+    tmp = 2; /* Class C Unicast */
+  else if ((cur.dstaddr & 0xc0000000) == 0x80000000)
+    tmp = 1; /* Class B Unicast */
+  else if ((cur.dstaddr & 0x80000000) == 0x00000000)
+    tmp = 0; /* Class A Unicast */
+  else
+    tmp = 6; /* not reached */
+  
+  STD_ACCUM_BUCKET2(rpt11->bucket, tmp);
+
+  return 0;
+
+} /* ftstat_rpt_11_accum */
+
+/* function: ftstat_rpt_11_calc
+ *
+ * Perform final calculations for rpt11
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_11_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_11, rpt11, 7);
+
+} /* ftstat_rpt_11_calc */
+
+/* function: ftstat_rpt_11_merge
+ *
+ * Merge the counters accumulated by src into rpt11
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_11_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_11, 7);
+
+} /* ftstat_rpt_11_merge */
+
+/* function: ftstat_rpt_11_save
+ *
+ * Write the counters of rpt11 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_11_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_11, 7);
+
+} /* ftstat_rpt_11_save */
+
+/* function: ftstat_rpt_11_load
+ *
+ * Merge counters written by ftstat_rpt_11_save() into rpt11
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_11_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_11, 7);
+
+} /* ftstat_rpt_11_load */
+
+/* function: ftstat_rpt_11_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_11_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_11, rpt11, 7, FT_PATH_SYM_IP_TYPE,
+    "ip-destination-address-type", "", "", "", "", "", "");
+
+} /* ftstat_rpt_11_dump */
+
+
+/* function: ftstat_rpt_11_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_11_new
+ *
+ */
+void ftstat_rpt_11_free(struct ftstat_rpt_11 *rpt11)
+{
+
+  STD_FREE_BUCKET(rpt11);
+
+} /* ftstat_rpt_11_free */
+
+
+/* function: ftstat_rpt_12_new
+ *
+ * Allocate and initialize data structures for rpt 12.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_12 *ftstat_rpt_12_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_12, rpt12, 256, rpt);
+
+} /* ftstat_rpt_12_new */
+
+
+/* function: ftstat_rpt_12_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_12_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_12, rpt12);
+
+  FT_RECGET_PROT(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt12->bucket, cur.prot);
+
+  return 0;
+
+} /* ftstat_rpt_12_accum */
+
+/* function: ftstat_rpt_12_calc
+ *
+ * Perform final calculations for rpt12
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_12_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_12, rpt12, 256);
+
+} /* ftstat_rpt_12_calc */
+
+/* function: ftstat_rpt_12_merge
+ *
+ * Merge the counters accumulated by src into rpt12
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_12_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_12, 256);
+
+} /* ftstat_rpt_12_merge */
+
+/* function: ftstat_rpt_12_save
+ *
+ * Write the counters of rpt12 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_12_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_12, 256);
+
+} /* ftstat_rpt_12_save */
+
+/* function: ftstat_rpt_12_load
+ *
+ * Merge counters written by ftstat_rpt_12_save() into rpt12
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_12_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_12, 256);
+
+} /* ftstat_rpt_12_load */
+
+/* function: ftstat_rpt_12_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_12_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_12, rpt12, 256, FT_PATH_SYM_IP_PROT,
+    "ip-protocol", "", "", "", "", "", "");
+} /* ftstat_rpt_12_dump */
+
+
+/* function: ftstat_rpt_12_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_12_new
+ *
+ */
+void ftstat_rpt_12_free(struct ftstat_rpt_12 *rpt12)
+{
+
+  STD_FREE_BUCKET(rpt12);
+
+} /* ftstat_rpt_12_free */
+
+
+/* function: ftstat_rpt_13_new
+ *
+ * Allocate and initialize data structures for rpt 13.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_13 *ftstat_rpt_13_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_13, rpt13, 256, rpt);
+
+} /* ftstat_rpt_13_new */
+
+
+/* function: ftstat_rpt_13_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_13_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_13, rpt13);
+
+  FT_RECGET_TOS(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt13->bucket, cur.tos);
+
+  return 0;
+
+} /* ftstat_rpt_13_accum */
+
+/* function: ftstat_rpt_13_calc
+ *
+ * Perform final calculations for rpt13
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_13_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_13, rpt13, 256);
+
+} /* ftstat_rpt_13_calc */
+
+/* function: ftstat_rpt_13_merge
+ *
+ * Merge the counters accumulated by src into rpt13
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_13_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_13, 256);
+
+} /* ftstat_rpt_13_merge */
+
+/* function: ftstat_rpt_13_save
+ *
+ * Write the counters of rpt13 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_13_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_13, 256);
+
+} /* ftstat_rpt_13_save */
+
+/* function: ftstat_rpt_13_load
+ *
+ * Merge counters written by ftstat_rpt_13_save() into rpt13
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_13_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_13, 256);
+
+} /* ftstat_rpt_13_load */
+
+/* function: ftstat_rpt_13_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_13_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_13, rpt13, 256, (char*)0L,
+    "ip-tos", "", "", "", "", "", "");
+
+} /* ftstat_rpt_13_dump */
+
+
+/* function: ftstat_rpt_13_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_13_new
+ *
+ */
+void ftstat_rpt_13_free(struct ftstat_rpt_13 *rpt13)
+{
+
+  STD_FREE_BUCKET(rpt13);
+
+} /* ftstat_rpt_13_free */
+
+
+/* function: ftstat_rpt_14_new
+ *
+ * Allocate and initialize data structures for rpt 14.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_14 *ftstat_rpt_14_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_14, rpt14, 65536, ftchash_rec_c32, 4, 65536);
+
+} /* ftstat_rpt_14_new */
+
+
+/* function: ftstat_rpt_14_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_14_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_14, rpt14, ftchash_rec_c32, ftch_recc32,
+    ftch_recc32p);
+
+  FT_RECGET_NEXTHOP(cur,rec,*fo);
+
+  ftch_recc32.c32 = cur.nexthop;
+
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt14, ftch_recc32, ftch_recc32p);
+
+  return 0;
+   
+} /* ftstat_rpt_14_accum */
+
+/* function: ftstat_rpt_14_calc
+ *
+ * Perform final calculations for rpt14
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_14_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_14, rpt14, ftchash_rec_c32, ftch_recc32);
+
+} /* ftstat_rpt_14_calc */
+
+/* function: ftstat_rpt_14_merge
+ *
+ * Merge the counters accumulated by src into rpt14
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_14_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_14, ftchash_rec_c32);
+
+} /* ftstat_rpt_14_merge */
+
+/* function: ftstat_rpt_14_save
+ *
+ * Write the counters of rpt14 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_14_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_14, ftchash_rec_c32);
+
+} /* ftstat_rpt_14_save */
+
+/* function: ftstat_rpt_14_load
+ *
+ * Merge counters written by ftstat_rpt_14_save() into rpt14
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_14_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_14, ftchash_rec_c32);
+
+} /* ftstat_rpt_14_load */
+
+/* function: ftstat_rpt_14_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_14_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_14, rpt14, chash_ip_dump,
+    "ip-next-hop-address", "", "", "", "", "", "");
+
+} /* ftstat_rpt_14_dump */
+
+
+/* function: ftstat_rpt_14_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_14_new
+ *
+ */
+void ftstat_rpt_14_free(struct ftstat_rpt_14 *rpt14)
+{
+
+  STD_FREE_HASH(rpt14);
+
+} /* ftstat_rpt_14_free */
+
+
+/* function: ftstat_rpt_15_new
+ *
+ * Allocate and initialize data structures for rpt 15.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_15 *ftstat_rpt_15_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_15, rpt15, 65536, ftchash_rec_prefix, 5, 65536);
+
+} /* ftstat_rpt_15_new */
+
+
+/* function: ftstat_rpt_15_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_15_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_15, rpt15, ftchash_rec_prefix, ftch_recprefix,
+    ftch_recprefixp);
+
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+ 
+  ftch_recprefix.prefix = cur.srcaddr;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix.mask = cur.src_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+
+  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefix.mask);
+
+  STD_ACCUM_HASH2(rpt15, ftch_recprefix, ftch_recprefixp);
+
+  return 0;
+   
+} /* ftstat_rpt_15_accum */
+
+/* function: ftstat_rpt_15_calc
+ *
+ * Perform final calculations for rpt15
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_15_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_15, rpt15, ftchash_rec_prefix, ftch_recprefix);
+
+} /* ftstat_rpt_15_calc */
+
+/* function: ftstat_rpt_15_merge
+ *
+ * Merge the counters accumulated by src into rpt15
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_15_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_15, ftchash_rec_prefix);
+
+} /* ftstat_rpt_15_merge */
+
+/* function: ftstat_rpt_15_save
+ *
+ * Write the counters of rpt15 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_15_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_15, ftchash_rec_prefix);
+
+} /* ftstat_rpt_15_save */
+
+/* function: ftstat_rpt_15_load
+ *
+ * Merge counters written by ftstat_rpt_15_save() into rpt15
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_15_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_15, ftchash_rec_prefix);
+
+} /* ftstat_rpt_15_load */
+
+/* function: ftstat_rpt_15_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_15_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0P(ftstat_rpt_15, rpt15, chash_prefix_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    "ip-source-address", "", "", "", "", "", "");
+
+} /* ftstat_rpt_15_dump */
+
+
+/* function: ftstat_rpt_15_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_15_new
+ *
+ */
+void ftstat_rpt_15_free(struct ftstat_rpt_15 *rpt15)
+{
+
+  STD_FREE_HASH(rpt15);
+
+} /* ftstat_rpt_15_free */
+
+
+/* function: ftstat_rpt_16_new
+ *
+ * Allocate and initialize data structures for rpt 16.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_16 *ftstat_rpt_16_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_16, rpt16, 65536, ftchash_rec_prefix, 5, 65536);
+
+} /* ftstat_rpt_16_new */
+
+
+/* function: ftstat_rpt_16_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_16_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_16, rpt16, ftchash_rec_prefix, ftch_recprefix,
+    ftch_recprefixp);
+
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+
+  ftch_recprefix.prefix = cur.dstaddr;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix.mask = cur.dst_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+
+  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefix.mask);
+
+  STD_ACCUM_HASH2(rpt16, ftch_recprefix, ftch_recprefixp);
+
+  return 0;
+   
+} /* ftstat_rpt_16_accum */
+
+/* function: ftstat_rpt_16_calc
+ *
+ * Perform final calculations for rpt16
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_16_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_16, rpt16, ftchash_rec_prefix, ftch_recprefix);
+
+} /* ftstat_rpt_16_calc */
+
+/* function: ftstat_rpt_16_merge
+ *
+ * Merge the counters accumulated by src into rpt16
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_16_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_16, ftchash_rec_prefix);
+
+} /* ftstat_rpt_16_merge */
+
+/* function: ftstat_rpt_16_save
+ *
+ * Write the counters of rpt16 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_16_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_16, ftchash_rec_prefix);
+
+} /* ftstat_rpt_16_save */
+
+/* function: ftstat_rpt_16_load
+ *
+ * Merge counters written by ftstat_rpt_16_save() into rpt16
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_16_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_16, ftchash_rec_prefix);
+
+} /* ftstat_rpt_16_load */
+
+/* function: ftstat_rpt_16_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_16_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0P(ftstat_rpt_16, rpt16, chash_prefix_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    "ip-destination-address", "", "", "", "", "", "");
+
+} /* ftstat_rpt_16_dump */
+
+
+/* function: ftstat_rpt_16_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_16_new
+ *
+ */
+void ftstat_rpt_16_free(struct ftstat_rpt_16 *rpt16)
+{
+
+  STD_FREE_HASH(rpt16);
+
+} /* ftstat_rpt_16_free */
+
+
+/* function: ftstat_rpt_17_new
+ *
+ * Allocate and initialize data structures for rpt 17.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_17 *ftstat_rpt_17_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_17, rpt17, 65536, ftchash_rec_prefix2, 16, 65536);
+
+} /* ftstat_rpt_17_new */
+
+
+/* function: ftstat_rpt_17_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_17_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_17, rpt17, ftchash_rec_prefix2, ftch_recprefix2,
+    ftch_recprefix2p);
+
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+
+  ftch_recprefix2.src_prefix = cur.srcaddr;
+  ftch_recprefix2.dst_prefix = cur.dstaddr;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix2.src_mask = cur.src_mask;
+  }
+
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix2.dst_mask = cur.dst_mask;
+  }
+  
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix2.src_prefix &= ipv4_len2mask(ftch_recprefix2.src_mask);
+  }
+
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix2.dst_prefix &= ipv4_len2mask(ftch_recprefix2.dst_mask);
+  }
+
+  hash = (ftch_recprefix2.src_prefix>>16)^
+          (ftch_recprefix2.src_prefix & 0xFFFF)^
+          (ftch_recprefix2.dst_prefix>>16)^
+          (ftch_recprefix2.dst_prefix & 0xFFFF)^
+          (ftch_recprefix2.src_mask)^
+          (uint32_t)(ftch_recprefix2.dst_mask<<8);
+
+  STD_ACCUM_HASH2(rpt17, ftch_recprefix2, ftch_recprefix2p);
+
+  return 0;
+   
+} /* ftstat_rpt_17_accum */
+
+/* function: ftstat_rpt_17_calc
+ *
+ * Perform final calculations for rpt17
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_17_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_17, rpt17, ftchash_rec_prefix2, ftch_recprefix2);
+
+} /* ftstat_rpt_17_calc */
+
+/* function: ftstat_rpt_17_merge
+ *
+ * Merge the counters accumulated by src into rpt17
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_17_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_17, ftchash_rec_prefix2);
+
+} /* ftstat_rpt_17_merge */
+
+/* function: ftstat_rpt_17_save
+ *
+ * Write the counters of rpt17 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_17_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_17, ftchash_rec_prefix2);
+
+} /* ftstat_rpt_17_save */
+
+/* function: ftstat_rpt_17_load
+ *
+ * Merge counters written by ftstat_rpt_17_save() into rpt17
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_17_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_17, ftchash_rec_prefix2);
+
+} /* ftstat_rpt_17_load */
+
+/* function: ftstat_rpt_17_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_17_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_17, rpt17, chash_prefix2_dump,
+    "", "ip-source-address", "ip-destination-address", "", "", "", "");
+
+} /* ftstat_rpt_17_dump */
+
+
+/* function: ftstat_rpt_17_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_17_new
+ *
+ */
+void ftstat_rpt_17_free(struct ftstat_rpt_17 *rpt17)
+{
+
+  STD_FREE_HASH(rpt17);
+
+} /* ftstat_rpt_17_free */
+
+
+/* function: ftstat_rpt_18_new
+ *
+ * Allocate and initialize data structures for rpt 18.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_18 *ftstat_rpt_18_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_18, rpt18, 65536, ftchash_rec_c32, 4, 65536);
+
+} /* ftstat_rpt_18_new */
+
+
+/* function: ftstat_rpt_18_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_18_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_18, rpt18, ftchash_rec_c32, ftch_recc32,
+    ftch_recc32p);
+
+  FT_RECGET_EXADDR(cur,rec,*fo);
+
+  ftch_recc32.c32 = cur.exaddr;
+  
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt18, ftch_recc32, ftch_recc32p);
+  
+  return 0;
+   
+} /* ftstat_rpt_18_accum */
+
+/* function: ftstat_rpt_18_calc
+ *
+ * Perform final calculations for rpt18
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_18_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_18, rpt18, ftchash_rec_c32, ftch_recc32);
+
+} /* ftstat_rpt_18_calc */
+
+/* function: ftstat_rpt_18_merge
+ *
+ * Merge the counters accumulated by src into rpt18
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_18_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_18, ftchash_rec_c32);
+
+} /* ftstat_rpt_18_merge */
+
+/* function: ftstat_rpt_18_save
+ *
+ * Write the counters of rpt18 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_18_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_18, ftchash_rec_c32);
+
+} /* ftstat_rpt_18_save */
+
+/* function: ftstat_rpt_18_load
+ *
+ * Merge counters written by ftstat_rpt_18_save() into rpt18
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_18_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_18, ftchash_rec_c32);
+
+} /* ftstat_rpt_18_load */
+
+/* function: ftstat_rpt_18_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_18_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH0(ftstat_rpt_18, rpt18, chash_ip_dump,
+    "ip-exporter-address", "", "", "", "", "", "");
+
+} /* ftstat_rpt_18_dump */
+
+
+/* function: ftstat_rpt_18_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_18_new
+ *
+ */
+void ftstat_rpt_18_free(struct ftstat_rpt_18 *rpt18)
+{
+
+  STD_FREE_HASH(rpt18);
+
+} /* ftstat_rpt_18_free */
+
+
+/* function: ftstat_rpt_19_new
+ *
+ * Allocate and initialize data structures for rpt 19.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_19 *ftstat_rpt_19_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_19, rpt19, 65536, rpt);
+
+} /* ftstat_rpt_19_new */
+
+
+/* function: ftstat_rpt_19_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_19_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_19, rpt19);
+
+  FT_RECGET_INPUT(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt19->bucket, cur.input);
+
+  return 0;
+
+} /* ftstat_rpt_19_accum */
+
+/* function: ftstat_rpt_19_calc
+ *
+ * Perform final calculations for rpt19
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_19_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_19, rpt19, 65536);
+
+} /* ftstat_rpt_19_calc */
+
+/* function: ftstat_rpt_19_merge
+ *
+ * Merge the counters accumulated by src into rpt19
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_19_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_19, 65536);
+
+} /* ftstat_rpt_19_merge */
+
+/* function: ftstat_rpt_19_save
+ *
+ * Write the counters of rpt19 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_19_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_19, 65536);
+
+} /* ftstat_rpt_19_save */
+
+/* function: ftstat_rpt_19_load
+ *
+ * Merge counters written by ftstat_rpt_19_save() into rpt19
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_19_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_19, 65536);
+
+} /* ftstat_rpt_19_load */
+
+/* function: ftstat_rpt_19_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_19_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_19, rpt19, 65536, (char*)0L,
+    "input-interface", "", "", "", "", "", "");
+
+} /* ftstat_rpt_19_dump */
+
+
+/* function: ftstat_rpt_19_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_19_new
+ *
+ */
+void ftstat_rpt_19_free(struct ftstat_rpt_19 *rpt19)
+{
+
+  STD_FREE_BUCKET(rpt19);
+
+} /* ftstat_rpt_19_free */
+
+
+/* function: ftstat_rpt_20_new
+ *
+ * Allocate and initialize data structures for rpt 20.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_20 *ftstat_rpt_20_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_20, rpt20, 65536, rpt);
+
+} /* ftstat_rpt_20_new */
+
+
+/* function: ftstat_rpt_20_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_20_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_20, rpt20);
+
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt20->bucket, cur.output);
+
+  return 0;
+
+} /* ftstat_rpt_20_accum */
+
+/* function: ftstat_rpt_20_calc
+ *
+ * Perform final calculations for rpt20
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_20_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_20, rpt20, 65536);
+
+} /* ftstat_rpt_20_calc */
+
+/* function: ftstat_rpt_20_merge
+ *
+ * Merge the counters accumulated by src into rpt20
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_20_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_20, 65536);
+
+} /* ftstat_rpt_20_merge */
+
+/* function: ftstat_rpt_20_save
+ *
+ * Write the counters of rpt20 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_20_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_20, 65536);
+
+} /* ftstat_rpt_20_save */
+
+/* function: ftstat_rpt_20_load
+ *
+ * Merge counters written by ftstat_rpt_20_save() into rpt20
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_20_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_20, 65536);
+
+} /* ftstat_rpt_20_load */
+
+/* function: ftstat_rpt_20_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_20_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_20, rpt20, 65536, (char*)0L,
+    "output-interface", "", "", "", "", "", "");
+
+} /* ftstat_rpt_20_dump */
+
+
+/* function: ftstat_rpt_20_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_20_new
+ *
+ */
+void ftstat_rpt_20_free(struct ftstat_rpt_20 *rpt20)
+{
+
+  STD_FREE_BUCKET(rpt20);
+
+} /* ftstat_rpt_20_free */
+
+
+/* function: ftstat_rpt_21_new
+ *
+ * Allocate and initialize data structures for rpt 21.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_21 *ftstat_rpt_21_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_21, rpt21, 65536, ftchash_rec_c162, 4, 65536);
+
+} /* ftstat_rpt_21_new */
+
+
+/* function: ftstat_rpt_21_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_21_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_21, rpt21, ftchash_rec_c162, ftch_recc162,
+    ftch_recc162p);
+
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+
+  ftch_recc162.c16a = cur.input;
+  ftch_recc162.c16b = cur.output;
+
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt21, ftch_recc162, ftch_recc162p);
+ 
+  return 0;
+   
+} /* ftstat_rpt_21_accum */
+
+/* function: ftstat_rpt_21_calc
+ *
+ * Perform final calculations for rpt21
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_21_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_21, rpt21, ftchash_rec_c162, ftch_recc162);
+
+} /* ftstat_rpt_21_calc */
+
+/* function: ftstat_rpt_21_merge
+ *
+ * Merge the counters accumulated by src into rpt21
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_21_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_21, ftchash_rec_c162);
+
+} /* ftstat_rpt_21_merge */
+
+/* function: ftstat_rpt_21_save
+ *
+ * Write the counters of rpt21 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_21_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_21, ftchash_rec_c162);
+
+} /* ftstat_rpt_21_save */
+
+/* function: ftstat_rpt_21_load
+ *
+ * Merge counters written by ftstat_rpt_21_save() into rpt21
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_21_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_21, ftchash_rec_c162);
+
+} /* ftstat_rpt_21_load */
+
+/* function: ftstat_rpt_21_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_21_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH2(ftstat_rpt_21, rpt21, chash_c162_dump,
+    (char*)0L, (char*)0L,
+    "", "input-interface", "output-interface", "", "", "", "");
+
+} /* ftstat_rpt_21_dump */
+
+
+/* function: ftstat_rpt_21_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_21_new
+ *
+ */
+void ftstat_rpt_21_free(struct ftstat_rpt_21 *rpt21)
+{
+
+  STD_FREE_HASH(rpt21);
+
+} /* ftstat_rpt_21_free */
+
+
+/* function: ftstat_rpt_22_new
+ *
+ * Allocate and initialize data structures for rpt 22.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_22 *ftstat_rpt_22_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_22, rpt22, 65536, rpt);
+
+} /* ftstat_rpt_22_new */
+
+
+/* function: ftstat_rpt_22_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_22_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_22, rpt22);
+  
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt22->bucket, cur.src_as);
+
+  return 0;
+
+} /* ftstat_rpt_22_accum */
+
+/* function: ftstat_rpt_22_calc
+ *
+ * Perform final calculations for rpt22
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_22_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_22, rpt22, 65536);
+
+} /* ftstat_rpt_22_calc */
+
+/* function: ftstat_rpt_22_merge
+ *
+ * Merge the counters accumulated by src into rpt22
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_22_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_22, 65536);
+
+} /* ftstat_rpt_22_merge */
+
+/* function: ftstat_rpt_22_save
+ *
+ * Write the counters of rpt22 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_22_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_22, 65536);
+
+} /* ftstat_rpt_22_save */
+
+/* function: ftstat_rpt_22_load
+ *
+ * Merge counters written by ftstat_rpt_22_save() into rpt22
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_22_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_22, 65536);
+
+} /* ftstat_rpt_22_load */
+
+/* function: ftstat_rpt_22_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_22_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_22, rpt22, 65536, FT_PATH_SYM_ASN,
+    "source-as", "", "", "", "", "", "");
+
+} /* ftstat_rpt_22_dump */
+
+
+/* function: ftstat_rpt_22_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_22_new
+ *
+ */
+void ftstat_rpt_22_free(struct ftstat_rpt_22 *rpt22)
+{
+
+  STD_FREE_BUCKET(rpt22);
+
+} /* ftstat_rpt_22_free */
+
+
+/* function: ftstat_rpt_23_new
+ *
+ * Allocate and initialize data structures for rpt 23.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_23 *ftstat_rpt_23_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_BUCKET(ftstat_rpt_23, rpt23, 65536, rpt);
+
+} /* ftstat_rpt_23_new */
+
+
+/* function: ftstat_rpt_23_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_23_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_BUCKET1(ftstat_rpt_23, rpt23);
+  
+  FT_RECGET_DST_AS(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt23->bucket, cur.dst_as);
+
+  return 0;
+
+} /* ftstat_rpt_23_accum */
+
+/* function: ftstat_rpt_23_calc
+ *
+ * Perform final calculations for rpt23
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_23_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_23, rpt23, 65536);
+
+} /* ftstat_rpt_23_calc */
+
+/* function: ftstat_rpt_23_merge
+ *
+ * Merge the counters accumulated by src into rpt23
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_23_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_BUCKET(ftstat_rpt_23, 65536);
+
+} /* ftstat_rpt_23_merge */
+
+/* function: ftstat_rpt_23_save
+ *
+ * Write the counters of rpt23 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_23_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_BUCKET(ftstat_rpt_23, 65536);
+
+} /* ftstat_rpt_23_save */
+
+/* function: ftstat_rpt_23_load
+ *
+ * Merge counters written by ftstat_rpt_23_save() into rpt23
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_23_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_BUCKET(ftstat_rpt_23, 65536);
+
+} /* ftstat_rpt_23_load */
+
+/* function: ftstat_rpt_23_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_23_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_BUCKET(ftstat_rpt_23, rpt23, 65536, FT_PATH_SYM_ASN,
+    "destination-as", "", "", "", "", "", "");
+ 
+} /* ftstat_rpt_23_dump */
+
+
+/* function: ftstat_rpt_23_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_23_new
+ *
+ */
+void ftstat_rpt_23_free(struct ftstat_rpt_23 *rpt23)
+{
+
+  STD_FREE_BUCKET(rpt23);
+
+} /* ftstat_rpt_23_free */
+
+
+/* function: ftstat_rpt_24_new
+ *
+ * Allocate and initialize data structures for rpt 24.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_24 *ftstat_rpt_24_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_24, rpt24, 65536, ftchash_rec_c162, 4, 65536);
+
+} /* ftstat_rpt_24_new */
+
+
+/* function: ftstat_rpt_24_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_24_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_24, rpt24, ftchash_rec_c162, ftch_recc162,
+    ftch_recc162p);
+
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
+
+  ftch_recc162.c16a = cur.src_as;
+  ftch_recc162.c16b = cur.dst_as;
+
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt24, ftch_recc162, ftch_recc162p);
+
+  return 0;
+   
+} /* ftstat_rpt_24_accum */
+
+/* function: ftstat_rpt_24_calc
+ *
+ * Perform final calculations for rpt24
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_24_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_24, rpt24, ftchash_rec_c162, ftch_recc162);
+
+} /* ftstat_rpt_24_calc */
+
+/* function: ftstat_rpt_24_merge
+ *
+ * Merge the counters accumulated by src into rpt24
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_24_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_24, ftchash_rec_c162);
+
+} /* ftstat_rpt_24_merge */
+
+/* function: ftstat_rpt_24_save
+ *
+ * Write the counters of rpt24 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_24_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_24, ftchash_rec_c162);
+
+} /* ftstat_rpt_24_save */
+
+/* function: ftstat_rpt_24_load
+ *
+ * Merge counters written by ftstat_rpt_24_save() into rpt24
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_24_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_24, ftchash_rec_c162);
+
+} /* ftstat_rpt_24_load */
+
+/* function: ftstat_rpt_24_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_24_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH2(ftstat_rpt_24, rpt24, chash_c162_dump,
+    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "source-as", "destination-AS", "", "", "", "");
+
+} /* ftstat_rpt_24_dump */
+
+
+/* function: ftstat_rpt_24_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_24_new
+ *
+ */
+void ftstat_rpt_24_free(struct ftstat_rpt_24 *rpt24)
+{
+
+  STD_FREE_HASH(rpt24);
+
+} /* ftstat_rpt_24_free */
+
+
+/* function: ftstat_rpt_25_new
+ *
+ * Allocate and initialize data structures for rpt 25.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_25 *ftstat_rpt_25_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_25, rpt25, 65536, ftchash_rec_prefix16, 8, 65536);
+
+} /* ftstat_rpt_25_new */
+
+
+/* function: ftstat_rpt_25_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_25_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_25, rpt25, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_prefix16p);
+
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+
+  ftch_recprefix16.prefix = cur.srcaddr;
+  ftch_recprefix16.c16 = cur.src_as;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.src_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+
+  STD_ACCUM_HASH2(rpt25, ftch_recprefix16, ftch_prefix16p);
+
+  return 0;
+   
+} /* ftstat_rpt_25_accum */
+
+/* function: ftstat_rpt_25_calc
+ *
+ * Perform final calculations for rpt25
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_25_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_25, rpt25, ftchash_rec_prefix16, ftch_recprefix16);
+
+} /* ftstat_rpt_25_calc */
+
+/* function: ftstat_rpt_25_merge
+ *
+ * Merge the counters accumulated by src into rpt25
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_25_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_25, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_25_merge */
+
+/* function: ftstat_rpt_25_save
+ *
+ * Write the counters of rpt25 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_25_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_25, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_25_save */
+
+/* function: ftstat_rpt_25_load
+ *
+ * Merge counters written by ftstat_rpt_25_save() into rpt25
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_25_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_25, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_25_load */
+
+/* function: ftstat_rpt_25_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_25_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1P(ftstat_rpt_25, rpt25, chash_prefix16_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_ASN,
+    "", "ip-source-address", "source-as", "", "", "", "");
+
+} /* ftstat_rpt_25_dump */
+
+
+/* function: ftstat_rpt_25_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_25_new
+ *
+ */
+void ftstat_rpt_25_free(struct ftstat_rpt_25 *rpt25)
+{
+
+  STD_FREE_HASH(rpt25);
+
+} /* ftstat_rpt_25_free */
+
+
+/* function: ftstat_rpt_26_new
+ *
+ * Allocate and initialize data structures for rpt 26.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_26 *ftstat_rpt_26_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_26, rpt26, 65536, ftchash_rec_prefix16, 8, 65536);
+
+} /* ftstat_rpt_26_new */
+
+
+/* function: ftstat_rpt_26_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_26_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_26, rpt26, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_recprefix16p);
+
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+
+  ftch_recprefix16.prefix = cur.dstaddr;
+  ftch_recprefix16.c16 = cur.src_as;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.dst_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+
+  STD_ACCUM_HASH2(rpt26, ftch_recprefix16, ftch_recprefix16p);
+
+  return 0;
+   
+} /* ftstat_rpt_26_accum */
+
+/* function: ftstat_rpt_26_calc
+ *
+ * Perform final calculations for rpt26
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_26_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_26, rpt26, ftchash_rec_prefix16, ftch_recprefix16);
+
+} /* ftstat_rpt_26_calc */
+
+/* function: ftstat_rpt_26_merge
+ *
+ * Merge the counters accumulated by src into rpt26
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_26_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_26, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_26_merge */
+
+/* function: ftstat_rpt_26_save
+ *
+ * Write the counters of rpt26 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_26_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_26, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_26_save */
+
+/* function: ftstat_rpt_26_load
+ *
+ * Merge counters written by ftstat_rpt_26_save() into rpt26
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_26_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_26, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_26_load */
+
+/* function: ftstat_rpt_26_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_26_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1P(ftstat_rpt_26, rpt26, chash_prefix16_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_ASN,
+    "", "ip-source-address", "destination-as", "", "", "", "");
+
+} /* ftstat_rpt_26_dump */
+
+
+/* function: ftstat_rpt_26_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_26_new
+ *
+ */
+void ftstat_rpt_26_free(struct ftstat_rpt_26 *rpt26)
+{
+
+  STD_FREE_HASH(rpt26);
+
+} /* ftstat_rpt_26_free */
+
+
+/* function: ftstat_rpt_27_new
+ *
+ * Allocate and initialize data structures for rpt 27.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_27 *ftstat_rpt_27_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_27, rpt27, 65536, ftchash_rec_prefix16, 8, 65536);
+
+} /* ftstat_rpt_27_new */
+
+
+/* function: ftstat_rpt_27_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_27_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_26, rpt26, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_recprefix16p);
+
+  FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+ 
+  ftch_recprefix16.prefix = cur.srcaddr;
+  ftch_recprefix16.c16 = cur.dst_as;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.src_mask;
+  }
+    
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+ 
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+
+  STD_ACCUM_HASH2(rpt26, ftch_recprefix16, ftch_recprefix16p);
+
+  return 0;
+   
+} /* ftstat_rpt_27_accum */
+
+/* function: ftstat_rpt_27_calc
+ *
+ * Perform final calculations for rpt27
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_27_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_27, rpt27, ftchash_rec_prefix16, ftch_recprefix16);
+
+} /* ftstat_rpt_27_calc */
+
+/* function: ftstat_rpt_27_merge
+ *
+ * Merge the counters accumulated by src into rpt27
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_27_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_27, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_27_merge */
+
+/* function: ftstat_rpt_27_save
+ *
+ * Write the counters of rpt27 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_27_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_27, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_27_save */
+
+/* function: ftstat_rpt_27_load
+ *
+ * Merge counters written by ftstat_rpt_27_save() into rpt27
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_27_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_27, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_27_load */
+
+/* function: ftstat_rpt_27_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_27_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1P(ftstat_rpt_27, rpt27, chash_prefix16_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_ASN,
+    "", "ip-source-address", "destination-as", "", "", "", "");
+
+
+} /* ftstat_rpt_27_dump */
+
+
+/* function: ftstat_rpt_27_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_27_new
+ *
+ */
+void ftstat_rpt_27_free(struct ftstat_rpt_27 *rpt27)
+{
+
+  STD_FREE_HASH(rpt27);
+
+} /* ftstat_rpt_27_free */
+
+
+/* function: ftstat_rpt_28_new
+ *
+ * Allocate and initialize data structures for rpt 28.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_28 *ftstat_rpt_28_new(struct ftstat_rpt *rpt)
+{
 
-  bzero(rpt1, sizeof *rpt1);
+  STD_NEW_HASH(ftstat_rpt_28, rpt28, 65536, ftchash_rec_prefix16, 8, 65536);
+
+} /* ftstat_rpt_28_new */
+
+
+/* function: ftstat_rpt_28_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_28_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_28, rpt28, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_recprefix16p);
+
+  FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  
+  ftch_recprefix16.prefix = cur.dstaddr;
+  ftch_recprefix16.c16 = cur.dst_as;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.dst_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+
+  STD_ACCUM_HASH2(rpt28, ftch_recprefix16, ftch_recprefix16p);
+  
+  return 0;
+   
+} /* ftstat_rpt_28_accum */
+
+/* function: ftstat_rpt_28_calc
+ *
+ * Perform final calculations for rpt28
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_28_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_28, rpt28, ftchash_rec_prefix16, ftch_recprefix16);
+
+} /* ftstat_rpt_28_calc */
+
+/* function: ftstat_rpt_28_merge
+ *
+ * Merge the counters accumulated by src into rpt28
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_28_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_28, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_28_merge */
+
+/* function: ftstat_rpt_28_save
+ *
+ * Write the counters of rpt28 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_28_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_28, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_28_save */
+
+/* function: ftstat_rpt_28_load
+ *
+ * Merge counters written by ftstat_rpt_28_save() into rpt28
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_28_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_28, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_28_load */
+
+/* function: ftstat_rpt_28_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_28_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1P(ftstat_rpt_28, rpt28, chash_prefix16_dump,
+   FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+   FT_PATH_SYM_ASN,
+    "", "ip-destination-address", "source-as", "", "", "", "");
+
+} /* ftstat_rpt_28_dump */
+
+
+/* function: ftstat_rpt_28_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_28_new
+ *
+ */
+void ftstat_rpt_28_free(struct ftstat_rpt_28 *rpt28)
+{
+
+  STD_FREE_HASH(rpt28);
+
+} /* ftstat_rpt_28_free */
+
+
+/* function: ftstat_rpt_29_new
+ *
+ * Allocate and initialize data structures for rpt 29.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_29 *ftstat_rpt_29_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_29, rpt29, 65536, ftchash_rec_prefix216, 13, 65536);
+
+} /* ftstat_rpt_29_new */
+
+
+/* function: ftstat_rpt_29_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_29_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_29, rpt29, ftchash_rec_prefix216,
+    ftch_recprefix216, ftch_recprefix216p);
+
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  
+  ftch_recprefix216.src_prefix = cur.srcaddr;
+  ftch_recprefix216.dst_prefix = cur.dstaddr;
+  ftch_recprefix216.c16 = cur.src_as;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix216.src_mask = cur.src_mask;
+  }
+
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix216.dst_mask = cur.dst_mask;
+  }
+ 
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
+  }
+
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
+  }
+ 
+  hash = (ftch_recprefix216.src_prefix>>16)^
+          (ftch_recprefix216.src_prefix & 0xFFFF)^
+          (ftch_recprefix216.dst_prefix>>16)^
+          (ftch_recprefix216.dst_prefix & 0xFFFF)^
+          (ftch_recprefix216.c16)^
+          (ftch_recprefix216.src_mask)^
+          (uint32_t)(ftch_recprefix216.dst_mask<<8);
+
+  STD_ACCUM_HASH2(rpt29, ftch_recprefix216, ftch_recprefix216p);
+  
+  return 0;
+   
+} /* ftstat_rpt_29_accum */
+
+/* function: ftstat_rpt_29_calc
+ *
+ * Perform final calculations for rpt29
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_29_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_29, rpt29, ftchash_rec_prefix216, ftch_recprefix216);
+
+} /* ftstat_rpt_29_calc */
+
+/* function: ftstat_rpt_29_merge
+ *
+ * Merge the counters accumulated by src into rpt29
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_29_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_29, ftchash_rec_prefix216);
+
+} /* ftstat_rpt_29_merge */
+
+/* function: ftstat_rpt_29_save
+ *
+ * Write the counters of rpt29 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_29_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_29, ftchash_rec_prefix216);
+
+} /* ftstat_rpt_29_save */
+
+/* function: ftstat_rpt_29_load
+ *
+ * Merge counters written by ftstat_rpt_29_save() into rpt29
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_29_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_29, ftchash_rec_prefix216);
+
+} /* ftstat_rpt_29_load */
+
+/* function: ftstat_rpt_29_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_29_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1(ftstat_rpt_29, rpt29, chash_prefix216_dump, FT_PATH_SYM_ASN,
+    "", "ip-source-address", "ip-destination-address", "source-as", "", "", "");
+
+} /* ftstat_rpt_29_dump */
+
+
+/* function: ftstat_rpt_29_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_29_new
+ *
+ */
+void ftstat_rpt_29_free(struct ftstat_rpt_29 *rpt29)
+{
+
+  STD_FREE_HASH(rpt29);
+
+} /* ftstat_rpt_29_free */
+
+
+/* function: ftstat_rpt_30_new
+ *
+ * Allocate and initialize data structures for rpt 30.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_30 *ftstat_rpt_30_new(struct ftstat_rpt *rpt)
+{
 
-  return rpt1;
+  STD_NEW_HASH(ftstat_rpt_30, rpt30, 65536, ftchash_rec_prefix216, 13, 65536);
 
-} /* ftstat_rpt_1_new */
+} /* ftstat_rpt_30_new */
 
 
-/* function: ftstat_rpt_1_accum
+/* function: ftstat_rpt_30_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_1_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_30_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
-  struct ftstat_rpt_1 *rpt1;
-  struct fts3rec_all2 cur;
-  uint32_t time_tmp, duration_tmp;
-  double pps_tmp, bps_tmp;
-  uint32_t p;
 
-  STD_ACCUM;
+  STD_ACCUM_HASH1(ftstat_rpt_30, rpt30, ftchash_rec_prefix216,
+    ftch_recprefix216, ftch_recprefix216p);
 
-  rpt1 = rpt->data;
+  FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+    
+  ftch_recprefix216.src_prefix = cur.srcaddr;
+  ftch_recprefix216.dst_prefix = cur.dstaddr;
+  ftch_recprefix216.c16 = cur.dst_as;
 
-  time_tmp = cur.unix_secs;
-  
-  if (time_tmp < rpt1->time_start)
-    rpt1->time_start = time_tmp;
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix216.src_mask = cur.src_mask;
+  }
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix216.dst_mask = cur.dst_mask;
+  }
+ 
+  /* remove host bits */  
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
+  }
+
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
+  }
   
-  if (time_tmp > rpt1->time_end)
-    rpt1->time_end = time_tmp;
+  hash = (ftch_recprefix216.src_prefix>>16)^
+          (ftch_recprefix216.src_prefix & 0xFFFF)^
+          (ftch_recprefix216.dst_prefix>>16)^
+          (ftch_recprefix216.dst_prefix & 0xFFFF)^
+          (ftch_recprefix216.c16)^
+          (ftch_recprefix216.src_mask)^
+          (uint32_t)(ftch_recprefix216.dst_mask<<8);
 
-  if (cur.First < rpt1->start)
-    rpt1->start = cur.First;
+  STD_ACCUM_HASH2(rpt30, ftch_recprefix216, ftch_recprefix216p);
   
-  if (cur.Last > rpt1->end)
-    rpt1->end = cur.Last;
+  return 0;
+   
+} /* ftstat_rpt_30_accum */
 
-  p = cur.dOctets64 / cur.dPkts64;
+/* function: ftstat_rpt_30_calc
+ *
+ * Perform final calculations for rpt30
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_30_calc(struct ftstat_rpt *rpt)
+{
 
-  if (p <= 32) ++ rpt1->psize32;
-  else if (p <= 64) ++ rpt1->psize64;
-  else if (p <= 96) ++ rpt1->psize96;
-  else if (p <= 128) ++ rpt1->psize128;
-  else if (p <= 160) ++ rpt1->psize160;
-  else if (p <= 192) ++ rpt1->psize192;
-  else if (p <= 224) ++ rpt1->psize224;
-  else if (p <= 256) ++ rpt1->psize256;
-  else if (p <= 288) ++ rpt1->psize288;
-  else if (p <= 320) ++ rpt1->psize320;
-  else if (p <= 352) ++ rpt1->psize352;
-  else if (p <= 384) ++ rpt1->psize384;
-  else if (p <= 416) ++ rpt1->psize416;
-  else if (p <= 448) ++ rpt1->psize448;
-  else if (p <= 480) ++ rpt1->psize480;
-  else if (p <= 512) ++ rpt1->psize512;
-  else if (p <= 544) ++ rpt1->psize544;
-  else if (p <= 576) ++ rpt1->psize576;
-  else if (p <= 1024) ++ rpt1->psize1024;
-  else if (p <= 1536) ++ rpt1->psize1536;
-  else if (p <= 2048) ++ rpt1->psize2048;
-  else if (p <= 2560) ++ rpt1->psize2560;
-  else if (p <= 3072) ++ rpt1->psize3072;
-  else if (p <= 3584) ++ rpt1->psize3584;
-  else if (p <= 4096) ++ rpt1->psize4096;
-  else if (p <= 4608) ++ rpt1->psize4608;
+  STD_CALC_HASH(ftstat_rpt_30, rpt30, ftchash_rec_prefix216, ftch_recprefix216);
 
-  p = cur.dPkts64;
+} /* ftstat_rpt_30_calc */
 
-  if (p <= 1) ++ rpt1->fpsize1;
-  else if (p <= 2) ++ rpt1->fpsize2;
-  else if (p <= 4) ++ rpt1->fpsize4;
-  else if (p <= 8) ++ rpt1->fpsize8;  
-  else if (p <= 12) ++ rpt1->fpsize12;
-  else if (p <= 16) ++ rpt1->fpsize16;
-  else if (p <= 20) ++ rpt1->fpsize20;
-  else if (p <= 24) ++ rpt1->fpsize24;
-  else if (p <= 28) ++ rpt1->fpsize28;
-  else if (p <= 32) ++ rpt1->fpsize32;
-  else if (p <= 36) ++ rpt1->fpsize36;
-  else if (p <= 40) ++ rpt1->fpsize40;
-  else if (p <= 44) ++ rpt1->fpsize44;
-  else if (p <= 48) ++ rpt1->fpsize48;
-  else if (p <= 52) ++ rpt1->fpsize52;
-  else if (p <= 60) ++ rpt1->fpsize60;
-  else if (p <= 100) ++ rpt1->fpsize100;
-  else if (p <= 200) ++ rpt1->fpsize200;
-  else if (p <= 300) ++ rpt1->fpsize300;
-  else if (p <= 400) ++ rpt1->fpsize400;
-  else if (p <= 500) ++ rpt1->fpsize500;
-  else if (p <= 600) ++ rpt1->fpsize600;
-  else if (p <= 700) ++ rpt1->fpsize700;
-  else if (p <= 800) ++ rpt1->fpsize800;
-  else if (p <= 900) ++ rpt1->fpsize900;
-  else ++ rpt1->fpsize_other;
+/* function: ftstat_rpt_30_merge
+ *
+ * Merge the counters accumulated by src into rpt30
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_30_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
 
-  p = cur.dOctets64;
+  STD_MERGE_HASH(ftstat_rpt_30, ftchash_rec_prefix216);
 
-  if (p <= 32) ++ rpt1->fosize32;
-  else if (p <= 64) ++ rpt1->fosize64;
-  else if (p <= 128) ++ rpt1->fosize128;
-  else if (p <= 256) ++ rpt1->fosize256;
-  else if (p <= 512) ++ rpt1->fosize512;
-  else if (p <= 1280) ++ rpt1->fosize1280;
-  else if (p <= 2048) ++ rpt1->fosize2048;
-  else if (p <= 2816) ++ rpt1->fosize2816;
-  else if (p <= 3584) ++ rpt1->fosize3584;
-  else if (p <= 4352) ++ rpt1->fosize4352;
-  else if (p <= 5120) ++ rpt1->fosize5120;
-  else if (p <= 5888) ++ rpt1->fosize5888;
-  else if (p <= 6656) ++ rpt1->fosize6656;
-  else if (p <= 7424) ++ rpt1->fosize7424;
-  else if (p <= 8192) ++ rpt1->fosize8192;
-  else if (p <= 8960) ++ rpt1->fosize8960;
-  else if (p <= 9728) ++ rpt1->fosize9728;
-  else if (p <= 10496) ++ rpt1->fosize10496;
-  else if (p <= 11264) ++ rpt1->fosize11264;
-  else if (p <= 12032) ++ rpt1->fosize12032;
-  else if (p <= 12800) ++ rpt1->fosize12800;
-  else if (p <= 13568) ++ rpt1->fosize13568;
-  else if (p <= 14336) ++ rpt1->fosize14336;
-  else if (p <= 15104) ++ rpt1->fosize15104;
-  else if (p <= 15872) ++ rpt1->fosize15872;
-  else ++ rpt1->fosize_other;
+} /* ftstat_rpt_30_merge */
 
-  p = cur.Last - cur.First;
-  rpt1->time += p;
-    
-  if (p <= 10) ++ rpt1->ftime10;
-  else if (p <= 50) ++ rpt1->ftime50;
-  else if (p <= 100) ++ rpt1->ftime100;
-  else if (p <= 200) ++ rpt1->ftime200;
-  else if (p <= 500) ++ rpt1->ftime500;
-  else if (p <= 1000) ++ rpt1->ftime1000;
-  else if (p <= 2000) ++ rpt1->ftime2000;
-  else if (p <= 3000) ++ rpt1->ftime3000;
-  else if (p <= 4000) ++ rpt1->ftime4000;
-  else if (p <= 5000) ++ rpt1->ftime5000;
-  else if (p <= 6000) ++ rpt1->ftime6000;
-  else if (p <= 7000) ++ rpt1->ftime7000;
-  else if (p <= 8000) ++ rpt1->ftime8000;
-  else if (p <= 9000) ++ rpt1->ftime9000;
-  else if (p <= 10000) ++ rpt1->ftime10000;
-  else if (p <= 12000) ++ rpt1->ftime12000;
-  else if (p <= 14000) ++ rpt1->ftime14000;
-  else if (p <= 16000) ++ rpt1->ftime16000;
-  else if (p <= 18000) ++ rpt1->ftime18000;
-  else if (p <= 20000) ++ rpt1->ftime20000;
-  else if (p <= 22000) ++ rpt1->ftime22000;
-  else if (p <= 24000) ++ rpt1->ftime24000;
-  else if (p <= 26000) ++ rpt1->ftime26000;
-  else if (p <= 28000) ++ rpt1->ftime28000;
-  else if (p <= 30000) ++ rpt1->ftime30000;
-  else ++ rpt1->ftime_other;
+/* function: ftstat_rpt_30_save
+ *
+ * Write the counters of rpt30 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_30_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  return 0;
+  STD_SAVE_HASH(ftstat_rpt_30, ftchash_rec_prefix216);
 
-} /* ftstat_rpt_1_accum */
+} /* ftstat_rpt_30_save */
 
-/* function: ftstat_rpt_1_calc
+/* function: ftstat_rpt_30_load
  *
- * Perform final calculations for rpt1
+ * Merge counters written by ftstat_rpt_30_save() into rpt30
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_30_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_30, ftchash_rec_prefix216);
+
+} /* ftstat_rpt_30_load */
+
+/* function: ftstat_rpt_30_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_30_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH1(ftstat_rpt_30, rpt30, chash_prefix216_dump, FT_PATH_SYM_ASN,
+    "", "ip-source-address", "ip-destination-address", "destination-as", "",
+    "", "");
+
+} /* ftstat_rpt_30_dump */
+
+
+/* function: ftstat_rpt_30_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_30_new
+ *
+ */
+void ftstat_rpt_30_free(struct ftstat_rpt_30 *rpt30)
+{
+
+  STD_FREE_HASH(rpt30);
+
+} /* ftstat_rpt_30_free */
+
+
+/* function: ftstat_rpt_31_new
+ *
+ * Allocate and initialize data structures for rpt 31.
+ *
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_31 *ftstat_rpt_31_new(struct ftstat_rpt *rpt)
+{
+
+  STD_NEW_HASH(ftstat_rpt_31, rpt31, 65536, ftchash_rec_prefix2162, 16, 65536);
+
+} /* ftstat_rpt_31_new */
+
+
+/* function: ftstat_rpt_31_accum
+ *
+ * Accumulate counters for report by processing flow.
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_1_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_31_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
-  struct ftstat_rpt_1 *rpt1;
-  uint32_t dif;
-
-  rpt1 = rpt->data;
 
-  STD_CALC;
+  STD_ACCUM_HASH1(ftstat_rpt_31, rpt31, ftchash_rec_prefix2162,
+    ftch_recprefix2162, ftch_recprefix2162p);
 
-  rpt1->time_real = rpt1->time_end - rpt1->time_start;
-  dif = rpt1->end - rpt1->start;
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+    
+  ftch_recprefix2162.src_prefix = cur.srcaddr;
+  ftch_recprefix2162.dst_prefix = cur.dstaddr;
+  ftch_recprefix2162.c16a = cur.src_as;
+  ftch_recprefix2162.c16b = cur.dst_as;
+ 
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix2162.src_mask = cur.src_mask;
+  }
 
-  if (rpt->t_flows) {
-    rpt1->aflowtime = rpt1->time / rpt->t_flows;
-    rpt1->afs = rpt->t_octets / rpt->t_flows;
-    rpt1->apf = rpt->t_packets / rpt->t_flows;
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix2162.dst_mask = cur.dst_mask;
   }
 
-  if (rpt->t_packets)
-    rpt1->aps = rpt->t_octets / rpt->t_packets;
- 
-  if (dif) 
-    rpt1->fps = (double)rpt->t_flows / (dif / 1000.0);
+  /* remove host bits */  
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix2162.src_prefix &= ipv4_len2mask(ftch_recprefix2162.src_mask);
+  }
 
-  if (rpt1->time_real)
-    rpt1->fps_real = (double)rpt->t_flows / (double)rpt1->time_real;
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix2162.dst_prefix &= ipv4_len2mask(ftch_recprefix2162.dst_mask);
+  }
+  
+  hash = (ftch_recprefix2162.src_prefix>>16)^
+          (ftch_recprefix2162.src_prefix & 0xFFFF)^
+          (ftch_recprefix2162.dst_prefix>>16)^
+          (ftch_recprefix2162.dst_prefix & 0xFFFF)^
+          (ftch_recprefix2162.c16b)^
+          (ftch_recprefix2162.c16a)^
+          (ftch_recprefix2162.src_mask)^
+          (uint32_t)(ftch_recprefix2162.dst_mask<<8);
 
+  STD_ACCUM_HASH2(rpt31, ftch_recprefix2162, ftch_recprefix2162p);
+  
   return 0;
+   
+} /* ftstat_rpt_31_accum */
 
-} /* ftstat_rpt_1_calc */
+/* function: ftstat_rpt_31_calc
+ *
+ * Perform final calculations for rpt31
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_31_calc(struct ftstat_rpt *rpt)
+{
+  
+  STD_CALC_HASH(ftstat_rpt_31, rpt31, ftchash_rec_prefix2162,
+    ftch_recprefix2162);
 
-/* function: ftstat_rpt_1_dump
+} /* ftstat_rpt_31_calc */
+
+/* function: ftstat_rpt_31_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt31
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_1_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_31_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
-  struct ftstat_rpt_1 *rpt1;
-  char fmt_buf[1024];
 
-  rpt1 = rpt->data;
+  STD_MERGE_HASH(ftstat_rpt_31, ftchash_rec_prefix2162);
 
-  fprintf(fp, "# rec2: time_real,aflowtime,aps,afs,apf,fps,fps_real,");
-  fprintf(fp, "psize32,psize64,psize96,psize128,psize160,psize192,psize224,psize256,psize288,psize320,psize352,psize384,psize416,psize448,psize480,psize512,psize544,psize576,psize1024,psize1536,psize2048,psize2560,psize3072,psize3584,>psize4096,psize4608,");
-  fprintf(fp, "fpsize1,fpsize2,fpsize4,fpsize8,fpsize12,fpsize16,fpsize20,fpsize24,fpsize28,fpsize32,fpsize36,fpsize40,fpsize44,fpsize48,fpsize52,fpsize60,fpsize100,fpsize200,fpsize300,fpsize400,fpsize500,fpsize600,fpsize700,fpsize800,fpsize900,fpsize_other,");
-  fprintf(fp, "fosize32,fosize64,fosize128,fosize256,fosize512,fosize1280,fosize2048,fosize2816,fosize3584,fosize4352,fosize5120,fosize5888,fosize6656,fosize7424,fosize8192,fosize8960,fosize9728,fosize10496,fosize11264,fosize12032,fosize12800,fosize13568,fosize14336,fosize15104,fosize15872,fosize_other,");
-  fprintf(fp, "ftime10,ftime50,ftime100,ftime200,ftime500,ftime1000,ftime2000,ftime3000,ftime4000,ftime5000,ftime6000,ftime7000,ftime8000,ftime9000,ftime10000,ftime12000,ftime14000,ftime16000,ftime18000,ftime20000,ftime22000,ftime24000,ftime26000,ftime28000,ftime30000,ftime_other\n");
+} /* ftstat_rpt_31_merge */
 
-  fmt_uint64(fmt_buf, rpt1->time_real, FMT_JUST_LEFT);
+/* function: ftstat_rpt_31_save
+ *
+ * Write the counters of rpt31 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_31_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  fprintf(fp, "%s,%f,%f,%f,%f,%f,%f,", fmt_buf, rpt1->aflowtime,
-    rpt1->aps, rpt1->afs, rpt1->apf, rpt1->fps, rpt1->fps_real);
+  STD_SAVE_HASH(ftstat_rpt_31, ftchash_rec_prefix2162);
 
-  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,",
-    (double)rpt1->psize32 / (double)rpt->t_flows,
-    (double)rpt1->psize64 / (double)rpt->t_flows,
-    (double)rpt1->psize96 / (double)rpt->t_flows,
-    (double)rpt1->psize128 / (double)rpt->t_flows,
-    (double)rpt1->psize160 / (double)rpt->t_flows,
-    (double)rpt1->psize192 / (double)rpt->t_flows,
-    (double)rpt1->psize224 / (double)rpt->t_flows,
-    (double)rpt1->psize256 / (double)rpt->t_flows,
-    (double)rpt1->psize288 / (double)rpt->t_flows,
-    (double)rpt1->psize320 / (double)rpt->t_flows,
-    (double)rpt1->psize352 / (double)rpt->t_flows,
-    (double)rpt1->psize384 / (double)rpt->t_flows,
-    (double)rpt1->psize416 / (double)rpt->t_flows,
-    (double)rpt1->psize448 / (double)rpt->t_flows,
-    (double)rpt1->psize480 / (double)rpt->t_flows,
-    (double)rpt1->psize512 / (double)rpt->t_flows,
-    (double)rpt1->psize544 / (double)rpt->t_flows,
-    (double)rpt1->psize576 / (double)rpt->t_flows,
-    (double)rpt1->psize1024 / (double)rpt->t_flows,
-    (double)rpt1->psize1536 / (double)rpt->t_flows,
-    (double)rpt1->psize2048 / (double)rpt->t_flows,
-    (double)rpt1->psize2560 / (double)rpt->t_flows,
-    (double)rpt1->psize3072 / (double)rpt->t_flows,
-    (double)rpt1->psize3584 / (double)rpt->t_flows,
-    (double)rpt1->psize4096 / (double)rpt->t_flows,
-    (double)rpt1->psize4608 / (double)rpt->t_flows);
+} /* ftstat_rpt_31_save */
 
-  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,",
-    (double)rpt1->fpsize1 / (double)rpt->t_flows,
-    (double)rpt1->fpsize2 / (double)rpt->t_flows,
-    (double)rpt1->fpsize4 / (double)rpt->t_flows,
-    (double)rpt1->fpsize8 / (double)rpt->t_flows,
-    (double)rpt1->fpsize12 / (double)rpt->t_flows,
-    (double)rpt1->fpsize16 / (double)rpt->t_flows,
-    (double)rpt1->fpsize20 / (double)rpt->t_flows,
-    (double)rpt1->fpsize24 / (double)rpt->t_flows,
-    (double)rpt1->fpsize28 / (double)rpt->t_flows,
-    (double)rpt1->fpsize32 / (double)rpt->t_flows,
-    (double)rpt1->fpsize36 / (double)rpt->t_flows,
-    (double)rpt1->fpsize40 / (double)rpt->t_flows,
-    (double)rpt1->fpsize44 / (double)rpt->t_flows,
-    (double)rpt1->fpsize48 / (double)rpt->t_flows,
-    (double)rpt1->fpsize52 / (double)rpt->t_flows,
-    (double)rpt1->fpsize60 / (double)rpt->t_flows,
-    (double)rpt1->fpsize100 / (double)rpt->t_flows,
-    (double)rpt1->fpsize200 / (double)rpt->t_flows,
-    (double)rpt1->fpsize300 / (double)rpt->t_flows,
-    (double)rpt1->fpsize400 / (double)rpt->t_flows,
-    (double)rpt1->fpsize500 / (double)rpt->t_flows,
-    (double)rpt1->fpsize600 / (double)rpt->t_flows,
-    (double)rpt1->fpsize700 / (double)rpt->t_flows,
-    (double)rpt1->fpsize800 / (double)rpt->t_flows,
-    (double)rpt1->fpsize900 / (double)rpt->t_flows,
-    (double)rpt1->fpsize_other / (double)rpt->t_flows);
+/* function: ftstat_rpt_31_load
+ *
+ * Merge counters written by ftstat_rpt_31_save() into rpt31
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_31_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,",
-    (double)rpt1->fosize32 / (double)rpt->t_flows,
-    (double)rpt1->fosize64 / (double)rpt->t_flows,
-    (double)rpt1->fosize128 / (double)rpt->t_flows,
-    (double)rpt1->fosize256 / (double)rpt->t_flows,
-    (double)rpt1->fosize512 / (double)rpt->t_flows,
-    (double)rpt1->fosize1280 / (double)rpt->t_flows,
-    (double)rpt1->fosize2048 / (double)rpt->t_flows,
-    (double)rpt1->fosize2816 / (double)rpt->t_flows,
-    (double)rpt1->fosize3584 / (double)rpt->t_flows,
-    (double)rpt1->fosize4352 / (double)rpt->t_flows,
-    (double)rpt1->fosize5120 / (double)rpt->t_flows,
-    (double)rpt1->fosize5888 / (double)rpt->t_flows,
-    (double)rpt1->fosize6656 / (double)rpt->t_flows,
-    (double)rpt1->fosize7424 / (double)rpt->t_flows,
-    (double)rpt1->fosize8192 / (double)rpt->t_flows,
-    (double)rpt1->fosize8960 / (double)rpt->t_flows,
-    (double)rpt1->fosize9728 / (double)rpt->t_flows,
-    (double)rpt1->fosize10496 / (double)rpt->t_flows,
-    (double)rpt1->fosize11264 / (double)rpt->t_flows,
-    (double)rpt1->fosize12032 / (double)rpt->t_flows,
-    (double)rpt1->fosize12800 / (double)rpt->t_flows,
-    (double)rpt1->fosize13568 / (double)rpt->t_flows,
-    (double)rpt1->fosize14336 / (double)rpt->t_flows,
-    (double)rpt1->fosize15104 / (double)rpt->t_flows,
-    (double)rpt1->fosize15872 / (double)rpt->t_flows,
-    (double)rpt1->fosize_other / (double)rpt->t_flows);
+  STD_LOAD_HASH(ftstat_rpt_31, ftchash_rec_prefix2162);
 
-  fprintf(fp, "%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f,%f\n",
-    (double)rpt1->ftime10 / (double)rpt->t_flows,
-    (double)rpt1->ftime50 / (double)rpt->t_flows,
-    (double)rpt1->ftime100 / (double)rpt->t_flows,
-    (double)rpt1->ftime200 / (double)rpt->t_flows,
-    (double)rpt1->ftime500 / (double)rpt->t_flows,
-    (double)rpt1->ftime1000 / (double)rpt->t_flows,
-    (double)rpt1->ftime2000 / (double)rpt->t_flows,
-    (double)rpt1->ftime3000 / (double)rpt->t_flows,
-    (double)rpt1->ftime4000 / (double)rpt->t_flows,
-    (double)rpt1->ftime5000 / (double)rpt->t_flows,
-    (double)rpt1->ftime6000 / (double)rpt->t_flows,
-    (double)rpt1->ftime7000 / (double)rpt->t_flows,
-    (double)rpt1->ftime8000 / (double)rpt->t_flows,
-    (double)rpt1->ftime9000 / (double)rpt->t_flows,
-    (double)rpt1->ftime10000 / (double)rpt->t_flows,
-    (double)rpt1->ftime12000 / (double)rpt->t_flows,
-    (double)rpt1->ftime14000 / (double)rpt->t_flows,
-    (double)rpt1->ftime16000 / (double)rpt->t_flows,
-    (double)rpt1->ftime18000 / (double)rpt->t_flows,
-    (double)rpt1->ftime20000 / (double)rpt->t_flows,
-    (double)rpt1->ftime22000 / (double)rpt->t_flows,
-    (double)rpt1->ftime24000 / (double)rpt->t_flows,
-    (double)rpt1->ftime26000 / (double)rpt->t_flows,
-    (double)rpt1->ftime28000 / (double)rpt->t_flows,
-    (double)rpt1->ftime30000 / (double)rpt->t_flows,
-    (double)rpt1->ftime_other / (double)rpt->t_flows);
+} /* ftstat_rpt_31_load */
 
+/* function: ftstat_rpt_31_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_31_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-  return 0;
+  STD_DUMP_HASH2(ftstat_rpt_31, rpt31, chash_prefix2162_dump,
+    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "ip-source-address", "ip-destination-address", "source-as",
+    "destination-as", "", "");
 
-} /* ftstat_rpt_1_dump */
+} /* ftstat_rpt_31_dump */
 
 
-/* function: ftstat_rpt_1_free
+/* function: ftstat_rpt_31_free
  *
- * Free data structures for report allocated by ftstat_rpt_1_new
+ * Free data structures for report allocated by ftstat_rpt_31_new
  *
  */
-void ftstat_rpt_1_free(struct ftstat_rpt_1 *rpt1)
+void ftstat_rpt_31_free(struct ftstat_rpt_31 *rpt31)
 {
-  if (rpt1)
-    free(rpt1);
-} /* ftstat_rpt_1_free */
 
+  STD_FREE_HASH(rpt31);
 
-/* function: ftstat_rpt_2_new
+} /* ftstat_rpt_31_free */
+
+
+/* function: ftstat_rpt_32_new
  *
- * Allocate and initialize data structures for rpt 2.
+ * Allocate and initialize data structures for rpt 32.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_2 *ftstat_rpt_2_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_32 *ftstat_rpt_32_new(struct ftstat_rpt *rpt)
 {
-  struct ftstat_rpt_2 *rpt2;
-
-  if (!(rpt2 = (struct ftstat_rpt_2*)malloc(sizeof (*rpt2)))) {
-    fterr_warnx("malloc(rpt2): failed");
-    return (struct ftstat_rpt_2*)0L;
-  }
 
-  bzero(rpt2, sizeof *rpt2);
-
-  return rpt2;
+  STD_NEW_HASH(ftstat_rpt_32, rpt32, 65536, ftchash_rec_prefix16, 8, 65536);
 
-} /* ftstat_rpt_2_new */
+} /* ftstat_rpt_32_new */
 
 
-/* function: ftstat_rpt_2_accum
+/* function: ftstat_rpt_32_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_2_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_32_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
-  struct fts3rec_all2 cur;
-  uint32_t duration_tmp;
-  double pps_tmp, bps_tmp;
 
-  STD_ACCUM;
+  STD_ACCUM_HASH1(ftstat_rpt_32, rpt32, ftchash_rec_prefix16,
+    ftch_recprefix16, ftch_recprefix16p);
 
-  return 0;
-} /* ftstat_rpt_2_accum */
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+    
+  ftch_recprefix16.prefix = cur.srcaddr;
+  ftch_recprefix16.c16 = cur.input;
 
-/* function: ftstat_rpt_2_calc
- *
- * Perform final calculations for rpt2
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_2_calc(struct ftstat_rpt *rpt)
-{
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.src_mask;
+  }
 
-  STD_CALC;
+  /* remove host bits */ 
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
+  STD_ACCUM_HASH2(rpt32, ftch_recprefix16, ftch_recprefix16p);
+  
   return 0;
+   
+} /* ftstat_rpt_32_accum */
 
-} /* ftstat_rpt_2_calc */
-
-
-/* function: ftstat_rpt_2_dump
+/* function: ftstat_rpt_32_calc
  *
- * Dump data for report.
+ * Perform final calculations for rpt32
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_2_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_32_calc(struct ftstat_rpt *rpt)
 {
-  return 0;
-} /* ftstat_rpt_2_dump */
 
+  STD_CALC_HASH(ftstat_rpt_32, rpt32, ftchash_rec_prefix16, ftch_recprefix16);
 
-/* function: ftstat_rpt_2_free
+} /* ftstat_rpt_32_calc */
+
+/* function: ftstat_rpt_32_merge
  *
- * Free data structures for report allocated by ftstat_rpt_2_new
+ * Merge the counters accumulated by src into rpt32
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_2_free(struct ftstat_rpt_2 *rpt2)
+int ftstat_rpt_32_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
-  if (rpt2)
-    free(rpt2);
-} /* ftstat_rpt_2_free */
 
+  STD_MERGE_HASH(ftstat_rpt_32, ftchash_rec_prefix16);
 
-/* function: ftstat_rpt_3_new
+} /* ftstat_rpt_32_merge */
+
+/* function: ftstat_rpt_32_save
  *
- * Allocate and initialize data structures for rpt 3.
+ * Write the counters of rpt32 to fp
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_3 *ftstat_rpt_3_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_32_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_HASH(ftstat_rpt_3, rpt3, 65536, ftchash_rec_c32, 4, 65536);
-
-} /* ftstat_rpt_3_new */
+  STD_SAVE_HASH(ftstat_rpt_32, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_32_save */
 
-/* function: ftstat_rpt_3_accum
+/* function: ftstat_rpt_32_load
  *
- * Accumulate counters for report by processing flow.
+ * Merge counters written by ftstat_rpt_32_save() into rpt32
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_3_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_32_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_3, rpt3, ftchash_rec_c32, ftch_recc32,
-    ftch_recc32p);
+  STD_LOAD_HASH(ftstat_rpt_32, ftchash_rec_prefix16);
 
-  ftch_recc32.c32 = cur.dOctets64 / cur.dPkts64;
+} /* ftstat_rpt_32_load */
 
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+/* function: ftstat_rpt_32_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_32_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-  STD_ACCUM_HASH2(rpt3, ftch_recc32, ftch_recc32p);
+  STD_DUMP_HASH1P(ftstat_rpt_32, rpt32, chash_prefix16_dump,
+   FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+   (char*)0L,
+    "", "ip-source-address", "input-interface", "", "", "", "");
 
-  return 0;
+} /* ftstat_rpt_32_dump */
 
-} /* ftstat_rpt_3_accum */
 
-/* function: ftstat_rpt_3_calc
+/* function: ftstat_rpt_32_free
  *
- * Perform final calculations for rpt3
+ * Free data structures for report allocated by ftstat_rpt_32_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_3_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_32_free(struct ftstat_rpt_32 *rpt32)
 {
 
-  STD_CALC_HASH(ftstat_rpt_3, rpt3, ftchash_rec_c32, ftch_recc32);
+  STD_FREE_HASH(rpt32);
 
-} /* ftstat_rpt_3_calc */
+} /* ftstat_rpt_32_free */
 
-/* function: ftstat_rpt_3_dump
+
+/* function: ftstat_rpt_33_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 33.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_3_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_33 *ftstat_rpt_33_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_3, rpt3, chash_c32_dump, (char*)0L,
-    "packet size/flow", "", "", "", "", "", "");
+  STD_NEW_HASH(ftstat_rpt_33, rpt33, 65536, ftchash_rec_prefix16, 8, 65536);
 
-} /* ftstat_rpt_3_dump */
+} /* ftstat_rpt_33_new */
 
 
-/* function: ftstat_rpt_3_free
+/* function: ftstat_rpt_33_accum
  *
- * Free data structures for report allocated by ftstat_rpt_3_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_3_free(struct ftstat_rpt_3 *rpt3)
+int ftstat_rpt_33_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_FREE_HASH(rpt3);
+  STD_ACCUM_HASH1(ftstat_rpt_33, rpt33, ftchash_rec_prefix16,
+    ftch_recprefix16, ftch_recprefix16p);
 
-} /* ftstat_rpt_3_free */
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  
+  ftch_recprefix16.prefix = cur.dstaddr;
+  ftch_recprefix16.c16 = cur.input;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.dst_mask;
+  }
+ 
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
+  STD_ACCUM_HASH2(rpt33, ftch_recprefix16, ftch_recprefix16p);
+  
+  return 0;
+   
+} /* ftstat_rpt_33_accum */
 
-/* function: ftstat_rpt_4_new
+/* function: ftstat_rpt_33_calc
  *
- * Allocate and initialize data structures for rpt 4.
+ * Perform final calculations for rpt33
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_4 *ftstat_rpt_4_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_33_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_4, rpt4, 65536, ftchash_rec_c64, 8, 65536);
-
-} /* ftstat_rpt_4_new */
+  STD_CALC_HASH(ftstat_rpt_33, rpt33, ftchash_rec_prefix16, ftch_recprefix16);
 
+} /* ftstat_rpt_33_calc */
 
-/* function: ftstat_rpt_4_accum
+/* function: ftstat_rpt_33_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt33
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_4_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_33_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_4, rpt4, ftchash_rec_c64, ftch_recc64,
-    ftch_recc64p);
+  STD_MERGE_HASH(ftstat_rpt_33, ftchash_rec_prefix16);
 
-  ftch_recc64.c64 = cur.dOctets64;
-     
-  hash = ftch_recc64.c64 & 0x000000FFFFFFLL; 
-  hash = (hash>>16) ^ (hash & 0xFFFF);
+} /* ftstat_rpt_33_merge */
 
-  STD_ACCUM_HASH2(rpt4, ftch_recc64, ftch_recc64p);
-  
-  return 0;
+/* function: ftstat_rpt_33_save
+ *
+ * Write the counters of rpt33 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_33_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-} /* ftstat_rpt_4_accum */
+  STD_SAVE_HASH(ftstat_rpt_33, ftchash_rec_prefix16);
 
-/* function: ftstat_rpt_4_calc
+} /* ftstat_rpt_33_save */
+
+/* function: ftstat_rpt_33_load
  *
- * Perform final calculations for rpt4
+ * Merge counters written by ftstat_rpt_33_save() into rpt33
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_4_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_33_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_4, rpt4, ftchash_rec_c64, ftch_recc64);
+  STD_LOAD_HASH(ftstat_rpt_33, ftchash_rec_prefix16);
 
-} /* ftstat_rpt_4_calc */
+} /* ftstat_rpt_33_load */
 
-/* function: ftstat_rpt_4_dump
+/* function: ftstat_rpt_33_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_4_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_33_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_4, rpt4, chash_c64_dump,
-    "octets/flow", "", "", "", "", "", "");
+  STD_DUMP_HASH1P(ftstat_rpt_33, rpt33, chash_prefix16_dump,
+   FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+   (char*)0L,
+    "", "ip-destination-address", "input-interface", "", "", "", "");
 
-} /* ftstat_rpt_4_dump */
+} /* ftstat_rpt_33_dump */
 
 
-/* function: ftstat_rpt_4_free
+/* function: ftstat_rpt_33_free
  *
- * Free data structures for report allocated by ftstat_rpt_4_new
+ * Free data structures for report allocated by ftstat_rpt_33_new
  *
  */
-void ftstat_rpt_4_free(struct ftstat_rpt_4 *rpt4)
+void ftstat_rpt_33_free(struct ftstat_rpt_33 *rpt33)
 {
 
-  STD_FREE_HASH(rpt4);
+  STD_FREE_HASH(rpt33);
 
-} /* ftstat_rpt_4_free */
+} /* ftstat_rpt_33_free */
 
 
-/* function: ftstat_rpt_5_new
+/* function: ftstat_rpt_34_new
  *
- * Allocate and initialize data structures for rpt 5.
+ * Allocate and initialize data structures for rpt 34.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_5 *ftstat_rpt_5_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_34 *ftstat_rpt_34_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_5, rpt5, 65536, ftchash_rec_c64, 8, 65536);
+  STD_NEW_HASH(ftstat_rpt_34, rpt34, 65536, ftchash_rec_prefix16, 8, 65536);
 
-} /* ftstat_rpt_5_new */
+} /* ftstat_rpt_34_new */
 
 
-/* function: ftstat_rpt_5_accum
+/* function: ftstat_rpt_34_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_5_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_34_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_5, rpt5, ftchash_rec_c64, ftch_recc64,
-    ftch_recc64p);
+  STD_ACCUM_HASH1(ftstat_rpt_33, rpt33, ftchash_rec_prefix16,
+    ftch_recprefix16, ftch_recprefix16p);
 
-  ftch_recc64.c64 = cur.dPkts64;
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
   
-  hash = ftch_recc64.c64 & 0x000000FFFFFFLL; 
-  hash = (hash>>16) ^ (hash & 0xFFFF);
+  ftch_recprefix16.prefix = cur.srcaddr;
+  ftch_recprefix16.c16 = cur.output;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.src_mask;
+  }
+ 
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
-  STD_ACCUM_HASH2(rpt5, ftch_recc64, ftch_recc64p);
+  STD_ACCUM_HASH2(rpt33, ftch_recprefix16, ftch_recprefix16p);
   
   return 0;
+   
+} /* ftstat_rpt_34_accum */
 
-} /* ftstat_rpt_5_accum */
-
-/* function: ftstat_rpt_5_calc
+/* function: ftstat_rpt_34_calc
  *
- * Perform final calculations for rpt5
+ * Perform final calculations for rpt34
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_5_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_34_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_5, rpt5, ftchash_rec_c64, ftch_recc64);
+  STD_CALC_HASH(ftstat_rpt_34, rpt34, ftchash_rec_prefix16, ftch_recprefix16);
 
-} /* ftstat_rpt_5_calc */
+} /* ftstat_rpt_34_calc */
 
-/* function: ftstat_rpt_5_dump
+/* function: ftstat_rpt_34_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt34
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_5_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_34_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_5, rpt5, chash_c64_dump,
-    "packets/flow", "", "", "", "", "", "");
-
-} /* ftstat_rpt_5_dump */
+  STD_MERGE_HASH(ftstat_rpt_34, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_34_merge */
 
-/* function: ftstat_rpt_5_free
+/* function: ftstat_rpt_34_save
  *
- * Free data structures for report allocated by ftstat_rpt_5_new
+ * Write the counters of rpt34 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_5_free(struct ftstat_rpt_5 *rpt5)
+int ftstat_rpt_34_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt5);
-
-} /* ftstat_rpt_5_free */
+  STD_SAVE_HASH(ftstat_rpt_34, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_34_save */
 
-/* function: ftstat_rpt_6_new
+/* function: ftstat_rpt_34_load
  *
- * Allocate and initialize data structures for rpt 6.
+ * Merge counters written by ftstat_rpt_34_save() into rpt34
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_6 *ftstat_rpt_6_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_34_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_6, rpt6, 65536, rpt);
-
-} /* ftstat_rpt_6_new */
+  STD_LOAD_HASH(ftstat_rpt_34, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_34_load */
 
-/* function: ftstat_rpt_6_accum
+/* function: ftstat_rpt_34_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_6_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_34_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_6, rpt6);
-
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-
-  STD_ACCUM_BUCKET2(rpt6->bucket, cur.srcport);
+  STD_DUMP_HASH1P(ftstat_rpt_28, rpt28, chash_prefix16_dump,
+   FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+   (char*)0L,
+    "", "ip-source-address", "output-interface", "", "", "", "");
 
-  return 0;
+} /* ftstat_rpt_34_dump */
 
-} /* ftstat_rpt_6_accum */
 
-/* function: ftstat_rpt_6_calc
+/* function: ftstat_rpt_34_free
  *
- * Perform final calculations for rpt6
+ * Free data structures for report allocated by ftstat_rpt_34_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_6_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_34_free(struct ftstat_rpt_34 *rpt34)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_6, rpt6, 65536);
+  STD_FREE_HASH(rpt34);
 
-} /* ftstat_rpt_6_calc */
+} /* ftstat_rpt_34_free */
 
-/* function: ftstat_rpt_6_dump
+
+/* function: ftstat_rpt_35_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 35.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_6_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_35 *ftstat_rpt_35_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_6, rpt6, 65536, FT_PATH_SYM_TCP_PORT,
-    "ip-source-port", "", "", "", "", "", "");
+  STD_NEW_HASH(ftstat_rpt_35, rpt35, 65536, ftchash_rec_prefix16, 8, 65536);
 
-} /* ftstat_rpt_6_dump */
+} /* ftstat_rpt_35_new */
 
 
-/* function: ftstat_rpt_6_free
+/* function: ftstat_rpt_35_accum
  *
- * Free data structures for report allocated by ftstat_rpt_6_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_6_free(struct ftstat_rpt_6 *rpt6)
+int ftstat_rpt_35_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_FREE_BUCKET(rpt6);
+  STD_ACCUM_HASH1(ftstat_rpt_35, rpt35, ftchash_rec_prefix16,
+    ftch_recprefix16, ftch_recprefix16p);
 
-} /* ftstat_rpt_6_free */
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  
+  ftch_recprefix16.prefix = cur.dstaddr;
+  ftch_recprefix16.c16 = cur.output;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.dst_mask;
+  }
+ 
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
+  STD_ACCUM_HASH2(rpt35, ftch_recprefix16, ftch_recprefix16p);
+  
+  return 0;
+   
+} /* ftstat_rpt_35_accum */
 
-/* function: ftstat_rpt_7_new
+/* function: ftstat_rpt_35_calc
  *
- * Allocate and initialize data structures for rpt 7.
+ * Perform final calculations for rpt35
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_7 *ftstat_rpt_7_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_35_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_7, rpt7, 65536, rpt);
-
-} /* ftstat_rpt_7_new */
+  STD_CALC_HASH(ftstat_rpt_35, rpt35, ftchash_rec_prefix16, ftch_recprefix16);
 
+} /* ftstat_rpt_35_calc */
 
-/* function: ftstat_rpt_7_accum
+/* function: ftstat_rpt_35_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt35
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_7_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_35_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_7, rpt7);
+  STD_MERGE_HASH(ftstat_rpt_35, ftchash_rec_prefix16);
 
-  FT_RECGET_DSTPORT(cur,rec,*fo);
+} /* ftstat_rpt_35_merge */
 
-  STD_ACCUM_BUCKET2(rpt7->bucket, cur.dstport);
+/* function: ftstat_rpt_35_save
+ *
+ * Write the counters of rpt35 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_35_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  return 0;
+  STD_SAVE_HASH(ftstat_rpt_35, ftchash_rec_prefix16);
 
-} /* ftstat_rpt_7_accum */
+} /* ftstat_rpt_35_save */
 
-/* function: ftstat_rpt_7_calc
+/* function: ftstat_rpt_35_load
  *
- * Perform final calculations for rpt7
+ * Merge counters written by ftstat_rpt_35_save() into rpt35
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_7_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_35_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_7, rpt7, 65536);
+  STD_LOAD_HASH(ftstat_rpt_35, ftchash_rec_prefix16);
 
-} /* ftstat_rpt_7_calc */
+} /* ftstat_rpt_35_load */
 
-/* function: ftstat_rpt_7_dump
+/* function: ftstat_rpt_35_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_7_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_35_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_7, rpt7, 65536, FT_PATH_SYM_TCP_PORT,
-    "ip-destination-port", "", "", "", "", "", "");
+  STD_DUMP_HASH1P(ftstat_rpt_35, rpt35, chash_prefix16_dump,
+   FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+   (char*)0L,
+    "", "ip-destination-address", "output-interface", "", "", "", "");
 
-} /* ftstat_rpt_7_dump */
+} /* ftstat_rpt_35_dump */
 
 
-/* function: ftstat_rpt_7_free
+/* function: ftstat_rpt_35_free
  *
- * Free data structures for report allocated by ftstat_rpt_7_new
+ * Free data structures for report allocated by ftstat_rpt_35_new
  *
  */
-void ftstat_rpt_7_free(struct ftstat_rpt_7 *rpt7)
+void ftstat_rpt_35_free(struct ftstat_rpt_35 *rpt35)
 {
-} /* ftstat_rpt_7_free */
 
+  STD_FREE_HASH(rpt35);
 
-/* function: ftstat_rpt_8_new
+} /* ftstat_rpt_35_free */
+
+
+/* function: ftstat_rpt_36_new
  *
- * Allocate and initialize data structures for rpt 8.
+ * Allocate and initialize data structures for rpt 36.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_8 *ftstat_rpt_8_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_36 *ftstat_rpt_36_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_8, rpt8, 65536, ftchash_rec_c162, 4, 65536);
+  STD_NEW_HASH(ftstat_rpt_36, rpt36, 65536, ftchash_rec_prefix216, 13, 65536);
 
-} /* ftstat_rpt_8_new */
+} /* ftstat_rpt_36_new */
 
 
-/* function: ftstat_rpt_8_accum
+/* function: ftstat_rpt_36_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_8_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_36_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_8, rpt8, ftchash_rec_c162, ftch_recc162,
-    ftch_recc162p);
+  STD_ACCUM_HASH1(ftstat_rpt_36, rpt36, ftchash_rec_prefix216,
+    ftch_recprefix216, ftch_recprefix216p);
 
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-  FT_RECGET_SRCPORT(cur,rec,*fo);
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+    
+  ftch_recprefix216.src_prefix = cur.srcaddr;
+  ftch_recprefix216.dst_prefix = cur.dstaddr;
+  ftch_recprefix216.c16 = cur.input;
 
-  ftch_recc162.c16a = cur.srcport;
-  ftch_recc162.c16b = cur.dstport;
-  
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix216.src_mask = cur.src_mask;
+  }
 
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix216.dst_mask = cur.dst_mask;
+  }
+ 
+  /* remove host bits */  
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
+  }
 
-  STD_ACCUM_HASH2(rpt8, ftch_recc162, ftch_recc162p);
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
+  }
+  
+  hash = (ftch_recprefix216.src_prefix>>16)^
+          (ftch_recprefix216.src_prefix & 0xFFFF)^
+          (ftch_recprefix216.dst_prefix>>16)^
+          (ftch_recprefix216.dst_prefix & 0xFFFF)^
+          (ftch_recprefix216.c16)^
+          (ftch_recprefix216.src_mask)^
+          (uint32_t)(ftch_recprefix216.dst_mask<<8);
 
+  STD_ACCUM_HASH2(rpt36, ftch_recprefix216, ftch_recprefix216p);
+  
   return 0;
    
-} /* ftstat_rpt_8_accum */
+} /* ftstat_rpt_36_accum */
+
+/* function: ftstat_rpt_36_calc
+ *
+ * Perform final calculations for rpt36
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_36_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_36, rpt36, ftchash_rec_prefix216, ftch_recprefix216);
 
-/* function: ftstat_rpt_8_calc
+} /* ftstat_rpt_36_calc */
+
+/* function: ftstat_rpt_36_merge
  *
- * Perform final calculations for rpt8
+ * Merge the counters accumulated by src into rpt36
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_8_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_36_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_CALC_HASH(ftstat_rpt_8, rpt8, ftchash_rec_c162, ftch_recc162);
+  STD_MERGE_HASH(ftstat_rpt_36, ftchash_rec_prefix216);
 
-} /* ftstat_rpt_8_calc */
+} /* ftstat_rpt_36_merge */
 
-/* function: ftstat_rpt_8_dump
+/* function: ftstat_rpt_36_save
  *
- * Dump data for report.
+ * Write the counters of rpt36 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_8_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_36_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_8, rpt8, chash_c162_dump,
-    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-port", "ip-destination-port", "", "", "", "");
-
-} /* ftstat_rpt_8_dump */
+  STD_SAVE_HASH(ftstat_rpt_36, ftchash_rec_prefix216);
 
+} /* ftstat_rpt_36_save */
 
-/* function: ftstat_rpt_8_free
+/* function: ftstat_rpt_36_load
  *
- * Free data structures for report allocated by ftstat_rpt_8_new
+ * Merge counters written by ftstat_rpt_36_save() into rpt36
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_8_free(struct ftstat_rpt_8 *rpt8)
+int ftstat_rpt_36_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt8);
-
-} /* ftstat_rpt_8_free */
+  STD_LOAD_HASH(ftstat_rpt_36, ftchash_rec_prefix216);
 
+} /* ftstat_rpt_36_load */
 
-/* function: ftstat_rpt_9_new
+/* function: ftstat_rpt_36_dump
  *
- * Allocate and initialize data structures for rpt 9.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_9 *ftstat_rpt_9_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_36_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_9, rpt9, 65536, ftchash_rec_c64, 8, 65536);
+  STD_DUMP_HASH1(ftstat_rpt_36, rpt36, chash_prefix216_dump,
+    (char*)0L,
+    "", "ip-source-address", "ip-destination-address", "input-interface", "",
+    "", "");
 
-} /* ftstat_rpt_9_new */
+} /* ftstat_rpt_36_dump */
 
 
-/* function: ftstat_rpt_9_accum
+/* function: ftstat_rpt_36_free
  *
- * Accumulate counters for report by processing flow.
+ * Free data structures for report allocated by ftstat_rpt_36_new
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_9_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+void ftstat_rpt_36_free(struct ftstat_rpt_36 *rpt36)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_9, rpt9, ftchash_rec_c64, ftch_recc64,
-    ftch_recc64p);
-
-  ftch_recc64.c64 = (duration_tmp) ?
-    (double)cur.dOctets64*8/((double)(duration_tmp)/1000.0) : 0;
-
-  hash = ftch_recc64.c64 & 0x000000FFFFFFLL;
-  hash = (hash>>16) ^ (hash & 0xFFFF);
+  STD_FREE_HASH(rpt36);
 
-  STD_ACCUM_HASH2(rpt9, ftch_recc64, ftch_recc64p);
+} /* ftstat_rpt_36_free */
 
-  return 0;
-   
-} /* ftstat_rpt_9_accum */
 
-/* function: ftstat_rpt_9_calc
+/* function: ftstat_rpt_37_new
  *
- * Perform final calculations for rpt9
+ * Allocate and initialize data structures for rpt 37.
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_9_calc(struct ftstat_rpt *rpt)
+struct ftstat_rpt_37 *ftstat_rpt_37_new(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_9, rpt9, ftchash_rec_c64, ftch_recc64);
+  STD_NEW_HASH(ftstat_rpt_37, rpt37, 65536, ftchash_rec_prefix216, 13, 65536);
 
-} /* ftstat_rpt_9_calc */
+} /* ftstat_rpt_37_new */
 
 
-/* function: ftstat_rpt_9_dump
+/* function: ftstat_rpt_37_accum
  *
- * Dump data for report.
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_9_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_37_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_9, rpt9, chash_c64_dump,
-    "bps/flow", "", "", "", "", "", "");
+  STD_ACCUM_HASH1(ftstat_rpt_37, rpt37, ftchash_rec_prefix216,
+    ftch_recprefix216, ftch_recprefix216p);
 
-} /* ftstat_rpt_9_dump */
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
 
+  ftch_recprefix216.src_prefix = cur.srcaddr;
+  ftch_recprefix216.dst_prefix = cur.dstaddr;
+  ftch_recprefix216.c16 = cur.output;
 
-/* function: ftstat_rpt_9_free
- *
- * Free data structures for report allocated by ftstat_rpt_9_new
- *
- */
-void ftstat_rpt_9_free(struct ftstat_rpt_9 *rpt9)
-{
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix216.src_mask = cur.src_mask;
+  }
 
-  STD_FREE_HASH(rpt9);
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix216.dst_mask = cur.dst_mask;
+  }
+ 
+  /* remove host bits */  
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
+  }
 
-} /* ftstat_rpt_9_free */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
+  }
+  
+  hash = (ftch_recprefix216.src_prefix>>16)^
+          (ftch_recprefix216.src_prefix & 0xFFFF)^
+          (ftch_recprefix216.dst_prefix>>16)^
+          (ftch_recprefix216.dst_prefix & 0xFFFF)^
+          (ftch_recprefix216.c16)^
+          (ftch_recprefix216.src_mask)^
+          (uint32_t)(ftch_recprefix216.dst_mask<<8);
+  
+  STD_ACCUM_HASH2(rpt37, ftch_recprefix216, ftch_recprefix216p);
 
+  return 0;
+   
+} /* ftstat_rpt_37_accum */
 
-/* function: ftstat_rpt_10_new
+/* function: ftstat_rpt_37_calc
  *
- * Allocate and initialize data structures for rpt 10.
+ * Perform final calculations for rpt37
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_10 *ftstat_rpt_10_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_37_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_10, rpt10, 65536, ftchash_rec_c64, 8, 65536);
-
-} /* ftstat_rpt_10_new */
+  STD_CALC_HASH(ftstat_rpt_37, rpt37, ftchash_rec_prefix216, ftch_recprefix216);
 
+} /* ftstat_rpt_37_calc */
 
-/* function: ftstat_rpt_10_accum
+/* function: ftstat_rpt_37_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt37
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_10_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_37_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_10, rpt10, ftchash_rec_c64, ftch_recc64,
-    ftch_recc64p);
+  STD_MERGE_HASH(ftstat_rpt_37, ftchash_rec_prefix216);
 
-  ftch_recc64.c64 = (duration_tmp) ?
-    (double)cur.dPkts64/((double)(duration_tmp)/1000.0) : 0;
+} /* ftstat_rpt_37_merge */
 
-  hash = ftch_recc64.c64 & 0x000000FFFFFFLL;
-  hash = (hash>>16) ^ (hash & 0xFFFF);
+/* function: ftstat_rpt_37_save
+ *
+ * Write the counters of rpt37 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_37_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  STD_ACCUM_HASH2(rpt10, ftch_recc64, ftch_recc64p);
-  
-  return 0;
-   
-} /* ftstat_rpt_10_accum */
+  STD_SAVE_HASH(ftstat_rpt_37, ftchash_rec_prefix216);
 
-/* function: ftstat_rpt_10_calc
+} /* ftstat_rpt_37_save */
+
+/* function: ftstat_rpt_37_load
  *
- * Perform final calculations for rpt10
+ * Merge counters written by ftstat_rpt_37_save() into rpt37
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_10_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_37_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_10, rpt10, ftchash_rec_c64, ftch_recc64);
+  STD_LOAD_HASH(ftstat_rpt_37, ftchash_rec_prefix216);
 
-} /* ftstat_rpt_10_calc */
+} /* ftstat_rpt_37_load */
 
-/* function: ftstat_rpt_10_dump
+/* function: ftstat_rpt_37_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_10_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_37_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_10, rpt10, chash_c64_dump,
-    "pps/flow", "", "", "", "", "", "");
+  STD_DUMP_HASH1(ftstat_rpt_37, rpt37, chash_prefix216_dump,
+    (char*)0L,
+    "", "ip-source-address", "ip-destination-address", "output-interface", "",
+    "", "");
 
-} /* ftstat_rpt_10_dump */
+} /* ftstat_rpt_37_dump */
 
 
-/* function: ftstat_rpt_10_free
+/* function: ftstat_rpt_37_free
  *
- * Free data structures for report allocated by ftstat_rpt_10_new
+ * Free data structures for report allocated by ftstat_rpt_37_new
  *
  */
-void ftstat_rpt_10_free(struct ftstat_rpt_10 *rpt10)
+void ftstat_rpt_37_free(struct ftstat_rpt_37 *rpt37)
 {
 
-  STD_FREE_HASH(rpt10);
+  STD_FREE_HASH(rpt37);
 
-} /* ftstat_rpt_10_free */
+} /* ftstat_rpt_37_free */
 
 
-/* function: ftstat_rpt_11_new
+/* function: ftstat_rpt_38_new
  *
- * Allocate and initialize data structures for rpt 11.
+ * Allocate and initialize data structures for rpt 38.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_11 *ftstat_rpt_11_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_38 *ftstat_rpt_38_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_11, rpt11, 7, rpt);
+  STD_NEW_HASH(ftstat_rpt_38, rpt38, 65536, ftchash_rec_prefix2162, 16, 65536);
 
-} /* ftstat_rpt_11_new */
+} /* ftstat_rpt_38_new */
 
 
-/* function: ftstat_rpt_11_accum
+/* function: ftstat_rpt_38_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_11_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_38_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
-  uint16_t tmp;
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_11, rpt11);
+  STD_ACCUM_HASH1(ftstat_rpt_38, rpt38, ftchash_rec_prefix2162,
+    ftch_recprefix2162, ftch_recprefix2162p);
 
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
+ 
+  ftch_recprefix2162.src_prefix = cur.srcaddr;
+  ftch_recprefix2162.dst_prefix = cur.dstaddr;
+  ftch_recprefix2162.c16a = cur.input;
+  ftch_recprefix2162.c16b = cur.output;
 
-  if ((cur.dstaddr & 0xf0000000) == 0xf0000000)
-    tmp = 5; /* Class E Reserved */
-  else if ((cur.dstaddr & 0xff000000) == 0xe8000000)
-    tmp = 4; /* Class D Multicast-SSM */
-  else if ((cur.dstaddr & 0xf0000000) == 0xe0000000)
-    tmp = 3; /* Class D Multicast-ASM */
-  else if ((cur.dstaddr & 0xe0000000) == 0xc0000000)
-    tmp = 2; /* Class C Unicast */
-  else if ((cur.dstaddr & 0xc0000000) == 0x80000000)
-    tmp = 1; /* Class B Unicast */
-  else if ((cur.dstaddr & 0x80000000) == 0x00000000)
-    tmp = 0; /* Class A Unicast */
-  else
-    tmp = 6; /* not reached */
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix2162.src_mask = cur.src_mask;
+  }
+
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix2162.dst_mask = cur.dst_mask;
+  }
+  
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recprefix2162.src_prefix &= ipv4_len2mask(ftch_recprefix2162.src_mask);
+  }
+
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recprefix2162.dst_prefix &= ipv4_len2mask(ftch_recprefix2162.dst_mask);
+  }
   
-  STD_ACCUM_BUCKET2(rpt11->bucket, tmp);
+  hash = (ftch_recprefix2162.src_prefix>>16)^
+          (ftch_recprefix2162.src_prefix & 0xFFFF)^
+          (ftch_recprefix2162.dst_prefix>>16)^
+          (ftch_recprefix2162.dst_prefix & 0xFFFF)^
+          (ftch_recprefix2162.c16b)^
+          (ftch_recprefix2162.c16a)^
+          (ftch_recprefix2162.src_mask)^
+          (uint32_t)(ftch_recprefix2162.dst_mask<<8);
+  
+  STD_ACCUM_HASH2(rpt38, ftch_recprefix2162, ftch_recprefix2162p);
 
   return 0;
+   
+} /* ftstat_rpt_38_accum */
 
-} /* ftstat_rpt_11_accum */
-
-/* function: ftstat_rpt_11_calc
+/* function: ftstat_rpt_38_calc
  *
- * Perform final calculations for rpt11
+ * Perform final calculations for rpt38
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_11_calc(struct ftstat_rpt *rpt)
-{
-
-  STD_CALC_BUCKET(ftstat_rpt_11, rpt11, 7);
-
-} /* ftstat_rpt_11_calc */
-
-/* function: ftstat_rpt_11_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_11_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
-
-  STD_DUMP_BUCKET(ftstat_rpt_11, rpt11, 7, FT_PATH_SYM_IP_TYPE,
-    "ip-destination-address-type", "", "", "", "", "", "");
-
-} /* ftstat_rpt_11_dump */
-
-
-/* function: ftstat_rpt_11_free
- *
- * Free data structures for report allocated by ftstat_rpt_11_new
- *
- */
-void ftstat_rpt_11_free(struct ftstat_rpt_11 *rpt11)
+int ftstat_rpt_38_calc(struct ftstat_rpt *rpt)
 {
+  
+  STD_CALC_HASH(ftstat_rpt_38, rpt38, ftchash_rec_prefix2162,
+    ftch_recprefix2162);
+    
+} /* ftstat_rpt_38_calc */
 
-  STD_FREE_BUCKET(rpt11);
-
-} /* ftstat_rpt_11_free */
-
-
-/* function: ftstat_rpt_12_new
+/* function: ftstat_rpt_38_merge
  *
- * Allocate and initialize data structures for rpt 12.
+ * Merge the counters accumulated by src into rpt38
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_12 *ftstat_rpt_12_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_38_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_12, rpt12, 256, rpt);
-
-} /* ftstat_rpt_12_new */
+  STD_MERGE_HASH(ftstat_rpt_38, ftchash_rec_prefix2162);
 
+} /* ftstat_rpt_38_merge */
 
-/* function: ftstat_rpt_12_accum
+/* function: ftstat_rpt_38_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt38 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_12_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_38_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_12, rpt12);
-
-  FT_RECGET_PROT(cur,rec,*fo);
-
-  STD_ACCUM_BUCKET2(rpt12->bucket, cur.prot);
-
-  return 0;
+  STD_SAVE_HASH(ftstat_rpt_38, ftchash_rec_prefix2162);
 
-} /* ftstat_rpt_12_accum */
+} /* ftstat_rpt_38_save */
 
-/* function: ftstat_rpt_12_calc
+/* function: ftstat_rpt_38_load
  *
- * Perform final calculations for rpt12
+ * Merge counters written by ftstat_rpt_38_save() into rpt38
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_12_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_38_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_12, rpt12, 256);
+  STD_LOAD_HASH(ftstat_rpt_38, ftchash_rec_prefix2162);
 
-} /* ftstat_rpt_12_calc */
+} /* ftstat_rpt_38_load */
 
-/* function: ftstat_rpt_12_dump
+/* function: ftstat_rpt_38_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_12_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_38_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_12, rpt12, 256, FT_PATH_SYM_IP_PROT,
-    "ip-protocol", "", "", "", "", "", "");
-} /* ftstat_rpt_12_dump */
+  STD_DUMP_HASH2(ftstat_rpt_31, rpt31, chash_prefix2162_dump,
+    (char*)0L, (char*)0L,
+    "", "ip-source-address", "ip-destination-address", "input-interface",
+    "output-interface", "", "");
+
+} /* ftstat_rpt_38_dump */
 
 
-/* function: ftstat_rpt_12_free
+/* function: ftstat_rpt_38_free
  *
- * Free data structures for report allocated by ftstat_rpt_12_new
+ * Free data structures for report allocated by ftstat_rpt_38_new
  *
  */
-void ftstat_rpt_12_free(struct ftstat_rpt_12 *rpt12)
+void ftstat_rpt_38_free(struct ftstat_rpt_38 *rpt38)
 {
 
-  STD_FREE_BUCKET(rpt12);
+  STD_FREE_HASH(rpt38);
 
-} /* ftstat_rpt_12_free */
+} /* ftstat_rpt_38_free */
 
 
-/* function: ftstat_rpt_13_new
+/* function: ftstat_rpt_39_new
  *
- * Allocate and initialize data structures for rpt 13.
+ * Allocate and initialize data structures for rpt 39.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_13 *ftstat_rpt_13_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_39 *ftstat_rpt_39_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_13, rpt13, 256, rpt);
+  STD_NEW_HASH(ftstat_rpt_39, rpt39, 65536, ftchash_rec_c162, 4, 65536);
 
-} /* ftstat_rpt_13_new */
+} /* ftstat_rpt_39_new */
 
 
-/* function: ftstat_rpt_13_accum
+/* function: ftstat_rpt_39_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_13_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_39_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_13, rpt13);
+  STD_ACCUM_HASH1(ftstat_rpt_39, rpt39, ftchash_rec_c162,
+    ftch_recc162, ftch_recc162p);
 
-  FT_RECGET_TOS(cur,rec,*fo);
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_SRC_AS(cur,rec,*fo);
 
-  STD_ACCUM_BUCKET2(rpt13->bucket, cur.tos);
+  ftch_recc162.c16a = cur.input;
+  ftch_recc162.c16b = cur.src_as;
+ 
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
 
+  STD_ACCUM_HASH2(rpt39, ftch_recc162, ftch_recc162p);
+  
   return 0;
+   
+} /* ftstat_rpt_39_accum */
 
-} /* ftstat_rpt_13_accum */
-
-/* function: ftstat_rpt_13_calc
+/* function: ftstat_rpt_39_calc
  *
- * Perform final calculations for rpt13
+ * Perform final calculations for rpt39
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_13_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_39_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_13, rpt13, 256);
+  STD_CALC_HASH(ftstat_rpt_39, rpt39, ftchash_rec_c162, ftch_recc162);
 
-} /* ftstat_rpt_13_calc */
+} /* ftstat_rpt_39_calc */
 
-/* function: ftstat_rpt_13_dump
+/* function: ftstat_rpt_39_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt39
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_13_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_39_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_13, rpt13, 256, (char*)0L,
-    "ip-tos", "", "", "", "", "", "");
-
-} /* ftstat_rpt_13_dump */
+  STD_MERGE_HASH(ftstat_rpt_39, ftchash_rec_c162);
 
+} /* ftstat_rpt_39_merge */
 
-/* function: ftstat_rpt_13_free
+/* function: ftstat_rpt_39_save
  *
- * Free data structures for report allocated by ftstat_rpt_13_new
+ * Write the counters of rpt39 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_13_free(struct ftstat_rpt_13 *rpt13)
+int ftstat_rpt_39_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_BUCKET(rpt13);
-
-} /* ftstat_rpt_13_free */
+  STD_SAVE_HASH(ftstat_rpt_39, ftchash_rec_c162);
 
+} /* ftstat_rpt_39_save */
 
-/* function: ftstat_rpt_14_new
+/* function: ftstat_rpt_39_load
  *
- * Allocate and initialize data structures for rpt 14.
+ * Merge counters written by ftstat_rpt_39_save() into rpt39
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_14 *ftstat_rpt_14_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_39_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_HASH(ftstat_rpt_14, rpt14, 65536, ftchash_rec_c32, 4, 65536);
-
-} /* ftstat_rpt_14_new */
+  STD_LOAD_HASH(ftstat_rpt_39, ftchash_rec_c162);
 
+} /* ftstat_rpt_39_load */
 
-/* function: ftstat_rpt_14_accum
+/* function: ftstat_rpt_39_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_14_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_39_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_14, rpt14, ftchash_rec_c32, ftch_recc32,
-    ftch_recc32p);
-
-  FT_RECGET_NEXTHOP(cur,rec,*fo);
-
-  ftch_recc32.c32 = cur.nexthop;
-
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+  STD_DUMP_HASH2(ftstat_rpt_8, rpt8, chash_c162_dump,
+    (char*)0L, FT_PATH_SYM_ASN,
+    "", "input-interface", "source-as", "", "", "", "");
 
-  STD_ACCUM_HASH2(rpt14, ftch_recc32, ftch_recc32p);
+} /* ftstat_rpt_39_dump */
 
-  return 0;
-   
-} /* ftstat_rpt_14_accum */
 
-/* function: ftstat_rpt_14_calc
+/* function: ftstat_rpt_39_free
  *
- * Perform final calculations for rpt14
+ * Free data structures for report allocated by ftstat_rpt_39_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_14_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_39_free(struct ftstat_rpt_39 *rpt39)
 {
 
-  STD_CALC_HASH(ftstat_rpt_14, rpt14, ftchash_rec_c32, ftch_recc32);
+  STD_FREE_HASH(rpt39);
 
-} /* ftstat_rpt_14_calc */
+} /* ftstat_rpt_39_free */
 
-/* function: ftstat_rpt_14_dump
+
+/* function: ftstat_rpt_40_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 40.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_14_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_40 *ftstat_rpt_40_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_14, rpt14, chash_ip_dump,
-    "ip-next-hop-address", "", "", "", "", "", "");
+  STD_NEW_HASH(ftstat_rpt_40, rpt40, 65536, ftchash_rec_c162, 4, 65536);
 
-} /* ftstat_rpt_14_dump */
+} /* ftstat_rpt_40_new */
 
 
-/* function: ftstat_rpt_14_free
+/* function: ftstat_rpt_40_accum
  *
- * Free data structures for report allocated by ftstat_rpt_14_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_14_free(struct ftstat_rpt_14 *rpt14)
+int ftstat_rpt_40_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_FREE_HASH(rpt14);
+  STD_ACCUM_HASH1(ftstat_rpt_40, rpt40, ftchash_rec_c162,
+    ftch_recc162, ftch_recc162p);
 
-} /* ftstat_rpt_14_free */
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
+
+  ftch_recc162.c16a = cur.input;
+  ftch_recc162.c16b = cur.dst_as;
+  
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+    
+  STD_ACCUM_HASH2(rpt40, ftch_recc162, ftch_recc162p);
 
+  return 0;
+   
+} /* ftstat_rpt_40_accum */
 
-/* function: ftstat_rpt_15_new
+/* function: ftstat_rpt_40_calc
  *
- * Allocate and initialize data structures for rpt 15.
+ * Perform final calculations for rpt40
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_15 *ftstat_rpt_15_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_40_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_15, rpt15, 65536, ftchash_rec_prefix, 5, 65536);
-
-} /* ftstat_rpt_15_new */
+  STD_CALC_HASH(ftstat_rpt_40, rpt40, ftchash_rec_c162, ftch_recc162);
 
+} /* ftstat_rpt_40_calc */
 
-/* function: ftstat_rpt_15_accum
+/* function: ftstat_rpt_40_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt40
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_15_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_40_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_15, rpt15, ftchash_rec_prefix, ftch_recprefix,
-    ftch_recprefixp);
-
-  FT_RECGET_SRCADDR(cur,rec,*fo);
- 
-  ftch_recprefix.prefix = cur.srcaddr;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix.mask = cur.src_mask;
-  }
+  STD_MERGE_HASH(ftstat_rpt_40, ftchash_rec_c162);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+} /* ftstat_rpt_40_merge */
 
-  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefix.mask);
+/* function: ftstat_rpt_40_save
+ *
+ * Write the counters of rpt40 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_40_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  STD_ACCUM_HASH2(rpt15, ftch_recprefix, ftch_recprefixp);
+  STD_SAVE_HASH(ftstat_rpt_40, ftchash_rec_c162);
 
-  return 0;
-   
-} /* ftstat_rpt_15_accum */
+} /* ftstat_rpt_40_save */
 
-/* function: ftstat_rpt_15_calc
+/* function: ftstat_rpt_40_load
  *
- * Perform final calculations for rpt15
+ * Merge counters written by ftstat_rpt_40_save() into rpt40
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_15_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_40_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_15, rpt15, ftchash_rec_prefix, ftch_recprefix);
+  STD_LOAD_HASH(ftstat_rpt_40, ftchash_rec_c162);
 
-} /* ftstat_rpt_15_calc */
+} /* ftstat_rpt_40_load */
 
-/* function: ftstat_rpt_15_dump
+/* function: ftstat_rpt_40_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_15_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_40_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH0P(ftstat_rpt_15, rpt15, chash_prefix_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    "ip-source-address", "", "", "", "", "", "");
+  STD_DUMP_HASH2(ftstat_rpt_40, rpt40, chash_c162_dump,
+    (char*)0L, FT_PATH_SYM_ASN,
+    "", "input-interface", "destination-as", "", "", "", "");
 
-} /* ftstat_rpt_15_dump */
+} /* ftstat_rpt_40_dump */
 
 
-/* function: ftstat_rpt_15_free
+/* function: ftstat_rpt_40_free
  *
- * Free data structures for report allocated by ftstat_rpt_15_new
+ * Free data structures for report allocated by ftstat_rpt_40_new
  *
  */
-void ftstat_rpt_15_free(struct ftstat_rpt_15 *rpt15)
+void ftstat_rpt_40_free(struct ftstat_rpt_40 *rpt40)
 {
 
-  STD_FREE_HASH(rpt15);
+  STD_FREE_HASH(rpt40);
 
-} /* ftstat_rpt_15_free */
+} /* ftstat_rpt_40_free */
 
 
-/* function: ftstat_rpt_16_new
+/* function: ftstat_rpt_41_new
  *
- * Allocate and initialize data structures for rpt 16.
+ * Allocate and initialize data structures for rpt 41.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_16 *ftstat_rpt_16_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_41 *ftstat_rpt_41_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_16, rpt16, 65536, ftchash_rec_prefix, 5, 65536);
+  STD_NEW_HASH(ftstat_rpt_41, rpt41, 65536, ftchash_rec_c162, 4, 65536);
 
-} /* ftstat_rpt_16_new */
+} /* ftstat_rpt_41_new */
 
 
-/* function: ftstat_rpt_16_accum
+/* function: ftstat_rpt_41_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_16_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_41_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_16, rpt16, ftchash_rec_prefix, ftch_recprefix,
-    ftch_recprefixp);
-
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-
-  ftch_recprefix.prefix = cur.dstaddr;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix.mask = cur.dst_mask;
-  }
-
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+  STD_ACCUM_HASH1(ftstat_rpt_41, rpt41, ftchash_rec_c162,
+    ftch_recc162, ftch_recc162p);
 
-  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefix.mask);
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRC_AS(cur,rec,*fo);
 
-  STD_ACCUM_HASH2(rpt16, ftch_recprefix, ftch_recprefixp);
+  ftch_recc162.c16a = cur.output;
+  ftch_recc162.c16b = cur.src_as;
+  
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
 
+  STD_ACCUM_HASH2(rpt41, ftch_recc162, ftch_recc162p);
+   
   return 0;
    
-} /* ftstat_rpt_16_accum */
+} /* ftstat_rpt_41_accum */
 
-/* function: ftstat_rpt_16_calc
+/* function: ftstat_rpt_41_calc
  *
- * Perform final calculations for rpt16
+ * Perform final calculations for rpt41
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_16_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_41_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_16, rpt16, ftchash_rec_prefix, ftch_recprefix);
+  STD_CALC_HASH(ftstat_rpt_41, rpt41, ftchash_rec_c162, ftch_recc162);
 
-} /* ftstat_rpt_16_calc */
+} /* ftstat_rpt_41_calc */
 
-/* function: ftstat_rpt_16_dump
+/* function: ftstat_rpt_41_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt41
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_16_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_41_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH0P(ftstat_rpt_16, rpt16, chash_prefix_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    "ip-destination-address", "", "", "", "", "", "");
-
-} /* ftstat_rpt_16_dump */
+  STD_MERGE_HASH(ftstat_rpt_41, ftchash_rec_c162);
 
+} /* ftstat_rpt_41_merge */
 
-/* function: ftstat_rpt_16_free
+/* function: ftstat_rpt_41_save
  *
- * Free data structures for report allocated by ftstat_rpt_16_new
+ * Write the counters of rpt41 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_16_free(struct ftstat_rpt_16 *rpt16)
+int ftstat_rpt_41_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt16);
-
-} /* ftstat_rpt_16_free */
+  STD_SAVE_HASH(ftstat_rpt_41, ftchash_rec_c162);
 
+} /* ftstat_rpt_41_save */
 
-/* function: ftstat_rpt_17_new
+/* function: ftstat_rpt_41_load
  *
- * Allocate and initialize data structures for rpt 17.
+ * Merge counters written by ftstat_rpt_41_save() into rpt41
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_17 *ftstat_rpt_17_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_41_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_HASH(ftstat_rpt_17, rpt17, 65536, ftchash_rec_prefix2, 16, 65536);
-
-} /* ftstat_rpt_17_new */
+  STD_LOAD_HASH(ftstat_rpt_41, ftchash_rec_c162);
 
+} /* ftstat_rpt_41_load */
 
-/* function: ftstat_rpt_17_accum
+/* function: ftstat_rpt_41_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_17_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_41_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_17, rpt17, ftchash_rec_prefix2, ftch_recprefix2,
-    ftch_recprefix2p);
-
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-
-  ftch_recprefix2.src_prefix = cur.srcaddr;
-  ftch_recprefix2.dst_prefix = cur.dstaddr;
+  STD_DUMP_HASH2(ftstat_rpt_41, rpt41, chash_c162_dump,
+    (char*)0L, FT_PATH_SYM_ASN,
+    "", "output-interface", "source-as", "", "", "", "");
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix2.src_mask = cur.src_mask;
-  }
+} /* ftstat_rpt_41_dump */
 
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix2.dst_mask = cur.dst_mask;
-  }
-  
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix2.src_prefix &= ipv4_len2mask(ftch_recprefix2.src_mask);
-  }
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix2.dst_prefix &= ipv4_len2mask(ftch_recprefix2.dst_mask);
-  }
+/* function: ftstat_rpt_41_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_41_new
+ *
+ */
+void ftstat_rpt_41_free(struct ftstat_rpt_41 *rpt41)
+{
 
-  hash = (ftch_recprefix2.src_prefix>>16)^
-          (ftch_recprefix2.src_prefix & 0xFFFF)^
-          (ftch_recprefix2.dst_prefix>>16)^
-          (ftch_recprefix2.dst_prefix & 0xFFFF)^
-          (ftch_recprefix2.src_mask)^
-          (uint32_t)(ftch_recprefix2.dst_mask<<8);
+  STD_FREE_HASH(rpt41);
 
-  STD_ACCUM_HASH2(rpt17, ftch_recprefix2, ftch_recprefix2p);
+} /* ftstat_rpt_41_free */
 
-  return 0;
-   
-} /* ftstat_rpt_17_accum */
 
-/* function: ftstat_rpt_17_calc
+/* function: ftstat_rpt_42_new
  *
- * Perform final calculations for rpt17
+ * Allocate and initialize data structures for rpt 42.
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_17_calc(struct ftstat_rpt *rpt)
+struct ftstat_rpt_42 *ftstat_rpt_42_new(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_17, rpt17, ftchash_rec_prefix2, ftch_recprefix2);
+  STD_NEW_HASH(ftstat_rpt_42, rpt42, 65536, ftchash_rec_c162, 4, 65536);
 
-} /* ftstat_rpt_17_calc */
+} /* ftstat_rpt_42_new */
 
-/* function: ftstat_rpt_17_dump
+
+/* function: ftstat_rpt_42_accum
  *
- * Dump data for report.
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_17_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_42_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_17, rpt17, chash_prefix2_dump,
-    "", "ip-source-address", "ip-destination-address", "", "", "", "");
+  STD_ACCUM_HASH1(ftstat_rpt_42, rpt42, ftchash_rec_c162,
+    ftch_recc162, ftch_recc162p);
 
-} /* ftstat_rpt_17_dump */
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
+
+  ftch_recc162.c16a = cur.output;
+  ftch_recc162.c16b = cur.dst_as;
+  
+  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
+    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
 
+  STD_ACCUM_HASH2(rpt42, ftch_recc162, ftch_recc162p);
+   
+  return 0;
+   
+} /* ftstat_rpt_42_accum */
 
-/* function: ftstat_rpt_17_free
+/* function: ftstat_rpt_42_calc
  *
- * Free data structures for report allocated by ftstat_rpt_17_new
+ * Perform final calculations for rpt42
  *
+ * returns allocated struct or 0L for error
  */
-void ftstat_rpt_17_free(struct ftstat_rpt_17 *rpt17)
+int ftstat_rpt_42_calc(struct ftstat_rpt *rpt)
 {
-} /* ftstat_rpt_17_free */
+    
+  STD_CALC_HASH(ftstat_rpt_42, rpt42, ftchash_rec_c162, ftch_recc162);
 
+} /* ftstat_rpt_42_calc */
 
-/* function: ftstat_rpt_18_new
+/* function: ftstat_rpt_42_merge
  *
- * Allocate and initialize data structures for rpt 18.
+ * Merge the counters accumulated by src into rpt42
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_18 *ftstat_rpt_18_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_42_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_HASH(ftstat_rpt_18, rpt18, 65536, ftchash_rec_c32, 4, 65536);
-
-} /* ftstat_rpt_18_new */
+  STD_MERGE_HASH(ftstat_rpt_42, ftchash_rec_c162);
 
+} /* ftstat_rpt_42_merge */
 
-/* function: ftstat_rpt_18_accum
+/* function: ftstat_rpt_42_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt42 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_18_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_42_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_18, rpt18, ftchash_rec_c32, ftch_recc32,
-    ftch_recc32p);
-
-  FT_RECGET_EXADDR(cur,rec,*fo);
-
-  ftch_recc32.c32 = cur.exaddr;
-  
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+  STD_SAVE_HASH(ftstat_rpt_42, ftchash_rec_c162);
 
-  STD_ACCUM_HASH2(rpt18, ftch_recc32, ftch_recc32p);
-  
-  return 0;
-   
-} /* ftstat_rpt_18_accum */
+} /* ftstat_rpt_42_save */
 
-/* function: ftstat_rpt_18_calc
+/* function: ftstat_rpt_42_load
  *
- * Perform final calculations for rpt18
+ * Merge counters written by ftstat_rpt_42_save() into rpt42
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_18_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_42_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_18, rpt18, ftchash_rec_c32, ftch_recc32);
+  STD_LOAD_HASH(ftstat_rpt_42, ftchash_rec_c162);
 
-} /* ftstat_rpt_18_calc */
+} /* ftstat_rpt_42_load */
 
-/* function: ftstat_rpt_18_dump
+/* function: ftstat_rpt_42_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_18_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_42_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH0(ftstat_rpt_18, rpt18, chash_ip_dump,
-    "ip-exporter-address", "", "", "", "", "", "");
+  
+  STD_DUMP_HASH2(ftstat_rpt_42, rpt42, chash_c162_dump,
+    (char*)0L, FT_PATH_SYM_ASN,
+    "", "output-interface", "destination-as", "", "", "", "");
+ 
 
-} /* ftstat_rpt_18_dump */
+} /* ftstat_rpt_42_dump */
 
 
-/* function: ftstat_rpt_18_free
+/* function: ftstat_rpt_42_free
  *
- * Free data structures for report allocated by ftstat_rpt_18_new
+ * Free data structures for report allocated by ftstat_rpt_42_new
  *
  */
-void ftstat_rpt_18_free(struct ftstat_rpt_18 *rpt18)
+void ftstat_rpt_42_free(struct ftstat_rpt_42 *rpt42)
 {
 
-  STD_FREE_HASH(rpt18);
+  STD_FREE_HASH(rpt42);
 
-} /* ftstat_rpt_18_free */
+} /* ftstat_rpt_42_free */
 
 
-/* function: ftstat_rpt_19_new
+/* function: ftstat_rpt_43_new
  *
- * Allocate and initialize data structures for rpt 19.
+ * Allocate and initialize data structures for rpt 43.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_19 *ftstat_rpt_19_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_43 *ftstat_rpt_43_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_19, rpt19, 65536, rpt);
+  STD_NEW_HASH(ftstat_rpt_43, rpt43, 65536, ftchash_rec_c163, 6, 65536);
 
-} /* ftstat_rpt_19_new */
+} /* ftstat_rpt_43_new */
 
 
-/* function: ftstat_rpt_19_accum
+/* function: ftstat_rpt_43_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_19_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_43_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_19, rpt19);
+  STD_ACCUM_HASH1(ftstat_rpt_43, rpt43, ftchash_rec_c163,
+    ftch_recc163, ftch_recc163p);
 
   FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
 
-  STD_ACCUM_BUCKET2(rpt19->bucket, cur.input);
+  ftch_recc163.c16a = cur.input;
+  ftch_recc163.c16b = cur.src_as;
+  ftch_recc163.c16c = cur.dst_as;
+  
+  hash = ftch_recc163.c16a ^ ftch_recc163.c16b ^ ftch_recc163.c16c;
+   
+  STD_ACCUM_HASH2(rpt43, ftch_recc163, ftch_recc163p);
 
   return 0;
+   
+} /* ftstat_rpt_43_accum */
 
-} /* ftstat_rpt_19_accum */
-
-/* function: ftstat_rpt_19_calc
+/* function: ftstat_rpt_43_calc
  *
- * Perform final calculations for rpt19
+ * Perform final calculations for rpt43
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_19_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_43_calc(struct ftstat_rpt *rpt)
 {
+  
+  STD_CALC_HASH(ftstat_rpt_43, rpt43, ftchash_rec_c163, ftch_recc163);
 
-  STD_CALC_BUCKET(ftstat_rpt_19, rpt19, 65536);
-
-} /* ftstat_rpt_19_calc */
+} /* ftstat_rpt_43_calc */
 
-/* function: ftstat_rpt_19_dump
+/* function: ftstat_rpt_43_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt43
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_19_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_43_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_19, rpt19, 65536, (char*)0L,
-    "input-interface", "", "", "", "", "", "");
-
-} /* ftstat_rpt_19_dump */
+  STD_MERGE_HASH(ftstat_rpt_43, ftchash_rec_c163);
 
+} /* ftstat_rpt_43_merge */
 
-/* function: ftstat_rpt_19_free
+/* function: ftstat_rpt_43_save
  *
- * Free data structures for report allocated by ftstat_rpt_19_new
+ * Write the counters of rpt43 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_19_free(struct ftstat_rpt_19 *rpt19)
+int ftstat_rpt_43_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_BUCKET(rpt19);
-
-} /* ftstat_rpt_19_free */
+  STD_SAVE_HASH(ftstat_rpt_43, ftchash_rec_c163);
 
+} /* ftstat_rpt_43_save */
 
-/* function: ftstat_rpt_20_new
+/* function: ftstat_rpt_43_load
  *
- * Allocate and initialize data structures for rpt 20.
+ * Merge counters written by ftstat_rpt_43_save() into rpt43
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_20 *ftstat_rpt_20_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_43_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_20, rpt20, 65536, rpt);
-
-} /* ftstat_rpt_20_new */
+  STD_LOAD_HASH(ftstat_rpt_43, ftchash_rec_c163);
 
+} /* ftstat_rpt_43_load */
 
-/* function: ftstat_rpt_20_accum
+/* function: ftstat_rpt_43_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_20_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_43_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_20, rpt20);
+  STD_DUMP_HASH3(ftstat_rpt_43, rpt43, chash_c163_dump,
+    (char*)0L, FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "input-interface", "source-as", "destination-as", "", "", "");
+  
+} /* ftstat_rpt_43_dump */
 
-  FT_RECGET_OUTPUT(cur,rec,*fo);
 
-  STD_ACCUM_BUCKET2(rpt20->bucket, cur.output);
+/* function: ftstat_rpt_43_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_43_new
+ *
+ */
+void ftstat_rpt_43_free(struct ftstat_rpt_43 *rpt43)
+{
 
-  return 0;
+  STD_FREE_HASH(rpt43);
 
-} /* ftstat_rpt_20_accum */
+} /* ftstat_rpt_43_free */
 
-/* function: ftstat_rpt_20_calc
+
+/* function: ftstat_rpt_44_new
  *
- * Perform final calculations for rpt20
+ * Allocate and initialize data structures for rpt 44.
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_20_calc(struct ftstat_rpt *rpt)
+struct ftstat_rpt_44 *ftstat_rpt_44_new(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_20, rpt20, 65536);
+  STD_NEW_HASH(ftstat_rpt_44, rpt44, 65536, ftchash_rec_c163, 6, 65536);
 
-} /* ftstat_rpt_20_calc */
+} /* ftstat_rpt_44_new */
 
-/* function: ftstat_rpt_20_dump
+
+/* function: ftstat_rpt_44_accum
  *
- * Dump data for report.
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_20_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_44_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_20, rpt20, 65536, (char*)0L,
-    "output-interface", "", "", "", "", "", "");
+  STD_ACCUM_HASH1(ftstat_rpt_44, rpt44, ftchash_rec_c163,
+    ftch_recc163, ftch_recc163p);
 
-} /* ftstat_rpt_20_dump */
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
+    
+  ftch_recc163.c16a = cur.output;
+  ftch_recc163.c16b = cur.src_as;
+  ftch_recc163.c16c = cur.dst_as;
+ 
+  hash = ftch_recc163.c16a ^ ftch_recc163.c16b ^ ftch_recc163.c16c;
 
+  STD_ACCUM_HASH2(rpt44, ftch_recc163, ftch_recc163p);
 
-/* function: ftstat_rpt_20_free
+  return 0;
+   
+} /* ftstat_rpt_44_accum */
+
+/* function: ftstat_rpt_44_calc
  *
- * Free data structures for report allocated by ftstat_rpt_20_new
+ * Perform final calculations for rpt44
  *
+ * returns allocated struct or 0L for error
  */
-void ftstat_rpt_20_free(struct ftstat_rpt_20 *rpt20)
+int ftstat_rpt_44_calc(struct ftstat_rpt *rpt)
 {
-} /* ftstat_rpt_20_free */
-
+  
+  STD_CALC_HASH(ftstat_rpt_44, rpt44, ftchash_rec_c163, ftch_recc163);
+  
+} /* ftstat_rpt_44_calc */
 
-/* function: ftstat_rpt_21_new
+/* function: ftstat_rpt_44_merge
  *
- * Allocate and initialize data structures for rpt 21.
+ * Merge the counters accumulated by src into rpt44
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_21 *ftstat_rpt_21_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_44_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_HASH(ftstat_rpt_21, rpt21, 65536, ftchash_rec_c162, 4, 65536);
-
-} /* ftstat_rpt_21_new */
+  STD_MERGE_HASH(ftstat_rpt_44, ftchash_rec_c163);
 
+} /* ftstat_rpt_44_merge */
 
-/* function: ftstat_rpt_21_accum
+/* function: ftstat_rpt_44_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt44 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_21_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_44_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_21, rpt21, ftchash_rec_c162, ftch_recc162,
-    ftch_recc162p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_OUTPUT(cur,rec,*fo);
-
-  ftch_recc162.c16a = cur.input;
-  ftch_recc162.c16b = cur.output;
-
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+  STD_SAVE_HASH(ftstat_rpt_44, ftchash_rec_c163);
 
-  STD_ACCUM_HASH2(rpt21, ftch_recc162, ftch_recc162p);
- 
-  return 0;
-   
-} /* ftstat_rpt_21_accum */
+} /* ftstat_rpt_44_save */
 
-/* function: ftstat_rpt_21_calc
+/* function: ftstat_rpt_44_load
  *
- * Perform final calculations for rpt21
+ * Merge counters written by ftstat_rpt_44_save() into rpt44
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_21_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_44_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_21, rpt21, ftchash_rec_c162, ftch_recc162);
+  STD_LOAD_HASH(ftstat_rpt_44, ftchash_rec_c163);
 
-} /* ftstat_rpt_21_calc */
+} /* ftstat_rpt_44_load */
 
-/* function: ftstat_rpt_21_dump
+/* function: ftstat_rpt_44_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_21_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_44_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_21, rpt21, chash_c162_dump,
-    (char*)0L, (char*)0L,
-    "", "input-interface", "output-interface", "", "", "", "");
-
-} /* ftstat_rpt_21_dump */
+  STD_DUMP_HASH3(ftstat_rpt_44, rpt44, chash_c163_dump,
+    (char*)0L, FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "output-interface", "source-as", "destination-as", "", "", "");
+ 
+} /* ftstat_rpt_44_dump */
 
 
-/* function: ftstat_rpt_21_free
+/* function: ftstat_rpt_44_free
  *
- * Free data structures for report allocated by ftstat_rpt_21_new
+ * Free data structures for report allocated by ftstat_rpt_44_new
  *
  */
-void ftstat_rpt_21_free(struct ftstat_rpt_21 *rpt21)
+void ftstat_rpt_44_free(struct ftstat_rpt_44 *rpt44)
 {
 
-  STD_FREE_HASH(rpt21);
+  STD_FREE_HASH(rpt44);
 
-} /* ftstat_rpt_21_free */
+} /* ftstat_rpt_44_free */
 
 
-/* function: ftstat_rpt_22_new
+/* function: ftstat_rpt_45_new
  *
- * Allocate and initialize data structures for rpt 22.
+ * Allocate and initialize data structures for rpt 45.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_22 *ftstat_rpt_22_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_45 *ftstat_rpt_45_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_22, rpt22, 65536, rpt);
+  STD_NEW_HASH(ftstat_rpt_45, rpt45, 65536, ftchash_rec_c164, 8, 65536);
 
-} /* ftstat_rpt_22_new */
+} /* ftstat_rpt_45_new */
 
 
-/* function: ftstat_rpt_22_accum
+/* function: ftstat_rpt_45_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_22_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_45_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_22, rpt22);
-  
+  STD_ACCUM_HASH1(ftstat_rpt_45, rpt45, ftchash_rec_c164,
+    ftch_recc164, ftch_recc164p);
+
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_OUTPUT(cur,rec,*fo);
   FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DST_AS(cur,rec,*fo);
+  
+  ftch_recc164.c16a = cur.input;
+  ftch_recc164.c16b = cur.output;
+  ftch_recc164.c16c = cur.src_as;
+  ftch_recc164.c16d = cur.dst_as;
+ 
+  hash = ftch_recc164.c16a ^ ftch_recc164.c16b ^ ftch_recc164.c16c ^
+         ftch_recc164.c16c;;
 
-  STD_ACCUM_BUCKET2(rpt22->bucket, cur.src_as);
+  STD_ACCUM_HASH2(rpt45, ftch_recc164, ftch_recc164p);
 
   return 0;
+   
+} /* ftstat_rpt_45_accum */
 
-} /* ftstat_rpt_22_accum */
-
-/* function: ftstat_rpt_22_calc
+/* function: ftstat_rpt_45_calc
  *
- * Perform final calculations for rpt22
+ * Perform final calculations for rpt45
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_22_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_45_calc(struct ftstat_rpt *rpt)
 {
+  
+  STD_CALC_HASH(ftstat_rpt_45, rpt45, ftchash_rec_c164, ftch_recc164);
 
-  STD_CALC_BUCKET(ftstat_rpt_22, rpt22, 65536);
-
-} /* ftstat_rpt_22_calc */
+} /* ftstat_rpt_45_calc */
 
-/* function: ftstat_rpt_22_dump
+/* function: ftstat_rpt_45_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt45
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_22_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_45_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_22, rpt22, 65536, FT_PATH_SYM_ASN,
-    "source-as", "", "", "", "", "", "");
-
-} /* ftstat_rpt_22_dump */
+  STD_MERGE_HASH(ftstat_rpt_45, ftchash_rec_c164);
 
+} /* ftstat_rpt_45_merge */
 
-/* function: ftstat_rpt_22_free
+/* function: ftstat_rpt_45_save
  *
- * Free data structures for report allocated by ftstat_rpt_22_new
+ * Write the counters of rpt45 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_22_free(struct ftstat_rpt_22 *rpt22)
+int ftstat_rpt_45_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_BUCKET(rpt22);
-
-} /* ftstat_rpt_22_free */
+  STD_SAVE_HASH(ftstat_rpt_45, ftchash_rec_c164);
 
+} /* ftstat_rpt_45_save */
 
-/* function: ftstat_rpt_23_new
+/* function: ftstat_rpt_45_load
  *
- * Allocate and initialize data structures for rpt 23.
+ * Merge counters written by ftstat_rpt_45_save() into rpt45
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_23 *ftstat_rpt_23_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_45_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_23, rpt23, 65536, rpt);
-
-} /* ftstat_rpt_23_new */
+  STD_LOAD_HASH(ftstat_rpt_45, ftchash_rec_c164);
 
+} /* ftstat_rpt_45_load */
 
-/* function: ftstat_rpt_23_accum
+/* function: ftstat_rpt_45_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_23_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_45_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_23, rpt23);
-  
-  FT_RECGET_DST_AS(cur,rec,*fo);
-
-  STD_ACCUM_BUCKET2(rpt23->bucket, cur.dst_as);
+  STD_DUMP_HASH4(ftstat_rpt_45, rpt45, chash_c164_dump,
+    (char*)0L, (char*)0L, FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "input-interface", "output-interface", "source-as", "destination-as",
+    "", "");
 
-  return 0;
+} /* ftstat_rpt_45_dump */
 
-} /* ftstat_rpt_23_accum */
 
-/* function: ftstat_rpt_23_calc
+/* function: ftstat_rpt_45_free
  *
- * Perform final calculations for rpt23
+ * Free data structures for report allocated by ftstat_rpt_45_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_23_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_45_free(struct ftstat_rpt_45 *rpt45)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_23, rpt23, 65536);
+  STD_FREE_HASH(rpt45);
 
-} /* ftstat_rpt_23_calc */
+} /* ftstat_rpt_45_free */
 
-/* function: ftstat_rpt_23_dump
+
+/* function: ftstat_rpt_46_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 46.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_23_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_46 *ftstat_rpt_46_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_23, rpt23, 65536, FT_PATH_SYM_ASN,
-    "destination-as", "", "", "", "", "", "");
- 
-} /* ftstat_rpt_23_dump */
+  STD_NEW_BUCKET(ftstat_rpt_46, rpt46, 256, rpt);
+
+} /* ftstat_rpt_46_new */
 
 
-/* function: ftstat_rpt_23_free
+/* function: ftstat_rpt_46_accum
  *
- * Free data structures for report allocated by ftstat_rpt_23_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_23_free(struct ftstat_rpt_23 *rpt23)
+int ftstat_rpt_46_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_FREE_BUCKET(rpt23);
+  STD_ACCUM_BUCKET1(ftstat_rpt_46, rpt46);
+  
+  FT_RECGET_ENGINE_ID(cur,rec,*fo);
 
-} /* ftstat_rpt_23_free */
+  STD_ACCUM_BUCKET2(rpt46->bucket, cur.engine_id);
 
+  return 0;
 
-/* function: ftstat_rpt_24_new
+} /* ftstat_rpt_46_accum */
+
+/* function: ftstat_rpt_46_calc
  *
- * Allocate and initialize data structures for rpt 24.
+ * Perform final calculations for rpt46
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_24 *ftstat_rpt_24_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_46_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_24, rpt24, 65536, ftchash_rec_c162, 4, 65536);
-
-} /* ftstat_rpt_24_new */
+  STD_CALC_BUCKET(ftstat_rpt_46, rpt46, 256);
 
+} /* ftstat_rpt_46_calc */
 
-/* function: ftstat_rpt_24_accum
+/* function: ftstat_rpt_46_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt46
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_24_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_46_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_24, rpt24, ftchash_rec_c162, ftch_recc162,
-    ftch_recc162p);
-
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
+  STD_MERGE_BUCKET(ftstat_rpt_46, 256);
 
-  ftch_recc162.c16a = cur.src_as;
-  ftch_recc162.c16b = cur.dst_as;
+} /* ftstat_rpt_46_merge */
 
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+/* function: ftstat_rpt_46_save
+ *
+ * Write the counters of rpt46 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_46_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  STD_ACCUM_HASH2(rpt24, ftch_recc162, ftch_recc162p);
+  STD_SAVE_BUCKET(ftstat_rpt_46, 256);
 
-  return 0;
-   
-} /* ftstat_rpt_24_accum */
+} /* ftstat_rpt_46_save */
 
-/* function: ftstat_rpt_24_calc
+/* function: ftstat_rpt_46_load
  *
- * Perform final calculations for rpt24
+ * Merge counters written by ftstat_rpt_46_save() into rpt46
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_24_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_46_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_24, rpt24, ftchash_rec_c162, ftch_recc162);
+  STD_LOAD_BUCKET(ftstat_rpt_46, 256);
 
-} /* ftstat_rpt_24_calc */
+} /* ftstat_rpt_46_load */
 
-/* function: ftstat_rpt_24_dump
+/* function: ftstat_rpt_46_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_24_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_46_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_24, rpt24, chash_c162_dump,
-    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "source-as", "destination-AS", "", "", "", "");
+  STD_DUMP_BUCKET(ftstat_rpt_46, rpt46, 256, (char*)0L,
+    "engine-id", "", "", "", "", "", "");
 
-} /* ftstat_rpt_24_dump */
+} /* ftstat_rpt_46_dump */
 
 
-/* function: ftstat_rpt_24_free
+/* function: ftstat_rpt_46_free
  *
- * Free data structures for report allocated by ftstat_rpt_24_new
+ * Free data structures for report allocated by ftstat_rpt_46_new
  *
  */
-void ftstat_rpt_24_free(struct ftstat_rpt_24 *rpt24)
+void ftstat_rpt_46_free(struct ftstat_rpt_46 *rpt46)
 {
 
-  STD_FREE_HASH(rpt24);
+  STD_FREE_BUCKET(rpt46);
 
-} /* ftstat_rpt_24_free */
+} /* ftstat_rpt_46_free */
 
 
-/* function: ftstat_rpt_25_new
+/* function: ftstat_rpt_47_new
  *
- * Allocate and initialize data structures for rpt 25.
+ * Allocate and initialize data structures for rpt 47.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_25 *ftstat_rpt_25_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_47 *ftstat_rpt_47_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_25, rpt25, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_NEW_BUCKET(ftstat_rpt_47, rpt47, 256, rpt);
 
-} /* ftstat_rpt_25_new */
+} /* ftstat_rpt_47_new */
 
 
-/* function: ftstat_rpt_25_accum
+/* function: ftstat_rpt_47_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_25_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_47_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_25, rpt25, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_prefix16p);
+  STD_ACCUM_BUCKET1(ftstat_rpt_47, rpt47);
+   
+  FT_RECGET_ENGINE_TYPE(cur,rec,*fo);
 
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
+  STD_ACCUM_BUCKET2(rpt47->bucket, cur.engine_type);
 
-  ftch_recprefix16.prefix = cur.srcaddr;
-  ftch_recprefix16.c16 = cur.src_as;
+  return 0;
+
+} /* ftstat_rpt_47_accum */
+
+/* function: ftstat_rpt_47_calc
+ *
+ * Perform final calculations for rpt47
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_47_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_BUCKET(ftstat_rpt_47, rpt47, 256);
+
+} /* ftstat_rpt_47_calc */
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.src_mask;
-  }
+/* function: ftstat_rpt_47_merge
+ *
+ * Merge the counters accumulated by src into rpt47
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_47_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  STD_MERGE_BUCKET(ftstat_rpt_47, 256);
 
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+} /* ftstat_rpt_47_merge */
 
-  STD_ACCUM_HASH2(rpt25, ftch_recprefix16, ftch_prefix16p);
+/* function: ftstat_rpt_47_save
+ *
+ * Write the counters of rpt47 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_47_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  return 0;
-   
-} /* ftstat_rpt_25_accum */
+  STD_SAVE_BUCKET(ftstat_rpt_47, 256);
 
-/* function: ftstat_rpt_25_calc
+} /* ftstat_rpt_47_save */
+
+/* function: ftstat_rpt_47_load
  *
- * Perform final calculations for rpt25
+ * Merge counters written by ftstat_rpt_47_save() into rpt47
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_25_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_47_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_25, rpt25, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_LOAD_BUCKET(ftstat_rpt_47, 256);
 
-} /* ftstat_rpt_25_calc */
+} /* ftstat_rpt_47_load */
 
-/* function: ftstat_rpt_25_dump
+/* function: ftstat_rpt_47_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_25_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_47_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_25, rpt25, chash_prefix16_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_ASN,
-    "", "ip-source-address", "source-as", "", "", "", "");
+  STD_DUMP_BUCKET(ftstat_rpt_47, rpt47, 256, (char*)0L,
+    "engine-type", "", "", "", "", "", "");
 
-} /* ftstat_rpt_25_dump */
+} /* ftstat_rpt_47_dump */
 
 
-/* function: ftstat_rpt_25_free
+/* function: ftstat_rpt_47_free
  *
- * Free data structures for report allocated by ftstat_rpt_25_new
+ * Free data structures for report allocated by ftstat_rpt_47_new
  *
  */
-void ftstat_rpt_25_free(struct ftstat_rpt_25 *rpt25)
+void ftstat_rpt_47_free(struct ftstat_rpt_47 *rpt47)
 {
 
-  STD_FREE_HASH(rpt25);
+  STD_FREE_BUCKET(rpt47);
 
-} /* ftstat_rpt_25_free */
+} /* ftstat_rpt_47_free */
 
 
-/* function: ftstat_rpt_26_new
+/* function: ftstat_rpt_48_new
  *
- * Allocate and initialize data structures for rpt 26.
+ * Allocate and initialize data structures for rpt 48.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_26 *ftstat_rpt_26_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_48 *ftstat_rpt_48_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_26, rpt26, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_NEW_HASH(ftstat_rpt_48, rpt48, 65536, ftchash_rec_c32, 4, 65536);
 
-} /* ftstat_rpt_26_new */
+} /* ftstat_rpt_48_new */
 
 
-/* function: ftstat_rpt_26_accum
+/* function: ftstat_rpt_48_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_26_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_48_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_26, rpt26, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_recprefix16p);
-
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-
-  ftch_recprefix16.prefix = cur.dstaddr;
-  ftch_recprefix16.c16 = cur.src_as;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.dst_mask;
-  }
+  STD_ACCUM_HASH1(ftstat_rpt_48, rpt48, ftchash_rec_c32,
+    ftch_recc32, ftch_recc32p);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  FT_RECGET_SRC_TAG(cur,rec,*fo);
 
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+  ftch_recc32.c32 = cur.src_tag;
 
-  STD_ACCUM_HASH2(rpt26, ftch_recprefix16, ftch_recprefix16p);
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
 
+  STD_ACCUM_HASH2(rpt48, ftch_recc32, ftch_recc32p);
+  
   return 0;
    
-} /* ftstat_rpt_26_accum */
+} /* ftstat_rpt_48_accum */
 
-/* function: ftstat_rpt_26_calc
+/* function: ftstat_rpt_48_calc
  *
- * Perform final calculations for rpt26
+ * Perform final calculations for rpt48
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_26_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_48_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_26, rpt26, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_CALC_HASH(ftstat_rpt_48, rpt48, ftchash_rec_c32, ftch_recc32);
 
-} /* ftstat_rpt_26_calc */
+} /* ftstat_rpt_48_calc */
 
-/* function: ftstat_rpt_26_dump
+/* function: ftstat_rpt_48_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt48
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_26_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_48_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_26, rpt26, chash_prefix16_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_ASN,
-    "", "ip-source-address", "destination-as", "", "", "", "");
-
-} /* ftstat_rpt_26_dump */
+  STD_MERGE_HASH(ftstat_rpt_48, ftchash_rec_c32);
 
+} /* ftstat_rpt_48_merge */
 
-/* function: ftstat_rpt_26_free
+/* function: ftstat_rpt_48_save
  *
- * Free data structures for report allocated by ftstat_rpt_26_new
+ * Write the counters of rpt48 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_26_free(struct ftstat_rpt_26 *rpt26)
+int ftstat_rpt_48_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt26);
-
-} /* ftstat_rpt_26_free */
+  STD_SAVE_HASH(ftstat_rpt_48, ftchash_rec_c32);
 
+} /* ftstat_rpt_48_save */
 
-/* function: ftstat_rpt_27_new
+/* function: ftstat_rpt_48_load
  *
- * Allocate and initialize data structures for rpt 27.
+ * Merge counters written by ftstat_rpt_48_save() into rpt48
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_27 *ftstat_rpt_27_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_48_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_HASH(ftstat_rpt_27, rpt27, 65536, ftchash_rec_prefix16, 8, 65536);
-
-} /* ftstat_rpt_27_new */
+  STD_LOAD_HASH(ftstat_rpt_48, ftchash_rec_c32);
 
+} /* ftstat_rpt_48_load */
 
-/* function: ftstat_rpt_27_accum
+/* function: ftstat_rpt_48_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_27_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_48_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_26, rpt26, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_recprefix16p);
-
-  FT_RECGET_DST_AS(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
- 
-  ftch_recprefix16.prefix = cur.srcaddr;
-  ftch_recprefix16.c16 = cur.dst_as;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.src_mask;
-  }
-    
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
- 
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+  STD_DUMP_HASH1(ftstat_rpt_48, rpt48, chash_c32_dump, FT_PATH_SYM_TAG,
+    "source-tag", "", "", "", "", "", "");
 
-  STD_ACCUM_HASH2(rpt26, ftch_recprefix16, ftch_recprefix16p);
+} /* ftstat_rpt_48_dump */
 
-  return 0;
-   
-} /* ftstat_rpt_27_accum */
 
-/* function: ftstat_rpt_27_calc
+/* function: ftstat_rpt_48_free
  *
- * Perform final calculations for rpt27
+ * Free data structures for report allocated by ftstat_rpt_48_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_27_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_48_free(struct ftstat_rpt_48 *rpt48)
 {
 
-  STD_CALC_HASH(ftstat_rpt_27, rpt27, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_FREE_HASH(rpt48);
 
-} /* ftstat_rpt_27_calc */
+} /* ftstat_rpt_48_free */
 
-/* function: ftstat_rpt_27_dump
+
+/* function: ftstat_rpt_49_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 49.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_27_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_49 *ftstat_rpt_49_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_27, rpt27, chash_prefix16_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_ASN,
-    "", "ip-source-address", "destination-as", "", "", "", "");
-
+  STD_NEW_HASH(ftstat_rpt_49, rpt49, 65536, ftchash_rec_c32, 4, 65536);
 
-} /* ftstat_rpt_27_dump */
+} /* ftstat_rpt_49_new */
 
 
-/* function: ftstat_rpt_27_free
+/* function: ftstat_rpt_49_accum
  *
- * Free data structures for report allocated by ftstat_rpt_27_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_27_free(struct ftstat_rpt_27 *rpt27)
+int ftstat_rpt_49_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_FREE_HASH(rpt27);
+  STD_ACCUM_HASH1(ftstat_rpt_49, rpt49, ftchash_rec_c32,
+    ftch_recc32, ftch_recc32p);
 
-} /* ftstat_rpt_27_free */
+  FT_RECGET_DST_TAG(cur,rec,*fo);
 
+  ftch_recc32.c32 = cur.dst_tag;
+  
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
 
-/* function: ftstat_rpt_28_new
+  STD_ACCUM_HASH2(rpt49, ftch_recc32, ftch_recc32p);
+  
+  return 0;
+   
+} /* ftstat_rpt_49_accum */
+
+/* function: ftstat_rpt_49_calc
  *
- * Allocate and initialize data structures for rpt 28.
+ * Perform final calculations for rpt49
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_28 *ftstat_rpt_28_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_49_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_28, rpt28, 65536, ftchash_rec_prefix16, 8, 65536);
-
-} /* ftstat_rpt_28_new */
+  STD_CALC_HASH(ftstat_rpt_49, rpt49, ftchash_rec_c32, ftch_recc32);
 
+} /* ftstat_rpt_49_calc */
 
-/* function: ftstat_rpt_28_accum
+/* function: ftstat_rpt_49_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt49
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_28_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_49_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_28, rpt28, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_recprefix16p);
-
-  FT_RECGET_DST_AS(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  
-  ftch_recprefix16.prefix = cur.dstaddr;
-  ftch_recprefix16.c16 = cur.dst_as;
+  STD_MERGE_HASH(ftstat_rpt_49, ftchash_rec_c32);
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.dst_mask;
-  }
+} /* ftstat_rpt_49_merge */
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+/* function: ftstat_rpt_49_save
+ *
+ * Write the counters of rpt49 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_49_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+  STD_SAVE_HASH(ftstat_rpt_49, ftchash_rec_c32);
 
-  STD_ACCUM_HASH2(rpt28, ftch_recprefix16, ftch_recprefix16p);
-  
-  return 0;
-   
-} /* ftstat_rpt_28_accum */
+} /* ftstat_rpt_49_save */
 
-/* function: ftstat_rpt_28_calc
+/* function: ftstat_rpt_49_load
  *
- * Perform final calculations for rpt28
+ * Merge counters written by ftstat_rpt_49_save() into rpt49
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_28_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_49_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_28, rpt28, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_LOAD_HASH(ftstat_rpt_49, ftchash_rec_c32);
 
-} /* ftstat_rpt_28_calc */
+} /* ftstat_rpt_49_load */
 
-/* function: ftstat_rpt_28_dump
+/* function: ftstat_rpt_49_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_28_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_49_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_28, rpt28, chash_prefix16_dump,
-   FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-   FT_PATH_SYM_ASN,
-    "", "ip-destination-address", "source-as", "", "", "", "");
+  STD_DUMP_HASH1(ftstat_rpt_49, rpt49, chash_c32_dump, FT_PATH_SYM_TAG,
+    "destination-tag", "", "", "", "", "", "");
 
-} /* ftstat_rpt_28_dump */
+} /* ftstat_rpt_49_dump */
 
 
-/* function: ftstat_rpt_28_free
+/* function: ftstat_rpt_49_free
  *
- * Free data structures for report allocated by ftstat_rpt_28_new
+ * Free data structures for report allocated by ftstat_rpt_49_new
  *
  */
-void ftstat_rpt_28_free(struct ftstat_rpt_28 *rpt28)
+void ftstat_rpt_49_free(struct ftstat_rpt_49 *rpt49)
 {
 
-  STD_FREE_HASH(rpt28);
+  STD_FREE_HASH(rpt49);
 
-} /* ftstat_rpt_28_free */
+} /* ftstat_rpt_49_free */
 
 
-/* function: ftstat_rpt_29_new
+/* function: ftstat_rpt_50_new
  *
- * Allocate and initialize data structures for rpt 29.
+ * Allocate and initialize data structures for rpt 50.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_29 *ftstat_rpt_29_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_50 *ftstat_rpt_50_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_29, rpt29, 65536, ftchash_rec_prefix216, 13, 65536);
+  STD_NEW_HASH(ftstat_rpt_50, rpt50, 65536, ftchash_rec_c322, 8, 65536);
 
-} /* ftstat_rpt_29_new */
+} /* ftstat_rpt_50_new */
 
 
-/* function: ftstat_rpt_29_accum
+/* function: ftstat_rpt_50_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_29_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_50_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_29, rpt29, ftchash_rec_prefix216,
-    ftch_recprefix216, ftch_recprefix216p);
-
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  
-  ftch_recprefix216.src_prefix = cur.srcaddr;
-  ftch_recprefix216.dst_prefix = cur.dstaddr;
-  ftch_recprefix216.c16 = cur.src_as;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix216.src_mask = cur.src_mask;
-  }
+  STD_ACCUM_HASH1(ftstat_rpt_50, rpt50, ftchash_rec_c322,
+    ftch_recc322, ftch_recc322p);
 
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix216.dst_mask = cur.dst_mask;
-  }
+  FT_RECGET_DST_TAG(cur,rec,*fo);
+  FT_RECGET_SRC_TAG(cur,rec,*fo);
  
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
-  }
+  ftch_recc322.c32a = cur.src_tag;
+  ftch_recc322.c32b = cur.dst_tag;
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
-  }
- 
-  hash = (ftch_recprefix216.src_prefix>>16)^
-          (ftch_recprefix216.src_prefix & 0xFFFF)^
-          (ftch_recprefix216.dst_prefix>>16)^
-          (ftch_recprefix216.dst_prefix & 0xFFFF)^
-          (ftch_recprefix216.c16)^
-          (ftch_recprefix216.src_mask)^
-          (uint32_t)(ftch_recprefix216.dst_mask<<8);
+  hash = (ftch_recc322.c32a>>16) ^ (ftch_recc322.c32a & 0xFFFF) ^
+    (ftch_recc322.c32b>>16) ^ (ftch_recc322.c32b & 0xFFFF);
+
+  STD_ACCUM_HASH2(rpt50, ftch_recc322, ftch_recc322p);
 
-  STD_ACCUM_HASH2(rpt29, ftch_recprefix216, ftch_recprefix216p);
-  
   return 0;
    
-} /* ftstat_rpt_29_accum */
+} /* ftstat_rpt_50_accum */
 
-/* function: ftstat_rpt_29_calc
+/* function: ftstat_rpt_50_calc
  *
- * Perform final calculations for rpt29
+ * Perform final calculations for rpt50
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_29_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_50_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_29, rpt29, ftchash_rec_prefix216, ftch_recprefix216);
+  STD_CALC_HASH(ftstat_rpt_50, rpt50, ftchash_rec_c322, ftch_recc322);
 
-} /* ftstat_rpt_29_calc */
+} /* ftstat_rpt_50_calc */
 
-/* function: ftstat_rpt_29_dump
+/* function: ftstat_rpt_50_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt50
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_29_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_50_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_29, rpt29, chash_prefix216_dump, FT_PATH_SYM_ASN,
-    "", "ip-source-address", "ip-destination-address", "source-as", "", "", "");
+  STD_MERGE_HASH(ftstat_rpt_50, ftchash_rec_c322);
 
-} /* ftstat_rpt_29_dump */
+} /* ftstat_rpt_50_merge */
+
+/* function: ftstat_rpt_50_save
+ *
+ * Write the counters of rpt50 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_50_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_SAVE_HASH(ftstat_rpt_50, ftchash_rec_c322);
 
-/* function: ftstat_rpt_29_free
+} /* ftstat_rpt_50_save */
+
+/* function: ftstat_rpt_50_load
  *
- * Free data structures for report allocated by ftstat_rpt_29_new
+ * Merge counters written by ftstat_rpt_50_save() into rpt50
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_29_free(struct ftstat_rpt_29 *rpt29)
+int ftstat_rpt_50_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt29);
+  STD_LOAD_HASH(ftstat_rpt_50, ftchash_rec_c322);
 
-} /* ftstat_rpt_29_free */
+} /* ftstat_rpt_50_load */
+
+/* function: ftstat_rpt_50_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_50_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
+  STD_DUMP_HASH2(ftstat_rpt_50, rpt50, chash_c322_dump,
+    FT_PATH_SYM_TAG, FT_PATH_SYM_TAG,
+    "", "source-tag", "destination-tag", "", "", "", "");
 
-/* function: ftstat_rpt_30_new
+} /* ftstat_rpt_50_dump */
+
+
+/* function: ftstat_rpt_50_free
  *
- * Allocate and initialize data structures for rpt 30.
+ * Free data structures for report allocated by ftstat_rpt_50_new
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_30 *ftstat_rpt_30_new(struct ftstat_rpt *rpt)
+void ftstat_rpt_50_free(struct ftstat_rpt_50 *rpt50)
 {
 
-  STD_NEW_HASH(ftstat_rpt_30, rpt30, 65536, ftchash_rec_prefix216, 13, 65536);
+  STD_FREE_HASH(rpt50);
 
-} /* ftstat_rpt_30_new */
+} /* ftstat_rpt_50_free */
 
+/* function: ftstat_rpt_51_new
+ * 
+ * Allocate and initialize data structures for rpt 51.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_51 *ftstat_rpt_51_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_51, rpt51, 65536, ftchash_rec_prefix16, 8, 65536);
 
-/* function: ftstat_rpt_30_accum
+} /* ftstat_rpt_51_new */
+
+/* function: ftstat_rpt_51_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_30_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_51_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_30, rpt30, ftchash_rec_prefix216,
-    ftch_recprefix216, ftch_recprefix216p);
+  STD_ACCUM_HASH1(ftstat_rpt_51, rpt51, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_prefix16p);
 
-  FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_SRCPORT(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-    
-  ftch_recprefix216.src_prefix = cur.srcaddr;
-  ftch_recprefix216.dst_prefix = cur.dstaddr;
-  ftch_recprefix216.c16 = cur.dst_as;
+
+  ftch_recprefix16.prefix = cur.srcaddr;
+  ftch_recprefix16.c16 = cur.srcport;
 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix216.src_mask = cur.src_mask;
-  }
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix216.dst_mask = cur.dst_mask;
+    ftch_recprefix16.mask = cur.src_mask;
   }
  
-  /* remove host bits */  
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
-  }
-
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
-  }
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
   
-  hash = (ftch_recprefix216.src_prefix>>16)^
-          (ftch_recprefix216.src_prefix & 0xFFFF)^
-          (ftch_recprefix216.dst_prefix>>16)^
-          (ftch_recprefix216.dst_prefix & 0xFFFF)^
-          (ftch_recprefix216.c16)^
-          (ftch_recprefix216.src_mask)^
-          (uint32_t)(ftch_recprefix216.dst_mask<<8);
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
-  STD_ACCUM_HASH2(rpt30, ftch_recprefix216, ftch_recprefix216p);
-  
+  STD_ACCUM_HASH2(rpt51, ftch_recprefix16, ftch_prefix16p);
+   
   return 0;
    
-} /* ftstat_rpt_30_accum */
+} /* ftstat_rpt_51_accum */
 
-/* function: ftstat_rpt_30_calc
+/* function: ftstat_rpt_51_calc
  *
- * Perform final calculations for rpt30
+ * Perform final calculations for rpt51
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_30_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_51_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_30, rpt30, ftchash_rec_prefix216, ftch_recprefix216);
-
-} /* ftstat_rpt_30_calc */
+  STD_CALC_HASH(ftstat_rpt_51, rpt51, ftchash_rec_prefix16, ftch_recprefix16); 
+ 
+} /* ftstat_rpt_51_calc */
 
-/* function: ftstat_rpt_30_dump
+/* function: ftstat_rpt_51_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt51
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_30_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_51_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_30, rpt30, chash_prefix216_dump, FT_PATH_SYM_ASN,
-    "", "ip-source-address", "ip-destination-address", "destination-as", "",
-    "", "");
+  STD_MERGE_HASH(ftstat_rpt_51, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_51_merge */
+
+/* function: ftstat_rpt_51_save
+ *
+ * Write the counters of rpt51 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_51_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-} /* ftstat_rpt_30_dump */
+  STD_SAVE_HASH(ftstat_rpt_51, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_51_save */
 
-/* function: ftstat_rpt_30_free
+/* function: ftstat_rpt_51_load
  *
- * Free data structures for report allocated by ftstat_rpt_30_new
+ * Merge counters written by ftstat_rpt_51_save() into rpt51
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_30_free(struct ftstat_rpt_30 *rpt30)
+int ftstat_rpt_51_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt30);
-
-} /* ftstat_rpt_30_free */
+  STD_LOAD_HASH(ftstat_rpt_51, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_51_load */
 
-/* function: ftstat_rpt_31_new
+/* function: ftstat_rpt_51_dump
  *
- * Allocate and initialize data structures for rpt 31.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_31 *ftstat_rpt_31_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_51_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_31, rpt31, 65536, ftchash_rec_prefix2162, 16, 65536);
+  STD_DUMP_HASH1P(ftstat_rpt_51, rpt51, chash_prefix16_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-address", "ip-source-port", "", "", "", "");
+ 
+} /* ftstat_rpt_51_dump */
 
-} /* ftstat_rpt_31_new */
+/* function: ftstat_rpt_51_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_51_new
+ *
+ */
+void ftstat_rpt_51_free(struct ftstat_rpt_51 *rpt51)
+{ 
+ 
+  STD_FREE_HASH(rpt51);
+   
+} /* ftstat_rpt_51_free */
 
 
-/* function: ftstat_rpt_31_accum
+/* function: ftstat_rpt_52_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_52 *ftstat_rpt_52_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_52, rpt52, 65536, ftchash_rec_prefix16, 8, 65536);
+
+} /* ftstat_rpt_52_new */
+
+/* function: ftstat_rpt_52_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_31_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_52_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_31, rpt31, ftchash_rec_prefix2162,
-    ftch_recprefix2162, ftch_recprefix2162p);
-
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_52, rpt52, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_prefix16p);
     
-  ftch_recprefix2162.src_prefix = cur.srcaddr;
-  ftch_recprefix2162.dst_prefix = cur.dstaddr;
-  ftch_recprefix2162.c16a = cur.src_as;
-  ftch_recprefix2162.c16b = cur.dst_as;
- 
+  FT_RECGET_DSTPORT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  
+  ftch_recprefix16.prefix = cur.srcaddr;
+  ftch_recprefix16.c16 = cur.dstport;
+
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix2162.src_mask = cur.src_mask;
-  }
-
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix2162.dst_mask = cur.dst_mask;
+    ftch_recprefix16.mask = cur.src_mask;
   }
 
-  /* remove host bits */  
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix2162.src_prefix &= ipv4_len2mask(ftch_recprefix2162.src_mask);
-  }
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+    
+  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
+    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix2162.dst_prefix &= ipv4_len2mask(ftch_recprefix2162.dst_mask);
-  }
-  
-  hash = (ftch_recprefix2162.src_prefix>>16)^
-          (ftch_recprefix2162.src_prefix & 0xFFFF)^
-          (ftch_recprefix2162.dst_prefix>>16)^
-          (ftch_recprefix2162.dst_prefix & 0xFFFF)^
-          (ftch_recprefix2162.c16b)^
-          (ftch_recprefix2162.c16a)^
-          (ftch_recprefix2162.src_mask)^
-          (uint32_t)(ftch_recprefix2162.dst_mask<<8);
+  STD_ACCUM_HASH2(rpt52, ftch_recprefix16, ftch_prefix16p);
 
-  STD_ACCUM_HASH2(rpt31, ftch_recprefix2162, ftch_recprefix2162p);
-  
   return 0;
    
-} /* ftstat_rpt_31_accum */
+} /* ftstat_rpt_52_accum */
 
-/* function: ftstat_rpt_31_calc
+/* function: ftstat_rpt_52_calc
  *
- * Perform final calculations for rpt31
+ * Perform final calculations for rpt52
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_31_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_52_calc(struct ftstat_rpt *rpt)
 {
-  
-  STD_CALC_HASH(ftstat_rpt_31, rpt31, ftchash_rec_prefix2162,
-    ftch_recprefix2162);
 
-} /* ftstat_rpt_31_calc */
+  STD_CALC_HASH(ftstat_rpt_52, rpt52, ftchash_rec_prefix16, ftch_recprefix16);
+ 
+} /* ftstat_rpt_52_calc */
 
-/* function: ftstat_rpt_31_dump
+/* function: ftstat_rpt_52_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt52
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_31_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_52_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_31, rpt31, chash_prefix2162_dump,
-    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "ip-source-address", "ip-destination-address", "source-as",
-    "destination-as", "", "");
-
-} /* ftstat_rpt_31_dump */
+  STD_MERGE_HASH(ftstat_rpt_52, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_52_merge */
 
-/* function: ftstat_rpt_31_free
+/* function: ftstat_rpt_52_save
  *
- * Free data structures for report allocated by ftstat_rpt_31_new
+ * Write the counters of rpt52 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_31_free(struct ftstat_rpt_31 *rpt31)
+int ftstat_rpt_52_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt31);
+  STD_SAVE_HASH(ftstat_rpt_52, ftchash_rec_prefix16);
 
-} /* ftstat_rpt_31_free */
+} /* ftstat_rpt_52_save */
+
+/* function: ftstat_rpt_52_load
+ *
+ * Merge counters written by ftstat_rpt_52_save() into rpt52
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_52_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_LOAD_HASH(ftstat_rpt_52, ftchash_rec_prefix16);
 
-/* function: ftstat_rpt_32_new
+} /* ftstat_rpt_52_load */
+
+/* function: ftstat_rpt_52_dump
  *
- * Allocate and initialize data structures for rpt 32.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_32 *ftstat_rpt_32_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_52_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_32, rpt32, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_DUMP_HASH1P(ftstat_rpt_51, rpt51, chash_prefix16_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-address", "ip-destination-port", "", "", "", "");
 
-} /* ftstat_rpt_32_new */
+} /* ftstat_rpt_52_dump */
 
+/* function: ftstat_rpt_52_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_52_new
+ *
+ */
+void ftstat_rpt_52_free(struct ftstat_rpt_52 *rpt52)
+{ 
+ 
+  STD_FREE_HASH(rpt52);
+   
+} /* ftstat_rpt_52_free */
 
-/* function: ftstat_rpt_32_accum
+/* function: ftstat_rpt_53_new
+ * 
+ * Allocate and initialize data structures for rpt 53.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_53 *ftstat_rpt_53_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_53, rpt53, 65536, ftchash_rec_prefix16, 8, 65536);
+
+} /* ftstat_rpt_53_new */
+
+/* function: ftstat_rpt_53_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_32_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_53_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_32, rpt32, ftchash_rec_prefix16,
-    ftch_recprefix16, ftch_recprefix16p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_53, rpt53, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_prefix16p);
     
-  ftch_recprefix16.prefix = cur.srcaddr;
-  ftch_recprefix16.c16 = cur.input;
+  FT_RECGET_SRCPORT(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  
+  ftch_recprefix16.prefix = cur.dstaddr;
+  ftch_recprefix16.c16 = cur.srcport;
 
   /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.src_mask;
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix16.mask = cur.dst_mask;
   }
 
-  /* remove host bits */ 
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
     ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
-  
+
   hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
     (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
-  STD_ACCUM_HASH2(rpt32, ftch_recprefix16, ftch_recprefix16p);
-  
+  STD_ACCUM_HASH2(rpt53, ftch_recprefix16, ftch_prefix16p);
+
   return 0;
    
-} /* ftstat_rpt_32_accum */
+} /* ftstat_rpt_53_accum */
 
-/* function: ftstat_rpt_32_calc
+/* function: ftstat_rpt_53_calc
  *
- * Perform final calculations for rpt32
+ * Perform final calculations for rpt53
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_32_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_53_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_32, rpt32, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_CALC_HASH(ftstat_rpt_53, rpt53, ftchash_rec_prefix16, ftch_recprefix16);
 
-} /* ftstat_rpt_32_calc */
+} /* ftstat_rpt_53_calc */
 
-/* function: ftstat_rpt_32_dump
+/* function: ftstat_rpt_53_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt53
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_32_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_53_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_32, rpt32, chash_prefix16_dump,
-   FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-   (char*)0L,
-    "", "ip-source-address", "input-interface", "", "", "", "");
+  STD_MERGE_HASH(ftstat_rpt_53, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_53_merge */
+
+/* function: ftstat_rpt_53_save
+ *
+ * Write the counters of rpt53 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_53_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_53, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_53_save */
+
+/* function: ftstat_rpt_53_load
+ *
+ * Merge counters written by ftstat_rpt_53_save() into rpt53
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_53_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-} /* ftstat_rpt_32_dump */
+  STD_LOAD_HASH(ftstat_rpt_53, ftchash_rec_prefix16);
 
+} /* ftstat_rpt_53_load */
 
-/* function: ftstat_rpt_32_free
+/* function: ftstat_rpt_53_dump
  *
- * Free data structures for report allocated by ftstat_rpt_32_new
+ * Dump data for report.
  *
  */
-void ftstat_rpt_32_free(struct ftstat_rpt_32 *rpt32)
+int ftstat_rpt_53_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_FREE_HASH(rpt32);
-
-} /* ftstat_rpt_32_free */
+  STD_DUMP_HASH1P(ftstat_rpt_53, rpt53, chash_prefix16_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    FT_PATH_SYM_TCP_PORT,
+    "", "ip-destination-address", "ip-source-port", "", "", "", "");
 
+} /* ftstat_rpt_53_dump */
 
-/* function: ftstat_rpt_33_new
+/* function: ftstat_rpt_53_free
  *
- * Allocate and initialize data structures for rpt 33.
+ * Free data structures for report allocated by ftstat_rpt_53_new
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_33 *ftstat_rpt_33_new(struct ftstat_rpt *rpt)
-{
+void ftstat_rpt_53_free(struct ftstat_rpt_53 *rpt53)
+{ 
+ 
+  STD_FREE_HASH(rpt53);
+   
+} /* ftstat_rpt_53_free */
 
-  STD_NEW_HASH(ftstat_rpt_33, rpt33, 65536, ftchash_rec_prefix16, 8, 65536);
 
-} /* ftstat_rpt_33_new */
+/* function: ftstat_rpt_54_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_54 *ftstat_rpt_54_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_54, rpt54, 65536, ftchash_rec_prefix16, 8, 65536);
 
+} /* ftstat_rpt_54_new */
 
-/* function: ftstat_rpt_33_accum
+/* function: ftstat_rpt_54_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_33_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_54_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_33, rpt33, ftchash_rec_prefix16,
-    ftch_recprefix16, ftch_recprefix16p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_54, rpt54, ftchash_rec_prefix16, ftch_recprefix16,
+    ftch_prefix16p);
+    
+  FT_RECGET_DSTPORT(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
   
   ftch_recprefix16.prefix = cur.dstaddr;
-  ftch_recprefix16.c16 = cur.input;
+  ftch_recprefix16.c16 = cur.dstport;
 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
     FT_RECGET_DST_MASK(cur,rec,*fo);
     ftch_recprefix16.mask = cur.dst_mask;
   }
- 
+
   /* remove host bits */
   if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
     ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
-  
+
   hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
     (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
 
-  STD_ACCUM_HASH2(rpt33, ftch_recprefix16, ftch_recprefix16p);
-  
+  STD_ACCUM_HASH2(rpt54, ftch_recprefix16, ftch_prefix16p);
+
   return 0;
    
-} /* ftstat_rpt_33_accum */
+} /* ftstat_rpt_54_accum */
 
-/* function: ftstat_rpt_33_calc
+/* function: ftstat_rpt_54_calc
  *
- * Perform final calculations for rpt33
+ * Perform final calculations for rpt54
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_33_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_54_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_33, rpt33, ftchash_rec_prefix16, ftch_recprefix16);
-
-} /* ftstat_rpt_33_calc */
+  STD_CALC_HASH(ftstat_rpt_54, rpt54, ftchash_rec_prefix16, ftch_recprefix16);
+ 
+} /* ftstat_rpt_54_calc */
 
-/* function: ftstat_rpt_33_dump
+/* function: ftstat_rpt_54_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt54
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_33_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_54_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_33, rpt33, chash_prefix16_dump,
-   FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-   (char*)0L,
-    "", "ip-destination-address", "input-interface", "", "", "", "");
+  STD_MERGE_HASH(ftstat_rpt_54, ftchash_rec_prefix16);
 
-} /* ftstat_rpt_33_dump */
+} /* ftstat_rpt_54_merge */
 
+/* function: ftstat_rpt_54_save
+ *
+ * Write the counters of rpt54 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_54_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-/* function: ftstat_rpt_33_free
+  STD_SAVE_HASH(ftstat_rpt_54, ftchash_rec_prefix16);
+
+} /* ftstat_rpt_54_save */
+
+/* function: ftstat_rpt_54_load
  *
- * Free data structures for report allocated by ftstat_rpt_33_new
+ * Merge counters written by ftstat_rpt_54_save() into rpt54
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_33_free(struct ftstat_rpt_33 *rpt33)
+int ftstat_rpt_54_load(struct ftstat_rpt *rpt, FILE *fp)
 {
-} /* ftstat_rpt_33_free */
 
+  STD_LOAD_HASH(ftstat_rpt_54, ftchash_rec_prefix16);
 
-/* function: ftstat_rpt_34_new
+} /* ftstat_rpt_54_load */
+
+/* function: ftstat_rpt_54_dump
  *
- * Allocate and initialize data structures for rpt 34.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_34 *ftstat_rpt_34_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_54_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_34, rpt34, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_DUMP_HASH1P(ftstat_rpt_54, rpt54, chash_prefix16_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    FT_PATH_SYM_TCP_PORT,
+    "", "ip-destination-address", "ip-destination-port", "", "", "", "");
 
-} /* ftstat_rpt_34_new */
+} /* ftstat_rpt_54_dump */
+
+/* function: ftstat_rpt_54_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_54_new
+ *
+ */
+void ftstat_rpt_54_free(struct ftstat_rpt_54 *rpt54)
+{ 
+ 
+  STD_FREE_HASH(rpt54);
+   
+} /* ftstat_rpt_54_free */
 
 
-/* function: ftstat_rpt_34_accum
+/* function: ftstat_rpt_55_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_55 *ftstat_rpt_55_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_55, rpt55, 65536, ftchash_rec_prefix162, 10, 65536);
+
+} /* ftstat_rpt_55_new */
+
+/* function: ftstat_rpt_55_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_34_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_55_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_33, rpt33, ftchash_rec_prefix16,
-    ftch_recprefix16, ftch_recprefix16p);
-
-  FT_RECGET_OUTPUT(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_55, rpt55, ftchash_rec_prefix162,
+    ftch_recprefix162, ftch_prefix162p);
+    
+  FT_RECGET_SRCPORT(cur,rec,*fo);
+  FT_RECGET_DSTPORT(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
   
-  ftch_recprefix16.prefix = cur.srcaddr;
-  ftch_recprefix16.c16 = cur.output;
+  ftch_recprefix162.prefix = cur.srcaddr;
+  ftch_recprefix162.c16a = cur.srcport;
+  ftch_recprefix162.c16b = cur.dstport;
 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.src_mask;
+    ftch_recprefix162.mask = cur.src_mask;
   }
- 
+
   /* remove host bits */
   if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
-  
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+
+  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
+    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^ 
+    (ftch_recprefix162.c16b);
+
+  STD_ACCUM_HASH2(rpt55, ftch_recprefix162, ftch_prefix162p);
 
-  STD_ACCUM_HASH2(rpt33, ftch_recprefix16, ftch_recprefix16p);
-  
   return 0;
    
-} /* ftstat_rpt_34_accum */
+} /* ftstat_rpt_55_accum */
 
-/* function: ftstat_rpt_34_calc
+/* function: ftstat_rpt_55_calc
  *
- * Perform final calculations for rpt34
+ * Perform final calculations for rpt55
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_34_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_55_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_34, rpt34, ftchash_rec_prefix16, ftch_recprefix16);
-
-} /* ftstat_rpt_34_calc */
+  STD_CALC_HASH(ftstat_rpt_55, rpt55, ftchash_rec_prefix162,
+    ftch_recprefix162);
+ 
+} /* ftstat_rpt_55_calc */
 
-/* function: ftstat_rpt_34_dump
+/* function: ftstat_rpt_55_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt55
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_34_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_55_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_28, rpt28, chash_prefix16_dump,
-   FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-   (char*)0L,
-    "", "ip-source-address", "output-interface", "", "", "", "");
-
-} /* ftstat_rpt_34_dump */
+  STD_MERGE_HASH(ftstat_rpt_55, ftchash_rec_prefix162);
 
+} /* ftstat_rpt_55_merge */
 
-/* function: ftstat_rpt_34_free
+/* function: ftstat_rpt_55_save
  *
- * Free data structures for report allocated by ftstat_rpt_34_new
+ * Write the counters of rpt55 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_34_free(struct ftstat_rpt_34 *rpt34)
+int ftstat_rpt_55_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt34);
+  STD_SAVE_HASH(ftstat_rpt_55, ftchash_rec_prefix162);
 
-} /* ftstat_rpt_34_free */
+} /* ftstat_rpt_55_save */
+
+/* function: ftstat_rpt_55_load
+ *
+ * Merge counters written by ftstat_rpt_55_save() into rpt55
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_55_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_LOAD_HASH(ftstat_rpt_55, ftchash_rec_prefix162);
 
-/* function: ftstat_rpt_35_new
+} /* ftstat_rpt_55_load */
+
+/* function: ftstat_rpt_55_dump
  *
- * Allocate and initialize data structures for rpt 35.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_35 *ftstat_rpt_35_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_55_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_35, rpt35, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_DUMP_HASH2P(ftstat_rpt_55, rpt55, chash_prefix162_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-address", "ip-source-port", "ip-destination-port", "", "",
+    "");
+ 
+} /* ftstat_rpt_55_dump */
 
-} /* ftstat_rpt_35_new */
+/* function: ftstat_rpt_55_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_55_new
+ *
+ */
+void ftstat_rpt_55_free(struct ftstat_rpt_55 *rpt55)
+{ 
+ 
+  STD_FREE_HASH(rpt55);
+   
+} /* ftstat_rpt_55_free */
+
+
+/* function: ftstat_rpt_56_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_56 *ftstat_rpt_56_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_56, rpt56, 65536, ftchash_rec_prefix162, 10, 65536);
 
+} /* ftstat_rpt_56_new */
 
-/* function: ftstat_rpt_35_accum
+/* function: ftstat_rpt_56_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_35_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_56_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_35, rpt35, ftchash_rec_prefix16,
-    ftch_recprefix16, ftch_recprefix16p);
+  STD_ACCUM_HASH1(ftstat_rpt_56, rpt56, ftchash_rec_prefix162,
+    ftch_recprefix162, ftch_prefix162p);
 
-  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRCPORT(cur,rec,*fo);
+  FT_RECGET_DSTPORT(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
-  
-  ftch_recprefix16.prefix = cur.dstaddr;
-  ftch_recprefix16.c16 = cur.output;
+    
+  ftch_recprefix162.prefix = cur.dstaddr;
+  ftch_recprefix162.c16a = cur.srcport;
+  ftch_recprefix162.c16b = cur.dstport;
 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
     FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.dst_mask;
+    ftch_recprefix162.mask = cur.dst_mask; 
   }
- 
+
   /* remove host bits */
   if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+    
+  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
+    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
+    (ftch_recprefix162.c16b);   
   
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+  STD_ACCUM_HASH2(rpt56, ftch_recprefix162, ftch_prefix162p);
 
-  STD_ACCUM_HASH2(rpt35, ftch_recprefix16, ftch_recprefix16p);
-  
   return 0;
    
-} /* ftstat_rpt_35_accum */
+} /* ftstat_rpt_56_accum */
 
-/* function: ftstat_rpt_35_calc
+/* function: ftstat_rpt_56_calc
  *
- * Perform final calculations for rpt35
+ * Perform final calculations for rpt56
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_35_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_56_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_35, rpt35, ftchash_rec_prefix16, ftch_recprefix16);
-
-} /* ftstat_rpt_35_calc */
+  STD_CALC_HASH(ftstat_rpt_56, rpt56, ftchash_rec_prefix162,
+    ftch_recprefix162);
+ 
+} /* ftstat_rpt_56_calc */
 
-/* function: ftstat_rpt_35_dump
+/* function: ftstat_rpt_56_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt56
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_35_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_56_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_35, rpt35, chash_prefix16_dump,
-   FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-   (char*)0L,
-    "", "ip-destination-address", "output-interface", "", "", "", "");
-
-} /* ftstat_rpt_35_dump */
+  STD_MERGE_HASH(ftstat_rpt_56, ftchash_rec_prefix162);
 
+} /* ftstat_rpt_56_merge */
 
-/* function: ftstat_rpt_35_free
+/* function: ftstat_rpt_56_save
  *
- * Free data structures for report allocated by ftstat_rpt_35_new
+ * Write the counters of rpt56 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_35_free(struct ftstat_rpt_35 *rpt35)
+int ftstat_rpt_56_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt35);
+  STD_SAVE_HASH(ftstat_rpt_56, ftchash_rec_prefix162);
 
-} /* ftstat_rpt_35_free */
+} /* ftstat_rpt_56_save */
+
+/* function: ftstat_rpt_56_load
+ *
+ * Merge counters written by ftstat_rpt_56_save() into rpt56
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_56_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_LOAD_HASH(ftstat_rpt_56, ftchash_rec_prefix162);
 
-/* function: ftstat_rpt_36_new
+} /* ftstat_rpt_56_load */
+
+/* function: ftstat_rpt_56_dump
  *
- * Allocate and initialize data structures for rpt 36.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_36 *ftstat_rpt_36_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_56_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_36, rpt36, 65536, ftchash_rec_prefix216, 13, 65536);
+  STD_DUMP_HASH2P(ftstat_rpt_56, rpt56, chash_prefix162_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
+    "", "ip-destination-address", "ip-source-port", "ip-destination-port", "",
+    "", "");
 
-} /* ftstat_rpt_36_new */
+} /* ftstat_rpt_56_dump */
+
+/* function: ftstat_rpt_56_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_56_new
+ *
+ */
+void ftstat_rpt_56_free(struct ftstat_rpt_56 *rpt56)
+{ 
+ 
+  STD_FREE_HASH(rpt56);
+   
+} /* ftstat_rpt_56_free */
 
 
-/* function: ftstat_rpt_36_accum
+/* function: ftstat_rpt_57_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_57 *ftstat_rpt_57_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_57, rpt57, 65536, ftchash_rec_prefix216, 13, 65536);
+
+} /* ftstat_rpt_57_new */
+
+/* function: ftstat_rpt_57_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_36_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_57_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_36, rpt36, ftchash_rec_prefix216,
+  STD_ACCUM_HASH1(ftstat_rpt_57, rpt57, ftchash_rec_prefix216,
     ftch_recprefix216, ftch_recprefix216p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
+ 
+  FT_RECGET_SRCPORT(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
-    
+
   ftch_recprefix216.src_prefix = cur.srcaddr;
   ftch_recprefix216.dst_prefix = cur.dstaddr;
-  ftch_recprefix216.c16 = cur.input;
-
+  ftch_recprefix216.c16 = cur.srcport;
+  
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
@@ -8111,8 +14212,8 @@ int ftstat_rpt_36_accum(struct ftstat_rpt *rpt, char *rec,
     FT_RECGET_DST_MASK(cur,rec,*fo);
     ftch_recprefix216.dst_mask = cur.dst_mask;
   }
- 
-  /* remove host bits */  
+  
+  /* remove host bits */
   if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
     ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
   }
@@ -8128,91 +14229,131 @@ int ftstat_rpt_36_accum(struct ftstat_rpt *rpt, char *rec,
           (ftch_recprefix216.c16)^
           (ftch_recprefix216.src_mask)^
           (uint32_t)(ftch_recprefix216.dst_mask<<8);
+ 
+  STD_ACCUM_HASH2(rpt57, ftch_recprefix216, ftch_recprefix216p);
 
-  STD_ACCUM_HASH2(rpt36, ftch_recprefix216, ftch_recprefix216p);
-  
   return 0;
    
-} /* ftstat_rpt_36_accum */
+} /* ftstat_rpt_57_accum */
 
-/* function: ftstat_rpt_36_calc
+/* function: ftstat_rpt_57_calc
  *
- * Perform final calculations for rpt36
+ * Perform final calculations for rpt57
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_36_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_57_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_36, rpt36, ftchash_rec_prefix216, ftch_recprefix216);
+  STD_CALC_HASH(ftstat_rpt_57, rpt57, ftchash_rec_prefix216,
+    ftch_recprefix216);
 
-} /* ftstat_rpt_36_calc */
+} /* ftstat_rpt_57_calc */
 
-/* function: ftstat_rpt_36_dump
+/* function: ftstat_rpt_57_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt57
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_36_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_57_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_36, rpt36, chash_prefix216_dump,
-    (char*)0L,
-    "", "ip-source-address", "ip-destination-address", "input-interface", "",
-    "", "");
-
-} /* ftstat_rpt_36_dump */
+  STD_MERGE_HASH(ftstat_rpt_57, ftchash_rec_prefix216);
 
+} /* ftstat_rpt_57_merge */
 
-/* function: ftstat_rpt_36_free
+/* function: ftstat_rpt_57_save
  *
- * Free data structures for report allocated by ftstat_rpt_36_new
+ * Write the counters of rpt57 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_36_free(struct ftstat_rpt_36 *rpt36)
+int ftstat_rpt_57_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt36);
+  STD_SAVE_HASH(ftstat_rpt_57, ftchash_rec_prefix216);
 
-} /* ftstat_rpt_36_free */
+} /* ftstat_rpt_57_save */
+
+/* function: ftstat_rpt_57_load
+ *
+ * Merge counters written by ftstat_rpt_57_save() into rpt57
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_57_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_LOAD_HASH(ftstat_rpt_57, ftchash_rec_prefix216);
 
-/* function: ftstat_rpt_37_new
+} /* ftstat_rpt_57_load */
+
+/* function: ftstat_rpt_57_dump
  *
- * Allocate and initialize data structures for rpt 37.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_37 *ftstat_rpt_37_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_57_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_37, rpt37, 65536, ftchash_rec_prefix216, 13, 65536);
+  STD_DUMP_HASH1(ftstat_rpt_57, rpt57, chash_prefix216_dump,
+    FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-address", "ip-destination-address", "ip-source-port", "",
+    "", "");
 
-} /* ftstat_rpt_37_new */
+} /* ftstat_rpt_57_dump */
+
+/* function: ftstat_rpt_57_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_57_new
+ *
+ */
+void ftstat_rpt_57_free(struct ftstat_rpt_57 *rpt57)
+{ 
+ 
+  STD_FREE_HASH(rpt57);
+   
+} /* ftstat_rpt_57_free */
+
+/* function: ftstat_rpt_58_new
+ * 
+ * Allocate and initialize data structures for rpt 58.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_58 *ftstat_rpt_58_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_58, rpt58, 65536, ftchash_rec_prefix216, 13, 65536);
 
+} /* ftstat_rpt_58_new */
 
-/* function: ftstat_rpt_37_accum
+/* function: ftstat_rpt_58_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_37_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_58_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_37, rpt37, ftchash_rec_prefix216,
+  STD_ACCUM_HASH1(ftstat_rpt_58, rpt58, ftchash_rec_prefix216,
     ftch_recprefix216, ftch_recprefix216p);
 
-  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_DSTPORT(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
 
   ftch_recprefix216.src_prefix = cur.srcaddr;
   ftch_recprefix216.dst_prefix = cur.dstaddr;
-  ftch_recprefix216.c16 = cur.output;
-
+  ftch_recprefix216.c16 = cur.dstport;
+ 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
@@ -8223,8 +14364,8 @@ int ftstat_rpt_37_accum(struct ftstat_rpt *rpt, char *rec,
     FT_RECGET_DST_MASK(cur,rec,*fo);
     ftch_recprefix216.dst_mask = cur.dst_mask;
   }
- 
-  /* remove host bits */  
+
+  /* remove host bits */
   if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
     ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
   }
@@ -8232,7 +14373,7 @@ int ftstat_rpt_37_accum(struct ftstat_rpt *rpt, char *rec,
   if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
     ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
   }
-  
+
   hash = (ftch_recprefix216.src_prefix>>16)^
           (ftch_recprefix216.src_prefix & 0xFFFF)^
           (ftch_recprefix216.dst_prefix>>16)^
@@ -8241,92 +14382,134 @@ int ftstat_rpt_37_accum(struct ftstat_rpt *rpt, char *rec,
           (ftch_recprefix216.src_mask)^
           (uint32_t)(ftch_recprefix216.dst_mask<<8);
   
-  STD_ACCUM_HASH2(rpt37, ftch_recprefix216, ftch_recprefix216p);
+  STD_ACCUM_HASH2(rpt58, ftch_recprefix216, ftch_recprefix216p);
+
+  return 0;
+   
+} /* ftstat_rpt_58_accum */
+
+/* function: ftstat_rpt_58_calc
+ *
+ * Perform final calculations for rpt58
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_58_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_58, rpt58, ftchash_rec_prefix216,
+    ftch_recprefix216);
 
-  return 0;
-   
-} /* ftstat_rpt_37_accum */
+} /* ftstat_rpt_58_calc */
 
-/* function: ftstat_rpt_37_calc
+/* function: ftstat_rpt_58_merge
  *
- * Perform final calculations for rpt37
+ * Merge the counters accumulated by src into rpt58
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_37_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_58_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_CALC_HASH(ftstat_rpt_37, rpt37, ftchash_rec_prefix216, ftch_recprefix216);
+  STD_MERGE_HASH(ftstat_rpt_58, ftchash_rec_prefix216);
 
-} /* ftstat_rpt_37_calc */
+} /* ftstat_rpt_58_merge */
 
-/* function: ftstat_rpt_37_dump
+/* function: ftstat_rpt_58_save
  *
- * Dump data for report.
+ * Write the counters of rpt58 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_37_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_58_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_37, rpt37, chash_prefix216_dump,
-    (char*)0L,
-    "", "ip-source-address", "ip-destination-address", "output-interface", "",
-    "", "");
-
-} /* ftstat_rpt_37_dump */
+  STD_SAVE_HASH(ftstat_rpt_58, ftchash_rec_prefix216);
 
+} /* ftstat_rpt_58_save */
 
-/* function: ftstat_rpt_37_free
+/* function: ftstat_rpt_58_load
  *
- * Free data structures for report allocated by ftstat_rpt_37_new
+ * Merge counters written by ftstat_rpt_58_save() into rpt58
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_37_free(struct ftstat_rpt_37 *rpt37)
+int ftstat_rpt_58_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt37);
-
-} /* ftstat_rpt_37_free */
+  STD_LOAD_HASH(ftstat_rpt_58, ftchash_rec_prefix216);
 
+} /* ftstat_rpt_58_load */
 
-/* function: ftstat_rpt_38_new
+/* function: ftstat_rpt_58_dump
  *
- * Allocate and initialize data structures for rpt 38.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_38 *ftstat_rpt_38_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_58_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_38, rpt38, 65536, ftchash_rec_prefix2162, 16, 65536);
+  STD_DUMP_HASH1(ftstat_rpt_58, rpt58, chash_prefix216_dump,
+    FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-address", "ip-destination-address", "ip-destination-port",
+    "", "", "");
 
-} /* ftstat_rpt_38_new */
+} /* ftstat_rpt_58_dump */
+
+/* function: ftstat_rpt_58_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_58_new
+ *
+ */
+void ftstat_rpt_58_free(struct ftstat_rpt_58 *rpt58)
+{ 
+ 
+  STD_FREE_HASH(rpt58);
+   
+} /* ftstat_rpt_58_free */
 
 
-/* function: ftstat_rpt_38_accum
+
+/* function: ftstat_rpt_59_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_59 *ftstat_rpt_59_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_59, rpt59, 65536, ftchash_rec_prefix2162, 16, 65536);
+
+} /* ftstat_rpt_59_new */
+
+/* function: ftstat_rpt_59_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_38_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_59_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_38, rpt38, ftchash_rec_prefix2162,
+  STD_ACCUM_HASH1(ftstat_rpt_59, rpt59, ftchash_rec_prefix2162,
     ftch_recprefix2162, ftch_recprefix2162p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_OUTPUT(cur,rec,*fo);
+ 
+  FT_RECGET_SRCPORT(cur,rec,*fo);
+  FT_RECGET_DSTPORT(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
- 
+  
   ftch_recprefix2162.src_prefix = cur.srcaddr;
   ftch_recprefix2162.dst_prefix = cur.dstaddr;
-  ftch_recprefix2162.c16a = cur.input;
-  ftch_recprefix2162.c16b = cur.output;
-
+  ftch_recprefix2162.c16a = cur.srcport;
+  ftch_recprefix2162.c16b = cur.dstport;
+  
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
@@ -8337,7 +14520,7 @@ int ftstat_rpt_38_accum(struct ftstat_rpt *rpt, char *rec,
     FT_RECGET_DST_MASK(cur,rec,*fo);
     ftch_recprefix2162.dst_mask = cur.dst_mask;
   }
-  
+
   /* remove host bits */
   if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
     ftch_recprefix2162.src_prefix &= ipv4_len2mask(ftch_recprefix2162.src_mask);
@@ -8355,4311 +14538,4224 @@ int ftstat_rpt_38_accum(struct ftstat_rpt *rpt, char *rec,
           (ftch_recprefix2162.c16a)^
           (ftch_recprefix2162.src_mask)^
           (uint32_t)(ftch_recprefix2162.dst_mask<<8);
-  
-  STD_ACCUM_HASH2(rpt38, ftch_recprefix2162, ftch_recprefix2162p);
+
+  STD_ACCUM_HASH2(rpt59, ftch_recprefix2162, ftch_recprefix2162p);
 
   return 0;
    
-} /* ftstat_rpt_38_accum */
+} /* ftstat_rpt_59_accum */
 
-/* function: ftstat_rpt_38_calc
+/* function: ftstat_rpt_59_calc
  *
- * Perform final calculations for rpt38
+ * Perform final calculations for rpt59
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_38_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_59_calc(struct ftstat_rpt *rpt)
 {
-  
-  STD_CALC_HASH(ftstat_rpt_38, rpt38, ftchash_rec_prefix2162,
+
+  STD_CALC_HASH(ftstat_rpt_59, rpt59, ftchash_rec_prefix2162,
     ftch_recprefix2162);
-    
-} /* ftstat_rpt_38_calc */
+ 
+} /* ftstat_rpt_59_calc */
 
-/* function: ftstat_rpt_38_dump
+/* function: ftstat_rpt_59_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt59
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_38_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_59_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_31, rpt31, chash_prefix2162_dump,
-    (char*)0L, (char*)0L,
-    "", "ip-source-address", "ip-destination-address", "input-interface",
-    "output-interface", "", "");
-
-} /* ftstat_rpt_38_dump */
+  STD_MERGE_HASH(ftstat_rpt_59, ftchash_rec_prefix2162);
 
+} /* ftstat_rpt_59_merge */
 
-/* function: ftstat_rpt_38_free
+/* function: ftstat_rpt_59_save
  *
- * Free data structures for report allocated by ftstat_rpt_38_new
+ * Write the counters of rpt59 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_38_free(struct ftstat_rpt_38 *rpt38)
+int ftstat_rpt_59_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt38);
-
-} /* ftstat_rpt_38_free */
+  STD_SAVE_HASH(ftstat_rpt_59, ftchash_rec_prefix2162);
 
+} /* ftstat_rpt_59_save */
 
-/* function: ftstat_rpt_39_new
+/* function: ftstat_rpt_59_load
  *
- * Allocate and initialize data structures for rpt 39.
+ * Merge counters written by ftstat_rpt_59_save() into rpt59
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_39 *ftstat_rpt_39_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_59_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_HASH(ftstat_rpt_39, rpt39, 65536, ftchash_rec_c162, 4, 65536);
-
-} /* ftstat_rpt_39_new */
+  STD_LOAD_HASH(ftstat_rpt_59, ftchash_rec_prefix2162);
 
+} /* ftstat_rpt_59_load */
 
-/* function: ftstat_rpt_39_accum
+/* function: ftstat_rpt_59_dump
  *
- * Accumulate counters for report by processing flow.
+ * Dump data for report.
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_39_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_59_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_39, rpt39, ftchash_rec_c162,
-    ftch_recc162, ftch_recc162p);
+  STD_DUMP_HASH2(ftstat_rpt_31, rpt31, chash_prefix2162_dump,
+    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
+    "", "ip-source-address", "ip-destination-address", "ip-source-port",
+    "ip-destination-port", "", "");
 
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_SRC_AS(cur,rec,*fo);
+} /* ftstat_rpt_59_dump */
 
-  ftch_recc162.c16a = cur.input;
-  ftch_recc162.c16b = cur.src_as;
+/* function: ftstat_rpt_59_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_59_new
+ *
+ */
+void ftstat_rpt_59_free(struct ftstat_rpt_59 *rpt59)
+{ 
  
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
-
-  STD_ACCUM_HASH2(rpt39, ftch_recc162, ftch_recc162p);
-  
-  return 0;
+  STD_FREE_HASH(rpt59);
    
-} /* ftstat_rpt_39_accum */
+} /* ftstat_rpt_59_free */
 
-/* function: ftstat_rpt_39_calc
- *
- * Perform final calculations for rpt39
- *
+
+/* function: ftstat_rpt_60_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_39_calc(struct ftstat_rpt *rpt)
+struct ftstat_rpt_60 *ftstat_rpt_60_new(struct ftstat_rpt *rpt)
 {
+  
+  STD_NEW_HASH(ftstat_rpt_60, rpt60, 65536, ftchash_rec_prefix162, 10, 65536);
 
-  STD_CALC_HASH(ftstat_rpt_39, rpt39, ftchash_rec_c162, ftch_recc162);
-
-} /* ftstat_rpt_39_calc */
+} /* ftstat_rpt_60_new */
 
-/* function: ftstat_rpt_39_dump
+/* function: ftstat_rpt_60_accum
  *
- * Dump data for report.
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_39_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_60_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_8, rpt8, chash_c162_dump,
-    (char*)0L, FT_PATH_SYM_ASN,
-    "", "input-interface", "source-as", "", "", "", "");
-
-} /* ftstat_rpt_39_dump */
-
+  STD_ACCUM_HASH1(ftstat_rpt_60, rpt60, ftchash_rec_prefix162,
+    ftch_recprefix162, ftch_prefix162p);
 
-/* function: ftstat_rpt_39_free
- *
- * Free data structures for report allocated by ftstat_rpt_39_new
- *
- */
-void ftstat_rpt_39_free(struct ftstat_rpt_39 *rpt39)
-{
+  FT_RECGET_INPUT(cur,rec,*fo);
+  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  
+  ftch_recprefix162.prefix = cur.srcaddr;
+  ftch_recprefix162.c16a = cur.input;
+  ftch_recprefix162.c16b = cur.output;
 
-  STD_FREE_HASH(rpt39);
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix162.mask = cur.src_mask; 
+  }
 
-} /* ftstat_rpt_39_free */
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+ 
+  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
+    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
+    (ftch_recprefix162.c16b);   
+   
+  STD_ACCUM_HASH2(rpt60, ftch_recprefix162, ftch_prefix162p);
 
+  return 0;
+   
+} /* ftstat_rpt_60_accum */
 
-/* function: ftstat_rpt_40_new
+/* function: ftstat_rpt_60_calc
  *
- * Allocate and initialize data structures for rpt 40.
+ * Perform final calculations for rpt60
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_40 *ftstat_rpt_40_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_60_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_40, rpt40, 65536, ftchash_rec_c162, 4, 65536);
-
-} /* ftstat_rpt_40_new */
+  STD_CALC_HASH(ftstat_rpt_60, rpt60, ftchash_rec_prefix162,
+    ftch_recprefix162);
 
+} /* ftstat_rpt_60_calc */
 
-/* function: ftstat_rpt_40_accum
+/* function: ftstat_rpt_60_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt60
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_40_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_60_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_40, rpt40, ftchash_rec_c162,
-    ftch_recc162, ftch_recc162p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
-
-  ftch_recc162.c16a = cur.input;
-  ftch_recc162.c16b = cur.dst_as;
-  
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
-    
-  STD_ACCUM_HASH2(rpt40, ftch_recc162, ftch_recc162p);
+  STD_MERGE_HASH(ftstat_rpt_60, ftchash_rec_prefix162);
 
-  return 0;
-   
-} /* ftstat_rpt_40_accum */
+} /* ftstat_rpt_60_merge */
 
-/* function: ftstat_rpt_40_calc
+/* function: ftstat_rpt_60_save
  *
- * Perform final calculations for rpt40
+ * Write the counters of rpt60 to fp
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_40_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_60_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_40, rpt40, ftchash_rec_c162, ftch_recc162);
+  STD_SAVE_HASH(ftstat_rpt_60, ftchash_rec_prefix162);
 
-} /* ftstat_rpt_40_calc */
+} /* ftstat_rpt_60_save */
 
-/* function: ftstat_rpt_40_dump
+/* function: ftstat_rpt_60_load
  *
- * Dump data for report.
+ * Merge counters written by ftstat_rpt_60_save() into rpt60
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_40_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_60_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_40, rpt40, chash_c162_dump,
-    (char*)0L, FT_PATH_SYM_ASN,
-    "", "input-interface", "destination-as", "", "", "", "");
-
-} /* ftstat_rpt_40_dump */
+  STD_LOAD_HASH(ftstat_rpt_60, ftchash_rec_prefix162);
 
+} /* ftstat_rpt_60_load */
 
-/* function: ftstat_rpt_40_free
+/* function: ftstat_rpt_60_dump
  *
- * Free data structures for report allocated by ftstat_rpt_40_new
+ * Dump data for report.
  *
  */
-void ftstat_rpt_40_free(struct ftstat_rpt_40 *rpt40)
+int ftstat_rpt_60_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_FREE_HASH(rpt40);
-
-} /* ftstat_rpt_40_free */
+  STD_DUMP_HASH2P(ftstat_rpt_60, rpt60, chash_prefix162_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    (char*)0L, (char*)0L,
+    "", "ip-source-address", "input-interface", "output-interface", "", "",
+    "");
 
+} /* ftstat_rpt_60_dump */
 
-/* function: ftstat_rpt_41_new
+/* function: ftstat_rpt_60_free
  *
- * Allocate and initialize data structures for rpt 41.
+ * Free data structures for report allocated by ftstat_rpt_60_new
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_41 *ftstat_rpt_41_new(struct ftstat_rpt *rpt)
-{
+void ftstat_rpt_60_free(struct ftstat_rpt_60 *rpt60)
+{ 
+ 
+  STD_FREE_HASH(rpt60);
+   
+} /* ftstat_rpt_60_free */
 
-  STD_NEW_HASH(ftstat_rpt_41, rpt41, 65536, ftchash_rec_c162, 4, 65536);
 
-} /* ftstat_rpt_41_new */
+/* function: ftstat_rpt_61_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_61 *ftstat_rpt_61_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_61, rpt61, 65536, ftchash_rec_prefix162, 10, 65536);
 
+} /* ftstat_rpt_61_new */
 
-/* function: ftstat_rpt_41_accum
+/* function: ftstat_rpt_61_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_41_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_61_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_41, rpt41, ftchash_rec_c162,
-    ftch_recc162, ftch_recc162p);
+  STD_ACCUM_HASH1(ftstat_rpt_61, rpt61, ftchash_rec_prefix162,
+    ftch_recprefix162, ftch_prefix162p);
 
+  FT_RECGET_INPUT(cur,rec,*fo);
   FT_RECGET_OUTPUT(cur,rec,*fo);
-  FT_RECGET_SRC_AS(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+ 
+  ftch_recprefix162.prefix = cur.dstaddr;
+  ftch_recprefix162.c16a = cur.input;
+  ftch_recprefix162.c16b = cur.output;
 
-  ftch_recc162.c16a = cur.output;
-  ftch_recc162.c16b = cur.src_as;
-  
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix162.mask = cur.dst_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+
+  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
+    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
+    (ftch_recprefix162.c16b);
+
+  STD_ACCUM_HASH2(rpt61, ftch_recprefix162, ftch_prefix162p);
 
-  STD_ACCUM_HASH2(rpt41, ftch_recc162, ftch_recc162p);
-   
   return 0;
    
-} /* ftstat_rpt_41_accum */
+} /* ftstat_rpt_61_accum */
 
-/* function: ftstat_rpt_41_calc
+/* function: ftstat_rpt_61_calc
  *
- * Perform final calculations for rpt41
+ * Perform final calculations for rpt61
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_41_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_61_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_41, rpt41, ftchash_rec_c162, ftch_recc162);
+  STD_CALC_HASH(ftstat_rpt_61, rpt61, ftchash_rec_prefix162,
+    ftch_recprefix162);
 
-} /* ftstat_rpt_41_calc */
+} /* ftstat_rpt_61_calc */
 
-/* function: ftstat_rpt_41_dump
+/* function: ftstat_rpt_61_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt61
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_41_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_61_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_41, rpt41, chash_c162_dump,
-    (char*)0L, FT_PATH_SYM_ASN,
-    "", "output-interface", "source-as", "", "", "", "");
-
-} /* ftstat_rpt_41_dump */
+  STD_MERGE_HASH(ftstat_rpt_61, ftchash_rec_prefix162);
 
+} /* ftstat_rpt_61_merge */
 
-/* function: ftstat_rpt_41_free
+/* function: ftstat_rpt_61_save
  *
- * Free data structures for report allocated by ftstat_rpt_41_new
+ * Write the counters of rpt61 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_41_free(struct ftstat_rpt_41 *rpt41)
+int ftstat_rpt_61_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt41);
+  STD_SAVE_HASH(ftstat_rpt_61, ftchash_rec_prefix162);
 
-} /* ftstat_rpt_41_free */
+} /* ftstat_rpt_61_save */
+
+/* function: ftstat_rpt_61_load
+ *
+ * Merge counters written by ftstat_rpt_61_save() into rpt61
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_61_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_LOAD_HASH(ftstat_rpt_61, ftchash_rec_prefix162);
 
-/* function: ftstat_rpt_42_new
+} /* ftstat_rpt_61_load */
+
+/* function: ftstat_rpt_61_dump
  *
- * Allocate and initialize data structures for rpt 42.
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_42 *ftstat_rpt_42_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_61_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_42, rpt42, 65536, ftchash_rec_c162, 4, 65536);
+  STD_DUMP_HASH2P(ftstat_rpt_61, rpt61, chash_prefix162_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    (char*)0L, (char*)0L,
+    "", "ip-destination-address", "input-interface", "output-interface", "",
+    "", "");
+   
+} /* ftstat_rpt_61_dump */
 
-} /* ftstat_rpt_42_new */
+/* function: ftstat_rpt_61_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_61_new
+ *
+ */
+void ftstat_rpt_61_free(struct ftstat_rpt_61 *rpt61)
+{ 
+ 
+  STD_FREE_HASH(rpt61);
+   
+} /* ftstat_rpt_61_free */
 
 
-/* function: ftstat_rpt_42_accum
+/* function: ftstat_rpt_62_new
+ * 
+ * Allocate and initialize data structures for rpt 52.
+ * 
+ * returns allocated struct or 0L for error
+ */
+struct ftstat_rpt_62 *ftstat_rpt_62_new(struct ftstat_rpt *rpt)
+{
+  
+  STD_NEW_HASH(ftstat_rpt_62, rpt62, 65536, ftchash_rec_prefix162, 10, 65536);
+
+} /* ftstat_rpt_62_new */
+
+/* function: ftstat_rpt_62_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_42_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_62_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_42, rpt42, ftchash_rec_c162,
-    ftch_recc162, ftch_recc162p);
+  STD_ACCUM_HASH1(ftstat_rpt_62, rpt62, ftchash_rec_prefix162,
+    ftch_recprefix162, ftch_prefix162p);
 
-  FT_RECGET_OUTPUT(cur,rec,*fo);
+  FT_RECGET_SRC_AS(cur,rec,*fo);
   FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+ 
+  ftch_recprefix162.prefix = cur.srcaddr;
+  ftch_recprefix162.c16a = cur.src_as;
+  ftch_recprefix162.c16b = cur.dst_as;
 
-  ftch_recc162.c16a = cur.output;
-  ftch_recc162.c16b = cur.dst_as;
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix162.mask = cur.src_mask; 
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+
+  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
+    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
+    (ftch_recprefix162.c16b);   
   
-  hash = (ftch_recc162.c16a>>16) ^ (ftch_recc162.c16a & 0xFFFF) ^
-    (ftch_recc162.c16b>>16) ^ (ftch_recc162.c16b & 0xFFFF);
+  STD_ACCUM_HASH2(rpt62, ftch_recprefix162, ftch_prefix162p);
 
-  STD_ACCUM_HASH2(rpt42, ftch_recc162, ftch_recc162p);
-   
   return 0;
    
-} /* ftstat_rpt_42_accum */
+} /* ftstat_rpt_62_accum */
+
+/* function: ftstat_rpt_62_calc
+ *
+ * Perform final calculations for rpt62
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_62_calc(struct ftstat_rpt *rpt)
+{
+
+  STD_CALC_HASH(ftstat_rpt_62, rpt55, ftchash_rec_prefix162,
+    ftch_recprefix162);
+ 
+} /* ftstat_rpt_62_calc */
+
+/* function: ftstat_rpt_62_merge
+ *
+ * Merge the counters accumulated by src into rpt62
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_62_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
 
-/* function: ftstat_rpt_42_calc
+  STD_MERGE_HASH(ftstat_rpt_62, ftchash_rec_prefix162);
+
+} /* ftstat_rpt_62_merge */
+
+/* function: ftstat_rpt_62_save
  *
- * Perform final calculations for rpt42
+ * Write the counters of rpt62 to fp
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_42_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_62_save(struct ftstat_rpt *rpt, FILE *fp)
 {
-    
-  STD_CALC_HASH(ftstat_rpt_42, rpt42, ftchash_rec_c162, ftch_recc162);
 
-} /* ftstat_rpt_42_calc */
+  STD_SAVE_HASH(ftstat_rpt_62, ftchash_rec_prefix162);
 
-/* function: ftstat_rpt_42_dump
+} /* ftstat_rpt_62_save */
+
+/* function: ftstat_rpt_62_load
  *
- * Dump data for report.
+ * Merge counters written by ftstat_rpt_62_save() into rpt62
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_42_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_62_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  
-  STD_DUMP_HASH2(ftstat_rpt_42, rpt42, chash_c162_dump,
-    (char*)0L, FT_PATH_SYM_ASN,
-    "", "output-interface", "destination-as", "", "", "", "");
- 
-
-} /* ftstat_rpt_42_dump */
+  STD_LOAD_HASH(ftstat_rpt_62, ftchash_rec_prefix162);
 
+} /* ftstat_rpt_62_load */
 
-/* function: ftstat_rpt_42_free
+/* function: ftstat_rpt_62_dump
  *
- * Free data structures for report allocated by ftstat_rpt_42_new
+ * Dump data for report.
  *
  */
-void ftstat_rpt_42_free(struct ftstat_rpt_42 *rpt42)
+int ftstat_rpt_62_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_FREE_HASH(rpt42);
-
-} /* ftstat_rpt_42_free */
+  STD_DUMP_HASH2P(ftstat_rpt_62, rpt62, chash_prefix162_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "ip-source-address", "source-as", "destination-as", "", "", "");
 
+} /* ftstat_rpt_62_dump */
 
-/* function: ftstat_rpt_43_new
+/* function: ftstat_rpt_62_free
  *
- * Allocate and initialize data structures for rpt 43.
+ * Free data structures for report allocated by ftstat_rpt_62_new
  *
+ */
+void ftstat_rpt_62_free(struct ftstat_rpt_62 *rpt62)
+{ 
+ 
+  STD_FREE_HASH(rpt62);
+   
+} /* ftstat_rpt_62_free */
+
+/* function: ftstat_rpt_63_new
+ * 
+ * Allocate and initialize data structures for rpt 63
+ * 
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_43 *ftstat_rpt_43_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_63 *ftstat_rpt_63_new(struct ftstat_rpt *rpt)
 {
+  
+  STD_NEW_HASH(ftstat_rpt_63, rpt63, 65536, ftchash_rec_prefix162, 10, 65536);
 
-  STD_NEW_HASH(ftstat_rpt_43, rpt43, 65536, ftchash_rec_c163, 6, 65536);
-
-} /* ftstat_rpt_43_new */
-
+} /* ftstat_rpt_63_new */
 
-/* function: ftstat_rpt_43_accum
+/* function: ftstat_rpt_63_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_43_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_63_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_43, rpt43, ftchash_rec_c163,
-    ftch_recc163, ftch_recc163p);
+  STD_ACCUM_HASH1(ftstat_rpt_63, rpt63, ftchash_rec_prefix162,
+    ftch_recprefix162, ftch_prefix162p);
 
-  FT_RECGET_INPUT(cur,rec,*fo);
   FT_RECGET_SRC_AS(cur,rec,*fo);
   FT_RECGET_DST_AS(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+ 
+  ftch_recprefix162.prefix = cur.dstaddr;
+  ftch_recprefix162.c16a = cur.src_as;
+  ftch_recprefix162.c16b = cur.dst_as;
 
-  ftch_recc163.c16a = cur.input;
-  ftch_recc163.c16b = cur.src_as;
-  ftch_recc163.c16c = cur.dst_as;
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix162.mask = cur.dst_mask; 
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+
+  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
+    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
+    (ftch_recprefix162.c16b);   
   
-  hash = ftch_recc163.c16a ^ ftch_recc163.c16b ^ ftch_recc163.c16c;
-   
-  STD_ACCUM_HASH2(rpt43, ftch_recc163, ftch_recc163p);
+  STD_ACCUM_HASH2(rpt63, ftch_recprefix162, ftch_prefix162p);
 
   return 0;
    
-} /* ftstat_rpt_43_accum */
+} /* ftstat_rpt_63_accum */
 
-/* function: ftstat_rpt_43_calc
+/* function: ftstat_rpt_63_calc
  *
- * Perform final calculations for rpt43
+ * Perform final calculations for rpt63
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_43_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_63_calc(struct ftstat_rpt *rpt)
 {
-  
-  STD_CALC_HASH(ftstat_rpt_43, rpt43, ftchash_rec_c163, ftch_recc163);
 
-} /* ftstat_rpt_43_calc */
+  STD_CALC_HASH(ftstat_rpt_63, rpt55, ftchash_rec_prefix162,
+    ftch_recprefix162);
+ 
+} /* ftstat_rpt_63_calc */
 
-/* function: ftstat_rpt_43_dump
+/* function: ftstat_rpt_63_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt63
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_43_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_63_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH3(ftstat_rpt_43, rpt43, chash_c163_dump,
-    (char*)0L, FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "input-interface", "source-as", "destination-as", "", "", "");
-  
-} /* ftstat_rpt_43_dump */
+  STD_MERGE_HASH(ftstat_rpt_63, ftchash_rec_prefix162);
 
+} /* ftstat_rpt_63_merge */
 
-/* function: ftstat_rpt_43_free
+/* function: ftstat_rpt_63_save
  *
- * Free data structures for report allocated by ftstat_rpt_43_new
+ * Write the counters of rpt63 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_43_free(struct ftstat_rpt_43 *rpt43)
+int ftstat_rpt_63_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_FREE_HASH(rpt43);
+  STD_SAVE_HASH(ftstat_rpt_63, ftchash_rec_prefix162);
 
-} /* ftstat_rpt_43_free */
+} /* ftstat_rpt_63_save */
+
+/* function: ftstat_rpt_63_load
+ *
+ * Merge counters written by ftstat_rpt_63_save() into rpt63
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_63_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
+  STD_LOAD_HASH(ftstat_rpt_63, ftchash_rec_prefix162);
 
-/* function: ftstat_rpt_44_new
+} /* ftstat_rpt_63_load */
+
+/* function: ftstat_rpt_63_dump
  *
- * Allocate and initialize data structures for rpt 44.
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_63_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
+
+  STD_DUMP_HASH2P(ftstat_rpt_63, rpt63, chash_prefix162_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
+    "", "ip-destination-address", "source-as", "destination-as", "", "", "");
+
+} /* ftstat_rpt_63_dump */
+
+/* function: ftstat_rpt_63_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_62_new
+ *
+ */
+void ftstat_rpt_63_free(struct ftstat_rpt_63 *rpt63)
+{ 
+ 
+  STD_FREE_HASH(rpt63);
+   
+} /* ftstat_rpt_63_free */
+
+/* function: ftstat_rpt_64_new
+ *
+ * Allocate and initialize data structures for rpt 15.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_44 *ftstat_rpt_44_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_64 *ftstat_rpt_64_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_44, rpt44, 65536, ftchash_rec_c163, 6, 65536);
+  STD_NEW_HASH(ftstat_rpt_64, rpt64, 65536, ftchash_rec_prefix, 5, 65536);
 
-} /* ftstat_rpt_44_new */
+} /* ftstat_rpt_64_new */
 
 
-/* function: ftstat_rpt_44_accum
+/* function: ftstat_rpt_64_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_44_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_64_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_44, rpt44, ftchash_rec_c163,
-    ftch_recc163, ftch_recc163p);
+  STD_ACCUM_HASH1(ftstat_rpt_64, rpt64, ftchash_rec_prefix, ftch_recprefix,
+    ftch_recprefixp);
 
-  FT_RECGET_OUTPUT(cur,rec,*fo);
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
-    
-  ftch_recc163.c16a = cur.output;
-  ftch_recc163.c16b = cur.src_as;
-  ftch_recc163.c16c = cur.dst_as;
+  FT_RECGET_SRCADDR(cur,rec,*fo);
  
-  hash = ftch_recc163.c16a ^ ftch_recc163.c16b ^ ftch_recc163.c16c;
+  ftch_recprefix.prefix = cur.srcaddr;
 
-  STD_ACCUM_HASH2(rpt44, ftch_recc163, ftch_recc163p);
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix.mask = cur.src_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+
+  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefix.mask);
+
+  STD_ACCUM_HASH2(rpt64, ftch_recprefix, ftch_recprefixp);
+
+  bzero(&ftch_recprefix, sizeof ftch_recprefix);
+
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+ 
+  ftch_recprefix.prefix = cur.dstaddr;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix.mask = cur.dst_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+
+  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefix.mask);
+
+  STD_ACCUM_HASH2(rpt64, ftch_recprefix, ftch_recprefixp);
 
   return 0;
    
-} /* ftstat_rpt_44_accum */
+} /* ftstat_rpt_64_accum */
 
-/* function: ftstat_rpt_44_calc
+/* function: ftstat_rpt_64_calc
  *
- * Perform final calculations for rpt44
+ * Perform final calculations for rpt64
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_44_calc(struct ftstat_rpt *rpt)
-{
-  
-  STD_CALC_HASH(ftstat_rpt_44, rpt44, ftchash_rec_c163, ftch_recc163);
-  
-} /* ftstat_rpt_44_calc */
-
-/* function: ftstat_rpt_44_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_44_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_64_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH3(ftstat_rpt_44, rpt44, chash_c163_dump,
-    (char*)0L, FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "output-interface", "source-as", "destination-as", "", "", "");
- 
-} /* ftstat_rpt_44_dump */
+  STD_CALC_HASH(ftstat_rpt_64, rpt64, ftchash_rec_prefix, ftch_recprefix);
 
+} /* ftstat_rpt_64_calc */
 
-/* function: ftstat_rpt_44_free
+/* function: ftstat_rpt_64_merge
  *
- * Free data structures for report allocated by ftstat_rpt_44_new
+ * Merge the counters accumulated by src into rpt64
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_44_free(struct ftstat_rpt_44 *rpt44)
+int ftstat_rpt_64_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_FREE_HASH(rpt44);
-
-} /* ftstat_rpt_44_free */
+  STD_MERGE_HASH(ftstat_rpt_64, ftchash_rec_prefix);
 
+} /* ftstat_rpt_64_merge */
 
-/* function: ftstat_rpt_45_new
+/* function: ftstat_rpt_64_save
  *
- * Allocate and initialize data structures for rpt 45.
+ * Write the counters of rpt64 to fp
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_45 *ftstat_rpt_45_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_64_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_NEW_HASH(ftstat_rpt_45, rpt45, 65536, ftchash_rec_c164, 8, 65536);
-
-} /* ftstat_rpt_45_new */
+  STD_SAVE_HASH(ftstat_rpt_64, ftchash_rec_prefix);
 
+} /* ftstat_rpt_64_save */
 
-/* function: ftstat_rpt_45_accum
+/* function: ftstat_rpt_64_load
  *
- * Accumulate counters for report by processing flow.
+ * Merge counters written by ftstat_rpt_64_save() into rpt64
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_45_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_64_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_45, rpt45, ftchash_rec_c164,
-    ftch_recc164, ftch_recc164p);
+  STD_LOAD_HASH(ftstat_rpt_64, ftchash_rec_prefix);
 
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_OUTPUT(cur,rec,*fo);
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
-  
-  ftch_recc164.c16a = cur.input;
-  ftch_recc164.c16b = cur.output;
-  ftch_recc164.c16c = cur.src_as;
-  ftch_recc164.c16d = cur.dst_as;
- 
-  hash = ftch_recc164.c16a ^ ftch_recc164.c16b ^ ftch_recc164.c16c ^
-         ftch_recc164.c16c;;
+} /* ftstat_rpt_64_load */
 
-  STD_ACCUM_HASH2(rpt45, ftch_recc164, ftch_recc164p);
+/* function: ftstat_rpt_64_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_64_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-  return 0;
-   
-} /* ftstat_rpt_45_accum */
+  STD_DUMP_HASH0P(ftstat_rpt_64, rpt64, chash_prefix_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK|
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    "ip-address", "", "", "", "", "", "");
 
-/* function: ftstat_rpt_45_calc
+} /* ftstat_rpt_64_dump */
+
+
+/* function: ftstat_rpt_64_free
  *
- * Perform final calculations for rpt45
+ * Free data structures for report allocated by ftstat_rpt_64_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_45_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_64_free(struct ftstat_rpt_64 *rpt64)
 {
-  
-  STD_CALC_HASH(ftstat_rpt_45, rpt45, ftchash_rec_c164, ftch_recc164);
 
-} /* ftstat_rpt_45_calc */
+  STD_FREE_HASH(rpt64);
 
-/* function: ftstat_rpt_45_dump
+} /* ftstat_rpt_64_free */
+
+/* function: ftstat_rpt_65_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 6.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_45_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_65 *ftstat_rpt_65_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH4(ftstat_rpt_45, rpt45, chash_c164_dump,
-    (char*)0L, (char*)0L, FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "input-interface", "output-interface", "source-as", "destination-as",
-    "", "");
+  STD_NEW_BUCKET(ftstat_rpt_65, rpt65, 65536, rpt);
 
-} /* ftstat_rpt_45_dump */
+} /* ftstat_rpt_65_new */
 
 
-/* function: ftstat_rpt_45_free
+/* function: ftstat_rpt_65_accum
  *
- * Free data structures for report allocated by ftstat_rpt_45_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_45_free(struct ftstat_rpt_45 *rpt45)
+int ftstat_rpt_65_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_FREE_HASH(rpt45);
+  STD_ACCUM_BUCKET1(ftstat_rpt_65, rpt65);
 
-} /* ftstat_rpt_45_free */
+  FT_RECGET_SRCPORT(cur,rec,*fo);
 
+  STD_ACCUM_BUCKET2(rpt65->bucket, cur.srcport);
 
-/* function: ftstat_rpt_46_new
+  FT_RECGET_DSTPORT(cur,rec,*fo);
+
+  STD_ACCUM_BUCKET2(rpt65->bucket, cur.dstport);
+
+  return 0;
+
+} /* ftstat_rpt_65_accum */
+
+/* function: ftstat_rpt_65_calc
  *
- * Allocate and initialize data structures for rpt 46.
+ * Perform final calculations for rpt65
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_46 *ftstat_rpt_46_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_65_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_46, rpt46, 256, rpt);
-
-} /* ftstat_rpt_46_new */
+  STD_CALC_BUCKET(ftstat_rpt_65, rpt65, 65536);
 
+} /* ftstat_rpt_65_calc */
 
-/* function: ftstat_rpt_46_accum
+/* function: ftstat_rpt_65_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt65
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_46_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_65_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_46, rpt46);
-  
-  FT_RECGET_ENGINE_ID(cur,rec,*fo);
+  STD_MERGE_BUCKET(ftstat_rpt_65, 65536);
 
-  STD_ACCUM_BUCKET2(rpt46->bucket, cur.engine_id);
+} /* ftstat_rpt_65_merge */
 
-  return 0;
+/* function: ftstat_rpt_65_save
+ *
+ * Write the counters of rpt65 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_65_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-} /* ftstat_rpt_46_accum */
+  STD_SAVE_BUCKET(ftstat_rpt_65, 65536);
 
-/* function: ftstat_rpt_46_calc
+} /* ftstat_rpt_65_save */
+
+/* function: ftstat_rpt_65_load
  *
- * Perform final calculations for rpt46
+ * Merge counters written by ftstat_rpt_65_save() into rpt65
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_46_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_65_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_46, rpt46, 256);
+  STD_LOAD_BUCKET(ftstat_rpt_65, 65536);
 
-} /* ftstat_rpt_46_calc */
+} /* ftstat_rpt_65_load */
 
-/* function: ftstat_rpt_46_dump
+/* function: ftstat_rpt_65_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_46_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_65_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_46, rpt46, 256, (char*)0L,
-    "engine-id", "", "", "", "", "", "");
+  STD_DUMP_BUCKET(ftstat_rpt_65, rpt65, 65536, FT_PATH_SYM_TCP_PORT,
+    "ip-port", "", "", "", "", "", "");
 
-} /* ftstat_rpt_46_dump */
+} /* ftstat_rpt_65_dump */
 
 
-/* function: ftstat_rpt_46_free
+/* function: ftstat_rpt_65_free
  *
- * Free data structures for report allocated by ftstat_rpt_46_new
+ * Free data structures for report allocated by ftstat_rpt_65_new
  *
  */
-void ftstat_rpt_46_free(struct ftstat_rpt_46 *rpt46)
+void ftstat_rpt_65_free(struct ftstat_rpt_65 *rpt65)
 {
 
-  STD_FREE_BUCKET(rpt46);
-
-} /* ftstat_rpt_46_free */
+  STD_FREE_BUCKET(rpt65);
 
+} /* ftstat_rpt_65_free */
 
-/* function: ftstat_rpt_47_new
+/* function: ftstat_rpt_66_new
  *
- * Allocate and initialize data structures for rpt 47.
+ * Allocate and initialize data structures for rpt 15.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_47 *ftstat_rpt_47_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_66 *ftstat_rpt_66_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_47, rpt47, 256, rpt);
+  STD_NEW_HASH1(ftstat_rpt_66, rpt66, 65536, ftchash_rec_prefixh, 5,
+    65536, 0);
 
-} /* ftstat_rpt_47_new */
+} /* ftstat_rpt_66_new */
 
 
-/* function: ftstat_rpt_47_accum
+/* function: ftstat_rpt_66_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_47_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_66_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
+  struct ftchash_rec_prefixs *ftch_recprefixsp, ftch_recprefixs;
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_47, rpt47);
-   
-  FT_RECGET_ENGINE_TYPE(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_66, rpt66, ftchash_rec_prefixh, ftch_recprefixh,
+    ftch_recprefixhp);
 
-  STD_ACCUM_BUCKET2(rpt47->bucket, cur.engine_type);
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+ 
+  ftch_recprefixh.prefix = cur.srcaddr;
 
-  return 0;
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefixh.mask = cur.src_mask;
+  }
 
-} /* ftstat_rpt_47_accum */
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefixh.prefix &= ipv4_len2mask(ftch_recprefixh.mask);
 
-/* function: ftstat_rpt_47_calc
- *
- * Perform final calculations for rpt47
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_47_calc(struct ftstat_rpt *rpt)
-{
+  hash = (ftch_recprefixh.prefix>>16) ^ (ftch_recprefixh.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefixh.mask);
 
-  STD_CALC_BUCKET(ftstat_rpt_47, rpt47, 256);
+  STD_ACCUM_HASH2(rpt66, ftch_recprefixh, ftch_recprefixhp);
 
-} /* ftstat_rpt_47_calc */
+  FT_RECGET_DSTADDR(cur,rec,*fo);
 
-/* function: ftstat_rpt_47_dump
+  bzero(&ftch_recprefixs, sizeof ftch_recprefixs);
+ 
+  ftch_recprefixs.prefix = cur.dstaddr;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefixs.mask = cur.dst_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefixs.prefix &= ipv4_len2mask(ftch_recprefixs.mask);
+
+  /* estimate only, no second hash */
+  if (rpt->count_estimate) {
+
+    if (!ftch_recprefixhp->hll) {
+      if (!(ftch_recprefixhp->hll = fthll_new(rpt->count_estimate))) {
+        fterr_warnx("fthll_new(): failed");
+        return -1;
+      }
+    }
+
+    fthll_add(ftch_recprefixhp->hll,
+      (uint64_t)ftch_recprefixs.prefix << 8 | ftch_recprefixs.mask);
+
+    return 0;
+
+  }
+
+  /* new second hash */
+  if (!ftch_recprefixhp->ftch) {
+    if (!(ftch_recprefixhp->ftch = ftchash_new(256,
+      sizeof (struct ftchash_rec_prefixs), 5, 64))) {
+      fterr_warnx("ftchash_new(): failed");
+      return -1;
+    }
+  }
+
+  hash = (ftch_recprefixs.prefix>>16) ^ (ftch_recprefixs.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefixs.mask);
+  hash = (hash >> 8) ^ (hash & 0xFF);
+
+  if (!(ftch_recprefixsp = ftchash_update(ftch_recprefixhp->ftch,
+    &ftch_recprefixs, hash))) {
+    fterr_warnx("ftch_update(): failed");
+    return -1;
+  }
+
+  return 0;
+   
+} /* ftstat_rpt_66_accum */
+
+/* function: ftstat_rpt_66_calc
  *
- * Dump data for report.
+ * Perform final calculations for rpt66
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_47_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_66_calc(struct ftstat_rpt *rpt)
 {
+  struct ftchash_rec_prefixh *ftch_recprefixh;
+  struct ftstat_rpt_66 *rpt66;
 
-  STD_DUMP_BUCKET(ftstat_rpt_47, rpt47, 256, (char*)0L,
-    "engine-type", "", "", "", "", "", "");
+  rpt66 = rpt->data;
 
-} /* ftstat_rpt_47_dump */
+  STD_CALC;
 
+  rpt->recs = rpt66->ftch->entries;
 
-/* function: ftstat_rpt_47_free
- *
- * Free data structures for report allocated by ftstat_rpt_47_new
- *
- */
-void ftstat_rpt_47_free(struct ftstat_rpt_47 *rpt47)
-{
+  ftchash_first(rpt66->ftch);
 
-  STD_FREE_BUCKET(rpt47);
+  while ((ftch_recprefixh = ftchash_foreach(rpt66->ftch))) {
 
-} /* ftstat_rpt_47_free */
+    if (ftch_recprefixh->etime) {
+      if (rpt->all_fields & FT_STAT_FIELD_PS) {
+        ftch_recprefixh->ps.avg_pps /= (double)ftch_recprefixh->nrecs;
+        ftch_recprefixh->ps.avg_bps /= (double)ftch_recprefixh->nrecs;
+      }
+    }
+
+    if (ftch_recprefixh->hll)
+      ftch_recprefixh->nprefixes = fthll_count(ftch_recprefixh->hll);
+    else
+      ftch_recprefixh->nprefixes = ftch_recprefixh->ftch->entries;
+    rpt->t_count += ftch_recprefixh->nprefixes;
+    
+  }
 
+  return 0;
 
-/* function: ftstat_rpt_48_new
+} /* ftstat_rpt_66_calc */
+
+/* function: ftstat_rpt_66_merge
  *
- * Allocate and initialize data structures for rpt 48.
+ * Merge the counters accumulated by src into rpt66
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_48 *ftstat_rpt_48_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_66_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_HASH(ftstat_rpt_48, rpt48, 65536, ftchash_rec_c32, 4, 65536);
-
-} /* ftstat_rpt_48_new */
+  STD_MERGE_HASH1(ftstat_rpt_66, ftchash_rec_prefixh, chash_prefixh_combine);
 
+} /* ftstat_rpt_66_merge */
 
-/* function: ftstat_rpt_48_accum
+/* function: ftstat_rpt_66_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt66 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_48_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_66_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_48, rpt48, ftchash_rec_c32,
-    ftch_recc32, ftch_recc32p);
-
-  FT_RECGET_SRC_TAG(cur,rec,*fo);
-
-  ftch_recc32.c32 = cur.src_tag;
-
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+  STD_STATE_NONE;
 
-  STD_ACCUM_HASH2(rpt48, ftch_recc32, ftch_recc32p);
-  
-  return 0;
-   
-} /* ftstat_rpt_48_accum */
+} /* ftstat_rpt_66_save */
 
-/* function: ftstat_rpt_48_calc
+/* function: ftstat_rpt_66_load
  *
- * Perform final calculations for rpt48
+ * Merge counters written by ftstat_rpt_66_save() into rpt66
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_48_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_66_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_48, rpt48, ftchash_rec_c32, ftch_recc32);
+  STD_STATE_NONE;
 
-} /* ftstat_rpt_48_calc */
+} /* ftstat_rpt_66_load */
 
-/* function: ftstat_rpt_48_dump
+/* function: ftstat_rpt_66_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_48_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_66_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_48, rpt48, chash_c32_dump, FT_PATH_SYM_TAG,
-    "source-tag", "", "", "", "", "", "");
+  STD_DUMP_HASH0P(ftstat_rpt_66, rpt66, chash_prefixh_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    "ip-source-address", "ip-destination-address-count", "", "", "", "", "");
 
-} /* ftstat_rpt_48_dump */
+} /* ftstat_rpt_66_dump */
 
 
-/* function: ftstat_rpt_48_free
+/* function: ftstat_rpt_66_free
  *
- * Free data structures for report allocated by ftstat_rpt_48_new
+ * Free data structures for report allocated by ftstat_rpt_66_new
  *
  */
-void ftstat_rpt_48_free(struct ftstat_rpt_48 *rpt48)
+void ftstat_rpt_66_free(struct ftstat_rpt_66 *rpt66)
 {
+  struct ftchash_rec_prefixh *ftch_recprefixh;
 
-  STD_FREE_HASH(rpt48);
+  if (rpt66) {
 
-} /* ftstat_rpt_48_free */
+    if (rpt66->ftch) {
 
+      ftchash_first(rpt66->ftch);
 
-/* function: ftstat_rpt_49_new
+      while ((ftch_recprefixh = ftchash_foreach(rpt66->ftch))) {
+
+        if (ftch_recprefixh->ftch)
+          ftchash_free(ftch_recprefixh->ftch);
+
+        if (ftch_recprefixh->hll)
+          fthll_free(ftch_recprefixh->hll);
+
+      }
+
+      ftchash_free(rpt66->ftch);
+
+    }
+
+    free (rpt66);
+
+  }
+
+} /* ftstat_rpt_66_free */
+
+/* function: ftstat_rpt_67_new
  *
- * Allocate and initialize data structures for rpt 49.
+ * Allocate and initialize data structures for rpt 15.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_49 *ftstat_rpt_49_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_67 *ftstat_rpt_67_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_49, rpt49, 65536, ftchash_rec_c32, 4, 65536);
+  STD_NEW_HASH1(ftstat_rpt_67, rpt67, 65536, ftchash_rec_prefixh, 5,
+    65536, 0);
 
-} /* ftstat_rpt_49_new */
+} /* ftstat_rpt_67_new */
 
 
-/* function: ftstat_rpt_49_accum
+/* function: ftstat_rpt_67_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_49_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_67_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
+  struct ftchash_rec_prefixs *ftch_recprefixsp, ftch_recprefixs;
 
-  STD_ACCUM_HASH1(ftstat_rpt_49, rpt49, ftchash_rec_c32,
-    ftch_recc32, ftch_recc32p);
+  STD_ACCUM_HASH1(ftstat_rpt_67, rpt67, ftchash_rec_prefixh, ftch_recprefixh,
+    ftch_recprefixhp);
 
-  FT_RECGET_DST_TAG(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+ 
+  ftch_recprefixh.prefix = cur.dstaddr;
 
-  ftch_recc32.c32 = cur.dst_tag;
-  
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefixh.mask = cur.dst_mask;
+  }
 
-  STD_ACCUM_HASH2(rpt49, ftch_recc32, ftch_recc32p);
-  
-  return 0;
-   
-} /* ftstat_rpt_49_accum */
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefixh.prefix &= ipv4_len2mask(ftch_recprefixh.mask);
 
-/* function: ftstat_rpt_49_calc
- *
- * Perform final calculations for rpt49
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_49_calc(struct ftstat_rpt *rpt)
-{
+  hash = (ftch_recprefixh.prefix>>16) ^ (ftch_recprefixh.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefixh.mask);
 
-  STD_CALC_HASH(ftstat_rpt_49, rpt49, ftchash_rec_c32, ftch_recc32);
+  STD_ACCUM_HASH2(rpt67, ftch_recprefixh, ftch_recprefixhp);
 
-} /* ftstat_rpt_49_calc */
+  FT_RECGET_SRCADDR(cur,rec,*fo);
 
-/* function: ftstat_rpt_49_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_49_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+  bzero(&ftch_recprefixs, sizeof ftch_recprefixs);
+ 
+  ftch_recprefixs.prefix = cur.srcaddr;
 
-  STD_DUMP_HASH1(ftstat_rpt_49, rpt49, chash_c32_dump, FT_PATH_SYM_TAG,
-    "destination-tag", "", "", "", "", "", "");
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefixs.mask = cur.src_mask;
+  }
 
-} /* ftstat_rpt_49_dump */
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefixs.prefix &= ipv4_len2mask(ftch_recprefixs.mask);
 
+  /* estimate only, no second hash */
+  if (rpt->count_estimate) {
 
-/* function: ftstat_rpt_49_free
- *
- * Free data structures for report allocated by ftstat_rpt_49_new
- *
- */
-void ftstat_rpt_49_free(struct ftstat_rpt_49 *rpt49)
-{
+    if (!ftch_recprefixhp->hll) {
+      if (!(ftch_recprefixhp->hll = fthll_new(rpt->count_estimate))) {
+        fterr_warnx("fthll_new(): failed");
+        return -1;
+      }
+    }
 
-  STD_FREE_HASH(rpt49);
+    fthll_add(ftch_recprefixhp->hll,
+      (uint64_t)ftch_recprefixs.prefix << 8 | ftch_recprefixs.mask);
 
-} /* ftstat_rpt_49_free */
+    return 0;
 
+  }
 
-/* function: ftstat_rpt_50_new
+  /* new second hash */
+  if (!ftch_recprefixhp->ftch) {
+    if (!(ftch_recprefixhp->ftch = ftchash_new(256,
+      sizeof (struct ftchash_rec_prefixs), 5, 64))) {
+      fterr_warnx("ftchash_new(): failed");
+      return -1;
+    }
+  }
+
+  hash = (ftch_recprefixs.prefix>>16) ^ (ftch_recprefixs.prefix & 0xFFFF);
+  hash = hash ^ (ftch_recprefixs.mask);
+  hash = (hash >> 8) ^ (hash & 0xFF);
+
+  if (!(ftch_recprefixsp = ftchash_update(ftch_recprefixhp->ftch,
+    &ftch_recprefixs, hash))) {
+    fterr_warnx("ftch_update(): failed");
+    return -1;
+  }
+
+  return 0;
+   
+} /* ftstat_rpt_67_accum */
+
+/* function: ftstat_rpt_67_calc
  *
- * Allocate and initialize data structures for rpt 50.
+ * Perform final calculations for rpt67
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_50 *ftstat_rpt_50_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_67_calc(struct ftstat_rpt *rpt)
 {
+  struct ftchash_rec_prefixh *ftch_recprefixh;
+  struct ftstat_rpt_67 *rpt67;
 
-  STD_NEW_HASH(ftstat_rpt_50, rpt50, 65536, ftchash_rec_c322, 8, 65536);
+  rpt67 = rpt->data;
 
-} /* ftstat_rpt_50_new */
+  STD_CALC;
+
+  rpt->recs = rpt67->ftch->entries;
 
+  ftchash_first(rpt67->ftch);
 
-/* function: ftstat_rpt_50_accum
+  while ((ftch_recprefixh = ftchash_foreach(rpt67->ftch))) {
+
+    if (ftch_recprefixh->etime) {
+      if (rpt->all_fields & FT_STAT_FIELD_PS) {
+        ftch_recprefixh->ps.avg_pps /= (double)ftch_recprefixh->nrecs;
+        ftch_recprefixh->ps.avg_bps /= (double)ftch_recprefixh->nrecs;
+      }
+    }
+
+    if (ftch_recprefixh->hll)
+      ftch_recprefixh->nprefixes = fthll_count(ftch_recprefixh->hll);
+    else
+      ftch_recprefixh->nprefixes = ftch_recprefixh->ftch->entries;
+    rpt->t_count += ftch_recprefixh->nprefixes;
+    
+  }
+
+  return 0;
+
+} /* ftstat_rpt_67_calc */
+
+/* function: ftstat_rpt_67_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt67
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_50_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_67_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_50, rpt50, ftchash_rec_c322,
-    ftch_recc322, ftch_recc322p);
-
-  FT_RECGET_DST_TAG(cur,rec,*fo);
-  FT_RECGET_SRC_TAG(cur,rec,*fo);
- 
-  ftch_recc322.c32a = cur.src_tag;
-  ftch_recc322.c32b = cur.dst_tag;
-
-  hash = (ftch_recc322.c32a>>16) ^ (ftch_recc322.c32a & 0xFFFF) ^
-    (ftch_recc322.c32b>>16) ^ (ftch_recc322.c32b & 0xFFFF);
-
-  STD_ACCUM_HASH2(rpt50, ftch_recc322, ftch_recc322p);
+  STD_MERGE_HASH1(ftstat_rpt_67, ftchash_rec_prefixh, chash_prefixh_combine);
 
-  return 0;
-   
-} /* ftstat_rpt_50_accum */
+} /* ftstat_rpt_67_merge */
 
-/* function: ftstat_rpt_50_calc
+/* function: ftstat_rpt_67_save
  *
- * Perform final calculations for rpt50
+ * Write the counters of rpt67 to fp
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_50_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_67_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_50, rpt50, ftchash_rec_c322, ftch_recc322);
+  STD_STATE_NONE;
 
-} /* ftstat_rpt_50_calc */
+} /* ftstat_rpt_67_save */
 
-/* function: ftstat_rpt_50_dump
+/* function: ftstat_rpt_67_load
  *
- * Dump data for report.
+ * Merge counters written by ftstat_rpt_67_save() into rpt67
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_50_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_67_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_50, rpt50, chash_c322_dump,
-    FT_PATH_SYM_TAG, FT_PATH_SYM_TAG,
-    "", "source-tag", "destination-tag", "", "", "", "");
-
-} /* ftstat_rpt_50_dump */
+  STD_STATE_NONE;
 
+} /* ftstat_rpt_67_load */
 
-/* function: ftstat_rpt_50_free
+/* function: ftstat_rpt_67_dump
  *
- * Free data structures for report allocated by ftstat_rpt_50_new
+ * Dump data for report.
  *
  */
-void ftstat_rpt_50_free(struct ftstat_rpt_50 *rpt50)
+int ftstat_rpt_67_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_FREE_HASH(rpt50);
-
-} /* ftstat_rpt_50_free */
+  STD_DUMP_HASH0P(ftstat_rpt_67, rpt67, chash_prefixh_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    "ip-destination-address", "ip-source-address-count", "", "", "", "", "");
 
-/* function: ftstat_rpt_51_new
- * 
- * Allocate and initialize data structures for rpt 51.
- * 
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_51 *ftstat_rpt_51_new(struct ftstat_rpt *rpt)
-{
-  
-  STD_NEW_HASH(ftstat_rpt_51, rpt51, 65536, ftchash_rec_prefix16, 8, 65536);
+} /* ftstat_rpt_67_dump */
 
-} /* ftstat_rpt_51_new */
 
-/* function: ftstat_rpt_51_accum
+/* function: ftstat_rpt_67_free
  *
- * Accumulate counters for report by processing flow.
+ * Free data structures for report allocated by ftstat_rpt_67_new
  *
- * returns 0: ok
- *        !0: error
  */
-int ftstat_rpt_51_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+void ftstat_rpt_67_free(struct ftstat_rpt_67 *rpt67)
 {
+  struct ftchash_rec_prefixh *ftch_recprefixh;
 
-  STD_ACCUM_HASH1(ftstat_rpt_51, rpt51, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_prefix16p);
+  if (rpt67) {
 
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
+    if (rpt67->ftch) {
 
-  ftch_recprefix16.prefix = cur.srcaddr;
-  ftch_recprefix16.c16 = cur.srcport;
+      ftchash_first(rpt67->ftch);
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.src_mask;
-  }
- 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
-  
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+      while ((ftch_recprefixh = ftchash_foreach(rpt67->ftch))) {
 
-  STD_ACCUM_HASH2(rpt51, ftch_recprefix16, ftch_prefix16p);
-   
-  return 0;
-   
-} /* ftstat_rpt_51_accum */
+        if (ftch_recprefixh->ftch)
+          ftchash_free(ftch_recprefixh->ftch);
 
-/* function: ftstat_rpt_51_calc
- *
- * Perform final calculations for rpt51
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_51_calc(struct ftstat_rpt *rpt)
-{
+        if (ftch_recprefixh->hll)
+          fthll_free(ftch_recprefixh->hll);
 
-  STD_CALC_HASH(ftstat_rpt_51, rpt51, ftchash_rec_prefix16, ftch_recprefix16); 
- 
-} /* ftstat_rpt_51_calc */
+      }
 
-/* function: ftstat_rpt_51_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_51_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+      ftchash_free(rpt67->ftch);
 
-  STD_DUMP_HASH1P(ftstat_rpt_51, rpt51, chash_prefix16_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-address", "ip-source-port", "", "", "", "");
- 
-} /* ftstat_rpt_51_dump */
+    }
 
-/* function: ftstat_rpt_51_free
- *
- * Free data structures for report allocated by ftstat_rpt_51_new
- *
- */
-void ftstat_rpt_51_free(struct ftstat_rpt_51 *rpt51)
-{ 
- 
-  STD_FREE_HASH(rpt51);
-   
-} /* ftstat_rpt_51_free */
+    free (rpt67);
+
+  }
+
+} /* ftstat_rpt_67_free */
 
 
-/* function: ftstat_rpt_52_new
+/* function: ftstat_rpt_68_new
  * 
- * Allocate and initialize data structures for rpt 52.
+ * Allocate and initialize data structures for rpt 68.
  * 
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_52 *ftstat_rpt_52_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_68 *ftstat_rpt_68_new(struct ftstat_rpt *rpt)
 {
   
-  STD_NEW_HASH(ftstat_rpt_52, rpt52, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_NEW_HASH(ftstat_rpt_68, rpt68, 65536, ftchash_rec_flow1, 16, 65536);
 
-} /* ftstat_rpt_52_new */
+} /* ftstat_rpt_68_new */
 
-/* function: ftstat_rpt_52_accum
+/* function: ftstat_rpt_68_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_52_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_68_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_52, rpt52, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_prefix16p);
-    
+  STD_ACCUM_HASH1(ftstat_rpt_68, rpt68, ftchash_rec_flow1,
+    ftch_recflow1, ftch_recflow1p);
+ 
+  FT_RECGET_SRCPORT(cur,rec,*fo);
   FT_RECGET_DSTPORT(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  FT_RECGET_TOS(cur,rec,*fo);
+  FT_RECGET_PROT(cur,rec,*fo);
+  
+  ftch_recflow1.src_prefix = cur.srcaddr;
+  ftch_recflow1.dst_prefix = cur.dstaddr;
+  ftch_recflow1.src_port = cur.srcport;
+  ftch_recflow1.dst_port = cur.dstport;
+  ftch_recflow1.tos = cur.tos;
+  ftch_recflow1.prot = cur.prot;
   
-  ftch_recprefix16.prefix = cur.srcaddr;
-  ftch_recprefix16.c16 = cur.dstport;
-
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.src_mask;
+    ftch_recflow1.src_mask = cur.src_mask;
   }
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
-    
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
-
-  STD_ACCUM_HASH2(rpt52, ftch_recprefix16, ftch_prefix16p);
-
-  return 0;
-   
-} /* ftstat_rpt_52_accum */
-
-/* function: ftstat_rpt_52_calc
- *
- * Perform final calculations for rpt52
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_52_calc(struct ftstat_rpt *rpt)
-{
-
-  STD_CALC_HASH(ftstat_rpt_52, rpt52, ftchash_rec_prefix16, ftch_recprefix16);
- 
-} /* ftstat_rpt_52_calc */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recflow1.dst_mask = cur.dst_mask;
+  }
 
-/* function: ftstat_rpt_52_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_52_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recflow1.src_prefix &= ipv4_len2mask(ftch_recflow1.src_mask);
+  }
 
-  STD_DUMP_HASH1P(ftstat_rpt_51, rpt51, chash_prefix16_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-address", "ip-destination-port", "", "", "", "");
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recflow1.dst_prefix &= ipv4_len2mask(ftch_recflow1.dst_mask);
+  }
+  
+  hash = (ftch_recflow1.src_prefix>>16)^
+          (ftch_recflow1.src_prefix & 0xFFFF)^
+          (ftch_recflow1.dst_prefix>>16)^
+          (ftch_recflow1.dst_prefix & 0xFFFF)^
+          (ftch_recflow1.src_port)^
+          (ftch_recflow1.dst_port)^
+          (ftch_recflow1.src_mask)^
+          (ftch_recflow1.tos)^
+          (ftch_recflow1.prot)^
+          (uint32_t)(ftch_recflow1.dst_mask<<8);
 
-} /* ftstat_rpt_52_dump */
+  STD_ACCUM_HASH2(rpt68, ftch_recflow1, ftch_recflow1p);
 
-/* function: ftstat_rpt_52_free
- *
- * Free data structures for report allocated by ftstat_rpt_52_new
- *
- */
-void ftstat_rpt_52_free(struct ftstat_rpt_52 *rpt52)
-{ 
- 
-  STD_FREE_HASH(rpt52);
+  return 0;
    
-} /* ftstat_rpt_52_free */
-
-/* function: ftstat_rpt_53_new
- * 
- * Allocate and initialize data structures for rpt 53.
- * 
+} /* ftstat_rpt_68_accum */
+
+/* function: ftstat_rpt_68_calc
+ *
+ * Perform final calculations for rpt68
+ *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_53 *ftstat_rpt_53_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_68_calc(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_53, rpt53, 65536, ftchash_rec_prefix16, 8, 65536);
 
-} /* ftstat_rpt_53_new */
+  STD_CALC_HASH(ftstat_rpt_68, rpt68, ftchash_rec_flow1,
+    ftch_recflow1);
+ 
+} /* ftstat_rpt_68_calc */
 
-/* function: ftstat_rpt_53_accum
+/* function: ftstat_rpt_68_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt68
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_53_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_68_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_53, rpt53, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_prefix16p);
-    
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  
-  ftch_recprefix16.prefix = cur.dstaddr;
-  ftch_recprefix16.c16 = cur.srcport;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.dst_mask;
-  }
+  STD_MERGE_HASH(ftstat_rpt_68, ftchash_rec_flow1);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+} /* ftstat_rpt_68_merge */
 
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+/* function: ftstat_rpt_68_save
+ *
+ * Write the counters of rpt68 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_68_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  STD_ACCUM_HASH2(rpt53, ftch_recprefix16, ftch_prefix16p);
+  STD_SAVE_HASH(ftstat_rpt_68, ftchash_rec_flow1);
 
-  return 0;
-   
-} /* ftstat_rpt_53_accum */
+} /* ftstat_rpt_68_save */
 
-/* function: ftstat_rpt_53_calc
+/* function: ftstat_rpt_68_load
  *
- * Perform final calculations for rpt53
+ * Merge counters written by ftstat_rpt_68_save() into rpt68
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_53_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_68_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_53, rpt53, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_LOAD_HASH(ftstat_rpt_68, ftchash_rec_flow1);
 
-} /* ftstat_rpt_53_calc */
+} /* ftstat_rpt_68_load */
 
-/* function: ftstat_rpt_53_dump
+/* function: ftstat_rpt_68_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_53_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_68_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_53, rpt53, chash_prefix16_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    FT_PATH_SYM_TCP_PORT,
-    "", "ip-destination-address", "ip-source-port", "", "", "", "");
+  STD_DUMP_HASH2(ftstat_rpt_68, rpt68, chash_flow1_dump,
+    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_IP_PROT,
+    "", "ip-source-address", "ip-destination-address", "ip-source-port",
+    "ip-destination-port", "ip-protocol", "ip-tos");
 
-} /* ftstat_rpt_53_dump */
+} /* ftstat_rpt_68_dump */
 
-/* function: ftstat_rpt_53_free
+/* function: ftstat_rpt_68_free
  *
- * Free data structures for report allocated by ftstat_rpt_53_new
+ * Free data structures for report allocated by ftstat_rpt_68_new
  *
  */
-void ftstat_rpt_53_free(struct ftstat_rpt_53 *rpt53)
+void ftstat_rpt_68_free(struct ftstat_rpt_68 *rpt68)
 { 
  
-  STD_FREE_HASH(rpt53);
+  STD_FREE_HASH(rpt68);
    
-} /* ftstat_rpt_53_free */
-
+} /* ftstat_rpt_68_free */
 
-/* function: ftstat_rpt_54_new
+/* function: ftstat_rpt_69_new
  * 
- * Allocate and initialize data structures for rpt 52.
+ * Allocate and initialize data structures for rpt 69.
  * 
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_54 *ftstat_rpt_54_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_69 *ftstat_rpt_69_new(struct ftstat_rpt *rpt)
 {
   
-  STD_NEW_HASH(ftstat_rpt_54, rpt54, 65536, ftchash_rec_prefix16, 8, 65536);
+  STD_NEW_HASH(ftstat_rpt_69, rpt69, 65536, ftchash_rec_flow1, 16, 65536);
 
-} /* ftstat_rpt_54_new */
+} /* ftstat_rpt_69_new */
 
-/* function: ftstat_rpt_54_accum
+/* function: ftstat_rpt_69_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_54_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_69_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_54, rpt54, ftchash_rec_prefix16, ftch_recprefix16,
-    ftch_prefix16p);
-    
-  FT_RECGET_DSTPORT(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_69, rpt69, ftchash_rec_flow1,
+    ftch_recflow1, ftch_recflow1p);
+ 
+  FT_RECGET_SRCADDR(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
+  FT_RECGET_TOS(cur,rec,*fo);
+  FT_RECGET_PROT(cur,rec,*fo);
+  
+  ftch_recflow1.src_prefix = cur.srcaddr;
+  ftch_recflow1.dst_prefix = cur.dstaddr;
+  ftch_recflow1.tos = cur.tos;
+  ftch_recflow1.prot = cur.prot;
   
-  ftch_recprefix16.prefix = cur.dstaddr;
-  ftch_recprefix16.c16 = cur.dstport;
-
   /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recflow1.src_mask = cur.src_mask;
+  }
+
   if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
     FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix16.mask = cur.dst_mask;
+    ftch_recflow1.dst_mask = cur.dst_mask;
   }
 
   /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix16.prefix &= ipv4_len2mask(ftch_recprefix16.mask);
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
+    ftch_recflow1.src_prefix &= ipv4_len2mask(ftch_recflow1.src_mask);
+  }
 
-  hash = (ftch_recprefix16.prefix>>16) ^ (ftch_recprefix16.prefix & 0xFFFF) ^
-    (ftch_recprefix16.mask) ^ (ftch_recprefix16.c16);
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
+    ftch_recflow1.dst_prefix &= ipv4_len2mask(ftch_recflow1.dst_mask);
+  }
+  
+  hash = (ftch_recflow1.src_prefix>>16)^
+          (ftch_recflow1.src_prefix & 0xFFFF)^
+          (ftch_recflow1.dst_prefix>>16)^
+          (ftch_recflow1.dst_prefix & 0xFFFF)^
+          (ftch_recflow1.src_mask)^
+          (ftch_recflow1.tos)^
+          (ftch_recflow1.prot)^
+          (uint32_t)(ftch_recflow1.dst_mask<<8);
 
-  STD_ACCUM_HASH2(rpt54, ftch_recprefix16, ftch_prefix16p);
+  STD_ACCUM_HASH2(rpt69, ftch_recflow1, ftch_recflow1p);
 
   return 0;
    
-} /* ftstat_rpt_54_accum */
+} /* ftstat_rpt_69_accum */
 
-/* function: ftstat_rpt_54_calc
+/* function: ftstat_rpt_69_calc
  *
- * Perform final calculations for rpt54
+ * Perform final calculations for rpt69
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_54_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_69_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_54, rpt54, ftchash_rec_prefix16, ftch_recprefix16);
+  STD_CALC_HASH(ftstat_rpt_69, rpt69, ftchash_rec_flow1,
+    ftch_recflow1);
  
-} /* ftstat_rpt_54_calc */
+} /* ftstat_rpt_69_calc */
 
-/* function: ftstat_rpt_54_dump
+/* function: ftstat_rpt_69_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt69
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_54_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_69_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH1P(ftstat_rpt_54, rpt54, chash_prefix16_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    FT_PATH_SYM_TCP_PORT,
-    "", "ip-destination-address", "ip-destination-port", "", "", "", "");
-
-} /* ftstat_rpt_54_dump */
-
-/* function: ftstat_rpt_54_free
- *
- * Free data structures for report allocated by ftstat_rpt_54_new
- *
- */
-void ftstat_rpt_54_free(struct ftstat_rpt_54 *rpt54)
-{ 
- 
-  STD_FREE_HASH(rpt54);
-   
-} /* ftstat_rpt_54_free */
-
-
-/* function: ftstat_rpt_55_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_55 *ftstat_rpt_55_new(struct ftstat_rpt *rpt)
-{
-  
-  STD_NEW_HASH(ftstat_rpt_55, rpt55, 65536, ftchash_rec_prefix162, 10, 65536);
+  STD_MERGE_HASH(ftstat_rpt_69, ftchash_rec_flow1);
 
-} /* ftstat_rpt_55_new */
+} /* ftstat_rpt_69_merge */
 
-/* function: ftstat_rpt_55_accum
+/* function: ftstat_rpt_69_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt69 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_55_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_69_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_55, rpt55, ftchash_rec_prefix162,
-    ftch_recprefix162, ftch_prefix162p);
-    
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  
-  ftch_recprefix162.prefix = cur.srcaddr;
-  ftch_recprefix162.c16a = cur.srcport;
-  ftch_recprefix162.c16b = cur.dstport;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix162.mask = cur.src_mask;
-  }
-
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
-
-  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
-    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^ 
-    (ftch_recprefix162.c16b);
-
-  STD_ACCUM_HASH2(rpt55, ftch_recprefix162, ftch_prefix162p);
+  STD_SAVE_HASH(ftstat_rpt_69, ftchash_rec_flow1);
 
-  return 0;
-   
-} /* ftstat_rpt_55_accum */
+} /* ftstat_rpt_69_save */
 
-/* function: ftstat_rpt_55_calc
+/* function: ftstat_rpt_69_load
  *
- * Perform final calculations for rpt55
+ * Merge counters written by ftstat_rpt_69_save() into rpt69
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_55_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_69_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_55, rpt55, ftchash_rec_prefix162,
-    ftch_recprefix162);
- 
-} /* ftstat_rpt_55_calc */
+  STD_LOAD_HASH(ftstat_rpt_69, ftchash_rec_flow1);
 
-/* function: ftstat_rpt_55_dump
+} /* ftstat_rpt_69_load */
+
+/* function: ftstat_rpt_69_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_55_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_69_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH2P(ftstat_rpt_55, rpt55, chash_prefix162_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-address", "ip-source-port", "ip-destination-port", "", "",
-    "");
- 
-} /* ftstat_rpt_55_dump */
+  STD_DUMP_HASH1(ftstat_rpt_69, rpt69, chash_flow12_dump,
+    FT_PATH_SYM_IP_PROT,
+    "", "ip-source-address", "ip-destination-address", "ip-protocol",
+    "ip-tos", "", "");
 
-/* function: ftstat_rpt_55_free
+} /* ftstat_rpt_69_dump */
+
+/* function: ftstat_rpt_69_free
  *
- * Free data structures for report allocated by ftstat_rpt_55_new
+ * Free data structures for report allocated by ftstat_rpt_69_new
  *
  */
-void ftstat_rpt_55_free(struct ftstat_rpt_55 *rpt55)
+void ftstat_rpt_69_free(struct ftstat_rpt_69 *rpt69)
 { 
  
-  STD_FREE_HASH(rpt55);
+  STD_FREE_HASH(rpt69);
    
-} /* ftstat_rpt_55_free */
-
+} /* ftstat_rpt_69_free */
 
-/* function: ftstat_rpt_56_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
+/* function: ftstat_rpt_70_new
+ *
+ * Allocate and initialize data structures for rpt 70.
+ *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_56 *ftstat_rpt_56_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_70 *ftstat_rpt_70_new(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_56, rpt56, 65536, ftchash_rec_prefix162, 10, 65536);
 
-} /* ftstat_rpt_56_new */
+  STD_NEW_HASH(ftstat_rpt_70, rpt70, 65536, ftchash_rec_prefix_tag, 12, 65536);
 
-/* function: ftstat_rpt_56_accum
+} /* ftstat_rpt_70_new */
+
+
+/* function: ftstat_rpt_70_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_56_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_70_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_56, rpt56, ftchash_rec_prefix162,
-    ftch_recprefix162, ftch_prefix162p);
+  STD_ACCUM_HASH1(ftstat_rpt_70, rpt70, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag, ftch_recprefix_tagp);
 
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-    
-  ftch_recprefix162.prefix = cur.dstaddr;
-  ftch_recprefix162.c16a = cur.srcport;
-  ftch_recprefix162.c16b = cur.dstport;
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_SRC_TAG(cur,rec,*fo);
+ 
+  ftch_recprefix_tag.prefix = cur.srcaddr;
+  ftch_recprefix_tag.tag = cur.src_tag;
 
   /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix162.mask = cur.dst_mask; 
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix_tag.mask = cur.src_mask;
   }
 
   /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
-    
-  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
-    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
-    (ftch_recprefix162.c16b);   
-  
-  STD_ACCUM_HASH2(rpt56, ftch_recprefix162, ftch_prefix162p);
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
+
+  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
+    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
+    (ftch_recprefix_tag.mask);
+
+  STD_ACCUM_HASH2(rpt70, ftch_recprefix_tag, ftch_recprefix_tagp);
 
   return 0;
    
-} /* ftstat_rpt_56_accum */
+} /* ftstat_rpt_70_accum */
 
-/* function: ftstat_rpt_56_calc
+/* function: ftstat_rpt_70_calc
  *
- * Perform final calculations for rpt56
+ * Perform final calculations for rpt70
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_56_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_70_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_56, rpt56, ftchash_rec_prefix162,
-    ftch_recprefix162);
- 
-} /* ftstat_rpt_56_calc */
+  STD_CALC_HASH(ftstat_rpt_70, rpt70, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag);
 
-/* function: ftstat_rpt_56_dump
+} /* ftstat_rpt_70_calc */
+
+/* function: ftstat_rpt_70_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt70
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_56_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_70_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH2P(ftstat_rpt_56, rpt56, chash_prefix162_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
-    "", "ip-destination-address", "ip-source-port", "ip-destination-port", "",
-    "", "");
+  STD_MERGE_HASH(ftstat_rpt_70, ftchash_rec_prefix_tag);
 
-} /* ftstat_rpt_56_dump */
+} /* ftstat_rpt_70_merge */
 
-/* function: ftstat_rpt_56_free
+/* function: ftstat_rpt_70_save
  *
- * Free data structures for report allocated by ftstat_rpt_56_new
+ * Write the counters of rpt70 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_56_free(struct ftstat_rpt_56 *rpt56)
-{ 
- 
-  STD_FREE_HASH(rpt56);
-   
-} /* ftstat_rpt_56_free */
-
-
-/* function: ftstat_rpt_57_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_57 *ftstat_rpt_57_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_70_save(struct ftstat_rpt *rpt, FILE *fp)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_57, rpt57, 65536, ftchash_rec_prefix216, 13, 65536);
 
-} /* ftstat_rpt_57_new */
+  STD_SAVE_HASH(ftstat_rpt_70, ftchash_rec_prefix_tag);
 
-/* function: ftstat_rpt_57_accum
+} /* ftstat_rpt_70_save */
+
+/* function: ftstat_rpt_70_load
  *
- * Accumulate counters for report by processing flow.
+ * Merge counters written by ftstat_rpt_70_save() into rpt70
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_57_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_70_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_57, rpt57, ftchash_rec_prefix216,
-    ftch_recprefix216, ftch_recprefix216p);
- 
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
+  STD_LOAD_HASH(ftstat_rpt_70, ftchash_rec_prefix_tag);
 
-  ftch_recprefix216.src_prefix = cur.srcaddr;
-  ftch_recprefix216.dst_prefix = cur.dstaddr;
-  ftch_recprefix216.c16 = cur.srcport;
-  
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix216.src_mask = cur.src_mask;
-  }
+} /* ftstat_rpt_70_load */
 
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix216.dst_mask = cur.dst_mask;
-  }
-  
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
-  }
+/* function: ftstat_rpt_70_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_70_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
-  }
-  
-  hash = (ftch_recprefix216.src_prefix>>16)^
-          (ftch_recprefix216.src_prefix & 0xFFFF)^
-          (ftch_recprefix216.dst_prefix>>16)^
-          (ftch_recprefix216.dst_prefix & 0xFFFF)^
-          (ftch_recprefix216.c16)^
-          (ftch_recprefix216.src_mask)^
-          (uint32_t)(ftch_recprefix216.dst_mask<<8);
- 
-  STD_ACCUM_HASH2(rpt57, ftch_recprefix216, ftch_recprefix216p);
+  STD_DUMP_HASH1P(ftstat_rpt_70, rpt70, chash_prefix_tag_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_TAG,
+    "", "ip-source-address", "source-tag", "", "", "", "");
 
-  return 0;
-   
-} /* ftstat_rpt_57_accum */
+} /* ftstat_rpt_70_dump */
 
-/* function: ftstat_rpt_57_calc
+
+/* function: ftstat_rpt_70_free
  *
- * Perform final calculations for rpt57
+ * Free data structures for report allocated by ftstat_rpt_70_new
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_57_calc(struct ftstat_rpt *rpt)
+void ftstat_rpt_70_free(struct ftstat_rpt_70 *rpt70)
 {
 
-  STD_CALC_HASH(ftstat_rpt_57, rpt57, ftchash_rec_prefix216,
-    ftch_recprefix216);
+  STD_FREE_HASH(rpt70);
 
-} /* ftstat_rpt_57_calc */
+} /* ftstat_rpt_70_free */
 
-/* function: ftstat_rpt_57_dump
+
+/* function: ftstat_rpt_71_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 71.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_57_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_71 *ftstat_rpt_71_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_57, rpt57, chash_prefix216_dump,
-    FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-address", "ip-destination-address", "ip-source-port", "",
-    "", "");
+  STD_NEW_HASH(ftstat_rpt_71, rpt71, 65536, ftchash_rec_prefix_tag, 12, 65536);
 
-} /* ftstat_rpt_57_dump */
+} /* ftstat_rpt_71_new */
 
-/* function: ftstat_rpt_57_free
+
+/* function: ftstat_rpt_71_accum
  *
- * Free data structures for report allocated by ftstat_rpt_57_new
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_57_free(struct ftstat_rpt_57 *rpt57)
-{ 
+int ftstat_rpt_71_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
+
+  STD_ACCUM_HASH1(ftstat_rpt_71, rpt71, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag, ftch_recprefix_tagp);
+
+  FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DST_TAG(cur,rec,*fo);
  
-  STD_FREE_HASH(rpt57);
+  ftch_recprefix_tag.prefix = cur.srcaddr;
+  ftch_recprefix_tag.tag = cur.dst_tag;
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
+    FT_RECGET_SRC_MASK(cur,rec,*fo);
+    ftch_recprefix_tag.mask = cur.src_mask;
+  }
+
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
+
+  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
+    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
+    (ftch_recprefix_tag.mask);
+
+  STD_ACCUM_HASH2(rpt71, ftch_recprefix_tag, ftch_recprefix_tagp);
+
+  return 0;
    
-} /* ftstat_rpt_57_free */
+} /* ftstat_rpt_71_accum */
 
-/* function: ftstat_rpt_58_new
- * 
- * Allocate and initialize data structures for rpt 58.
- * 
+/* function: ftstat_rpt_71_calc
+ *
+ * Perform final calculations for rpt71
+ *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_58 *ftstat_rpt_58_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_71_calc(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_58, rpt58, 65536, ftchash_rec_prefix216, 13, 65536);
 
-} /* ftstat_rpt_58_new */
+  STD_CALC_HASH(ftstat_rpt_71, rpt71, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag);
+
+} /* ftstat_rpt_71_calc */
 
-/* function: ftstat_rpt_58_accum
+/* function: ftstat_rpt_71_merge
  *
- * Accumulate counters for report by processing flow.
+ * Merge the counters accumulated by src into rpt71
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_58_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_71_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_58, rpt58, ftchash_rec_prefix216,
-    ftch_recprefix216, ftch_recprefix216p);
-
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-
-  ftch_recprefix216.src_prefix = cur.srcaddr;
-  ftch_recprefix216.dst_prefix = cur.dstaddr;
-  ftch_recprefix216.c16 = cur.dstport;
- 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix216.src_mask = cur.src_mask;
-  }
-
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix216.dst_mask = cur.dst_mask;
-  }
+  STD_MERGE_HASH(ftstat_rpt_71, ftchash_rec_prefix_tag);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix216.src_prefix &= ipv4_len2mask(ftch_recprefix216.src_mask);
-  }
+} /* ftstat_rpt_71_merge */
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix216.dst_prefix &= ipv4_len2mask(ftch_recprefix216.dst_mask);
-  }
+/* function: ftstat_rpt_71_save
+ *
+ * Write the counters of rpt71 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_71_save(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  hash = (ftch_recprefix216.src_prefix>>16)^
-          (ftch_recprefix216.src_prefix & 0xFFFF)^
-          (ftch_recprefix216.dst_prefix>>16)^
-          (ftch_recprefix216.dst_prefix & 0xFFFF)^
-          (ftch_recprefix216.c16)^
-          (ftch_recprefix216.src_mask)^
-          (uint32_t)(ftch_recprefix216.dst_mask<<8);
-  
-  STD_ACCUM_HASH2(rpt58, ftch_recprefix216, ftch_recprefix216p);
+  STD_SAVE_HASH(ftstat_rpt_71, ftchash_rec_prefix_tag);
 
-  return 0;
-   
-} /* ftstat_rpt_58_accum */
+} /* ftstat_rpt_71_save */
 
-/* function: ftstat_rpt_58_calc
+/* function: ftstat_rpt_71_load
  *
- * Perform final calculations for rpt58
+ * Merge counters written by ftstat_rpt_71_save() into rpt71
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_58_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_71_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_HASH(ftstat_rpt_58, rpt58, ftchash_rec_prefix216,
-    ftch_recprefix216);
+  STD_LOAD_HASH(ftstat_rpt_71, ftchash_rec_prefix_tag);
 
-} /* ftstat_rpt_58_calc */
+} /* ftstat_rpt_71_load */
 
-/* function: ftstat_rpt_58_dump
+/* function: ftstat_rpt_71_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_58_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_71_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH1(ftstat_rpt_58, rpt58, chash_prefix216_dump,
-    FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-address", "ip-destination-address", "ip-destination-port",
-    "", "", "");
+  STD_DUMP_HASH1P(ftstat_rpt_71, rpt71, chash_prefix_tag_dump,
+    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
+    FT_PATH_SYM_TAG,
+    "", "ip-source-address", "destination-tag", "", "", "", "");
 
-} /* ftstat_rpt_58_dump */
+} /* ftstat_rpt_71_dump */
 
-/* function: ftstat_rpt_58_free
+
+/* function: ftstat_rpt_71_free
  *
- * Free data structures for report allocated by ftstat_rpt_58_new
+ * Free data structures for report allocated by ftstat_rpt_71_new
  *
  */
-void ftstat_rpt_58_free(struct ftstat_rpt_58 *rpt58)
-{ 
- 
-  STD_FREE_HASH(rpt58);
-   
-} /* ftstat_rpt_58_free */
+void ftstat_rpt_71_free(struct ftstat_rpt_71 *rpt71)
+{
 
+  STD_FREE_HASH(rpt71);
 
+} /* ftstat_rpt_71_free */
 
-/* function: ftstat_rpt_59_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
+/* function: ftstat_rpt_72_new
+ *
+ * Allocate and initialize data structures for rpt 72.
+ *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_59 *ftstat_rpt_59_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_72 *ftstat_rpt_72_new(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_59, rpt59, 65536, ftchash_rec_prefix2162, 16, 65536);
 
-} /* ftstat_rpt_59_new */
+  STD_NEW_HASH(ftstat_rpt_72, rpt72, 65536, ftchash_rec_prefix_tag, 12, 65536);
 
-/* function: ftstat_rpt_59_accum
+} /* ftstat_rpt_72_new */
+
+
+/* function: ftstat_rpt_72_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_59_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_72_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_59, rpt59, ftchash_rec_prefix2162,
-    ftch_recprefix2162, ftch_recprefix2162p);
- 
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
+  STD_ACCUM_HASH1(ftstat_rpt_72, rpt72, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag, ftch_recprefix_tagp);
+
   FT_RECGET_DSTADDR(cur,rec,*fo);
-  
-  ftch_recprefix2162.src_prefix = cur.srcaddr;
-  ftch_recprefix2162.dst_prefix = cur.dstaddr;
-  ftch_recprefix2162.c16a = cur.srcport;
-  ftch_recprefix2162.c16b = cur.dstport;
-  
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix2162.src_mask = cur.src_mask;
-  }
+  FT_RECGET_SRC_TAG(cur,rec,*fo);
+ 
+  ftch_recprefix_tag.prefix = cur.dstaddr;
+  ftch_recprefix_tag.tag = cur.src_tag;
 
+  /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
     FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix2162.dst_mask = cur.dst_mask;
+    ftch_recprefix_tag.mask = cur.dst_mask;
   }
 
   /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recprefix2162.src_prefix &= ipv4_len2mask(ftch_recprefix2162.src_mask);
-  }
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recprefix2162.dst_prefix &= ipv4_len2mask(ftch_recprefix2162.dst_mask);
-  }
-  
-  hash = (ftch_recprefix2162.src_prefix>>16)^
-          (ftch_recprefix2162.src_prefix & 0xFFFF)^
-          (ftch_recprefix2162.dst_prefix>>16)^
-          (ftch_recprefix2162.dst_prefix & 0xFFFF)^
-          (ftch_recprefix2162.c16b)^
-          (ftch_recprefix2162.c16a)^
-          (ftch_recprefix2162.src_mask)^
-          (uint32_t)(ftch_recprefix2162.dst_mask<<8);
+  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
+    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
+    (ftch_recprefix_tag.mask);
 
-  STD_ACCUM_HASH2(rpt59, ftch_recprefix2162, ftch_recprefix2162p);
+  STD_ACCUM_HASH2(rpt72, ftch_recprefix_tag, ftch_recprefix_tagp);
 
   return 0;
    
-} /* ftstat_rpt_59_accum */
+} /* ftstat_rpt_72_accum */
 
-/* function: ftstat_rpt_59_calc
+/* function: ftstat_rpt_72_calc
  *
- * Perform final calculations for rpt59
+ * Perform final calculations for rpt72
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_59_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_72_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_59, rpt59, ftchash_rec_prefix2162,
-    ftch_recprefix2162);
- 
-} /* ftstat_rpt_59_calc */
+  STD_CALC_HASH(ftstat_rpt_72, rpt72, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag);
 
-/* function: ftstat_rpt_59_dump
+} /* ftstat_rpt_72_calc */
+
+/* function: ftstat_rpt_72_merge
  *
- * Dump data for report.
+ * Merge the counters accumulated by src into rpt72
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_59_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_72_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_DUMP_HASH2(ftstat_rpt_31, rpt31, chash_prefix2162_dump,
-    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_TCP_PORT,
-    "", "ip-source-address", "ip-destination-address", "ip-source-port",
-    "ip-destination-port", "", "");
+  STD_MERGE_HASH(ftstat_rpt_72, ftchash_rec_prefix_tag);
 
-} /* ftstat_rpt_59_dump */
+} /* ftstat_rpt_72_merge */
 
-/* function: ftstat_rpt_59_free
+/* function: ftstat_rpt_72_save
  *
- * Free data structures for report allocated by ftstat_rpt_59_new
+ * Write the counters of rpt72 to fp
  *
+ * returns 0: ok
+ *        !0: error
  */
-void ftstat_rpt_59_free(struct ftstat_rpt_59 *rpt59)
-{ 
- 
-  STD_FREE_HASH(rpt59);
-   
-} /* ftstat_rpt_59_free */
-
-
-/* function: ftstat_rpt_60_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_60 *ftstat_rpt_60_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_72_save(struct ftstat_rpt *rpt, FILE *fp)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_60, rpt60, 65536, ftchash_rec_prefix162, 10, 65536);
 
-} /* ftstat_rpt_60_new */
+  STD_SAVE_HASH(ftstat_rpt_72, ftchash_rec_prefix_tag);
 
-/* function: ftstat_rpt_60_accum
+} /* ftstat_rpt_72_save */
+
+/* function: ftstat_rpt_72_load
  *
- * Accumulate counters for report by processing flow.
+ * Merge counters written by ftstat_rpt_72_save() into rpt72
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_60_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_72_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_60, rpt60, ftchash_rec_prefix162,
-    ftch_recprefix162, ftch_prefix162p);
-
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_OUTPUT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  
-  ftch_recprefix162.prefix = cur.srcaddr;
-  ftch_recprefix162.c16a = cur.input;
-  ftch_recprefix162.c16b = cur.output;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix162.mask = cur.src_mask; 
-  }
-
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
- 
-  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
-    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
-    (ftch_recprefix162.c16b);   
-   
-  STD_ACCUM_HASH2(rpt60, ftch_recprefix162, ftch_prefix162p);
+  STD_LOAD_HASH(ftstat_rpt_72, ftchash_rec_prefix_tag);
 
-  return 0;
-   
-} /* ftstat_rpt_60_accum */
+} /* ftstat_rpt_72_load */
 
-/* function: ftstat_rpt_60_calc
+/* function: ftstat_rpt_72_dump
  *
- * Perform final calculations for rpt60
+ * Dump data for report.
  *
- * returns allocated struct or 0L for error
  */
-int ftstat_rpt_60_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_72_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_60, rpt60, ftchash_rec_prefix162,
-    ftch_recprefix162);
+  STD_DUMP_HASH1P(ftstat_rpt_72, rpt72, chash_prefix_tag_dump,
+    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
+    FT_PATH_SYM_TAG,
+    "", "ip-destination-address", "source-tag", "", "", "", "");
 
-} /* ftstat_rpt_60_calc */
+} /* ftstat_rpt_72_dump */
 
-/* function: ftstat_rpt_60_dump
+
+/* function: ftstat_rpt_72_free
  *
- * Dump data for report.
+ * Free data structures for report allocated by ftstat_rpt_72_new
  *
  */
-int ftstat_rpt_60_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+void ftstat_rpt_72_free(struct ftstat_rpt_72 *rpt72)
 {
 
-  STD_DUMP_HASH2P(ftstat_rpt_60, rpt60, chash_prefix162_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    (char*)0L, (char*)0L,
-    "", "ip-source-address", "input-interface", "output-interface", "", "",
-    "");
+  STD_FREE_HASH(rpt72);
 
-} /* ftstat_rpt_60_dump */
+} /* ftstat_rpt_72_free */
 
-/* function: ftstat_rpt_60_free
+/* function: ftstat_rpt_73_new
  *
- * Free data structures for report allocated by ftstat_rpt_60_new
+ * Allocate and initialize data structures for rpt 73.
  *
- */
-void ftstat_rpt_60_free(struct ftstat_rpt_60 *rpt60)
-{ 
- 
-  STD_FREE_HASH(rpt60);
-   
-} /* ftstat_rpt_60_free */
-
-
-/* function: ftstat_rpt_61_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_61 *ftstat_rpt_61_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_73 *ftstat_rpt_73_new(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_61, rpt61, 65536, ftchash_rec_prefix162, 10, 65536);
 
-} /* ftstat_rpt_61_new */
+  STD_NEW_HASH(ftstat_rpt_73, rpt73, 65536, ftchash_rec_prefix_tag, 12, 65536);
 
-/* function: ftstat_rpt_61_accum
+} /* ftstat_rpt_73_new */
+
+
+/* function: ftstat_rpt_73_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_61_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_73_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_61, rpt61, ftchash_rec_prefix162,
-    ftch_recprefix162, ftch_prefix162p);
+  STD_ACCUM_HASH1(ftstat_rpt_73, rpt73, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag, ftch_recprefix_tagp);
 
-  FT_RECGET_INPUT(cur,rec,*fo);
-  FT_RECGET_OUTPUT(cur,rec,*fo);
   FT_RECGET_DSTADDR(cur,rec,*fo);
+  FT_RECGET_DST_TAG(cur,rec,*fo);
  
-  ftch_recprefix162.prefix = cur.dstaddr;
-  ftch_recprefix162.c16a = cur.input;
-  ftch_recprefix162.c16b = cur.output;
+  ftch_recprefix_tag.prefix = cur.dstaddr;
+  ftch_recprefix_tag.tag = cur.dst_tag;
 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
     FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix162.mask = cur.dst_mask;
+    ftch_recprefix_tag.mask = cur.dst_mask;
   }
 
   /* remove host bits */
   if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
 
-  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
-    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
-    (ftch_recprefix162.c16b);
+  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
+    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
+    (ftch_recprefix_tag.mask);
 
-  STD_ACCUM_HASH2(rpt61, ftch_recprefix162, ftch_prefix162p);
+  STD_ACCUM_HASH2(rpt73, ftch_recprefix_tag, ftch_recprefix_tagp);
 
   return 0;
    
-} /* ftstat_rpt_61_accum */
+} /* ftstat_rpt_73_accum */
 
-/* function: ftstat_rpt_61_calc
+/* function: ftstat_rpt_73_calc
  *
- * Perform final calculations for rpt61
+ * Perform final calculations for rpt73
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_61_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_73_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_61, rpt61, ftchash_rec_prefix162,
-    ftch_recprefix162);
+  STD_CALC_HASH(ftstat_rpt_73, rpt73, ftchash_rec_prefix_tag,
+    ftch_recprefix_tag);
 
-} /* ftstat_rpt_61_calc */
+} /* ftstat_rpt_73_calc */
 
-/* function: ftstat_rpt_61_dump
+/* function: ftstat_rpt_73_merge
+ *
+ * Merge the counters accumulated by src into rpt73
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_73_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_73, ftchash_rec_prefix_tag);
+
+} /* ftstat_rpt_73_merge */
+
+/* function: ftstat_rpt_73_save
+ *
+ * Write the counters of rpt73 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_73_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_73, ftchash_rec_prefix_tag);
+
+} /* ftstat_rpt_73_save */
+
+/* function: ftstat_rpt_73_load
+ *
+ * Merge counters written by ftstat_rpt_73_save() into rpt73
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_73_load(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_LOAD_HASH(ftstat_rpt_73, ftchash_rec_prefix_tag);
+
+} /* ftstat_rpt_73_load */
+
+/* function: ftstat_rpt_73_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_61_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_73_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH2P(ftstat_rpt_61, rpt61, chash_prefix162_dump,
+  STD_DUMP_HASH1P(ftstat_rpt_73, rpt73, chash_prefix_tag_dump,
     FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    (char*)0L, (char*)0L,
-    "", "ip-destination-address", "input-interface", "output-interface", "",
-    "", "");
-   
-} /* ftstat_rpt_61_dump */
+    FT_PATH_SYM_TAG,
+    "", "ip-destination-address", "destination-tag", "", "", "", "");
 
-/* function: ftstat_rpt_61_free
+} /* ftstat_rpt_73_dump */
+
+
+/* function: ftstat_rpt_73_free
  *
- * Free data structures for report allocated by ftstat_rpt_61_new
+ * Free data structures for report allocated by ftstat_rpt_73_new
  *
  */
-void ftstat_rpt_61_free(struct ftstat_rpt_61 *rpt61)
-{ 
- 
-  STD_FREE_HASH(rpt61);
-   
-} /* ftstat_rpt_61_free */
+void ftstat_rpt_73_free(struct ftstat_rpt_73 *rpt73)
+{
 
+  STD_FREE_HASH(rpt73);
 
-/* function: ftstat_rpt_62_new
- * 
- * Allocate and initialize data structures for rpt 52.
- * 
+} /* ftstat_rpt_73_free */
+
+/* function: ftstat_rpt_74_new
+ *
+ * Allocate and initialize data structures for rpt 74.
+ *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_62 *ftstat_rpt_62_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_74 *ftstat_rpt_74_new(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_62, rpt62, 65536, ftchash_rec_prefix162, 10, 65536);
 
-} /* ftstat_rpt_62_new */
+  STD_NEW_HASH(ftstat_rpt_74, rpt74, 65536, ftchash_rec_prefix2tag2, 24, 65536);
 
-/* function: ftstat_rpt_62_accum
+} /* ftstat_rpt_74_new */
+
+
+/* function: ftstat_rpt_74_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_62_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_74_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_62, rpt62, ftchash_rec_prefix162,
-    ftch_recprefix162, ftch_prefix162p);
+  STD_ACCUM_HASH1(ftstat_rpt_74, rpt74, ftchash_rec_prefix2tag2,
+    ftch_recprefix2tag2, ftch_recprefix2tag2p);
 
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
   FT_RECGET_SRCADDR(cur,rec,*fo);
+  FT_RECGET_DSTADDR(cur,rec,*fo);
+  FT_RECGET_SRC_TAG(cur,rec,*fo);
+  FT_RECGET_DST_TAG(cur,rec,*fo);
  
-  ftch_recprefix162.prefix = cur.srcaddr;
-  ftch_recprefix162.c16a = cur.src_as;
-  ftch_recprefix162.c16b = cur.dst_as;
+  ftch_recprefix2tag2.src_prefix = cur.srcaddr;
+  ftch_recprefix2tag2.src_tag = cur.src_tag;
+  ftch_recprefix2tag2.dst_prefix = cur.dstaddr;
+  ftch_recprefix2tag2.dst_tag = cur.dst_tag;
 
   /* only use mask if option set */
   if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
     FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix162.mask = cur.src_mask; 
+    ftch_recprefix2tag2.src_mask = cur.src_mask;
+  }
+
+  /* only use mask if option set */
+  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
+    FT_RECGET_DST_MASK(cur,rec,*fo);
+    ftch_recprefix2tag2.src_mask = cur.dst_mask;
   }
 
   /* remove host bits */
   if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+    ftch_recprefix2tag2.src_prefix &=
+      ipv4_len2mask(ftch_recprefix2tag2.src_mask);
 
-  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
-    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
-    (ftch_recprefix162.c16b);   
-  
-  STD_ACCUM_HASH2(rpt62, ftch_recprefix162, ftch_prefix162p);
+  /* remove host bits */
+  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+    ftch_recprefix2tag2.dst_prefix
+      &= ipv4_len2mask(ftch_recprefix2tag2.dst_mask);
+
+  hash = (ftch_recprefix2tag2.src_tag>>16) ^
+         (ftch_recprefix2tag2.src_tag & 0xFFFF) ^
+         (ftch_recprefix2tag2.dst_tag>>16) ^
+         (ftch_recprefix2tag2.dst_tag & 0xFFFF) ^
+         (ftch_recprefix2tag2.src_prefix>>16) ^
+         (ftch_recprefix2tag2.src_prefix & 0xFFFF) ^
+         (ftch_recprefix2tag2.dst_prefix>>16) ^
+         (ftch_recprefix2tag2.dst_prefix & 0xFFFF) ^
+         (ftch_recprefix2tag2.src_mask) ^
+         (ftch_recprefix2tag2.dst_mask);
+
+  STD_ACCUM_HASH2(rpt74, ftch_recprefix2tag2, ftch_recprefix2tag2p);
 
   return 0;
    
-} /* ftstat_rpt_62_accum */
+} /* ftstat_rpt_74_accum */
 
-/* function: ftstat_rpt_62_calc
+/* function: ftstat_rpt_74_calc
  *
- * Perform final calculations for rpt62
+ * Perform final calculations for rpt74
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_62_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_74_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_62, rpt55, ftchash_rec_prefix162,
-    ftch_recprefix162);
- 
-} /* ftstat_rpt_62_calc */
+  STD_CALC_HASH(ftstat_rpt_74, rpt74, ftchash_rec_prefix2tag2,
+    ftch_recprefix2tag2);
+
+} /* ftstat_rpt_74_calc */
+
+/* function: ftstat_rpt_74_merge
+ *
+ * Merge the counters accumulated by src into rpt74
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_74_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
+
+  STD_MERGE_HASH(ftstat_rpt_74, ftchash_rec_prefix2tag2);
+
+} /* ftstat_rpt_74_merge */
+
+/* function: ftstat_rpt_74_save
+ *
+ * Write the counters of rpt74 to fp
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_74_save(struct ftstat_rpt *rpt, FILE *fp)
+{
+
+  STD_SAVE_HASH(ftstat_rpt_74, ftchash_rec_prefix2tag2);
+
+} /* ftstat_rpt_74_save */
+
+/* function: ftstat_rpt_74_load
+ *
+ * Merge counters written by ftstat_rpt_74_save() into rpt74
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_74_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-/* function: ftstat_rpt_62_dump
+  STD_LOAD_HASH(ftstat_rpt_74, ftchash_rec_prefix2tag2);
+
+} /* ftstat_rpt_74_load */
+
+/* function: ftstat_rpt_74_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_62_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_74_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH2P(ftstat_rpt_62, rpt62, chash_prefix162_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "ip-source-address", "source-as", "destination-as", "", "", "");
+  STD_DUMP_HASH1(ftstat_rpt_74, rpt74, chash_prefix2tag2_dump,
+    FT_PATH_SYM_TAG,
+    "", "ip-source-address", "ip-destination-address", "source-tag",
+    "destination-tag", "", "");
 
-} /* ftstat_rpt_62_dump */
+} /* ftstat_rpt_74_dump */
 
-/* function: ftstat_rpt_62_free
+
+/* function: ftstat_rpt_74_free
  *
- * Free data structures for report allocated by ftstat_rpt_62_new
+ * Free data structures for report allocated by ftstat_rpt_74_new
  *
  */
-void ftstat_rpt_62_free(struct ftstat_rpt_62 *rpt62)
-{ 
- 
-  STD_FREE_HASH(rpt62);
-   
-} /* ftstat_rpt_62_free */
+void ftstat_rpt_74_free(struct ftstat_rpt_74 *rpt74)
+{
 
-/* function: ftstat_rpt_63_new
- * 
- * Allocate and initialize data structures for rpt 63
- * 
+  STD_FREE_HASH(rpt74);
+
+} /* ftstat_rpt_74_free */
+
+/* function: ftstat_rpt_75_new
+ *
+ * Allocate and initialize data structures for rpt 75.
+ *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_63 *ftstat_rpt_63_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_75 *ftstat_rpt_75_new(struct ftstat_rpt *rpt)
 {
-  
-  STD_NEW_HASH(ftstat_rpt_63, rpt63, 65536, ftchash_rec_prefix162, 10, 65536);
 
-} /* ftstat_rpt_63_new */
+  STD_NEW_HASH1(ftstat_rpt_75, rpt75, 65536, ftchash_rec_int, 4,
+    65536, 0);
 
-/* function: ftstat_rpt_63_accum
+} /* ftstat_rpt_75_new */
+
+
+/* function: ftstat_rpt_75_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_63_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_75_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
+  struct fttime start, end;
+  uint32_t i;
+  double p_flows, p_octets, p_packets, d;
 
-  STD_ACCUM_HASH1(ftstat_rpt_63, rpt63, ftchash_rec_prefix162,
-    ftch_recprefix162, ftch_prefix162p);
+  STD_ACCUM_HASH1(ftstat_rpt_75, rpt75, ftchash_rec_int,
+    ftch_recint, ftch_recintp);
 
-  FT_RECGET_SRC_AS(cur,rec,*fo);
-  FT_RECGET_DST_AS(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
- 
-  ftch_recprefix162.prefix = cur.dstaddr;
-  ftch_recprefix162.c16a = cur.src_as;
-  ftch_recprefix162.c16b = cur.dst_as;
+  FT_RECGET_SYSUPTIME(cur,rec,*fo);
+  FT_RECGET_UNIX_SECS(cur,rec,*fo);
+  FT_RECGET_UNIX_NSECS(cur,rec,*fo);
+  FT_RECGET_FIRST(cur,rec,*fo);
+  FT_RECGET_LAST(cur,rec,*fo);
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix162.mask = cur.dst_mask; 
-  }
+  start = ftltime(cur.sysUpTime, cur.unix_secs, cur.unix_nsecs, cur.First);
+  end = ftltime(cur.sysUpTime, cur.unix_secs, cur.unix_nsecs, cur.Last);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix162.prefix &= ipv4_len2mask(ftch_recprefix162.mask);
+  d = (end.secs - start.secs) + 1;
 
-  hash = (ftch_recprefix162.prefix>>16) ^ (ftch_recprefix162.prefix & 0xFFFF) ^
-    (ftch_recprefix162.mask) ^ (ftch_recprefix162.c16a) ^
-    (ftch_recprefix162.c16b);   
-  
-  STD_ACCUM_HASH2(rpt63, ftch_recprefix162, ftch_prefix162p);
+  p_flows = (double)cur.dFlows64 / d;
+  p_octets = (double)cur.dOctets64 / d;
+  p_packets = (double)cur.dPkts64 / d;
+
+  for (i = start.secs; i <= end.secs; ++i) {
+
+    ftch_recint.time = i;
 
+    hash = (i>>16) ^ (i & 0xFFFF);
+
+    if (!(ftch_recintp = ftchash_update(rpt75->ftch, &ftch_recint, hash))) {
+      fterr_warnx("ftch_update(): failed");
+      return -1;
+    }
+
+    ftch_recintp->nflows += p_flows;
+    ftch_recintp->noctets += p_octets;
+    ftch_recintp->npackets += p_packets;
+
+  }
+  
   return 0;
    
-} /* ftstat_rpt_63_accum */
+} /* ftstat_rpt_75_accum */
 
-/* function: ftstat_rpt_63_calc
+/* function: ftstat_rpt_75_calc
  *
- * Perform final calculations for rpt63
+ * Perform final calculations for rpt75
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_63_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_75_calc(struct ftstat_rpt *rpt)
 {
+  struct ftstat_rpt_75 *rpt75;
 
-  STD_CALC_HASH(ftstat_rpt_63, rpt55, ftchash_rec_prefix162,
-    ftch_recprefix162);
- 
-} /* ftstat_rpt_63_calc */
+  rpt75 = rpt->data;
 
-/* function: ftstat_rpt_63_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_63_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+  STD_CALC;
 
-  STD_DUMP_HASH2P(ftstat_rpt_63, rpt63, chash_prefix162_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    FT_PATH_SYM_ASN, FT_PATH_SYM_ASN,
-    "", "ip-destination-address", "source-as", "destination-as", "", "", "");
+  rpt->recs = rpt75->ftch->entries;
 
-} /* ftstat_rpt_63_dump */
+  return 0;
 
-/* function: ftstat_rpt_63_free
- *
- * Free data structures for report allocated by ftstat_rpt_62_new
- *
- */
-void ftstat_rpt_63_free(struct ftstat_rpt_63 *rpt63)
-{ 
- 
-  STD_FREE_HASH(rpt63);
-   
-} /* ftstat_rpt_63_free */
+} /* ftstat_rpt_75_calc */
 
-/* function: ftstat_rpt_64_new
+/* function: ftstat_rpt_75_merge
  *
- * Allocate and initialize data structures for rpt 15.
+ * Merge the counters accumulated by src into rpt75
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_64 *ftstat_rpt_64_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_75_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_HASH(ftstat_rpt_64, rpt64, 65536, ftchash_rec_prefix, 5, 65536);
-
-} /* ftstat_rpt_64_new */
+  STD_MERGE_HASH1(ftstat_rpt_75, ftchash_rec_int, chash_int_combine);
 
+} /* ftstat_rpt_75_merge */
 
-/* function: ftstat_rpt_64_accum
+/* function: ftstat_rpt_75_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt75 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_64_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_75_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_64, rpt64, ftchash_rec_prefix, ftch_recprefix,
-    ftch_recprefixp);
-
-  FT_RECGET_SRCADDR(cur,rec,*fo);
- 
-  ftch_recprefix.prefix = cur.srcaddr;
+  STD_STATE_NONE;
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix.mask = cur.src_mask;
-  }
+} /* ftstat_rpt_75_save */
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
+/* function: ftstat_rpt_75_load
+ *
+ * Merge counters written by ftstat_rpt_75_save() into rpt75
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_75_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefix.mask);
+  STD_STATE_NONE;
 
-  STD_ACCUM_HASH2(rpt64, ftch_recprefix, ftch_recprefixp);
+} /* ftstat_rpt_75_load */
 
-  bzero(&ftch_recprefix, sizeof ftch_recprefix);
+/* function: ftstat_rpt_75_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_75_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-  FT_RECGET_DSTADDR(cur,rec,*fo);
- 
-  ftch_recprefix.prefix = cur.dstaddr;
+  STD_DUMP_HASH0(ftstat_rpt_75, rpt75, chash_int_dump,
+    "unix-secs", "", "", "", "", "", "");
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix.mask = cur.dst_mask;
-  }
+} /* ftstat_rpt_75_dump */
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix.prefix &= ipv4_len2mask(ftch_recprefix.mask);
 
-  hash = (ftch_recprefix.prefix>>16) ^ (ftch_recprefix.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefix.mask);
+/* function: ftstat_rpt_75_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_75_new
+ *
+ */
+void ftstat_rpt_75_free(struct ftstat_rpt_75 *rpt75)
+{
 
-  STD_ACCUM_HASH2(rpt64, ftch_recprefix, ftch_recprefixp);
+  STD_FREE_HASH(rpt75);
 
-  return 0;
-   
-} /* ftstat_rpt_64_accum */
+} /* ftstat_rpt_75_free */
 
-/* function: ftstat_rpt_64_calc
+/* function: ftstat_rpt_76_new
  *
- * Perform final calculations for rpt64
+ * Allocate and initialize data structures for rpt 76.
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_64_calc(struct ftstat_rpt *rpt)
+struct ftstat_rpt_76 *ftstat_rpt_76_new(struct ftstat_rpt *rpt)
 {
 
-  STD_CALC_HASH(ftstat_rpt_64, rpt64, ftchash_rec_prefix, ftch_recprefix);
+  STD_NEW_HASH(ftstat_rpt_76, rpt76, 65536, ftchash_rec_c32, 4, 65536);
 
-} /* ftstat_rpt_64_calc */
+} /* ftstat_rpt_76_new */
 
-/* function: ftstat_rpt_64_dump
+
+/* function: ftstat_rpt_76_accum
  *
- * Dump data for report.
+ * Accumulate counters for report by processing flow.
  *
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_64_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_76_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
 
-  STD_DUMP_HASH0P(ftstat_rpt_64, rpt64, chash_prefix_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK|
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    "ip-address", "", "", "", "", "", "");
+  STD_ACCUM_HASH1(ftstat_rpt_76, rpt76, ftchash_rec_c32,
+    ftch_recc32, ftch_recc32p);
 
-} /* ftstat_rpt_64_dump */
+  ftch_recc32.c32 = cur.First;
+
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
 
+  STD_ACCUM_HASH2(rpt76, ftch_recc32, ftch_recc32p);
+  
+  return 0;
+   
+} /* ftstat_rpt_76_accum */
 
-/* function: ftstat_rpt_64_free
+/* function: ftstat_rpt_76_calc
  *
- * Free data structures for report allocated by ftstat_rpt_64_new
+ * Perform final calculations for rpt76
  *
+ * returns allocated struct or 0L for error
  */
-void ftstat_rpt_64_free(struct ftstat_rpt_64 *rpt64)
+int ftstat_rpt_76_calc(struct ftstat_rpt *rpt)
 {
 
-  STD_FREE_HASH(rpt64);
+  STD_CALC_HASH(ftstat_rpt_76, rpt76, ftchash_rec_c32, ftch_recc32);
 
-} /* ftstat_rpt_64_free */
+} /* ftstat_rpt_76_calc */
 
-/* function: ftstat_rpt_65_new
+/* function: ftstat_rpt_76_merge
  *
- * Allocate and initialize data structures for rpt 6.
+ * Merge the counters accumulated by src into rpt76
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_65 *ftstat_rpt_65_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_76_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_BUCKET(ftstat_rpt_65, rpt65, 65536, rpt);
-
-} /* ftstat_rpt_65_new */
+  STD_MERGE_HASH(ftstat_rpt_76, ftchash_rec_c32);
 
+} /* ftstat_rpt_76_merge */
 
-/* function: ftstat_rpt_65_accum
+/* function: ftstat_rpt_76_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt76 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_65_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_76_save(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_ACCUM_BUCKET1(ftstat_rpt_65, rpt65);
-
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-
-  STD_ACCUM_BUCKET2(rpt65->bucket, cur.srcport);
-
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-
-  STD_ACCUM_BUCKET2(rpt65->bucket, cur.dstport);
-
-  return 0;
+  STD_SAVE_HASH(ftstat_rpt_76, ftchash_rec_c32);
 
-} /* ftstat_rpt_65_accum */
+} /* ftstat_rpt_76_save */
 
-/* function: ftstat_rpt_65_calc
+/* function: ftstat_rpt_76_load
  *
- * Perform final calculations for rpt65
+ * Merge counters written by ftstat_rpt_76_save() into rpt76
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_65_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_76_load(struct ftstat_rpt *rpt, FILE *fp)
 {
 
-  STD_CALC_BUCKET(ftstat_rpt_65, rpt65, 65536);
+  STD_LOAD_HASH(ftstat_rpt_76, ftchash_rec_c32);
 
-} /* ftstat_rpt_65_calc */
+} /* ftstat_rpt_76_load */
 
-/* function: ftstat_rpt_65_dump
+/* function: ftstat_rpt_76_dump
  *
  * Dump data for report.
  *
  */
-int ftstat_rpt_65_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+int ftstat_rpt_76_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_BUCKET(ftstat_rpt_65, rpt65, 65536, FT_PATH_SYM_TCP_PORT,
-    "ip-port", "", "", "", "", "", "");
+  STD_DUMP_HASH1(ftstat_rpt_76, rpt76, chash_c32_dump, (char*)0L,
+    "First", "", "", "", "", "", "");
 
-} /* ftstat_rpt_65_dump */
+} /* ftstat_rpt_76_dump */
 
 
-/* function: ftstat_rpt_65_free
+/* function: ftstat_rpt_76_free
  *
- * Free data structures for report allocated by ftstat_rpt_65_new
+ * Free data structures for report allocated by ftstat_rpt_76_new
  *
  */
-void ftstat_rpt_65_free(struct ftstat_rpt_65 *rpt65)
+void ftstat_rpt_76_free(struct ftstat_rpt_76 *rpt76)
 {
 
-  STD_FREE_BUCKET(rpt65);
+  STD_FREE_HASH(rpt76);
 
-} /* ftstat_rpt_65_free */
+} /* ftstat_rpt_76_free */
 
-/* function: ftstat_rpt_66_new
+
+/* function: ftstat_rpt_77_new
  *
- * Allocate and initialize data structures for rpt 15.
+ * Allocate and initialize data structures for rpt 77.
  *
  * returns allocated struct or 0L for error
  */
-struct ftstat_rpt_66 *ftstat_rpt_66_new(struct ftstat_rpt *rpt)
+struct ftstat_rpt_77 *ftstat_rpt_77_new(struct ftstat_rpt *rpt)
 {
 
-  STD_NEW_HASH(ftstat_rpt_66, rpt66, 65536, ftchash_rec_prefixh, 5, 65536);
+  STD_NEW_HASH(ftstat_rpt_77, rpt77, 65536, ftchash_rec_c32, 4, 65536);
 
-} /* ftstat_rpt_66_new */
+} /* ftstat_rpt_77_new */
 
 
-/* function: ftstat_rpt_66_accum
+/* function: ftstat_rpt_77_accum
  *
  * Accumulate counters for report by processing flow.
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_66_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_77_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
 {
-  struct ftchash_rec_prefixs *ftch_recprefixsp, ftch_recprefixs;
-
-  STD_ACCUM_HASH1(ftstat_rpt_66, rpt66, ftchash_rec_prefixh, ftch_recprefixh,
-    ftch_recprefixhp);
-
-  FT_RECGET_SRCADDR(cur,rec,*fo);
- 
-  ftch_recprefixh.prefix = cur.srcaddr;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefixh.mask = cur.src_mask;
-  }
-
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefixh.prefix &= ipv4_len2mask(ftch_recprefixh.mask);
 
-  hash = (ftch_recprefixh.prefix>>16) ^ (ftch_recprefixh.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefixh.mask);
+  STD_ACCUM_HASH1(ftstat_rpt_77, rpt77, ftchash_rec_c32,
+    ftch_recc32, ftch_recc32p);
 
-  STD_ACCUM_HASH2(rpt66, ftch_recprefixh, ftch_recprefixhp);
+  ftch_recc32.c32 = cur.Last;
 
-  /* new second hash */
-  if (!ftch_recprefixhp->ftch) {
-    if (!(ftch_recprefixhp->ftch = ftchash_new(256,
-      sizeof (struct ftchash_rec_prefixs), 5, 64))) {
-      fterr_warnx("ftchash_new(): failed");
-      return -1;
-    }
-  }
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
 
-  FT_RECGET_DSTADDR(cur,rec,*fo);
+  STD_ACCUM_HASH2(rpt77, ftch_recc32, ftch_recc32p);
+  
+  return 0;
+   
+} /* ftstat_rpt_77_accum */
 
-  bzero(&ftch_recprefixs, sizeof ftch_recprefixs);
- 
-  ftch_recprefixs.prefix = cur.dstaddr;
+/* function: ftstat_rpt_77_calc
+ *
+ * Perform final calculations for rpt77
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_77_calc(struct ftstat_rpt *rpt)
+{
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefixs.mask = cur.dst_mask;
-  }
+  STD_CALC_HASH(ftstat_rpt_77, rpt77, ftchash_rec_c32, ftch_recc32);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefixs.prefix &= ipv4_len2mask(ftch_recprefixs.mask);
+} /* ftstat_rpt_77_calc */
 
-  hash = (ftch_recprefixs.prefix>>16) ^ (ftch_recprefixs.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefixs.mask);
-  hash = (hash >> 8) ^ (hash & 0xFF);
+/* function: ftstat_rpt_77_merge
+ *
+ * Merge the counters accumulated by src into rpt77
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_77_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
+{
 
-  if (!(ftch_recprefixsp = ftchash_update(ftch_recprefixhp->ftch,
-    &ftch_recprefixs, hash))) {
-    fterr_warnx("ftch_update(): failed");
-    return -1;
-  }
+  STD_MERGE_HASH(ftstat_rpt_77, ftchash_rec_c32);
 
-  return 0;
-   
-} /* ftstat_rpt_66_accum */
+} /* ftstat_rpt_77_merge */
 
-/* function: ftstat_rpt_66_calc
+/* function: ftstat_rpt_77_save
  *
- * Perform final calculations for rpt66
+ * Write the counters of rpt77 to fp
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-int ftstat_rpt_66_calc(struct ftstat_rpt *rpt)
+int ftstat_rpt_77_save(struct ftstat_rpt *rpt, FILE *fp)
 {
-  struct ftchash_rec_prefixh *ftch_recprefixh;
-  struct ftstat_rpt_66 *rpt66;
 
-  rpt66 = rpt->data;
+  STD_SAVE_HASH(ftstat_rpt_77, ftchash_rec_c32);
 
-  STD_CALC;
+} /* ftstat_rpt_77_save */
 
-  rpt->recs = rpt66->ftch->entries;
+/* function: ftstat_rpt_77_load
+ *
+ * Merge counters written by ftstat_rpt_77_save() into rpt77
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_77_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  ftchash_first(rpt66->ftch);
+  STD_LOAD_HASH(ftstat_rpt_77, ftchash_rec_c32);
 
-  while ((ftch_recprefixh = ftchash_foreach(rpt66->ftch))) {
+} /* ftstat_rpt_77_load */
 
-    if (ftch_recprefixh->etime) {
-      if (rpt->all_fields & FT_STAT_FIELD_PS) {
-        ftch_recprefixh->ps.avg_pps /= (double)ftch_recprefixh->nrecs;
-        ftch_recprefixh->ps.avg_bps /= (double)ftch_recprefixh->nrecs;
-      }
-    }
+/* function: ftstat_rpt_77_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_77_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-    ftch_recprefixh->nprefixes = ftch_recprefixh->ftch->entries;
-    rpt->t_count += ftch_recprefixh->ftch->entries;
-    
-  }
+  STD_DUMP_HASH1(ftstat_rpt_77, rpt77, chash_c32_dump, (char*)0L,
+    "Last", "", "", "", "", "", "");
 
-  return 0;
+} /* ftstat_rpt_77_dump */
 
-} /* ftstat_rpt_66_calc */
 
-/* function: ftstat_rpt_66_dump
+/* function: ftstat_rpt_77_free
  *
- * Dump data for report.
+ * Free data structures for report allocated by ftstat_rpt_77_new
  *
  */
-int ftstat_rpt_66_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+void ftstat_rpt_77_free(struct ftstat_rpt_77 *rpt77)
 {
 
-  STD_DUMP_HASH0P(ftstat_rpt_66, rpt66, chash_prefixh_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    "ip-source-address", "ip-destination-address-count", "", "", "", "", "");
+  STD_FREE_HASH(rpt77);
 
-} /* ftstat_rpt_66_dump */
+} /* ftstat_rpt_77_free */
 
 
-/* function: ftstat_rpt_66_free
+/* function: ftstat_rpt_78_new
  *
- * Free data structures for report allocated by ftstat_rpt_66_new
+ * Allocate and initialize data structures for rpt 78.
  *
+ * returns allocated struct or 0L for error
  */
-void ftstat_rpt_66_free(struct ftstat_rpt_66 *rpt66)
+struct ftstat_rpt_78 *ftstat_rpt_78_new(struct ftstat_rpt *rpt)
 {
-  struct ftchash_rec_prefixh *ftch_recprefixh;
 
-  if (rpt66) {
+  STD_NEW_HASH(ftstat_rpt_78, rpt78, 65536, ftchash_rec_c32, 4, 65536);
 
-    if (rpt66->ftch) {
+} /* ftstat_rpt_78_new */
 
-      ftchash_first(rpt66->ftch);
 
-      while ((ftch_recprefixh = ftchash_foreach(rpt66->ftch))) {
+/* function: ftstat_rpt_78_accum
+ *
+ * Accumulate counters for report by processing flow.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_78_accum(struct ftstat_rpt *rpt, char *rec,
+  struct fts3rec_offsets *fo, struct ftstat_flow *ff)
+{
 
-        if (ftch_recprefixh->ftch)
-          ftchash_free(ftch_recprefixh->ftch);
+  STD_ACCUM_HASH1(ftstat_rpt_78, rpt78, ftchash_rec_c32,
+    ftch_recc32, ftch_recc32p);
 
-      }
+  ftch_recc32.c32 = cur.Last - cur.First;
 
-      ftchash_free(rpt66->ftch);
+  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
 
-    }
+  STD_ACCUM_HASH2(rpt78, ftch_recc32, ftch_recc32p);
+  
+  return 0;
+   
+} /* ftstat_rpt_78_accum */
 
-    free (rpt66);
+/* function: ftstat_rpt_78_calc
+ *
+ * Perform final calculations for rpt78
+ *
+ * returns allocated struct or 0L for error
+ */
+int ftstat_rpt_78_calc(struct ftstat_rpt *rpt)
+{
 
-  }
+  STD_CALC_HASH(ftstat_rpt_78, rpt78, ftchash_rec_c32, ftch_recc32);
 
-} /* ftstat_rpt_66_free */
+} /* ftstat_rpt_78_calc */
 
-/* function: ftstat_rpt_67_new
+/* function: ftstat_rpt_78_merge
  *
- * Allocate and initialize data structures for rpt 15.
+ * Merge the counters accumulated by src into rpt78
  *
- * returns allocated struct or 0L for error
+ * returns 0: ok
+ *        !0: error
  */
-struct ftstat_rpt_67 *ftstat_rpt_67_new(struct ftstat_rpt *rpt)
+int ftstat_rpt_78_merge(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
 
-  STD_NEW_HASH(ftstat_rpt_67, rpt67, 65536, ftchash_rec_prefixh, 5, 65536);
-
-} /* ftstat_rpt_67_new */
+  STD_MERGE_HASH(ftstat_rpt_78, ftchash_rec_c32);
 
+} /* ftstat_rpt_78_merge */
 
-/* function: ftstat_rpt_67_accum
+/* function: ftstat_rpt_78_save
  *
- * Accumulate counters for report by processing flow.
+ * Write the counters of rpt78 to fp
  *
  * returns 0: ok
  *        !0: error
  */
-int ftstat_rpt_67_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+int ftstat_rpt_78_save(struct ftstat_rpt *rpt, FILE *fp)
 {
-  struct ftchash_rec_prefixs *ftch_recprefixsp, ftch_recprefixs;
-
-  STD_ACCUM_HASH1(ftstat_rpt_67, rpt67, ftchash_rec_prefixh, ftch_recprefixh,
-    ftch_recprefixhp);
-
-  FT_RECGET_DSTADDR(cur,rec,*fo);
- 
-  ftch_recprefixh.prefix = cur.dstaddr;
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefixh.mask = cur.dst_mask;
-  }
+  STD_SAVE_HASH(ftstat_rpt_78, ftchash_rec_c32);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefixh.prefix &= ipv4_len2mask(ftch_recprefixh.mask);
+} /* ftstat_rpt_78_save */
 
-  hash = (ftch_recprefixh.prefix>>16) ^ (ftch_recprefixh.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefixh.mask);
+/* function: ftstat_rpt_78_load
+ *
+ * Merge counters written by ftstat_rpt_78_save() into rpt78
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int ftstat_rpt_78_load(struct ftstat_rpt *rpt, FILE *fp)
+{
 
-  STD_ACCUM_HASH2(rpt67, ftch_recprefixh, ftch_recprefixhp);
+  STD_LOAD_HASH(ftstat_rpt_78, ftchash_rec_c32);
 
-  /* new second hash */
-  if (!ftch_recprefixhp->ftch) {
-    if (!(ftch_recprefixhp->ftch = ftchash_new(256,
-      sizeof (struct ftchash_rec_prefixs), 5, 64))) {
-      fterr_warnx("ftchash_new(): failed");
-      return -1;
-    }
-  }
+} /* ftstat_rpt_78_load */
 
-  FT_RECGET_SRCADDR(cur,rec,*fo);
+/* function: ftstat_rpt_78_dump
+ *
+ * Dump data for report.
+ *
+ */
+int ftstat_rpt_78_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+{
 
-  bzero(&ftch_recprefixs, sizeof ftch_recprefixs);
- 
-  ftch_recprefixs.prefix = cur.srcaddr;
+  STD_DUMP_HASH1(ftstat_rpt_78, rpt78, chash_c32_dump, (char*)0L,
+    "Duration", "", "", "", "", "", "");
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefixs.mask = cur.src_mask;
-  }
+} /* ftstat_rpt_78_dump */
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefixs.prefix &= ipv4_len2mask(ftch_recprefixs.mask);
 
-  hash = (ftch_recprefixs.prefix>>16) ^ (ftch_recprefixs.prefix & 0xFFFF);
-  hash = hash ^ (ftch_recprefixs.mask);
-  hash = (hash >> 8) ^ (hash & 0xFF);
+/* function: ftstat_rpt_78_free
+ *
+ * Free data structures for report allocated by ftstat_rpt_78_new
+ *
+ */
+void ftstat_rpt_78_free(struct ftstat_rpt_78 *rpt78)
+{
 
-  if (!(ftch_recprefixsp = ftchash_update(ftch_recprefixhp->ftch,
-    &ftch_recprefixs, hash))) {
-    fterr_warnx("ftch_update(): failed");
-    return -1;
-  }
+  STD_FREE_HASH(rpt78);
 
-  return 0;
-   
-} /* ftstat_rpt_67_accum */
+} /* ftstat_rpt_78_free */
 
-/* function: ftstat_rpt_67_calc
+/* function: ftstat_rpt_79_new
  *
- * Perform final calculations for rpt67
+ * Allocate and initialize data structures for rpt 79, ip-source-address-destination-count
+ * with an estimated count.  Shares everything else with rpt 66.
  *
  * returns allocated struct or 0L for error
  */
-int ftstat_rpt_67_calc(struct ftstat_rpt *rpt)
+struct ftstat_rpt_66 *ftstat_rpt_79_new(struct ftstat_rpt *rpt)
 {
-  struct ftchash_rec_prefixh *ftch_recprefixh;
-  struct ftstat_rpt_67 *rpt67;
-
-  rpt67 = rpt->data;
 
-  STD_CALC;
-
-  rpt->recs = rpt67->ftch->entries;
-
-  ftchash_first(rpt67->ftch);
-
-  while ((ftch_recprefixh = ftchash_foreach(rpt67->ftch))) {
-
-    if (ftch_recprefixh->etime) {
-      if (rpt->all_fields & FT_STAT_FIELD_PS) {
-        ftch_recprefixh->ps.avg_pps /= (double)ftch_recprefixh->nrecs;
-        ftch_recprefixh->ps.avg_bps /= (double)ftch_recprefixh->nrecs;
-      }
-    }
-
-    ftch_recprefixh->nprefixes = ftch_recprefixh->ftch->entries;
-    rpt->t_count += ftch_recprefixh->ftch->entries;
-    
-  }
+  if (!rpt->count_estimate)
+    rpt->count_estimate = FT_HLL_DEF_PRECISION;
 
-  return 0;
+  return ftstat_rpt_66_new(rpt);
 
-} /* ftstat_rpt_67_calc */
+} /* ftstat_rpt_79_new */
 
-/* function: ftstat_rpt_67_dump
+/* function: ftstat_rpt_80_new
  *
- * Dump data for report.
+ * Allocate and initialize data structures for rpt 80, ip-destination-address-source-count
+ * with an estimated count.  Shares everything else with rpt 67.
  *
+ * returns allocated struct or 0L for error
  */
-int ftstat_rpt_67_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+struct ftstat_rpt_67 *ftstat_rpt_80_new(struct ftstat_rpt *rpt)
 {
 
-  STD_DUMP_HASH0P(ftstat_rpt_67, rpt67, chash_prefixh_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    "ip-destination-address", "ip-source-address-count", "", "", "", "", "");
+  if (!rpt->count_estimate)
+    rpt->count_estimate = FT_HLL_DEF_PRECISION;
 
-} /* ftstat_rpt_67_dump */
+  return ftstat_rpt_67_new(rpt);
 
+} /* ftstat_rpt_80_new */
 
-/* function: ftstat_rpt_67_free
+/*
+ * function: resolve_reports
  *
- * Free data structures for report allocated by ftstat_rpt_67_new
+ * resolve the dangling pointers to rpts in definitions --
+ * allows definitions to be defined before reports.
+ *
+ * _must_ be called after work done by parse_def_report
  *
+ * returns: 0  ok
+ *          <0 fail
  */
-void ftstat_rpt_67_free(struct ftstat_rpt_67 *rpt67)
+static int resolve_reports(struct ftstat *ftstat)
 {
-  struct ftchash_rec_prefixh *ftch_recprefixh;
+  struct ftstat_rpt_item *ftsrpti;
+  struct ftstat_rpt_out *ftsro;
+  struct ftstat_def *ftsd;
+  struct ftstat_rpt *ftsrpt;
+  int found;
 
-  if (rpt67) {
+  /* foreach definition */
+  FT_SLIST_FOREACH(ftsd, &ftstat->defs, chain) {
 
-    if (rpt67->ftch) {
+    /* foreach report in the definition */
+    FT_STAILQ_FOREACH(ftsrpti, &ftsd->items, chain) {
 
-      ftchash_first(rpt67->ftch);
+      /* find the report */
+      found = 0;
 
-      while ((ftch_recprefixh = ftchash_foreach(rpt67->ftch))) {
+      FT_SLIST_FOREACH(ftsrpt, &ftstat->rpts, chain) {
 
-        if (ftch_recprefixh->ftch)
-          ftchash_free(ftch_recprefixh->ftch);
+        if (!strcasecmp(ftsrpti->tmp_report, ftsrpt->name)) {
 
-      }
+          found = 1;
+          break;
 
-      ftchash_free(rpt67->ftch);
+        } /* if */
 
-    }
+      } /* ftsrpt */
 
-    free (rpt67);
+      if (!found) {
+        fterr_warnx(
+          "Unable to resolve report \"%s\" in stat-definition \"%s\".",
+          ftsrpti->tmp_report, ftsd->name);
+        return -1;
+      } /* !found */
 
-  }
+      /* report found */
+      ftsrpti->rpt = ftsrpt;
+      ftsd->xfields |= ftsrpt->xfields;
 
-} /* ftstat_rpt_67_free */
+    } /* ftsrpti */
 
+  } /* ftsd */
 
-/* function: ftstat_rpt_68_new
- * 
- * Allocate and initialize data structures for rpt 68.
- * 
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_68 *ftstat_rpt_68_new(struct ftstat_rpt *rpt)
-{
-  
-  STD_NEW_HASH(ftstat_rpt_68, rpt68, 65536, ftchash_rec_flow1, 16, 65536);
+  /*
+   * the spilled runs are merged back keeping only the top records of
+   * each output, an output that shows them all would need them all in
+   * memory again
+   */
+  FT_SLIST_FOREACH(ftsrpt, &ftstat->rpts, chain) {
 
-} /* ftstat_rpt_68_new */
+    if (!ftsrpt->memory_limit)
+      continue;
 
-/* function: ftstat_rpt_68_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_68_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+    FT_STAILQ_FOREACH(ftsro, &ftsrpt->outs, chain) {
+
+      if ((!ftsro->records) || !(ftsro->options & FT_STAT_OPT_SORT) ||
+        !(ftsro->sort_field & (FT_STAT_FIELD_FLOWS|FT_STAT_FIELD_OCTETS|
+        FT_STAT_FIELD_PACKETS|FT_STAT_FIELD_DURATION|FT_STAT_FIELD_PS))) {
+        fterr_warnx(
+          "Report \"%s\": memory-limit needs outputs sorted on a counter with records.",
+          ftsrpt->name);
+        return -1;
+      }
+
+    } /* ftsro */
+
+  } /* ftsrpt */
+
+  return 0;
+
+} /* resolve_reports */
+
+static int dump_ascii_header(FILE *fp, struct ftio *ftio,
+  struct ftstat_def *active_def, struct ftstat_rpt *rpt)
 {
+  int comma, sort_field;
+  char *buf, fmt_buf[32];
+  time_t now, time_flow;
 
-  STD_ACCUM_HASH1(ftstat_rpt_68, rpt68, ftchash_rec_flow1,
-    ftch_recflow1, ftch_recflow1p);
+  /* shortcut */
+  if (!(rpt->out->options & FT_STAT_OPT_HEADER))
+    return 0;
+
+  if (!active_def->interval) {
+
+    fprintf(fp, "#  --- ---- ---- Report Information --- --- ---\n");
+    fprintf(fp, "# build-version:        flow-tools %s\n", VERSION);
+    fprintf(fp, "# name:                 %s\n", rpt->name);
+    fprintf(fp, "# type:                 %s\n", rpt->format_name);
+    if (rpt->scale)
+      fprintf(fp, "# scale:                %lu\n", (unsigned long)rpt->scale);
  
-  FT_RECGET_SRCPORT(cur,rec,*fo);
-  FT_RECGET_DSTPORT(cur,rec,*fo);
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  FT_RECGET_TOS(cur,rec,*fo);
-  FT_RECGET_PROT(cur,rec,*fo);
-  
-  ftch_recflow1.src_prefix = cur.srcaddr;
-  ftch_recflow1.dst_prefix = cur.dstaddr;
-  ftch_recflow1.src_port = cur.srcport;
-  ftch_recflow1.dst_port = cur.dstport;
-  ftch_recflow1.tos = cur.tos;
-  ftch_recflow1.prot = cur.prot;
-  
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recflow1.src_mask = cur.src_mask;
-  }
+    if (rpt->out->options) {
+
+      fprintf(fp, "# options:              ");
+
+      comma = 0;
+
+      if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+        fprintf(fp, "+percent-total");
+        comma=1;
+      }
 
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recflow1.dst_mask = cur.dst_mask;
-  }
+      if (rpt->out->options & FT_STAT_OPT_NAMES) {
+        fprintf(fp, "%snames", comma ? ",+" : "+");
+        comma=1;
+      }
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recflow1.src_prefix &= ipv4_len2mask(ftch_recflow1.src_mask);
-  }
+      if (rpt->out->options & FT_STAT_OPT_HEADER) {
+        fprintf(fp, "%sheader", comma ? ",+" : "+");
+        comma=1;
+      }
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recflow1.dst_prefix &= ipv4_len2mask(ftch_recflow1.dst_mask);
-  }
-  
-  hash = (ftch_recflow1.src_prefix>>16)^
-          (ftch_recflow1.src_prefix & 0xFFFF)^
-          (ftch_recflow1.dst_prefix>>16)^
-          (ftch_recflow1.dst_prefix & 0xFFFF)^
-          (ftch_recflow1.src_port)^
-          (ftch_recflow1.dst_port)^
-          (ftch_recflow1.src_mask)^
-          (ftch_recflow1.tos)^
-          (ftch_recflow1.prot)^
-          (uint32_t)(ftch_recflow1.dst_mask<<8);
+      if (rpt->out->options & FT_STAT_OPT_XHEADER) {
+        fprintf(fp, "%sxheader", comma ? ",+" : "+");
+        comma=1;
+      }
 
-  STD_ACCUM_HASH2(rpt68, ftch_recflow1, ftch_recflow1p);
+      if (rpt->out->options & FT_STAT_OPT_TOTALS) {
+        fprintf(fp, "%stotals", comma ? ",+" : "+");
+        comma=1;
+      }
 
-  return 0;
-   
-} /* ftstat_rpt_68_accum */
+      fprintf(fp, "\n");
 
-/* function: ftstat_rpt_68_calc
- *
- * Perform final calculations for rpt68
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_68_calc(struct ftstat_rpt *rpt)
-{
+    } /* options */
 
-  STD_CALC_HASH(ftstat_rpt_68, rpt68, ftchash_rec_flow1,
-    ftch_recflow1);
- 
-} /* ftstat_rpt_68_calc */
+    if (rpt->xfields & FT_XFIELD_SRCADDR) {
 
-/* function: ftstat_rpt_68_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_68_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+      fprintf(fp, "# ip-src-addr-type:     ");
 
-  STD_DUMP_HASH2(ftstat_rpt_68, rpt68, chash_flow1_dump,
-    FT_PATH_SYM_TCP_PORT, FT_PATH_SYM_IP_PROT,
-    "", "ip-source-address", "ip-destination-address", "ip-source-port",
-    "ip-destination-port", "ip-protocol", "ip-tos");
+      if (rpt->options & FT_STAT_OPT_SRC_PREFIX_LEN)
+        fprintf(fp, "prefix-len\n");
+      else if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
+        fprintf(fp, "prefix-mask\n");
+      else
+        fprintf(fp, "address\n");
 
-} /* ftstat_rpt_68_dump */
+    }
 
-/* function: ftstat_rpt_68_free
- *
- * Free data structures for report allocated by ftstat_rpt_68_new
- *
- */
-void ftstat_rpt_68_free(struct ftstat_rpt_68 *rpt68)
-{ 
- 
-  STD_FREE_HASH(rpt68);
-   
-} /* ftstat_rpt_68_free */
+    if (rpt->xfields & FT_XFIELD_DSTADDR) {
 
-/* function: ftstat_rpt_69_new
- * 
- * Allocate and initialize data structures for rpt 69.
- * 
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_69 *ftstat_rpt_69_new(struct ftstat_rpt *rpt)
-{
-  
-  STD_NEW_HASH(ftstat_rpt_69, rpt69, 65536, ftchash_rec_flow1, 16, 65536);
+      fprintf(fp, "# ip-dst-addr-type:     ");
 
-} /* ftstat_rpt_69_new */
+      if (rpt->options & FT_STAT_OPT_DST_PREFIX_LEN)
+        fprintf(fp, "prefix-len\n");
+      else if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
+        fprintf(fp, "prefix-mask\n");
+      else
+        fprintf(fp, "address\n");
 
-/* function: ftstat_rpt_69_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_69_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+    }
 
-  STD_ACCUM_HASH1(ftstat_rpt_69, rpt69, ftchash_rec_flow1,
-    ftch_recflow1, ftch_recflow1p);
- 
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  FT_RECGET_TOS(cur,rec,*fo);
-  FT_RECGET_PROT(cur,rec,*fo);
+
+    if (rpt->out->options & FT_STAT_OPT_SORT) {
   
-  ftch_recflow1.src_prefix = cur.srcaddr;
-  ftch_recflow1.dst_prefix = cur.dstaddr;
-  ftch_recflow1.tos = cur.tos;
-  ftch_recflow1.prot = cur.prot;
+      sort_field = rpt->out->sort_field;
+      if (sort_field < 0)
+        sort_field *= -1;
   
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recflow1.src_mask = cur.src_mask;
-  }
+      if (sort_field & FT_STAT_FIELD_KEY)
+        buf = "key";
+      else if (sort_field & FT_STAT_FIELD_KEY1)
+        buf = "key1";
+      else if (sort_field & FT_STAT_FIELD_KEY2)
+        buf = "key2";
+      else if (sort_field & FT_STAT_FIELD_KEY3)
+        buf = "key3";
+      else if (sort_field & FT_STAT_FIELD_KEY4)
+        buf = "key4";
+      else if (sort_field & FT_STAT_FIELD_KEY5)
+        buf = "key5";
+      else if (sort_field & FT_STAT_FIELD_KEY6)
+        buf = "key6";
+      else if (sort_field & FT_STAT_FIELD_FLOWS)
+        buf = "flows";
+      else if (sort_field & FT_STAT_FIELD_OCTETS)
+        buf = "octets";
+      else if (sort_field & FT_STAT_FIELD_PACKETS)
+        buf = "packets";
+      else if (sort_field & FT_STAT_FIELD_DURATION)
+        buf = "duration";
+      else if (sort_field & FT_STAT_FIELD_AVG_PPS)
+        buf = "avg-pps";
+      else if (sort_field & FT_STAT_FIELD_MIN_PPS)
+        buf = "min-pps";
+      else if (sort_field & FT_STAT_FIELD_MAX_PPS)
+        buf = "max-pps";
+      else if (sort_field & FT_STAT_FIELD_AVG_BPS)
+        buf = "avg-bps";
+      else if (sort_field & FT_STAT_FIELD_MIN_BPS)
+        buf = "min-bps";
+      else if (sort_field & FT_STAT_FIELD_MAX_BPS)
+        buf = "max-bps";
+      else if (sort_field & FT_STAT_FIELD_OTHER)
+        buf = "other";
+      else if (sort_field & FT_STAT_FIELD_COUNT)
+        buf = "count";
+      else
+        buf = "error";
 
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recflow1.dst_mask = cur.dst_mask;
-  }
+      fprintf(fp, "# sort_field:           %c%s\n",
+        (rpt->out->sort_field < 0) ? '-' : '+', buf);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK) {
-    ftch_recflow1.src_prefix &= ipv4_len2mask(ftch_recflow1.src_mask);
-  }
+    } /* FT_STAT_OPT_SORT */
 
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK) {
-    ftch_recflow1.dst_prefix &= ipv4_len2mask(ftch_recflow1.dst_mask);
-  }
-  
-  hash = (ftch_recflow1.src_prefix>>16)^
-          (ftch_recflow1.src_prefix & 0xFFFF)^
-          (ftch_recflow1.dst_prefix>>16)^
-          (ftch_recflow1.dst_prefix & 0xFFFF)^
-          (ftch_recflow1.src_mask)^
-          (ftch_recflow1.tos)^
-          (ftch_recflow1.prot)^
-          (uint32_t)(ftch_recflow1.dst_mask<<8);
+    if (rpt->out->fields) {
 
-  STD_ACCUM_HASH2(rpt69, ftch_recflow1, ftch_recflow1p);
+      fprintf(fp, "# fields:               ");
 
-  return 0;
-   
-} /* ftstat_rpt_69_accum */
+      comma = 0;
+      if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+        fprintf(fp, "+key");
+        comma = 1;
+      }
 
-/* function: ftstat_rpt_69_calc
- *
- * Perform final calculations for rpt69
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_69_calc(struct ftstat_rpt *rpt)
-{
+      if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+        fprintf(fp, "%skey1", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  STD_CALC_HASH(ftstat_rpt_69, rpt69, ftchash_rec_flow1,
-    ftch_recflow1);
- 
-} /* ftstat_rpt_69_calc */
+      if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+        fprintf(fp, "%skey2", comma ? ",+" : "+");
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
+        fprintf(fp, "%skey3", comma ? ",+" : "+");
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
+        fprintf(fp, "%skey4", comma ? ",+" : "+");
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_KEY5) {
+        fprintf(fp, "%skey5", comma ? ",+" : "+");
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_KEY6) {
+        fprintf(fp, "%skey6", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-/* function: ftstat_rpt_69_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_69_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+      if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
+        fprintf(fp, "%sflows", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  STD_DUMP_HASH1(ftstat_rpt_69, rpt69, chash_flow12_dump,
-    FT_PATH_SYM_IP_PROT,
-    "", "ip-source-address", "ip-destination-address", "ip-protocol",
-    "ip-tos", "", "");
+      if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
+        fprintf(fp, "%soctets", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-} /* ftstat_rpt_69_dump */
+      if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
+        fprintf(fp, "%spackets", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-/* function: ftstat_rpt_69_free
- *
- * Free data structures for report allocated by ftstat_rpt_69_new
- *
- */
-void ftstat_rpt_69_free(struct ftstat_rpt_69 *rpt69)
-{ 
- 
-  STD_FREE_HASH(rpt69);
-   
-} /* ftstat_rpt_69_free */
+      if (rpt->out->fields & FT_STAT_FIELD_DURATION) {
+        fprintf(fp, "%sduration", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-/* function: ftstat_rpt_70_new
- *
- * Allocate and initialize data structures for rpt 70.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_70 *ftstat_rpt_70_new(struct ftstat_rpt *rpt)
-{
+      if (rpt->out->fields & FT_STAT_FIELD_AVG_PPS) {
+        fprintf(fp, "%savg-pps", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  STD_NEW_HASH(ftstat_rpt_70, rpt70, 65536, ftchash_rec_prefix_tag, 12, 65536);
+      if (rpt->out->fields & FT_STAT_FIELD_MIN_PPS) {
+        fprintf(fp, "%smin-pps", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-} /* ftstat_rpt_70_new */
+      if (rpt->out->fields & FT_STAT_FIELD_MAX_PPS) {
+        fprintf(fp, "%smax-pps", comma ? ",+" : "+");
+        comma = 1;
+      }
 
+      if (rpt->out->fields & FT_STAT_FIELD_AVG_BPS) {
+        fprintf(fp, "%savg-bps", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-/* function: ftstat_rpt_70_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_70_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+      if (rpt->out->fields & FT_STAT_FIELD_MIN_BPS) {
+        fprintf(fp, "%smin-bps", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  STD_ACCUM_HASH1(ftstat_rpt_70, rpt70, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag, ftch_recprefix_tagp);
+      if (rpt->out->fields & FT_STAT_FIELD_MAX_BPS) {
+        fprintf(fp, "%smax-bps", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_SRC_TAG(cur,rec,*fo);
- 
-  ftch_recprefix_tag.prefix = cur.srcaddr;
-  ftch_recprefix_tag.tag = cur.src_tag;
+      if (rpt->out->fields & FT_STAT_FIELD_QDURATION) {
+        fprintf(fp, "%sduration-quantiles", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix_tag.mask = cur.src_mask;
-  }
+      if (rpt->out->fields & FT_STAT_FIELD_QPPS) {
+        fprintf(fp, "%spps-quantiles", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
+      if (rpt->out->fields & FT_STAT_FIELD_QBPS) {
+        fprintf(fp, "%sbps-quantiles", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
-    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
-    (ftch_recprefix_tag.mask);
+      if (rpt->out->fields & FT_STAT_FIELD_QOPP) {
+        fprintf(fp, "%sopp-quantiles", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  STD_ACCUM_HASH2(rpt70, ftch_recprefix_tag, ftch_recprefix_tagp);
+      if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
+        fprintf(fp, "%sfrecs", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-  return 0;
-   
-} /* ftstat_rpt_70_accum */
+      if (rpt->out->fields & FT_STAT_FIELD_OTHER) {
+        fprintf(fp, "%sother", comma ? ",+" : "+");
+        comma = 1;
+      }
 
-/* function: ftstat_rpt_70_calc
- *
- * Perform final calculations for rpt70
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_70_calc(struct ftstat_rpt *rpt)
-{
+      fprintf(fp, "\n");
 
-  STD_CALC_HASH(ftstat_rpt_70, rpt70, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag);
+    } /* rpt->out->fields */
 
-} /* ftstat_rpt_70_calc */
+    if (rpt->out->options & FT_STAT_OPT_TALLY)
+      fprintf(fp, "# tally:                %lu\n",
+        (unsigned long)rpt->out->tally);
 
-/* function: ftstat_rpt_70_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_70_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+    if (active_def->ftd)
+      fprintf(fp, "# tag:                  %s\n", active_def->ftd->name);
 
-  STD_DUMP_HASH1P(ftstat_rpt_70, rpt70, chash_prefix_tag_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_TAG,
-    "", "ip-source-address", "source-tag", "", "", "", "");
+    if (active_def->ftfd)
+      fprintf(fp, "# pre-filter:           %s\n", active_def->ftfd->name);
 
-} /* ftstat_rpt_70_dump */
+    if (rpt->ftfd)
+      fprintf(fp, "# filter:               %s\n", rpt->ftfd->name);
 
+  } /* !active_def->interval */
 
-/* function: ftstat_rpt_70_free
- *
- * Free data structures for report allocated by ftstat_rpt_70_new
- *
- */
-void ftstat_rpt_70_free(struct ftstat_rpt_70 *rpt70)
-{
+  fmt_uint64(fmt_buf, rpt->recs, FMT_JUST_LEFT);
+    fprintf(fp, "# records:              %s\n", fmt_buf);
 
-  STD_FREE_HASH(rpt70);
+  if (rpt->out->records) {
+    fmt_uint64(fmt_buf, rpt->out->records, FMT_JUST_LEFT);
+    fprintf(fp, "# records_shown:      %s\n", fmt_buf);
+  }
 
-} /* ftstat_rpt_70_free */
+  if (rpt->memory_limit) {
+    fmt_uint64(fmt_buf, rpt->memory_limit, FMT_JUST_LEFT);
+    fprintf(fp, "# memory-limit:         %s\n", fmt_buf);
+    fmt_uint64(fmt_buf, rpt->spill_runs, FMT_JUST_LEFT);
+    fprintf(fp, "# spill-runs:           %s\n", fmt_buf);
+    fmt_uint64(fmt_buf, rpt->spill_recs, FMT_JUST_LEFT);
+    fprintf(fp, "# spill-records:        %s\n", fmt_buf);
+    fmt_uint64(fmt_buf, rpt->merge_recs, FMT_JUST_LEFT);
+    fprintf(fp, "# merge-records:        %s\n", fmt_buf);
+  }
 
+  if (rpt->heavy_hitters) {
+    fmt_uint64(fmt_buf, rpt->heavy_hitters, FMT_JUST_LEFT);
+    fprintf(fp, "# heavy-hitters:        %s %s\n", fmt_buf,
+      (rpt->heavy_field == FT_STAT_FIELD_OCTETS) ? "octets" :
+      (rpt->heavy_field == FT_STAT_FIELD_PACKETS) ? "packets" : "flows");
+    fmt_uint64(fmt_buf, rpt->heavy_evictions, FMT_JUST_LEFT);
+    fprintf(fp, "# heavy-evictions:      %s\n", fmt_buf);
+    fmt_uint64(fmt_buf, rpt->heavy_error, FMT_JUST_LEFT);
+    fprintf(fp, "# heavy-error:          %s\n", fmt_buf);
+  }
 
-/* function: ftstat_rpt_71_new
- *
- * Allocate and initialize data structures for rpt 71.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_71 *ftstat_rpt_71_new(struct ftstat_rpt *rpt)
-{
+  if (rpt->all_fields & FT_STAT_FIELD_QUANT)
+    fprintf(fp, "# quantile-error:       %.1f%%\n", ftqs_error() * 100.0);
 
-  STD_NEW_HASH(ftstat_rpt_71, rpt71, 65536, ftchash_rec_prefix_tag, 12, 65536);
+  if (rpt->count_estimate) {
+    fprintf(fp, "# count-estimate:       %d (standard error %.2f%%)\n",
+      rpt->count_estimate, fthll_error(rpt->count_estimate) * 100.0);
+  }
 
-} /* ftstat_rpt_71_new */
+  time_flow = rpt->time_start;
+  fprintf(fp, "# first-flow:           %lu %s",
+    (unsigned long)rpt->time_start, ctime(&time_flow));
 
+  time_flow = rpt->time_end;
+  fprintf(fp, "# last-flow:            %lu %s",
+    (unsigned long)rpt->time_end, ctime(&time_flow));
 
-/* function: ftstat_rpt_71_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_71_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+  now = time((time_t*)0L);
 
-  STD_ACCUM_HASH1(ftstat_rpt_71, rpt71, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag, ftch_recprefix_tagp);
+  fprintf(fp, "# now:                  %lu %s", (unsigned long)now,
+    ctime(&now));
 
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DST_TAG(cur,rec,*fo);
- 
-  ftch_recprefix_tag.prefix = cur.srcaddr;
-  ftch_recprefix_tag.tag = cur.dst_tag;
+  if (active_def->max_time)
+    fprintf(fp, "# time-series:          %lu seconds / interval %lu\n",
+      (unsigned long)active_def->max_time,
+      (unsigned long)active_def->interval);
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix_tag.mask = cur.src_mask;
+  if (active_def->window) {
+    fprintf(fp,
+      "# window:               %lu seconds / step %lu / interval %lu\n",
+      (unsigned long)active_def->window, (unsigned long)active_def->slide,
+      (unsigned long)active_def->interval);
+    time_flow = active_def->window_end - active_def->window;
+    fprintf(fp, "# window-start:         %lu %s",
+      (unsigned long)time_flow, ctime(&time_flow));
+    time_flow = active_def->window_end;
+    fprintf(fp, "# window-end:           %lu %s",
+      (unsigned long)time_flow, ctime(&time_flow));
   }
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
+  if (!active_def->interval) {
 
-  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
-    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
-    (ftch_recprefix_tag.mask);
+    /* no ftio when the report was built from state files only */
+    if ((rpt->out->options & FT_STAT_OPT_XHEADER) && ftio)
+      ftio_header_print(ftio, fp, '#');
 
-  STD_ACCUM_HASH2(rpt71, ftch_recprefix_tag, ftch_recprefix_tagp);
+  } /* !active_def->interval */
 
   return 0;
-   
-} /* ftstat_rpt_71_accum */
 
-/* function: ftstat_rpt_71_calc
- *
- * Perform final calculations for rpt71
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_71_calc(struct ftstat_rpt *rpt)
+} /* dump_ascii_header */
+
+static int chash_c32_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1)
 {
+  struct ftsym *ftsym1;
 
-  STD_CALC_HASH(ftstat_rpt_71, rpt71, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag);
+  CHASH_DUMP_INIT(ftchash_rec_c32, ftch_recc32);
 
-} /* ftstat_rpt_71_calc */
+  ftsym1 = (struct ftsym*)0L;
 
-/* function: ftstat_rpt_71_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_71_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+  if (rpt->out->options & FT_STAT_OPT_NAMES)
+    ftsym1 = ftsym_new(sym1);
 
-  STD_DUMP_HASH1P(ftstat_rpt_71, rpt71, chash_prefix_tag_dump,
-    FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK,
-    FT_PATH_SYM_TAG,
-    "", "ip-source-address", "destination-tag", "", "", "", "");
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-} /* ftstat_rpt_71_dump */
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
+      sort_offset = offsetof(struct ftchash_rec_c32, c32);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else
 
-/* function: ftstat_rpt_71_free
- *
- * Free data structures for report allocated by ftstat_rpt_71_new
- *
- */
-void ftstat_rpt_71_free(struct ftstat_rpt_71 *rpt71)
-{
+    CHASH_DUMP_STD_SORT(ftchash_rec_c32);
 
-  STD_FREE_HASH(rpt71);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-} /* ftstat_rpt_71_free */
+  } /* FT_STAT_OPT_SORT */
 
-/* function: ftstat_rpt_72_new
- *
- * Allocate and initialize data structures for rpt 72.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_72 *ftstat_rpt_72_new(struct ftstat_rpt *rpt)
-{
+  ftchash_first(ftch);
 
-  STD_NEW_HASH(ftstat_rpt_72, rpt72, 65536, ftchash_rec_prefix_tag, 12, 65536);
+  while ((ftch_recc32 = ftchash_foreach(ftch))) {
 
-} /* ftstat_rpt_72_new */
+    len = comma = 0;
 
+    DUMP_STD_OUT();
 
-/* function: ftstat_rpt_72_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_72_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc32->c32,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  STD_ACCUM_HASH1(ftstat_rpt_72, rpt72, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag, ftch_recprefix_tagp);
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  FT_RECGET_SRC_TAG(cur,rec,*fo);
- 
-  ftch_recprefix_tag.prefix = cur.dstaddr;
-  ftch_recprefix_tag.tag = cur.src_tag;
+      CHASH_STDP_OUT(ftch_recc32, comma);
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix_tag.mask = cur.dst_mask;
-  }
+    } else {
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
+      CHASH_STD_OUT(ftch_recc32, comma);
 
-  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
-    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
-    (ftch_recprefix_tag.mask);
+    }
 
-  STD_ACCUM_HASH2(rpt72, ftch_recprefix_tag, ftch_recprefix_tagp);
+  }
+
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
   return 0;
-   
-} /* ftstat_rpt_72_accum */
 
-/* function: ftstat_rpt_72_calc
- *
- * Perform final calculations for rpt72
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_72_calc(struct ftstat_rpt *rpt)
+} /* chash_c32_dump */
+
+static int chash_c322_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2)
 {
+  struct ftsym *ftsym1, *ftsym2;
 
-  STD_CALC_HASH(ftstat_rpt_72, rpt72, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag);
+  CHASH_DUMP_INIT(ftchash_rec_c322, ftch_recc322);
 
-} /* ftstat_rpt_72_calc */
+  ftsym1 = ftsym2 = (struct ftsym*)0L;
 
-/* function: ftstat_rpt_72_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_72_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+  if (rpt->out->options & FT_STAT_OPT_NAMES) {
+    ftsym1 = ftsym_new(sym1);
+    ftsym2 = ftsym_new(sym2);
+  }
 
-  STD_DUMP_HASH1P(ftstat_rpt_72, rpt72, chash_prefix_tag_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    FT_PATH_SYM_TAG,
-    "", "ip-destination-address", "source-tag", "", "", "", "");
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-} /* ftstat_rpt_72_dump */
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_c322, c32a);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_c322, c32b);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else
 
-/* function: ftstat_rpt_72_free
- *
- * Free data structures for report allocated by ftstat_rpt_72_new
- *
- */
-void ftstat_rpt_72_free(struct ftstat_rpt_72 *rpt72)
-{
+    CHASH_DUMP_STD_SORT(ftchash_rec_c322);
 
-  STD_FREE_HASH(rpt72);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-} /* ftstat_rpt_72_free */
+  } /* FT_STAT_OPT_SORT */
 
-/* function: ftstat_rpt_73_new
- *
- * Allocate and initialize data structures for rpt 73.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_73 *ftstat_rpt_73_new(struct ftstat_rpt *rpt)
-{
+  ftchash_first(ftch);
 
-  STD_NEW_HASH(ftstat_rpt_73, rpt73, 65536, ftchash_rec_prefix_tag, 12, 65536);
+  while ((ftch_recc322 = ftchash_foreach(ftch))) {
+  
+    len = comma = 0;
+ 
+    DUMP_STD_OUT();
 
-} /* ftstat_rpt_73_new */
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc322->c32a,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
+  
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint32s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc322->c32b,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
+  
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
+      CHASH_STDP_OUT(ftch_recc322, comma);
 
-/* function: ftstat_rpt_73_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_73_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+    } else {
 
-  STD_ACCUM_HASH1(ftstat_rpt_73, rpt73, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag, ftch_recprefix_tagp);
+      CHASH_STD_OUT(ftch_recc322, comma);
 
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  FT_RECGET_DST_TAG(cur,rec,*fo);
- 
-  ftch_recprefix_tag.prefix = cur.dstaddr;
-  ftch_recprefix_tag.tag = cur.dst_tag;
+    }
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix_tag.mask = cur.dst_mask;
   }
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix_tag.prefix &= ipv4_len2mask(ftch_recprefix_tag.mask);
-
-  hash = (ftch_recprefix_tag.tag>>16) ^ (ftch_recprefix_tag.tag & 0xFFFF) ^
-    (ftch_recprefix_tag.prefix>>16) ^ (ftch_recprefix_tag.prefix & 0xFFFF) ^
-    (ftch_recprefix_tag.mask);
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
-  STD_ACCUM_HASH2(rpt73, ftch_recprefix_tag, ftch_recprefix_tagp);
+  if (ftsym2)
+    ftsym_free(ftsym2);
 
   return 0;
-   
-} /* ftstat_rpt_73_accum */
-
-/* function: ftstat_rpt_73_calc
- *
- * Perform final calculations for rpt73
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_73_calc(struct ftstat_rpt *rpt)
-{
-
-  STD_CALC_HASH(ftstat_rpt_73, rpt73, ftchash_rec_prefix_tag,
-    ftch_recprefix_tag);
 
-} /* ftstat_rpt_73_calc */
+} /* chash_c322_dump */
 
-/* function: ftstat_rpt_73_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_73_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+static int chash_c162_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2)
 {
+  struct ftsym *ftsym1, *ftsym2;
 
-  STD_DUMP_HASH1P(ftstat_rpt_73, rpt73, chash_prefix_tag_dump,
-    FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK,
-    FT_PATH_SYM_TAG,
-    "", "ip-destination-address", "destination-tag", "", "", "", "");
+  CHASH_DUMP_INIT(ftchash_rec_c162, ftch_recc162);
 
-} /* ftstat_rpt_73_dump */
+  ftsym1 = ftsym2 = (struct ftsym*)0L;
 
+  if (rpt->out->options & FT_STAT_OPT_NAMES) {
+    ftsym1 = ftsym_new(sym1);
+    ftsym2 = ftsym_new(sym2);
+  }
 
-/* function: ftstat_rpt_73_free
- *
- * Free data structures for report allocated by ftstat_rpt_73_new
- *
- */
-void ftstat_rpt_73_free(struct ftstat_rpt_73 *rpt73)
-{
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-  STD_FREE_HASH(rpt73);
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-} /* ftstat_rpt_73_free */
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_c162, c16a);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_c162, c16b);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else
 
-/* function: ftstat_rpt_74_new
- *
- * Allocate and initialize data structures for rpt 74.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_74 *ftstat_rpt_74_new(struct ftstat_rpt *rpt)
-{
+    CHASH_DUMP_STD_SORT(ftchash_rec_c162);
 
-  STD_NEW_HASH(ftstat_rpt_74, rpt74, 65536, ftchash_rec_prefix2tag2, 24, 65536);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-} /* ftstat_rpt_74_new */
+  } /* FT_STAT_OPT_SORT */
 
+  ftchash_first(ftch);
 
-/* function: ftstat_rpt_74_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_74_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+  while ((ftch_recc162 = ftchash_foreach(ftch))) {
 
-  STD_ACCUM_HASH1(ftstat_rpt_74, rpt74, ftchash_rec_prefix2tag2,
-    ftch_recprefix2tag2, ftch_recprefix2tag2p);
+    len = comma = 0;
 
-  FT_RECGET_SRCADDR(cur,rec,*fo);
-  FT_RECGET_DSTADDR(cur,rec,*fo);
-  FT_RECGET_SRC_TAG(cur,rec,*fo);
-  FT_RECGET_DST_TAG(cur,rec,*fo);
+    DUMP_STD_OUT()
  
-  ftch_recprefix2tag2.src_prefix = cur.srcaddr;
-  ftch_recprefix2tag2.src_tag = cur.src_tag;
-  ftch_recprefix2tag2.dst_prefix = cur.dstaddr;
-  ftch_recprefix2tag2.dst_tag = cur.dst_tag;
-
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_SRC_PREFIX_MASK|FT_STAT_OPT_SRC_PREFIX_LEN)) {
-    FT_RECGET_SRC_MASK(cur,rec,*fo);
-    ftch_recprefix2tag2.src_mask = cur.src_mask;
-  }
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc162->c16a,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
+  
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc162->c16b,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
+  
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  /* only use mask if option set */
-  if (rpt->options & (FT_STAT_OPT_DST_PREFIX_MASK|FT_STAT_OPT_DST_PREFIX_LEN)) {
-    FT_RECGET_DST_MASK(cur,rec,*fo);
-    ftch_recprefix2tag2.src_mask = cur.dst_mask;
-  }
+      CHASH_STDP_OUT(ftch_recc162, comma);
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-    ftch_recprefix2tag2.src_prefix &=
-      ipv4_len2mask(ftch_recprefix2tag2.src_mask);
+    } else {
 
-  /* remove host bits */
-  if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-    ftch_recprefix2tag2.dst_prefix
-      &= ipv4_len2mask(ftch_recprefix2tag2.dst_mask);
+      CHASH_STD_OUT(ftch_recc162, comma);
 
-  hash = (ftch_recprefix2tag2.src_tag>>16) ^
-         (ftch_recprefix2tag2.src_tag & 0xFFFF) ^
-         (ftch_recprefix2tag2.dst_tag>>16) ^
-         (ftch_recprefix2tag2.dst_tag & 0xFFFF) ^
-         (ftch_recprefix2tag2.src_prefix>>16) ^
-         (ftch_recprefix2tag2.src_prefix & 0xFFFF) ^
-         (ftch_recprefix2tag2.dst_prefix>>16) ^
-         (ftch_recprefix2tag2.dst_prefix & 0xFFFF) ^
-         (ftch_recprefix2tag2.src_mask) ^
-         (ftch_recprefix2tag2.dst_mask);
+    }
+  
+  }
+  
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
-  STD_ACCUM_HASH2(rpt74, ftch_recprefix2tag2, ftch_recprefix2tag2p);
+  if (ftsym2)
+    ftsym_free(ftsym2);
 
   return 0;
-   
-} /* ftstat_rpt_74_accum */
-
-/* function: ftstat_rpt_74_calc
- *
- * Perform final calculations for rpt74
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_74_calc(struct ftstat_rpt *rpt)
-{
-
-  STD_CALC_HASH(ftstat_rpt_74, rpt74, ftchash_rec_prefix2tag2,
-    ftch_recprefix2tag2);
 
-} /* ftstat_rpt_74_calc */
+} /* chash_c162_dump */
 
-/* function: ftstat_rpt_74_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_74_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+static int chash_c163_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2, const char *sym3)
 {
+  struct ftsym *ftsym1, *ftsym2, *ftsym3;
 
-  STD_DUMP_HASH1(ftstat_rpt_74, rpt74, chash_prefix2tag2_dump,
-    FT_PATH_SYM_TAG,
-    "", "ip-source-address", "ip-destination-address", "source-tag",
-    "destination-tag", "", "");
+  CHASH_DUMP_INIT(ftchash_rec_c163, ftch_recc163);
 
-} /* ftstat_rpt_74_dump */
+  ftsym1 = ftsym2 = ftsym3 = (struct ftsym*)0L;
 
+  if (rpt->out->options & FT_STAT_OPT_NAMES) {
+    ftsym1 = ftsym_new(sym1);
+    ftsym2 = ftsym_new(sym2);
+    ftsym3 = ftsym_new(sym3);
+  }
 
-/* function: ftstat_rpt_74_free
- *
- * Free data structures for report allocated by ftstat_rpt_74_new
- *
- */
-void ftstat_rpt_74_free(struct ftstat_rpt_74 *rpt74)
-{
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-  STD_FREE_HASH(rpt74);
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-} /* ftstat_rpt_74_free */
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_c163, c16a);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_c163, c16b);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_c163, c16c);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else 
 
-/* function: ftstat_rpt_75_new
- *
- * Allocate and initialize data structures for rpt 75.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_75 *ftstat_rpt_75_new(struct ftstat_rpt *rpt)
-{
+    CHASH_DUMP_STD_SORT(ftchash_rec_c163);
 
-  STD_NEW_HASH(ftstat_rpt_75, rpt75, 65536, ftchash_rec_int, 4, 65536);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-} /* ftstat_rpt_75_new */
+  } /* FT_STAT_OPT_SORT */
 
+  ftchash_first(ftch);
 
-/* function: ftstat_rpt_75_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_75_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
-  struct fttime start, end;
-  uint32_t i;
-  double p_flows, p_octets, p_packets, d;
+  while ((ftch_recc163 = ftchash_foreach(ftch))) {
 
-  STD_ACCUM_HASH1(ftstat_rpt_75, rpt75, ftchash_rec_int,
-    ftch_recint, ftch_recintp);
+    len = comma = 0;
 
-  FT_RECGET_SYSUPTIME(cur,rec,*fo);
-  FT_RECGET_UNIX_SECS(cur,rec,*fo);
-  FT_RECGET_UNIX_NSECS(cur,rec,*fo);
-  FT_RECGET_FIRST(cur,rec,*fo);
-  FT_RECGET_LAST(cur,rec,*fo);
+    DUMP_STD_OUT()
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc163->c16a,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  start = ftltime(cur.sysUpTime, cur.unix_secs, cur.unix_nsecs, cur.First);
-  end = ftltime(cur.sysUpTime, cur.unix_secs, cur.unix_nsecs, cur.Last);
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc163->c16b,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  d = (end.secs - start.secs) + 1;
+    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym3, FMT_SYM_LEN, fmt_buf+len, ftch_recc163->c16c,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  p_flows = (double)cur.dFlows64 / d;
-  p_octets = (double)cur.dOctets64 / d;
-  p_packets = (double)cur.dPkts64 / d;
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  for (i = start.secs; i <= end.secs; ++i) {
+      CHASH_STDP_OUT(ftch_recc163, comma);
 
-    ftch_recint.time = i;
+    } else {
 
-    hash = (i>>16) ^ (i & 0xFFFF);
+      CHASH_STD_OUT(ftch_recc163, comma);
 
-    if (!(ftch_recintp = ftchash_update(rpt75->ftch, &ftch_recint, hash))) {
-      fterr_warnx("ftch_update(): failed");
-      return -1;
     }
 
-    ftch_recintp->nflows += p_flows;
-    ftch_recintp->noctets += p_octets;
-    ftch_recintp->npackets += p_packets;
-
   }
-  
-  return 0;
-   
-} /* ftstat_rpt_75_accum */
-
-/* function: ftstat_rpt_75_calc
- *
- * Perform final calculations for rpt75
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_75_calc(struct ftstat_rpt *rpt)
-{
-  struct ftstat_rpt_75 *rpt75;
 
-  rpt75 = rpt->data;
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
-  STD_CALC;
+  if (ftsym2)
+    ftsym_free(ftsym2);
 
-  rpt->recs = rpt75->ftch->entries;
+  if (ftsym3)
+    ftsym_free(ftsym3);
 
   return 0;
 
-} /* ftstat_rpt_75_calc */
+} /* chash_c163_dump */
 
-/* function: ftstat_rpt_75_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_75_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
+static int chash_c164_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2, const char *sym3, const char *sym4)
 {
+  struct ftsym *ftsym1, *ftsym2, *ftsym3, *ftsym4;
 
-  STD_DUMP_HASH0(ftstat_rpt_75, rpt75, chash_int_dump,
-    "unix-secs", "", "", "", "", "", "");
+  CHASH_DUMP_INIT(ftchash_rec_c164, ftch_recc164);
 
-} /* ftstat_rpt_75_dump */
+  ftsym1 = ftsym2 = ftsym3 = ftsym4 = (struct ftsym*)0L;
 
+  if (rpt->out->options & FT_STAT_OPT_NAMES) {
+    ftsym1 = ftsym_new(sym1);
+    ftsym2 = ftsym_new(sym2);
+    ftsym3 = ftsym_new(sym3);
+    ftsym4 = ftsym_new(sym4);
+  }
 
-/* function: ftstat_rpt_75_free
- *
- * Free data structures for report allocated by ftstat_rpt_75_new
- *
- */
-void ftstat_rpt_75_free(struct ftstat_rpt_75 *rpt75)
-{
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-  STD_FREE_HASH(rpt75);
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-} /* ftstat_rpt_75_free */
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_c164, c16a);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_c164, c16b);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_c164, c16c);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
+      sort_offset = offsetof(struct ftchash_rec_c164, c16d);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else
 
-/* function: ftstat_rpt_76_new
- *
- * Allocate and initialize data structures for rpt 76.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_76 *ftstat_rpt_76_new(struct ftstat_rpt *rpt)
-{
+    CHASH_DUMP_STD_SORT(ftchash_rec_c164);
 
-  STD_NEW_HASH(ftstat_rpt_76, rpt76, 65536, ftchash_rec_c32, 4, 65536);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-} /* ftstat_rpt_76_new */
+  } /* FT_STAT_OPT_SORT */
 
+  ftchash_first(ftch);
 
-/* function: ftstat_rpt_76_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_76_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+  while ((ftch_recc164 = ftchash_foreach(ftch))) {
 
-  STD_ACCUM_HASH1(ftstat_rpt_76, rpt76, ftchash_rec_c32,
-    ftch_recc32, ftch_recc32p);
+    len = comma = 0;
 
-  ftch_recc32.c32 = cur.First;
+    DUMP_STD_OUT();
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16a,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16b,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  STD_ACCUM_HASH2(rpt76, ftch_recc32, ftch_recc32p);
-  
-  return 0;
-   
-} /* ftstat_rpt_76_accum */
+    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym3, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16c,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-/* function: ftstat_rpt_76_calc
- *
- * Perform final calculations for rpt76
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_76_calc(struct ftstat_rpt *rpt)
-{
+    if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym4, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16d,
+        FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-  STD_CALC_HASH(ftstat_rpt_76, rpt76, ftchash_rec_c32, ftch_recc32);
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-} /* ftstat_rpt_76_calc */
+      CHASH_STDP_OUT(ftch_recc164, comma);
 
-/* function: ftstat_rpt_76_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_76_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+    } else {
 
-  STD_DUMP_HASH1(ftstat_rpt_76, rpt76, chash_c32_dump, (char*)0L,
-    "First", "", "", "", "", "", "");
+      CHASH_STD_OUT(ftch_recc164, comma);
 
-} /* ftstat_rpt_76_dump */
+    }
 
+  }
 
-/* function: ftstat_rpt_76_free
- *
- * Free data structures for report allocated by ftstat_rpt_76_new
- *
- */
-void ftstat_rpt_76_free(struct ftstat_rpt_76 *rpt76)
-{
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
-  STD_FREE_HASH(rpt76);
+  if (ftsym2)
+    ftsym_free(ftsym2);
 
-} /* ftstat_rpt_76_free */
+  if (ftsym3)
+    ftsym_free(ftsym3);
 
+  if (ftsym4)
+    ftsym_free(ftsym4);
 
-/* function: ftstat_rpt_77_new
- *
- * Allocate and initialize data structures for rpt 77.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_77 *ftstat_rpt_77_new(struct ftstat_rpt *rpt)
-{
 
-  STD_NEW_HASH(ftstat_rpt_77, rpt77, 65536, ftchash_rec_c32, 4, 65536);
+  return 0;
 
-} /* ftstat_rpt_77_new */
+} /* chash_c163_dump */
 
 
-/* function: ftstat_rpt_77_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_77_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
+
+static int chash_ip_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch)
 {
 
-  STD_ACCUM_HASH1(ftstat_rpt_77, rpt77, ftchash_rec_c32,
-    ftch_recc32, ftch_recc32p);
+  CHASH_DUMP_INIT(ftchash_rec_c32, ftch_recc32);
 
-  ftch_recc32.c32 = cur.Last;
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-  STD_ACCUM_HASH2(rpt77, ftch_recc32, ftch_recc32p);
-  
-  return 0;
-   
-} /* ftstat_rpt_77_accum */
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
+      sort_offset = offsetof(struct ftchash_rec_c32, c32);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else
 
-/* function: ftstat_rpt_77_calc
- *
- * Perform final calculations for rpt77
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_77_calc(struct ftstat_rpt *rpt)
-{
+    CHASH_DUMP_STD_SORT(ftchash_rec_c32);
 
-  STD_CALC_HASH(ftstat_rpt_77, rpt77, ftchash_rec_c32, ftch_recc32);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-} /* ftstat_rpt_77_calc */
+  } /* FT_STAT_OPT_SORT */
 
-/* function: ftstat_rpt_77_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_77_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+  ftchash_first(ftch);
 
-  STD_DUMP_HASH1(ftstat_rpt_77, rpt77, chash_c32_dump, (char*)0L,
-    "Last", "", "", "", "", "", "");
+  while ((ftch_recc32 = ftchash_foreach(ftch))) {
 
-} /* ftstat_rpt_77_dump */
+    len = comma = 0;
 
+    DUMP_STD_OUT();
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_ipv4s(fmt_buf+len, ftch_recc32->c32, 64, fmt);
+      comma = 1;
+    }
 
-/* function: ftstat_rpt_77_free
- *
- * Free data structures for report allocated by ftstat_rpt_77_new
- *
- */
-void ftstat_rpt_77_free(struct ftstat_rpt_77 *rpt77)
-{
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  STD_FREE_HASH(rpt77);
+      CHASH_STDP_OUT(ftch_recc32, comma);
 
-} /* ftstat_rpt_77_free */
+    } else {
 
+      CHASH_STD_OUT(ftch_recc32, comma);
 
-/* function: ftstat_rpt_78_new
- *
- * Allocate and initialize data structures for rpt 78.
- *
- * returns allocated struct or 0L for error
- */
-struct ftstat_rpt_78 *ftstat_rpt_78_new(struct ftstat_rpt *rpt)
+    }
+
+  }
+
+  return 0;
+
+} /* chash_ip_dump */
+
+static int chash_prefix_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, int f1)
 {
 
-  STD_NEW_HASH(ftstat_rpt_78, rpt78, 65536, ftchash_rec_c32, 4, 65536);
+  CHASH_DUMP_INIT(ftchash_rec_prefix, ftch_recprefix);
 
-} /* ftstat_rpt_78_new */
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-/* function: ftstat_rpt_78_accum
- *
- * Accumulate counters for report by processing flow.
- *
- * returns 0: ok
- *        !0: error
- */
-int ftstat_rpt_78_accum(struct ftstat_rpt *rpt, char *rec,
-  struct fts3rec_offsets *fo)
-{
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
+      sort_offset = offsetof(struct ftchash_rec_prefix, prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else 
 
-  STD_ACCUM_HASH1(ftstat_rpt_78, rpt78, ftchash_rec_c32,
-    ftch_recc32, ftch_recc32p);
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix);
 
-  ftch_recc32.c32 = cur.Last - cur.First;
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-  hash = (ftch_recc32.c32>>16) ^ (ftch_recc32.c32 & 0xFFFF);
+  } /* FT_STAT_OPT_SORT */
 
-  STD_ACCUM_HASH2(rpt78, ftch_recc32, ftch_recc32p);
-  
-  return 0;
-   
-} /* ftstat_rpt_78_accum */
+  ftchash_first(ftch);
 
-/* function: ftstat_rpt_78_calc
- *
- * Perform final calculations for rpt78
- *
- * returns allocated struct or 0L for error
- */
-int ftstat_rpt_78_calc(struct ftstat_rpt *rpt)
-{
+  while ((ftch_recprefix = ftchash_foreach(ftch))) {
 
-  STD_CALC_HASH(ftstat_rpt_78, rpt78, ftchash_rec_c32, ftch_recc32);
+    len = comma = 0;
 
-} /* ftstat_rpt_78_calc */
+    DUMP_STD_OUT();
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options & f1)
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix->prefix,
+          ftch_recprefix->mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix->prefix, 64, fmt);
+      comma = 1;
+    }
 
-/* function: ftstat_rpt_78_dump
- *
- * Dump data for report.
- *
- */
-int ftstat_rpt_78_dump(FILE *fp, struct ftio *ftio, struct ftstat_rpt *rpt)
-{
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  STD_DUMP_HASH1(ftstat_rpt_78, rpt78, chash_c32_dump, (char*)0L,
-    "Duration", "", "", "", "", "", "");
+      CHASH_STDP_OUT(ftch_recprefix, comma);
 
-} /* ftstat_rpt_78_dump */
+    } else {
 
+      CHASH_STD_OUT(ftch_recprefix, comma);
 
-/* function: ftstat_rpt_78_free
- *
- * Free data structures for report allocated by ftstat_rpt_78_new
- *
- */
-void ftstat_rpt_78_free(struct ftstat_rpt_78 *rpt78)
-{
+    }
 
-  STD_FREE_HASH(rpt78);
+  }
 
-} /* ftstat_rpt_78_free */
+  return 0;
 
-/*
- * function: resolve_reports
- *
- * resolve the dangling pointers to rpts in definitions --
- * allows definitions to be defined before reports.
- *
- * _must_ be called after work done by parse_def_report
- *
- * returns: 0  ok
- *          <0 fail
- */
-static int resolve_reports(struct ftstat *ftstat)
+} /* chash_prefix_dump */
+
+static int chash_prefix_tag_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, int f1)
 {
-  struct ftstat_rpt_item *ftsrpti;
-  struct ftstat_def *ftsd;
-  struct ftstat_rpt *ftsrpt;
-  int found;
+  struct ftsym *ftsym1;
 
-  /* foreach definition */
-  FT_SLIST_FOREACH(ftsd, &ftstat->defs, chain) {
+  CHASH_DUMP_INIT(ftchash_rec_prefix_tag, ftch_recprefix_tag);
 
-    /* foreach report in the definition */
-    FT_STAILQ_FOREACH(ftsrpti, &ftsd->items, chain) {
+  ftsym1 = (struct ftsym*)0L;
 
-      /* find the report */
-      found = 0;
+  if (rpt->out->options & FT_STAT_OPT_NAMES)
+    ftsym1 = ftsym_new(sym1);
 
-      FT_SLIST_FOREACH(ftsrpt, &ftstat->rpts, chain) {
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-        if (!strcasecmp(ftsrpti->tmp_report, ftsrpt->name)) {
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-          found = 1;
-          break;
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix_tag, prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_prefix_tag, tag);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else
 
-        } /* if */
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix_tag);
 
-      } /* ftsrpt */
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-      if (!found) {
-        fterr_warnx(
-          "Unable to resolve report \"%s\" in stat-definition \"%s\".",
-          ftsrpti->tmp_report, ftsd->name);
-        return -1;
-      } /* !found */
+  } /* FT_STAT_OPT_SORT */
 
-      /* report found */
-      ftsrpti->rpt = ftsrpt;
-      ftsd->xfields |= ftsrpt->xfields;
+  ftchash_first(ftch);
 
-    } /* ftsrpti */
+  while ((ftch_recprefix_tag = ftchash_foreach(ftch))) {
 
-  } /* ftsd */
+    len = comma = 0;
 
-  return 0;
+    DUMP_STD_OUT();
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options & f1)
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix_tag->prefix,
+          ftch_recprefix_tag->mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix_tag->prefix, 64, fmt);
+      comma = 1;
+    }
 
-} /* resolve_reports */
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix_tag->tag, FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-static int dump_ascii_header(FILE *fp, struct ftio *ftio,
-  struct ftstat_def *active_def, struct ftstat_rpt *rpt)
-{
-  int comma, sort_field;
-  char *buf, fmt_buf[32];
-  time_t now, time_flow;
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  /* shortcut */
-  if (!(rpt->out->options & FT_STAT_OPT_HEADER))
-    return 0;
+      CHASH_STDP_OUT(ftch_recprefix_tag, comma);
 
-  if (!active_def->interval) {
+    } else {
 
-    fprintf(fp, "#  --- ---- ---- Report Information --- --- ---\n");
-    fprintf(fp, "# build-version:        flow-tools %s\n", VERSION);
-    fprintf(fp, "# name:                 %s\n", rpt->name);
-    fprintf(fp, "# type:                 %s\n", rpt->format_name);
-    if (rpt->scale)
-      fprintf(fp, "# scale:                %lu\n", (unsigned long)rpt->scale);
- 
-    if (rpt->out->options) {
+      CHASH_STD_OUT(ftch_recprefix_tag, comma);
 
-      fprintf(fp, "# options:              ");
+    }
 
-      comma = 0;
+  }
 
-      if (rpt->out->options & FT_STAT_OPT_PERCENT) {
-        fprintf(fp, "+percent-total");
-        comma=1;
-      }
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
-      if (rpt->out->options & FT_STAT_OPT_NAMES) {
-        fprintf(fp, "%snames", comma ? ",+" : "+");
-        comma=1;
-      }
+  return 0;
 
-      if (rpt->out->options & FT_STAT_OPT_HEADER) {
-        fprintf(fp, "%sheader", comma ? ",+" : "+");
-        comma=1;
-      }
+} /* chash_prefix_tag_dump */
 
-      if (rpt->out->options & FT_STAT_OPT_XHEADER) {
-        fprintf(fp, "%sxheader", comma ? ",+" : "+");
-        comma=1;
-      }
+static int chash_prefix2tag2_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1)
+{
+  struct ftsym *ftsym1;
 
-      if (rpt->out->options & FT_STAT_OPT_TOTALS) {
-        fprintf(fp, "%stotals", comma ? ",+" : "+");
-        comma=1;
-      }
+  CHASH_DUMP_INIT(ftchash_rec_prefix2tag2, ftch_recprefix2tag2);
 
-      fprintf(fp, "\n");
+  ftsym1 = (struct ftsym*)0L;
 
-    } /* options */
+  if (rpt->out->options & FT_STAT_OPT_NAMES)
+    ftsym1 = ftsym_new(sym1);
 
-    if (rpt->xfields & FT_XFIELD_SRCADDR) {
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-      fprintf(fp, "# ip-src-addr-type:     ");
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-      if (rpt->options & FT_STAT_OPT_SRC_PREFIX_LEN)
-        fprintf(fp, "prefix-len\n");
-      else if (rpt->options & FT_STAT_OPT_SRC_PREFIX_MASK)
-        fprintf(fp, "prefix-mask\n");
-      else
-        fprintf(fp, "address\n");
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, src_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, dst_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, src_tag);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, dst_tag);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else
 
-    }
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix2tag2);
 
-    if (rpt->xfields & FT_XFIELD_DSTADDR) {
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-      fprintf(fp, "# ip-dst-addr-type:     ");
+  } /* FT_STAT_OPT_SORT */
 
-      if (rpt->options & FT_STAT_OPT_DST_PREFIX_LEN)
-        fprintf(fp, "prefix-len\n");
-      else if (rpt->options & FT_STAT_OPT_DST_PREFIX_MASK)
-        fprintf(fp, "prefix-mask\n");
-      else
-        fprintf(fp, "address\n");
+  ftchash_first(ftch);
 
-    }
+  while ((ftch_recprefix2tag2 = ftchash_foreach(ftch))) {
 
+    len = comma = 0;
 
-    if (rpt->out->options & FT_STAT_OPT_SORT) {
-  
-      sort_field = rpt->out->sort_field;
-      if (sort_field < 0)
-        sort_field *= -1;
-  
-      if (sort_field & FT_STAT_FIELD_KEY)
-        buf = "key";
-      else if (sort_field & FT_STAT_FIELD_KEY1)
-        buf = "key1";
-      else if (sort_field & FT_STAT_FIELD_KEY2)
-        buf = "key2";
-      else if (sort_field & FT_STAT_FIELD_KEY3)
-        buf = "key3";
-      else if (sort_field & FT_STAT_FIELD_KEY4)
-        buf = "key4";
-      else if (sort_field & FT_STAT_FIELD_KEY5)
-        buf = "key5";
-      else if (sort_field & FT_STAT_FIELD_KEY6)
-        buf = "key6";
-      else if (sort_field & FT_STAT_FIELD_FLOWS)
-        buf = "flows";
-      else if (sort_field & FT_STAT_FIELD_OCTETS)
-        buf = "octets";
-      else if (sort_field & FT_STAT_FIELD_PACKETS)
-        buf = "packets";
-      else if (sort_field & FT_STAT_FIELD_DURATION)
-        buf = "duration";
-      else if (sort_field & FT_STAT_FIELD_AVG_PPS)
-        buf = "avg-pps";
-      else if (sort_field & FT_STAT_FIELD_MIN_PPS)
-        buf = "min-pps";
-      else if (sort_field & FT_STAT_FIELD_MAX_PPS)
-        buf = "max-pps";
-      else if (sort_field & FT_STAT_FIELD_AVG_BPS)
-        buf = "avg-bps";
-      else if (sort_field & FT_STAT_FIELD_MIN_BPS)
-        buf = "min-bps";
-      else if (sort_field & FT_STAT_FIELD_MAX_BPS)
-        buf = "max-bps";
-      else if (sort_field & FT_STAT_FIELD_OTHER)
-        buf = "other";
-      else if (sort_field & FT_STAT_FIELD_COUNT)
-        buf = "count";
+    DUMP_STD_OUT();
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options &
+        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2tag2->src_prefix,
+          ftch_recprefix2tag2->src_mask, 64, fmt);
       else
-        buf = "error";
-
-      fprintf(fp, "# sort_field:           %c%s\n",
-        (rpt->out->sort_field < 0) ? '-' : '+', buf);
-
-    } /* FT_STAT_OPT_SORT */
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2tag2->src_prefix,
+          64, fmt);
+      comma = 1;
+    }
 
-    if (rpt->out->fields) {
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options &
+        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2tag2->dst_prefix,
+          ftch_recprefix2tag2->dst_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2tag2->dst_prefix,
+          64, fmt);
+      comma = 1;
+    }
 
-      fprintf(fp, "# fields:               ");
+    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix2tag2->src_tag, FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-      comma = 0;
-      if (rpt->out->fields & FT_STAT_FIELD_KEY) {
-        fprintf(fp, "+key");
-        comma = 1;
-      }
+    if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix2tag2->dst_tag, FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-        fprintf(fp, "%skey1", comma ? ",+" : "+");
-        comma = 1;
-      }
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-        fprintf(fp, "%skey2", comma ? ",+" : "+");
-        comma = 1;
-      }
+      CHASH_STDP_OUT(ftch_recprefix2tag2, comma);
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
-        fprintf(fp, "%skey3", comma ? ",+" : "+");
-        comma = 1;
-      }
+    } else {
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
-        fprintf(fp, "%skey4", comma ? ",+" : "+");
-        comma = 1;
-      }
+      CHASH_STD_OUT(ftch_recprefix2tag2, comma);
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY5) {
-        fprintf(fp, "%skey5", comma ? ",+" : "+");
-        comma = 1;
-      }
+    }
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY6) {
-        fprintf(fp, "%skey6", comma ? ",+" : "+");
-        comma = 1;
-      }
+  }
 
-      if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
-        fprintf(fp, "%sflows", comma ? ",+" : "+");
-        comma = 1;
-      }
+  if (ftsym1)
+    ftsym_free(ftsym1);
 
-      if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
-        fprintf(fp, "%soctets", comma ? ",+" : "+");
-        comma = 1;
-      }
+  return 0;
 
-      if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
-        fprintf(fp, "%spackets", comma ? ",+" : "+");
-        comma = 1;
-      }
+} /* chash_prefix2tag2_dump */
 
-      if (rpt->out->fields & FT_STAT_FIELD_DURATION) {
-        fprintf(fp, "%sduration", comma ? ",+" : "+");
-        comma = 1;
-      }
 
-      if (rpt->out->fields & FT_STAT_FIELD_AVG_PPS) {
-        fprintf(fp, "%savg-pps", comma ? ",+" : "+");
-        comma = 1;
-      }
 
-      if (rpt->out->fields & FT_STAT_FIELD_MIN_PPS) {
-        fprintf(fp, "%smin-pps", comma ? ",+" : "+");
-        comma = 1;
-      }
+static int chash_prefixh_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, int f1)
+{
 
-      if (rpt->out->fields & FT_STAT_FIELD_MAX_PPS) {
-        fprintf(fp, "%smax-pps", comma ? ",+" : "+");
-        comma = 1;
-      }
+  CHASH_DUMP_INIT(ftchash_rec_prefixh, ftch_recprefixh);
 
-      if (rpt->out->fields & FT_STAT_FIELD_AVG_BPS) {
-        fprintf(fp, "%savg-bps", comma ? ",+" : "+");
-        comma = 1;
-      }
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
-      if (rpt->out->fields & FT_STAT_FIELD_MIN_BPS) {
-        fprintf(fp, "%smin-bps", comma ? ",+" : "+");
-        comma = 1;
-      }
+    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+      sort_flags = FT_CHASH_SORT_ASCENDING;
+    else
+      sort_flags = 0;
 
-      if (rpt->out->fields & FT_STAT_FIELD_MAX_BPS) {
-        fprintf(fp, "%smax-bps", comma ? ",+" : "+");
-        comma = 1;
-      }
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
+      sort_offset = offsetof(struct ftchash_rec_prefixh, prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_COUNT) {
+      sort_offset = offsetof(struct ftchash_rec_prefixh, nprefixes);
+      sort_flags |= FT_CHASH_SORT_64;
+    } else
 
-      if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
-        fprintf(fp, "%sfrecs", comma ? ",+" : "+");
-        comma = 1;
-      }
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefixh);
 
-      if (rpt->out->fields & FT_STAT_FIELD_OTHER) {
-        fprintf(fp, "%sother", comma ? ",+" : "+");
-        comma = 1;
-      }
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-      fprintf(fp, "\n");
+  } /* FT_STAT_OPT_SORT */
 
-    } /* rpt->out->fields */
+  ftchash_first(ftch);
 
-    if (rpt->out->options & FT_STAT_OPT_TALLY)
-      fprintf(fp, "# tally:                %lu\n",
-        (unsigned long)rpt->out->tally);
+  while ((ftch_recprefixh = ftchash_foreach(ftch))) {
 
-    if (active_def->ftd)
-      fprintf(fp, "# tag:                  %s\n", active_def->ftd->name);
+    len = comma = 0;
 
-    if (active_def->ftfd)
-      fprintf(fp, "# pre-filter:           %s\n", active_def->ftfd->name);
+    DUMP_STD_OUT();
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options & f1)
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefixh->prefix,
+          ftch_recprefixh->mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefixh->prefix, 64, fmt);
+      comma = 1;
+    }
 
-    if (rpt->ftfd)
-      fprintf(fp, "# filter:               %s\n", rpt->ftfd->name);
+    if (rpt->out->fields & FT_STAT_FIELD_COUNT) {
 
-  } /* !active_def->interval */
+      if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  fmt_uint64(fmt_buf, rpt->recs, FMT_JUST_LEFT);
-    fprintf(fp, "# records:              %s\n", fmt_buf);
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+          ((double)ftch_recprefixh->nprefixes / rpt->t_count)*100.0);
+        comma = 1;
 
-  if (rpt->out->records) {
-    fmt_uint64(fmt_buf, rpt->out->records, FMT_JUST_LEFT);
-    fprintf(fp, "# records_shown:      %s\n", fmt_buf);
-  }
+      } else {
 
-  time_flow = rpt->time_start;
-  fprintf(fp, "# first-flow:           %lu %s",
-    (unsigned long)rpt->time_start, ctime(&time_flow));
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint64(fmt_buf+len, ftch_recprefixh->nprefixes,
+          FMT_JUST_LEFT);
+        comma = 1;
 
-  time_flow = rpt->time_end;
-  fprintf(fp, "# last-flow:            %lu %s",
-    (unsigned long)rpt->time_end, ctime(&time_flow));
+      }
+    }
 
-  now = time((time_t*)0L);
+    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-  fprintf(fp, "# now:                  %lu %s", (unsigned long)now,
-    ctime(&now));
+      CHASH_STDP_OUT(ftch_recprefixh, comma);
 
-  if (active_def->max_time)
-    fprintf(fp, "# time-series:          %lu seconds / interval %lu\n",
-      (unsigned long)active_def->max_time,
-      (unsigned long)active_def->interval);
+    } else {
 
-  if (!active_def->interval) {
+      CHASH_STD_OUT(ftch_recprefixh, comma);
 
-    if (rpt->out->options & FT_STAT_OPT_XHEADER)
-      ftio_header_print(ftio, fp, '#');
+    }
 
-  } /* !active_def->interval */
+  }
 
   return 0;
 
-} /* dump_ascii_header */
+} /* chash_prefixh_dump */
 
-static int chash_c32_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1)
+static int chash_prefix2_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch)
 {
-  struct ftsym *ftsym1;
-
-  CHASH_DUMP_INIT(ftchash_rec_c32, ftch_recc32);
-
-  ftsym1 = (struct ftsym*)0L;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES)
-    ftsym1 = ftsym_new(sym1);
+  CHASH_DUMP_INIT(ftchash_rec_prefix2, ftch_recprefix2);
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -12668,64 +18764,78 @@ static int chash_c32_dump(FILE *fp, struct ftstat_rpt *rpt,
     else
       sort_flags = 0;
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      sort_offset = offsetof(struct ftchash_rec_c32, c32);
-      sort_flags |= FT_CHASH_SORT_32;
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2, src_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2, dst_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c32);
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix2);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recc32 = ftchash_foreach(ftch))) {
+  while ((ftch_recprefix2 = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
     DUMP_STD_OUT();
-
-    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+ 
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc32->c32,
-        FMT_JUST_LEFT);
+      if (rpt->options &
+        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2->src_prefix,
+          ftch_recprefix2->src_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2->src_prefix, 64, fmt);
+      comma = 1;
+    }
+
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma)
+        fmt_buf[len++] = ',';
+      if (rpt->options &
+        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2->dst_prefix,
+          ftch_recprefix2->dst_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2->dst_prefix, 64, fmt);
       comma = 1;
     }
 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recc32, comma);
+      CHASH_STDP_OUT(ftch_recprefix2, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recc32, comma);
+      CHASH_STD_OUT(ftch_recprefix2, comma);
 
     }
 
   }
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
-
   return 0;
 
-} /* chash_c32_dump */
+} /* chash_prefix2_dump */
 
-static int chash_c322_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2)
+static int chash_prefix16_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, int f1)
 {
-  struct ftsym *ftsym1, *ftsym2;
+  struct ftsym *ftsym1;
 
-  CHASH_DUMP_INIT(ftchash_rec_c322, ftch_recc322);
+  CHASH_DUMP_INIT(ftchash_rec_prefix16, ftch_recprefix16);
 
-  ftsym1 = ftsym2 = (struct ftsym*)0L;
+  ftsym1 = (struct ftsym*)0L;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES) {
+  if (rpt->out->options & FT_STAT_OPT_NAMES)
     ftsym1 = ftsym_new(sym1);
-    ftsym2 = ftsym_new(sym2);
-  }
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -12734,49 +18844,52 @@ static int chash_c322_dump(FILE *fp, struct ftstat_rpt *rpt,
     else
       sort_flags = 0;
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_c322, c32a);
-      sort_flags |= FT_CHASH_SORT_32;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_c322, c32b);
-      sort_flags |= FT_CHASH_SORT_32;
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_prefix16, c16);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix16, prefix);
+      sort_flags |= FT_CHASH_SORT_40;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c322);
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix16);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recc322 = ftchash_foreach(ftch))) {
-  
+  while ((ftch_recprefix16 = ftchash_foreach(ftch))) {
+
     len = comma = 0;
- 
+
     DUMP_STD_OUT();
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc322->c32a,
-        FMT_JUST_LEFT);
+      if (rpt->options & f1)
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix16->prefix,
+          ftch_recprefix16->mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix16->prefix, 64, fmt);
       comma = 1;
     }
-  
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc322->c32b,
-        FMT_JUST_LEFT);
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix16->c16, FMT_JUST_LEFT);
       comma = 1;
     }
-  
+ 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recc322, comma);
+      CHASH_STDP_OUT(ftch_recprefix16, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recc322, comma);
+      CHASH_STD_OUT(ftch_recprefix16, comma);
 
     }
 
@@ -12785,19 +18898,16 @@ static int chash_c322_dump(FILE *fp, struct ftstat_rpt *rpt,
   if (ftsym1)
     ftsym_free(ftsym1);
 
-  if (ftsym2)
-    ftsym_free(ftsym2);
-
   return 0;
 
-} /* chash_c322_dump */
+} /* chash_prefix16_dump */
 
-static int chash_c162_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2)
+static int chash_prefix162_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2, int f1)
 {
   struct ftsym *ftsym1, *ftsym2;
 
-  CHASH_DUMP_INIT(ftchash_rec_c162, ftch_recc162);
+  CHASH_DUMP_INIT(ftchash_rec_prefix162, ftch_recprefix162);
 
   ftsym1 = ftsym2 = (struct ftsym*)0L;
 
@@ -12813,54 +18923,69 @@ static int chash_c162_dump(FILE *fp, struct ftstat_rpt *rpt,
     else
       sort_flags = 0;
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_c162, c16a);
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_prefix162, c16b);
       sort_flags |= FT_CHASH_SORT_16;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_c162, c16b);
+      sort_offset = offsetof(struct ftchash_rec_prefix162, c16a);
       sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix162, prefix);
+      sort_flags |= FT_CHASH_SORT_40;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c162);
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix162);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recc162 = ftchash_foreach(ftch))) {
+  while ((ftch_recprefix162 = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
-    DUMP_STD_OUT()
- 
+    DUMP_STD_OUT();
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc162->c16a,
-        FMT_JUST_LEFT);
+      if (rpt->options & f1)
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix162->prefix,
+          ftch_recprefix162->mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix162->prefix, 64, fmt);
       comma = 1;
     }
-  
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc162->c16b,
-        FMT_JUST_LEFT);
+      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix162->c16a, FMT_JUST_LEFT);
       comma = 1;
     }
-  
+
+
+    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix162->c16b, FMT_JUST_LEFT);
+      comma = 1;
+    }
+
+
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recc162, comma);
+      CHASH_STDP_OUT(ftch_recprefix162, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recc162, comma);
+      CHASH_STD_OUT(ftch_recprefix162, comma);
 
     }
-  
+
   }
-  
+
   if (ftsym1)
     ftsym_free(ftsym1);
 
@@ -12869,22 +18994,21 @@ static int chash_c162_dump(FILE *fp, struct ftstat_rpt *rpt,
 
   return 0;
 
-} /* chash_c162_dump */
+} /* chash_prefix162_dump */
 
-static int chash_c163_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2, const char *sym3)
+
+
+static int chash_prefix216_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1)
 {
-  struct ftsym *ftsym1, *ftsym2, *ftsym3;
+  struct ftsym *ftsym1;
 
-  CHASH_DUMP_INIT(ftchash_rec_c163, ftch_recc163);
+  CHASH_DUMP_INIT(ftchash_rec_prefix216, ftch_recprefix216);
 
-  ftsym1 = ftsym2 = ftsym3 = (struct ftsym*)0L;
+  ftsym1 = (struct ftsym*)0L;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES) {
+  if (rpt->out->options & FT_STAT_OPT_NAMES)
     ftsym1 = ftsym_new(sym1);
-    ftsym2 = ftsym_new(sym2);
-    ftsym3 = ftsym_new(sym3);
-  }
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -12893,59 +19017,68 @@ static int chash_c163_dump(FILE *fp, struct ftstat_rpt *rpt,
     else
       sort_flags = 0;
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_c163, c16a);
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_prefix216, c16);
       sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix216, src_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_c163, c16b);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_c163, c16c);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else 
+      sort_offset = offsetof(struct ftchash_rec_prefix216, dst_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c163);
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix216);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recc163 = ftchash_foreach(ftch))) {
+  while ((ftch_recprefix216 = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
-    DUMP_STD_OUT()
- 
+    DUMP_STD_OUT();
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc163->c16a,
-        FMT_JUST_LEFT);
+      if (rpt->options &
+        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix216->src_prefix,
+          ftch_recprefix216->src_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix216->src_prefix, 64, fmt);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc163->c16b,
-        FMT_JUST_LEFT);
+      if (rpt->options &
+        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix216->dst_prefix,
+          ftch_recprefix216->dst_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix216->dst_prefix,
+          64, fmt);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym3, FMT_SYM_LEN, fmt_buf+len, ftch_recc163->c16c,
-        FMT_JUST_LEFT);
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix216->c16, FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recc163, comma);
+      CHASH_STDP_OUT(ftch_recprefix216, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recc163, comma);
+      CHASH_STD_OUT(ftch_recprefix216, comma);
 
     }
 
@@ -12954,30 +19087,22 @@ static int chash_c163_dump(FILE *fp, struct ftstat_rpt *rpt,
   if (ftsym1)
     ftsym_free(ftsym1);
 
-  if (ftsym2)
-    ftsym_free(ftsym2);
-
-  if (ftsym3)
-    ftsym_free(ftsym3);
-
   return 0;
 
-} /* chash_c163_dump */
+} /* chash_prefix216_dump */
 
-static int chash_c164_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2, const char *sym3, const char *sym4)
+static int chash_prefix2162_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2)
 {
-  struct ftsym *ftsym1, *ftsym2, *ftsym3, *ftsym4;
+  struct ftsym *ftsym1, *ftsym2;
 
-  CHASH_DUMP_INIT(ftchash_rec_c164, ftch_recc164);
+  CHASH_DUMP_INIT(ftchash_rec_prefix2162, ftch_recprefix2162);
 
-  ftsym1 = ftsym2 = ftsym3 = ftsym4 = (struct ftsym*)0L;
+  ftsym1 = ftsym2 = (struct ftsym*)0L;
 
   if (rpt->out->options & FT_STAT_OPT_NAMES) {
     ftsym1 = ftsym_new(sym1);
     ftsym2 = ftsym_new(sym2);
-    ftsym3 = ftsym_new(sym3);
-    ftsym4 = ftsym_new(sym4);
   }
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
@@ -12987,69 +19112,77 @@ static int chash_c164_dump(FILE *fp, struct ftstat_rpt *rpt,
     else
       sort_flags = 0;
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_c164, c16a);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_c164, c16b);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_c164, c16c);
+    if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2162, c16a);
       sort_flags |= FT_CHASH_SORT_16;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
-      sort_offset = offsetof(struct ftchash_rec_c164, c16d);
+      sort_offset = offsetof(struct ftchash_rec_prefix2162, c16b);
       sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2162, src_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
+      sort_offset = offsetof(struct ftchash_rec_prefix2162, dst_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c164);
+    CHASH_DUMP_STD_SORT(ftchash_rec_prefix2162);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recc164 = ftchash_foreach(ftch))) {
+  while ((ftch_recprefix2162 = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
     DUMP_STD_OUT();
- 
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16a,
-        FMT_JUST_LEFT);
+      if (rpt->options &
+        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2162->src_prefix,
+          ftch_recprefix2162->src_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2162->src_prefix, 64, fmt);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16b,
-        FMT_JUST_LEFT);
+      if (rpt->options &
+        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2162->dst_prefix,
+          ftch_recprefix2162->dst_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2162->dst_prefix, 64, fmt);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym3, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16c,
-        FMT_JUST_LEFT);
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix2162->c16a, FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym4, FMT_SYM_LEN, fmt_buf+len, ftch_recc164->c16d,
-        FMT_JUST_LEFT);
+      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recprefix2162->c16b, FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recc164, comma);
+      CHASH_STDP_OUT(ftch_recprefix2162, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recc164, comma);
+      CHASH_STD_OUT(ftch_recprefix2162, comma);
 
     }
 
@@ -13061,24 +19194,15 @@ static int chash_c164_dump(FILE *fp, struct ftstat_rpt *rpt,
   if (ftsym2)
     ftsym_free(ftsym2);
 
-  if (ftsym3)
-    ftsym_free(ftsym3);
-
-  if (ftsym4)
-    ftsym_free(ftsym4);
-
-
   return 0;
 
-} /* chash_c163_dump */
-
-
+} /* chash_prefix2162_dump */
 
-static int chash_ip_dump(FILE *fp, struct ftstat_rpt *rpt,
+static int chash_c64_dump(FILE *fp, struct ftstat_rpt *rpt,
   struct ftchash *ftch)
 {
 
-  CHASH_DUMP_INIT(ftchash_rec_c32, ftch_recc32);
+  CHASH_DUMP_INIT(ftchash_rec_c64, ftch_recc64);
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -13088,37 +19212,38 @@ static int chash_ip_dump(FILE *fp, struct ftstat_rpt *rpt,
       sort_flags = 0;
 
     if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      sort_offset = offsetof(struct ftchash_rec_c32, c32);
-      sort_flags |= FT_CHASH_SORT_32;
+      sort_offset = offsetof(struct ftchash_rec_c64, c64);
+      sort_flags |= FT_CHASH_SORT_64;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c32);
+    CHASH_DUMP_STD_SORT(ftchash_rec_c64);
+
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recc32 = ftchash_foreach(ftch))) {
+  while ((ftch_recc64 = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
     DUMP_STD_OUT();
- 
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_ipv4s(fmt_buf+len, ftch_recc32->c32, 64, fmt);
+      len += fmt_uint64(fmt_buf+len, ftch_recc64->c64, FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recc32, comma);
+      CHASH_STDP_OUT(ftch_recc64, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recc32, comma);
+      CHASH_STD_OUT(ftch_recc64, comma);
 
     }
 
@@ -13126,13 +19251,13 @@ static int chash_ip_dump(FILE *fp, struct ftstat_rpt *rpt,
 
   return 0;
 
-} /* chash_ip_dump */
+} /* chash_c64_dump */
 
-static int chash_prefix_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, int f1)
+static int chash_int_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch)
 {
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix, ftch_recprefix);
+  CHASH_DUMP_INIT(ftchash_rec_int, ftch_recint);
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -13142,61 +19267,93 @@ static int chash_prefix_dump(FILE *fp, struct ftstat_rpt *rpt,
       sort_flags = 0;
 
     if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      sort_offset = offsetof(struct ftchash_rec_prefix, prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else 
-
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix);
+      sort_offset = offsetof(struct ftchash_rec_int, time);
+      sort_flags |= FT_CHASH_SORT_32;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_FLOWS) {\
+      sort_offset = offsetof(struct ftchash_rec_int, nflows);\
+      sort_flags |= FT_CHASH_SORT_DOUBLE;\
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_OCTETS) {\
+      sort_offset = offsetof(struct ftchash_rec_int, noctets);\
+      sort_flags |= FT_CHASH_SORT_DOUBLE;\
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_PACKETS) {\
+      sort_offset = offsetof(struct ftchash_rec_int, npackets);\
+      sort_flags |= FT_CHASH_SORT_DOUBLE;\
+    }
 
     ftchash_sort(ftch, sort_offset, sort_flags);
 
+
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recprefix = ftchash_foreach(ftch))) {
+  while ((ftch_recint = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
     DUMP_STD_OUT();
- 
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY) {
       if (comma) fmt_buf[len++] = ',';
-      if (rpt->options & f1)
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix->prefix,
-          ftch_recprefix->mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix->prefix, 64, fmt);
+      len += fmt_uint32(fmt_buf+len, ftch_recint->time, FMT_JUST_LEFT);
       comma = 1;
     }
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+/* XXX percent totals? */
 
-      CHASH_STDP_OUT(ftch_recprefix, comma);
+    if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
+      if (comma) fmt_buf[len++] = ',';
+      len += sprintf(fmt_buf+len, "%f", ftch_recint->nflows);\
+      comma = 1;
+    }
 
-    } else {
+    if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
+      if (comma) fmt_buf[len++] = ',';
+      len += sprintf(fmt_buf+len, "%f", ftch_recint->noctets);\
+      comma = 1;
+    }
 
-      CHASH_STD_OUT(ftch_recprefix, comma);
+    if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
+      if (comma) fmt_buf[len++] = ',';
+      len += sprintf(fmt_buf+len, "%f", ftch_recint->npackets);\
+      comma = 1;
+    }
+
+    if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint64(fmt_buf+len, ftch_recint->nrecs, FMT_JUST_LEFT);
+      comma = 1;\
+    }
+
+    fmt_buf[len++] = '\n';
+    fmt_buf[len] = 0;
+
+    fputs(fmt_buf, fp);
 
+    if (rpt->out->records && (tally.rt_recs == rpt->out->records)) {
+      fprintf(fp, "# stop, hit record limit.\n");
+      break;
     }
 
   }
 
   return 0;
 
-} /* chash_prefix_dump */
+} /* chash_int_dump */
 
-static int chash_prefix_tag_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, int f1)
+static int chash_flow1_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, const char *sym1, const char *sym2)
 {
-  struct ftsym *ftsym1;
+  struct ftsym *ftsym1, *ftsym2;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix_tag, ftch_recprefix_tag);
+  CHASH_DUMP_INIT(ftchash_rec_flow1, ftch_recflow1);
 
-  ftsym1 = (struct ftsym*)0L;
+  ftsym1 = ftsym2 = (struct ftsym*)0L;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES)
+  if (rpt->out->options & FT_STAT_OPT_NAMES) {
     ftsym1 = ftsym_new(sym1);
+    ftsym2 = ftsym_new(sym2);
+  }
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -13206,51 +19363,96 @@ static int chash_prefix_tag_dump(FILE *fp, struct ftstat_rpt *rpt,
       sort_flags = 0;
 
     if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix_tag, prefix);
+      sort_offset = offsetof(struct ftchash_rec_flow1, src_prefix);
       sort_flags |= FT_CHASH_SORT_40;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix_tag, tag);
-      sort_flags |= FT_CHASH_SORT_32;
+      sort_offset = offsetof(struct ftchash_rec_flow1, dst_prefix);
+      sort_flags |= FT_CHASH_SORT_40;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
+      sort_offset = offsetof(struct ftchash_rec_flow1, src_port);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
+      sort_offset = offsetof(struct ftchash_rec_flow1, dst_port);
+      sort_flags |= FT_CHASH_SORT_16;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY5) {
+      sort_offset = offsetof(struct ftchash_rec_flow1, prot);
+      sort_flags |= FT_CHASH_SORT_8;
+    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY6) {
+      sort_offset = offsetof(struct ftchash_rec_flow1, tos);
+      sort_flags |= FT_CHASH_SORT_8;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix_tag);
+    CHASH_DUMP_STD_SORT(ftchash_rec_flow1);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recprefix_tag = ftchash_foreach(ftch))) {
+  while ((ftch_recflow1 = ftchash_foreach(ftch))) {
+
+    len = comma = 0;
+
+    DUMP_STD_OUT();
+
+    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options &
+        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->src_prefix,
+          ftch_recflow1->src_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->src_prefix, 64, fmt);
+      comma = 1;
+    }
+
+    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+      if (comma) fmt_buf[len++] = ',';
+      if (rpt->options &
+        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->dst_prefix,
+          ftch_recflow1->dst_mask, 64, fmt);
+      else
+        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->dst_prefix, 64, fmt);
+      comma = 1;
+    }
+
+    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recflow1->src_port, FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-    len = comma = 0;
+    if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
+      if (comma) fmt_buf[len++] = ',';
+      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
+        ftch_recflow1->dst_port, FMT_JUST_LEFT);
+      comma = 1;
+    }
 
-    DUMP_STD_OUT();
- 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
+    if (rpt->out->fields & FT_STAT_FIELD_KEY5) {
       if (comma) fmt_buf[len++] = ',';
-      if (rpt->options & f1)
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix_tag->prefix,
-          ftch_recprefix_tag->mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix_tag->prefix, 64, fmt);
+      len += fmt_uint8s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recflow1->prot,
+        FMT_JUST_LEFT);
       comma = 1;
     }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
+    if (rpt->out->fields & FT_STAT_FIELD_KEY6) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix_tag->tag, FMT_JUST_LEFT);
+      len += fmt_uint8(fmt_buf+len, ftch_recflow1->tos,
+        FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recprefix_tag, comma);
+      CHASH_STDP_OUT(ftch_recflow1, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recprefix_tag, comma);
+      CHASH_STD_OUT(ftch_recflow1, comma);
 
     }
 
@@ -13259,21 +19461,25 @@ static int chash_prefix_tag_dump(FILE *fp, struct ftstat_rpt *rpt,
   if (ftsym1)
     ftsym_free(ftsym1);
 
+  if (ftsym2)
+    ftsym_free(ftsym2);
+
   return 0;
 
-} /* chash_prefix_tag_dump */
+} /* chash_flow1_dump */
 
-static int chash_prefix2tag2_dump(FILE *fp, struct ftstat_rpt *rpt,
+static int chash_flow12_dump(FILE *fp, struct ftstat_rpt *rpt,
   struct ftchash *ftch, const char *sym1)
 {
   struct ftsym *ftsym1;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix2tag2, ftch_recprefix2tag2);
+  CHASH_DUMP_INIT(ftchash_rec_flow1, ftch_recflow1);
 
   ftsym1 = (struct ftsym*)0L;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES)
+  if (rpt->out->options & FT_STAT_OPT_NAMES) {
     ftsym1 = ftsym_new(sym1);
+  }
 
   if (rpt->out->options & FT_STAT_OPT_SORT) {
 
@@ -13283,41 +19489,41 @@ static int chash_prefix2tag2_dump(FILE *fp, struct ftstat_rpt *rpt,
       sort_flags = 0;
 
     if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, src_prefix);
+      sort_offset = offsetof(struct ftchash_rec_flow1, src_prefix);
       sort_flags |= FT_CHASH_SORT_40;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, dst_prefix);
+      sort_offset = offsetof(struct ftchash_rec_flow1, dst_prefix);
       sort_flags |= FT_CHASH_SORT_40;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, src_tag);
-      sort_flags |= FT_CHASH_SORT_32;
+      sort_offset = offsetof(struct ftchash_rec_flow1, prot);
+      sort_flags |= FT_CHASH_SORT_8;
     } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2tag2, dst_tag);
-      sort_flags |= FT_CHASH_SORT_32;
+      sort_offset = offsetof(struct ftchash_rec_flow1, tos);
+      sort_flags |= FT_CHASH_SORT_8;
     } else
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix2tag2);
+    CHASH_DUMP_STD_SORT(ftchash_rec_flow1);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
   } /* FT_STAT_OPT_SORT */
 
   ftchash_first(ftch);
 
-  while ((ftch_recprefix2tag2 = ftchash_foreach(ftch))) {
+  while ((ftch_recflow1 = ftchash_foreach(ftch))) {
 
     len = comma = 0;
 
     DUMP_STD_OUT();
- 
+
     if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
       if (comma) fmt_buf[len++] = ',';
       if (rpt->options &
         (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2tag2->src_prefix,
-          ftch_recprefix2tag2->src_mask, 64, fmt);
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->src_prefix,
+          ftch_recflow1->src_mask, 64, fmt);
       else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2tag2->src_prefix,
+        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->src_prefix,
           64, fmt);
       comma = 1;
     }
@@ -13326,35 +19532,34 @@ static int chash_prefix2tag2_dump(FILE *fp, struct ftstat_rpt *rpt,
       if (comma) fmt_buf[len++] = ',';
       if (rpt->options &
         (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2tag2->dst_prefix,
-          ftch_recprefix2tag2->dst_mask, 64, fmt);
+        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->dst_prefix,
+          ftch_recflow1->dst_mask, 64, fmt);
       else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2tag2->dst_prefix,
-          64, fmt);
+        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->dst_prefix, 64, fmt);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix2tag2->src_tag, FMT_JUST_LEFT);
+      len += fmt_uint8s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recflow1->prot,
+        FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
       if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix2tag2->dst_tag, FMT_JUST_LEFT);
+      len += fmt_uint8(fmt_buf+len, ftch_recflow1->tos,
+        FMT_JUST_LEFT);
       comma = 1;
     }
 
     if (rpt->out->options & FT_STAT_OPT_PERCENT) {
 
-      CHASH_STDP_OUT(ftch_recprefix2tag2, comma);
+      CHASH_STDP_OUT(ftch_recflow1, comma);
 
     } else {
 
-      CHASH_STD_OUT(ftch_recprefix2tag2, comma);
+      CHASH_STD_OUT(ftch_recflow1, comma);
 
     }
 
@@ -13365,1519 +19570,2245 @@ static int chash_prefix2tag2_dump(FILE *fp, struct ftstat_rpt *rpt,
 
   return 0;
 
-} /* chash_prefix2tag2_dump */
+} /* chash_flow12_dump */
+
+
+/*
+ * function: bucket_sort
+ *
+ * Rebuild b->index with the buckets that saw flows and order it by
+ * the sort field of the current output.  The caller walks index[]
+ * from start to end by increment.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int bucket_sort(struct ftstat_rpt *rpt, struct flow_bucket *b,
+  int32_t *start, int32_t *end, int32_t *increment)
+{
+  struct flow_bucket_page *bp;
+  uint64_t *v64;
+  double *vd;
+  uint32_t *pos, i, j;
+  size_t off;
+  int dbl;
+
+  if (bucket_index(b) < 0)
+    return -1;
+
+  *start = 0; *end = b->nindex, *increment = 1;
+
+  if (!(rpt->out->options & FT_STAT_OPT_SORT))
+    return 0;
+
+  if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
+    *start = b->nindex - 1, *end = -1, *increment = -1;
+
+  dbl = 0, off = 0;
+
+  if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
+    return 0; /* sorted by default */
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_FLOWS) {
+    off = offsetof(struct flow_bucket_page, flows);
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_OCTETS) {
+    off = offsetof(struct flow_bucket_page, octets);
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_PACKETS) {
+    off = offsetof(struct flow_bucket_page, packets);
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_DURATION) {
+    off = offsetof(struct flow_bucket_page, duration);
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_AVG_PPS) {
+    off = offsetof(struct flow_bucket_page, avg_pps), dbl = 1;
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_MIN_PPS) {
+    off = offsetof(struct flow_bucket_page, min_pps), dbl = 1;
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_MAX_PPS) {
+    off = offsetof(struct flow_bucket_page, max_pps), dbl = 1;
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_AVG_BPS) {
+    off = offsetof(struct flow_bucket_page, avg_bps), dbl = 1;
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_MIN_BPS) {
+    off = offsetof(struct flow_bucket_page, min_bps), dbl = 1;
+  } else if (rpt->out->sort_field == FT_STAT_FIELD_MAX_BPS) {
+    off = offsetof(struct flow_bucket_page, max_bps), dbl = 1;
+  } else {
+    fterr_errx(1,"bucket_sort(): internal error");
+  }
+
+  /*
+   * the counters live in pages, gather the sort field into a dense
+   * array parallel to index[] and sort positions into it.
+   */
+  if (!(pos = (uint32_t*)malloc((b->nindex+1)*sizeof(uint32_t)))) {
+    fterr_warn("malloc(pos):");
+    return -1;
+  }
+
+  if (!(v64 = (uint64_t*)malloc((b->nindex+1)*sizeof(uint64_t)))) {
+    fterr_warn("malloc(v64):");
+    free(pos);
+    return -1;
+  }
+  vd = (double*)v64;
+
+  for (i = 0; i < b->nindex; ++i) {
+
+    bp = b->pages[b->index[i] >> FT_STAT_BUCKET_SHIFT];
+    j = b->index[i] & FT_STAT_BUCKET_MASK;
+
+    if (dbl)
+      vd[i] = (*(double**)((char*)bp + off))[j];
+    else
+      v64[i] = (*(uint64_t**)((char*)bp + off))[j];
+
+    pos[i] = i;
+
+  }
+
+  if (dbl) {
+    sort_idouble = vd;
+    qsort(pos, b->nindex, sizeof (uint32_t), sort_cmp_double);
+  } else {
+    sort_i64 = v64;
+    qsort(pos, b->nindex, sizeof (uint32_t), sort_cmp64);
+  }
+
+  for (i = 0; i < b->nindex; ++i)
+    pos[i] = b->index[pos[i]];
+
+  free(v64);
+  free(b->index);
+  b->index = pos;
+
+  return 0;
+
+} /* bucket_sort */
 
+static int bucket_dump1(FILE *fp, struct ftstat_rpt *rpt, struct flow_bucket *b,
+  const char *symfile)
+{
+  struct ftsym *ftsym;
+  struct tally tally;
+  char fmt_buf1[32], fmt_buf[1024];
+  int len, comma;
+  struct flow_bucket_page *bp;
+  int32_t i, start, end, increment;
+  uint32_t *index, j;
+
+  ftsym = (struct ftsym*)0L;
+  fmt_buf1[0] = fmt_buf[0] = 0;
+  bzero(&tally, sizeof tally);
+
+  if (rpt->out->options & FT_STAT_OPT_NAMES)
+    ftsym = ftsym_new(symfile);
+
+  if (bucket_sort(rpt, b, &start, &end, &increment) < 0)
+    return -1;
+
+  index = b->index;
+
+  /* need to know the total number of records first */
+  if (rpt->out->options & FT_STAT_OPT_TALLY)
+    tally.t_recs = b->nindex;
+
+  if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+
+    for (i = start; i != end; i += increment) {
+
+      bp = b->pages[index[i] >> FT_STAT_BUCKET_SHIFT];
+      j = index[i] & FT_STAT_BUCKET_MASK;
+
+      if ((rpt->out->options & FT_STAT_OPT_TALLY) && tally.rt_recs &&
+        (!(tally.rt_recs % rpt->out->tally))) {
+
+        if (rpt->all_fields & FT_STAT_FIELD_PS)
+          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f %%avg-bps=%3.3f %%avg-pps=%3.3f\n",
+            ((double)tally.rt_recs/(double)tally.t_recs)*100,
+            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
+            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
+            ((double)tally.rt_packets/(double)rpt->t_packets)*100,
+            (((double)tally.ravg_bps/(double)tally.rt_frecs)/
+              (double)rpt->avg_bps)*100,
+            (((double)tally.ravg_pps/(double)tally.rt_frecs)/
+              (double)rpt->avg_pps)*100);
+         else
+          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f\n",
+            ((double)tally.rt_recs/(double)tally.t_recs)*100,
+            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
+            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
+            ((double)tally.rt_packets/(double)rpt->t_packets)*100);
+
+      } /* tally */
+
+      tally.rt_flows += bp->flows[j];
+      tally.rt_octets += bp->octets[j];
+      tally.rt_packets += bp->packets[j];
+      tally.rt_frecs += bp->recs[j];
+      tally.rt_recs ++;
+      if (rpt->all_fields & FT_STAT_FIELD_PS) {
+        tally.ravg_bps += bp->avg_bps[j] * bp->recs[j];
+        tally.ravg_pps += bp->avg_pps[j] * bp->recs[j];
+      }
+
+      len = comma = 0;
+
+      DUMP_STD_OUT();
+
+      if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint32s(ftsym, FMT_SYM_LEN, fmt_buf+len, b->index[i],
+          FMT_JUST_LEFT);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->flows[j] / (double)rpt->t_flows)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->octets[j] / (double)rpt->t_octets)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->packets[j] / (double)rpt->t_packets)*100.0);
+        comma = 1;
+      }
+
+
+      if (rpt->out->fields & FT_STAT_FIELD_DURATION) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->duration[j] / (double)rpt->t_duration)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_AVG_BPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->avg_bps[j] / (double)rpt->avg_bps)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_MIN_BPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->min_bps[j] / (double)rpt->min_bps)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_MAX_BPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->max_bps[j] / (double)rpt->max_bps)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_AVG_PPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->avg_pps[j] / (double)rpt->avg_pps)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_MIN_PPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->min_pps[j] / (double)rpt->min_pps)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_MAX_PPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f",
+         ((double)bp->max_pps[j] / (double)rpt->max_pps)*100.0);
+        comma = 1;
+      }
+
+      if (rpt->out->fields & FT_STAT_FIELD_QUANT) {
+        len += qs_dump(fmt_buf+len, rpt->out->fields, bp->qs[j],
+          comma);
+        comma = 1;
+      }
 
+      if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint64(fmt_buf+len, bp->recs[j], FMT_JUST_LEFT);\
+        comma = 1;
+      }
 
-static int chash_prefixh_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, int f1)
-{
+      fmt_buf[len++] = '\n';
+      fmt_buf[len] = 0;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefixh, ftch_recprefixh);
+      fputs(fmt_buf, fp);
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+      if (rpt->out->records && (tally.rt_recs == rpt->out->records)) {
+        fprintf(fp, "# stop, hit record limit.\n");
+        break;
+      }
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+    }
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      sort_offset = offsetof(struct ftchash_rec_prefixh, prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_COUNT) {
-      sort_offset = offsetof(struct ftchash_rec_prefixh, nprefixes);
-      sort_flags |= FT_CHASH_SORT_64;
-    } else
+  } else {
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefixh);
+    for (i = start; i != end; i += increment) {
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+      bp = b->pages[index[i] >> FT_STAT_BUCKET_SHIFT];
+      j = index[i] & FT_STAT_BUCKET_MASK;
 
-  } /* FT_STAT_OPT_SORT */
+      if ((rpt->out->options & FT_STAT_OPT_TALLY) && tally.rt_recs &&
+        (!(tally.rt_recs % rpt->out->tally))) {
 
-  ftchash_first(ftch);
+        if (rpt->all_fields & FT_STAT_FIELD_PS)
+          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f %%avg-bps=%3.3f %%avg-pps=%3.3f\n",
+            ((double)tally.rt_recs/(double)tally.t_recs)*100,
+            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
+            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
+            ((double)tally.rt_packets/(double)rpt->t_packets)*100,
+            (((double)tally.ravg_bps/(double)tally.rt_frecs)/
+              (double)rpt->avg_bps)*100,
+            (((double)tally.ravg_pps/(double)tally.rt_frecs)/
+              (double)rpt->avg_pps)*100);
+         else
+          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f\n",
+            ((double)tally.rt_recs/(double)tally.t_recs)*100,
+            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
+            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
+            ((double)tally.rt_packets/(double)rpt->t_packets)*100);
 
-  while ((ftch_recprefixh = ftchash_foreach(ftch))) {
+      } /* tally */
 
-    len = comma = 0;
+      tally.rt_flows += bp->flows[j];
+      tally.rt_octets += bp->octets[j];
+      tally.rt_packets += bp->packets[j];
+      tally.rt_recs ++;
+      tally.rt_frecs += bp->recs[j];
+      if (rpt->all_fields & FT_STAT_FIELD_PS) {
+        tally.ravg_bps += bp->avg_bps[j] * bp->recs[j];
+        tally.ravg_pps += bp->avg_pps[j] * bp->recs[j];
+      }
 
-    DUMP_STD_OUT();
- 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options & f1)
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefixh->prefix,
-          ftch_recprefixh->mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefixh->prefix, 64, fmt);
-      comma = 1;
-    }
+      len = comma = 0;
 
-    if (rpt->out->fields & FT_STAT_FIELD_COUNT) {
+      DUMP_STD_OUT();
 
-      if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+      if (rpt->out->fields & FT_STAT_FIELD_KEY) {
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint32s(ftsym, FMT_SYM_LEN, fmt_buf+len, b->index[i],
+          FMT_JUST_LEFT);
+        comma = 1;
+      }
 
+      if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
         if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-          ((double)ftch_recprefixh->nprefixes / rpt->t_count)*100.0);
+        len += fmt_uint64(fmt_buf+len, bp->flows[j], FMT_JUST_LEFT);
         comma = 1;
+      }
 
-      } else {
+      if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint64(fmt_buf+len, bp->octets[j], FMT_JUST_LEFT);
+        comma = 1;
+      }
 
+      if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
         if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, ftch_recprefixh->nprefixes,
-          FMT_JUST_LEFT);
+        len += fmt_uint64(fmt_buf+len, bp->packets[j], FMT_JUST_LEFT);
         comma = 1;
+      }
 
+      if (rpt->out->fields & FT_STAT_FIELD_DURATION) {
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint64(fmt_buf+len, bp->duration[j], FMT_JUST_LEFT);
+        comma = 1;
       }
-    }
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+      if (rpt->out->fields & FT_STAT_FIELD_AVG_BPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f", bp->avg_bps[j]);
+        comma = 1;
+      }
 
-      CHASH_STDP_OUT(ftch_recprefixh, comma);
+      if (rpt->out->fields & FT_STAT_FIELD_MIN_BPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f", bp->min_bps[j]);
+        comma = 1;
+      }
 
-    } else {
+      if (rpt->out->fields & FT_STAT_FIELD_MAX_BPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f", bp->max_bps[j]);
+        comma = 1;
+      }
 
-      CHASH_STD_OUT(ftch_recprefixh, comma);
+      if (rpt->out->fields & FT_STAT_FIELD_AVG_PPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f", bp->avg_pps[j]);
+        comma = 1;
+      }
 
-    }
+      if (rpt->out->fields & FT_STAT_FIELD_MIN_PPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f", bp->min_pps[j]);
+        comma = 1;
+      }
 
-  }
+      if (rpt->out->fields & FT_STAT_FIELD_MAX_PPS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += sprintf(fmt_buf+len, "%f", bp->max_pps[j]);
+        comma = 1;
+      }
 
-  return 0;
+      if (rpt->out->fields & FT_STAT_FIELD_QUANT) {
+        len += qs_dump(fmt_buf+len, rpt->out->fields, bp->qs[j],
+          comma);
+        comma = 1;
+      }
 
-} /* chash_prefixh_dump */
+      if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
+        if (comma) fmt_buf[len++] = ',';
+        len += fmt_uint64(fmt_buf+len, bp->recs[j], FMT_JUST_LEFT);\
+        comma = 1;
+      }
 
-static int chash_prefix2_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch)
-{
+      fmt_buf[len++] = '\n';
+      fmt_buf[len] = 0;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix2, ftch_recprefix2);
+      fputs(fmt_buf, fp);
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+      if (rpt->out->records && (tally.rt_recs == rpt->out->records)) {
+        fprintf(fp, "# stop, hit record limit.\n");
+        break;
+      }
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+    } /* foreach record */
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2, src_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2, dst_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else
+  } /* totals */
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix2);
+  if (ftsym)
+    ftsym_free(ftsym);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+  return 0;
 
-  } /* FT_STAT_OPT_SORT */
+} /* bucket_dump1 */
 
-  ftchash_first(ftch);
+/*
+ * binary output.  bin_layouts has where the keys and counters are in
+ * the hash records of each chash_*_dump, buckets are copied one at a
+ * time into a struct bin_brec so both share the column and row code.
+ */
+struct bin_key {
+  int slot; /* 0=KEY, 1..6=KEY1..KEY6 */
+  int offset; /* of the key in the record */
+  int type; /* FT_BIN_TYPE_* */
+  int mask; /* offset of the prefix length, -1 none */
+  int opt; /* rpt->options selecting the prefix length, 0 from the dump */
+};
 
-  while ((ftch_recprefix2 = ftchash_foreach(ftch))) {
+struct bin_layout {
+  void *f_dump; /* chash_*_dump the records belong to */
+  int nrecs, nflows, noctets, npackets, etime, ps; /* counter offsets */
+  int nkeys;
+  struct bin_key keys[6];
+};
 
-    len = comma = 0;
+struct bin_brec {
+  uint64_t nrecs, nflows, noctets, npackets, etime;
+  struct ftps ps;
+  uint32_t key;
+};
 
-    DUMP_STD_OUT();
- 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2->src_prefix,
-          ftch_recprefix2->src_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2->src_prefix, 64, fmt);
-      comma = 1;
-    }
+struct bin_out {
+  struct ftbin_hdr hdr;
+  struct ftbin_col cols[FT_BIN_MAXCOLS];
+  int src[FT_BIN_MAXCOLS]; /* offset of each column in the record */
+  char *buf; /* rows not written yet */
+  uint32_t nbuf, buf_rows;
+};
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma)
-        fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2->dst_prefix,
-          ftch_recprefix2->dst_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2->dst_prefix, 64, fmt);
-      comma = 1;
-    }
+#define BIN_COUNTERS(A)\
+  offsetof(struct A, nrecs), offsetof(struct A, nflows),\
+  offsetof(struct A, noctets), offsetof(struct A, npackets),\
+  offsetof(struct A, etime), offsetof(struct A, ps)
+
+#define BIN_KEY(A,S,F,T) {S, offsetof(struct A, F), T, -1, 0}
+
+#define BIN_PREFIX(A,S,F,M,O) {S, offsetof(struct A, F), FT_BIN_TYPE_IPV4,\
+  offsetof(struct A, M), O}
+
+#define BIN_SRC (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK)
+#define BIN_DST (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK)
+
+static struct bin_layout bin_layouts[] = {
+  {(void*)chash_c32_dump, BIN_COUNTERS(ftchash_rec_c32), 1,
+    {BIN_KEY(ftchash_rec_c32, 0, c32, FT_BIN_TYPE_U32)}},
+  {(void*)chash_c64_dump, BIN_COUNTERS(ftchash_rec_c64), 1,
+    {BIN_KEY(ftchash_rec_c64, 0, c64, FT_BIN_TYPE_U64)}},
+  {(void*)chash_c322_dump, BIN_COUNTERS(ftchash_rec_c322), 2,
+    {BIN_KEY(ftchash_rec_c322, 1, c32a, FT_BIN_TYPE_U32),
+     BIN_KEY(ftchash_rec_c322, 2, c32b, FT_BIN_TYPE_U32)}},
+  {(void*)chash_c162_dump, BIN_COUNTERS(ftchash_rec_c162), 2,
+    {BIN_KEY(ftchash_rec_c162, 1, c16a, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_c162, 2, c16b, FT_BIN_TYPE_U16)}},
+  {(void*)chash_c163_dump, BIN_COUNTERS(ftchash_rec_c163), 3,
+    {BIN_KEY(ftchash_rec_c163, 1, c16a, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_c163, 2, c16b, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_c163, 3, c16c, FT_BIN_TYPE_U16)}},
+  {(void*)chash_c164_dump, BIN_COUNTERS(ftchash_rec_c164), 4,
+    {BIN_KEY(ftchash_rec_c164, 1, c16a, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_c164, 2, c16b, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_c164, 3, c16c, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_c164, 4, c16d, FT_BIN_TYPE_U16)}},
+  {(void*)chash_ip_dump, BIN_COUNTERS(ftchash_rec_c32), 1,
+    {BIN_KEY(ftchash_rec_c32, 0, c32, FT_BIN_TYPE_IPV4)}},
+  {(void*)chash_prefix_dump, BIN_COUNTERS(ftchash_rec_prefix), 1,
+    {BIN_PREFIX(ftchash_rec_prefix, 0, prefix, mask, 0)}},
+  {(void*)chash_prefix2_dump, BIN_COUNTERS(ftchash_rec_prefix2), 2,
+    {BIN_PREFIX(ftchash_rec_prefix2, 1, src_prefix, src_mask, BIN_SRC),
+     BIN_PREFIX(ftchash_rec_prefix2, 2, dst_prefix, dst_mask, BIN_DST)}},
+  {(void*)chash_prefix16_dump, BIN_COUNTERS(ftchash_rec_prefix16), 2,
+    {BIN_PREFIX(ftchash_rec_prefix16, 1, prefix, mask, 0),
+     BIN_KEY(ftchash_rec_prefix16, 2, c16, FT_BIN_TYPE_U16)}},
+  {(void*)chash_prefix162_dump, BIN_COUNTERS(ftchash_rec_prefix162), 3,
+    {BIN_PREFIX(ftchash_rec_prefix162, 1, prefix, mask, 0),
+     BIN_KEY(ftchash_rec_prefix162, 2, c16a, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_prefix162, 3, c16b, FT_BIN_TYPE_U16)}},
+  {(void*)chash_prefix216_dump, BIN_COUNTERS(ftchash_rec_prefix216), 3,
+    {BIN_PREFIX(ftchash_rec_prefix216, 1, src_prefix, src_mask, BIN_SRC),
+     BIN_PREFIX(ftchash_rec_prefix216, 2, dst_prefix, dst_mask, BIN_DST),
+     BIN_KEY(ftchash_rec_prefix216, 3, c16, FT_BIN_TYPE_U16)}},
+  {(void*)chash_prefix2162_dump, BIN_COUNTERS(ftchash_rec_prefix2162), 4,
+    {BIN_PREFIX(ftchash_rec_prefix2162, 1, src_prefix, src_mask, BIN_SRC),
+     BIN_PREFIX(ftchash_rec_prefix2162, 2, dst_prefix, dst_mask, BIN_DST),
+     BIN_KEY(ftchash_rec_prefix2162, 3, c16a, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_prefix2162, 4, c16b, FT_BIN_TYPE_U16)}},
+  {(void*)chash_flow1_dump, BIN_COUNTERS(ftchash_rec_flow1), 6,
+    {BIN_PREFIX(ftchash_rec_flow1, 1, src_prefix, src_mask, BIN_SRC),
+     BIN_PREFIX(ftchash_rec_flow1, 2, dst_prefix, dst_mask, BIN_DST),
+     BIN_KEY(ftchash_rec_flow1, 3, src_port, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_flow1, 4, dst_port, FT_BIN_TYPE_U16),
+     BIN_KEY(ftchash_rec_flow1, 5, prot, FT_BIN_TYPE_U8),
+     BIN_KEY(ftchash_rec_flow1, 6, tos, FT_BIN_TYPE_U8)}},
+  {(void*)chash_flow12_dump, BIN_COUNTERS(ftchash_rec_flow1), 4,
+    {BIN_PREFIX(ftchash_rec_flow1, 1, src_prefix, src_mask, BIN_SRC),
+     BIN_PREFIX(ftchash_rec_flow1, 2, dst_prefix, dst_mask, BIN_DST),
+     BIN_KEY(ftchash_rec_flow1, 3, prot, FT_BIN_TYPE_U8),
+     BIN_KEY(ftchash_rec_flow1, 4, tos, FT_BIN_TYPE_U8)}},
+  {(void*)chash_prefix_tag_dump, BIN_COUNTERS(ftchash_rec_prefix_tag), 2,
+    {BIN_PREFIX(ftchash_rec_prefix_tag, 1, prefix, mask, 0),
+     BIN_KEY(ftchash_rec_prefix_tag, 2, tag, FT_BIN_TYPE_U32)}},
+  {(void*)chash_prefix2tag2_dump, BIN_COUNTERS(ftchash_rec_prefix2tag2), 4,
+    {BIN_PREFIX(ftchash_rec_prefix2tag2, 1, src_prefix, src_mask, BIN_SRC),
+     BIN_PREFIX(ftchash_rec_prefix2tag2, 2, dst_prefix, dst_mask, BIN_DST),
+     BIN_KEY(ftchash_rec_prefix2tag2, 3, src_tag, FT_BIN_TYPE_U32),
+     BIN_KEY(ftchash_rec_prefix2tag2, 4, dst_tag, FT_BIN_TYPE_U32)}},
+};
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+static struct bin_layout bin_bucket = {
+  (void*)0L, BIN_COUNTERS(bin_brec), 1,
+    {BIN_KEY(bin_brec, 0, key, FT_BIN_TYPE_U32)}};
 
-      CHASH_STDP_OUT(ftch_recprefix2, comma);
+static int bin_type_size[] = {0, 1, 2, 4, 8, 8, 4}; /* by FT_BIN_TYPE_* */
 
-    } else {
+/*
+ * function: bin_col
+ *
+ * Append a column to the row of bo, aligned to its size.
+ */
+static void bin_col(struct bin_out *bo, const char *name, const char *suffix,
+  int type, int src)
+{
+  struct ftbin_col *c;
+  int size;
 
-      CHASH_STD_OUT(ftch_recprefix2, comma);
+  c = &bo->cols[bo->hdr.ncols];
+  size = bin_type_size[type];
 
-    }
+  bo->hdr.row_size = (bo->hdr.row_size + size - 1) & ~(size - 1);
 
-  }
+  snprintf(c->name, sizeof c->name, "%s%s", name, suffix);
+  c->offset = bo->hdr.row_size;
+  c->type = type;
+  c->size = size;
 
-  return 0;
+  bo->src[bo->hdr.ncols++] = src;
+  bo->hdr.row_size += size;
 
-} /* chash_prefix2_dump */
+} /* bin_col */
 
-static int chash_prefix16_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, int f1)
+/*
+ * function: bin_begin
+ *
+ * Set up the columns of the current output of rpt from the keys of bl
+ * and the counters in its fields, then write the block header.  Key
+ * columns are named like the recn line of the ascii output, a prefix
+ * is followed by a <key>-prefix-len column when the ascii output would
+ * print it.  f1 selects it for keys whose layout leaves that to the dump.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int bin_begin(FILE *fp, struct bin_out *bo, struct ftstat_rpt *rpt,
+  struct bin_layout *bl, int f1, char **keys, uint64_t nrows)
 {
-  struct ftsym *ftsym1;
+  struct bin_key *k;
+  char name[FT_BIN_COLLEN];
+  uint32_t fields;
+  int i;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix16, ftch_recprefix16);
+  bzero(bo, sizeof *bo);
+  fields = rpt->out->fields;
 
-  ftsym1 = (struct ftsym*)0L;
+  for (i = 0; i < bl->nkeys; ++i) {
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES)
-    ftsym1 = ftsym_new(sym1);
+    k = &bl->keys[i];
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+    if (!(fields & (k->slot ? (FT_STAT_FIELD_KEY1 << (k->slot - 1)) :
+      FT_STAT_FIELD_KEY)))
+      continue;
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
+    if (keys[k->slot][0])
+      snprintf(name, sizeof name, "%s", keys[k->slot]);
     else
-      sort_flags = 0;
-
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix16, c16);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix16, prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else
-
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix16);
-
-    ftchash_sort(ftch, sort_offset, sort_flags);
-
-  } /* FT_STAT_OPT_SORT */
+      snprintf(name, sizeof name, "key%d", k->slot);
 
-  ftchash_first(ftch);
-
-  while ((ftch_recprefix16 = ftchash_foreach(ftch))) {
-
-    len = comma = 0;
+    bin_col(bo, name, "", k->type, k->offset);
 
-    DUMP_STD_OUT();
+    if ((k->mask != -1) && (rpt->options & (k->opt ? k->opt : f1)))
+      bin_col(bo, name, "-prefix-len", FT_BIN_TYPE_U8, k->mask);
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options & f1)
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix16->prefix,
-          ftch_recprefix16->mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix16->prefix, 64, fmt);
-      comma = 1;
-    }
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix16->c16, FMT_JUST_LEFT);
-      comma = 1;
-    }
- 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  if (fields & FT_STAT_FIELD_FLOWS)
+    bin_col(bo, "flows", "", FT_BIN_TYPE_U64, bl->nflows);
+  if (fields & FT_STAT_FIELD_OCTETS)
+    bin_col(bo, "octets", "", FT_BIN_TYPE_U64, bl->noctets);
+  if (fields & FT_STAT_FIELD_PACKETS)
+    bin_col(bo, "packets", "", FT_BIN_TYPE_U64, bl->npackets);
+  if (fields & FT_STAT_FIELD_DURATION)
+    bin_col(bo, "duration", "", FT_BIN_TYPE_U64, bl->etime);
+  if (fields & FT_STAT_FIELD_AVG_BPS)
+    bin_col(bo, "avg-bps", "", FT_BIN_TYPE_DOUBLE,
+      bl->ps + offsetof(struct ftps, avg_bps));
+  if (fields & FT_STAT_FIELD_MIN_BPS)
+    bin_col(bo, "min-bps", "", FT_BIN_TYPE_DOUBLE,
+      bl->ps + offsetof(struct ftps, min_bps));
+  if (fields & FT_STAT_FIELD_MAX_BPS)
+    bin_col(bo, "max-bps", "", FT_BIN_TYPE_DOUBLE,
+      bl->ps + offsetof(struct ftps, max_bps));
+  if (fields & FT_STAT_FIELD_AVG_PPS)
+    bin_col(bo, "avg-pps", "", FT_BIN_TYPE_DOUBLE,
+      bl->ps + offsetof(struct ftps, avg_pps));
+  if (fields & FT_STAT_FIELD_MIN_PPS)
+    bin_col(bo, "min-pps", "", FT_BIN_TYPE_DOUBLE,
+      bl->ps + offsetof(struct ftps, min_pps));
+  if (fields & FT_STAT_FIELD_MAX_PPS)
+    bin_col(bo, "max-pps", "", FT_BIN_TYPE_DOUBLE,
+      bl->ps + offsetof(struct ftps, max_pps));
+  if (fields & FT_STAT_FIELD_FRECS)
+    bin_col(bo, "frecs", "", FT_BIN_TYPE_U64, bl->nrecs);
+
+  /* rows stay 8 byte aligned, at least one byte */
+  bo->hdr.row_size = (bo->hdr.row_size + 7) & ~7;
+  if (!bo->hdr.row_size)
+    bo->hdr.row_size = 8;
+
+  bo->hdr.magic = FT_BIN_MAGIC;
+  bo->hdr.version = FT_BIN_VERSION;
+  bo->hdr.nrows = nrows;
+  bo->hdr.t_ignores = rpt->t_ignores;
+  bo->hdr.t_recs = rpt->t_recs;
+  bo->hdr.t_flows = rpt->t_flows;
+  bo->hdr.t_octets = rpt->t_octets;
+  bo->hdr.t_packets = rpt->t_packets;
+  bo->hdr.t_duration = rpt->t_duration;
+  bo->hdr.time_start = rpt->time_start;
+  bo->hdr.time_end = rpt->time_end;
+  strncpy(bo->hdr.name, rpt->name, FT_BIN_NAMELEN-1);
+  strncpy(bo->hdr.type, rpt->format_name, FT_BIN_NAMELEN-1);
+
+  bo->buf_rows = FT_BIN_BUFSIZE / bo->hdr.row_size;
+
+  if (!(bo->buf = (char*)malloc(bo->buf_rows * bo->hdr.row_size))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
 
-      CHASH_STDP_OUT(ftch_recprefix16, comma);
+  if ((fwrite(&bo->hdr, sizeof bo->hdr, 1, fp) != 1) ||
+    (fwrite(bo->cols, sizeof bo->cols[0], bo->hdr.ncols, fp) !=
+    bo->hdr.ncols)) {
+    fterr_warn("fwrite()");
+    free(bo->buf);
+    bo->buf = (char*)0L;
+    return -1;
+  }
 
-    } else {
+  return 0;
 
-      CHASH_STD_OUT(ftch_recprefix16, comma);
+} /* bin_begin */
 
-    }
+/*
+ * function: bin_flush
+ *
+ * Write the buffered rows of bo.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int bin_flush(FILE *fp, struct bin_out *bo)
+{
 
+  if (bo->nbuf &&
+    (fwrite(bo->buf, bo->hdr.row_size, bo->nbuf, fp) != bo->nbuf)) {
+    fterr_warn("fwrite()");
+    return -1;
   }
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
+  bo->nbuf = 0;
 
   return 0;
 
-} /* chash_prefix16_dump */
+} /* bin_flush */
 
-static int chash_prefix162_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2, int f1)
+/*
+ * function: bin_row
+ *
+ * Copy the columns of rec into the next row of bo.  Rows go out
+ * FT_BIN_BUFSIZE bytes at a time.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int bin_row(FILE *fp, struct bin_out *bo, char *rec)
 {
-  struct ftsym *ftsym1, *ftsym2;
+  char *row;
+  int i;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix162, ftch_recprefix162);
+  row = bo->buf + (size_t)bo->nbuf * bo->hdr.row_size;
+  bzero(row, bo->hdr.row_size);
 
-  ftsym1 = ftsym2 = (struct ftsym*)0L;
+  for (i = 0; i < bo->hdr.ncols; ++i)
+    bcopy(rec + bo->src[i], row + bo->cols[i].offset, bo->cols[i].size);
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES) {
-    ftsym1 = ftsym_new(sym1);
-    ftsym2 = ftsym_new(sym2);
-  }
+  if (++bo->nbuf == bo->buf_rows)
+    return bin_flush(fp, bo);
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  return 0;
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+} /* bin_row */
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_prefix162, c16b);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix162, c16a);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix162, prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else
+/*
+ * function: bin_sort
+ *
+ * Hash sort offset and flags for the sort field of the current output.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int bin_sort(struct ftstat_rpt *rpt, struct bin_layout *bl,
+  int *sort_offset, int *sort_flags)
+{
+  int field, i;
+
+  field = rpt->out->sort_field;
+
+  *sort_flags = (rpt->out->sort_order & FT_STAT_SORT_ASCEND) ?
+    FT_CHASH_SORT_ASCENDING : 0;
+
+  if (field == FT_STAT_FIELD_FLOWS) {
+    *sort_offset = bl->nflows;
+    *sort_flags |= FT_CHASH_SORT_64;
+  } else if (field == FT_STAT_FIELD_OCTETS) {
+    *sort_offset = bl->noctets;
+    *sort_flags |= FT_CHASH_SORT_64;
+  } else if (field == FT_STAT_FIELD_PACKETS) {
+    *sort_offset = bl->npackets;
+    *sort_flags |= FT_CHASH_SORT_64;
+  } else if (field == FT_STAT_FIELD_DURATION) {
+    *sort_offset = bl->etime;
+    *sort_flags |= FT_CHASH_SORT_64;
+  } else if (field == FT_STAT_FIELD_AVG_PPS) {
+    *sort_offset = bl->ps + offsetof(struct ftps, avg_pps);
+    *sort_flags |= FT_CHASH_SORT_DOUBLE;
+  } else if (field == FT_STAT_FIELD_MIN_PPS) {
+    *sort_offset = bl->ps + offsetof(struct ftps, min_pps);
+    *sort_flags |= FT_CHASH_SORT_DOUBLE;
+  } else if (field == FT_STAT_FIELD_MAX_PPS) {
+    *sort_offset = bl->ps + offsetof(struct ftps, max_pps);
+    *sort_flags |= FT_CHASH_SORT_DOUBLE;
+  } else if (field == FT_STAT_FIELD_AVG_BPS) {
+    *sort_offset = bl->ps + offsetof(struct ftps, avg_bps);
+    *sort_flags |= FT_CHASH_SORT_DOUBLE;
+  } else if (field == FT_STAT_FIELD_MIN_BPS) {
+    *sort_offset = bl->ps + offsetof(struct ftps, min_bps);
+    *sort_flags |= FT_CHASH_SORT_DOUBLE;
+  } else if (field == FT_STAT_FIELD_MAX_BPS) {
+    *sort_offset = bl->ps + offsetof(struct ftps, max_bps);
+    *sort_flags |= FT_CHASH_SORT_DOUBLE;
+  } else {
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix162);
+    for (i = 0; i < bl->nkeys; ++i)
+      if (field == (bl->keys[i].slot ?
+        (FT_STAT_FIELD_KEY1 << (bl->keys[i].slot - 1)) : FT_STAT_FIELD_KEY))
+        break;
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    if (i == bl->nkeys) {
+      fterr_warnx("%s: can not sort binary output on that field.", rpt->name);
+      return -1;
+    }
 
-  } /* FT_STAT_OPT_SORT */
+    *sort_offset = bl->keys[i].offset;
+
+    /* prefix and its length sort together like the ascii output */
+    if (bl->keys[i].mask == bl->keys[i].offset + 4)
+      *sort_flags |= FT_CHASH_SORT_40;
+    else if (bl->keys[i].type == FT_BIN_TYPE_U8)
+      *sort_flags |= FT_CHASH_SORT_8;
+    else if (bl->keys[i].type == FT_BIN_TYPE_U16)
+      *sort_flags |= FT_CHASH_SORT_16;
+    else if (bl->keys[i].type == FT_BIN_TYPE_U64)
+      *sort_flags |= FT_CHASH_SORT_64;
+    else
+      *sort_flags |= FT_CHASH_SORT_32;
 
-  ftchash_first(ftch);
+  }
 
-  while ((ftch_recprefix162 = ftchash_foreach(ftch))) {
+  return 0;
 
-    len = comma = 0;
+} /* bin_sort */
 
-    DUMP_STD_OUT();
+/*
+ * function: chash_bin_dump
+ *
+ * Binary output of a hash report, the records are laid out as for
+ * f_dump, one of the chash_*_dump functions.  Rows follow the sort and
+ * record limit of the output.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int chash_bin_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct ftchash *ftch, void *f_dump, int f1, char *key, char *key1,
+  char *key2, char *key3, char *key4, char *key5, char *key6)
+{
+  struct bin_layout *bl;
+  struct bin_out bo;
+  char *keys[7], *rec;
+  uint64_t nrows, n;
+  int i, sort_offset, sort_flags, ret;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options & f1)
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix162->prefix,
-          ftch_recprefix162->mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix162->prefix, 64, fmt);
-      comma = 1;
-    }
+  ret = -1;
+  bl = (struct bin_layout*)0L;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix162->c16a, FMT_JUST_LEFT);
-      comma = 1;
+  for (i = 0; i < sizeof bin_layouts / sizeof bin_layouts[0]; ++i)
+    if (bin_layouts[i].f_dump == f_dump) {
+      bl = &bin_layouts[i];
+      break;
     }
 
+  if (!bl) {
+    fterr_warnx("%s: type %s has no binary format.", rpt->name,
+      rpt->format_name);
+    return -1;
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix162->c16b, FMT_JUST_LEFT);
-      comma = 1;
-    }
+  if (rpt->out->options & FT_STAT_OPT_SORT) {
 
+    if (bin_sort(rpt, bl, &sort_offset, &sort_flags) < 0)
+      return -1;
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, rpt->out->records);
 
-      CHASH_STDP_OUT(ftch_recprefix162, comma);
+  } /* FT_STAT_OPT_SORT */
 
-    } else {
+  nrows = ftch->entries;
+  if (rpt->out->records && (nrows > rpt->out->records))
+    nrows = rpt->out->records;
 
-      CHASH_STD_OUT(ftch_recprefix162, comma);
+  keys[0] = key; keys[1] = key1; keys[2] = key2; keys[3] = key3;
+  keys[4] = key4; keys[5] = key5; keys[6] = key6;
 
-    }
+  if (bin_begin(fp, &bo, rpt, bl, f1, keys, nrows) < 0)
+    return -1;
 
-  }
+  ftchash_first(ftch);
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
+  for (n = 0; (n < nrows) && (rec = ftchash_foreach(ftch)); ++n)
+    if (bin_row(fp, &bo, rec) < 0)
+      goto out;
 
-  if (ftsym2)
-    ftsym_free(ftsym2);
+  if (n != nrows) {
+    fterr_warnx("%s: %llu of %llu rows.", rpt->name, (unsigned long long)n,
+      (unsigned long long)nrows);
+    goto out;
+  }
 
-  return 0;
+  ret = bin_flush(fp, &bo);
 
-} /* chash_prefix162_dump */
+out:
 
+  free(bo.buf);
 
+  return ret;
 
-static int chash_prefix216_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1)
+} /* chash_bin_dump */
+
+/*
+ * function: bucket_bin_dump
+ *
+ * Binary output of a bucket report, one row for each bucket with
+ * flows.
+ *
+ * returns: 0  ok
+ *          <0 fail
+ */
+static int bucket_bin_dump(FILE *fp, struct ftstat_rpt *rpt,
+  struct flow_bucket *b, char *key)
 {
-  struct ftsym *ftsym1;
+  struct flow_bucket_page *bp;
+  struct bin_brec br;
+  struct bin_out bo;
+  char *keys[7];
+  uint64_t nrows;
+  int32_t i, start, end, increment;
+  uint32_t k;
+  int ret;
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix216, ftch_recprefix216);
+  ret = -1;
 
-  ftsym1 = (struct ftsym*)0L;
+  if (bucket_sort(rpt, b, &start, &end, &increment) < 0)
+    return -1;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES)
-    ftsym1 = ftsym_new(sym1);
+  nrows = b->nindex;
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  if (rpt->out->records && (nrows > rpt->out->records))
+    nrows = rpt->out->records;
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+  keys[0] = key;
+  keys[1] = keys[2] = keys[3] = keys[4] = keys[5] = keys[6] = "";
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_prefix216, c16);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix216, src_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix216, dst_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else
+  if (bin_begin(fp, &bo, rpt, &bin_bucket, 0, keys, nrows) < 0)
+    return -1;
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix216);
+  bzero(&br, sizeof br);
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+  for (i = start; (i != end) && nrows; i += increment) {
 
-  } /* FT_STAT_OPT_SORT */
+    bp = b->pages[b->index[i] >> FT_STAT_BUCKET_SHIFT];
+    k = b->index[i] & FT_STAT_BUCKET_MASK;
 
-  ftchash_first(ftch);
+    br.key = b->index[i];
+    br.nrecs = bp->recs[k];
+    br.nflows = bp->flows[k];
+    br.noctets = bp->octets[k];
+    br.npackets = bp->packets[k];
+    br.etime = bp->duration[k];
 
-  while ((ftch_recprefix216 = ftchash_foreach(ftch))) {
+    if (rpt->all_fields & FT_STAT_FIELD_PS) {
+      br.ps.avg_pps = bp->avg_pps[k];
+      br.ps.min_pps = bp->min_pps[k];
+      br.ps.max_pps = bp->max_pps[k];
+      br.ps.avg_bps = bp->avg_bps[k];
+      br.ps.min_bps = bp->min_bps[k];
+      br.ps.max_bps = bp->max_bps[k];
+    }
 
-    len = comma = 0;
+    if (bin_row(fp, &bo, (char*)&br) < 0)
+      goto out;
 
-    DUMP_STD_OUT();
+    --nrows;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix216->src_prefix,
-          ftch_recprefix216->src_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix216->src_prefix, 64, fmt);
-      comma = 1;
-    }
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix216->dst_prefix,
-          ftch_recprefix216->dst_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix216->dst_prefix,
-          64, fmt);
-      comma = 1;
-    }
+  ret = bin_flush(fp, &bo);
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix216->c16, FMT_JUST_LEFT);
-      comma = 1;
-    }
+out:
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  free(bo.buf);
 
-      CHASH_STDP_OUT(ftch_recprefix216, comma);
+  return ret;
 
-    } else {
+} /* bucket_bin_dump */
 
-      CHASH_STD_OUT(ftch_recprefix216, comma);
+static int recn_dump(FILE *fp, int fields, char *key, char *key1,
+  char *key2, char *key3, char *key4, char *key5, char *key6)
+{
+  int comma, i, j;
 
-    }
+  fprintf(fp, "# recn: ");
+  comma = 0;
 
+  if (fields & FT_STAT_FIELD_INDEX) {
+    fprintf(fp, "%sindex", comma ? "," : "");
+    comma = 1;
   }
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
+  if (fields & FT_STAT_FIELD_FIRST) {
+    fprintf(fp, "%sfirst", comma ? "," : "");
+    comma = 1;
+  }
 
-  return 0;
+  if (fields & FT_STAT_FIELD_LAST) {
+    fprintf(fp, "%slast", comma ? "," : "");
+    comma = 1;
+  }
 
-} /* chash_prefix216_dump */
+  if (fields & FT_STAT_FIELD_KEY) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key);
+    comma = 1;
+  }
 
-static int chash_prefix2162_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2)
-{
-  struct ftsym *ftsym1, *ftsym2;
+  if (fields & FT_STAT_FIELD_KEY1) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key1);
+    comma = 1;
+  }
 
-  CHASH_DUMP_INIT(ftchash_rec_prefix2162, ftch_recprefix2162);
+  if (fields & FT_STAT_FIELD_KEY2) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key2);
+    comma = 1;
+  }
+
+  if (fields & FT_STAT_FIELD_KEY3) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key3);
+    comma = 1;
+  }
+
+  if (fields & FT_STAT_FIELD_KEY4) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key4);
+    comma = 1;
+  }
 
-  ftsym1 = ftsym2 = (struct ftsym*)0L;
+  if (fields & FT_STAT_FIELD_KEY5) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key5);
+    comma = 1;
+  }
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES) {
-    ftsym1 = ftsym_new(sym1);
-    ftsym2 = ftsym_new(sym2);
+  if (fields & FT_STAT_FIELD_KEY6) {
+    fprintf(fp, "%s%s*", comma ? "," : "", key6);
+    comma = 1;
   }
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  if (fields & FT_STAT_FIELD_COUNT) {
+    fprintf(fp, "%s%s", comma ? "," : "", key1);
+    comma = 1;
+  }
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+  if (fields & FT_STAT_FIELD_FLOWS) {
+    fprintf(fp, "%sflows", comma ? "," : "");
+    comma = 1;
+  }
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2162, c16a);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2162, c16b);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2162, src_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_prefix2162, dst_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else
+  if (fields & FT_STAT_FIELD_OCTETS) {
+    fprintf(fp, "%soctets", comma ? "," : "");
+    comma = 1;
+  }
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_prefix2162);
+  if (fields & FT_STAT_FIELD_PACKETS) {
+    fprintf(fp, "%spackets", comma ? "," : "");
+    comma = 1;
+  }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+  if (fields & FT_STAT_FIELD_DURATION) {
+    fprintf(fp, "%sduration", comma ? "," : "");
+    comma = 1;
+  }
 
-  } /* FT_STAT_OPT_SORT */
+  if (fields & FT_STAT_FIELD_AVG_BPS) {
+    fprintf(fp, "%savg-bps", comma ? "," : "");
+    comma = 1;
+  }
 
-  ftchash_first(ftch);
+  if (fields & FT_STAT_FIELD_MIN_BPS) {
+    fprintf(fp, "%smin-bps", comma ? "," : "");
+    comma = 1;
+  }
 
-  while ((ftch_recprefix2162 = ftchash_foreach(ftch))) {
+  if (fields & FT_STAT_FIELD_MAX_BPS) {
+    fprintf(fp, "%smax-bps", comma ? "," : "");
+    comma = 1;
+  }
 
-    len = comma = 0;
+  if (fields & FT_STAT_FIELD_AVG_PPS) {
+    fprintf(fp, "%savg-pps", comma ? "," : "");
+    comma = 1;
+  }
 
-    DUMP_STD_OUT();
+  if (fields & FT_STAT_FIELD_MIN_PPS) {
+    fprintf(fp, "%smin-pps", comma ? "," : "");
+    comma = 1;
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2162->src_prefix,
-          ftch_recprefix2162->src_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2162->src_prefix, 64, fmt);
-      comma = 1;
-    }
+  if (fields & FT_STAT_FIELD_MAX_PPS) {
+    fprintf(fp, "%smax-pps", comma ? "," : "");
+    comma = 1;
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recprefix2162->dst_prefix,
-          ftch_recprefix2162->dst_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recprefix2162->dst_prefix, 64, fmt);
+  for (i = 0; i < FT_STAT_QS_N; ++i) {
+    if (fields & qs_fields[i]) {
+      for (j = 0; j < FT_STAT_QS_NPOINTS; ++j)
+        fprintf(fp, "%s%s-p%d", comma ? "," : "", qs_names[i],
+          qs_points[j]);
       comma = 1;
     }
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix2162->c16a, FMT_JUST_LEFT);
-      comma = 1;
-    }
+  if (fields & FT_STAT_FIELD_FRECS) {
+    fprintf(fp, "%sfrecs", comma ? "," : "");
+    comma = 1;
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym2, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recprefix2162->c16b, FMT_JUST_LEFT);
-      comma = 1;
-    }
+  fprintf(fp, "\n");
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  return 0;
 
-      CHASH_STDP_OUT(ftch_recprefix2162, comma);
+} /* recn_dump */
 
-    } else {
+/*
+ * function: bucket_alloc
+ *
+ * Set up b for n buckets.  Only the page table is allocated here,
+ * the counter pages are allocated by bucket_page_new() the first
+ * time one of their buckets is touched.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+int bucket_alloc(struct flow_bucket *b, uint32_t n, struct ftstat_rpt *rpt)
+{
 
-      CHASH_STD_OUT(ftch_recprefix2162, comma);
+  bzero(b, sizeof (*b));
 
-    }
+  b->n = n;
+  b->npages = (n + FT_STAT_BUCKET_MASK) >> FT_STAT_BUCKET_SHIFT;
+  b->page_len = (n < FT_STAT_BUCKET_PAGE) ? n : FT_STAT_BUCKET_PAGE;
+  b->ps = (rpt->all_fields & FT_STAT_FIELD_PS) ? 1 : 0;
+  b->qs = (rpt->all_fields & FT_STAT_FIELD_QUANT) ? 1 : 0;
 
+  if (!(b->pages = (struct flow_bucket_page**)calloc(b->npages,
+    sizeof (*b->pages)))) {
+    fterr_warn("calloc(b->pages):");
+    return -1;
   }
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
-
-  if (ftsym2)
-    ftsym_free(ftsym2);
-
   return 0;
 
-} /* chash_prefix2162_dump */
+} /* bucket_alloc */
 
-static int chash_c64_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch)
+/*
+ * function: bucket_page_new
+ *
+ * Allocate counter page pg of b.  The page header and its arrays are
+ * a single zeroed allocation, the pps/bps and quantile arrays are only
+ * present when the report asked for those fields.
+ *
+ * returns: page or 0L on error
+ */
+static struct flow_bucket_page *bucket_page_new(struct flow_bucket *b,
+  uint32_t pg)
 {
+  struct flow_bucket_page *bp;
+  size_t len, size;
+  char *p;
 
-  CHASH_DUMP_INIT(ftchash_rec_c64, ftch_recc64);
+  len = b->page_len;
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  size = sizeof (*bp) + 5 * len * sizeof (uint64_t);
+  if (b->ps)
+    size += 6 * len * sizeof (double);
+  if (b->qs)
+    size += len * sizeof (struct ftstat_qs*);
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+  if (!(bp = (struct flow_bucket_page*)calloc(1, size))) {
+    fterr_warn("calloc(bp):");
+    return (struct flow_bucket_page*)0L;
+  }
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      sort_offset = offsetof(struct ftchash_rec_c64, c64);
-      sort_flags |= FT_CHASH_SORT_64;
-    } else
+  p = (char*)(bp + 1);
+
+  bp->recs = (uint64_t*)p; p += len * sizeof (uint64_t);
+  bp->flows = (uint64_t*)p; p += len * sizeof (uint64_t);
+  bp->octets = (uint64_t*)p; p += len * sizeof (uint64_t);
+  bp->packets = (uint64_t*)p; p += len * sizeof (uint64_t);
+  bp->duration = (uint64_t*)p; p += len * sizeof (uint64_t);
+
+  if (b->ps) {
+    bp->avg_pps = (double*)p; p += len * sizeof (double);
+    bp->avg_bps = (double*)p; p += len * sizeof (double);
+    bp->min_pps = (double*)p; p += len * sizeof (double);
+    bp->min_bps = (double*)p; p += len * sizeof (double);
+    bp->max_pps = (double*)p; p += len * sizeof (double);
+    bp->max_bps = (double*)p; p += len * sizeof (double);
+  }
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_c64);
+  if (b->qs)
+    bp->qs = (struct ftstat_qs**)p;
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+  b->pages[pg] = bp;
 
+  return bp;
 
-  } /* FT_STAT_OPT_SORT */
+} /* bucket_page_new */
 
-  ftchash_first(ftch);
+void bucket_free(struct flow_bucket *b)
+{
+  uint32_t pg;
 
-  while ((ftch_recc64 = ftchash_foreach(ftch))) {
+  if (b->pages) {
+    for (pg = 0; pg < b->npages; ++pg)
+      if (b->pages[pg])
+        free(b->pages[pg]);
+    free(b->pages);
+  }
+  if (b->index)
+    free(b->index);
 
-    len = comma = 0;
+  bzero(b, sizeof (*b));
 
-    DUMP_STD_OUT();
+} /* bucket_free */
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint64(fmt_buf+len, ftch_recc64->c64, FMT_JUST_LEFT);
-      comma = 1;
-    }
+/*
+ * function: bucket_calc
+ *
+ * Turn the pps/bps sums of each touched bucket into averages and
+ * count the buckets with packets in rpt->recs.
+ */
+static void bucket_calc(struct flow_bucket *b, struct ftstat_rpt *rpt)
+{
+  struct flow_bucket_page *bp;
+  uint32_t pg, i;
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  for (pg = 0; pg < b->npages; ++pg) {
 
-      CHASH_STDP_OUT(ftch_recc64, comma);
+    if (!(bp = b->pages[pg]))
+      continue;
 
-    } else {
+    for (i = 0; i < b->page_len; ++i) {
 
-      CHASH_STD_OUT(ftch_recc64, comma);
+      if (bp->duration[i] && b->ps) {
+        bp->avg_pps[i] /= (double)bp->recs[i];
+        bp->avg_bps[i] /= (double)bp->recs[i];
+      }
+
+      if (bp->packets[i])
+        ++rpt->recs;
 
     }
 
   }
 
-  return 0;
-
-} /* chash_c64_dump */
+} /* bucket_calc */
 
-static int chash_int_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch)
+/*
+ * function: bucket_index
+ *
+ * Rebuild b->index with the buckets that saw flows, in key order.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int bucket_index(struct flow_bucket *b)
 {
+  struct flow_bucket_page *bp;
+  uint32_t pg, i, n;
 
-  CHASH_DUMP_INIT(ftchash_rec_int, ftch_recint);
-
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
-
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
-
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      sort_offset = offsetof(struct ftchash_rec_int, time);
-      sort_flags |= FT_CHASH_SORT_32;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_FLOWS) {\
-      sort_offset = offsetof(struct ftchash_rec_int, nflows);\
-      sort_flags |= FT_CHASH_SORT_DOUBLE;\
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_OCTETS) {\
-      sort_offset = offsetof(struct ftchash_rec_int, noctets);\
-      sort_flags |= FT_CHASH_SORT_DOUBLE;\
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_PACKETS) {\
-      sort_offset = offsetof(struct ftchash_rec_int, npackets);\
-      sort_flags |= FT_CHASH_SORT_DOUBLE;\
-    }
-
-    ftchash_sort(ftch, sort_offset, sort_flags);
+  for (n = 0, pg = 0; pg < b->npages; ++pg)
+    if ((bp = b->pages[pg]))
+      for (i = 0; i < b->page_len; ++i)
+        if (bp->flows[i])
+          ++n;
 
+  if (b->index)
+    free(b->index);
 
-  } /* FT_STAT_OPT_SORT */
+  b->nindex = 0;
 
-  ftchash_first(ftch);
+  if (!(b->index = (uint32_t*)malloc((n+1)*sizeof(uint32_t)))) {
+    fterr_warn("malloc(b->index):");
+    return -1;
+  }
 
-  while ((ftch_recint = ftchash_foreach(ftch))) {
+  for (pg = 0; pg < b->npages; ++pg)
+    if ((bp = b->pages[pg]))
+      for (i = 0; i < b->page_len; ++i)
+        if (bp->flows[i])
+          b->index[b->nindex++] = (pg << FT_STAT_BUCKET_SHIFT) | i;
 
-    len = comma = 0;
+  return 0;
 
-    DUMP_STD_OUT();
+} /* bucket_index */
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint32(fmt_buf+len, ftch_recint->time, FMT_JUST_LEFT);
-      comma = 1;
-    }
+/*
+ * function: bucket_merge
+ *
+ * Add the counters of bucket src to b, both n entries.  Only the
+ * pages touched in src are visited.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int bucket_merge(struct flow_bucket *b, struct flow_bucket *src,
+  uint32_t n, struct ftstat_rpt *rpt)
+{
+  struct flow_bucket_page *bp, *sp;
+  uint32_t pg, i;
 
-/* XXX percent totals? */
+  for (pg = 0; pg < src->npages; ++pg) {
 
-    if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
-      if (comma) fmt_buf[len++] = ',';
-      len += sprintf(fmt_buf+len, "%f", ftch_recint->nflows);\
-      comma = 1;
-    }
+    if (!(sp = src->pages[pg]))
+      continue;
 
-    if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
-      if (comma) fmt_buf[len++] = ',';
-      len += sprintf(fmt_buf+len, "%f", ftch_recint->noctets);\
-      comma = 1;
-    }
+    if (!(bp = b->pages[pg]) && !(bp = bucket_page_new(b, pg)))
+      return -1;
 
-    if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
-      if (comma) fmt_buf[len++] = ',';
-      len += sprintf(fmt_buf+len, "%f", ftch_recint->npackets);\
-      comma = 1;
+    for (i = 0; i < b->page_len; ++i) {
+      bp->recs[i] += sp->recs[i];
+      bp->flows[i] += sp->flows[i];
+      bp->octets[i] += sp->octets[i];
+      bp->packets[i] += sp->packets[i];
+      bp->duration[i] += sp->duration[i];
     }
 
-    if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint64(fmt_buf+len, ftch_recint->nrecs, FMT_JUST_LEFT);
-      comma = 1;\
+    if (b->ps) {
+
+      for (i = 0; i < b->page_len; ++i) {
+        bp->avg_pps[i] += sp->avg_pps[i];
+        bp->avg_bps[i] += sp->avg_bps[i];
+        MERGE_MIN(bp->min_pps[i], sp->min_pps[i]);
+        MERGE_MIN(bp->min_bps[i], sp->min_bps[i]);
+        MERGE_MAX(bp->max_pps[i], sp->max_pps[i]);
+        MERGE_MAX(bp->max_bps[i], sp->max_bps[i]);
+      }
+
     }
 
-    fmt_buf[len++] = '\n';
-    fmt_buf[len] = 0;
+    if (b->qs && sp->qs) {
 
-    fputs(fmt_buf, fp);
+      for (i = 0; i < b->page_len; ++i)
+        if (sp->qs[i] && qs_merge(rpt, &bp->qs[i], sp->qs[i]))
+          return -1;
 
-    if (rpt->out->records && (tally.rt_recs == rpt->out->records)) {
-      fprintf(fp, "# stop, hit record limit.\n");
-      break;
     }
 
   }
 
   return 0;
 
-} /* chash_int_dump */
+} /* bucket_merge */
 
-static int chash_flow1_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1, const char *sym2)
+/*
+ * function: rpt_merge_totals
+ *
+ * Add the report totals of src to rpt.  The averages are still sums
+ * until f_calc() runs.
+ */
+static void rpt_merge_totals(struct ftstat_rpt *rpt, struct ftstat_rpt *src)
 {
-  struct ftsym *ftsym1, *ftsym2;
 
-  CHASH_DUMP_INIT(ftchash_rec_flow1, ftch_recflow1);
+  rpt->t_ignores += src->t_ignores;
+  rpt->t_recs += src->t_recs;
+  rpt->t_flows += src->t_flows;
+  rpt->t_octets += src->t_octets;
+  rpt->t_packets += src->t_packets;
+  rpt->t_duration += src->t_duration;
+  rpt->t_count += src->t_count;
 
-  ftsym1 = ftsym2 = (struct ftsym*)0L;
+  rpt->avg_pps += src->avg_pps;
+  rpt->avg_bps += src->avg_bps;
+  MERGE_MIN(rpt->min_pps, src->min_pps);
+  MERGE_MIN(rpt->min_bps, src->min_bps);
+  MERGE_MAX(rpt->max_pps, src->max_pps);
+  MERGE_MAX(rpt->max_bps, src->max_bps);
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES) {
-    ftsym1 = ftsym_new(sym1);
-    ftsym2 = ftsym_new(sym2);
+  if (src->time_start < rpt->time_start)
+    rpt->time_start = src->time_start;
+
+  if (src->time_end > rpt->time_end)
+    rpt->time_end = src->time_end;
+
+} /* rpt_merge_totals */
+
+/*
+ * function: state_write
+ *
+ * fwrite() n bytes of buf to a state file.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int state_write(FILE *fp, const void *buf, size_t n)
+{
+
+  if (n && (fwrite(buf, n, 1, fp) != 1)) {
+    fterr_warn("fwrite()");
+    return -1;
   }
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  return 0;
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+} /* state_write */
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, src_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, dst_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, src_port);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, dst_port);
-      sort_flags |= FT_CHASH_SORT_16;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY5) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, prot);
-      sort_flags |= FT_CHASH_SORT_8;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY6) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, tos);
-      sort_flags |= FT_CHASH_SORT_8;
-    } else
+/*
+ * function: state_read
+ *
+ * fread() n bytes of a state file into buf.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int state_read(FILE *fp, void *buf, size_t n)
+{
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_flow1);
+  if (n && (fread(buf, n, 1, fp) != 1)) {
+    fterr_warnx("state file: short read");
+    return -1;
+  }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+  return 0;
 
-  } /* FT_STAT_OPT_SORT */
+} /* state_read */
 
-  ftchash_first(ftch);
+/*
+ * function: state_write_str
+ *
+ * Write str as a 32 bit length and the characters.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int state_write_str(FILE *fp, const char *str)
+{
+  uint32_t len;
 
-  while ((ftch_recflow1 = ftchash_foreach(ftch))) {
+  len = strlen(str);
 
-    len = comma = 0;
+  if (state_write(fp, &len, sizeof len) || state_write(fp, str, len))
+    return -1;
 
-    DUMP_STD_OUT();
+  return 0;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->src_prefix,
-          ftch_recflow1->src_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->src_prefix, 64, fmt);
-      comma = 1;
-    }
+} /* state_write_str */
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->dst_prefix,
-          ftch_recflow1->dst_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->dst_prefix, 64, fmt);
-      comma = 1;
-    }
+/*
+ * function: state_read_str
+ *
+ * Read a string written by state_write_str().
+ *
+ * returns allocated string or 0L for error
+ */
+static char *state_read_str(FILE *fp)
+{
+  uint32_t len;
+  char *str;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recflow1->src_port, FMT_JUST_LEFT);
-      comma = 1;
-    }
+  if (state_read(fp, &len, sizeof len))
+    return (char*)0L;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint16s(ftsym1, FMT_SYM_LEN, fmt_buf+len,
-        ftch_recflow1->dst_port, FMT_JUST_LEFT);
-      comma = 1;
-    }
+  if (len > FT_STAT_STATE_MAXSTR) {
+    fterr_warnx("state file: bad string length %lu", (unsigned long)len);
+    return (char*)0L;
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY5) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint8s(ftsym2, FMT_SYM_LEN, fmt_buf+len, ftch_recflow1->prot,
-        FMT_JUST_LEFT);
-      comma = 1;
-    }
+  if (!(str = (char*)malloc(len+1))) {
+    fterr_warn("malloc()");
+    return (char*)0L;
+  }
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY6) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint8(fmt_buf+len, ftch_recflow1->tos,
-        FMT_JUST_LEFT);
-      comma = 1;
-    }
+  if (state_read(fp, str, len)) {
+    free(str);
+    return (char*)0L;
+  }
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  str[len] = 0;
 
-      CHASH_STDP_OUT(ftch_recflow1, comma);
+  return str;
 
-    } else {
+} /* state_read_str */
 
-      CHASH_STD_OUT(ftch_recflow1, comma);
+/*
+ * function: rpt_save_totals
+ *
+ * Write the totals of rpt kept by every report type.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int rpt_save_totals(struct ftstat_rpt *rpt, FILE *fp)
+{
+  uint64_t t[7];
+  double ps[6];
+  uint32_t tm[2];
 
-    }
+  t[0] = rpt->t_ignores; t[1] = rpt->t_recs; t[2] = rpt->t_flows;
+  t[3] = rpt->t_octets; t[4] = rpt->t_packets; t[5] = rpt->t_duration;
+  t[6] = rpt->t_count;
 
-  }
+  ps[0] = rpt->avg_pps; ps[1] = rpt->min_pps; ps[2] = rpt->max_pps;
+  ps[3] = rpt->avg_bps; ps[4] = rpt->min_bps; ps[5] = rpt->max_bps;
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
+  tm[0] = rpt->time_start; tm[1] = rpt->time_end;
 
-  if (ftsym2)
-    ftsym_free(ftsym2);
+  if (state_write(fp, t, sizeof t) || state_write(fp, ps, sizeof ps) ||
+      state_write(fp, tm, sizeof tm))
+    return -1;
 
   return 0;
 
-} /* chash_flow1_dump */
+} /* rpt_save_totals */
 
-static int chash_flow12_dump(FILE *fp, struct ftstat_rpt *rpt,
-  struct ftchash *ftch, const char *sym1)
+/*
+ * function: rpt_load_totals
+ *
+ * Merge totals written by rpt_save_totals() into rpt.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int rpt_load_totals(struct ftstat_rpt *rpt, FILE *fp)
 {
-  struct ftsym *ftsym1;
+  struct ftstat_rpt src;
+  uint64_t t[7];
+  double ps[6];
+  uint32_t tm[2];
 
-  CHASH_DUMP_INIT(ftchash_rec_flow1, ftch_recflow1);
+  if (state_read(fp, t, sizeof t) || state_read(fp, ps, sizeof ps) ||
+      state_read(fp, tm, sizeof tm))
+    return -1;
 
-  ftsym1 = (struct ftsym*)0L;
+  bzero(&src, sizeof src);
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES) {
-    ftsym1 = ftsym_new(sym1);
-  }
+  src.t_ignores = t[0]; src.t_recs = t[1]; src.t_flows = t[2];
+  src.t_octets = t[3]; src.t_packets = t[4]; src.t_duration = t[5];
+  src.t_count = t[6];
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  src.avg_pps = ps[0]; src.min_pps = ps[1]; src.max_pps = ps[2];
+  src.avg_bps = ps[3]; src.min_bps = ps[4]; src.max_bps = ps[5];
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      sort_flags = FT_CHASH_SORT_ASCENDING;
-    else
-      sort_flags = 0;
+  src.time_start = tm[0]; src.time_end = tm[1];
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY1) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, src_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY2) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, dst_prefix);
-      sort_flags |= FT_CHASH_SORT_40;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY3) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, prot);
-      sort_flags |= FT_CHASH_SORT_8;
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_KEY4) {
-      sort_offset = offsetof(struct ftchash_rec_flow1, tos);
-      sort_flags |= FT_CHASH_SORT_8;
-    } else
+  rpt_merge_totals(rpt, &src);
 
-    CHASH_DUMP_STD_SORT(ftchash_rec_flow1);
+  return 0;
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+} /* rpt_load_totals */
 
-  } /* FT_STAT_OPT_SORT */
+/*
+ * function: chash_save
+ *
+ * Write the record layout and records of a report hash table, cm
+ * describes the record as for ftchash_merge().
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_save(struct ftchash *ftch, FILE *fp, struct chash_merge *cm)
+{
+  uint32_t size[2];
 
-  ftchash_first(ftch);
+  size[0] = ftch->d_size;
+  size[1] = ftch->key_size;
 
-  while ((ftch_recflow1 = ftchash_foreach(ftch))) {
+  if (state_write(fp, size, sizeof size) ||
+      ftchash_save(ftch, fp, chash_std_clear, cm))
+    return -1;
 
-    len = comma = 0;
+  return 0;
 
-    DUMP_STD_OUT();
+} /* chash_save */
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY1) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_SRC_PREFIX_LEN|FT_STAT_OPT_SRC_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->src_prefix,
-          ftch_recflow1->src_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->src_prefix,
-          64, fmt);
-      comma = 1;
-    }
+/*
+ * function: chash_load
+ *
+ * Merge records written by chash_save() into ftch, cm describes the
+ * record as for ftchash_merge().
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_load(struct ftchash *ftch, FILE *fp, struct chash_merge *cm)
+{
+  uint32_t size[2];
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY2) {
-      if (comma) fmt_buf[len++] = ',';
-      if (rpt->options &
-        (FT_STAT_OPT_DST_PREFIX_LEN|FT_STAT_OPT_DST_PREFIX_MASK))
-        len += fmt_ipv4prefixs(fmt_buf+len, ftch_recflow1->dst_prefix,
-          ftch_recflow1->dst_mask, 64, fmt);
-      else
-        len += fmt_ipv4s(fmt_buf+len, ftch_recflow1->dst_prefix, 64, fmt);
-      comma = 1;
-    }
+  if (state_read(fp, size, sizeof size))
+    return -1;
+
+  if ((size[0] != ftch->d_size) || (size[1] != ftch->key_size)) {
+    fterr_warnx("%s: state record size differs.", cm->rpt->name);
+    return -1;
+  }
+
+  return ftchash_load(ftch, fp, chash_load_combine, cm);
+
+} /* chash_load */
+
+/*
+ * function: bucket_save
+ *
+ * Write the touched pages of b, each as its page number followed by
+ * the counter arrays of the page.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int bucket_save(struct flow_bucket *b, uint32_t n,
+  struct ftstat_rpt *rpt, FILE *fp)
+{
+  struct flow_bucket_page *bp;
+  uint32_t pg, npages;
+  size_t s64, sd;
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY3) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint8s(ftsym1, FMT_SYM_LEN, fmt_buf+len, ftch_recflow1->prot,
-        FMT_JUST_LEFT);
-      comma = 1;
-    }
+  s64 = b->page_len * sizeof (uint64_t);
+  sd = b->page_len * sizeof (double);
 
-    if (rpt->out->fields & FT_STAT_FIELD_KEY4) {
-      if (comma) fmt_buf[len++] = ',';
-      len += fmt_uint8(fmt_buf+len, ftch_recflow1->tos,
-        FMT_JUST_LEFT);
-      comma = 1;
-    }
+  for (npages = 0, pg = 0; pg < b->npages; ++pg)
+    if (b->pages[pg])
+      ++npages;
 
-    if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  if (state_write(fp, &n, sizeof n) || state_write(fp, &npages, sizeof npages))
+    return -1;
 
-      CHASH_STDP_OUT(ftch_recflow1, comma);
+  for (pg = 0; pg < b->npages; ++pg) {
 
-    } else {
+    if (!(bp = b->pages[pg]))
+      continue;
 
-      CHASH_STD_OUT(ftch_recflow1, comma);
+    if (state_write(fp, &pg, sizeof pg) ||
+        state_write(fp, bp->recs, s64) || state_write(fp, bp->flows, s64) ||
+        state_write(fp, bp->octets, s64) || state_write(fp, bp->packets, s64) ||
+        state_write(fp, bp->duration, s64))
+      return -1;
 
+    if (b->ps) {
+      if (state_write(fp, bp->avg_pps, sd) ||
+          state_write(fp, bp->avg_bps, sd) ||
+          state_write(fp, bp->min_pps, sd) ||
+          state_write(fp, bp->min_bps, sd) ||
+          state_write(fp, bp->max_pps, sd) ||
+          state_write(fp, bp->max_bps, sd))
+        return -1;
     }
 
   }
 
-  if (ftsym1)
-    ftsym_free(ftsym1);
-
   return 0;
 
-} /* chash_flow12_dump */
-
+} /* bucket_save */
 
-static int bucket_dump1(FILE *fp, struct ftstat_rpt *rpt, struct flow_bucket *b,
-  uint32_t nindex, const char *symfile)
+/*
+ * function: bucket_load
+ *
+ * Merge pages written by bucket_save() into b.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int bucket_load(struct flow_bucket *b, uint32_t n,
+  struct ftstat_rpt *rpt, FILE *fp)
 {
-  struct ftsym *ftsym;
-  struct tally tally;
-  char fmt_buf1[32], fmt_buf[1024];
-  int len, comma;
-  int32_t i, start, end, increment;
-  uint32_t *index;
-
-  ftsym = (struct ftsym*)0L;
-  fmt_buf1[0] = fmt_buf[0] = 0;
-  index = b->index;
-  bzero(&tally, sizeof tally);
+  struct flow_bucket src;
+  struct flow_bucket_page *bp;
+  size_t s64, sd;
+  uint32_t sn, npages, pg;
+  int ret;
 
-  if (rpt->out->options & FT_STAT_OPT_NAMES)
-    ftsym = ftsym_new(symfile);
+  if (state_read(fp, &sn, sizeof sn) || state_read(fp, &npages, sizeof npages))
+    return -1;
 
-  start = 0; end = nindex, increment = 1;
+  if (sn != n) {
+    fterr_warnx("%s: state has %lu buckets.", rpt->name, (unsigned long)sn);
+    return -1;
+  }
 
-  if (rpt->out->options & FT_STAT_OPT_SORT) {
+  if (bucket_alloc(&src, n, rpt))
+    return -1;
 
-    if (rpt->out->sort_order & FT_STAT_SORT_ASCEND)
-      start = nindex - 1, end = -1, increment = -1;
+  s64 = src.page_len * sizeof (uint64_t);
+  sd = src.page_len * sizeof (double);
 
-    if (rpt->out->sort_field == FT_STAT_FIELD_KEY) {
-      ; /* sorted by default */
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_FLOWS) {
-      sort_i64 = b->flows;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp64);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_OCTETS) {
-      sort_i64 = b->octets;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp64);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_PACKETS) {
-      sort_i64 = b->packets;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp64);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_DURATION) {
-      sort_i64 = b->duration;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp64);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_AVG_PPS) {
-      sort_idouble = b->avg_pps;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp_double);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_MIN_PPS) {
-      sort_idouble = b->min_pps;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp_double);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_MAX_PPS) {
-      sort_idouble = b->max_pps;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp_double);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_AVG_BPS) {
-      sort_idouble = b->avg_bps;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp_double);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_MIN_BPS) {
-      sort_idouble = b->min_bps;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp_double);
-    } else if (rpt->out->sort_field == FT_STAT_FIELD_MAX_BPS) {
-      sort_idouble = b->max_bps;
-      qsort(b->index, nindex, sizeof (uint32_t), sort_cmp_double);
-    } else {
-      fterr_errx(1,"bucket_dump1(): internal error");
-    }
+  ret = -1; /* err */
 
-  } /* FT_STAT_OPT_SORT */
+  for (; npages; --npages) {
 
-  /* need to know the total number of records first */
-  if (rpt->out->options & FT_STAT_OPT_TALLY) {
+    if (state_read(fp, &pg, sizeof pg))
+      goto out;
 
-    for (i = start; i != end; i += increment) {
+    if ((pg >= src.npages) || src.pages[pg]) {
+      fterr_warnx("%s: state has bad bucket page.", rpt->name);
+      goto out;
+    }
 
-      if (!b->flows[index[i]])
-        continue;
+    if (!(bp = bucket_page_new(&src, pg)))
+      goto out;
 
-      ++tally.t_recs;
+    if (state_read(fp, bp->recs, s64) || state_read(fp, bp->flows, s64) ||
+        state_read(fp, bp->octets, s64) || state_read(fp, bp->packets, s64) ||
+        state_read(fp, bp->duration, s64))
+      goto out;
 
+    if (src.ps) {
+      if (state_read(fp, bp->avg_pps, sd) || state_read(fp, bp->avg_bps, sd) ||
+          state_read(fp, bp->min_pps, sd) || state_read(fp, bp->min_bps, sd) ||
+          state_read(fp, bp->max_pps, sd) || state_read(fp, bp->max_bps, sd))
+        goto out;
     }
 
   }
 
-  if (rpt->out->options & FT_STAT_OPT_PERCENT) {
+  ret = bucket_merge(b, &src, n, rpt);
 
-    for (i = start; i != end; i += increment) {
+out:
 
-      if (!b->flows[index[i]])
-        continue;
+  bucket_free(&src);
 
-      if ((rpt->out->options & FT_STAT_OPT_TALLY) && tally.rt_recs &&
-        (!(tally.rt_recs % rpt->out->tally))) {
+  return ret;
 
-        if (rpt->all_fields & FT_STAT_FIELD_PS)
-          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f %%avg-bps=%3.3f %%avg-pps=%3.3f\n",
-            ((double)tally.rt_recs/(double)tally.t_recs)*100,
-            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
-            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
-            ((double)tally.rt_packets/(double)rpt->t_packets)*100,
-            (((double)tally.ravg_bps/(double)tally.rt_frecs)/
-              (double)rpt->avg_bps)*100,
-            (((double)tally.ravg_pps/(double)tally.rt_frecs)/
-              (double)rpt->avg_pps)*100);
-         else
-          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f\n",
-            ((double)tally.rt_recs/(double)tally.t_recs)*100,
-            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
-            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
-            ((double)tally.rt_packets/(double)rpt->t_packets)*100);
+} /* bucket_load */
 
-      } /* tally */
+/*
+ * function: chash_std_combine
+ *
+ * ftchash_merge() callback for the standard hash records, arg is
+ * the struct chash_merge describing the record.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_std_combine(void *drec, void *srec, void *arg)
+{
+  struct chash_merge *cm;
+  struct ftps *dps, *sps;
+  uint64_t *d, *s;
 
-      tally.rt_flows += b->flows[index[i]];
-      tally.rt_octets += b->octets[index[i]];
-      tally.rt_packets += b->packets[index[i]];
-      tally.rt_frecs += b->recs[index[i]];
-      tally.rt_recs ++;
-      if (rpt->all_fields & FT_STAT_FIELD_PS) {
-        tally.ravg_bps += b->avg_bps[index[i]] * b->recs[index[i]];
-        tally.ravg_pps += b->avg_pps[index[i]] * b->recs[index[i]];
-      }
+  cm = arg;
 
-      len = comma = 0;
+  /* nrecs, nflows, noctets, npackets, etime */
+  d = (uint64_t*)((char*)drec + cm->nrecs);
+  s = (uint64_t*)((char*)srec + cm->nrecs);
 
-      DUMP_STD_OUT();
+  d[0] += s[0];
+  d[1] += s[1];
+  d[2] += s[2];
+  d[3] += s[3];
+  d[4] += s[4];
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint32s(ftsym, FMT_SYM_LEN, fmt_buf+len, b->index[i],
-          FMT_JUST_LEFT);
-        comma = 1;
-      }
+  if (cm->ps != -1) {
 
-      if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->flows[index[i]] / (double)rpt->t_flows)*100.0);
-        comma = 1;
-      }
+    dps = (struct ftps*)((char*)drec + cm->ps);
+    sps = (struct ftps*)((char*)srec + cm->ps);
 
-      if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->octets[index[i]] / (double)rpt->t_octets)*100.0);
-        comma = 1;
-      }
+    dps->avg_pps += sps->avg_pps;
+    dps->avg_bps += sps->avg_bps;
+    MERGE_MIN(dps->min_pps, sps->min_pps);
+    MERGE_MIN(dps->min_bps, sps->min_bps);
+    MERGE_MAX(dps->max_pps, sps->max_pps);
+    MERGE_MAX(dps->max_bps, sps->max_bps);
 
-      if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->packets[index[i]] / (double)rpt->t_packets)*100.0);
-        comma = 1;
-      }
+    if (sps->qs && qs_merge(cm->rpt, &dps->qs, sps->qs))
+      return -1;
 
+  }
 
-      if (rpt->out->fields & FT_STAT_FIELD_DURATION) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->duration[index[i]] / (double)rpt->t_duration)*100.0);
-        comma = 1;
-      }
+  return 0;
 
-      if (rpt->out->fields & FT_STAT_FIELD_AVG_BPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->avg_bps[index[i]] / (double)rpt->avg_bps)*100.0);
-        comma = 1;
-      }
+} /* chash_std_combine */
 
-      if (rpt->out->fields & FT_STAT_FIELD_MIN_BPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->min_bps[index[i]] / (double)rpt->min_bps)*100.0);
-        comma = 1;
-      }
+/*
+ * function: chash_std_clear
+ *
+ * ftchash_save() callback, zero the quantile sketch pointer of a
+ * record so no address is written to the state file.
+ */
+static void chash_std_clear(void *rec, void *arg)
+{
+  struct chash_merge *cm;
 
-      if (rpt->out->fields & FT_STAT_FIELD_MAX_BPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->max_bps[index[i]] / (double)rpt->max_bps)*100.0);
-        comma = 1;
-      }
+  cm = arg;
 
-      if (rpt->out->fields & FT_STAT_FIELD_AVG_PPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->avg_pps[index[i]] / (double)rpt->avg_pps)*100.0);
-        comma = 1;
-      }
+  if (cm->ps != -1)
+    ((struct ftps*)((char*)rec + cm->ps))->qs = (struct ftstat_qs*)0L;
 
-      if (rpt->out->fields & FT_STAT_FIELD_MIN_PPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->min_pps[index[i]] / (double)rpt->min_pps)*100.0);
-        comma = 1;
-      }
+} /* chash_std_clear */
 
-      if (rpt->out->fields & FT_STAT_FIELD_MAX_PPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f",
-         ((double)b->max_pps[index[i]] / (double)rpt->max_pps)*100.0);
-        comma = 1;
-      }
+/*
+ * function: chash_load_combine
+ *
+ * ftchash_load() callback, chash_std_combine() of a record read from a
+ * state file.  The sketch pointer read is not trusted.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_load_combine(void *drec, void *srec, void *arg)
+{
 
-      if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, b->recs[index[i]], FMT_JUST_LEFT);\
-        comma = 1;
-      }
+  chash_std_clear(srec, arg);
 
-      fmt_buf[len++] = '\n';
-      fmt_buf[len] = 0;
+  return chash_std_combine(drec, srec, arg);
 
-      fputs(fmt_buf, fp);
+} /* chash_load_combine */
 
-      if (rpt->out->records && (tally.rt_recs == rpt->out->records)) {
-        fprintf(fp, "# stop, hit record limit.\n");
-        break;
-      }
+/*
+ * function: chash_std_final
+ *
+ * ftchash_unspill() callback, the per second averages of STD_CALC_HASH
+ * for one record.  arg is the struct chash_merge describing the record.
+ */
+static void chash_std_final(void *rec, void *arg)
+{
+  struct chash_merge *cm;
+  struct ftps *ps;
+  uint64_t *c;
 
-    }
+  cm = arg;
 
-  } else {
+  if (cm->ps == -1)
+    return;
 
-    for (i = start; i != end; i += increment) {
+  /* nrecs, nflows, noctets, npackets, etime */
+  c = (uint64_t*)((char*)rec + cm->nrecs);
+  ps = (struct ftps*)((char*)rec + cm->ps);
 
-      if (!b->flows[index[i]])
-        continue;
+  if (c[4]) {
+    ps->avg_pps /= (double)c[0];
+    ps->avg_bps /= (double)c[0];
+  }
 
-      if ((rpt->out->options & FT_STAT_OPT_TALLY) && tally.rt_recs &&
-        (!(tally.rt_recs % rpt->out->tally))) {
+} /* chash_std_final */
 
-        if (rpt->all_fields & FT_STAT_FIELD_PS)
-          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f %%avg-bps=%3.3f %%avg-pps=%3.3f\n",
-            ((double)tally.rt_recs/(double)tally.t_recs)*100,
-            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
-            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
-            ((double)tally.rt_packets/(double)rpt->t_packets)*100,
-            (((double)tally.ravg_bps/(double)tally.rt_frecs)/
-              (double)rpt->avg_bps)*100,
-            (((double)tally.ravg_pps/(double)tally.rt_frecs)/
-              (double)rpt->avg_pps)*100);
-         else
-          fprintf(fp, "#TALLY %%recs=%3.3f %%flows=%3.3f %%octets=%3.3f %%packets=%3.3f\n",
-            ((double)tally.rt_recs/(double)tally.t_recs)*100,
-            ((double)tally.rt_flows/(double)rpt->t_flows)*100,
-            ((double)tally.rt_octets/(double)rpt->t_octets)*100,
-            ((double)tally.rt_packets/(double)rpt->t_packets)*100);
+/*
+ * function: chash_std_unspill
+ *
+ * calc for a standard hash table that spilled past its memory-limit.
+ * The runs are merged back keeping only the records some output of
+ * rpt can show, an output without a records limit or sorted on the
+ * key keeps them all.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_std_unspill(struct ftstat_rpt *rpt, struct ftchash *ftch,
+  int nrecs, int ps)
+{
+  struct ftstat_rpt_out *ftsro;
+  struct ftchash_keep *keep;
+  struct chash_merge cm;
+  int nkeep, n, ret;
 
-      } /* tally */
+  cm.nrecs = nrecs;
+  cm.ps = ps;
+  cm.rpt = rpt;
 
-      tally.rt_flows += b->flows[index[i]];
-      tally.rt_octets += b->octets[index[i]];
-      tally.rt_packets += b->packets[index[i]];
-      tally.rt_recs ++;
-      tally.rt_frecs += b->recs[index[i]];
-      if (rpt->all_fields & FT_STAT_FIELD_PS) {
-        tally.ravg_bps += b->avg_bps[index[i]] * b->recs[index[i]];
-        tally.ravg_pps += b->avg_pps[index[i]] * b->recs[index[i]];
-      }
+  n = 0;
+  FT_STAILQ_FOREACH(ftsro, &rpt->outs, chain)
+    ++n;
 
-      len = comma = 0;
+  if (!(keep = (struct ftchash_keep*)malloc((n+1) * sizeof *keep))) {
+    fterr_warn("malloc()");
+    return -1;
+  }
 
-      DUMP_STD_OUT();
+  nkeep = 0;
+  FT_STAILQ_FOREACH(ftsro, &rpt->outs, chain) {
 
-      if (rpt->out->fields & FT_STAT_FIELD_KEY) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint32s(ftsym, FMT_SYM_LEN, fmt_buf+len, b->index[i],
-          FMT_JUST_LEFT);
-        comma = 1;
-      }
+    /* every record is shown, or as many as there can be */
+    if ((!ftsro->records) ||
+      (ftsro->records >= ftch->spill_recs + ftch->entries)) {
+      nkeep = 0;
+      break;
+    }
 
-      if (rpt->out->fields & FT_STAT_FIELD_FLOWS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, b->flows[index[i]], FMT_JUST_LEFT);
-        comma = 1;
-      }
+    keep[nkeep].k = ftsro->records;
+    keep[nkeep].flags = 0;
 
-      if (rpt->out->fields & FT_STAT_FIELD_OCTETS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, b->octets[index[i]], FMT_JUST_LEFT);
-        comma = 1;
-      }
+    if (!(ftsro->options & FT_STAT_OPT_SORT)) {
+      keep[nkeep++].offset = -1;
+      continue;
+    }
+
+    if (ftsro->sort_order & FT_STAT_SORT_ASCEND)
+      keep[nkeep].flags = FT_CHASH_SORT_ASCENDING;
+
+    /* nrecs, nflows, noctets, npackets, etime */
+    if (ftsro->sort_field == FT_STAT_FIELD_FLOWS)
+      keep[nkeep].offset = nrecs + 8;
+    else if (ftsro->sort_field == FT_STAT_FIELD_OCTETS)
+      keep[nkeep].offset = nrecs + 16;
+    else if (ftsro->sort_field == FT_STAT_FIELD_PACKETS)
+      keep[nkeep].offset = nrecs + 24;
+    else if (ftsro->sort_field == FT_STAT_FIELD_DURATION)
+      keep[nkeep].offset = nrecs + 32;
+    else if (ps == -1)
+      keep[nkeep].offset = -1;
+    else if (ftsro->sort_field == FT_STAT_FIELD_AVG_PPS)
+      keep[nkeep].offset = ps + offsetof(struct ftps, avg_pps);
+    else if (ftsro->sort_field == FT_STAT_FIELD_MIN_PPS)
+      keep[nkeep].offset = ps + offsetof(struct ftps, min_pps);
+    else if (ftsro->sort_field == FT_STAT_FIELD_MAX_PPS)
+      keep[nkeep].offset = ps + offsetof(struct ftps, max_pps);
+    else if (ftsro->sort_field == FT_STAT_FIELD_AVG_BPS)
+      keep[nkeep].offset = ps + offsetof(struct ftps, avg_bps);
+    else if (ftsro->sort_field == FT_STAT_FIELD_MIN_BPS)
+      keep[nkeep].offset = ps + offsetof(struct ftps, min_bps);
+    else if (ftsro->sort_field == FT_STAT_FIELD_MAX_BPS)
+      keep[nkeep].offset = ps + offsetof(struct ftps, max_bps);
+    else
+      keep[nkeep].offset = -1;
+
+    /* sorted on a key field */
+    if (keep[nkeep].offset == -1) {
+      nkeep = 0;
+      break;
+    }
+
+    if ((ps == -1) || (keep[nkeep].offset < ps))
+      keep[nkeep].flags |= FT_CHASH_SORT_64;
+    else
+      keep[nkeep].flags |= FT_CHASH_SORT_DOUBLE;
 
-      if (rpt->out->fields & FT_STAT_FIELD_PACKETS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, b->packets[index[i]], FMT_JUST_LEFT);
-        comma = 1;
-      }
+    ++nkeep;
 
-      if (rpt->out->fields & FT_STAT_FIELD_DURATION) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, b->duration[index[i]], FMT_JUST_LEFT);
-        comma = 1;
-      }
+  } /* ftsro */
 
-      if (rpt->out->fields & FT_STAT_FIELD_AVG_BPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f", b->avg_bps[index[i]]);
-        comma = 1;
-      }
+  ret = ftchash_unspill(ftch, chash_std_combine, chash_std_final, &cm,
+    keep, nkeep);
 
-      if (rpt->out->fields & FT_STAT_FIELD_MIN_BPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f", b->min_bps[index[i]]);
-        comma = 1;
-      }
+  free(keep);
 
-      if (rpt->out->fields & FT_STAT_FIELD_MAX_BPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f", b->max_bps[index[i]]);
-        comma = 1;
-      }
+  if (ret) {
+    fterr_warnx("ftchash_unspill(): failed");
+    return -1;
+  }
 
-      if (rpt->out->fields & FT_STAT_FIELD_AVG_PPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f", b->avg_pps[index[i]]);
-        comma = 1;
-      }
+  rpt->recs = ftch->merge_keys;
+  rpt->spill_runs = ftch->spill_runs;
+  rpt->spill_recs = ftch->spill_recs;
+  rpt->merge_recs = ftch->merge_recs;
 
-      if (rpt->out->fields & FT_STAT_FIELD_MIN_PPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f", b->min_pps[index[i]]);
-        comma = 1;
-      }
+  return 0;
 
-      if (rpt->out->fields & FT_STAT_FIELD_MAX_PPS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += sprintf(fmt_buf+len, "%f", b->max_pps[index[i]]);
-        comma = 1;
-      }
+} /* chash_std_unspill */
 
-      if (rpt->out->fields & FT_STAT_FIELD_FRECS) {
-        if (comma) fmt_buf[len++] = ',';
-        len += fmt_uint64(fmt_buf+len, b->recs[index[i]], FMT_JUST_LEFT);\
-        comma = 1;
-      }
+/*
+ * function: chash_std_bound
+ *
+ * make the standard hash table of rpt a heavy-hitters summary.  Without
+ * a counter given it is ranked on the sort field of the first output
+ * sorted on flows, octets or packets, else on flows.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_std_bound(struct ftstat_rpt *rpt, struct ftchash *ftch,
+  int nrecs, int ps)
+{
+  struct ftstat_rpt_out *ftsro;
+  int offset;
 
-      fmt_buf[len++] = '\n';
-      fmt_buf[len] = 0;
+  if (!rpt->heavy_field) {
 
-      fputs(fmt_buf, fp);
+    rpt->heavy_field = FT_STAT_FIELD_FLOWS;
 
-      if (rpt->out->records && (tally.rt_recs == rpt->out->records)) {
-        fprintf(fp, "# stop, hit record limit.\n");
+    FT_STAILQ_FOREACH(ftsro, &rpt->outs, chain) {
+      if ((ftsro->options & FT_STAT_OPT_SORT) &&
+        (ftsro->sort_field & (FT_STAT_FIELD_FLOWS|FT_STAT_FIELD_OCTETS|
+          FT_STAT_FIELD_PACKETS))) {
+        rpt->heavy_field = ftsro->sort_field;
         break;
       }
+    }
 
-    } /* foreach record */
+  }
 
-  } /* totals */
+  /* nrecs, nflows, noctets, npackets */
+  if (rpt->heavy_field == FT_STAT_FIELD_OCTETS)
+    offset = nrecs + 16;
+  else if (rpt->heavy_field == FT_STAT_FIELD_PACKETS)
+    offset = nrecs + 24;
+  else
+    offset = nrecs + 8;
 
-  if (ftsym)
-    ftsym_free(ftsym);
+  /* sketches of evicted keys are reset and reused */
+  rpt->qs_offset = ps + offsetof(struct ftps, qs);
+
+  if (ftchash_bound(ftch, rpt->heavy_hitters, offset,
+    (rpt->all_fields & FT_STAT_FIELD_QUANT) ? chash_std_evict :
+    (void (*)(void*, void*))0L, rpt)) {
+    fterr_warnx("ftchash_bound(): failed");
+    return -1;
+  }
 
   return 0;
 
-} /* bucket_dump1 */
+} /* chash_std_bound */
 
-static int recn_dump(FILE *fp, int fields, char *key, char *key1,
-  char *key2, char *key3, char *key4, char *key5, char *key6)
+/*
+ * function: chash_std_evict
+ *
+ * ftchash_bound() callback, reset the quantile sketches of a record
+ * about to be taken over by another key and keep them for qs_new().
+ */
+static void chash_std_evict(void *rec, void *arg)
 {
-  int comma;
+  struct ftstat_rpt *rpt;
+  struct ftstat_qs *qs;
+  int i;
 
-  fprintf(fp, "# recn: ");
-  comma = 0;
+  rpt = arg;
 
-  if (fields & FT_STAT_FIELD_INDEX) {
-    fprintf(fp, "%sindex", comma ? "," : "");
-    comma = 1;
-  }
+  if (!(qs = *(struct ftstat_qs**)((char*)rec + rpt->qs_offset)))
+    return;
 
-  if (fields & FT_STAT_FIELD_FIRST) {
-    fprintf(fp, "%sfirst", comma ? "," : "");
-    comma = 1;
-  }
+  for (i = 0; i < FT_STAT_QS_N; ++i)
+    ftqs_free(&qs->q[i]);
 
-  if (fields & FT_STAT_FIELD_LAST) {
-    fprintf(fp, "%slast", comma ? "," : "");
-    comma = 1;
-  }
+  qs->spare = rpt->qs_spare;
+  rpt->qs_spare = qs;
 
-  if (fields & FT_STAT_FIELD_KEY) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key);
-    comma = 1;
-  }
+} /* chash_std_evict */
 
-  if (fields & FT_STAT_FIELD_KEY1) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key1);
-    comma = 1;
-  }
+/*
+ * function: qs_new
+ *
+ * empty quantile sketches for a key of rpt, a spare from an evicted
+ * key or a new allocation.
+ *
+ * returns allocated struct or 0L for error
+ */
+static struct ftstat_qs *qs_new(struct ftstat_rpt *rpt)
+{
+  struct ftstat_qs *qs;
 
-  if (fields & FT_STAT_FIELD_KEY2) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key2);
-    comma = 1;
+  if ((qs = rpt->qs_spare)) {
+    rpt->qs_spare = qs->spare;
+    qs->spare = (struct ftstat_qs*)0L;
+    return qs;
   }
 
-  if (fields & FT_STAT_FIELD_KEY3) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key3);
-    comma = 1;
+  if (!(qs = (struct ftstat_qs*)malloc(sizeof *qs))) {
+    fterr_warn("malloc()");
+    return (struct ftstat_qs*)0L;
   }
 
-  if (fields & FT_STAT_FIELD_KEY4) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key4);
-    comma = 1;
-  }
+  bzero(qs, sizeof *qs);
+  qs->next = rpt->qs;
+  rpt->qs = qs;
 
-  if (fields & FT_STAT_FIELD_KEY5) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key5);
-    comma = 1;
-  }
+  return qs;
 
-  if (fields & FT_STAT_FIELD_KEY6) {
-    fprintf(fp, "%s%s*", comma ? "," : "", key6);
-    comma = 1;
-  }
+} /* qs_new */
 
-  if (fields & FT_STAT_FIELD_COUNT) {
-    fprintf(fp, "%s%s", comma ? "," : "", key1);
-    comma = 1;
-  }
+/*
+ * function: qs_accum
+ *
+ * add one flow to the quantile sketches of a key, *qsp is allocated
+ * on the first flow.  Per second rates only exist for flows with a
+ * duration, octets per packet for flows with packets.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int qs_accum(struct ftstat_rpt *rpt, struct ftstat_qs **qsp,
+  struct fts3rec_all2 *cur, uint32_t duration, double pps, double bps)
+{
+  struct ftstat_qs *qs;
+  int fields, err;
 
-  if (fields & FT_STAT_FIELD_FLOWS) {
-    fprintf(fp, "%sflows", comma ? "," : "");
-    comma = 1;
-  }
+  if (!(qs = *qsp)) {
 
-  if (fields & FT_STAT_FIELD_OCTETS) {
-    fprintf(fp, "%soctets", comma ? "," : "");
-    comma = 1;
-  }
+    if (!(qs = qs_new(rpt)))
+      return -1;
 
-  if (fields & FT_STAT_FIELD_PACKETS) {
-    fprintf(fp, "%spackets", comma ? "," : "");
-    comma = 1;
-  }
+    *qsp = qs;
 
-  if (fields & FT_STAT_FIELD_DURATION) {
-    fprintf(fp, "%sduration", comma ? "," : "");
-    comma = 1;
   }
 
-  if (fields & FT_STAT_FIELD_AVG_BPS) {
-    fprintf(fp, "%savg-bps", comma ? "," : "");
-    comma = 1;
-  }
+  fields = rpt->all_fields;
+  err = 0;
 
-  if (fields & FT_STAT_FIELD_MIN_BPS) {
-    fprintf(fp, "%smin-bps", comma ? "," : "");
-    comma = 1;
-  }
+  if (fields & FT_STAT_FIELD_QDURATION)
+    err |= ftqs_add(&qs->q[FT_STAT_QS_DURATION], (double)duration);
 
-  if (fields & FT_STAT_FIELD_MAX_BPS) {
-    fprintf(fp, "%smax-bps", comma ? "," : "");
-    comma = 1;
-  }
+  if (duration && (fields & FT_STAT_FIELD_QPPS))
+    err |= ftqs_add(&qs->q[FT_STAT_QS_PPS], pps);
 
-  if (fields & FT_STAT_FIELD_AVG_PPS) {
-    fprintf(fp, "%savg-pps", comma ? "," : "");
-    comma = 1;
-  }
+  if (duration && (fields & FT_STAT_FIELD_QBPS))
+    err |= ftqs_add(&qs->q[FT_STAT_QS_BPS], bps);
 
-  if (fields & FT_STAT_FIELD_MIN_PPS) {
-    fprintf(fp, "%smin-pps", comma ? "," : "");
-    comma = 1;
-  }
+  if (cur->dPkts64 && (fields & FT_STAT_FIELD_QOPP))
+    err |= ftqs_add(&qs->q[FT_STAT_QS_OPP],
+      (double)cur->dOctets64 / (double)cur->dPkts64);
 
-  if (fields & FT_STAT_FIELD_MAX_PPS) {
-    fprintf(fp, "%smax-pps", comma ? "," : "");
-    comma = 1;
+  if (err) {
+    fterr_warnx("ftqs_add(): failed");
+    return -1;
   }
 
-  if (fields & FT_STAT_FIELD_FRECS) {
-    fprintf(fp, "%sfrecs", comma ? "," : "");
-    comma = 1;
+  return 0;
+
+} /* qs_accum */
+
+/*
+ * function: qs_merge
+ *
+ * fold the sketches src into *qsp, allocated in rpt if needed.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int qs_merge(struct ftstat_rpt *rpt, struct ftstat_qs **qsp,
+  struct ftstat_qs *src)
+{
+  struct ftstat_qs *qs;
+  int i;
+
+  if (!(qs = *qsp)) {
+
+    if (!(qs = qs_new(rpt)))
+      return -1;
+
+    *qsp = qs;
+
   }
 
-  fprintf(fp, "\n");
+  for (i = 0; i < FT_STAT_QS_N; ++i) {
+    if (ftqs_merge(&qs->q[i], &src->q[i])) {
+      fterr_warnx("ftqs_merge(): failed");
+      return -1;
+    }
+  }
 
   return 0;
 
-} /* recn_dump */
+} /* qs_merge */
 
-int bucket_alloc(struct flow_bucket *b, uint32_t n, struct ftstat_rpt *rpt)
+/*
+ * function: qs_dump
+ *
+ * format the quantiles selected by fields into buf, 0 for a key
+ * without sketches.
+ *
+ * returns characters added to buf
+ */
+static int qs_dump(char *buf, int fields, struct ftstat_qs *qs, int comma)
 {
-  register int i;
+  int i, j, len;
 
-  bzero(b, sizeof (*b));
+  len = 0;
 
-  if (!(b->recs = (uint64_t*)malloc(n*sizeof(uint64_t)))) {
-    fterr_warn("malloc(b->recs):");
-    return -1;
-  }
+  for (i = 0; i < FT_STAT_QS_N; ++i) {
 
-  if (!(b->flows = (uint64_t*)malloc(n*sizeof(uint64_t)))) {
-    fterr_warn("malloc(b->flows):");
-    return -1;
-  }
+    if (!(fields & qs_fields[i]))
+      continue;
 
-  if (!(b->octets = (uint64_t*)malloc(n*sizeof(uint64_t)))) {
-    fterr_warn("malloc(fopdi):");
-    bucket_free(b);
-    return -1;
-  }
+    for (j = 0; j < FT_STAT_QS_NPOINTS; ++j) {
+      if (comma) buf[len++] = ',';
+      len += sprintf(buf+len, "%f", qs ?
+        ftqs_quantile(&qs->q[i], (double)qs_points[j] / 100.0) : 0.0);
+      comma = 1;
+    }
 
-  if (!(b->packets = (uint64_t*)malloc(n*sizeof(uint64_t)))) {
-    fterr_warn("malloc(b->packets):");
-    bucket_free(b);
-    return -1;
   }
 
-  if (!(b->duration = (uint64_t*)malloc(n*sizeof(uint64_t)))) {
-    fterr_warn("malloc(b->duration):");
-    bucket_free(b);
-    return -1;
-  }
+  return len;
 
-  if (!(b->index = (uint32_t*)malloc(n*sizeof(uint32_t)))) {
-    fterr_warn("malloc(b->index):");
-    bucket_free(b);
-    return -1;
+} /* qs_dump */
+
+/*
+ * function: qs_free
+ *
+ * free the quantile sketches of every key of rpt
+ */
+static void qs_free(struct ftstat_rpt *rpt)
+{
+  struct ftstat_qs *qs;
+  int i;
+
+  while ((qs = rpt->qs)) {
+    rpt->qs = qs->next;
+    for (i = 0; i < FT_STAT_QS_N; ++i)
+      ftqs_free(&qs->q[i]);
+    free(qs);
   }
 
-  if (rpt->all_fields & FT_STAT_FIELD_PS) {
+  rpt->qs_spare = (struct ftstat_qs*)0L;
 
-    if (!(b->avg_pps = (double*)malloc(n*sizeof(double)))) {
-      fterr_warn("malloc(b->avg_pps):");
-      bucket_free(b);
-      return -1;
-    }
+} /* qs_free */
 
-    if (!(b->min_pps = (double*)malloc(n*sizeof(double)))) {
-      fterr_warn("malloc(b->min_pps):");
-      bucket_free(b);
-      return -1;
-    }
+/*
+ * function: chash_prefixh_combine
+ *
+ * ftchash_merge() callback for ftchash_rec_prefixh, merges the
+ * counters and the second level hash of prefixes or its estimate.
+ *
+ * returns 0: ok
+ *        !0: error
+ */
+static int chash_prefixh_combine(void *drec, void *srec, void *arg)
+{
+  struct ftchash_rec_prefixh *d, *s;
 
-    if (!(b->max_pps = (double*)malloc(n*sizeof(double)))) {
-      fterr_warn("malloc(b->max_pps):");
-      bucket_free(b);
-      return -1;
-    }
+  chash_std_combine(drec, srec, arg);
 
-    if (!(b->avg_bps = (double*)malloc(n*sizeof(double)))) {
-      fterr_warn("malloc(b->avg_bps):");
-      bucket_free(b);
-      return -1;
-    }
+  d = drec;
+  s = srec;
 
-    if (!(b->min_bps = (double*)malloc(n*sizeof(double)))) {
-      fterr_warn("malloc(b->min_bps):");
-      bucket_free(b);
+  if (s->hll) {
+    if (!d->hll && !(d->hll = fthll_new(s->hll->precision))) {
+      fterr_warnx("fthll_new(): failed");
       return -1;
     }
-
-    if (!(b->max_bps = (double*)malloc(n*sizeof(double)))) {
-      fterr_warn("malloc(b->max_bps):");
-      bucket_free(b);
+    if (fthll_merge(d->hll, s->hll)) {
+      fterr_warnx("fthll_merge(): failed");
       return -1;
     }
+  }
 
-    bzero(b->avg_pps, n*sizeof(double));
-    bzero(b->min_pps, n*sizeof(double));
-    bzero(b->max_pps, n*sizeof(double));
-    bzero(b->avg_bps, n*sizeof(double));
-    bzero(b->min_bps, n*sizeof(double));
-    bzero(b->max_bps, n*sizeof(double));
+  if (!s->ftch)
+    return 0;
 
+  /* new second hash */
+  if (!d->ftch) {
+    if (!(d->ftch = ftchash_new(256,
+      sizeof (struct ftchash_rec_prefixs), 5, 64))) {
+      fterr_warnx("ftchash_new(): failed");
+      return -1;
+    }
   }
 
-  bzero(b->recs, n*sizeof(uint64_t));
-  bzero(b->flows, n*sizeof(uint64_t));
-  bzero(b->octets, n*sizeof(uint64_t));
-  bzero(b->packets, n*sizeof(uint64_t));
-  bzero(b->duration, n*sizeof(uint64_t));
-
-  for (i = 0; i < n; ++i)
-    b->index[i] = i;
+  if (ftchash_merge(d->ftch, s->ftch, 0L, (void*)0L)) {
+    fterr_warnx("ftchash_merge(): failed");
+    return -1;
+  }
 
   return 0;
 
-} /* bucket_alloc */
+} /* chash_prefixh_combine */
 
-void bucket_free(struct flow_bucket *b)
+/*
+ * function: chash_int_combine
+ *
+ * ftchash_merge() callback for ftchash_rec_int
+ *
+ * returns 0
+ */
+static int chash_int_combine(void *drec, void *srec, void *arg)
 {
-  if (b->recs)
-    free(b->recs);
-  if (b->flows)
-    free(b->flows);
-  if (b->octets)
-    free(b->octets);
-  if (b->packets)
-    free(b->packets);
-  if (b->duration)
-    free(b->duration);
-  if (b->avg_pps)
-    free(b->avg_pps);
-  if (b->min_pps)
-    free(b->min_pps);
-  if (b->max_pps)
-    free(b->max_pps);
-  if (b->avg_bps)
-    free(b->avg_bps);
-  if (b->min_bps)
-    free(b->min_bps);
-  if (b->max_bps)
-    free(b->max_bps);
-  if (b->index)
-    free(b->index);
+  struct ftchash_rec_int *d, *s;
 
-  bzero(b, sizeof (*b));
+  d = drec;
+  s = srec;
 
-} /* bucket_free */
+  d->nrecs += s->nrecs;
+  d->nflows += s->nflows;
+  d->noctets += s->noctets;
+  d->npackets += s->npackets;
+
+  return 0;
+
+} /* chash_int_combine */
 
 static int sort_cmp64(const void *a, const void *b)
 {
@@ -154,6 +154,7 @@ char **argv;
   struct ftvar ftvar;
   struct ftxlate_def *ftxd;
   struct fts3rec_offsets fo;
+  struct ftrollup ftr;
   struct client_rec *client_rec, *client_rec2;
   pid_t child_pid;
   time_t tt_now, time_startup;
@@ -164,6 +165,10 @@ char **argv;
   uint32_t hash;
   char fmt_src_ip[32], fmt_dst_ip[32], fmt_dst_port[32];
   char xl_rec[FT_IO_MAXREC], *out_rec;
+  char ru_name[MAXPATHLEN+1], ru_nname[MAXPATHLEN+1], *c;
+  FILE *ru_fp;
+  off_t ru_nbytes;
+  uint64_t rollup_xfields;
   const char *tag_fname, *tag_active;
   const char *filter_fname, *filter_active;
   const char *xlate_fname, *xlate_active;
@@ -192,6 +197,7 @@ char **argv;
   bzero (&ftfil, sizeof ftfil);
   bzero (&ftxlate, sizeof ftxlate);
   bzero (&ftvar, sizeof ftvar);
+  bzero (&ftr, sizeof ftr);
 
   FT_LIST_INIT(&client.list);
   stat_interval = 0;
@@ -199,6 +205,7 @@ char **argv;
   v_flag = 0;
   reload_flag = 1;
   preserve_umask = 0;
+  rollup_xfields = 0;
 
   tag_fname = FT_PATH_CFG_TAG;
   tag_active = (char*)0L;
@@ -253,10 +260,17 @@ char **argv;
   pidfile = CAPTURE_PIDFILE;
 
   while ((i = getopt(argc, argv,
-    "b:c:C:d:De:E:f:F:hn:N:p:S:t:T:uv:V:w:x:X:z:R:")) != -1)
+    "a:b:c:C:d:De:E:f:F:hn:N:p:S:t:T:uv:V:w:x:X:z:R:")) != -1)
   
     switch (i) {
 
+    case 'a': /* rollup dimensions */
+      if (ftxfield_parse(optarg, &rollup_xfields) < 0)
+        fterr_errx(1, "ftxfield_parse(): failed");
+      if (rollup_xfields & ~FT_ROLLUP_XFIELDS)
+        fterr_errx(1, "-a: rollup dimensions are exaddr,input,output,prot,tos,src_as,dst_as");
+      break;
+
     case 'b': /* output byte order */
       if (!strcasecmp(optarg, "little"))
         ftset.byte_order = FT_HEADER_LITTLE_ENDIAN;
@@ -492,7 +506,8 @@ char **argv;
    * load directory entries into the file ager
    */
   if (fte.expiring)
-    if (ftfile_loaddir(&fte, ".", FT_FILE_SORT|FT_FILE_INIT|FT_FILE_CHECKNAMES))
+    if (ftfile_loaddir(&fte, ".", FT_FILE_SORT|FT_FILE_INIT|FT_FILE_CHECKNAMES|
+      FT_FILE_ROLLUPS))
       fterr_errx(1, "ftfile_scandir(): failed");
 
   /* debugging gets a dump of the ager */
@@ -1061,6 +1076,11 @@ skip_pdu_decode:
       ftio_set_reset(&ftio, cap_file.hdr_flows_reset);
       ftio_set_flows_count(&ftio, cap_file.hdr_nflows);
 
+      /* rollup rows for this file */
+      if (rollup_xfields)
+        if (ftrollup_new(&ftr, rollup_xfields, cap_file.time) < 0)
+          fterr_errx(1, "ftrollup_new(): failed");
+
 /*      ftio_map_load(&ftio, FT_MAP_FILE, ftnet.rem_ip); */
 
       /* header first */
@@ -1131,6 +1151,9 @@ skip_pdu_decode:
     
       } /* xlate_active */
 
+      if (rollup_xfields & ~ftrec_xfield(&ftv))
+        fterr_errx(1, "Rollup references a field not in flow.");
+
       reload_flag = 0;
 
     } /* reload_flag */
@@ -1171,6 +1194,10 @@ skip_pdu_decode:
       /* update # of flows stored in capture file */
       cap_file.hdr_nflows ++;
 
+      if (rollup_xfields)
+        if (ftrollup_accum(&ftr, out_rec, &fo) < 0)
+          fterr_errx(1, "ftrollup_accum(): failed");
+
       if ((n = ftio_write(&ftio, out_rec)) < 0)
         fterr_errx(1, "ftio_write(): failed");
 
@@ -1237,6 +1264,43 @@ skip_pdu_decode:
         if (rename(cap_file.name, cap_file.nname) == -1)
           fterr_err(1, "rename(%s,%s)", cap_file.name, cap_file.nname);
 
+        /*
+         * rollup goes next to the flow file, ft-v05.2026-... becomes
+         * ru-v05.2026-...  Written as tmp-ru-v05... first.
+         */
+        if (rollup_xfields) {
+
+          strcpy(ru_nname, cap_file.nname);
+          c = (c = strrchr(ru_nname, '/')) ? c+1 : ru_nname;
+          bcopy(FT_ROLLUP_PREFIX, c, strlen(FT_ROLLUP_PREFIX));
+
+          snprintf(ru_name, sizeof ru_name, "%.*stmp-%s", (int)(c - ru_nname),
+            ru_nname, c);
+
+          if (!(ru_fp = fopen(ru_name, "w")))
+            fterr_err(1, "fopen(%s)", ru_name);
+
+          if (ftrollup_write(&ftr, ru_fp, (uint32_t)tt_now) < 0)
+            fterr_errx(1, "ftrollup_write(%s): failed", ru_name);
+
+          if ((ru_nbytes = ftello(ru_fp)) == -1)
+            fterr_err(1, "ftello(%s)", ru_name);
+
+          if (fclose(ru_fp))
+            fterr_err(1, "fclose(%s)", ru_name);
+
+          if (rename(ru_name, ru_nname) == -1)
+            fterr_err(1, "rename(%s,%s)", ru_name, ru_nname);
+
+          ftrollup_free(&ftr);
+
+          /* the rollup ages with its flow file */
+          if (fte.expiring)
+            if (ftfile_add_tail(&fte, ru_nname, ru_nbytes, cap_file.time))
+              fterr_errx(1, "ftfile_add_tail(%s): failed", ru_nname);
+
+        } /* rollup_xfields */
+
         /* add it to the ager */
         if (fte.expiring)
           if (ftfile_add_tail(&fte, cap_file.nname, cap_file.nbytes,
@@ -1437,7 +1501,7 @@ void fterr_exit_handler(int code)
 
 void usage(void) {
 
-  fprintf(stderr, "Usage: flow-capture [-hu] [-b big|little]\n");
+  fprintf(stderr, "Usage: flow-capture [-hu] [-a rollup_fields] [-b big|little]\n");
   fprintf(stderr, "       [-C comment] [-c flow_clients] [-d debug_level] [-D daemonize]\n");
   fprintf(stderr, "       [-e expire_count] [-E expire_size[bKMG]] [-n rotations]\n");
   fprintf(stderr, "       [-N nesting_level] [-p pidfile ] [-R rotate_program]\n");
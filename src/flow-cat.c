@@ -64,8 +64,10 @@ int main(int argc, char **argv)
   struct ftset ftset;
   struct ftfile_entries **fte;
   struct ftfile_entry *fty;
+  struct ftcol ftc;
+  FILE *out_fp;
   int i, out_fd, out_fd_plain, in_fd, disable_mmap, in_fd_plain, sort;
-  int fields;
+  int fields, col;
   int x, n, fd, flags, fte_entries, preload, time_filter;
   char *fname, *out_fname;
   char *rec;
@@ -104,8 +106,10 @@ int main(int argc, char **argv)
   time_filter = 0;
   time_high = time_low = 0;
   fields = 0;
+  col = 0;
+  out_fp = (FILE*)0L;
 
-  while ((i = getopt(argc, argv, "ab:C:d:gh?mo:pt:T:z:")) != -1)
+  while ((i = getopt(argc, argv, "ab:cC:d:gh?mo:pt:T:z:")) != -1)
 
     switch (i) {
 
@@ -122,6 +126,10 @@ int main(int argc, char **argv)
         fterr_errx(1, "expecting \"big\" or \"little\"");
       break;
 
+    case 'c': /* column file output */
+      col = 1;
+      break;
+
     case 'C': /* comment field */
       ftset.comments = optarg;
       break;
@@ -206,14 +214,15 @@ int main(int argc, char **argv)
   } else 
     out_fd = 1;
 
-  /* output to out_fd */    
+  /* output to out_fd, column files compress each column themselves */
   if (ftio_init(&ftio_out, out_fd, FT_IO_FLAG_WRITE |
-    ((ftset.z_level) ? FT_IO_FLAG_ZINIT : 0) ) < 0)
+    ((ftset.z_level && !col) ? FT_IO_FLAG_ZINIT : 0) ) < 0)
     fterr_errx(1, "ftio_init(): failed");
 
   ftio_set_comment(&ftio_out, ftset.comments);
   ftio_set_byte_order(&ftio_out, ftset.byte_order);
-  ftio_set_z_level(&ftio_out, ftset.z_level);
+  if (!col)
+    ftio_set_z_level(&ftio_out, ftset.z_level);
   ftio_set_streaming(&ftio_out, 1);
   ftio_set_debug(&ftio_out, debug);
 
@@ -528,15 +537,28 @@ skip_file:
         /* save for later compare */
         bcopy(&ftv2, &ftv, sizeof ftv);
 
-        /* header first */
-        if ((n = ftio_write_header(&ftio_out)) < 0)
-          fterr_errx(1, "ftio_write_header(): failed");
+        if (col) {
+
+          /* ftio_out still owns out_fd */
+          if (!(out_fp = fdopen(dup(out_fd), "w")))
+            fterr_err(1, "fdopen()");
+
+          if (ftcol_open_write(&ftc, out_fp, &ftv, ftset.z_level) < 0)
+            fterr_errx(1, "ftcol_open_write(): failed");
+
+        } else {
 
-        total_bytes += n;
+          /* header first */
+          if ((n = ftio_write_header(&ftio_out)) < 0)
+            fterr_errx(1, "ftio_write_header(): failed");
 
-        if (debug > 6)
-          if (n)
-            fterr_info("ftio_write_header()=%d", n);
+          total_bytes += n;
+
+          if (debug > 6)
+            if (n)
+              fterr_info("ftio_write_header()=%d", n);
+
+        }
 
       } else {
 
@@ -552,14 +574,23 @@ skip_file:
 
         ++total_flows;
 
-        if ((n = ftio_write(&ftio_out, rec)) < 0)
-          fterr_errx(1, "ftio_write(): failed");
+        if (col) {
 
-        total_bytes += n;
+          if (ftcol_write(&ftc, rec) < 0)
+            fterr_errx(1, "ftcol_write(): failed");
+
+        } else {
 
-        if (debug > 6)
-          if (n)
-            fterr_info("ftio_write()=%d", n);
+          if ((n = ftio_write(&ftio_out, rec)) < 0)
+            fterr_errx(1, "ftio_write(): failed");
+
+          total_bytes += n;
+
+          if (debug > 6)
+            if (n)
+              fterr_info("ftio_write()=%d", n);
+
+        }
 
         if ((debug > 5) && ((total_flows & 0x3ffff) == 0))
            fterr_info("processed/total flows: %lu / %lu", total_flows, ftio_get_flows_count(&ftio_out));
@@ -587,7 +618,7 @@ skip_file:
    * if the output file descriptor was a real file, re-write the
    * flow_header with the correct # of total flows
    */
-  if (out_fd_plain) {
+  if (out_fd_plain && !col) {
 
     ftio_set_cap_time(&ftio_out, time_start, time_end);
     ftio_set_flows_count(&ftio_out, total_flows);
@@ -604,6 +635,17 @@ skip_file:
 
   } /* out_fd_plain */
 
+  /* last block of the column file */
+  if (out_fp) {
+
+    if (ftcol_close(&ftc) < 0)
+      fterr_errx(1, "ftcol_close(): failed");
+
+    if (fclose(out_fp))
+      fterr_err(1, "fclose()");
+
+  }
+
   /* done with output stream */
   if ((n = ftio_close(&ftio_out)) < 0)
     fterr_errx(1, "ftio_close(): failed");
@@ -646,7 +688,7 @@ void sig_quit(int sig)
 
 void usage(void) {
 
-  fprintf(stderr, "Usage: flow-cat [-aghmp] [-b byte_order] [-C comment] [-d debug_level]\n");
+  fprintf(stderr, "Usage: flow-cat [-acghmp] [-b byte_order] [-C comment] [-d debug_level]\n");
   fprintf(stderr, "       [-o filename] [-t start_time] [-T end_time] [-z z_level]\n");
   fprintf(stderr, "       file|directory ...");
   fprintf(stderr, "\n");
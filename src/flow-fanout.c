@@ -47,6 +47,7 @@
 #include <stdlib.h>
 #include <fcntl.h>
 #include <time.h>
+#include <pthread.h>
 
 #if HAVE_STRINGS_H
  #include <strings.h>
@@ -61,30 +62,72 @@
 
 #define SELECT_TIMEOUT 5   /* 5 seconds */
 
+#define FANOUT_QUEUE_LEN 1024 /* default PDUs queued per peer */
+
+/* -H partition keys */
+#define FANOUT_PART_NONE     0  /* replicate to every peer */
+#define FANOUT_PART_EXPORTER 1  /* exporter IP address */
+#define FANOUT_PART_SRCADDR  2  /* srcaddr */
+#define FANOUT_PART_DSTADDR  3  /* dstaddr */
+#define FANOUT_PART_5TUPLE   4  /* srcaddr dstaddr srcport dstport prot */
+
 
 int debug;
 char *pidfile;
 
 void usage(void);
 
+/* encoded PDU waiting in a peer queue */
+struct fanout_pdu {
+  int64_t t_enq;               /* ftpace_now() when queued */
+  uint32_t src_ip;             /* exporter, network byte order */
+  int buf_size;                /* bytes in PDU, excluding IP header */
+  int d_sum;                   /* data checksum of the PDU */
+  char buf[FT_IO_MAXENCODE];   /* [IP/UDP header] + PDU */
+};
+
 struct peer {
   int fd;
   struct sockaddr_in loc_addr; /* us */
   struct sockaddr_in rem_addr; /* them */
   int port;
   int ttl;
+  int index;                   /* position on command line */
+  int src_ip_spoof;            /* raw socket, build IP/UDP header */
+  int hdr_len;                 /* FT_ENC_IPHDR_LEN when spoofing */
+  int tx_delay;                /* microseconds after each send */
+  struct ftpace pace;          /* PDUs/second limit */
+  pthread_t thread;            /* sender */
+  pthread_mutex_t lock;        /* protects everything below */
+  pthread_cond_t q_cond;       /* signaled on enqueue and shutdown */
+  struct fanout_pdu *q;        /* ring of q_size PDUs */
+  int q_size, q_head, q_used;
+  int done;                    /* drain queue and exit */
+  uint64_t queued;             /* PDUs accepted into the queue */
+  uint64_t sent;               /* PDUs sent */
+  uint64_t dropped;            /* PDUs dropped, queue full */
+  uint64_t send_nobufs;        /* send() returned ENOBUFS */
+  uint64_t send_errors;        /* send() failed */
+  int64_t lat_sum, lat_max;    /* queue to wire latency (ns), interval */
+  uint64_t lat_n;              /* samples in lat_sum */
+  uint64_t seed;               /* rendezvous hash seed, from rem_addr */
 };
 
 void fterr_exit_handler(int code);
 
-int sig_quit_flag, sig_hup_flag, sig_term_flag, reload_flag;
-void sig_quit(int), sig_hup(int), sig_term(int);
+int sig_quit_flag, sig_hup_flag, sig_term_flag, sig_usr1_flag, reload_flag;
+void sig_quit(int), sig_hup(int), sig_term(int), sig_usr1(int);
 pid_t pid;
 uint16_t listen_port;
 
-void pdu_xmit(int npeers, int tx_delay, int src_ip_spoof, int hdr_len,
-  uint32_t *send_nobufs, struct ip *ip_hdr, struct udphdr *udp_hdr,
-  struct ftencode *fte, struct peer *peers, struct ftnet *ftnet);
+void pdu_xmit(int npeers, struct ftencode *fte, struct peer *peers,
+  struct ftnet *ftnet);
+void peer_enqueue(struct peer *peer, struct ftencode *fte, uint32_t src_ip);
+void *peer_thread(void *arg);
+void peer_stat_dump(struct peer *peers, int npeers, time_t now,
+  time_t time_startup);
+static inline uint64_t mix64(uint64_t x);
+static inline int peer_select(struct peer *peers, int npeers, uint64_t key);
 
 int main(int argc, char **argv)
 {
@@ -99,15 +142,13 @@ int main(int argc, char **argv)
   struct tm *tm;
   time_t now, time_startup;
   fd_set rfd;
-  struct ip *ip_hdr;
-  struct udphdr *udp_hdr;
   struct ftpeeri ftpi;
   struct ftpdu ftpdu;
   struct ftver ftv;
   struct ftnet ftnet;
   struct ftchash *ftch;
   struct ftchash_rec_exp ftch_recexp, *ftch_recexpp;
-  struct ftencode fte;
+  struct ftencode *ftes, *fte;
   struct ftfil ftfil;
   struct ftfil_def *ftfd;
   struct fts3rec_offsets fo;
@@ -116,13 +157,17 @@ int main(int argc, char **argv)
   struct peer *peers;
   struct ftipmask ftipmask;
   uint32_t flows_corrupt, flows_lost, flows_reset, hash, privacy_mask;
-  uint32_t send_nobufs;
   unsigned int v1, v2;
+  sigset_t sigs_all, sigs_old;
+  double pdu_rate, peer_rate;
+  char *rate_str;
+  int queue_len;
   char fmt_src_ip[32], fmt_dst_ip[32], fmt_dst_port[32];
   char xl_rec[FT_IO_MAXREC], *out_rec;
   const char *filter_fname, *filter_active;
-  int i, n, detach, one, ret, offset, hdr_len;
-  int npeers, tx_delay;
+  int i, j, n, detach, one, ret, offset, hdr_len;
+  int npeers, tx_delay, nftes, part_key, part_each;
+  uint64_t key;
   int stat_interval, stat_next, src_ip_spoof;
 #ifdef IP_RECVDSTADDR
 #ifdef CMSG_DATA
@@ -147,7 +192,9 @@ int main(int argc, char **argv)
   stat_next = -1;
   src_ip_spoof = 0; /* no */
   hdr_len = 0;
-  send_nobufs = 0;
+  pdu_rate = 0;
+  queue_len = FANOUT_QUEUE_LEN;
+  part_key = FANOUT_PART_NONE;
   reload_flag = 1; /* yes */
 
   /* init var binding */
@@ -173,7 +220,7 @@ int main(int argc, char **argv)
   tx_delay = 0;
   detach = 1;
 
-  while ((i = getopt(argc, argv, "A:d:Df:F:hm:p:sS:v:V:x:")) != -1)
+  while ((i = getopt(argc, argv, "A:d:Df:F:hH:m:p:q:r:sS:v:V:x:")) != -1)
     switch (i) {
 
     case 'A': /* AS substitution */
@@ -201,6 +248,19 @@ int main(int argc, char **argv)
       exit (0);
       break;
 
+    case 'H': /* partition by hash of key */
+      if (!strcasecmp(optarg, "exporter"))
+        part_key = FANOUT_PART_EXPORTER;
+      else if (!strcasecmp(optarg, "srcaddr"))
+        part_key = FANOUT_PART_SRCADDR;
+      else if (!strcasecmp(optarg, "dstaddr"))
+        part_key = FANOUT_PART_DSTADDR;
+      else if (!strcasecmp(optarg, "5-tuple"))
+        part_key = FANOUT_PART_5TUPLE;
+      else
+        fterr_errx(1, "Unknown partition key: %s", optarg);
+      break;
+
     case 'm': /* privacy mask */
       privacy_mask = scan_ip(optarg);
       break;
@@ -212,6 +272,18 @@ int main(int argc, char **argv)
         pidfile = optarg;
       break;
 
+    case 'q': /* per peer queue length */
+      queue_len = atoi(optarg);
+      if (queue_len < 1)
+        fterr_errx(1, "Queue length must be > 0.");
+      break;
+
+    case 'r': /* default per peer PDUs/second */
+      pdu_rate = strtod(optarg, (char**)0L);
+      if (pdu_rate <= 0)
+        fterr_errx(1, "PDU rate must be > 0.");
+      break;
+
     case 's': /* source ip preserve */
       src_ip_spoof = 1;
       break;
@@ -255,32 +327,36 @@ int main(int argc, char **argv)
 
     } /* switch */
 
-  /* initialize encode struct */
-  ftencode_init(&fte, (src_ip_spoof) ? FT_ENC_FLAGS_IPHDR : 0);
-
-  /* if src ip spoofing, initialize the IP/UDP header */
-  if (src_ip_spoof) {
-
-    ip_hdr = (struct ip*)&fte.buf;
-    udp_hdr = (struct udphdr*)((char*)&fte.buf + sizeof (*ip_hdr));
-
-    ip_hdr->ip_hl = 5;
-    ip_hdr->ip_v = 4;
-    ip_hdr->ip_p = 17; /* UDP */
+  /* if src ip spoofing, the sender threads fill in the IP/UDP header */
+  if (src_ip_spoof)
     hdr_len = FT_ENC_IPHDR_LEN;
 
-  }
-
-  /* initialize encoder version */
-  if (ftv.set)
-    bcopy(&ftv, &fte.ver, sizeof ftv);
-
   /* allocate argc - optind peer entries */
   npeers = argc - optind - 1;
 
   if (npeers < 1)
     fterr_errx(1, "Must define at least source and one destination.");
 
+  /*
+   * one encoder shared by all peers when replicating, else one per
+   * peer so each partition has its own PDUs and sequence numbers
+   */
+  nftes = (part_key == FANOUT_PART_NONE) ? 1 : npeers;
+
+  if (!(ftes = (struct ftencode*)malloc(nftes * sizeof (struct ftencode))))
+    fterr_err(1, "malloc()");
+
+  for (n = 0; n < nftes; ++n) {
+
+    /* initialize encode struct */
+    ftencode_init(&ftes[n], (src_ip_spoof) ? FT_ENC_FLAGS_IPHDR : 0);
+
+    /* initialize encoder version */
+    if (ftv.set)
+      bcopy(&ftv, &ftes[n].ver, sizeof ftv);
+
+  }
+
   /* pre-scan so write_pidfile has the port */
   ftpi = scan_peeri(argv[optind]);
 
@@ -295,6 +371,9 @@ int main(int argc, char **argv)
   if (mysignal(SIGHUP, sig_hup) == SIG_ERR)
     fterr_err(1, "signal(SIGHUP)");
 
+  if (mysignal(SIGUSR1, sig_usr1) == SIG_ERR)
+    fterr_err(1, "signal(SIGUSR1)");
+
   /* daemonize */
   if (detach) {  
     if ((pid = fork()) == -1) {
@@ -328,9 +407,39 @@ int main(int argc, char **argv)
   /* pick off destinations, fill in peer entries */
   for (i = optind+1, n = 0; i < argc; ++i, ++n) {
 
+    /* optional ,pdu_rate suffix overrides -r for this peer */
+    peer_rate = pdu_rate;
+    if ((rate_str = strchr(argv[i], ','))) {
+      *rate_str++ = 0;
+      peer_rate = strtod(rate_str, (char**)0L);
+      if (peer_rate <= 0)
+        fterr_errx(1, "PDU rate must be > 0: %s", argv[i]);
+    }
+
     /* parse loc_ip/rem_ip/port/ttl */
     ftpi = scan_peeri(argv[i]);
 
+    peers[n].index = n;
+    peers[n].src_ip_spoof = src_ip_spoof;
+    peers[n].hdr_len = hdr_len;
+    peers[n].tx_delay = tx_delay;
+
+    /* bucket depth of 1ms, at least one PDU */
+    if (ftpace_init(&peers[n].pace, peer_rate, (uint32_t)(peer_rate / 1000)))
+      fterr_errx(1, "ftpace_init(): failed");
+
+    if (!(peers[n].q = (struct fanout_pdu*)malloc(queue_len *
+      sizeof (struct fanout_pdu))))
+      fterr_err(1, "malloc()");
+
+    peers[n].q_size = queue_len;
+
+    if (pthread_mutex_init(&peers[n].lock, (pthread_mutexattr_t*)0L))
+      fterr_errx(1, "pthread_mutex_init(): failed");
+
+    if (pthread_cond_init(&peers[n].q_cond, (pthread_condattr_t*)0L))
+      fterr_errx(1, "pthread_cond_init(): failed");
+
     /* default UDP destination port is FT_PORT */
     peers[n].rem_addr.sin_port = (ftpi.dst_port) ? htons(ftpi.dst_port)
       : htons(FT_PORT);
@@ -339,6 +448,10 @@ int main(int argc, char **argv)
     peers[n].rem_addr.sin_family = AF_INET;
     peers[n].ttl = ftpi.ttl;
 
+    /* partition placement depends on the destination, not argv order */
+    peers[n].seed = mix64(((uint64_t)ftpi.rem_ip << 16) |
+      ntohs(peers[n].rem_addr.sin_port));
+
     /* default ttl to 255 if this is unicast */
     if (!(IN_CLASSD(ftpi.rem_ip)) && (!ftpi.ttl))
       peers[n].ttl = 255;
@@ -418,6 +531,18 @@ int main(int argc, char **argv)
 
   } /* for each destination */
 
+  /* senders leave signal handling to the receive thread */
+  sigfillset(&sigs_all);
+  pthread_sigmask(SIG_BLOCK, &sigs_all, &sigs_old);
+
+  for (n = 0; n < npeers; ++n) {
+    if (pthread_create(&peers[n].thread, (pthread_attr_t*)0L, peer_thread,
+      &peers[n]))
+      fterr_errx(1, "pthread_create(): failed");
+  }
+
+  pthread_sigmask(SIG_SETMASK, &sigs_old, (sigset_t*)0L);
+
   /* first arg is the listener, scan it and store away in ftnet */
   ftpi = scan_peeri(argv[optind]);
   
@@ -597,16 +722,17 @@ mcast_done:
           fmt_ipv4(fmt_dst_ip, ftch_recexpp->dst_ip, FMT_JUST_LEFT);
 
           fterr_info(
-            "STAT: now=%lu startup=%lu src_ip=%s dst_ip=%s d_ver=%d pkts=%lu flows=%lu lost=%lu reset=%lu filter_drops=%lu send_nobufs=%lu",
+            "STAT: now=%lu startup=%lu src_ip=%s dst_ip=%s d_ver=%d pkts=%lu flows=%lu lost=%lu reset=%lu filter_drops=%lu",
             (unsigned long)now, (unsigned long)time_startup,
             fmt_src_ip, fmt_dst_ip,
             ftch_recexpp->d_version, (u_long)ftch_recexpp->packets,
             (u_long)ftch_recexpp->flows, (u_long)ftch_recexpp->lost,
-            (u_long)ftch_recexpp->reset, (u_long)ftch_recexpp->filtered_flows,
-            (u_long)send_nobufs);
+            (u_long)ftch_recexpp->reset, (u_long)ftch_recexpp->filtered_flows);
 
         }
 
+        peer_stat_dump(peers, npeers, now, time_startup);
+
         stat_next = (tm->tm_min + (stat_interval - tm->tm_min % stat_interval))
           % 60;
 
@@ -695,7 +821,8 @@ restart_recvmsg:
         ftv.set = 1;
 
         /* configure encoder version */
-        bcopy(&ftv, &fte.ver, sizeof ftv);
+        for (n = 0; n < nftes; ++n)
+          bcopy(&ftv, &ftes[n].ver, sizeof ftv);
 
         /* need offsets for filter later */
         fts3rec_compute_offsets(&fo, &ftv);
@@ -748,6 +875,18 @@ restart_recvmsg:
         
         } /* filter_active */
 
+        /* partition key must be in the output records */
+        if (((part_key == FANOUT_PART_SRCADDR) &&
+             (!(ftrec_xfield(&ftv) & FT_XFIELD_SRCADDR))) ||
+            ((part_key == FANOUT_PART_DSTADDR) &&
+             (!(ftrec_xfield(&ftv) & FT_XFIELD_DSTADDR))) ||
+            ((part_key == FANOUT_PART_5TUPLE) &&
+             ((ftrec_xfield(&ftv) & (FT_XFIELD_SRCADDR|FT_XFIELD_DSTADDR|
+              FT_XFIELD_SRCPORT|FT_XFIELD_DSTPORT|FT_XFIELD_PROT)) !=
+              (FT_XFIELD_SRCADDR|FT_XFIELD_DSTADDR|FT_XFIELD_SRCPORT|
+              FT_XFIELD_DSTPORT|FT_XFIELD_PROT))))
+          fterr_errx(1, "Partition key references a field not in flow.");
+
         reload_flag = 0;
 
       }
@@ -809,6 +948,14 @@ restart_recvmsg:
       ftch_recexpp->packets ++;
         ftch_recexpp->flows += n;
 
+      /* every flow in the PDU came from the same exporter */
+      part_each = 0;
+      j = 0;
+      if (part_key == FANOUT_PART_EXPORTER)
+        j = peer_select(peers, npeers, mix64(ftch_recexp.src_ip));
+      else if (part_key != FANOUT_PART_NONE)
+        part_each = 1;
+
       /* write decoded flows */
       for (i = 0, offset = 0; i < n; ++i, offset += ftpdu.ftd.rec_size) {
 
@@ -836,9 +983,35 @@ restart_recvmsg:
             continue;
           }
 
+        /* pick the partition */
+        if (part_each) {
+
+          if (part_key == FANOUT_PART_SRCADDR) {
+
+            key = mix64(*((uint32_t*)(out_rec+fo.srcaddr)));
+
+          } else if (part_key == FANOUT_PART_DSTADDR) {
+
+            key = mix64(*((uint32_t*)(out_rec+fo.dstaddr)));
+
+          } else {
+
+            key = mix64(((uint64_t)*((uint32_t*)(out_rec+fo.srcaddr)) << 32) |
+              *((uint32_t*)(out_rec+fo.dstaddr)));
+            key = mix64(key ^ (((uint64_t)*((uint16_t*)(out_rec+fo.srcport))
+              << 24) | ((uint64_t)*((uint16_t*)(out_rec+fo.dstport)) << 8) |
+              *((uint8_t*)(out_rec+fo.prot))));
+
+          }
+
+          j = peer_select(peers, npeers, key);
+
+        } /* part_each */
+
+        fte = &ftes[(part_key == FANOUT_PART_NONE) ? 0 : j];
 
 retry:
-        ret = fts3rec_pdu_encode(&fte, out_rec);
+        ret = fts3rec_pdu_encode(fte, out_rec);
       
         /*   ret == 0 then send and clear out buffer
          *   ret > 0 then can encode another
@@ -848,8 +1021,10 @@ retry:
         /* need to transmit? */
         if (ret < 0) {
 
-          pdu_xmit(npeers, tx_delay, src_ip_spoof, hdr_len, &send_nobufs,
-            ip_hdr, udp_hdr, &fte, peers, &ftnet);
+          if (part_key == FANOUT_PART_NONE)
+            pdu_xmit(npeers, fte, peers, &ftnet);
+          else
+            pdu_xmit(1, fte, &peers[j], &ftnet);
 
         } /* ret < 0 */
 
@@ -860,11 +1035,17 @@ retry:
       } /* for each flow */
     
       /* any encoded flows that have not been transmitted */
-      if (fte.buf_size) {
+      if (part_key == FANOUT_PART_NONE) {
+
+        if (ftes[0].buf_size)
+          pdu_xmit(npeers, &ftes[0], peers, &ftnet);
+
+      } else {
+
+        for (j = 0; j < npeers; ++j)
+          if (ftes[j].buf_size)
+            pdu_xmit(1, &ftes[j], &peers[j], &ftnet);
 
-        pdu_xmit(npeers, tx_delay, src_ip_spoof, hdr_len, &send_nobufs,
-          ip_hdr, udp_hdr, &fte, peers, &ftnet);
-    
       } /* fte.buf_size */
     
 
@@ -887,13 +1068,29 @@ skip1:
       sig_hup_flag = 0;
     }
 
+    if (sig_usr1_flag) {
+      sig_usr1_flag = 0;
+      peer_stat_dump(peers, npeers, now, time_startup);
+    }
+
   } /* while 1 */
 
+  /* let the senders drain their queues */
+  for (n = 0; n < npeers; ++n) {
+    pthread_mutex_lock(&peers[n].lock);
+    peers[n].done = 1;
+    pthread_cond_signal(&peers[n].q_cond);
+    pthread_mutex_unlock(&peers[n].lock);
+  }
+
+  for (n = 0; n < npeers; ++n)
+    pthread_join(peers[n].thread, (void**)0L);
+
   if (pidfile)
     unlink_pidfile(pid, pidfile, listen_port);
 
   for (n = 0; n < npeers; ++n)
-    close(peers[0].fd);
+    close(peers[n].fd);
 
   return 0;
 
@@ -909,6 +1106,11 @@ void sig_term(int sig)
   sig_term_flag = 1;
 }
 
+void sig_usr1(int sig)
+{
+  sig_usr1_flag = 1;
+}
+
 void sig_hup(int sig)
 {
   sig_hup_flag = 1;
@@ -922,12 +1124,17 @@ void fterr_exit_handler(int code)
       unlink_pidfile(pid, pidfile, listen_port);
   exit (code);
 } /* fterr_exit_handler */
- 
-void pdu_xmit(int npeers, int tx_delay, int src_ip_spoof, int hdr_len,
-  uint32_t *send_nobufs, struct ip *ip_hdr, struct udphdr *udp_hdr,
-  struct ftencode *fte, struct peer *peers, struct ftnet *ftnet)
+
+/*
+ * function: pdu_xmit
+ *
+ * Hand the encoded PDU to each peer's sender thread and reset the
+ * encoder.  Never blocks, a peer with a full queue drops the PDU.
+ */
+void pdu_xmit(int npeers, struct ftencode *fte, struct peer *peers,
+  struct ftnet *ftnet)
 {
-  int j, sum;
+  int j;
 
   /* convert pdu to network byte order */
 #if BYTE_ORDER == LITTLE_ENDIAN
@@ -937,70 +1144,271 @@ void pdu_xmit(int npeers, int tx_delay, int src_ip_spoof, int hdr_len,
   /* do this once for all destinations */
   ftencode_sum_data(fte);
 
-  for (j = 0; j < npeers; ++j) {
+  for (j = 0; j < npeers; ++j)
+    peer_enqueue(&peers[j], fte, ftnet->rem_addr.sin_addr.s_addr);
 
-    if (src_ip_spoof) {
+  /* reset encode buffer */
+  ftencode_reset(fte);
+
+} /* pdu_xmit */
+
+/*
+ * function: peer_enqueue
+ *
+ * Copy the network byte order PDU in fte onto the peer's queue.
+ */
+void peer_enqueue(struct peer *peer, struct ftencode *fte, uint32_t src_ip)
+{
+  struct fanout_pdu *fp;
+
+  pthread_mutex_lock(&peer->lock);
+
+  if (peer->q_used == peer->q_size) {
+    ++peer->dropped;
+    pthread_mutex_unlock(&peer->lock);
+    return;
+  }
+
+  fp = &peer->q[(peer->q_head + peer->q_used) % peer->q_size];
+
+  fp->t_enq = ftpace_now();
+  fp->src_ip = src_ip;
+  fp->buf_size = fte->buf_size;
+  fp->d_sum = fte->d_sum;
+  bcopy(fte->buf, fp->buf, fte->buf_size + peer->hdr_len);
+
+  ++peer->q_used;
+  ++peer->queued;
+
+  pthread_cond_signal(&peer->q_cond);
+  pthread_mutex_unlock(&peer->lock);
+
+} /* peer_enqueue */
+
+/*
+ * function: peer_thread
+ *
+ * Sender, one per peer.  Drains the queue at the peer's rate until
+ * told to exit.
+ */
+void *peer_thread(void *arg)
+{
+  struct peer *peer;
+  struct fanout_pdu *fp;
+  struct ip *ip_hdr;
+  struct udphdr *udp_hdr;
+  int64_t lat;
+  int sum, nobufs, err;
+
+  peer = (struct peer*)arg;
+
+  while (1) {
+
+    pthread_mutex_lock(&peer->lock);
+
+    while ((!peer->q_used) && (!peer->done))
+      pthread_cond_wait(&peer->q_cond, &peer->lock);
+
+    if (!peer->q_used) {
+      pthread_mutex_unlock(&peer->lock);
+      break;
+    }
+
+    /* the head slot is not reused until q_used drops */
+    fp = &peer->q[peer->q_head];
+
+    pthread_mutex_unlock(&peer->lock);
+
+    ftpace_wait(&peer->pace, 1);
+
+    if (peer->src_ip_spoof) {
+
+      ip_hdr = (struct ip*)fp->buf;
+      udp_hdr = (struct udphdr*)(fp->buf + sizeof (*ip_hdr));
+
+      ip_hdr->ip_hl = 5;
+      ip_hdr->ip_v = 4;
+      ip_hdr->ip_p = 17; /* UDP */
 
 /* see Stevens Unix Network Programming Volume 1 2nd edition page 657 */
 /* conditional from <simon@limmat.switch.ch> rawsend.c */
 #if defined (__linux__) || (defined (__OpenBSD__) && (OpenBSD > 199702))
-      ip_hdr->ip_len = htons(FT_ENC_IPHDR_LEN+fte->buf_size);
+      ip_hdr->ip_len = htons(FT_ENC_IPHDR_LEN+fp->buf_size);
 #else
-      ip_hdr->ip_len = FT_ENC_IPHDR_LEN+fte->buf_size;
+      ip_hdr->ip_len = FT_ENC_IPHDR_LEN+fp->buf_size;
 #endif
-      ip_hdr->ip_ttl = peers[j].ttl;
+      ip_hdr->ip_ttl = peer->ttl;
       /* use transmit source if loc_addr is not specified */
-      if (!peers[j].loc_addr.sin_addr.s_addr)
-        ip_hdr->ip_src.s_addr = ftnet->rem_addr.sin_addr.s_addr;
+      if (!peer->loc_addr.sin_addr.s_addr)
+        ip_hdr->ip_src.s_addr = fp->src_ip;
       else
-        ip_hdr->ip_src.s_addr = peers[j].loc_addr.sin_addr.s_addr;
-      ip_hdr->ip_dst.s_addr = peers[j].rem_addr.sin_addr.s_addr;
+        ip_hdr->ip_src.s_addr = peer->loc_addr.sin_addr.s_addr;
+      ip_hdr->ip_dst.s_addr = peer->rem_addr.sin_addr.s_addr;
 
-      udp_hdr->uh_sport = htons(7999+j);
-      udp_hdr->uh_dport = peers[j].rem_addr.sin_port;
-      udp_hdr->uh_ulen = htons(fte->buf_size+8);
+      udp_hdr->uh_sport = htons(7999+peer->index);
+      udp_hdr->uh_dport = peer->rem_addr.sin_port;
+      udp_hdr->uh_ulen = htons(fp->buf_size+8);
       udp_hdr->uh_sum = 0;
 
-      sum = fte->d_sum;
-      sum += udp_cksum(ip_hdr, udp_hdr, fte->buf_size+8);
+      sum = fp->d_sum;
+      sum += udp_cksum(ip_hdr, udp_hdr, fp->buf_size+8);
 
       sum = (sum >> 16) + (sum & 0xffff);
       sum += (sum >> 16);
       udp_hdr->uh_sum = ~sum;
 
     }
- 
+
+    nobufs = err = 0;
+
 again:
- 
-    if (send(peers[j].fd, (char*)&fte->buf, fte->buf_size+hdr_len, 0) < 0) {
+
+    if (send(peer->fd, fp->buf, fp->buf_size+peer->hdr_len, 0) < 0) {
 
       /* always complete a send, drop flows in the kernel on receive if
          overloaded */
       if (errno == ENOBUFS) {
-        ++ *send_nobufs;
+        ++nobufs;
         usleep(1);
         goto again;
       }
 
-      if (errno != ECONNREFUSED)
-        fterr_warn("send(j=%d)", j);
+      if (errno != ECONNREFUSED) {
+        fterr_warn("send(j=%d)", peer->index);
+        err = 1;
+      }
 
     }
 
-    if (tx_delay)
-      usleep((unsigned)tx_delay);
+    lat = ftpace_now() - fp->t_enq;
 
-  } /* foreach peer to send to */
+    pthread_mutex_lock(&peer->lock);
 
-  /* reset encode buffer */
-  ftencode_reset(fte);
+    peer->q_head = (peer->q_head + 1) % peer->q_size;
+    --peer->q_used;
 
-} /* pdu_xmit */
+    ++peer->sent;
+    peer->send_nobufs += nobufs;
+    peer->send_errors += err;
+    peer->lat_sum += lat;
+    ++peer->lat_n;
+    if (lat > peer->lat_max)
+      peer->lat_max = lat;
+
+    pthread_mutex_unlock(&peer->lock);
+
+    if (peer->tx_delay)
+      usleep((unsigned)peer->tx_delay);
+
+  } /* while 1 */
+
+  return (void*)0L;
+
+} /* peer_thread */
+
+/*
+ * function: mix64
+ *
+ * 64 bit finalizer from MurmurHash3, spreads every input bit over
+ * the whole output.
+ */
+static inline uint64_t mix64(uint64_t x)
+{
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdULL;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53ULL;
+  x ^= x >> 33;
+  return x;
+} /* mix64 */
+
+/*
+ * function: peer_select
+ *
+ * Rendezvous (highest random weight) hash of key over the peers.
+ * Adding or removing a peer only moves the keys that land on or
+ * leave that peer.
+ *
+ * returns: index of peer
+ */
+static inline int peer_select(struct peer *peers, int npeers, uint64_t key)
+{
+  uint64_t w, w_max;
+  int j, j_max;
+
+  j_max = 0;
+  w_max = mix64(key ^ peers[0].seed);
+
+  for (j = 1; j < npeers; ++j) {
+    w = mix64(key ^ peers[j].seed);
+    if (w > w_max) {
+      w_max = w;
+      j_max = j;
+    }
+  }
+
+  return j_max;
+
+} /* peer_select */
+
+/*
+ * function: peer_stat_dump
+ *
+ * Log a STAT line per peer.  Latency is for the interval since the
+ * previous dump, the counters are totals.
+ */
+void peer_stat_dump(struct peer *peers, int npeers, time_t now,
+  time_t time_startup)
+{
+  struct peer *peer;
+  char fmt_dst_ip[32];
+  uint64_t queued, sent, dropped, send_nobufs, send_errors, lat_n;
+  int64_t lat_sum, lat_max;
+  int j, q_used;
+
+  for (j = 0; j < npeers; ++j) {
+
+    peer = &peers[j];
+
+    pthread_mutex_lock(&peer->lock);
+
+    queued = peer->queued;
+    sent = peer->sent;
+    dropped = peer->dropped;
+    send_nobufs = peer->send_nobufs;
+    send_errors = peer->send_errors;
+    q_used = peer->q_used;
+    lat_sum = peer->lat_sum;
+    lat_max = peer->lat_max;
+    lat_n = peer->lat_n;
+
+    peer->lat_sum = peer->lat_max = 0;
+    peer->lat_n = 0;
+
+    pthread_mutex_unlock(&peer->lock);
+
+    fmt_ipv4(fmt_dst_ip, ntohl(peer->rem_addr.sin_addr.s_addr),
+      FMT_JUST_LEFT);
+
+    fterr_info(
+      "STAT: now=%lu startup=%lu peer=%d dst_ip=%s dst_port=%d queued=%llu sent=%llu dropped=%llu q_used=%d send_nobufs=%llu send_errors=%llu lat_avg_us=%llu lat_max_us=%llu",
+      (unsigned long)now, (unsigned long)time_startup, j, fmt_dst_ip,
+      (int)ntohs(peer->rem_addr.sin_port), (unsigned long long)queued,
+      (unsigned long long)sent, (unsigned long long)dropped, q_used,
+      (unsigned long long)send_nobufs, (unsigned long long)send_errors,
+      (unsigned long long)(lat_n ? lat_sum / lat_n / 1000 : 0),
+      (unsigned long long)(lat_max / 1000));
+
+  } /* foreach peer */
+
+} /* peer_stat_dump */
 
 void usage(void)
 {
   fprintf(stderr, "usage: flow-fanout [-hDs] [-A AS0_substitution] [-d debug_level]\n");
-  fprintf(stderr, "       [-m privacy_mask] [-p pidfile] [-S stat_interval] [-V pdu_version]\n");
-  fprintf(stderr, "       [-x] xmit_delay] localip/remoteip/port localip/remoteip/port ...\n");
+  fprintf(stderr, "       [-H exporter|srcaddr|dstaddr|5-tuple]\n");
+  fprintf(stderr, "       [-m privacy_mask] [-p pidfile] [-q queue_len] [-r pdu_rate]\n");
+  fprintf(stderr, "       [-S stat_interval] [-V pdu_version] [-x xmit_delay]\n");
+  fprintf(stderr, "       localip/remoteip/port localip/remoteip/port[,pdu_rate] ...\n");
 
 } /* usage */
@@ -29,9 +29,16 @@
 #include "ftconfig.h"
 #include <ftlib.h>
 
+#include <sys/types.h>
+#include <sys/stat.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <ctype.h>
+#include <time.h>
+#include <math.h>
+#include <pthread.h>
 
 #if HAVE_STRINGS_H
  #include <strings.h>
@@ -46,25 +53,108 @@
  * generate flows for testing
  */
 
-int gen_v1(struct ftio *ftio, int options);
-int gen_v5(struct ftio *ftio, int options);
-int gen_v6(struct ftio *ftio, int options);
-int gen_v7(struct ftio *ftio, int options);
-int gen_v1005(struct ftio *ftio, int options);
-int gen_v8_1(struct ftio *ftio, int options);
-int gen_v8_2(struct ftio *ftio, int options);
-int gen_v8_3(struct ftio *ftio, int options);
-int gen_v8_4(struct ftio *ftio, int options);
-int gen_v8_5(struct ftio *ftio, int options);
-int gen_v8_6(struct ftio *ftio, int options);
-int gen_v8_7(struct ftio *ftio, int options);
-int gen_v8_8(struct ftio *ftio, int options);
-int gen_v8_9(struct ftio *ftio, int options);
-int gen_v8_10(struct ftio *ftio, int options);
-int gen_v8_11(struct ftio *ftio, int options);
-int gen_v8_12(struct ftio *ftio, int options);
-int gen_v8_13(struct ftio *ftio, int options);
-int gen_v8_14(struct ftio *ftio, int options);
+int gen_v1(struct ftio *ftio, uint64_t count);
+int gen_v5(struct ftio *ftio, uint64_t count);
+int gen_v6(struct ftio *ftio, uint64_t count);
+int gen_v7(struct ftio *ftio, uint64_t count);
+int gen_v1005(struct ftio *ftio, uint64_t count);
+int gen_v8_1(struct ftio *ftio, uint64_t count);
+int gen_v8_2(struct ftio *ftio, uint64_t count);
+int gen_v8_3(struct ftio *ftio, uint64_t count);
+int gen_v8_4(struct ftio *ftio, uint64_t count);
+int gen_v8_5(struct ftio *ftio, uint64_t count);
+int gen_v8_6(struct ftio *ftio, uint64_t count);
+int gen_v8_7(struct ftio *ftio, uint64_t count);
+int gen_v8_8(struct ftio *ftio, uint64_t count);
+int gen_v8_9(struct ftio *ftio, uint64_t count);
+int gen_v8_10(struct ftio *ftio, uint64_t count);
+int gen_v8_11(struct ftio *ftio, uint64_t count);
+int gen_v8_12(struct ftio *ftio, uint64_t count);
+int gen_v8_13(struct ftio *ftio, uint64_t count);
+int gen_v8_14(struct ftio *ftio, uint64_t count);
+
+/*
+ * realistic workload generator (-R)
+ */
+
+#define GEN_BLOCK     8192  /* records generated per work unit */
+#define GEN_MAX_TERMS 64    /* max prefixes, exporters, port mix entries */
+
+/* xoshiro256** */
+struct gen_rng {
+  uint64_t s[4];
+};
+
+/* rejection-inversion Zipf sampler over 1..n */
+struct gen_zipf {
+  uint64_t n;
+  double s;
+  double h_x1, h_n, s_div;
+};
+
+/* Zipf ranked addresses scattered over a set of prefixes */
+struct gen_space {
+  uint32_t addr[GEN_MAX_TERMS];
+  uint8_t len[GEN_MAX_TERMS];
+  uint64_t end[GEN_MAX_TERMS];    /* cumulative size */
+  int n;
+  uint64_t size;                  /* addresses in all prefixes */
+  uint64_t mask;                  /* 2^bits - 1 >= size - 1 */
+  int shift;                      /* bits / 2 */
+  uint64_t mul, add;              /* rank -> address permutation */
+  struct gen_zipf zipf;
+};
+
+struct gen_mix {
+  uint8_t prot[GEN_MAX_TERMS];
+  uint16_t port[GEN_MAX_TERMS];   /* 0 is ephemeral */
+  double cum[GEN_MAX_TERMS];      /* cumulative weight, normalized */
+  int n;
+};
+
+struct gen_exporters {
+  uint32_t ip[GEN_MAX_TERMS];
+  double cum[GEN_MAX_TERMS];      /* cumulative weight, normalized */
+  uint32_t boot[GEN_MAX_TERMS];   /* boot time, seconds before t_start */
+  int n;
+};
+
+struct gen_model {
+  uint64_t count;                 /* records to generate */
+  uint64_t seed;
+  uint32_t t_start;               /* unix time of first export */
+  uint32_t t_len;                 /* seconds covered */
+  double diurnal;                 /* amplitude of daily cycle, 0..1 */
+  double *t_cdf;                  /* cumulative intensity, per minute */
+  int t_cdf_n;
+  struct gen_space src, dst;
+  struct gen_mix mix;
+  struct gen_exporters exp;
+  void (*xlate)(void *in_rec, void *out_rec);
+  int rec_size;                   /* output record size */
+};
+
+/* work queue shared by the generator threads and the writer */
+struct gen_work {
+  struct gen_model *gm;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  uint64_t nblocks;
+  uint64_t next;                  /* next block to claim */
+  uint64_t written;               /* blocks written so far */
+  int nslots;
+  char **slot;                    /* GEN_BLOCK records each */
+  uint64_t *slot_block;           /* block in slot, ~0 while empty */
+};
+
+int gen_realistic(struct ftio *ftio, struct gen_model *gm, int nthreads);
+void *gen_thread(void *arg);
+void gen_block(struct gen_model *gm, uint64_t block, char *buf, int n);
+int gen_parse_space(struct gen_space *gs, char *spec, double skew,
+  uint64_t seed);
+int gen_parse_mix(struct gen_mix *gx, char *spec);
+int gen_parse_exporters(struct gen_exporters *ge, char *spec, uint64_t seed);
+void gen_time_init(struct gen_model *gm);
 
 int debug;
 
@@ -74,9 +164,14 @@ int main(int argc, char **argv)
 {
   struct ftset ftset;
   struct ftio ftio;
-  struct ftver ftv;
-  int count, i, n;
+  struct ftver ftv, ftv5;
+  struct gen_model gm;
+  char *src_spec, *dst_spec, *mix_spec, *exp_spec, *out_fname;
+  double skew;
+  uint64_t count;
+  int i, n, out_fd, realistic, nthreads;
   unsigned int v1, v2;
+  time_t now;
 
   /* init fterr */
   fterr_setid(argv[0]);
@@ -85,16 +180,39 @@ int main(int argc, char **argv)
   ftset_init(&ftset, 0);
 
   bzero(&ftv, sizeof ftv);
+  bzero(&gm, sizeof gm);
   count = 1000;
+  realistic = 0;
+  nthreads = 1;
+  skew = 1.1;
+  out_fd = 1;
+  out_fname = (char*)0L;
+  src_spec = "10.0.0.0/8";
+  dst_spec = "0.0.0.0/0";
+  mix_spec = "tcp/443:30,tcp/80:12,udp/443:8,udp/53:12,udp/123:3,tcp/22:2,tcp/25:2,tcp/3389:1,tcp:10,udp:8,icmp:3,esp:1";
+  exp_spec = "192.0.2.1";
+  gm.diurnal = 0.6;
+  gm.t_len = 86400;
+
+  /* default to yesterday, midnight local time */
+  now = time((time_t*)0L);
+  gm.t_start = now - ((now + get_gmtoff(now)) % 86400) - 86400;
   ftv.s_version = FT_IO_SVERSION;
   ftv.d_version = 5;
   ftv.agg_method = 1;
   ftv.agg_version = 2;
 
-   while ((i = getopt(argc, argv, "b:d:hn:V:z:")) != -1)
+   while ((i = getopt(argc, argv, "a:b:d:D:e:hj:n:o:P:Rs:S:t:T:V:z:Z:")) != -1)
 
     switch(i) {
 
+    case 'a': /* diurnal amplitude */
+      gm.diurnal = strtod(optarg, (char**)0L);
+      if ((gm.diurnal < 0) || (gm.diurnal > 1))
+        fterr_errx(1, "Diurnal amplitude must be between 0 and 1");
+      realistic = 1;
+      break;
+
     case 'b': /* output byte order */
       if (!strcasecmp(optarg, "little"))
         ftset.byte_order = FT_HEADER_LITTLE_ENDIAN;
@@ -108,13 +226,67 @@ int main(int argc, char **argv)
       debug = atoi(optarg);
       break;
 
+    case 'D': /* destination prefixes */
+      dst_spec = optarg;
+      realistic = 1;
+      break;
+
+    case 'e': /* exporters */
+      exp_spec = optarg;
+      realistic = 1;
+      break;
+
     case 'h': /* help */
       usage();
       exit(0);
       break;
 
+    case 'j': /* generator threads */
+      nthreads = atoi(optarg);
+      if (nthreads < 1)
+        fterr_errx(1, "Thread count must be > 0");
+      realistic = 1;
+      break;
+
     case 'n': /* count */
-      count = atoi(optarg);
+      count = strtoull(optarg, (char**)0L, 0);
+      break;
+
+    case 'o': /* output filename */
+      out_fname = optarg;
+      break;
+
+    case 'P': /* protocol/port mix */
+      mix_spec = optarg;
+      realistic = 1;
+      break;
+
+    case 'R': /* realistic distributions */
+      realistic = 1;
+      break;
+
+    case 's': /* PRNG seed */
+      gm.seed = strtoull(optarg, (char**)0L, 0);
+      realistic = 1;
+      break;
+
+    case 'S': /* source prefixes */
+      src_spec = optarg;
+      realistic = 1;
+      break;
+
+    case 't': /* start time */
+      if ((now = get_date(optarg, (time_t*)0L)) == -1)
+        fterr_errx(1, "get_date(%s): failed", optarg);
+      gm.t_start = now;
+      realistic = 1;
+      break;
+
+    case 'T': /* seconds covered */
+      gm.t_len = strtoul(optarg, (char**)0L, 0);
+      if (!gm.t_len)
+        fterr_errx(1, "Duration must be > 0");
+      realistic = 1;
       break;
 
    case 'V': /* PDU version */
@@ -139,6 +311,13 @@ int main(int argc, char **argv)
         fterr_errx(1, "Compression level must be between 0 and 9");
       break;
 
+    case 'Z': /* Zipf exponent for addresses */
+      skew = strtod(optarg, (char**)0L);
+      if (skew <= 0)
+        fterr_errx(1, "Zipf exponent must be > 0");
+      realistic = 1;
+      break;
+
     default:
       usage();
       exit (1);
@@ -148,8 +327,40 @@ int main(int argc, char **argv)
   if (argc - optind)
     fterr_errx(1, "Extra arguments starting with %s.", argv[optind]);
 
+  if (out_fname) {
+    if ((out_fd = open(out_fname,  O_WRONLY|O_CREAT|O_TRUNC, 0644)) == -1)
+      fterr_err(1, "open(%s)", out_fname);
+  }
+
+  /* realistic records are built as v5 and translated */
+  if (realistic) {
+
+    bzero(&ftv5, sizeof ftv5);
+    ftv5.d_version = 5;
+
+    if ((ftv.d_version != 5) && (!(gm.xlate = ftrec_xlate_func(&ftv5, &ftv))))
+      fterr_errx(1, "-R supports versions 1, 5, 6, 7 and 1005");
+
+    gm.count = count;
+
+    if (gen_parse_space(&gm.src, src_spec, skew, gm.seed) < 0)
+      fterr_errx(1, "Bad source prefix list: %s", src_spec);
+
+    if (gen_parse_space(&gm.dst, dst_spec, skew, ~gm.seed) < 0)
+      fterr_errx(1, "Bad destination prefix list: %s", dst_spec);
+
+    if (gen_parse_mix(&gm.mix, mix_spec) < 0)
+      fterr_errx(1, "Bad protocol/port mix: %s", mix_spec);
+
+    if (gen_parse_exporters(&gm.exp, exp_spec, gm.seed) < 0)
+      fterr_errx(1, "Bad exporter list: %s", exp_spec);
+
+    gen_time_init(&gm);
+
+  } /* realistic */
+
   /* output to stdout */
-  if (ftio_init(&ftio, 1, FT_IO_FLAG_WRITE |
+  if (ftio_init(&ftio, out_fd, FT_IO_FLAG_WRITE |
     ((ftset.z_level) ? FT_IO_FLAG_ZINIT : 0) ) < 0)
     fterr_errx(1, "ftio_init(): failed");
 
@@ -167,6 +378,17 @@ int main(int argc, char **argv)
   if (ftio_write_header(&ftio) < 0)
     fterr_errx(1, "ftio_write_header(): failed");
 
+  if (realistic) {
+
+    gm.rec_size = ftio_rec_size(&ftio);
+
+    if (gen_realistic(&ftio, &gm, nthreads) < 0)
+      fterr_errx(1, "gen_realistic(): failed");
+
+    goto done;
+
+  }
+
   switch (ftv.d_version) {
 
     case 1:
@@ -261,6 +483,8 @@ int main(int argc, char **argv)
 
   } /* switch d_version */
 
+done:
+
   if (ftio_close(&ftio) < 0)
     fterr_errx(1, "ftio_close(): failed");
 
@@ -268,10 +492,10 @@ int main(int argc, char **argv)
 
 } /* main */
 
-int gen_v1(struct ftio *ftio, int count)
+int gen_v1(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v1 rec_v1;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v1, sizeof rec_v1);
 
@@ -309,10 +533,10 @@ int gen_v1(struct ftio *ftio, int count)
 
 } /* gen_v1 */
 
-int gen_v5(struct ftio *ftio, int count)
+int gen_v5(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v5 rec_v5;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v5, sizeof rec_v5);
 
@@ -356,10 +580,10 @@ int gen_v5(struct ftio *ftio, int count)
 
 } /* gen_v5 */
 
-int gen_v6(struct ftio *ftio, int count)
+int gen_v6(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v6 rec_v6;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v6, sizeof rec_v6);
 
@@ -407,10 +631,10 @@ int gen_v6(struct ftio *ftio, int count)
 
 } /* gen_v6 */
 
-int gen_v7(struct ftio *ftio, int count)
+int gen_v7(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v7 rec_v7;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v7, sizeof rec_v7);
 
@@ -454,10 +678,10 @@ int gen_v7(struct ftio *ftio, int count)
 
 } /* gen_v7 */
 
-int gen_v8_1(struct ftio *ftio, int count)
+int gen_v8_1(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_1 rec_v8_1;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_1, sizeof rec_v8_1);
 
@@ -491,10 +715,10 @@ int gen_v8_1(struct ftio *ftio, int count)
 
 } /* gen_v8_1 */
 
-int gen_v8_2(struct ftio *ftio, int count)
+int gen_v8_2(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_2 rec_v8_2;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_2, sizeof rec_v8_2);
 
@@ -524,10 +748,10 @@ int gen_v8_2(struct ftio *ftio, int count)
 
 } /* gen_v8_2 */
 
-int gen_v8_3(struct ftio *ftio, int count)
+int gen_v8_3(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_3 rec_v8_3;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_3, sizeof rec_v8_3);
 
@@ -559,10 +783,10 @@ int gen_v8_3(struct ftio *ftio, int count)
 
 } /* gen_v8_3 */
 
-int gen_v8_4(struct ftio *ftio, int count)
+int gen_v8_4(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_4 rec_v8_4;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_4, sizeof rec_v8_4);
 
@@ -593,10 +817,10 @@ int gen_v8_4(struct ftio *ftio, int count)
 
 } /* gen_v8_4 */
 
-int gen_v8_5(struct ftio *ftio, int count)
+int gen_v8_5(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_5 rec_v8_5;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_5, sizeof rec_v8_5);
 
@@ -635,10 +859,10 @@ int gen_v8_5(struct ftio *ftio, int count)
 
 } /* gen_v8_5 */
 
-int gen_v8_6(struct ftio *ftio, int count)
+int gen_v8_6(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_6 rec_v8_6;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_6, sizeof rec_v8_6);
 
@@ -675,10 +899,10 @@ int gen_v8_6(struct ftio *ftio, int count)
 
 } /* gen_v8_6 */
 
-int gen_v8_7(struct ftio *ftio, int count)
+int gen_v8_7(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_7 rec_v8_7;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_7, sizeof rec_v8_7);
 
@@ -717,10 +941,10 @@ int gen_v8_7(struct ftio *ftio, int count)
 
 } /* gen_v8_7 */
 
-int gen_v8_8(struct ftio *ftio, int count)
+int gen_v8_8(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_8 rec_v8_8;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_8, sizeof rec_v8_8);
 
@@ -763,10 +987,10 @@ int gen_v8_8(struct ftio *ftio, int count)
 
 } /* gen_v8_8 */
 
-int gen_v8_9(struct ftio *ftio, int count)
+int gen_v8_9(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_9 rec_v8_9;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_9, sizeof rec_v8_9);
 
@@ -802,10 +1026,10 @@ int gen_v8_9(struct ftio *ftio, int count)
 
 } /* gen_v8_9 */
 
-int gen_v8_10(struct ftio *ftio, int count)
+int gen_v8_10(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_10 rec_v8_10;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_10, sizeof rec_v8_10);
 
@@ -837,10 +1061,10 @@ int gen_v8_10(struct ftio *ftio, int count)
 
 } /* gen_v8_10 */
 
-int gen_v8_11(struct ftio *ftio, int count)
+int gen_v8_11(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_11 rec_v8_11;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_11, sizeof rec_v8_11);
 
@@ -873,10 +1097,10 @@ int gen_v8_11(struct ftio *ftio, int count)
 
 } /* gen_v8_11 */
 
-int gen_v8_12(struct ftio *ftio, int count)
+int gen_v8_12(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_12 rec_v8_12;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_12, sizeof rec_v8_12);
 
@@ -909,10 +1133,10 @@ int gen_v8_12(struct ftio *ftio, int count)
 
 } /* gen_v8_12 */
 
-int gen_v8_13(struct ftio *ftio, int count)
+int gen_v8_13(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_13 rec_v8_13;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_13, sizeof rec_v8_13);
 
@@ -953,10 +1177,10 @@ int gen_v8_13(struct ftio *ftio, int count)
 
 } /* gen_v8_13 */
 
-int gen_v8_14(struct ftio *ftio, int count)
+int gen_v8_14(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v8_14 rec_v8_14;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v8_14, sizeof rec_v8_14);
 
@@ -999,10 +1223,10 @@ int gen_v8_14(struct ftio *ftio, int count)
 
 } /* gen_v8_14 */
 
-int gen_v1005(struct ftio *ftio, int count)
+int gen_v1005(struct ftio *ftio, uint64_t count)
 {
   struct fts3rec_v1005 rec_v1005;
-  int i;
+  uint64_t i;
 
   bzero(&rec_v1005, sizeof rec_v1005);
 
@@ -1052,7 +1276,723 @@ int gen_v1005(struct ftio *ftio, int count)
   return 0;
 
 } /* gen_v1005 */
+/*
+ * function: gen_rng_seed
+ *
+ * Seed xoshiro256** from a 64 bit value with splitmix64.
+ */
+static void gen_rng_seed(struct gen_rng *r, uint64_t seed)
+{
+  uint64_t z;
+  int i;
+
+  for (i = 0; i < 4; ++i) {
+    seed += 0x9e3779b97f4a7c15ULL;
+    z = seed;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    r->s[i] = z ^ (z >> 31);
+  }
+
+} /* gen_rng_seed */
+
+static inline uint64_t gen_rotl(uint64_t x, int k)
+{
+  return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t gen_rng_next(struct gen_rng *r)
+{
+  uint64_t result, t;
+
+  result = gen_rotl(r->s[1] * 5, 7) * 9;
+  t = r->s[1] << 17;
+
+  r->s[2] ^= r->s[0];
+  r->s[3] ^= r->s[1];
+  r->s[1] ^= r->s[2];
+  r->s[0] ^= r->s[3];
+  r->s[2] ^= t;
+  r->s[3] = gen_rotl(r->s[3], 45);
+
+  return result;
+}
+
+/* uniform [0,1) */
+static inline double gen_rng_u(struct gen_rng *r)
+{
+  return (gen_rng_next(r) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/* uniform [lo,hi] */
+static inline uint32_t gen_rng_range(struct gen_rng *r, uint32_t lo,
+  uint32_t hi)
+{
+  return lo + (uint32_t)(gen_rng_u(r) * ((double)hi - lo + 1));
+}
+
+/* index of first cum[] > u */
+static inline int gen_pick(double *cum, int n, double u)
+{
+  int i;
+
+  for (i = 0; i < n - 1; ++i)
+    if (u < cum[i])
+      break;
+
+  return i;
+}
+
+/*
+ * Zipf sampling by rejection-inversion, W. Hormann and G. Derflinger,
+ * "Rejection-inversion to generate variates from monotone discrete
+ * distributions", 1996.  Constant time for any n and exponent.
+ */
+static double gen_zipf_h1(double x)
+{
+  return (fabs(x) > 1e-8) ? log1p(x) / x : 1 - x * (0.5 - x * (1.0/3 - 0.25 * x));
+}
+
+static double gen_zipf_h2(double x)
+{
+  return (fabs(x) > 1e-8) ? expm1(x) / x : 1 + x * 0.5 * (1 + x / 3 * (1 + 0.25 * x));
+}
+
+static double gen_zipf_hint(struct gen_zipf *z, double x)
+{
+  double log_x;
+
+  log_x = log(x);
+  return gen_zipf_h2((1 - z->s) * log_x) * log_x;
+}
+
+static double gen_zipf_h(struct gen_zipf *z, double x)
+{
+  return exp(-z->s * log(x));
+}
+
+static double gen_zipf_hinv(struct gen_zipf *z, double x)
+{
+  double t;
+
+  t = x * (1 - z->s);
+  if (t < -1)
+    t = -1;
+  return exp(gen_zipf_h1(t) * x);
+}
+
+static void gen_zipf_init(struct gen_zipf *z, uint64_t n, double s)
+{
+  z->n = n;
+  z->s = s;
+  z->h_x1 = gen_zipf_hint(z, 1.5) - 1;
+  z->h_n = gen_zipf_hint(z, (double)n + 0.5);
+  z->s_div = 2 - gen_zipf_hinv(z, gen_zipf_hint(z, 2.5) - gen_zipf_h(z, 2));
+}
+
+/* rank in 1..n, 1 most likely */
+static uint64_t gen_zipf_sample(struct gen_zipf *z, struct gen_rng *r)
+{
+  double u, x;
+  uint64_t k;
+
+  while (1) {
+
+    u = z->h_n + gen_rng_u(r) * (z->h_x1 - z->h_n);
+    x = gen_zipf_hinv(z, u);
+
+    if (x < 1.5)
+      k = 1;
+    else if (x + 0.5 >= (double)z->n)
+      k = z->n;
+    else
+      k = (uint64_t)(x + 0.5);
+
+    if (((double)k - x <= z->s_div) ||
+        (u >= gen_zipf_hint(z, (double)k + 0.5) - gen_zipf_h(z, (double)k)))
+      return k;
+
+  }
+
+} /* gen_zipf_sample */
+
+/*
+ * function: gen_space_addr
+ *
+ * Map a Zipf rank to an address.  Ranks are scattered over the
+ * prefixes with a bijection on [0,2^bits) and cycle walking, so the
+ * popular addresses are not all at the start of the first prefix.
+ */
+static uint32_t gen_space_addr(struct gen_space *gs, uint64_t rank)
+{
+  uint64_t x;
+  int i;
+
+  x = rank - 1;
+
+  do {
+    x = (x * gs->mul + gs->add) & gs->mask;
+    x ^= x >> gs->shift;
+  } while (x >= gs->size);
+
+  for (i = 0; i < gs->n - 1; ++i)
+    if (x < gs->end[i])
+      break;
+
+  if (i)
+    x -= gs->end[i-1];
+
+  return gs->addr[i] + (uint32_t)x;
+
+} /* gen_space_addr */
+
+/*
+ * function: gen_parse_space
+ *
+ * Parse a comma separated prefix list, a.b.c.d/len,...
+ *
+ * returns: < 0 error
+ *          >= 0 ok
+ */
+int gen_parse_space(struct gen_space *gs, char *spec, double skew,
+  uint64_t seed)
+{
+  struct ip_prefix pfx;
+  struct gen_rng r;
+  char *buf, *c, *tok;
+  int bits;
+
+  bzero(gs, sizeof *gs);
+
+  if (!(buf = strdup(spec)))
+    return -1;
+
+  for (c = buf; (tok = strsep(&c, ","));) {
+
+    if (!*tok)
+      continue;
+
+    if (gs->n == GEN_MAX_TERMS) {
+      free(buf);
+      return -1;
+    }
+
+    pfx = scan_ip_prefix(tok);
+
+    gs->len[gs->n] = pfx.len;
+    gs->addr[gs->n] = pfx.addr & ipv4_len2mask(pfx.len);
+    if (!pfx.len)
+      gs->addr[gs->n] = 0;
+    gs->size += 1ULL << (32 - pfx.len);
+    gs->end[gs->n] = gs->size;
+    ++gs->n;
+
+  }
+
+  free(buf);
+
+  if (!gs->n)
+    return -1;
+
+  for (bits = 1; (1ULL << bits) < gs->size; ++bits);
+
+  gs->mask = (1ULL << bits) - 1;
+  gs->shift = (bits + 1) / 2;
+
+  gen_rng_seed(&r, seed);
+  gs->mul = (gen_rng_next(&r) | 1) & gs->mask;
+  gs->add = gen_rng_next(&r) & gs->mask;
+
+  gen_zipf_init(&gs->zipf, gs->size, skew);
+
+  return 0;
+
+} /* gen_parse_space */
+
+/*
+ * function: gen_parse_mix
+ *
+ * Parse prot[/port][:weight],...  prot is a number or tcp, udp, icmp,
+ * gre, esp.  A missing or 0 port is a random ephemeral port.
+ *
+ * returns: < 0 error
+ *          >= 0 ok
+ */
+int gen_parse_mix(struct gen_mix *gx, char *spec)
+{
+  char *buf, *c, *tok, *port, *weight;
+  double total, w;
+  int i, prot;
+
+  bzero(gx, sizeof *gx);
+
+  if (!(buf = strdup(spec)))
+    return -1;
+
+  total = 0;
+
+  for (c = buf; (tok = strsep(&c, ","));) {
+
+    if (!*tok)
+      continue;
+
+    if (gx->n == GEN_MAX_TERMS)
+      goto bad;
+
+    w = 1;
+    if ((weight = strchr(tok, ':'))) {
+      *weight++ = 0;
+      w = strtod(weight, (char**)0L);
+    }
+
+    if ((port = strchr(tok, '/')))
+      *port++ = 0;
+
+    if (!strcasecmp(tok, "tcp"))
+      prot = 6;
+    else if (!strcasecmp(tok, "udp"))
+      prot = 17;
+    else if (!strcasecmp(tok, "icmp"))
+      prot = 1;
+    else if (!strcasecmp(tok, "gre"))
+      prot = 47;
+    else if (!strcasecmp(tok, "esp"))
+      prot = 50;
+    else if (isdigit((int)*tok))
+      prot = atoi(tok);
+    else
+      goto bad;
+
+    if ((prot > 255) || (w <= 0))
+      goto bad;
+
+    gx->prot[gx->n] = prot;
+    gx->port[gx->n] = port ? atoi(port) : 0;
+    total += w;
+    gx->cum[gx->n] = total;
+    ++gx->n;
+
+  }
+
+  free(buf);
+
+  if (!gx->n)
+    return -1;
+
+  for (i = 0; i < gx->n; ++i)
+    gx->cum[i] /= total;
+
+  return 0;
+
+bad:
+  free(buf);
+  return -1;
+
+} /* gen_parse_mix */
+
+/*
+ * function: gen_parse_exporters
+ *
+ * Parse ip[:weight],...  Each exporter's share of the flows is
+ * proportional to its weight.
+ *
+ * returns: < 0 error
+ *          >= 0 ok
+ */
+int gen_parse_exporters(struct gen_exporters *ge, char *spec, uint64_t seed)
+{
+  struct gen_rng r;
+  char *buf, *c, *tok, *weight;
+  double total, w;
+  int i;
+
+  bzero(ge, sizeof *ge);
+
+  if (!(buf = strdup(spec)))
+    return -1;
+
+  gen_rng_seed(&r, seed ^ 0x6578706f72746572ULL);
+
+  total = 0;
+
+  for (c = buf; (tok = strsep(&c, ","));) {
+
+    if (!*tok)
+      continue;
+
+    w = 1;
+    if ((weight = strchr(tok, ':'))) {
+      *weight++ = 0;
+      w = strtod(weight, (char**)0L);
+    }
+
+    if ((ge->n == GEN_MAX_TERMS) || (w <= 0)) {
+      free(buf);
+      return -1;
+    }
+
+    ge->ip[ge->n] = scan_ip(tok);
+    total += w;
+    ge->cum[ge->n] = total;
+
+    /* up for 1 to 40 days, sysUpTime wraps at 49.7 */
+    ge->boot[ge->n] = gen_rng_range(&r, 86400, 86400*40);
+
+    ++ge->n;
+
+  }
+
+  free(buf);
+
+  if (!ge->n)
+    return -1;
+
+  for (i = 0; i < ge->n; ++i)
+    ge->cum[i] /= total;
+
+  return 0;
+
+} /* gen_parse_exporters */
+
+/*
+ * function: gen_time_init
+ *
+ * Build the cumulative flow intensity over the time range, one point
+ * per minute.  Intensity follows a daily cosine peaking at 21:00 local
+ * time scaled by the diurnal amplitude.
+ */
+void gen_time_init(struct gen_model *gm)
+{
+  double hour, x;
+  int i, gmtoff;
+
+  gm->t_cdf_n = (gm->t_len + 59) / 60;
+
+  if (!(gm->t_cdf = (double*)malloc((gm->t_cdf_n + 1) * sizeof (double))))
+    fterr_err(1, "malloc()");
+
+  gmtoff = get_gmtoff(gm->t_start);
+
+  gm->t_cdf[0] = 0;
+
+  for (i = 0; i < gm->t_cdf_n; ++i) {
+    hour = fmod((double)(gm->t_start + gmtoff + i * 60 + 30) / 3600.0, 24.0);
+    x = 1 + gm->diurnal * cos(2 * M_PI * (hour - 21.0) / 24.0);
+    gm->t_cdf[i+1] = gm->t_cdf[i] + x;
+  }
+
+  for (i = 1; i <= gm->t_cdf_n; ++i)
+    gm->t_cdf[i] /= gm->t_cdf[gm->t_cdf_n];
+
+} /* gen_time_init */
+
+/*
+ * function: gen_block
+ *
+ * Generate records [block*GEN_BLOCK, block*GEN_BLOCK+n) into buf.
+ * Each block has its own PRNG stream so the output depends only on the
+ * seed, not on the number of threads.
+ */
+void gen_block(struct gen_model *gm, uint64_t block, char *buf, int n)
+{
+  struct fts3rec_v5 rec_v5;
+  struct gen_rng r;
+  uint64_t i;
+  uint64_t t_ns;
+  uint32_t export_ms, last_ms, dur_ms, pkts, avg, port;
+  double u, t;
+  int j, k, e, server_dst;
+  uint8_t prot;
+
+  gen_rng_seed(&r, gm->seed ^ (block * 0xd1b54a32d192ed03ULL));
+
+  bzero(&rec_v5, sizeof rec_v5);
+
+  k = 0;
+
+  for (j = 0; j < n; ++j) {
+
+    i = block * GEN_BLOCK + j;
+
+    /* export time, inverse of the intensity cdf */
+    u = ((double)i + 0.5) / (double)gm->count;
+
+    while ((k < gm->t_cdf_n - 1) && (gm->t_cdf[k+1] <= u))
+      ++k;
+
+    t = (double)k + (u - gm->t_cdf[k]) / (gm->t_cdf[k+1] - gm->t_cdf[k]);
+    t_ns = (uint64_t)(t * 60.0 * 1e9);
+    if (t_ns >= (uint64_t)gm->t_len * 1000000000ULL)
+      t_ns = (uint64_t)gm->t_len * 1000000000ULL - 1;
+
+    e = gen_pick(gm->exp.cum, gm->exp.n, gen_rng_u(&r));
+
+    rec_v5.unix_secs = gm->t_start + (uint32_t)(t_ns / 1000000000ULL);
+    rec_v5.unix_nsecs = (uint32_t)(t_ns % 1000000000ULL);
+    export_ms = (gm->exp.boot[e] * 1000) + (uint32_t)(t_ns / 1000000ULL);
+    rec_v5.sysUpTime = export_ms;
+    rec_v5.exaddr = gm->exp.ip[e];
+    rec_v5.engine_id = e;
+
+    rec_v5.srcaddr = gen_space_addr(&gm->src,
+      gen_zipf_sample(&gm->src.zipf, &r));
+    rec_v5.dstaddr = gen_space_addr(&gm->dst,
+      gen_zipf_sample(&gm->dst.zipf, &r));
+
+    /* application */
+    e = gen_pick(gm->mix.cum, gm->mix.n, gen_rng_u(&r));
+    prot = gm->mix.prot[e];
+    port = gm->mix.port[e];
+    server_dst = gen_rng_u(&r) < 0.5;
+
+    if ((prot == 6) || (prot == 17)) {
+
+      if (!port)
+        port = gen_rng_range(&r, 1024, 65535);
+
+      if (server_dst) {
+        rec_v5.dstport = port;
+        rec_v5.srcport = gen_rng_range(&r, 1024, 65535);
+      } else {
+        rec_v5.srcport = port;
+        rec_v5.dstport = gen_rng_range(&r, 1024, 65535);
+      }
+
+    } else if (prot == 1) {
+
+      /* type << 8 | code, echo request / reply / unreachable */
+      u = gen_rng_u(&r);
+      rec_v5.srcport = 0;
+      rec_v5.dstport = (u < 0.45) ? 0x0800 : (u < 0.9) ? 0x0000 : 0x0303;
+
+    } else {
+
+      rec_v5.srcport = rec_v5.dstport = 0;
+
+    }
+
+    rec_v5.prot = prot;
+
+    /* packets, Pareto alpha 1.2, about half the flows are 1 packet */
+    u = gen_rng_u(&r);
+    t = pow(1.0 - u, -1.0 / 1.2);
+    pkts = (t >= 4e9) ? 4000000000U : (uint32_t)t;
+
+    /* average packet size by application */
+    u = gen_rng_u(&r);
+    if (prot == 6) {
+      if (pkts == 1)
+        avg = gen_rng_range(&r, 40, 64);
+      else
+        avg = (u < 0.5) ? gen_rng_range(&r, 1000, 1500) :
+          gen_rng_range(&r, 52, 400);
+    } else if (prot == 17) {
+      if ((port == 53) || (port == 123))
+        avg = gen_rng_range(&r, 60, 220);
+      else
+        avg = gen_rng_range(&r, 100, 1350);
+    } else if (prot == 1) {
+      avg = gen_rng_range(&r, 64, 98);
+    } else {
+      avg = gen_rng_range(&r, 100, 1400);
+    }
+
+    rec_v5.dPkts = pkts;
+    rec_v5.dOctets = ((uint64_t)pkts * avg > 0xFFFFFFFFULL) ? 0xFFFFFFFF :
+      pkts * avg;
+
+    /* duration, capped at a 30 minute active timeout */
+    if (pkts == 1)
+      dur_ms = 0;
+    else {
+      t = (double)(pkts - 1) * -log(1.0 - gen_rng_u(&r)) * 40.0;
+      dur_ms = (t > 1800000.0) ? 1800000 : (uint32_t)t;
+    }
+
+    /* flow ended within the 15 second inactive timeout before export */
+    last_ms = export_ms - gen_rng_range(&r, 0, 15000);
+    rec_v5.Last = last_ms;
+    rec_v5.First = last_ms - dur_ms;
+
+    if (prot == 6) {
+      u = gen_rng_u(&r);
+      if (pkts == 1)
+        rec_v5.tcp_flags = (u < 0.6) ? 0x02 : (u < 0.8) ? 0x04 : 0x10;
+      else
+        rec_v5.tcp_flags = (u < 0.7) ? 0x1b : (u < 0.9) ? 0x18 : 0x1f;
+    } else {
+      rec_v5.tcp_flags = 0;
+    }
+
+    /* mostly best effort, some AF11 and EF */
+    u = gen_rng_u(&r);
+    rec_v5.tos = (u < 0.9) ? 0 : (u < 0.97) ? 0x28 : 0xb8;
+
+    /* interfaces, a few busy ones per exporter */
+    rec_v5.input = 1 + (uint16_t)(-log(1.0 - gen_rng_u(&r)) * 3.0) % 48;
+    rec_v5.output = 1 + (uint16_t)(-log(1.0 - gen_rng_u(&r)) * 3.0) % 48;
+    rec_v5.nexthop = (rec_v5.exaddr & 0xFFFFFF00) | (rec_v5.output & 0xFF);
+
+    /* routing is stable per /16 */
+    rec_v5.src_mask = 24;
+    rec_v5.dst_mask = 24;
+    rec_v5.src_as = 64512 + ((rec_v5.srcaddr >> 16) * 2654435761U >> 22);
+    rec_v5.dst_as = 64512 + ((rec_v5.dstaddr >> 16) * 2654435761U >> 22);
+
+    if (gm->xlate)
+      gm->xlate(&rec_v5, buf + j * gm->rec_size);
+    else
+      bcopy(&rec_v5, buf + j * gm->rec_size, sizeof rec_v5);
+
+  } /* for */
+
+} /* gen_block */
+
+/*
+ * function: gen_thread
+ *
+ * Claim blocks, generate into a free slot, hand to the writer.
+ */
+void *gen_thread(void *arg)
+{
+  struct gen_work *gw;
+  uint64_t b;
+  int slot, n;
+
+  gw = (struct gen_work*)arg;
+
+  while (1) {
+
+    pthread_mutex_lock(&gw->lock);
+
+    if (gw->next == gw->nblocks) {
+      pthread_mutex_unlock(&gw->lock);
+      break;
+    }
+
+    b = gw->next++;
+    slot = b % gw->nslots;
+
+    /* slot is free once the writer is within nslots of this block */
+    while (b >= gw->written + gw->nslots)
+      pthread_cond_wait(&gw->cond, &gw->lock);
+
+    pthread_mutex_unlock(&gw->lock);
+
+    n = (b == gw->nblocks - 1) ? gw->gm->count - b * GEN_BLOCK : GEN_BLOCK;
+
+    gen_block(gw->gm, b, gw->slot[slot], n);
+
+    pthread_mutex_lock(&gw->lock);
+    gw->slot_block[slot] = b;
+    pthread_cond_broadcast(&gw->cond);
+    pthread_mutex_unlock(&gw->lock);
+
+  } /* while */
+
+  return (void*)0L;
+
+} /* gen_thread */
+
+/*
+ * function: gen_realistic
+ *
+ * Generate gm->count records with nthreads generators, writing blocks
+ * to ftio in order from the calling thread.
+ *
+ * returns: < 0 error
+ *          >= 0 ok
+ */
+int gen_realistic(struct ftio *ftio, struct gen_model *gm, int nthreads)
+{
+  struct gen_work gw;
+  pthread_t *threads;
+  uint64_t b;
+  char *rec;
+  int i, slot, n, ret;
+
+  bzero(&gw, sizeof gw);
+  ret = -1;
+
+  gw.gm = gm;
+  gw.nblocks = (gm->count + GEN_BLOCK - 1) / GEN_BLOCK;
+  gw.nslots = nthreads * 2;
+
+  if (!(threads = (pthread_t*)malloc(nthreads * sizeof (pthread_t))) ||
+      !(gw.slot = (char**)malloc(gw.nslots * sizeof (char*))) ||
+      !(gw.slot_block = (uint64_t*)malloc(gw.nslots * sizeof (uint64_t))))
+    fterr_err(1, "malloc()");
+
+  for (i = 0; i < gw.nslots; ++i) {
+    if (!(gw.slot[i] = (char*)malloc(GEN_BLOCK * gm->rec_size)))
+      fterr_err(1, "malloc()");
+    gw.slot_block[i] = ~0ULL;
+  }
+
+  pthread_mutex_init(&gw.lock, (pthread_mutexattr_t*)0L);
+  pthread_cond_init(&gw.cond, (pthread_condattr_t*)0L);
+
+  for (i = 0; i < nthreads; ++i)
+    if (pthread_create(&threads[i], (pthread_attr_t*)0L, gen_thread, &gw))
+      fterr_errx(1, "pthread_create(): failed");
+
+  for (b = 0; b < gw.nblocks; ++b) {
+
+    slot = b % gw.nslots;
+
+    pthread_mutex_lock(&gw.lock);
+    while (gw.slot_block[slot] != b)
+      pthread_cond_wait(&gw.cond, &gw.lock);
+    pthread_mutex_unlock(&gw.lock);
+
+    n = (b == gw.nblocks - 1) ? gm->count - b * GEN_BLOCK : GEN_BLOCK;
+
+    for (i = 0, rec = gw.slot[slot]; i < n; ++i, rec += gm->rec_size) {
+      if (ftio_write(ftio, rec) < 0) {
+        fterr_warnx("ftio_write(): failed");
+        goto out;
+      }
+    }
+
+    pthread_mutex_lock(&gw.lock);
+    gw.slot_block[slot] = ~0ULL;
+    ++gw.written;
+    pthread_cond_broadcast(&gw.cond);
+    pthread_mutex_unlock(&gw.lock);
+
+  } /* for */
+
+  ret = 0;
+
+out:
+
+  /* on error let the generators run dry */
+  if (ret < 0) {
+    pthread_mutex_lock(&gw.lock);
+    gw.next = gw.nblocks;
+    gw.written = gw.nblocks;
+    pthread_cond_broadcast(&gw.cond);
+    pthread_mutex_unlock(&gw.lock);
+  }
+
+  for (i = 0; i < nthreads; ++i)
+    pthread_join(threads[i], (void**)0L);
+
+  for (i = 0; i < gw.nslots; ++i)
+    free(gw.slot[i]);
+
+  free(gw.slot);
+  free(gw.slot_block);
+  free(threads);
+
+  return ret;
+
+} /* gen_realistic */
+
 void usage(void) {
   fprintf(stderr, "Usage: flow-gen [-h] [-b big|little] [-d debug_level] [-n count]\n");
-  fprintf(stderr, "       [-V version] [-z z_level]\n");
+  fprintf(stderr, "       [-o output_file] [-V version] [-z z_level]\n");
+  fprintf(stderr, "       [-R] [-j threads] [-s seed] [-S src_prefix,...] [-D dst_prefix,...]\n");
+  fprintf(stderr, "       [-Z zipf_exponent] [-P prot/port:weight,...] [-e exporter:weight,...]\n");
+  fprintf(stderr, "       [-t start_time] [-T seconds] [-a diurnal_amplitude]\n");
 } /* usage */
@@ -30,11 +30,16 @@
 #include <ftlib.h>
 
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <sys/signal.h>
+#include <dirent.h>
 #include <unistd.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <fcntl.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
 
 #if HAVE_STRINGS_H
  #include <strings.h>
@@ -45,27 +50,183 @@
 #endif
 
 
+/*
+ * With -j the input is cut into blocks of REPORT_BLOCK_RECS records.
+ * Each block is accumulated by a worker thread into its own copy of the
+ * definition, then merged into the main copy in input order.  The block
+ * size does not depend on the number of threads so the output does not
+ * either.
+ *
+ * Several definitions are evaluated in one pass over the input, each
+ * block is accumulated into every definition.
+ */
+#define REPORT_BLOCK_RECS  131072
+
+/*
+ * Without -j flows are copied into a batch of REPORT_BATCH_RECS and
+ * accumulated with ftstat_def_accum_batch().  Definitions with a mask
+ * or tag instead share the masked and tagged flow one at a time.
+ */
+#define REPORT_BATCH_RECS  256
+
+/*
+ * Definitions with a window are reported at wall clock steps.  A reader
+ * thread queues up to STREAM_QUEUE_RECS flows so a step ends on time
+ * when no flows arrive.  A sliding window keeps a copy of the definition
+ * per step in a ring, the window reported is the merge of the ring.
+ */
+#define STREAM_QUEUE_RECS  4096
+
+/*
+ * With -O a finished interval is calculated and dumped by a writer
+ * thread while flows accumulate into a spare copy of the definition.
+ * Each of the -O snapshots is a private copy of the configuration, at
+ * most that many intervals of a definition wait for the writer.
+ */
+
+#define REPORT_IDLE        0  /* nothing to merge */
+#define REPORT_BUSY        1  /* accumulating a block */
+#define REPORT_DONE        2  /* block accumulated, waiting for merge */
+#define REPORT_QUIT        3  /* exit */
+
+struct report_pool;
+
+struct report_worker {
+  pthread_t thread;
+  pthread_cond_t cond;         /* signaled when a block is assigned */
+  struct report_pool *pool;    /* back pointer */
+  struct ftstat ftstat;        /* private copy of the configuration */
+  struct ftstat_def **ftsd;    /* private copies of the definitions */
+  uint32_t *start_time;        /* time series interval of block, per def */
+  char *recs;                  /* block of records */
+  uint32_t nrecs;              /* records in block */
+  int state;                   /* REPORT_* */
+  int live;                    /* ftsd[0..live-1] have report state */
+  int err;                     /* accumulate failed */
+};
+
+struct report_pool {
+  pthread_mutex_t lock;        /* protects state of all workers */
+  pthread_cond_t done_cond;    /* signaled when a block is accumulated */
+  struct report_worker *workers;
+  struct fts3rec_offsets *fo;
+  int nworkers;
+  int ndefs;
+  int rec_size;
+  int batch;                   /* use ftstat_def_accum_batch() */
+  uint64_t seq;                /* next block to dispatch */
+  uint64_t merged;             /* next block to merge */
+};
+
+struct stream_queue {
+  pthread_mutex_t lock;
+  pthread_cond_t cond;         /* flows queued, queue drained or eof */
+  pthread_t thread;
+  struct ftio *ftio;
+  struct ftcol *ftc;           /* column file instead of ftio */
+  char *recs;                  /* queued records */
+  char *spare;                 /* swapped with recs by the consumer */
+  uint32_t nrecs;              /* records queued */
+  int rec_size;
+  int eof;                     /* reader is done */
+};
+
+struct report_writer {
+  pthread_mutex_t lock;
+  pthread_cond_t cond;         /* queued, copy returned or quit */
+  pthread_t thread;
+  struct ftio *ftio;
+  struct ftstat *ftstat;       /* private configuration per snapshot */
+  struct ftstat_def ***spare;  /* per def, copies ready to accumulate */
+  int *nspare;                 /* per def */
+  struct ftstat_def **queue;   /* intervals to output, in order */
+  int *queue_d;                /* def index of queue entry */
+  int qlen, head, n;           /* queue ring */
+  int ndefs, nsnaps;
+  int quit;                    /* drain the queue and exit */
+};
+
+struct stream_ring {
+  struct ftstat *ftstat;       /* private configuration per step */
+  struct ftstat_def **ftsd;    /* definition per step */
+  int nsteps;                  /* window / slide, 0 for no ring */
+  int cur;                     /* step accumulating flows */
+};
+
 int debug;
 void usage(void);
 
 int sig_pipe_flag;
 void sig_pipe(int);
 
+void *report_thread(void *arg);
+void report_merge(struct report_pool *pool, struct report_worker *w,
+  struct ftstat_def **ftsd);
+struct report_worker *report_take(struct report_pool *pool,
+  struct ftstat_def **ftsd);
+void report_dispatch(struct report_pool *pool, struct report_worker *w,
+  uint32_t nrecs);
+void report_flush(struct report_pool *pool, struct ftstat_def **ftsd);
+void report_output(struct ftio *ftio, struct ftstat_def *ftsd);
+void report_batch(struct ftstat_def **ftsd, int ndefs, char *recs,
+  int rec_size, uint32_t nrecs, struct fts3rec_offsets *fo);
+void report_xrec(struct report_writer *rw, struct ftio *ftio,
+  struct ftstat_def **ftsd, int ndefs, char *rec, struct fts3rec_offsets *fo,
+  struct ftstat_xrec *xr);
+void report_emit(struct report_writer *rw, struct ftio *ftio,
+  struct ftstat_def **ftsd, int d);
+
+void writer_start(struct report_writer *rw, struct ftio *ftio,
+  struct ftvar *ftvar, const char *fname, const char **dnames, int ndefs,
+  int nsnaps);
+void writer_stop(struct report_writer *rw);
+void writer_free(struct report_writer *rw);
+void *writer_thread(void *arg);
+
+void rollup_find(const char *path, char ***names, int *nnames);
+int rollup_cmp(const void *a, const void *b);
+uint64_t rollup_xfields(char **names, int nnames);
+uint32_t rollup_replay(struct ftstat_def **ftsd, int ndefs, char **names,
+  int nnames);
+
+char *report_read(struct ftio *ftio, struct ftcol *ftc);
+
+void *stream_read(void *arg);
+uint32_t stream_take(struct stream_queue *q, char **recs, uint32_t deadline,
+  int *eof);
+void stream_step(struct report_writer *rw, struct ftio *ftio,
+  struct ftstat_def **ftsd, int d, struct stream_ring *ring);
+
 int main(int argc, char **argv)
 {
-  struct ftio ftio;
+  struct ftio ftio, *ftiop;
+  struct ftcol ftc, *ftcp;
   struct ftprof ftp;
   struct ftstat ftstat;
-  struct ftstat_def *ftsd;
+  struct ftstat_def **ftsd, *ftsd1;
+  struct ftstat_rpt_item *ftsrpti, *ftsrpti2;
+  struct ftstat_xrec xr;
   struct ftver ftv;
   struct ftvar ftvar;
   struct ftset ftset;
   struct fts3rec_offsets fo;
-  char *rec;
-  const char *fname, *dname;
-  uint32_t total_flows;
-  int i, split, done;
-  int usage_call;
+  char *rec, *brecs;
+  const char *fname, **dnames, **rnames, *wname, *cname;
+  char **runames;
+  FILE *fp, *cfp;
+  struct fts3rec_all2 cur;
+  struct report_pool pool;
+  struct report_worker *w;
+  struct stream_queue sq;
+  struct stream_ring *rings;
+  struct ftstat_def **sdefs;
+  struct report_writer writer, *rw;
+  sigset_t sigs_all, sigs_old;
+  uint32_t total_flows, nrecs, now, deadline;
+  int i, d, ndefs, done, nthreads, batch, rec_size;
+  int usage_call, all_defs, nrnames, no_flows, stream, nsnaps;
+  int nrunames, rollup;
+  uint64_t ru_xfields, need;
 
   /* init fterr */
   fterr_setid(argv[0]);
@@ -74,13 +235,28 @@ int main(int argc, char **argv)
   bzero(&ftvar, sizeof ftvar);
   total_flows = 0;
   usage_call = 0;
+  nthreads = 0;
+  ndefs = 0;
+  all_defs = 0;
+  dnames = (const char**)0L;
+  rnames = (const char**)0L;
+  nrnames = 0;
+  runames = (char**)0L;
+  nrunames = 0;
+  rollup = 0;
+  cname = (const char*)0L;
+  ftcp = (struct ftcol*)0L;
+  cfp = (FILE*)0L;
+  wname = (const char*)0L;
+  no_flows = 0;
+  nsnaps = 0;
+  rw = (struct report_writer*)0L;
 
   /* init var binding */
   if (ftvar_new(&ftvar) < 0)
     fterr_errx(1, "ftvar_new(): failed");
 
   fname = FT_PATH_CFG_STAT;
-  dname = "default";
 
   /* configure signal handler */
   if (mysignal(SIGPIPE, sig_pipe) == SIG_ERR)
@@ -89,20 +265,58 @@ int main(int argc, char **argv)
   /* defaults + no compression */
   ftset_init(&ftset, 0);
 
-  while ((i = getopt(argc, argv, "b:C:d:h?s:S:kz:v:")) != -1)
+  while ((i = getopt(argc, argv, "ab:c:C:d:h?j:nO:r:R:s:S:kz:v:w:")) != -1)
 
     switch (i) {
 
+    case 'a': /* all stat definitions */
+      all_defs = 1;
+      break;
+
+    case 'c': /* column file instead of stdin */
+      cname = optarg;
+      break;
+
     case 'd': /* debug */
       debug = atoi(optarg);
       break;
 
+    case 'j': /* worker threads */
+      nthreads = atoi(optarg);
+      if (nthreads < 0)
+        fterr_errx(1, "Threads must be >= 0.");
+      break;
+
+    case 'n': /* no flows, reports from state files only */
+      no_flows = 1;
+      break;
+
+    case 'O': /* output snapshots */
+      nsnaps = atoi(optarg);
+      if (nsnaps < 0)
+        fterr_errx(1, "Snapshots must be >= 0.");
+      break;
+
+    case 'r': /* read report state, may be repeated */
+      if (!(rnames = (const char**)realloc(rnames,
+        (nrnames+1) * sizeof (char*))))
+        fterr_err(1, "realloc()");
+      rnames[nrnames++] = optarg;
+      break;
+
+    case 'R': /* rollup file or directory, may be repeated */
+      rollup_find(optarg, &runames, &nrunames);
+      break;
+
     case 's': /* stat file name */
       fname = optarg;
       break;
 
-    case 'S': /* stat definition name */
-      dname = optarg;
+    case 'S': /* stat definition name, may be repeated */
+      if (!(dnames = (const char**)realloc(dnames,
+        (ndefs+1) * sizeof (char*))))
+        fterr_err(1, "realloc()");
+      dnames[ndefs++] = optarg;
       break;
 
     case 'v': /* variable */
@@ -110,6 +324,10 @@ int main(int argc, char **argv)
         fterr_errx(1, "ftvar_pset(%s): failed", optarg);
       break;
 
+    case 'w': /* write report state */
+      wname = optarg;
+      break;
+
     case 'h': /* help */
     case '?': 
       usage();
@@ -133,77 +351,595 @@ int main(int argc, char **argv)
   if (ftstat_load(&ftstat, &ftvar, fname))
     fterr_errx(1, "ftstat_load(): failed");
 
-  if (!(ftsd = ftstat_def_find(&ftstat, dname))) 
-    fterr_errx(1, "ftstat_find_def(%s): failed", dname);
+  if (all_defs && ndefs)
+    fterr_errx(1, "-a and -S are exclusive.");
+
+  /* all definitions, in the order of the configuration file */
+  if (all_defs) {
+
+    FT_SLIST_FOREACH(ftsd1, &ftstat.defs, chain)
+      ++ndefs;
+
+    if (!ndefs)
+      fterr_errx(1, "No stat definitions in %s.", fname);
+
+    if (!(dnames = (const char**)malloc(ndefs * sizeof (char*))))
+      fterr_err(1, "malloc()");
+
+    d = ndefs;
+    FT_SLIST_FOREACH(ftsd1, &ftstat.defs, chain)
+      dnames[--d] = ftsd1->name;
+
+  }
+
+  if (!ndefs) {
+
+    if (!(dnames = (const char**)malloc(sizeof (char*))))
+      fterr_err(1, "malloc()");
+
+    dnames[ndefs++] = "default";
+
+  }
+
+  if (!(ftsd = (struct ftstat_def**)malloc(ndefs *
+    sizeof (struct ftstat_def*))))
+    fterr_err(1, "malloc()");
+
+  for (d = 0; d < ndefs; ++d) {
+
+    if (!(ftsd[d] = ftstat_def_find(&ftstat, dnames[d])))
+      fterr_errx(1, "ftstat_find_def(%s): failed", dnames[d]);
+
+    for (i = 0; i < d; ++i)
+      if (ftsd[i] == ftsd[d])
+        fterr_errx(1, "Definition %s selected twice.", dnames[d]);
+
+  }
+
+  /* report state lives in the report, it can not be in two definitions */
+  for (d = 0; d < ndefs; ++d)
+    FT_STAILQ_FOREACH(ftsrpti, &ftsd[d]->items, chain)
+      for (i = 0; i < d; ++i)
+        FT_STAILQ_FOREACH(ftsrpti2, &ftsd[i]->items, chain)
+          if (ftsrpti->rpt == ftsrpti2->rpt)
+            fterr_errx(1, "Report %s is in definitions %s and %s.",
+              ftsrpti->rpt->name, ftsd[i]->name, ftsd[d]->name);
+
+  /* state files hold one interval */
+  if (nrnames || wname)
+    for (d = 0; d < ndefs; ++d)
+      if (ftsd[d]->max_time || ftsd[d]->window)
+        fterr_errx(1, "Definition %s is a time-series, no state files.",
+          ftsd[d]->name);
+
+  /* wall clock windows read a stream */
+  stream = 0;
+  for (d = 0; d < ndefs; ++d)
+    if (ftsd[d]->window)
+      stream = 1;
+
+  if (cname && no_flows)
+    fterr_errx(1, "-c and -n are exclusive.");
+
+  if (stream && (nthreads || no_flows))
+    fterr_errx(1, "Window definitions do not work with -j or -n.");
+
+  /*
+   * rollups replace the flows when every definition can be answered
+   * from the dimensions all of them have, else read the flows.
+   */
+  if (nrunames) {
+
+    qsort(runames, nrunames, sizeof (char*), rollup_cmp);
+
+    ru_xfields = rollup_xfields(runames, nrunames);
+
+    rollup = 1;
+
+    for (d = 0; d < ndefs; ++d)
+      if (ftstat_def_test_rollup(ftsd[d], ru_xfields)) {
+        if (no_flows)
+          fterr_errx(1, "Definition %s can not be answered from rollups.",
+            ftsd[d]->name);
+        if (debug > 0)
+          fterr_warnx("Definition %s not covered by rollups, reading flows.",
+            ftsd[d]->name);
+        rollup = 0;
+      }
+
+  }
 
   /* input is stdin */
-  if (ftio_init(&ftio, 0, FT_IO_FLAG_READ) < 0)
-    fterr_errx(1, "ftio_init(): failed");
+  if (no_flows || rollup) {
+
+    ftiop = (struct ftio*)0L;
+
+  } else if (cname) {
+
+    ftiop = (struct ftio*)0L;
+
+    if (!(cfp = fopen(cname, "r")))
+      fterr_err(1, "fopen(%s)", cname);
+
+    if (ftcol_open_read(&ftc, cfp) < 0)
+      fterr_errx(1, "ftcol_open_read(%s): failed.", cname);
+
+    ftcp = &ftc;
+
+    bcopy(&ftc.ftv, &ftv, sizeof ftv);
+
+  } else {
 
-  ftio_get_ver(&ftio, &ftv);
+    if (ftio_init(&ftio, 0, FT_IO_FLAG_READ) < 0)
+      fterr_errx(1, "ftio_init(): failed");
 
-  if (ftstat_def_test_xfields(ftsd, ftrec_xfield(&ftv)))
-    fterr_errx(1, "Report definition references a field not in flow.");
+    ftiop = &ftio;
 
-  fts3rec_compute_offsets(&fo, &ftv);
+    ftio_get_ver(&ftio, &ftv);
+
+  }
+
+  if (ftiop || ftcp) {
+
+    for (d = 0; d < ndefs; ++d)
+      if (ftstat_def_test_xfields(ftsd[d], ftrec_xfield(&ftv)))
+        fterr_errx(1, "Report definition %s references a field not in flow.",
+          ftsd[d]->name);
+
+    fts3rec_compute_offsets(&fo, &ftv);
+
+  }
+
+  /* only decode the columns the definitions read */
+  if (ftcp) {
+
+    for (d = 0, need = 0; d < ndefs; ++d)
+      need |= ftstat_def_need_xfields(ftsd[d]);
+
+    ftcol_select(ftcp, need);
+
+  }
 
   /* profile */
   ftprof_start (&ftp);
 
-  if (ftstat_def_new(ftsd)) {
-    fterr_errx(1, "ftstat_new(%s): failed.",ftsd->name);
+  for (d = 0; d < ndefs; ++d)
+    if (ftstat_def_new(ftsd[d])) {
+      fterr_errx(1, "ftstat_new(%s): failed.",ftsd[d]->name);
+    }
+
+  /* merge saved report state */
+  for (i = 0; i < nrnames; ++i) {
+
+    if (!(fp = fopen(rnames[i], "r")))
+      fterr_err(1, "fopen(%s)", rnames[i]);
+
+    if (ftstat_def_state_load(ftsd, ndefs, fp) < 0)
+      fterr_errx(1, "ftstat_def_state_load(%s): failed.", rnames[i]);
+
+    fclose(fp);
+
+  }
+
+  if (rollup) {
+    total_flows = rollup_replay(ftsd, ndefs, runames, nrunames);
+    goto calc;
   }
 
-  while ((rec = ftio_read(&ftio))) {
+  if (no_flows)
+    goto calc;
+
+  if (nsnaps) {
+    writer_start(&writer, ftiop, &ftvar, fname, dnames, ndefs, nsnaps);
+    rw = &writer;
+  }
+
+  /* masks and tags are shared between definitions on the per flow path */
+  batch = 1;
+  for (d = 0; d < ndefs; ++d)
+    if (ftsd[d]->ftmd || ftsd[d]->ftd)
+      batch = 0;
+
+  rec_size = ftcp ? (int)ftcp->hdr.rec_size : ftio_rec_size(&ftio);
+  brecs = (char*)0L;
+  nrecs = 0;
+
+  if (stream)
+    goto stream;
+
+  if (nthreads)
+    goto threaded;
+
+  if (batch && !(brecs = (char*)malloc(REPORT_BATCH_RECS * rec_size)))
+    fterr_err(1, "malloc()");
+
+  while ((rec = report_read(ftiop, ftcp))) {
 
     ++total_flows;
 
-    done = 0;
+    if (batch) {
 
-    if ((split = ftstat_def_accum(ftsd, rec, &fo)) < 0) {
-      fterr_errx(1, "ftstat_eval(%s): failed.",ftsd->name);
-    }
+      FT_RECGET_UNIX_SECS(cur,rec,fo);
 
-    if (split) {
+      /* time series split, finish the interval before this flow */
+      for (d = 0; d < ndefs; ++d) {
 
-      if (ftstat_def_calc(ftsd)) {
-        fterr_errx(1, "ftstat_dump(%s): failed.",ftsd->name);
-      }
+        if (!ftstat_def_split(ftsd[d], cur.unix_secs))
+          continue;
+
+        report_batch(ftsd, ndefs, brecs, rec_size, nrecs, &fo);
+        nrecs = 0;
 
-      if (ftstat_def_dump(&ftio, ftsd)) {
-        fterr_errx(1, "ftstat_dump(%s): failed.",ftsd->name);
+        report_emit(rw, ftiop, ftsd, d);
+
+      } /* foreach definition */
+
+      bcopy(rec, brecs + nrecs * rec_size, rec_size);
+
+      if (++nrecs == REPORT_BATCH_RECS) {
+        report_batch(ftsd, ndefs, brecs, rec_size, nrecs, &fo);
+        nrecs = 0;
       }
 
-      if (ftstat_def_reset(ftsd)) {
-        fterr_errx(1, "ftstat_def_reset(%s): failed.",ftsd->name);
+      continue;
+
+    } /* batch */
+
+    report_xrec(rw, ftiop, ftsd, ndefs, rec, &fo, &xr);
+
+  } /* while more flows */
+
+  report_batch(ftsd, ndefs, brecs, rec_size, nrecs, &fo);
+  free(brecs);
+
+  goto calc;
+
+threaded:
+
+  /*
+   * each worker loads its own copy of the configuration so filters,
+   * tags and masks are private too.
+   */
+  bzero(&pool, sizeof pool);
+  pool.nworkers = nthreads;
+  pool.ndefs = ndefs;
+  pool.rec_size = rec_size;
+  pool.batch = batch;
+  pool.fo = &fo;
+
+  if (!(pool.workers = (struct report_worker*)malloc(nthreads *
+    sizeof (struct report_worker))))
+    fterr_err(1, "malloc()");
+
+  bzero(pool.workers, nthreads * sizeof (struct report_worker));
+
+  if (pthread_mutex_init(&pool.lock, (pthread_mutexattr_t*)0L))
+    fterr_errx(1, "pthread_mutex_init(): failed");
+
+  if (pthread_cond_init(&pool.done_cond, (pthread_condattr_t*)0L))
+    fterr_errx(1, "pthread_cond_init(): failed");
+
+  for (i = 0; i < nthreads; ++i) {
+
+    w = &pool.workers[i];
+    w->pool = &pool;
+
+    if (ftstat_load(&w->ftstat, &ftvar, fname))
+      fterr_errx(1, "ftstat_load(): failed");
+
+    if (!(w->ftsd = (struct ftstat_def**)malloc(ndefs *
+      sizeof (struct ftstat_def*))))
+      fterr_err(1, "malloc()");
+
+    if (!(w->start_time = (uint32_t*)malloc(ndefs * sizeof (uint32_t))))
+      fterr_err(1, "malloc()");
+
+    for (d = 0; d < ndefs; ++d)
+      if (!(w->ftsd[d] = ftstat_def_find(&w->ftstat, dnames[d])))
+        fterr_errx(1, "ftstat_find_def(%s): failed", dnames[d]);
+
+    if (!(w->recs = (char*)malloc(REPORT_BLOCK_RECS * pool.rec_size)))
+      fterr_err(1, "malloc()");
+
+    if (pthread_cond_init(&w->cond, (pthread_condattr_t*)0L))
+      fterr_errx(1, "pthread_cond_init(): failed");
+
+  }
+
+  /* workers do not handle signals */
+  sigfillset(&sigs_all);
+  pthread_sigmask(SIG_BLOCK, &sigs_all, &sigs_old);
+
+  for (i = 0; i < nthreads; ++i)
+    if (pthread_create(&pool.workers[i].thread, (pthread_attr_t*)0L,
+      report_thread, &pool.workers[i]))
+      fterr_errx(1, "pthread_create(): failed");
+
+  pthread_sigmask(SIG_SETMASK, &sigs_old, (sigset_t*)0L);
+
+  w = report_take(&pool, ftsd);
+  nrecs = 0;
+
+  while ((rec = report_read(ftiop, ftcp))) {
+
+    ++total_flows;
+
+    FT_RECGET_UNIX_SECS(cur,rec,fo);
+
+    /* time series split, finish the interval before this flow */
+    for (d = 0; d < ndefs; ++d) {
+
+      if (!ftstat_def_split(ftsd[d], cur.unix_secs))
+        continue;
+
+      if (nrecs) {
+        report_dispatch(&pool, w, nrecs);
+        w = report_take(&pool, ftsd);
+        nrecs = 0;
       }
 
-      if ((split = ftstat_def_accum(ftsd, rec, &fo)) < 0) {
-        fterr_errx(1, "ftstat_eval(%s): failed.",ftsd->name);
+      report_flush(&pool, ftsd);
+
+      report_emit(rw, ftiop, ftsd, d);
+
+    } /* foreach definition */
+
+    if (!nrecs)
+      for (d = 0; d < ndefs; ++d)
+        w->start_time[d] = ftsd[d]->start_time;
+
+    bcopy(rec, w->recs + nrecs * pool.rec_size, pool.rec_size);
+
+    if (++nrecs == REPORT_BLOCK_RECS) {
+      report_dispatch(&pool, w, nrecs);
+      w = report_take(&pool, ftsd);
+      nrecs = 0;
+    }
+
+  } /* while more flows */
+
+  if (nrecs)
+    report_dispatch(&pool, w, nrecs);
+
+  report_flush(&pool, ftsd);
+
+  pthread_mutex_lock(&pool.lock);
+  for (i = 0; i < nthreads; ++i) {
+    pool.workers[i].state = REPORT_QUIT;
+    pthread_cond_signal(&pool.workers[i].cond);
+  }
+  pthread_mutex_unlock(&pool.lock);
+
+  for (i = 0; i < nthreads; ++i) {
+
+    w = &pool.workers[i];
+
+    pthread_join(w->thread, (void**)0L);
+
+    for (d = 0; d < w->live; ++d)
+      if (ftstat_def_free(w->ftsd[d]))
+        fterr_errx(1, "ftstat_def_free(%s): failed.", w->ftsd[d]->name);
+
+    ftstat_free(&w->ftstat);
+    pthread_cond_destroy(&w->cond);
+    free(w->start_time);
+    free(w->ftsd);
+    free(w->recs);
+
+  }
+
+  pthread_cond_destroy(&pool.done_cond);
+  pthread_mutex_destroy(&pool.lock);
+  free(pool.workers);
+
+  goto calc;
+
+stream:
+
+  bzero(&sq, sizeof sq);
+  sq.ftio = ftiop;
+  sq.ftc = ftcp;
+  sq.rec_size = rec_size;
+
+  if (!(sq.recs = (char*)malloc(STREAM_QUEUE_RECS * rec_size)) ||
+      !(sq.spare = (char*)malloc(STREAM_QUEUE_RECS * rec_size)))
+    fterr_err(1, "malloc()");
+
+  if (pthread_mutex_init(&sq.lock, (pthread_mutexattr_t*)0L))
+    fterr_errx(1, "pthread_mutex_init(): failed");
+
+  if (pthread_cond_init(&sq.cond, (pthread_condattr_t*)0L))
+    fterr_errx(1, "pthread_cond_init(): failed");
+
+  if (!(rings = (struct stream_ring*)malloc(ndefs *
+    sizeof (struct stream_ring))))
+    fterr_err(1, "malloc()");
+
+  if (!(sdefs = (struct ftstat_def**)malloc(ndefs *
+    sizeof (struct ftstat_def*))))
+    fterr_err(1, "malloc()");
+
+  bzero(rings, ndefs * sizeof (struct stream_ring));
+
+  now = time((time_t*)0L);
+
+  for (d = 0; d < ndefs; ++d) {
+
+    /* flows go to the main copy unless the window slides */
+    sdefs[d] = ftsd[d];
+
+    ftstat_def_window(ftsd[d], now);
+
+    if (ftsd[d]->window == ftsd[d]->slide)
+      continue;
+
+    rings[d].nsteps = ftsd[d]->window / ftsd[d]->slide;
+
+    if (!(rings[d].ftstat = (struct ftstat*)malloc(rings[d].nsteps *
+      sizeof (struct ftstat))))
+      fterr_err(1, "malloc()");
+
+    if (!(rings[d].ftsd = (struct ftstat_def**)malloc(rings[d].nsteps *
+      sizeof (struct ftstat_def*))))
+      fterr_err(1, "malloc()");
+
+    for (i = 0; i < rings[d].nsteps; ++i) {
+
+      if (ftstat_load(&rings[d].ftstat[i], &ftvar, fname))
+        fterr_errx(1, "ftstat_load(): failed");
+
+      if (!(rings[d].ftsd[i] = ftstat_def_find(&rings[d].ftstat[i],
+        dnames[d])))
+        fterr_errx(1, "ftstat_find_def(%s): failed", dnames[d]);
+
+      if (ftstat_def_new(rings[d].ftsd[i]))
+        fterr_errx(1, "ftstat_new(%s): failed.", dnames[d]);
+
+    }
+
+    sdefs[d] = rings[d].ftsd[0];
+
+  }
+
+  /* the reader does not handle signals */
+  sigfillset(&sigs_all);
+  pthread_sigmask(SIG_BLOCK, &sigs_all, &sigs_old);
+
+  if (pthread_create(&sq.thread, (pthread_attr_t*)0L, stream_read, &sq))
+    fterr_errx(1, "pthread_create(): failed");
+
+  pthread_sigmask(SIG_SETMASK, &sigs_old, (sigset_t*)0L);
+
+  done = 0;
+
+  while (!done) {
+
+    now = time((time_t*)0L);
+    deadline = 0;
+
+    /* report the windows ending at the steps that are over */
+    for (d = 0; d < ndefs; ++d) {
+
+      if (!ftsd[d]->window)
+        continue;
+
+      while (ftstat_def_window(ftsd[d], now)) {
+        stream_step(rw, ftiop, ftsd, d, &rings[d]);
+        sdefs[d] = rings[d].nsteps ? rings[d].ftsd[rings[d].cur] : ftsd[d];
+        ftsd[d]->window_end += ftsd[d]->slide;
       }
 
-      if (split == 1)
-        fterr_errx(1, "ftstat_def_accum(): looping on split");
+      if (!deadline || (ftsd[d]->window_end < deadline))
+        deadline = ftsd[d]->window_end;
 
-    } /* split */
+    }
+
+    nrecs = stream_take(&sq, &brecs, deadline, &done);
+
+    for (i = 0; i < nrecs; ++i) {
+
+      ++total_flows;
+
+      report_xrec(rw, ftiop, sdefs, ndefs, brecs + i * rec_size, &fo, &xr);
+
+    }
+
+    /* a time series split may have swapped in a spare copy */
+    for (d = 0; d < ndefs; ++d)
+      if (!rings[d].nsteps)
+        ftsd[d] = sdefs[d];
 
   } /* while more flows */
 
-  if (ftstat_def_calc(ftsd)) {
-    fterr_errx(1, "ftstat_dump(%s): failed.",ftsd->name);
+  pthread_join(sq.thread, (void**)0L);
+
+  /* last partial window */
+  for (d = 0; d < ndefs; ++d) {
+
+    for (i = 0; i < rings[d].nsteps; ++i) {
+
+      if (ftstat_def_merge(ftsd[d], rings[d].ftsd[i]))
+        fterr_errx(1, "ftstat_def_merge(%s): failed.", ftsd[d]->name);
+
+      if (ftstat_def_free(rings[d].ftsd[i]))
+        fterr_errx(1, "ftstat_def_free(%s): failed.", ftsd[d]->name);
+
+      ftstat_free(&rings[d].ftstat[i]);
+
+    }
+
+    if (rings[d].nsteps) {
+      free(rings[d].ftstat);
+      free(rings[d].ftsd);
+    }
+
   }
 
-  if (ftstat_def_dump(&ftio, ftsd)) {
-    fterr_errx(1, "ftstat_dump(%s): failed.",ftsd->name);
+  pthread_cond_destroy(&sq.cond);
+  pthread_mutex_destroy(&sq.lock);
+  free(sq.recs);
+  free(sq.spare);
+  free(rings);
+  free(sdefs);
+
+calc:
+
+  /* earlier intervals are written before the last one */
+  if (rw)
+    writer_stop(rw);
+
+  /* save state before ftstat_def_calc() changes it */
+  if (wname) {
+
+    if (!(fp = fopen(wname, "w")))
+      fterr_err(1, "fopen(%s)", wname);
+
+    for (d = 0; d < ndefs; ++d)
+      if (ftstat_def_state_save(ftsd[d], fp))
+        fterr_errx(1, "ftstat_def_state_save(%s): failed.", ftsd[d]->name);
+
+    if (fclose(fp))
+      fterr_err(1, "fclose(%s)", wname);
+
   }
 
-  if (ftstat_def_free(ftsd)) {
-    fterr_errx(1, "ftstat_def_free(%s): failed.",ftsd->name);
+  for (d = 0; d < ndefs; ++d) {
+
+    report_output(ftiop, ftsd[d]);
+
+    if (ftstat_def_free(ftsd[d])) {
+      fterr_errx(1, "ftstat_def_free(%s): failed.",ftsd[d]->name);
+    }
+
   }
 
-  if (ftio_close(&ftio) < 0)
+  /* ftsd may have been copies from the writer configurations */
+  if (rw)
+    writer_free(rw);
+
+  free(ftsd);
+  free(dnames);
+  free(rnames);
+
+  for (i = 0; i < nrunames; ++i)
+    free(runames[i]);
+  free(runames);
+
+  if (ftiop && (ftio_close(ftiop) < 0))
     fterr_errx(1, "ftio_close(): failed");
 
+  if (ftcp) {
+
+    if (debug > 0)
+      fterr_info("columns read=%llu bytes skipped=%llu bytes",
+        (unsigned long long)ftcp->bytes_read,
+        (unsigned long long)ftcp->bytes_skipped);
+
+    ftcol_close(ftcp);
+    fclose(cfp);
+
+  }
+
   if (debug > 0) {
     ftprof_end (&ftp, total_flows);
     ftprof_print(&ftp, argv[0], stderr);
@@ -223,9 +959,12 @@ void usage(void) {
 
   if (!first) {
 
-    fprintf(stderr, "Usage: flow-report [-h]\n");
-    fprintf(stderr, "       [-d debug_level] [-s stat_fname] [-S stat_definition]\n");
-    fprintf(stderr, "       [-v var=val]\n");
+    fprintf(stderr, "Usage: flow-report [-ahn]\n");
+    fprintf(stderr, "       [-c column_fname] [-d debug_level] [-j threads] [-O snapshots]\n");
+    fprintf(stderr, "       [-s stat_fname]\n");
+    fprintf(stderr, "       [-S stat_definition]... [-r state_fname]...\n");
+    fprintf(stderr, "       [-R rollup_fname|rollup_dir]...\n");
+    fprintf(stderr, "       [-v var=val] [-w state_fname]\n");
 
     ++first;
 
@@ -242,3 +981,770 @@ void sig_pipe(int signo)
   sig_pipe_flag = 1;
 }
 
+/*
+ * function: report_thread
+ *
+ * Worker thread.  Accumulates the blocks assigned to it into a fresh
+ * report state, which report_take() merges.
+ */
+void *report_thread(void *arg)
+{
+  struct report_worker *w;
+  struct report_pool *pool;
+  struct ftstat_xrec xr;
+  char *rec;
+  uint32_t n;
+  int d;
+
+  w = arg;
+  pool = w->pool;
+
+  pthread_mutex_lock(&pool->lock);
+
+  for (;;) {
+
+    while ((w->state != REPORT_BUSY) && (w->state != REPORT_QUIT))
+      pthread_cond_wait(&w->cond, &pool->lock);
+
+    if (w->state == REPORT_QUIT)
+      break;
+
+    pthread_mutex_unlock(&pool->lock);
+
+    /* state from the previous block was merged, start over */
+    for (d = 0; d < w->live; ++d)
+      if (ftstat_def_free(w->ftsd[d]))
+        w->err = 1;
+    w->live = 0;
+
+    for (d = 0; (d < pool->ndefs) && !w->err; ++d) {
+      if (ftstat_def_new(w->ftsd[d]))
+        w->err = 1;
+      else
+        ++w->live;
+    }
+
+    /* the reader already split the input on intervals */
+    for (d = 0; d < w->live; ++d)
+      w->ftsd[d]->start_time = w->start_time[d];
+
+    if (pool->batch) {
+
+      for (d = 0; (d < w->live) && !w->err; ++d) {
+        n = w->nrecs;
+        if (ftstat_def_accum_batch(w->ftsd[d], w->recs, pool->rec_size, &n,
+          pool->fo))
+          w->err = 1;
+      }
+
+    } else for (n = 0, rec = w->recs; (n < w->nrecs) && !w->err;
+      ++n, rec += pool->rec_size) {
+
+      ftstat_xrec_reset(&xr);
+
+      for (d = 0; (d < pool->ndefs) && !w->err; ++d)
+        if (ftstat_def_accum_xrec(w->ftsd[d], rec, pool->fo, &xr))
+          w->err = 1;
+
+    }
+
+    pthread_mutex_lock(&pool->lock);
+
+    w->state = REPORT_DONE;
+    pthread_cond_signal(&pool->done_cond);
+
+  }
+
+  pthread_mutex_unlock(&pool->lock);
+
+  return (void*)0L;
+
+} /* report_thread */
+
+/*
+ * function: report_merge
+ *
+ * Wait for w to finish its block and merge the result into each of
+ * the definitions in ftsd.
+ */
+void report_merge(struct report_pool *pool, struct report_worker *w,
+  struct ftstat_def **ftsd)
+{
+  int d;
+
+  pthread_mutex_lock(&pool->lock);
+  while (w->state == REPORT_BUSY)
+    pthread_cond_wait(&pool->done_cond, &pool->lock);
+  pthread_mutex_unlock(&pool->lock);
+
+  if (w->state == REPORT_DONE) {
+
+    if (w->err)
+      fterr_errx(1, "ftstat_def_accum(): failed.");
+
+    for (d = 0; d < pool->ndefs; ++d)
+      if (ftstat_def_merge(ftsd[d], w->ftsd[d]))
+        fterr_errx(1, "ftstat_def_merge(%s): failed.", ftsd[d]->name);
+
+    w->state = REPORT_IDLE;
+    ++pool->merged;
+
+  }
+
+} /* report_merge */
+
+/*
+ * function: report_take
+ *
+ * Get the worker for the next block.  Blocks are handed out round robin
+ * so the worker's previous block is the oldest one not merged yet, it
+ * is merged first which keeps the merges in input order.
+ *
+ * returns worker, its record buffer is free for the next block.
+ */
+struct report_worker *report_take(struct report_pool *pool,
+  struct ftstat_def **ftsd)
+{
+  struct report_worker *w;
+
+  w = &pool->workers[pool->seq % pool->nworkers];
+
+  report_merge(pool, w, ftsd);
+
+  return w;
+
+} /* report_take */
+
+/*
+ * function: report_dispatch
+ *
+ * Hand the first nrecs records in the buffer of w to the worker.
+ */
+void report_dispatch(struct report_pool *pool, struct report_worker *w,
+  uint32_t nrecs)
+{
+
+  pthread_mutex_lock(&pool->lock);
+  w->nrecs = nrecs;
+  w->state = REPORT_BUSY;
+  pthread_cond_signal(&w->cond);
+  pthread_mutex_unlock(&pool->lock);
+
+  ++pool->seq;
+
+} /* report_dispatch */
+
+/*
+ * function: report_flush
+ *
+ * Wait for and merge all dispatched blocks.
+ */
+void report_flush(struct report_pool *pool, struct ftstat_def **ftsd)
+{
+
+  while (pool->merged < pool->seq)
+    report_merge(pool, &pool->workers[pool->merged % pool->nworkers], ftsd);
+
+} /* report_flush */
+
+/*
+ * function: report_output
+ *
+ * Calculate and dump the reports of ftsd.
+ */
+void report_output(struct ftio *ftio, struct ftstat_def *ftsd)
+{
+
+  if (ftstat_def_calc(ftsd)) {
+    fterr_errx(1, "ftstat_dump(%s): failed.",ftsd->name);
+  }
+
+  if (ftstat_def_dump(ftio, ftsd)) {
+    fterr_errx(1, "ftstat_dump(%s): failed.",ftsd->name);
+  }
+
+} /* report_output */
+
+/*
+ * function: report_batch
+ *
+ * Accumulate nrecs flows in recs into each definition.  The caller
+ * already ended the batch at time series splits.
+ */
+void report_batch(struct ftstat_def **ftsd, int ndefs, char *recs,
+  int rec_size, uint32_t nrecs, struct fts3rec_offsets *fo)
+{
+  uint32_t n;
+  int d, ret;
+
+  if (!nrecs)
+    return;
+
+  for (d = 0; d < ndefs; ++d) {
+
+    n = nrecs;
+
+    if ((ret = ftstat_def_accum_batch(ftsd[d], recs, rec_size, &n, fo)) < 0)
+      fterr_errx(1, "ftstat_eval(%s): failed.",ftsd[d]->name);
+
+    if (ret == 1)
+      fterr_errx(1, "ftstat_def_accum_batch(): split inside batch");
+
+  }
+
+} /* report_batch */
+
+/*
+ * function: report_xrec
+ *
+ * Accumulate one flow into each definition, sharing the masked and
+ * tagged flow between them.  A definition whose time series interval
+ * ends at this flow is reported and reset first.
+ */
+void report_xrec(struct report_writer *rw, struct ftio *ftio,
+  struct ftstat_def **ftsd, int ndefs, char *rec, struct fts3rec_offsets *fo,
+  struct ftstat_xrec *xr)
+{
+  int d, split;
+
+  ftstat_xrec_reset(xr);
+
+  for (d = 0; d < ndefs; ++d) {
+
+    if ((split = ftstat_def_accum_xrec(ftsd[d], rec, fo, xr)) < 0) {
+      fterr_errx(1, "ftstat_eval(%s): failed.",ftsd[d]->name);
+    }
+
+    if (split) {
+
+      report_emit(rw, ftio, ftsd, d);
+
+      if ((split = ftstat_def_accum_xrec(ftsd[d], rec, fo, xr)) < 0) {
+        fterr_errx(1, "ftstat_eval(%s): failed.",ftsd[d]->name);
+      }
+
+      if (split == 1)
+        fterr_errx(1, "ftstat_def_accum(): looping on split");
+
+    } /* split */
+
+  } /* foreach definition */
+
+} /* report_xrec */
+
+/*
+ * function: stream_read
+ *
+ * Reader thread, queue the flows of q->ftio until end of input.  Waits
+ * while the queue is full.
+ */
+void *stream_read(void *arg)
+{
+  struct stream_queue *q;
+  char *rec;
+
+  q = (struct stream_queue*)arg;
+
+  while ((rec = report_read(q->ftio, q->ftc))) {
+
+    pthread_mutex_lock(&q->lock);
+
+    while (q->nrecs == STREAM_QUEUE_RECS)
+      pthread_cond_wait(&q->cond, &q->lock);
+
+    bcopy(rec, q->recs + q->nrecs * q->rec_size, q->rec_size);
+
+    /* consumer only waits on an empty queue */
+    if (!q->nrecs++)
+      pthread_cond_signal(&q->cond);
+
+    pthread_mutex_unlock(&q->lock);
+
+  }
+
+  pthread_mutex_lock(&q->lock);
+  q->eof = 1;
+  pthread_cond_signal(&q->cond);
+  pthread_mutex_unlock(&q->lock);
+
+  return (void*)0L;
+
+} /* stream_read */
+
+/*
+ * function: stream_take
+ *
+ * Wait until flows are queued, the reader is done or the wall clock
+ * reaches deadline.  The queued flows are swapped out to *recs, valid
+ * until the next call.  *eof is set when these are the last flows.
+ *
+ * returns number of flows in *recs
+ */
+uint32_t stream_take(struct stream_queue *q, char **recs, uint32_t deadline,
+  int *eof)
+{
+  struct timespec ts;
+  uint32_t nrecs;
+  char *tmp;
+
+  ts.tv_sec = deadline;
+  ts.tv_nsec = 0;
+
+  pthread_mutex_lock(&q->lock);
+
+  while (!q->nrecs && !q->eof)
+    if (pthread_cond_timedwait(&q->cond, &q->lock, &ts) == ETIMEDOUT)
+      break;
+
+  nrecs = q->nrecs;
+  *eof = q->eof;
+  tmp = q->recs;
+  q->recs = q->spare;
+  q->spare = tmp;
+  q->nrecs = 0;
+
+  /* reader may be waiting for room */
+  if (nrecs == STREAM_QUEUE_RECS)
+    pthread_cond_signal(&q->cond);
+
+  pthread_mutex_unlock(&q->lock);
+
+  *recs = tmp;
+
+  return nrecs;
+
+} /* stream_take */
+
+/*
+ * function: stream_step
+ *
+ * Report the window of ftsd[d] ending now.  For a sliding window the
+ * steps in the ring are merged into ftsd[d] first, then the oldest step
+ * is reset to accumulate the next one.
+ */
+void stream_step(struct report_writer *rw, struct ftio *ftio,
+  struct ftstat_def **ftsd, int d, struct stream_ring *ring)
+{
+  int i;
+
+  for (i = 0; i < ring->nsteps; ++i)
+    if (ftstat_def_merge(ftsd[d], ring->ftsd[i]))
+      fterr_errx(1, "ftstat_def_merge(%s): failed.", ftsd[d]->name);
+
+  report_emit(rw, ftio, ftsd, d);
+
+  if (ring->nsteps) {
+
+    ring->cur = (ring->cur + 1) % ring->nsteps;
+
+    if (ftstat_def_reset(ring->ftsd[ring->cur]))
+      fterr_errx(1, "ftstat_def_reset(%s): failed.", ftsd[d]->name);
+
+  }
+
+} /* stream_step */
+
+/*
+ * function: report_emit
+ *
+ * Output the finished interval of ftsd[d] and start the next one.
+ * Without a writer this is done inline.  With one, ftsd[d] is queued
+ * for the writer and replaced by a spare copy that continues the time
+ * series, waiting for a copy when all are queued.
+ */
+void report_emit(struct report_writer *rw, struct ftio *ftio,
+  struct ftstat_def **ftsd, int d)
+{
+  struct ftstat_def *next;
+  int i;
+
+  if (!rw) {
+
+    report_output(ftio, ftsd[d]);
+
+    if (ftstat_def_reset(ftsd[d])) {
+      fterr_errx(1, "ftstat_def_reset(%s): failed.",ftsd[d]->name);
+    }
+
+    return;
+
+  }
+
+  pthread_mutex_lock(&rw->lock);
+
+  while (!rw->nspare[d])
+    pthread_cond_wait(&rw->cond, &rw->lock);
+
+  next = rw->spare[d][--rw->nspare[d]];
+
+  pthread_mutex_unlock(&rw->lock);
+
+  next->start_time = ftsd[d]->start_time;
+  next->window_end = ftsd[d]->window_end;
+  next->interval = ftsd[d]->interval + 1;
+
+  pthread_mutex_lock(&rw->lock);
+
+  i = (rw->head + rw->n) % rw->qlen;
+  rw->queue[i] = ftsd[d];
+  rw->queue_d[i] = d;
+  ++rw->n;
+
+  pthread_cond_broadcast(&rw->cond);
+  pthread_mutex_unlock(&rw->lock);
+
+  ftsd[d] = next;
+
+} /* report_emit */
+
+/*
+ * function: writer_start
+ *
+ * Load nsnaps private copies of the configuration as spares for each
+ * selected definition and start the writer thread.
+ */
+void writer_start(struct report_writer *rw, struct ftio *ftio,
+  struct ftvar *ftvar, const char *fname, const char **dnames, int ndefs,
+  int nsnaps)
+{
+  sigset_t sigs_all, sigs_old;
+  int i, d;
+
+  bzero(rw, sizeof *rw);
+  rw->ftio = ftio;
+  rw->ndefs = ndefs;
+  rw->nsnaps = nsnaps;
+  rw->qlen = ndefs * nsnaps;
+
+  if (!(rw->ftstat = (struct ftstat*)malloc(nsnaps * sizeof (struct ftstat))))
+    fterr_err(1, "malloc()");
+
+  if (!(rw->spare = (struct ftstat_def***)malloc(ndefs *
+    sizeof (struct ftstat_def**))))
+    fterr_err(1, "malloc()");
+
+  if (!(rw->nspare = (int*)malloc(ndefs * sizeof (int))))
+    fterr_err(1, "malloc()");
+
+  if (!(rw->queue = (struct ftstat_def**)malloc(rw->qlen *
+    sizeof (struct ftstat_def*))))
+    fterr_err(1, "malloc()");
+
+  if (!(rw->queue_d = (int*)malloc(rw->qlen * sizeof (int))))
+    fterr_err(1, "malloc()");
+
+  for (d = 0; d < ndefs; ++d) {
+
+    if (!(rw->spare[d] = (struct ftstat_def**)malloc(nsnaps *
+      sizeof (struct ftstat_def*))))
+      fterr_err(1, "malloc()");
+
+    rw->nspare[d] = 0;
+
+  }
+
+  for (i = 0; i < nsnaps; ++i) {
+
+    if (ftstat_load(&rw->ftstat[i], ftvar, fname))
+      fterr_errx(1, "ftstat_load(): failed");
+
+    for (d = 0; d < ndefs; ++d) {
+
+      if (!(rw->spare[d][i] = ftstat_def_find(&rw->ftstat[i], dnames[d])))
+        fterr_errx(1, "ftstat_find_def(%s): failed", dnames[d]);
+
+      if (ftstat_def_new(rw->spare[d][i]))
+        fterr_errx(1, "ftstat_new(%s): failed.", dnames[d]);
+
+      ++rw->nspare[d];
+
+    }
+
+  }
+
+  if (pthread_mutex_init(&rw->lock, (pthread_mutexattr_t*)0L))
+    fterr_errx(1, "pthread_mutex_init(): failed");
+
+  if (pthread_cond_init(&rw->cond, (pthread_condattr_t*)0L))
+    fterr_errx(1, "pthread_cond_init(): failed");
+
+  /* the writer does not handle signals */
+  sigfillset(&sigs_all);
+  pthread_sigmask(SIG_BLOCK, &sigs_all, &sigs_old);
+
+  if (pthread_create(&rw->thread, (pthread_attr_t*)0L, writer_thread, rw))
+    fterr_errx(1, "pthread_create(): failed");
+
+  pthread_sigmask(SIG_SETMASK, &sigs_old, (sigset_t*)0L);
+
+} /* writer_start */
+
+/*
+ * function: writer_thread
+ *
+ * Calculate and dump the queued intervals in order, then reset each
+ * copy and return it to the spares of its definition.
+ */
+void *writer_thread(void *arg)
+{
+  struct report_writer *rw;
+  struct ftstat_def *ftsd;
+  int d;
+
+  rw = (struct report_writer*)arg;
+
+  pthread_mutex_lock(&rw->lock);
+
+  while (1) {
+
+    while (!rw->n && !rw->quit)
+      pthread_cond_wait(&rw->cond, &rw->lock);
+
+    if (!rw->n)
+      break;
+
+    ftsd = rw->queue[rw->head];
+    d = rw->queue_d[rw->head];
+    rw->head = (rw->head + 1) % rw->qlen;
+    --rw->n;
+
+    pthread_mutex_unlock(&rw->lock);
+
+    report_output(rw->ftio, ftsd);
+
+    if (ftstat_def_reset(ftsd)) {
+      fterr_errx(1, "ftstat_def_reset(%s): failed.",ftsd->name);
+    }
+
+    pthread_mutex_lock(&rw->lock);
+
+    rw->spare[d][rw->nspare[d]++] = ftsd;
+
+    pthread_cond_broadcast(&rw->cond);
+
+  }
+
+  pthread_mutex_unlock(&rw->lock);
+
+  return (void*)0L;
+
+} /* writer_thread */
+
+/*
+ * function: writer_stop
+ *
+ * Wait for the queued intervals to be written and stop the writer
+ * thread.
+ */
+void writer_stop(struct report_writer *rw)
+{
+
+  pthread_mutex_lock(&rw->lock);
+  rw->quit = 1;
+  pthread_cond_broadcast(&rw->cond);
+  pthread_mutex_unlock(&rw->lock);
+
+  pthread_join(rw->thread, (void**)0L);
+
+} /* writer_stop */
+
+/*
+ * function: writer_free
+ *
+ * Free the spare copies and the private configurations, after the
+ * definitions in use are freed.
+ */
+void writer_free(struct report_writer *rw)
+{
+  int i, d;
+
+  /* spares may include copies from the main configuration */
+  for (d = 0; d < rw->ndefs; ++d) {
+
+    for (i = 0; i < rw->nspare[d]; ++i)
+      if (ftstat_def_free(rw->spare[d][i]))
+        fterr_errx(1, "ftstat_def_free(%s): failed.", rw->spare[d][i]->name);
+
+    free(rw->spare[d]);
+
+  }
+
+  for (i = 0; i < rw->nsnaps; ++i)
+    ftstat_free(&rw->ftstat[i]);
+
+  pthread_cond_destroy(&rw->cond);
+  pthread_mutex_destroy(&rw->lock);
+  free(rw->ftstat);
+  free(rw->spare);
+  free(rw->nspare);
+  free(rw->queue);
+  free(rw->queue_d);
+
+} /* writer_free */
+
+/*
+ * function: report_read
+ *
+ * Next flow of the column file ftc, or of ftio without one.
+ *
+ * returns: record
+ *          0L end of input
+ */
+char *report_read(struct ftio *ftio, struct ftcol *ftc)
+{
+
+  if (ftc)
+    return ftcol_read(ftc);
+
+  return (char*)ftio_read(ftio);
+
+} /* report_read */
+
+/*
+ * function: rollup_find
+ *
+ * Add path to names if it is a file, else the rollup files (named
+ * FT_ROLLUP_PREFIX...) below the directory path.
+ */
+void rollup_find(const char *path, char ***names, int *nnames)
+{
+  struct stat sb;
+  struct dirent *dirent;
+  DIR *dirp;
+  char *sub;
+
+  if (stat(path, &sb) < 0)
+    fterr_err(1, "stat(%s)", path);
+
+  if (!S_ISDIR(sb.st_mode)) {
+
+    if (!(*names = (char**)realloc(*names, (*nnames+1) * sizeof (char*))))
+      fterr_err(1, "realloc()");
+
+    if (!((*names)[*nnames] = strdup(path)))
+      fterr_err(1, "strdup()");
+
+    ++*nnames;
+
+    return;
+
+  }
+
+  if (!(dirp = opendir(path)))
+    fterr_err(1, "opendir(%s)", path);
+
+  while ((dirent = readdir(dirp))) {
+
+    if (!strcmp(dirent->d_name, ".") || !strcmp(dirent->d_name, ".."))
+      continue;
+
+    if (!(sub = (char*)malloc(strlen(path) + strlen(dirent->d_name) + 2)))
+      fterr_err(1, "malloc()");
+
+    sprintf(sub, "%s/%s", path, dirent->d_name);
+
+    if (stat(sub, &sb) < 0)
+      fterr_err(1, "stat(%s)", sub);
+
+    if (S_ISDIR(sb.st_mode) || (S_ISREG(sb.st_mode) &&
+      !strncmp(dirent->d_name, FT_ROLLUP_PREFIX, strlen(FT_ROLLUP_PREFIX))))
+      rollup_find(sub, names, nnames);
+
+    free(sub);
+
+  }
+
+  closedir(dirp);
+
+} /* rollup_find */
+
+/*
+ * function: rollup_cmp
+ *
+ * qsort() rollup names, the capture time is in the name.
+ */
+int rollup_cmp(const void *a, const void *b)
+{
+
+  return strcmp(*(char* const*)a, *(char* const*)b);
+
+} /* rollup_cmp */
+
+/*
+ * function: rollup_xfields
+ *
+ * Dimensions common to all the rollups in names.
+ */
+uint64_t rollup_xfields(char **names, int nnames)
+{
+  struct ftrollup_rd rd;
+  uint64_t xfields;
+  FILE *fp;
+  int i;
+
+  xfields = FT_ROLLUP_XFIELDS;
+
+  for (i = 0; i < nnames; ++i) {
+
+    if (!(fp = fopen(names[i], "r")))
+      fterr_err(1, "fopen(%s)", names[i]);
+
+    if (ftrollup_open(&rd, fp) < 0)
+      fterr_errx(1, "ftrollup_open(%s): failed.", names[i]);
+
+    xfields &= rd.hdr.xfields;
+
+    fclose(fp);
+
+  }
+
+  return xfields;
+
+} /* rollup_xfields */
+
+/*
+ * function: rollup_replay
+ *
+ * Accumulate the rows of the rollups in names into each definition.
+ *
+ * returns: number of records replayed
+ */
+uint32_t rollup_replay(struct ftstat_def **ftsd, int ndefs, char **names,
+  int nnames)
+{
+  struct ftrollup_rd rd;
+  uint32_t nrecs;
+  FILE *fp;
+  char *rec;
+  int i, d, ret;
+
+  nrecs = 0;
+
+  for (i = 0; i < nnames; ++i) {
+
+    if (!(fp = fopen(names[i], "r")))
+      fterr_err(1, "fopen(%s)", names[i]);
+
+    if (ftrollup_open(&rd, fp) < 0)
+      fterr_errx(1, "ftrollup_open(%s): failed.", names[i]);
+
+    while ((ret = ftrollup_read(&rd, &rec)) > 0) {
+
+      ++nrecs;
+
+      for (d = 0; d < ndefs; ++d)
+        if (ftstat_def_accum(ftsd[d], rec, &rd.fo) < 0)
+          fterr_errx(1, "ftstat_def_accum(): failed.");
+
+    }
+
+    if (ret < 0)
+      fterr_errx(1, "ftrollup_read(%s): failed.", names[i]);
+
+    fclose(fp);
+
+  }
+
+  return nrecs;
+
+} /* rollup_replay */
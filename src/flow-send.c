@@ -53,9 +53,21 @@
 
 int debug;
 
+/* transmit pacing */
+struct xmit_pace {
+  int tx_delay;            /* fixed microsecond delay after each PDU */
+  struct ftpace pdus;      /* PDUs/second token bucket */
+  struct ftpace flows;     /* flows/second token bucket */
+  double speed;            /* original timing speed-up, 0 disables */
+  int64_t rec_t0;          /* export time of first PDU (ns) */
+  int64_t wall_t0;         /* ftpace_now() when first PDU was sent */
+  int64_t wait_ns;         /* total time spent pacing */
+  uint64_t npdus;          /* PDUs sent */
+};
+
 void usage(void);
 
-void pdu_xmit(int tx_delay, int src_ip_spoof, int hdr_len,
+void pdu_xmit(struct xmit_pace *xp, int src_ip_spoof, int hdr_len,
   struct ip *ip_hdr, struct udphdr *udp_hdr,
   int sock, struct ftencode *fte, struct ftpeeri *ftpi);
 
@@ -70,18 +82,23 @@ int main(int argc, char **argv)
   struct ftencode fte;
   struct ftpeeri ftpi;
   struct ftipmask ftipmask;
+  struct xmit_pace xp;
   void (*xlate)(void *in_rec, void *out_rec);
   char xl_rec[FT_IO_MAXREC], *out_rec;
   uint32_t privacy_mask;
   unsigned int v1, v2, one;
-  int i, n, ret, tx_delay, udp_sock;
+  int i, n, ret, udp_sock;
+  double pdu_rate, flow_rate;
+  uint32_t burst;
   int src_ip_spoof, hdr_len = 0;
   void *rec;
 
   /* init fterr */
   fterr_setid(argv[0]);
 
-  tx_delay = 0;
+  bzero(&xp, sizeof xp);
+  pdu_rate = flow_rate = 0;
+  burst = 0;
   bzero(&loc_addr, sizeof (struct sockaddr_in));
   bzero(&rem_addr, sizeof (struct sockaddr_in));
   bzero(&ftv, sizeof ftv);
@@ -91,13 +108,23 @@ int main(int argc, char **argv)
   /* profile */
   ftprof_start (&ftp);
 
-  while ((i = getopt(argc, argv, "d:h?m:sV:x:")) != -1)
+  while ((i = getopt(argc, argv, "b:d:f:h?m:r:sT:V:x:")) != -1)
     switch (i) {
 
+    case 'b': /* pacing burst */
+      burst = strtoul(optarg, (char**)0L, 0);
+      break;
+
     case 'd': /* debug */
       debug = atoi(optarg);
       break;
 
+    case 'f': /* flows/second */
+      flow_rate = strtod(optarg, (char**)0L);
+      if (flow_rate <= 0)
+        fterr_errx(1, "Flow rate must be > 0");
+      break;
+
     case 'h': /* help */
     case '?':
       usage();
@@ -108,10 +135,22 @@ int main(int argc, char **argv)
       privacy_mask = scan_ip(optarg);
       break;
 
+    case 'r': /* PDUs/second */
+      pdu_rate = strtod(optarg, (char**)0L);
+      if (pdu_rate <= 0)
+        fterr_errx(1, "PDU rate must be > 0");
+      break;
+
     case 's': /* source ip preserve */
       src_ip_spoof = 1;
       break;
 
+    case 'T': /* original timing, speed-up factor */
+      xp.speed = strtod(optarg, (char**)0L);
+      if (xp.speed <= 0)
+        fterr_errx(1, "Speed-up factor must be > 0");
+      break;
+
     case 'V': /* PDU version */
       n = sscanf(optarg, "%u.%u", &v1, &v2);
       if (n == 1) {
@@ -129,7 +168,7 @@ int main(int argc, char **argv)
       break;
 
     case 'x': /* transmitter delay */
-      tx_delay = atoi(optarg);
+      xp.tx_delay = atoi(optarg);
       break;
 
     default:
@@ -145,6 +184,22 @@ int main(int argc, char **argv)
     exit (1);
   }
 
+  /*
+   * default burst is ~1ms worth of traffic.  The flow bucket must
+   * hold at least one full PDU or every PDU would block.
+   */
+  if (pdu_rate) {
+    if (ftpace_init(&xp.pdus, pdu_rate, burst ? burst :
+      (uint32_t)(pdu_rate / 1000)) < 0)
+      fterr_errx(1, "ftpace_init(): failed");
+  }
+
+  if (flow_rate) {
+    if (ftpace_init(&xp.flows, flow_rate, burst ? burst :
+      (uint32_t)(flow_rate / 1000) + FT_PDU_V8_1_MAXFLOWS) < 0)
+      fterr_errx(1, "ftpace_init(): failed");
+  }
+
   /* get localip/rem_ip/port/ttl */
   ftpi = scan_peeri(argv[optind]);
 
@@ -294,7 +349,7 @@ retry:
 
     if (ret <= 0) {
 
-      pdu_xmit(tx_delay, src_ip_spoof, hdr_len, ip_hdr, udp_hdr, udp_sock,
+      pdu_xmit(&xp, src_ip_spoof, hdr_len, ip_hdr, udp_hdr, udp_sock,
         &fte, &ftpi);
 
       /* if ret < 0 then the current record was not encoded */
@@ -307,7 +362,7 @@ retry:
   /* any left over? */
   if (fte.buf_size) {
 
-    pdu_xmit(tx_delay, src_ip_spoof, hdr_len, ip_hdr, udp_hdr, udp_sock,
+    pdu_xmit(&xp, src_ip_spoof, hdr_len, ip_hdr, udp_hdr, udp_sock,
       &fte, &ftpi);
 
   } /* fte.buf_size */
@@ -315,6 +370,8 @@ retry:
   if (debug > 0) {
     ftprof_end(&ftp, ftio_get_rec_total(&ftio));
     ftprof_print(&ftp, argv[0], stderr);
+    fprintf(stderr, "%s: sent %llu PDUs, paced %.3f seconds\n", argv[0],
+      (unsigned long long)xp.npdus, (double)xp.wait_ns / 1000000000.0);
   }
 
   return ret;
@@ -322,12 +379,48 @@ retry:
 } /* main */
 
 
-void pdu_xmit(int tx_delay, int src_ip_spoof, int hdr_len,
+void pdu_xmit(struct xmit_pace *xp, int src_ip_spoof, int hdr_len,
   struct ip *ip_hdr, struct udphdr *udp_hdr,
   int sock, struct ftencode *fte, struct ftpeeri *ftpi)
 {
+  struct ftpdu_header *ph;
+  int64_t t0, rec_t;
   int sum;
 
+  /*
+   * the common header is still in host byte order.  v1 lacks
+   * flow_sequence and the engine fields but shares the leading
+   * version/count/sysUpTime/unix_secs/unix_nsecs layout.
+   */
+  ph = (struct ftpdu_header*)fte->buf_enc;
+
+  t0 = 0;
+
+  /* original timing, schedule relative to the first PDU's export time */
+  if (xp->speed) {
+
+    rec_t = (int64_t)ph->unix_secs * 1000000000LL + ph->unix_nsecs;
+
+    if (!xp->npdus) {
+
+      xp->rec_t0 = rec_t;
+      xp->wall_t0 = ftpace_now();
+
+    } else if (rec_t > xp->rec_t0) {
+
+      /* records out of order are sent immediately */
+      t0 = ftpace_now();
+      ftpace_sleep_until(xp->wall_t0 +
+        (int64_t)((double)(rec_t - xp->rec_t0) / xp->speed));
+      xp->wait_ns += ftpace_now() - t0;
+
+    }
+
+  } /* xp->speed */
+
+  xp->wait_ns += ftpace_wait(&xp->pdus, 1);
+  xp->wait_ns += ftpace_wait(&xp->flows, ph->count);
+
   /* convert pdu to network byte order */
 #if BYTE_ORDER == LITTLE_ENDIAN
   ftpdu_swap(fte->buf_enc, BYTE_ORDER);
@@ -379,8 +472,10 @@ again:
 
   }
 
-  if (tx_delay)
-    usleep((unsigned)tx_delay);
+  if (xp->tx_delay)
+    usleep((unsigned)xp->tx_delay);
+
+  ++xp->npdus;
 
   /* reset encode buffer */
   ftencode_reset(fte);
@@ -388,7 +483,8 @@ again:
 } /* pdu_xmit */
 
 void usage(void) {
-  fprintf(stderr, "Usage: flow-send [-h] [-d debug_level] [-x xmit_delay] [-V pdu_version]\n");
-  fprintf(stderr, "       localip/remoteip/port\n");
+  fprintf(stderr, "Usage: flow-send [-hs] [-d debug_level] [-m privacy_mask] [-x xmit_delay]\n");
+  fprintf(stderr, "       [-r pdu_rate] [-f flow_rate] [-b burst] [-T speed]\n");
+  fprintf(stderr, "       [-V pdu_version] localip/remoteip/port\n");
 } /* usage */
 
@@ -132,6 +132,7 @@ struct fmtargs {
   int sort_order;
   int options;
   int tally;
+  uint64_t records;
   char cc;
 };
 
@@ -146,28 +147,29 @@ int tbl_out1(struct fmtargs *args, unsigned int nindex, struct fopdi *stat,
   struct fopd *total, char *title, const char *symfile);
 
 int chash_c32_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total, char *title, const char *symfile);
+  uint64_t records, struct fopd *total, char *title, const char *symfile);
 
 int chash_c322_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total, char *title, char *title2, const char *symfile);
+  uint64_t records, struct fopd *total, char *title, char *title2,
+  const char *symfile);
 
 int chash_ip_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total);
+  uint64_t records, struct fopd *total);
 
 int chash_ip2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total);
+  uint64_t records, struct fopd *total);
 
 int chash_as2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total, const char *symfile);
+  uint64_t records, struct fopd *total, const char *symfile);
 
 int chash_if2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total);
+  uint64_t records, struct fopd *total);
 
 int chash_pre_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total);
+  uint64_t records, struct fopd *total);
 
 int chash_pre2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total);
+  uint64_t records, struct fopd *total);
 
 
 int format0(struct fmtargs *args); int format1(struct fmtargs *args);
@@ -333,8 +335,9 @@ int main(int argc, char **argv)
   print_header = 0;
   args.cc = '#';
   args.sort_order = 0;
+  args.records = 0;
 
-  while ((i = getopt(argc, argv, "c:d:f:h?npPs:S:t:T:w")) != -1)
+  while ((i = getopt(argc, argv, "c:d:f:h?l:npPs:S:t:T:w")) != -1)
 
     switch (i) {
 
@@ -356,6 +359,10 @@ int main(int argc, char **argv)
       ++usage_call;
       break;
 
+    case 'l': /* record limit */
+      args.records = strtoull(optarg, (char**)0L, 0);
+      break;
+
     case 'n': /* use names */
       args.options |= FT_OPT_NAMES;
       break;
@@ -869,8 +876,8 @@ int format1(struct fmtargs *args)
 
   }
 
-  chash_c32_dump(ftch, args->cc, args->sort_order, args->options, &total,
-    "Pkt Size", (char*)0L);
+  chash_c32_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total, "Pkt Size", (char*)0L);
 
   ftchash_free(ftch);
 
@@ -938,8 +945,8 @@ int format2(struct fmtargs *args)
        
   }
 
-  chash_c32_dump(ftch, args->cc, args->sort_order, args->options, &total,
-    "Packets ", (char*)0L);
+  chash_c32_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total, "Packets ", (char*)0L);
 
   ftchash_free(ftch);
 
@@ -1006,8 +1013,8 @@ int format3(struct fmtargs *args)
 
   }
 
-  chash_c32_dump(ftch, args->cc, args->sort_order, args->options, &total,
-    "Octets  ", (char*)0L);
+  chash_c32_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total, "Octets  ", (char*)0L);
      
   ftchash_free(ftch);
     
@@ -1277,7 +1284,8 @@ int format8(struct fmtargs *args)
 
   }
 
-  chash_ip_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_ip_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
 
   ftchash_free(ftch);
 
@@ -1345,7 +1353,8 @@ int format9(struct fmtargs *args)
 
   }
 
-  chash_ip_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_ip_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
 
   ftchash_free(ftch);
 
@@ -1415,7 +1424,8 @@ int format10(struct fmtargs *args)
 
   }
 
-  chash_ip2_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_ip2_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
       
   ftchash_free(ftch);
 
@@ -1495,7 +1505,8 @@ int format11(struct fmtargs *args)
 
   }
 
-  chash_ip_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_ip_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
       
   ftchash_free(ftch);
 
@@ -1811,7 +1822,8 @@ int format16(struct fmtargs *args)
 
   }
 
-  chash_ip_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_ip_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
       
   ftchash_free(ftch);
 
@@ -2103,7 +2115,7 @@ int format21(struct fmtargs *args)
   }
 
   chash_as2_dump(ftch, args->cc, args->sort_order, args->options,
-    &total, FT_PATH_SYM_ASN);
+    args->records, &total, FT_PATH_SYM_ASN);
     
   ftchash_free(ftch);
 
@@ -2226,7 +2238,8 @@ int format23(struct fmtargs *args)
 
   }
 
-  chash_if2_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_if2_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
     
   ftchash_free(ftch);
 
@@ -2300,7 +2313,8 @@ int format24(struct fmtargs *args)
 
   }
 
-  chash_pre_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_pre_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
 
   ftchash_free(ftch);
 
@@ -2374,7 +2388,8 @@ int format25(struct fmtargs *args)
 
   }
 
-  chash_pre_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_pre_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
 
   ftchash_free(ftch);
 
@@ -2457,7 +2472,8 @@ int format26(struct fmtargs *args)
 
   }
 
-  chash_pre2_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_pre2_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
 
   ftchash_free(ftch);
 
@@ -2525,7 +2541,8 @@ int format27(struct fmtargs *args)
 
   } /* while */
 
-  chash_ip_dump(ftch, args->cc, args->sort_order, args->options, &total);
+  chash_ip_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total);
 
   ftchash_free(ftch);
 
@@ -2702,8 +2719,8 @@ int format30(struct fmtargs *args)
 
   } /* while */
 
-  chash_c32_dump(ftch, args->cc, args->sort_order, args->options, &total,
-    "Src Tag ", FT_PATH_SYM_TAG);
+  chash_c32_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total, "Src Tag ", FT_PATH_SYM_TAG);
   
   ftchash_free(ftch);
     
@@ -2771,8 +2788,8 @@ int format31(struct fmtargs *args)
 
   } /* while */
 
-  chash_c32_dump(ftch, args->cc, args->sort_order, args->options, &total,
-    "Dst Tag ", FT_PATH_SYM_TAG);
+  chash_c32_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total, "Dst Tag ", FT_PATH_SYM_TAG);
   
   ftchash_free(ftch);
     
@@ -2843,8 +2860,8 @@ int format32(struct fmtargs *args)
 
   } /* while */
 
-  chash_c322_dump(ftch, args->cc, args->sort_order, args->options, &total,
-    "Src Tag ", "Dst Tag   ", FT_PATH_SYM_TAG);
+  chash_c322_dump(ftch, args->cc, args->sort_order, args->options,
+    args->records, &total, "Src Tag ", "Dst Tag   ", FT_PATH_SYM_TAG);
   
   ftchash_free(ftch);
     
@@ -2854,10 +2871,11 @@ int format32(struct fmtargs *args)
 
 
 int chash_ip_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total)
+  uint64_t records, struct fopd *total)
 {
   struct ftchash_rec_ip *ftch_recip;
   char fmt_buf[256];
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   if (sort_order) {
@@ -2887,7 +2905,7 @@ int chash_ip_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -2903,10 +2921,14 @@ int chash_ip_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c IPaddr         flows                 octets                packets\n%c\n", cc, cc, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   while ((ftch_recip = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_PERCENT) {
   
       fmt_ipv4(fmt_buf, ftch_recip->addr, FMT_PAD_RIGHT);
@@ -2954,10 +2976,11 @@ int chash_ip_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 } /* chash_ip_dump */
 
 int chash_ip2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total)
+  uint64_t records, struct fopd *total)
 {
   struct ftchash_rec_ip2 *ftch_recip2;
   char fmt_buf[256];
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   if (sort_order) {
@@ -2990,7 +3013,7 @@ int chash_ip2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3006,10 +3029,14 @@ int chash_ip2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c src IPaddr     dst IPaddr       flows                 octets                packets\n%c\n", cc, cc, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   while ((ftch_recip2 = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_PERCENT) {
 
       len = fmt_ipv4(fmt_buf, ftch_recip2->src_addr, FMT_PAD_RIGHT);
@@ -3060,11 +3087,12 @@ int chash_ip2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 
 
 int chash_as2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total, const char *symfile)
+  uint64_t records, struct fopd *total, const char *symfile)
 {
   struct ftchash_rec_as2 *ftch_recas2;
   struct ftsym *ftsym;
   char fmt_buf[256], fmt_buf1[64], fmt_buf2[64];
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   ftsym = (struct ftsym*)0L;
@@ -3099,7 +3127,7 @@ int chash_as2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3118,10 +3146,14 @@ int chash_as2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c src AS          dst AS            flows                 octets                packets\n%c\n", cc, cc, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   while ((ftch_recas2 = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     fmt_uint16s(ftsym, 18, fmt_buf1, (uint16_t)ftch_recas2->src_as,
       FMT_PAD_RIGHT);
     fmt_uint16s(ftsym, 18, fmt_buf2, (uint16_t)ftch_recas2->dst_as,
@@ -3172,10 +3204,11 @@ int chash_as2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 } /* chash_as2_dump */
 
 int chash_if2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total)
+  uint64_t records, struct fopd *total)
 {
   struct ftchash_rec_if2 *ftch_recif2;
   char fmt_buf[256];
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   if (sort_order) {
@@ -3208,7 +3241,7 @@ int chash_if2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3224,10 +3257,14 @@ int chash_if2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c in   out    flows                 octets                packets\n%c\n", cc, cc, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   while ((ftch_recif2 = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_PERCENT) {
 
       len = fmt_uint16(fmt_buf, ftch_recif2->input, FMT_PAD_RIGHT);
@@ -3279,10 +3316,11 @@ int chash_if2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 } /* chash_if2_dump */
 
 int chash_pre_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total)
+  uint64_t records, struct fopd *total)
 {
   struct ftchash_rec_prefix *ftch_recpre;
   char fmt_buf[256];
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   if (sort_order) {
@@ -3312,7 +3350,7 @@ int chash_pre_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3328,10 +3366,14 @@ int chash_pre_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c Source Prefix     flows                 octets                packets\n%c\n", cc, cc, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   while ((ftch_recpre = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_PERCENT) {
   
       fmt_ipv4prefix(fmt_buf, ftch_recpre->prefix, ftch_recpre->mask,
@@ -3380,10 +3422,11 @@ int chash_pre_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 } /* chash_pre_dump */
 
 int chash_pre2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total)
+  uint64_t records, struct fopd *total)
 {
   struct ftchash_rec_prefix2 *ftch_recpre2;
   char fmt_buf[256];
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   if (sort_order) {
@@ -3416,7 +3459,7 @@ int chash_pre2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3432,10 +3475,14 @@ int chash_pre2_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c Source Prefix     Destination Prefix  flows                 octets                packets\n%c\n", cc, cc, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   while ((ftch_recpre2 = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_PERCENT) {
   
       len = fmt_ipv4prefix(fmt_buf, ftch_recpre2->src_prefix,
@@ -3716,11 +3763,12 @@ int tbl_out1(struct fmtargs *args, unsigned int nindex, struct fopdi *stat,
 } /* tbl_out1 */
 
 int chash_c32_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total, char *title, const char *symfile)
+  uint64_t records, struct fopd *total, char *title, const char *symfile)
 {
   struct ftsym *ftsym;
   struct ftchash_rec_c32 *ftch_recc32;
   char fmt_buf[256], fmt_buf2[64], *fmt_bufp;
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   ftsym = (struct ftsym*)0L;
@@ -3752,7 +3800,7 @@ int chash_c32_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3769,6 +3817,7 @@ int chash_c32_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c %s  flows                 octets                packets\n%c\n", cc, cc, title, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   if (options & FT_OPT_NAMES) {
@@ -3777,6 +3826,9 @@ int chash_c32_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 
   while ((ftch_recc32 = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_PERCENT) {
  
       if (options & FT_OPT_NAMES) {
@@ -3842,11 +3894,13 @@ int chash_c32_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 
 
 int chash_c322_dump (struct ftchash *ftch, char cc, int sort_order, int options,
-  struct fopd *total, char *title, char *title2, const char *symfile)
+  uint64_t records, struct fopd *total, char *title, char *title2,
+  const char *symfile)
 {
   struct ftchash_rec_c322 *ftch_recc322;
   struct ftsym *ftsym;
   char fmt_buf[256], fmt_buf2[256], *fmt_buf_a, *fmt_buf_b;
+  uint64_t nrecs;
   int len, sort_flags, sort_offset;
 
   ftsym = (struct ftsym*)0L;
@@ -3881,7 +3935,7 @@ int chash_c322_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       return -1;
     }
 
-    ftchash_sort(ftch, sort_offset, sort_flags);
+    ftchash_sort_topk(ftch, sort_offset, sort_flags, records);
 
   } /* sorted? */
 
@@ -3899,6 +3953,7 @@ int chash_c322_dump (struct ftchash *ftch, char cc, int sort_order, int options,
       printf("%c\n%c %s  %s  flows                 octets                packets\n%c\n", cc, cc, title, title2, cc);
   }
 
+  nrecs = 0;
   ftchash_first(ftch);
 
   if (options & FT_OPT_NAMES) {
@@ -3907,6 +3962,9 @@ int chash_c322_dump (struct ftchash *ftch, char cc, int sort_order, int options,
 
   while ((ftch_recc322 = ftchash_foreach(ftch))) {
 
+    if (records && (nrecs++ == records))
+      break;
+
     if (options & FT_OPT_NAMES) {
 
       if (ftsym_findbyval(ftsym, ftch_recc322->c32a, &fmt_buf_a) != 1) {
@@ -3995,7 +4053,7 @@ void usage(void)
   if (!first) {
 
     fprintf(stderr, "Usage: flow-stat [-hnpPw] [-d debug_level] [-f format] [-S sort_field]\n");
-    fprintf(stderr, "       [-s sort_field] [-t tally_lines] [-T title]\n");
+    fprintf(stderr, "       [-s sort_field] [-t tally_lines] [-T title] [-l records]\n");
 
     ++first;
 